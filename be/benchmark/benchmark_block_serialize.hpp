@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/data.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "agent/be_exec_version_manager.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// A block like the ones exchanged between fragments: an id column, a low cardinality int column
+// and a string column.
+inline Block make_exchange_block(size_t rows) {
+    std::mt19937_64 rng(rows);
+    auto id_column = ColumnInt64::create();
+    auto int_column = ColumnInt32::create();
+    auto str_column = ColumnString::create();
+    for (size_t i = 0; i < rows; ++i) {
+        id_column->insert_value(static_cast<int64_t>(i));
+        int_column->insert_value(static_cast<int32_t>(rng() % 100));
+        auto value = "value_" + std::to_string(rng() % 1000);
+        str_column->insert_data(value.data(), value.size());
+    }
+    Block block;
+    block.insert({std::move(id_column), std::make_shared<DataTypeInt64>(), "id"});
+    block.insert({std::move(int_column), std::make_shared<DataTypeInt32>(), "i"});
+    block.insert({std::move(str_column), std::make_shared<DataTypeString>(), "s"});
+    return block;
+}
+
+static void BM_BlockSerialize(benchmark::State& state,
+                              segment_v2::CompressionTypePB compression_type) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    const Block block = make_exchange_block(rows);
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+    for (auto _ : state) {
+        PBlock pblock;
+        auto st = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                  &uncompressed_bytes, &compressed_bytes, compression_type);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(pblock);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * uncompressed_bytes));
+    state.counters["compression_ratio"] =
+            compressed_bytes == 0 ? 0 : static_cast<double>(uncompressed_bytes) / compressed_bytes;
+}
+
+BENCHMARK_CAPTURE(BM_BlockSerialize, NO_COMPRESSION, segment_v2::CompressionTypePB::NO_COMPRESSION)
+        ->Arg(4096);
+BENCHMARK_CAPTURE(BM_BlockSerialize, SNAPPY, segment_v2::CompressionTypePB::SNAPPY)->Arg(4096);
+BENCHMARK_CAPTURE(BM_BlockSerialize, LZ4, segment_v2::CompressionTypePB::LZ4)->Arg(4096);
+BENCHMARK_CAPTURE(BM_BlockSerialize, LZ4F, segment_v2::CompressionTypePB::LZ4F)->Arg(4096);
+BENCHMARK_CAPTURE(BM_BlockSerialize, LZ4HC, segment_v2::CompressionTypePB::LZ4HC)->Arg(4096);
+BENCHMARK_CAPTURE(BM_BlockSerialize, ZLIB, segment_v2::CompressionTypePB::ZLIB)->Arg(4096);
+BENCHMARK_CAPTURE(BM_BlockSerialize, ZSTD, segment_v2::CompressionTypePB::ZSTD)->Arg(4096);
+
+} // namespace doris::vectorized
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "exprs/block_bloom_filter.hpp"
+
+namespace doris {
+
+inline std::vector<uint32_t> make_hashes(size_t n, uint64_t seed) {
+    std::mt19937 rng(static_cast<uint32_t>(seed));
+    std::vector<uint32_t> hashes(n);
+    for (auto& hash : hashes) {
+        hash = rng();
+    }
+    return hashes;
+}
+
+// A filter of 8 bits per key for `ndv` keys
+inline Status init_bloom_filter(BlockBloomFilter* filter, size_t ndv) {
+    int log_space_bytes = static_cast<int>(std::ceil(std::log2(static_cast<double>(ndv))));
+    return filter->init(std::max(log_space_bytes, 5), 0);
+}
+
+static void BM_BlockBloomFilterInsert(benchmark::State& state) {
+    const auto ndv = static_cast<size_t>(state.range(0));
+    auto hashes = make_hashes(ndv, ndv);
+    for (auto _ : state) {
+        BlockBloomFilter filter;
+        auto st = init_bloom_filter(&filter, ndv);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        for (auto hash : hashes) {
+            filter.insert(hash);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * ndv);
+}
+
+// Find the inserted keys and as many keys not inserted
+static void BM_BlockBloomFilterFind(benchmark::State& state) {
+    const auto ndv = static_cast<size_t>(state.range(0));
+    BlockBloomFilter filter;
+    auto st = init_bloom_filter(&filter, ndv);
+    if (!st.ok()) {
+        state.SkipWithError(st.to_string().c_str());
+        return;
+    }
+    for (auto hash : make_hashes(ndv, ndv)) {
+        filter.insert(hash);
+    }
+    auto probes = make_hashes(ndv, ndv);
+    auto misses = make_hashes(ndv, ndv + 1);
+    probes.insert(probes.end(), misses.begin(), misses.end());
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(static_cast<uint32_t>(ndv)));
+    for (auto _ : state) {
+        size_t found = 0;
+        for (auto hash : probes) {
+            found += filter.find(hash);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+BENCHMARK(BM_BlockBloomFilterInsert)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_BlockBloomFilterFind)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 22);
+
+} // namespace doris
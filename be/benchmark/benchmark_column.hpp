@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+
+#include "vec/columns/column.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::vectorized {
+
+inline ColumnPtr make_int64_column(size_t rows) {
+    std::mt19937_64 rng(rows);
+    auto column = ColumnInt64::create();
+    for (size_t i = 0; i < rows; ++i) {
+        column->insert_value(static_cast<int64_t>(rng()));
+    }
+    return column;
+}
+
+inline ColumnPtr make_string_column(size_t rows) {
+    std::mt19937_64 rng(rows);
+    auto column = ColumnString::create();
+    for (size_t i = 0; i < rows; ++i) {
+        // strings of 0 to 63 chars
+        auto value = std::string(rng() % 64, 'a') + std::to_string(rng());
+        column->insert_data(value.data(), value.size());
+    }
+    return column;
+}
+
+inline IColumn::Filter make_filter(size_t rows, int selectivity_percent) {
+    std::mt19937 rng(static_cast<uint32_t>(rows));
+    IColumn::Filter filter(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        filter[i] = rng() % 100 < static_cast<uint32_t>(selectivity_percent);
+    }
+    return filter;
+}
+
+inline IColumn::Permutation make_permutation(size_t rows) {
+    IColumn::Permutation perm(rows);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), std::mt19937(static_cast<uint32_t>(rows)));
+    return perm;
+}
+
+// range(0): rows, range(1): percent of the rows selected
+template <ColumnPtr (*MakeColumn)(size_t)>
+static void BM_ColumnFilter(benchmark::State& state) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    auto column = MakeColumn(rows);
+    auto filter = make_filter(rows, static_cast<int>(state.range(1)));
+    for (auto _ : state) {
+        auto result = column->filter(filter, -1);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+template <ColumnPtr (*MakeColumn)(size_t)>
+static void BM_ColumnPermute(benchmark::State& state) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    auto column = MakeColumn(rows);
+    auto perm = make_permutation(rows);
+    for (auto _ : state) {
+        auto result = column->permute(perm, 0);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+// Append the column to an empty one by ranges of range(1) rows
+template <ColumnPtr (*MakeColumn)(size_t)>
+static void BM_ColumnInsertRangeFrom(benchmark::State& state) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    const auto range_rows = static_cast<size_t>(state.range(1));
+    auto column = MakeColumn(rows);
+    for (auto _ : state) {
+        auto result = column->clone_empty();
+        for (size_t start = 0; start < rows; start += range_rows) {
+            result->insert_range_from(*column, start, std::min(range_rows, rows - start));
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+BENCHMARK_TEMPLATE(BM_ColumnFilter, make_int64_column)
+        ->ArgsProduct({{4096, 65536}, {1, 50, 99}});
+BENCHMARK_TEMPLATE(BM_ColumnFilter, make_string_column)
+        ->ArgsProduct({{4096, 65536}, {1, 50, 99}});
+BENCHMARK_TEMPLATE(BM_ColumnPermute, make_int64_column)->Arg(4096)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_ColumnPermute, make_string_column)->Arg(4096)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_ColumnInsertRangeFrom, make_int64_column)
+        ->ArgsProduct({{65536}, {1, 64, 4096}});
+BENCHMARK_TEMPLATE(BM_ColumnInsertRangeFrom, make_string_column)
+        ->ArgsProduct({{65536}, {1, 64, 4096}});
+
+} // namespace doris::vectorized
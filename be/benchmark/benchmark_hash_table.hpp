@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+
+#include "vec/columns/column.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/columns_hashing.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/hash_map_context.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+#include "vec/common/hash_table/string_hash_map.h"
+
+namespace doris::vectorized {
+
+// The key columns of the hash table benchmarks, `rows` keys of `cardinality` distinct values.
+template <typename ColumnType>
+ColumnPtr make_key_column(size_t rows, size_t cardinality) {
+    std::mt19937_64 rng(cardinality);
+    auto column = ColumnType::create();
+    for (size_t i = 0; i < rows; ++i) {
+        auto key = rng() % cardinality;
+        if constexpr (std::is_same_v<ColumnType, ColumnString>) {
+            auto value = "key_" + std::to_string(key);
+            column->insert_data(value.data(), value.size());
+        } else {
+            column->insert_value(static_cast<typename ColumnType::value_type>(key));
+        }
+    }
+    return column;
+}
+
+template <typename HashMethod>
+void emplace_keys(HashMethod& method, const ColumnRawPtrs& key_columns) {
+    typename HashMethod::State state(key_columns);
+    const size_t rows = key_columns[0]->size();
+    method.init_serialized_keys(key_columns, rows);
+    for (size_t i = 0; i < rows; ++i) {
+        auto creator = [&](const auto& ctor, auto& key, auto& origin) { ctor(key, i); };
+        auto creator_for_null_key = [&](auto& mapped) {};
+        method.lazy_emplace(state, i, creator, creator_for_null_key);
+    }
+}
+
+// The hash map contexts of a key type of the hash join and aggregation,
+// `KeyColumns` are the column types of the keys of them.
+template <typename HashMethod, typename... KeyColumns>
+struct HashTableBench {
+    static HashMethod create_method() {
+        if constexpr (std::is_constructible_v<HashMethod, Sizes>) {
+            return HashMethod(Sizes {sizeof(typename KeyColumns::value_type)...});
+        } else {
+            return HashMethod();
+        }
+    }
+
+    static Columns make_columns(size_t rows, size_t cardinality) {
+        return {make_key_column<KeyColumns>(rows, cardinality)...};
+    }
+};
+
+template <typename Bench>
+static void BM_HashTableEmplace(benchmark::State& state) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    auto columns = Bench::make_columns(rows, static_cast<size_t>(state.range(1)));
+    ColumnRawPtrs key_columns;
+    for (const auto& column : columns) {
+        key_columns.push_back(column.get());
+    }
+    for (auto _ : state) {
+        auto method = Bench::create_method();
+        emplace_keys(method, key_columns);
+        benchmark::DoNotOptimize(method.hash_table->size());
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+template <typename Bench>
+static void BM_HashTableFind(benchmark::State& state) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    auto columns = Bench::make_columns(rows, static_cast<size_t>(state.range(1)));
+    ColumnRawPtrs key_columns;
+    for (const auto& column : columns) {
+        key_columns.push_back(column.get());
+    }
+    auto method = Bench::create_method();
+    emplace_keys(method, key_columns);
+    for (auto _ : state) {
+        typename decltype(method)::State find_state(key_columns);
+        method.init_serialized_keys(key_columns, rows);
+        size_t found = 0;
+        for (size_t i = 0; i < rows; ++i) {
+            found += method.find(find_state, i).is_found();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+template <typename Key, typename KeyColumn>
+using NumberKeyBench =
+        HashTableBench<MethodOneNumber<Key, PHHashMap<Key, IColumn::ColumnIndex, HashCRC32<Key>>>,
+                       KeyColumn>;
+template <typename Key, typename... KeyColumns>
+using FixedKeyBench = HashTableBench<
+        MethodKeysFixed<PHHashMap<Key, IColumn::ColumnIndex, HashCRC32<Key>>>, KeyColumns...>;
+
+using UInt8KeyBench = NumberKeyBench<UInt8, ColumnUInt8>;
+using UInt16KeyBench = NumberKeyBench<UInt16, ColumnInt16>;
+using UInt32KeyBench = NumberKeyBench<UInt32, ColumnInt32>;
+using UInt64KeyBench = NumberKeyBench<UInt64, ColumnInt64>;
+using UInt128KeyBench = NumberKeyBench<UInt128, ColumnInt128>;
+using Fixed64KeyBench = FixedKeyBench<UInt64, ColumnInt32, ColumnInt32>;
+using Fixed128KeyBench = FixedKeyBench<UInt128, ColumnInt64, ColumnInt64>;
+using Fixed256KeyBench = FixedKeyBench<UInt256, ColumnInt128, ColumnInt128>;
+using SerializedKeyBench =
+        HashTableBench<MethodSerialized<StringHashMap<IColumn::ColumnIndex>>, ColumnInt32,
+                       ColumnString>;
+using StringKeyBench =
+        HashTableBench<MethodStringNoCache<StringHashMap<IColumn::ColumnIndex>>, ColumnString>;
+
+#define HASH_TABLE_BENCHMARK(BENCH)                                                       \
+    BENCHMARK_TEMPLATE(BM_HashTableEmplace, BENCH)->ArgsProduct({{65536}, {256, 65536}}); \
+    BENCHMARK_TEMPLATE(BM_HashTableFind, BENCH)->ArgsProduct({{65536}, {256, 65536}});
+
+HASH_TABLE_BENCHMARK(UInt8KeyBench)
+HASH_TABLE_BENCHMARK(UInt16KeyBench)
+HASH_TABLE_BENCHMARK(UInt32KeyBench)
+HASH_TABLE_BENCHMARK(UInt64KeyBench)
+HASH_TABLE_BENCHMARK(UInt128KeyBench)
+HASH_TABLE_BENCHMARK(Fixed64KeyBench)
+HASH_TABLE_BENCHMARK(Fixed128KeyBench)
+HASH_TABLE_BENCHMARK(Fixed256KeyBench)
+HASH_TABLE_BENCHMARK(SerializedKeyBench)
+HASH_TABLE_BENCHMARK(StringKeyBench)
+
+#undef HASH_TABLE_BENCHMARK
+
+} // namespace doris::vectorized
@@ -17,36 +17,17 @@
 
 #include <benchmark/benchmark.h>
 
-#include <string>
-
-#include "vec/columns/column_string.h"
-#include "vec/core/block.h"
-#include "vec/data_types/data_type.h"
-#include "vec/data_types/data_type_string.h"
-
-namespace doris::vectorized { // change if need
-
-static void Example1(benchmark::State& state) {
-    // init. dont time it.
-    state.PauseTiming();
-    Block block;
-    DataTypePtr str_type = std::make_shared<DataTypeString>();
-    std::vector<std::string> vals {100, "content"};
-    state.ResumeTiming();
-
-    // do test
-    for (auto _ : state) {
-        auto str_col = ColumnString::create();
-        for (auto& v : vals) {
-            str_col->insert_data(v.data(), v.size());
-        }
-        block.insert({std::move(str_col), str_type, "col"});
-        benchmark::DoNotOptimize(block); // mark the watched target
-    }
-}
-// could BENCHMARK many functions to compare them together.
-BENCHMARK(Example1);
-
-} // namespace doris::vectorized
-
+#include "benchmark_block_serialize.hpp"
+#include "benchmark_bloom_filter.hpp"
+#include "benchmark_column.hpp"
+#include "benchmark_hash_table.hpp"
+#include "benchmark_page_decoder.hpp"
+#include "benchmark_sort.hpp"
+
+// Microbenchmarks of the hot paths of BE, built as `benchmark_test` by `build.sh --benchmark`.
+// To compare two builds, save the results of each as json and compare them with the
+// `tools/compare.py` of google benchmark:
+//   benchmark_test --benchmark_out=result.json --benchmark_out_format=json
+//   compare.py benchmarks baseline.json result.json
+// `--benchmark_filter=<regex>` runs a part of them, e.g. `--benchmark_filter=BM_HashTable`.
 BENCHMARK_MAIN();
@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/encoding_info.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/slice.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::segment_v2 {
+
+constexpr size_t PAGE_BENCHMARK_ROWS = 65536;
+
+// The values of a page of `Type`: sorted ids for ints, so that delta and FOR encodings apply,
+// prices with two decimals for doubles, and low cardinality strings.
+template <FieldType Type>
+auto make_page_values() {
+    std::mt19937_64 rng(PAGE_BENCHMARK_ROWS);
+    using CppType = typename TypeTraits<Type>::CppType;
+    std::vector<CppType> values(PAGE_BENCHMARK_ROWS);
+    if constexpr (Type == FieldType::OLAP_FIELD_TYPE_VARCHAR) {
+        static std::vector<std::string> strings;
+        strings.clear();
+        for (size_t i = 0; i < PAGE_BENCHMARK_ROWS; ++i) {
+            strings.push_back("http://doris.apache.org/" + std::to_string(rng() % 1000));
+        }
+        for (size_t i = 0; i < PAGE_BENCHMARK_ROWS; ++i) {
+            values[i] = Slice(strings[i]);
+        }
+    } else if constexpr (Type == FieldType::OLAP_FIELD_TYPE_DOUBLE) {
+        for (auto& value : values) {
+            value = static_cast<double>(rng() % 1000000) / 100;
+        }
+    } else {
+        CppType id = 0;
+        for (auto& value : values) {
+            id += static_cast<CppType>(rng() % 16);
+            value = id;
+        }
+    }
+    return values;
+}
+
+template <FieldType Type>
+Status encode_page(const EncodingInfo* encoding_info, OwnedSlice* page) {
+    auto values = make_page_values<Type>();
+    PageBuilderOptions options;
+    options.data_page_size = 16 * 1024 * 1024;
+    PageBuilder* builder_ptr = nullptr;
+    RETURN_IF_ERROR(encoding_info->create_page_builder(options, &builder_ptr));
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    size_t count = values.size();
+    RETURN_IF_ERROR(builder->add(reinterpret_cast<const uint8_t*>(values.data()), &count));
+    if (count != values.size()) {
+        return Status::InternalError("page is full after {} values", count);
+    }
+    return builder->finish(page);
+}
+
+// Decode a page of PAGE_BENCHMARK_ROWS values of `Type` in `encoding` into `ColumnType`.
+template <FieldType Type, typename ColumnType>
+static void BM_PageDecode(benchmark::State& state, EncodingTypePB encoding) {
+    const EncodingInfo* encoding_info = nullptr;
+    auto st = EncodingInfo::get(get_scalar_type_info(Type), encoding, &encoding_info);
+    OwnedSlice encoded;
+    if (st.ok()) {
+        st = encode_page<Type>(encoding_info, &encoded);
+    }
+    // The encodings like bitshuffle are decoded before being put into the page cache, decode
+    // the cached page as the column readers do.
+    std::unique_ptr<DataPage> decoded_page;
+    Slice page = encoded.slice();
+    if (st.ok() && encoding_info->get_data_page_pre_decoder() != nullptr) {
+        st = encoding_info->get_data_page_pre_decoder()->decode(&decoded_page, &page, 0, false,
+                                                                 PageTypePB::DATA_PAGE);
+    }
+    if (!st.ok()) {
+        state.SkipWithError(st.to_string().c_str());
+        return;
+    }
+
+    for (auto _ : state) {
+        PageDecoder* decoder_ptr = nullptr;
+        st = encoding_info->create_page_decoder(page, PageDecoderOptions(), &decoder_ptr);
+        std::unique_ptr<PageDecoder> decoder(decoder_ptr);
+        if (st.ok()) {
+            st = decoder->init();
+        }
+        vectorized::MutableColumnPtr column = ColumnType::create();
+        size_t rows = PAGE_BENCHMARK_ROWS;
+        if (st.ok()) {
+            st = decoder->next_batch(&rows, column);
+        }
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetItemsProcessed(state.iterations() * PAGE_BENCHMARK_ROWS);
+    state.counters["page_bytes"] = static_cast<double>(encoded.slice().size);
+}
+
+#define PAGE_DECODE_BENCHMARK(TYPE, COLUMN, ENCODING)                                         \
+    BENCHMARK_CAPTURE((BM_PageDecode<FieldType::OLAP_FIELD_TYPE_##TYPE, vectorized::COLUMN>), \
+                      TYPE##_##ENCODING, ENCODING)
+
+PAGE_DECODE_BENCHMARK(INT, ColumnInt32, PLAIN_ENCODING);
+PAGE_DECODE_BENCHMARK(INT, ColumnInt32, BIT_SHUFFLE);
+PAGE_DECODE_BENCHMARK(INT, ColumnInt32, FOR_ENCODING);
+PAGE_DECODE_BENCHMARK(INT, ColumnInt32, DELTA_ENCODING);
+PAGE_DECODE_BENCHMARK(INT, ColumnInt32, DELTA_OF_DELTA_ENCODING);
+PAGE_DECODE_BENCHMARK(BIGINT, ColumnInt64, PLAIN_ENCODING);
+PAGE_DECODE_BENCHMARK(BIGINT, ColumnInt64, BIT_SHUFFLE);
+PAGE_DECODE_BENCHMARK(BIGINT, ColumnInt64, FOR_ENCODING);
+PAGE_DECODE_BENCHMARK(BIGINT, ColumnInt64, DELTA_ENCODING);
+PAGE_DECODE_BENCHMARK(BIGINT, ColumnInt64, DELTA_OF_DELTA_ENCODING);
+PAGE_DECODE_BENCHMARK(DOUBLE, ColumnFloat64, PLAIN_ENCODING);
+PAGE_DECODE_BENCHMARK(DOUBLE, ColumnFloat64, BIT_SHUFFLE);
+PAGE_DECODE_BENCHMARK(DOUBLE, ColumnFloat64, ALP_ENCODING);
+PAGE_DECODE_BENCHMARK(VARCHAR, ColumnString, PLAIN_ENCODING);
+PAGE_DECODE_BENCHMARK(VARCHAR, ColumnString, PREFIX_ENCODING);
+
+#undef PAGE_DECODE_BENCHMARK
+
+} // namespace doris::segment_v2
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "runtime/descriptors.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/sort/sorter.h"
+#include "vec/core/block.h"
+#include "vec/core/sort_block.h"
+#include "vec/core/sort_description.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// A block of an int64 column of random values and a string column, sorted if `sorted`.
+inline Block make_sort_block(size_t rows, uint64_t seed, bool sorted) {
+    std::mt19937_64 rng(seed);
+    std::vector<int64_t> keys(rows);
+    for (auto& key : keys) {
+        key = static_cast<int64_t>(rng() % (rows * 16));
+    }
+    if (sorted) {
+        std::sort(keys.begin(), keys.end());
+    }
+    auto key_column = ColumnInt64::create();
+    auto value_column = ColumnString::create();
+    for (auto key : keys) {
+        key_column->insert_value(key);
+        auto value = std::to_string(key);
+        value_column->insert_data(value.data(), value.size());
+    }
+    Block block;
+    block.insert({std::move(key_column), std::make_shared<DataTypeInt64>(), "k"});
+    block.insert({std::move(value_column), std::make_shared<DataTypeString>(), "v"});
+    return block;
+}
+
+// range(0): rows, range(1): limit, 0 for a full sort
+static void BM_SortBlock(benchmark::State& state) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    auto limit = static_cast<UInt64>(state.range(1));
+    const Block src = make_sort_block(rows, rows, false);
+    const SortDescription description {SortColumnDescription(0, 1, 1)};
+    for (auto _ : state) {
+        state.PauseTiming();
+        Block block = src;
+        Block dest = src.clone_empty();
+        state.ResumeTiming();
+        sort_block(block, dest, description, limit);
+        benchmark::DoNotOptimize(dest);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+// Merge range(0) sorted blocks of range(1) rows, as a sort operator merges its sorted runs.
+static void BM_MergeSorterState(benchmark::State& state) {
+    const auto num_blocks = static_cast<size_t>(state.range(0));
+    const auto rows = static_cast<size_t>(state.range(1));
+    std::vector<Block> blocks;
+    for (size_t i = 0; i < num_blocks; ++i) {
+        blocks.push_back(make_sort_block(rows, i, true));
+    }
+    const SortDescription description {SortColumnDescription(0, 1, 1)};
+    constexpr int batch_size = 4096;
+    for (auto _ : state) {
+        state.PauseTiming();
+        MergeSorterState sorter_state(RowDescriptor(), 0);
+        sorter_state.unsorted_block() = Block::create_unique(blocks[0].clone_empty());
+        for (const auto& block : blocks) {
+            sorter_state.add_sorted_block(Block::create_shared(block));
+        }
+        state.ResumeTiming();
+
+        auto st = sorter_state.build_merge_tree(description);
+        bool eos = false;
+        size_t merged_rows = 0;
+        while (st.ok() && !eos) {
+            Block block;
+            st = sorter_state.merge_sort_read(&block, batch_size, &eos);
+            merged_rows += block.rows();
+        }
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(merged_rows);
+    }
+    state.SetItemsProcessed(state.iterations() * num_blocks * rows);
+}
+
+BENCHMARK(BM_SortBlock)->ArgsProduct({{4096, 65536}, {0, 100}});
+BENCHMARK(BM_MergeSorterState)->ArgsProduct({{2, 16, 128}, {4096}});
+
+} // namespace doris::vectorized
@@ -111,9 +111,13 @@ void BeExecVersionManager::check_function_compatibility(int current_be_exec_vers
  * 7: start from doris 3.0.2
  *    a. window funnel logic change
 *     b. support const column in serialize/deserialize function: PR #41175
+ *
+ * 9: multi_distinct_count of integers uses an adaptive sorted array / roaring bitmap state.
+ *
+ * 10: the null map of a nullable column is serialized as a bitmap, and not at all without nulls.
  */
 
-const int BeExecVersionManager::max_be_exec_version = 8;
+const int BeExecVersionManager::max_be_exec_version = 10;
 const int BeExecVersionManager::min_be_exec_version = 0;
 std::map<std::string, std::set<int>> BeExecVersionManager::_function_change_map {};
 std::set<std::string> BeExecVersionManager::_function_restrict_map;
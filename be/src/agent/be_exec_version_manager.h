@@ -32,6 +32,10 @@ constexpr inline int AGGREGATION_2_1_VERSION =
         6; // some aggregation changed the data format after this version
 constexpr inline int USE_CONST_SERDE =
         8; // support const column in serialize/deserialize function: PR #41175
+constexpr inline int ADAPTIVE_UNIQ_EXACT =
+        9; // multi_distinct_count of integers keeps a sorted array or a roaring bitmap
+constexpr inline int BITMAP_NULL_MAP_SERDE =
+        10; // the null map of a nullable column is serialized as a bitmap, or skipped
 
 class BeExecVersionManager {
 public:
@@ -40,6 +40,7 @@
 #include <sstream>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -519,7 +520,9 @@ bvar::Adder<uint64_t> report_index_policy_failed("report", "index_policy_failed"
 
 TaskWorkerPool::TaskWorkerPool(std::string_view name, int worker_count,
                                std::function<void(const TAgentTaskRequest& task)> callback)
-        : _callback(std::move(callback)) {
+        : _callback(std::move(callback)),
+          _queue_wait_latency(std::make_unique<bvar::LatencyRecorder>(
+                  "task_queue_wait", fmt::format("TaskWP_{}", name))) {
     auto st = ThreadPoolBuilder(fmt::format("TaskWP_{}", name))
                       .set_min_threads(worker_count)
                       .set_max_threads(worker_count)
@@ -543,18 +546,46 @@ void TaskWorkerPool::stop() {
 
 Status TaskWorkerPool::submit_task(const TAgentTaskRequest& task) {
     return _submit_task(task, [this](auto&& task) {
+        bool high_prior = task.__isset.priority && task.priority == TPriority::HIGH;
         add_task_count(task, 1);
-        return _thread_pool->submit_func([this, task]() {
-            _callback(task);
+        {
+            std::lock_guard lock(_mtx);
+            auto& queue = high_prior ? _high_prior_queue : _normal_queue;
+            queue.push_back({std::make_unique<TAgentTaskRequest>(task), MonotonicMicros()});
+        }
+        auto st = _thread_pool->submit_func([this] { _run_queued_task(); });
+        if (!st.ok()) {
+            std::lock_guard lock(_mtx);
+            auto& queue = high_prior ? _high_prior_queue : _normal_queue;
+            queue.pop_back();
             add_task_count(task, -1);
-        });
+        }
+        return st;
     });
 }
 
+void TaskWorkerPool::_run_queued_task() {
+    QueuedTask queued;
+    {
+        std::lock_guard lock(_mtx);
+        auto& queue = _high_prior_queue.empty() ? _normal_queue : _high_prior_queue;
+        if (queue.empty()) {
+            return;
+        }
+        queued = std::move(queue.front());
+        queue.pop_front();
+    }
+
+    *_queue_wait_latency << (MonotonicMicros() - queued.enqueue_time_us);
+    _callback(*queued.req);
+    add_task_count(*queued.req, -1);
+}
+
 PriorTaskWorkerPool::PriorTaskWorkerPool(
         const std::string& name, int normal_worker_count, int high_prior_worker_count,
         std::function<void(const TAgentTaskRequest& task)> callback)
-        : _callback(std::move(callback)) {
+        : _callback(std::move(callback)),
+          _queue_wait_latency(std::make_unique<bvar::LatencyRecorder>("task_queue_wait", name)) {
     for (int i = 0; i < normal_worker_count; ++i) {
         auto st = Thread::create(
                 "Normal", name, [this] { normal_loop(); }, &_workers.emplace_back());
@@ -597,21 +628,29 @@ Status PriorTaskWorkerPool::submit_task(const TAgentTaskRequest& task) {
         add_task_count(*req, 1);
         if (req->__isset.priority && req->priority == TPriority::HIGH) {
             std::lock_guard lock(_mtx);
-            _high_prior_queue.push_back(std::move(req));
+            _high_prior_queue.emplace_back(std::move(req), MonotonicMicros());
             _high_prior_condv.notify_one();
             _normal_condv.notify_one();
         } else {
             std::lock_guard lock(_mtx);
-            _normal_queue.push_back(std::move(req));
+            _normal_queue.emplace_back(std::move(req), MonotonicMicros());
             _normal_condv.notify_one();
         }
         return Status::OK();
     });
 }
 
+void PriorTaskWorkerPool::_run_task(std::unique_ptr<TAgentTaskRequest> req,
+                                    int64_t enqueue_time_us) {
+    *_queue_wait_latency << (MonotonicMicros() - enqueue_time_us);
+    _callback(*req);
+    add_task_count(*req, -1);
+}
+
 void PriorTaskWorkerPool::normal_loop() {
     while (true) {
         std::unique_ptr<TAgentTaskRequest> req;
+        int64_t enqueue_time_us = 0;
 
         {
             std::unique_lock lock(_mtx);
@@ -624,24 +663,24 @@ void PriorTaskWorkerPool::normal_loop() {
             }
 
             if (!_high_prior_queue.empty()) {
-                req = std::move(_high_prior_queue.front());
+                std::tie(req, enqueue_time_us) = std::move(_high_prior_queue.front());
                 _high_prior_queue.pop_front();
             } else if (!_normal_queue.empty()) {
-                req = std::move(_normal_queue.front());
+                std::tie(req, enqueue_time_us) = std::move(_normal_queue.front());
                 _normal_queue.pop_front();
             } else {
                 continue;
             }
         }
 
-        _callback(*req);
-        add_task_count(*req, -1);
+        _run_task(std::move(req), enqueue_time_us);
     }
 }
 
 void PriorTaskWorkerPool::high_prior_loop() {
     while (true) {
         std::unique_ptr<TAgentTaskRequest> req;
+        int64_t enqueue_time_us = 0;
 
         {
             std::unique_lock lock(_mtx);
@@ -655,12 +694,11 @@ void PriorTaskWorkerPool::high_prior_loop() {
                 continue;
             }
 
-            req = std::move(_high_prior_queue.front());
+            std::tie(req, enqueue_time_us) = std::move(_high_prior_queue.front());
             _high_prior_queue.pop_front();
         }
 
-        _callback(*req);
-        add_task_count(*req, -1);
+        _run_task(std::move(req), enqueue_time_us);
     }
 }
 
@@ -29,6 +29,10 @@
 #include "common/status.h"
 #include "gutil/ref_counted.h"
 
+namespace bvar {
+class LatencyRecorder;
+} // namespace bvar
+
 namespace doris {
 
 class ExecEnv;
@@ -60,9 +64,25 @@ public:
     Status submit_task(const TAgentTaskRequest& task) override;
 
 protected:
+    struct QueuedTask {
+        std::unique_ptr<TAgentTaskRequest> req;
+        int64_t enqueue_time_us;
+    };
+
+    // Run the first task of the high priority queue, or of the normal queue if there is no high
+    // priority task. A func running this is submitted to `_thread_pool` for each queued task, so
+    // a high priority task needn't wait for the normal tasks submitted before it.
+    void _run_queued_task();
+
     std::atomic_bool _stopped {false};
     std::unique_ptr<ThreadPool> _thread_pool;
     std::function<void(const TAgentTaskRequest&)> _callback;
+
+    std::mutex _mtx;
+    std::deque<QueuedTask> _normal_queue;
+    std::deque<QueuedTask> _high_prior_queue;
+    // the time a task waits in the queues
+    std::unique_ptr<bvar::LatencyRecorder> _queue_wait_latency;
 };
 
 class PublishVersionWorkerPool final : public TaskWorkerPool {
@@ -96,15 +116,20 @@ private:
 
     bool _stopped {false};
 
+    void _run_task(std::unique_ptr<TAgentTaskRequest> req, int64_t enqueue_time_us);
+
     std::mutex _mtx;
     std::condition_variable _normal_condv;
-    std::deque<std::unique_ptr<TAgentTaskRequest>> _normal_queue;
+    // <task, enqueue time in us>
+    std::deque<std::pair<std::unique_ptr<TAgentTaskRequest>, int64_t>> _normal_queue;
     std::condition_variable _high_prior_condv;
-    std::deque<std::unique_ptr<TAgentTaskRequest>> _high_prior_queue;
+    std::deque<std::pair<std::unique_ptr<TAgentTaskRequest>, int64_t>> _high_prior_queue;
 
     std::vector<scoped_refptr<Thread>> _workers;
 
     std::function<void(const TAgentTaskRequest&)> _callback;
+    // the time a task waits in the queues
+    std::unique_ptr<bvar::LatencyRecorder> _queue_wait_latency;
 };
 
 class ReportWorker {
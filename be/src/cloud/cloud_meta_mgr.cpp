@@ -61,6 +61,7 @@
 #include "runtime/client_cache.h"
 #include "runtime/exec_env.h"
 #include "runtime/stream_load/stream_load_context.h"
+#include "util/doris_metrics.h"
 #include "util/network_util.h"
 #include "util/s3_util.h"
 #include "util/thrift_rpc_helper.h"
@@ -135,6 +136,10 @@ namespace {
 constexpr int kBrpcRetryTimes = 3;
 
 bvar::LatencyRecorder _get_rowset_latency("doris_cloud_meta_mgr_get_rowset");
+bvar::Adder<uint64_t> g_cloud_sync_tablets_rowsets_skipped(
+        "doris_cloud_meta_mgr_sync_tablets_rowsets_skipped");
+bvar::Adder<uint64_t> g_cloud_sync_tablets_rowsets_synced(
+        "doris_cloud_meta_mgr_sync_tablets_rowsets_synced");
 bvar::LatencyRecorder g_cloud_commit_txn_resp_redirect_latency("cloud_table_stats_report_latency");
 bvar::Adder<uint64_t> g_cloud_meta_mgr_rpc_timeout_count("cloud_meta_mgr_rpc_timeout_count");
 bvar::Window<bvar::Adder<uint64_t>> g_cloud_ms_rpc_timeout_count_window(
@@ -384,7 +389,10 @@ Status retry_rpc(std::string_view op_name, const Request& req, Response* res,
         cntl.set_max_retry(kBrpcRetryTimes);
         res->Clear();
         int error_code = 0;
-        (stub.get()->*method)(&cntl, &req, res, nullptr);
+        {
+            SCOPED_HISTOGRAM_LATENCY_US(DorisMetrics::instance()->meta_service_rpc_latency_us);
+            (stub.get()->*method)(&cntl, &req, res, nullptr);
+        }
         if (cntl.Failed()) [[unlikely]] {
             error_msg = cntl.ErrorText();
             error_code = cntl.ErrorCode();
@@ -496,6 +504,36 @@ Status CloudMetaMgr::sync_tablet_rowsets(CloudTablet* tablet, const SyncOptions&
     return sync_tablet_rowsets_unlocked(tablet, lock, options, sync_stats);
 }
 
+Status CloudMetaMgr::sync_tablets_rowsets(const std::vector<CloudTablet*>& tablets,
+                                          const std::vector<int64_t>& query_versions,
+                                          const SyncOptions& options,
+                                          std::vector<SyncRowsetStats>* sync_stats,
+                                          int concurrency) {
+    DCHECK_EQ(tablets.size(), query_versions.size());
+    DCHECK(sync_stats == nullptr || sync_stats->size() == tablets.size());
+    std::vector<std::function<Status()>> tasks;
+    for (size_t i = 0; i < tablets.size(); ++i) {
+        auto* tablet = tablets[i];
+        int64_t query_version = query_versions[i];
+        // check the local version first, so the up to date tablets don't occupy a sync slot
+        if (query_version > 0 && tablet->tablet_state() == TABLET_RUNNING) {
+            std::shared_lock rlock(tablet->get_header_lock());
+            if (tablet->max_version_unlocked() >= query_version) {
+                continue;
+            }
+        }
+        auto* stats = sync_stats != nullptr ? &(*sync_stats)[i] : nullptr;
+        tasks.emplace_back([tablet, stats, query_version, &options]() {
+            SyncOptions tablet_options = options;
+            tablet_options.query_version = query_version;
+            return tablet->sync_rowsets(tablet_options, stats);
+        });
+    }
+    g_cloud_sync_tablets_rowsets_skipped << tablets.size() - tasks.size();
+    g_cloud_sync_tablets_rowsets_synced << tasks.size();
+    return bthread_fork_join(tasks, concurrency);
+}
+
 Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
                                                   std::unique_lock<bthread::Mutex>& lock,
                                                   const SyncOptions& options,
@@ -731,7 +769,10 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
             }
             std::vector<RowsetSharedPtr> rowsets;
             rowsets.reserve(resp.rowset_meta().size());
-            for (const auto& cloud_rs_meta_pb : resp.rowset_meta()) {
+            // schema_version -> the first synced rowset meta of that schema, see
+            // `enable_cloud_share_rowset_schema`
+            std::unordered_map<int32_t, RowsetMetaSharedPtr> schema_rs_metas;
+            for (auto& cloud_rs_meta_pb : *resp.mutable_rowset_meta()) {
                 VLOG_DEBUG << "get rowset meta, tablet_id=" << cloud_rs_meta_pb.tablet_id()
                            << ", version=[" << cloud_rs_meta_pb.start_version() << '-'
                            << cloud_rs_meta_pb.end_version() << ']';
@@ -741,6 +782,18 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
                     existed_rowset->rowset_id().to_string() == cloud_rs_meta_pb.rowset_id_v2()) {
                     continue; // Same rowset, skip it
                 }
+                bool share_schema = config::enable_cloud_share_rowset_schema &&
+                                    cloud_rs_meta_pb.has_schema_version() &&
+                                    !cloud_rs_meta_pb.has_schema_dict_key_list();
+                RowsetMetaSharedPtr schema_rs_meta;
+                if (share_schema) {
+                    auto it = schema_rs_metas.find(cloud_rs_meta_pb.schema_version());
+                    if (it != schema_rs_metas.end()) {
+                        schema_rs_meta = it->second;
+                        // needn't convert the same schema again
+                        cloud_rs_meta_pb.clear_tablet_schema();
+                    }
+                }
                 RowsetMetaPB meta_pb;
                 // Check if the rowset meta contains a schema dictionary key list.
                 if (cloud_rs_meta_pb.has_schema_dict_key_list() && !resp.has_schema_dict()) {
@@ -767,6 +820,13 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
                 }
                 auto rs_meta = std::make_shared<RowsetMeta>();
                 rs_meta->init_from_pb(meta_pb);
+                if (schema_rs_meta) {
+                    rs_meta->share_tablet_schema(*schema_rs_meta);
+                } else if (share_schema && rs_meta->tablet_schema() &&
+                           rs_meta->tablet_schema()->num_variant_columns() == 0) {
+                    // the schema of a rowset with variant columns is extended by its own data
+                    schema_rs_metas.emplace(cloud_rs_meta_pb.schema_version(), rs_meta);
+                }
                 RowsetSharedPtr rowset;
                 // schema is nullptr implies using RowsetMeta.tablet_schema
                 Status s = RowsetFactory::create_rowset(nullptr, "", rs_meta, &rowset);
@@ -69,6 +69,14 @@ public:
             CloudTablet* tablet, std::unique_lock<bthread::Mutex>& lock /* _sync_meta_lock */,
             const SyncOptions& options = {}, SyncRowsetStats* sync_stats = nullptr);
 
+    // Sync the rowsets of `tablets` to be readable at `query_versions`, `sync_stats` holds one
+    // entry per tablet if not null. The tablets already at their query version are skipped
+    // without any rpc, the others are synced with at most `concurrency` rpcs in flight.
+    Status sync_tablets_rowsets(const std::vector<CloudTablet*>& tablets,
+                                const std::vector<int64_t>& query_versions,
+                                const SyncOptions& options,
+                                std::vector<SyncRowsetStats>* sync_stats, int concurrency);
+
     Status prepare_rowset(const RowsetMeta& rs_meta, const std::string& job_id,
                           std::shared_ptr<RowsetMeta>* existed_rs_meta = nullptr);
 
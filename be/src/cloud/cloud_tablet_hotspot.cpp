@@ -17,8 +17,10 @@
 
 #include "cloud/cloud_tablet_hotspot.h"
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
+#include <tuple>
 
 #include "cloud/config.h"
 #include "olap/tablet_fwd.h"
@@ -155,6 +157,30 @@ void TabletHotspot::get_top_n_hot_partition(std::vector<THotTableMessage>* hot_t
     _last_week_hot_partitions = std::move(week_hot_partitions);
 }
 
+void TabletHotspot::get_top_n_hot_tablets(size_t n, std::vector<HotTablet>* hot_tablets) {
+    std::vector<HotTablet> tablets;
+    std::for_each(_tablets_hotspot.begin(), _tablets_hotspot.end(), [&](HotspotMap& map) {
+        std::lock_guard lock(map.mtx);
+        for (auto& [tablet_id, counter] : map.map) {
+            uint64_t qpw = counter->qpw();
+            if (qpw != 0) {
+                tablets.push_back({tablet_id, counter->qpd(), qpw});
+            }
+        }
+    });
+    auto hotter = [](const HotTablet& lhs, const HotTablet& rhs) {
+        return std::tie(lhs.qpd, lhs.qpw, rhs.tablet_id) >
+               std::tie(rhs.qpd, rhs.qpw, lhs.tablet_id);
+    };
+    if (tablets.size() > n) {
+        std::partial_sort(tablets.begin(), tablets.begin() + n, tablets.end(), hotter);
+        tablets.resize(n);
+    } else {
+        std::sort(tablets.begin(), tablets.end(), hotter);
+    }
+    *hot_tablets = std::move(tablets);
+}
+
 void HotspotCounter::make_dot_point() {
     uint64_t value = cur_counter.load();
     cur_counter = 0;
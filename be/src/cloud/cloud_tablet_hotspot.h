@@ -57,6 +57,12 @@ struct TabletHotspotMapValue {
     int64_t last_access_time;
 };
 
+struct HotTablet {
+    int64_t tablet_id = 0;
+    uint64_t qpd = 0; // query per day
+    uint64_t qpw = 0; // query per week
+};
+
 struct MapKeyHash {
     int64_t operator()(const std::pair<int64_t, int64_t>& key) const {
         return std::hash<int64_t> {}(key.first) + std::hash<int64_t> {}(key.second);
@@ -70,6 +76,8 @@ public:
     // When query the tablet, count it
     void count(const BaseTablet& tablet);
     void get_top_n_hot_partition(std::vector<THotTableMessage>* hot_tables);
+    // Get the n tablets queried most in the last day, then in the last week, hottest first
+    void get_top_n_hot_tablets(size_t n, std::vector<HotTablet>* hot_tablets);
 
 private:
     void make_dot_point();
@@ -21,11 +21,16 @@
 #include <bvar/reducer.h>
 
 #include <algorithm>
+#include <charconv>
+#include <chrono>
 #include <cstddef>
+#include <string_view>
 #include <tuple>
 
 #include "cloud/cloud_tablet_mgr.h"
+#include "cloud/config.h"
 #include "common/logging.h"
+#include "http/http_client.h"
 #include "io/cache/block_file_cache_downloader.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/rowset/segment_v2/inverted_index_desc.h"
@@ -39,6 +44,7 @@ bvar::Adder<uint64_t> file_cache_warm_up_failed_task_num("file_cache_warm_up", "
 
 CloudWarmUpManager::CloudWarmUpManager(CloudStorageEngine& engine) : _engine(engine) {
     _download_thread = std::thread(&CloudWarmUpManager::handle_jobs, this);
+    _hotspot_thread = std::thread(&CloudWarmUpManager::handle_hotspot_warm_up, this);
 }
 
 CloudWarmUpManager::~CloudWarmUpManager() {
@@ -50,6 +56,9 @@ CloudWarmUpManager::~CloudWarmUpManager() {
     if (_download_thread.joinable()) {
         _download_thread.join();
     }
+    if (_hotspot_thread.joinable()) {
+        _hotspot_thread.join();
+    }
 }
 
 std::unordered_map<std::string, RowsetMetaSharedPtr> snapshot_rs_metas(BaseTablet* tablet) {
@@ -62,16 +71,16 @@ std::unordered_map<std::string, RowsetMetaSharedPtr> snapshot_rs_metas(BaseTable
     return id_to_rowset_meta_map;
 }
 
-void CloudWarmUpManager::submit_download_tasks(io::Path path, int64_t file_size,
-                                               io::FileSystemSPtr file_system,
-                                               int64_t expiration_time,
-                                               std::shared_ptr<bthread::CountdownEvent> wait) {
+int64_t CloudWarmUpManager::submit_download_tasks(io::Path path, int64_t file_size,
+                                                  io::FileSystemSPtr file_system,
+                                                  int64_t expiration_time,
+                                                  std::shared_ptr<bthread::CountdownEvent> wait) {
     if (file_size < 0) {
         auto st = file_system->file_size(path, &file_size);
         if (!st.ok()) [[unlikely]] {
             LOG(WARNING) << "get file size failed: " << path;
             file_cache_warm_up_failed_task_num << 1;
-            return;
+            return 0;
         }
     }
 
@@ -106,6 +115,71 @@ void CloudWarmUpManager::submit_download_tasks(io::Path path, int64_t file_size,
         offset += current_chunk_size;
         remaining_size -= current_chunk_size;
     }
+    return file_size;
+}
+
+int64_t CloudWarmUpManager::submit_tablet_download_tasks(
+        CloudTablet* tablet, std::shared_ptr<bthread::CountdownEvent> wait) {
+    int64_t bytes = 0;
+    auto tablet_meta = tablet->tablet_meta();
+    auto rs_metas = snapshot_rs_metas(tablet);
+    for (auto& [_, rs] : rs_metas) {
+        for (int64_t seg_id = 0; seg_id < rs->num_segments(); seg_id++) {
+            auto storage_resource = rs->remote_storage_resource();
+            if (!storage_resource) {
+                LOG(WARNING) << storage_resource.error();
+                continue;
+            }
+
+            int64_t expiration_time =
+                    tablet_meta->ttl_seconds() == 0 || rs->newest_write_timestamp() <= 0
+                            ? 0
+                            : rs->newest_write_timestamp() + tablet_meta->ttl_seconds();
+            if (expiration_time <= UnixSeconds()) {
+                expiration_time = 0;
+            }
+
+            // 1st. download segment files
+            bytes += submit_download_tasks(
+                    storage_resource.value()->remote_segment_path(*rs, seg_id),
+                    rs->segment_file_size(seg_id), storage_resource.value()->fs, expiration_time,
+                    wait);
+
+            // 2nd. download inverted index files
+            int64_t file_size = -1;
+            auto schema_ptr = rs->tablet_schema();
+            auto idx_version = schema_ptr->get_inverted_index_storage_format();
+            const auto& idx_file_info = rs->inverted_index_file_info(seg_id);
+            if (idx_version == InvertedIndexStorageFormatPB::V1) {
+                for (const auto& index : schema_ptr->inverted_indexes()) {
+                    auto idx_path = storage_resource.value()->remote_idx_v1_path(
+                            *rs, seg_id, index->index_id(), index->get_index_suffix());
+                    if (idx_file_info.index_info_size() > 0) {
+                        for (const auto& idx_info : idx_file_info.index_info()) {
+                            if (index->index_id() == idx_info.index_id() &&
+                                index->get_index_suffix() == idx_info.index_suffix()) {
+                                file_size = idx_info.index_file_size();
+                                break;
+                            }
+                        }
+                    }
+                    bytes += submit_download_tasks(idx_path, file_size,
+                                                   storage_resource.value()->fs, expiration_time,
+                                                   wait);
+                }
+            } else {
+                if (schema_ptr->has_inverted_index()) {
+                    auto idx_path = storage_resource.value()->remote_idx_v2_path(*rs, seg_id);
+                    file_size =
+                            idx_file_info.has_index_size() ? idx_file_info.index_size() : -1;
+                    bytes += submit_download_tasks(idx_path, file_size,
+                                                   storage_resource.value()->fs, expiration_time,
+                                                   wait);
+                }
+            }
+        }
+    }
+    return bytes;
 }
 
 void CloudWarmUpManager::handle_jobs() {
@@ -146,63 +220,7 @@ void CloudWarmUpManager::handle_jobs() {
                 continue;
             }
 
-            auto tablet_meta = tablet->tablet_meta();
-            auto rs_metas = snapshot_rs_metas(tablet.get());
-            for (auto& [_, rs] : rs_metas) {
-                for (int64_t seg_id = 0; seg_id < rs->num_segments(); seg_id++) {
-                    auto storage_resource = rs->remote_storage_resource();
-                    if (!storage_resource) {
-                        LOG(WARNING) << storage_resource.error();
-                        continue;
-                    }
-
-                    int64_t expiration_time =
-                            tablet_meta->ttl_seconds() == 0 || rs->newest_write_timestamp() <= 0
-                                    ? 0
-                                    : rs->newest_write_timestamp() + tablet_meta->ttl_seconds();
-                    if (expiration_time <= UnixSeconds()) {
-                        expiration_time = 0;
-                    }
-
-                    // 1st. download segment files
-                    submit_download_tasks(
-                            storage_resource.value()->remote_segment_path(*rs, seg_id),
-                            rs->segment_file_size(seg_id), storage_resource.value()->fs,
-                            expiration_time, wait);
-
-                    // 2nd. download inverted index files
-                    int64_t file_size = -1;
-                    auto schema_ptr = rs->tablet_schema();
-                    auto idx_version = schema_ptr->get_inverted_index_storage_format();
-                    const auto& idx_file_info = rs->inverted_index_file_info(seg_id);
-                    if (idx_version == InvertedIndexStorageFormatPB::V1) {
-                        for (const auto& index : schema_ptr->inverted_indexes()) {
-                            auto idx_path = storage_resource.value()->remote_idx_v1_path(
-                                    *rs, seg_id, index->index_id(), index->get_index_suffix());
-                            if (idx_file_info.index_info_size() > 0) {
-                                for (const auto& idx_info : idx_file_info.index_info()) {
-                                    if (index->index_id() == idx_info.index_id() &&
-                                        index->get_index_suffix() == idx_info.index_suffix()) {
-                                        file_size = idx_info.index_file_size();
-                                        break;
-                                    }
-                                }
-                            }
-                            submit_download_tasks(idx_path, file_size, storage_resource.value()->fs,
-                                                  expiration_time, wait);
-                        }
-                    } else {
-                        if (schema_ptr->has_inverted_index()) {
-                            auto idx_path =
-                                    storage_resource.value()->remote_idx_v2_path(*rs, seg_id);
-                            file_size = idx_file_info.has_index_size() ? idx_file_info.index_size()
-                                                                       : -1;
-                            submit_download_tasks(idx_path, file_size, storage_resource.value()->fs,
-                                                  expiration_time, wait);
-                        }
-                    }
-                }
-            }
+            submit_tablet_download_tasks(tablet.get(), wait);
         }
 
         timespec time;
@@ -219,6 +237,126 @@ void CloudWarmUpManager::handle_jobs() {
 #endif
 }
 
+void CloudWarmUpManager::handle_hotspot_warm_up() {
+#ifndef BE_TEST
+    while (true) {
+        {
+            std::unique_lock lock(_mtx);
+            _cond.wait_for(lock, std::chrono::seconds(config::hotspot_warm_up_interval_s),
+                           [this]() { return _closed; });
+            if (_closed) {
+                break;
+            }
+        }
+        if (config::hotspot_warm_up_source_be.empty()) {
+            _hot_tablet_warmed_versions.clear();
+            continue;
+        }
+        std::vector<int64_t> tablet_ids;
+        auto st = fetch_hot_tablets(&tablet_ids);
+        if (!st) {
+            LOG_WARNING("Failed to get hot tablets")
+                    .tag("source_be", config::hotspot_warm_up_source_be)
+                    .error(st);
+            continue;
+        }
+        warm_up_hot_tablets(tablet_ids);
+    }
+#endif
+}
+
+Status CloudWarmUpManager::fetch_hot_tablets(std::vector<int64_t>* tablet_ids) {
+    std::string url = fmt::format("http://{}/api/hotspot/tablet?metrics=query&topn={}",
+                                  config::hotspot_warm_up_source_be, config::hotspot_warm_up_top_n);
+    std::string ranking;
+    RETURN_IF_ERROR(HttpClient::execute_with_retry(3, 1, [&](HttpClient* client) {
+        RETURN_IF_ERROR(client->init(url));
+        client->set_timeout_ms(10 * 1000);
+        return client->execute(&ranking);
+    }));
+    return parse_hot_tablets(ranking, tablet_ids);
+}
+
+Status CloudWarmUpManager::parse_hot_tablets(const std::string& ranking,
+                                             std::vector<int64_t>* tablet_ids) {
+    std::string_view remain = ranking;
+    while (!remain.empty()) {
+        size_t end = remain.find('\n');
+        std::string_view line = remain.substr(0, end);
+        remain = end == std::string_view::npos ? std::string_view {} : remain.substr(end + 1);
+        if (line.empty()) {
+            continue;
+        }
+        int64_t tablet_id = 0;
+        auto [ptr, ec] = std::from_chars(line.data(), line.data() + line.size(), tablet_id);
+        if (ec != std::errc() || (ptr != line.data() + line.size() && *ptr != ' ')) {
+            return Status::InvalidArgument("invalid hot tablet line: {}", line);
+        }
+        tablet_ids->push_back(tablet_id);
+    }
+    return Status::OK();
+}
+
+void CloudWarmUpManager::warm_up_hot_tablets(const std::vector<int64_t>& tablet_ids) {
+    constexpr int WAIT_TIME_SECONDS = 600;
+    auto start = std::chrono::steady_clock::now();
+    int64_t total_bytes = 0;
+    int64_t num_warmed = 0;
+    // Only keep the tablets of this round, the ones not hot any more are warmed up again later
+    std::unordered_map<int64_t, int64_t> warmed_versions;
+    for (int64_t tablet_id : tablet_ids) {
+        {
+            std::lock_guard lock(_mtx);
+            // The jobs from FE go first
+            if (_closed || !_pending_job_metas.empty()) {
+                break;
+            }
+        }
+        // A tablet not in the tablet cache is served by other BEs of the compute group
+        auto res = _engine.tablet_mgr().get_tablet(tablet_id, false, false, nullptr, true);
+        if (!res.has_value()) {
+            continue;
+        }
+        auto tablet = res.value();
+        auto st = tablet->sync_rowsets();
+        if (!st) {
+            LOG_WARNING("Hotspot warm up error ").tag("tablet_id", tablet_id).error(st);
+            continue;
+        }
+        int64_t max_version = tablet->max_version_unlocked();
+        warmed_versions[tablet_id] = max_version;
+        if (auto iter = _hot_tablet_warmed_versions.find(tablet_id);
+            iter != _hot_tablet_warmed_versions.end() && iter->second == max_version) {
+            continue;
+        }
+
+        auto wait = std::make_shared<bthread::CountdownEvent>(0);
+        total_bytes += submit_tablet_download_tasks(tablet.get(), wait);
+        timespec time {.tv_sec = UnixSeconds() + WAIT_TIME_SECONDS, .tv_nsec = 0};
+        if (wait->timed_wait(time)) {
+            LOG_WARNING("Hotspot warm up tablet {} take a long time", tablet_id);
+        }
+        ++num_warmed;
+
+        int64_t bytes_per_second = config::hotspot_warm_up_bytes_per_second;
+        if (bytes_per_second > 0) {
+            auto deadline =
+                    start + std::chrono::milliseconds(total_bytes * 1000 / bytes_per_second);
+            std::unique_lock lock(_mtx);
+            _cond.wait_until(lock, deadline, [this]() { return _closed; });
+        }
+    }
+    _hot_tablet_warmed_versions = std::move(warmed_versions);
+    if (num_warmed > 0) {
+        LOG_INFO("Hotspot warm up finished")
+                .tag("num_tablets", num_warmed)
+                .tag("bytes", total_bytes)
+                .tag("cost_ms", std::chrono::duration_cast<std::chrono::milliseconds>(
+                                        std::chrono::steady_clock::now() - start)
+                                        .count());
+    }
+}
+
 JobMeta::JobMeta(const TJobMeta& meta)
         : be_ip(meta.be_ip), brpc_port(meta.brpc_port), tablet_ids(meta.tablet_ids) {
     switch (meta.download_type) {
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "cloud/cloud_storage_engine.h"
@@ -69,11 +70,24 @@ public:
     // Cancel the job
     Status clear_job(int64_t job_id);
 
+    // Parse the ranking of /api/hotspot/tablet?metrics=query, a "tablet_id count" line each
+    static Status parse_hot_tablets(const std::string& ranking, std::vector<int64_t>* tablet_ids);
+
 private:
     void handle_jobs();
-    void submit_download_tasks(io::Path path, int64_t file_size, io::FileSystemSPtr file_system,
-                               int64_t expiration_time,
-                               std::shared_ptr<bthread::CountdownEvent> wait);
+    // Return the bytes to download
+    int64_t submit_download_tasks(io::Path path, int64_t file_size, io::FileSystemSPtr file_system,
+                                  int64_t expiration_time,
+                                  std::shared_ptr<bthread::CountdownEvent> wait);
+    // Download the segment and index files of the tablet, return the bytes to download
+    int64_t submit_tablet_download_tasks(CloudTablet* tablet,
+                                         std::shared_ptr<bthread::CountdownEvent> wait);
+
+    // Pull the hot tablets of another compute group and warm up the ones this BE serves
+    void handle_hotspot_warm_up();
+    Status fetch_hot_tablets(std::vector<int64_t>* tablet_ids);
+    void warm_up_hot_tablets(const std::vector<int64_t>& tablet_ids);
+
     std::mutex _mtx;
     std::condition_variable _cond;
     int64_t _cur_job_id {0};
@@ -81,6 +95,9 @@ private:
     std::deque<std::shared_ptr<JobMeta>> _pending_job_metas;
     std::vector<std::shared_ptr<JobMeta>> _finish_job;
     std::thread _download_thread;
+    std::thread _hotspot_thread;
+    // tablet id -> the max version warmed up, only accessed by _hotspot_thread
+    std::unordered_map<int64_t, int64_t> _hot_tablet_warmed_versions;
     bool _closed {false};
     // the attribute for compile in ut
     [[maybe_unused]] CloudStorageEngine& _engine;
@@ -91,5 +91,15 @@ DEFINE_mInt32(meta_service_conflict_error_retry_times, "10");
 
 DEFINE_Bool(enable_check_storage_vault, "true");
 
+DEFINE_mBool(enable_cloud_share_rowset_schema, "true");
+
+DEFINE_mString(hotspot_warm_up_source_be, "");
+
+DEFINE_mInt32(hotspot_warm_up_interval_s, "300");
+
+DEFINE_mInt32(hotspot_warm_up_top_n, "1000");
+
+DEFINE_mInt64(hotspot_warm_up_bytes_per_second, "104857600");
+
 #include "common/compile_check_end.h"
 } // namespace doris::config
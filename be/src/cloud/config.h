@@ -127,5 +127,18 @@ DECLARE_mInt32(meta_service_conflict_error_retry_times);
 
 DECLARE_Bool(enable_check_storage_vault);
 
+// The synced rowsets of a tablet with the same schema version and without variant columns share
+// one cached tablet schema, instead of converting and serializing the schema of each rowset.
+DECLARE_mBool(enable_cloud_share_rowset_schema);
+
+// Warm up the tablets of this BE which are hot in another compute group. The ranking is pulled
+// from a BE of that group ("host:http_port") every `hotspot_warm_up_interval_s`, empty to disable.
+DECLARE_mString(hotspot_warm_up_source_be);
+DECLARE_mInt32(hotspot_warm_up_interval_s);
+// the number of the hottest tablets pulled for each round
+DECLARE_mInt32(hotspot_warm_up_top_n);
+// the average download bandwidth of a round, 0 for no limit
+DECLARE_mInt64(hotspot_warm_up_bytes_per_second);
+
 #include "common/compile_check_end.h"
 } // namespace doris::config
@@ -138,6 +138,8 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
 
+DEFINE_Int64(mmap_huge_page_threshold, "-1"); // bytes
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DEFINE_mInt32(hash_table_double_grow_degree, "31");
@@ -227,6 +229,8 @@ DEFINE_Int32(alter_tablet_worker_count, "3");
 DEFINE_Int32(alter_index_worker_count, "3");
 // the count of thread to clone
 DEFINE_Int32(clone_worker_count, "3");
+DEFINE_Int32(clone_high_prior_worker_count, "1");
+DEFINE_mInt32(clone_download_concurrency_per_disk, "4");
 // the count of thread to clone
 DEFINE_Int32(storage_medium_migrate_count, "1");
 // the count of thread to check consistency
@@ -325,15 +329,26 @@ DEFINE_mInt32(doris_scanner_row_num, "16384");
 DEFINE_mInt32(doris_scanner_row_bytes, "10485760");
 // single read execute fragment max run time millseconds
 DEFINE_mInt32(doris_scanner_max_run_time_ms, "1000");
+DEFINE_mBool(enable_adaptive_scan_concurrency, "true");
+DEFINE_mInt32(adaptive_scan_concurrency_interval_ms, "100");
 // (Advanced) Maximum size of per-query receive-side buffer
 DEFINE_mInt32(exchg_node_buffer_size_bytes, "20485760");
 DEFINE_mInt32(exchg_buffer_queue_capacity_factor, "64");
+DEFINE_mInt32(exchange_sink_coalesce_blocks_byte_size, "0");
+DEFINE_mBool(enable_exchange_adaptive_compression, "false");
+DEFINE_mBool(enable_transmit_block_by_attachment, "false");
+DEFINE_mInt64(transmit_block_attachment_min_bytes, "65536");
+DEFINE_mInt32(exchange_adaptive_compression_sample_interval, "64");
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DEFINE_mInt64(memory_limitation_per_thread_for_schema_change_bytes, "2147483648");
+DEFINE_mInt32(schema_change_rowset_parallelism, "1");
 
 DEFINE_mInt32(cache_prune_interval_sec, "10");
 DEFINE_mInt32(cache_periodic_prune_stale_sweep_sec, "60");
+DEFINE_mBool(enable_cache_capacity_arbitration, "false");
+DEFINE_mInt32(cache_capacity_arbitration_interval_sec, "60");
+DEFINE_mDouble(cache_capacity_arbitration_max_weighted, "4");
 // the clean interval of tablet lookup cache
 DEFINE_mInt32(tablet_lookup_cache_stale_sweep_time_sec, "30");
 DEFINE_mInt32(point_query_row_cache_stale_sweep_time_sec, "300");
@@ -380,6 +395,8 @@ DEFINE_Int32(storage_page_cache_shard_size, "256");
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DEFINE_Int32(index_page_cache_percentage, "10");
+DEFINE_Int32(compressed_data_page_cache_percentage, "0");
+DEFINE_mInt32(compressed_data_page_cache_promote_hits, "2");
 // whether to disable page cache feature in storage
 DEFINE_mBool(disable_storage_page_cache, "false");
 // whether to disable row cache feature in storage
@@ -395,6 +412,18 @@ DEFINE_Int32(primary_key_data_page_size, "32768");
 DEFINE_mInt32(data_page_cache_stale_sweep_time_sec, "300");
 DEFINE_mInt32(index_page_cache_stale_sweep_time_sec, "600");
 DEFINE_mInt32(pk_index_page_cache_stale_sweep_time_sec, "600");
+DEFINE_Bool(data_page_cache_enable_tiny_lfu, "false");
+DEFINE_Bool(index_page_cache_enable_tiny_lfu, "false");
+DEFINE_Bool(pk_index_page_cache_enable_tiny_lfu, "false");
+DEFINE_Bool(segment_cache_enable_tiny_lfu, "false");
+DEFINE_Bool(inverted_index_query_cache_enable_tiny_lfu, "false");
+// a scan of a large table shouldn't flush the page indexes of the hot partitions
+DEFINE_Bool(file_meta_range_cache_enable_tiny_lfu, "true");
+
+DEFINE_mBool(enable_alp_encoding, "false");
+DEFINE_mBool(enable_fsst_encoding, "false");
+DEFINE_mBool(enable_delta_encoding, "false");
+DEFINE_mBool(enable_string_page_bloom_filter, "false");
 
 DEFINE_Bool(enable_low_cardinality_optimize, "true");
 DEFINE_Bool(enable_low_cardinality_cache_code, "true");
@@ -414,6 +443,21 @@ DEFINE_mInt32(vertical_compaction_num_columns_per_group, "5");
 DEFINE_Int32(vertical_compaction_max_row_source_memory_mb, "1024");
 // In vertical compaction, max dest segment file size
 DEFINE_mInt64(vertical_compaction_max_segment_size, "1073741824");
+DEFINE_mInt32(vertical_compaction_pipeline_blocks, "2");
+DEFINE_Int32(vertical_compaction_write_thread_num, "8");
+DEFINE_mBool(enable_background_disk_io_throttle, "false");
+DEFINE_mInt64(background_disk_io_max_bytes_per_second, "524288000");
+DEFINE_mInt64(background_disk_io_min_bytes_per_second, "20971520");
+DEFINE_mInt64(background_disk_io_target_read_latency_us, "10000");
+DEFINE_mInt32(background_disk_io_idle_ms, "1000");
+DEFINE_mString(background_write_page_cache_mode, "drop_behind");
+DEFINE_Validator(background_write_page_cache_mode, [](const std::string& config) -> bool {
+    return config == "cached" || config == "drop_behind" || config == "direct";
+});
+DEFINE_mInt64(drop_behind_write_window_bytes, "8388608");
+DEFINE_mInt32(direct_io_write_buffer_size, "1048576");
+DEFINE_Validator(direct_io_write_buffer_size,
+                 [](const int config) -> bool { return config > 0 && config % 4096 == 0; });
 
 // If enabled, segments will be flushed column by column
 DEFINE_mBool(enable_vertical_segment_writer, "true");
@@ -551,6 +595,7 @@ DEFINE_String(ssl_private_key_path, "");
 DEFINE_Bool(enable_all_http_auth, "false");
 // Number of webserver workers
 DEFINE_Int32(webserver_num_workers, "128");
+DEFINE_Bool(enable_webserver_reuse_port, "false");
 
 DEFINE_Bool(enable_single_replica_load, "true");
 // Number of download workers for single replica load
@@ -633,8 +678,14 @@ DEFINE_Int32(min_buffer_size, "1024"); // 1024, The minimum read buffer size (in
 DEFINE_String(pprof_profile_dir, "${DORIS_HOME}/log");
 // for jeprofile in jemalloc
 DEFINE_mString(jeprofile_dir, "${DORIS_HOME}/log");
+DEFINE_Int32(continuous_heap_profile_interval_s, "0");
+DEFINE_mInt32(continuous_heap_profile_ring_size, "12");
+DEFINE_Int32(continuous_heap_profile_lg_sample, "21");
 DEFINE_mBool(enable_je_purge_dirty_pages, "true");
 DEFINE_mInt32(je_dirty_decay_ms, "5000");
+DEFINE_Int32(je_query_arena_num, "0");
+// 8G
+DEFINE_mInt64(je_query_arena_min_mem_limit, "8589934592");
 
 // to forward compatibility, will be removed later
 DEFINE_mBool(enable_token_check, "true");
@@ -661,6 +712,10 @@ DEFINE_mInt32(memory_gc_sleep_time_ms, "500");
 DEFINE_mInt64(write_buffer_size, "209715200");
 // max buffer size used in memtable for the aggregated table, default 400MB
 DEFINE_mInt64(write_buffer_size_for_agg, "419430400");
+DEFINE_Int32(memtable_sort_thread_num, "4");
+DEFINE_mInt64(memtable_sort_part_rows, "1048576");
+DEFINE_Int32(segment_column_encode_thread_num, "4");
+DEFINE_mInt32(segment_parallel_encode_min_columns, "64");
 // max parallel flush task per memtable writer
 DEFINE_mInt32(memtable_flush_running_count_limit, "2");
 
@@ -688,6 +743,7 @@ DEFINE_mInt32(result_buffer_cancelled_interval_time, "300");
 
 // arrow flight result sink buffer rows size, default 4096 * 8
 DEFINE_mInt32(arrow_flight_result_sink_buffer_size_rows, "32768");
+DEFINE_mInt64(arrow_flight_result_sink_buffer_size_bytes, "67108864");
 // The timeout for ADBC Client to wait for data using arrow flight reader.
 // If the query is very complex and no result is generated after this time, consider increasing this timeout.
 DEFINE_mInt32(arrow_flight_reader_brpc_controller_timeout_ms, "300000");
@@ -712,6 +768,7 @@ DEFINE_Bool(enable_metric_calculator, "true");
 
 // max consumer num in one data consumer group, for routine load
 DEFINE_mInt32(max_consumer_num_per_group, "3");
+DEFINE_mInt32(routine_load_consume_batch_size, "256");
 
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
@@ -733,6 +790,7 @@ DEFINE_String(es_scroll_keepalive, "5m");
 
 // HTTP connection timeout for es
 DEFINE_mInt32(es_http_timeout_ms, "5000");
+DEFINE_mInt32(es_scroll_slices_per_shard, "1");
 
 // the max client cache number per each host
 // There are variety of client cache in BE, but currently we use the
@@ -763,6 +821,7 @@ DEFINE_Int32(high_priority_flush_thread_num_per_store, "6");
 // number of threads = min(flush_thread_num_per_store * num_store,
 //                         max_flush_thread_num_per_cpu * num_cpu)
 DEFINE_Int32(max_flush_thread_num_per_cpu, "4");
+DEFINE_mInt64(blocking_flush_memtable_max_bytes, "16777216");
 
 // config for tablet meta checkpoint
 DEFINE_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
@@ -856,6 +915,7 @@ DEFINE_mInt32(remote_storage_read_buffer_mb, "16");
 // Decreasing this value will increase the frequency of consume/release.
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DEFINE_mInt32(mem_tracker_consume_min_size_bytes, "1048576");
+DEFINE_mBool(enable_consumer_mem_tracker_batch_consume, "false");
 
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
@@ -899,6 +959,8 @@ DEFINE_mInt32(segment_compression_threshold_kb, "256");
 
 // Time to clean up useless JDBC connection pool cache
 DEFINE_mInt32(jdbc_connection_pool_cache_clear_time_sec, "28800");
+DEFINE_mInt32(jdbc_sink_batch_rows, "4096");
+DEFINE_mInt32(jdbc_sink_parallel_connections, "1");
 
 // Global bitmap cache capacity for aggregation cache, size in bytes
 DEFINE_Int64(delete_bitmap_agg_cache_capacity, "104857600");
@@ -908,6 +970,7 @@ DEFINE_Int64(delete_bitmap_agg_cache_capacity, "104857600");
 // we will take the larger of 1.0% of the total memory and 100MB as the delete bitmap cache size.
 DEFINE_String(delete_bitmap_dynamic_agg_cache_limit, "1.0%");
 DEFINE_mInt32(delete_bitmap_agg_cache_stale_sweep_time_sec, "1800");
+DEFINE_mBool(enable_seal_delete_bitmap, "true");
 
 // reference https://github.com/edenhill/librdkafka/blob/master/INTRODUCTION.md#broker-version-compatibility
 // If the dependent kafka broker version older than 0.10.0.0,
@@ -967,6 +1030,8 @@ DEFINE_mInt32(parquet_header_max_size_mb, "1");
 DEFINE_mInt32(parquet_rowgroup_max_buffer_mb, "128");
 // Max buffer size for parquet chunk column
 DEFINE_mInt32(parquet_column_max_buffer_mb, "8");
+DEFINE_mInt32(parquet_prefetch_row_group_num, "2");
+DEFINE_mInt64(parquet_prefetch_row_group_max_bytes, "268435456");
 DEFINE_mDouble(max_amplified_read_ratio, "0.8");
 DEFINE_mInt32(merged_oss_min_io_size, "1048576");
 DEFINE_mInt32(merged_hdfs_min_io_size, "8192");
@@ -978,6 +1043,7 @@ DEFINE_mInt64(small_column_size_buffer, "100");
 
 // Perform the always_true check at intervals determined by runtime_filter_sampling_frequency
 DEFINE_mInt32(runtime_filter_sampling_frequency, "64");
+DEFINE_mInt32(runtime_filter_filtered_row_benefit_ns, "0");
 DEFINE_mInt32(execution_max_rpc_timeout_sec, "3600");
 DEFINE_mBool(execution_ignore_eovercrowded, "true");
 // cooldown task configs
@@ -997,6 +1063,7 @@ DEFINE_Bool(enable_time_lut, "true");
 DEFINE_mBool(enable_simdjson_reader, "true");
 
 DEFINE_mBool(enable_query_like_bloom_filter, "true");
+DEFINE_mBool(enable_query_regexp_bloom_filter, "true");
 // number of s3 scanner thread pool size
 DEFINE_Int32(doris_remote_scanner_thread_pool_thread_num, "48");
 // number of s3 scanner thread pool queue size
@@ -1046,6 +1113,8 @@ DEFINE_Int64(segcompaction_task_max_bytes, "157286400");
 // Global segcompaction thread pool size.
 DEFINE_mInt32(segcompaction_num_threads, "5");
 
+DEFINE_mBool(segcompaction_defer_on_load_memory_pressure, "true");
+
 // enable java udf and jdbc scannode
 DEFINE_Bool(enable_java_support, "true");
 
@@ -1058,6 +1127,14 @@ DEFINE_Bool(enable_fuzzy_mode, "false");
 DEFINE_Bool(enable_debug_points, "false");
 
 DEFINE_Int32(pipeline_executor_size, "0");
+DEFINE_Bool(enable_pipeline_numa_aware_scheduling, "false");
+DEFINE_mBool(enable_pipeline_workload_group_fair_schedule, "false");
+DEFINE_mInt32(pipeline_fair_schedule_max_lag_ms, "100");
+DEFINE_mInt32(pipeline_task_affinity_queue_threshold, "16");
+DEFINE_mBool(enable_adaptive_pipeline_parallelism, "false");
+DEFINE_mInt32(adaptive_pipeline_min_running_tasks, "1");
+DEFINE_Int32(pipeline_trace_ring_buffer_size, "2048");
+DEFINE_mBool(enable_pipeline_task_perf_counters, "false");
 DEFINE_Bool(enable_workload_group_for_scan, "false");
 DEFINE_mInt64(workload_group_scan_task_wait_timeout_ms, "10000");
 
@@ -1086,6 +1163,7 @@ DEFINE_String(file_cache_path, "[{\"path\":\"${DORIS_HOME}/file_cache\"}]");
 DEFINE_Int64(file_cache_each_block_size, "1048576"); // 1MB
 
 DEFINE_Bool(clear_file_cache, "false");
+DEFINE_Int32(file_cache_shards_per_path, "1");
 DEFINE_Bool(enable_file_cache_query_limit, "false");
 DEFINE_mInt32(file_cache_enter_disk_resource_limit_mode_percent, "90");
 DEFINE_mInt32(file_cache_exit_disk_resource_limit_mode_percent, "88");
@@ -1097,16 +1175,25 @@ DEFINE_mInt64(file_cache_evict_in_advance_batch_bytes, "31457280"); // 30MB
 DEFINE_mInt64(file_cache_evict_in_advance_recycle_keys_num_threshold, "1000");
 
 DEFINE_mBool(enable_read_cache_file_directly, "false");
+DEFINE_mBool(enable_file_cache_write_behind, "false");
+DEFINE_mInt64(file_cache_write_behind_max_bytes, "268435456");
+DEFINE_Int32(file_cache_write_behind_thread_num, "4");
+DEFINE_mBool(enable_file_cache_io_uring, "false");
+DEFINE_Int32(io_uring_queue_depth, "64");
 DEFINE_mBool(file_cache_enable_evict_from_other_queue_by_size, "true");
 // If true, evict the ttl cache using LRU when full.
 // Otherwise, only expiration can evict ttl and new data won't add to cache when full.
 DEFINE_Bool(enable_ttl_cache_evict_using_lru, "true");
+DEFINE_String(file_cache_segmented_fifo_queues, "");
+DEFINE_Int32(file_cache_segmented_fifo_probation_percent, "10");
+DEFINE_Bool(enable_file_cache_meta_checkpoint, "false");
 DEFINE_mBool(enbale_dump_error_file, "false");
 // limit the max size of error log on disk
 DEFINE_mInt64(file_cache_error_log_limit_bytes, "209715200"); // 200MB
 DEFINE_mInt64(cache_lock_wait_long_tail_threshold_us, "30000000");
 DEFINE_mInt64(cache_lock_held_long_tail_threshold_us, "30000000");
 DEFINE_mBool(enable_file_cache_keep_base_compaction_output, "false");
+DEFINE_mDouble(file_cache_keep_compaction_output_min_cached_ratio, "0.8");
 DEFINE_mInt64(file_cache_remove_block_qps_limit, "1000");
 DEFINE_mInt64(file_cache_background_gc_interval_ms, "100");
 DEFINE_mBool(enable_reader_dryrun_when_download_file_cache, "true");
@@ -1129,12 +1216,14 @@ DEFINE_Int32(inverted_index_query_cache_shards, "256");
 
 // inverted index match bitmap cache size
 DEFINE_String(inverted_index_query_cache_limit, "10%");
+DEFINE_mBool(enable_inverted_index_term_cache, "true");
 
 // inverted index
 DEFINE_mDouble(inverted_index_ram_buffer_size, "512");
 // -1 indicates not working.
 // Normally we should not change this, it's useful for testing.
 DEFINE_mInt32(inverted_index_max_buffered_docs, "-1");
+DEFINE_mInt64(inverted_index_writer_flush_threshold_bytes, "0");
 // dict path for chinese analyzer
 DEFINE_String(inverted_index_dict_path, "${DORIS_HOME}/dict");
 DEFINE_Int32(inverted_index_read_buffer_size, "4096");
@@ -1142,18 +1231,23 @@ DEFINE_Int32(inverted_index_read_buffer_size, "4096");
 DEFINE_Int32(max_depth_in_bkd_tree, "32");
 // index compaction
 DEFINE_mBool(inverted_index_compaction_enable, "true");
+DEFINE_Int32(inverted_index_compaction_thread_num, "4");
+DEFINE_mInt64(inverted_index_compaction_task_mem_limit_bytes, "-1");
 // Only for debug, do not use in production
 DEFINE_mBool(debug_inverted_index_compaction, "false");
 // index by RAM directory
 DEFINE_mBool(inverted_index_ram_dir_enable, "true");
 // wheather index by RAM directory when base compaction
 DEFINE_mBool(inverted_index_ram_dir_enable_when_base_compaction, "true");
+DEFINE_mInt32(inverted_index_max_runtime_filter_in_list_size, "128");
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DEFINE_Int32(num_broadcast_buffer, "32");
 
 // max depth of expression tree allowed.
 DEFINE_Int32(max_depth_of_expr_tree, "600");
 
+DEFINE_Bool(enable_projection_common_subexpr_reuse, "true");
+
 // Report a tablet as bad when io errors occurs more than this value.
 DEFINE_mInt64(max_tablet_io_errors, "-1");
 
@@ -1163,6 +1257,11 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 
 // it must be larger than or equal to 5MB
 DEFINE_mInt64(s3_write_buffer_size, "5242880");
+DEFINE_mInt32(s3_write_part_size_grow_interval, "1000");
+// 5GB, the max part size of S3
+DEFINE_mInt64(s3_write_max_part_size, "5368709120");
+DEFINE_mInt64(s3_write_buffer_initial_size, "262144");
+DEFINE_mInt32(s3_upload_max_concurrency_per_host, "64");
 // Log interval when doing s3 upload task
 DEFINE_mInt32(s3_file_writer_log_interval_second, "60");
 DEFINE_mInt64(file_cache_max_file_reader_cache_size, "1000000");
@@ -1177,6 +1276,7 @@ DEFINE_mInt32(schema_cache_sweep_time_sec, "100");
 DEFINE_Int32(segment_cache_capacity, "-1");
 DEFINE_Int32(segment_cache_fd_percentage, "20");
 DEFINE_mInt32(estimated_mem_per_column_reader, "512");
+DEFINE_mInt32(max_column_readers_per_segment, "1024");
 DEFINE_Int32(segment_cache_memory_percentage, "5");
 
 // enable feature binlog, default false
@@ -1188,6 +1288,12 @@ DEFINE_Bool(enable_set_in_bitmap_value, "true");
 DEFINE_Int64(max_hdfs_file_handle_cache_num, "20000");
 DEFINE_Int32(max_hdfs_file_handle_cache_time_sec, "28800");
 DEFINE_Int64(max_external_file_meta_cache_num, "1000");
+// 256MB
+DEFINE_Int64(max_external_file_meta_range_cache_bytes, "268435456");
+// 256MB
+DEFINE_Int64(max_external_deletion_vector_cache_bytes, "268435456");
+// 128MB
+DEFINE_Int64(max_hyperscan_database_cache_bytes, "134217728");
 DEFINE_mInt32(common_obj_lru_cache_stale_sweep_time_sec, "900");
 // Apply delete pred in cumu compaction
 DEFINE_mBool(enable_delete_when_cumu_compaction, "false");
@@ -1216,6 +1322,9 @@ DEFINE_mInt64(auto_inc_low_water_level_mark_size_ratio, "3");
 DEFINE_mInt64(auto_inc_fetch_thread_num, "3");
 // default max to 2048 connections
 DEFINE_mInt64(lookup_connection_cache_capacity, "2048");
+DEFINE_Bool(enable_descriptor_tbl_cache, "false");
+DEFINE_Int64(descriptor_tbl_cache_capacity, "1024");
+DEFINE_mInt32(descriptor_tbl_cache_stale_sweep_time_sec, "300");
 
 // level of compression when using LZ4_HC, whose defalut value is LZ4HC_CLEVEL_DEFAULT
 DEFINE_mInt64(LZ4_HC_compression_level, "9");
@@ -1273,6 +1382,9 @@ DEFINE_mInt32(group_commit_queue_mem_limit, "67108864");
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DEFINE_String(group_commit_wal_max_disk_limit, "10%");
 DEFINE_Bool(group_commit_wait_replay_wal_finish, "false");
+DEFINE_mBool(enable_group_commit_wal_compression, "true");
+DEFINE_mBool(enable_adaptive_group_commit_interval, "false");
+DEFINE_mInt32(group_commit_min_interval_ms, "50");
 
 DEFINE_mInt32(scan_thread_nice_value, "0");
 DEFINE_mInt32(tablet_schema_cache_recycle_interval, "3600");
@@ -1291,6 +1403,11 @@ DEFINE_mInt32(be_proc_monitor_interval_ms, "10000");
 DEFINE_Int32(workload_group_metrics_interval_ms, "5000");
 
 DEFINE_Bool(ignore_always_true_predicate_for_segment, "true");
+DEFINE_mBool(enable_adaptive_predicate_order, "true");
+DEFINE_mBool(enable_segment_data_page_prefetch, "true");
+DEFINE_mInt64(segment_prefetch_window_bytes, "16777216");
+DEFINE_mInt64(segment_prefetch_merge_distance_bytes, "1048576");
+DEFINE_mInt64(segment_prefetch_max_read_bytes, "8388608");
 
 // Ingest binlog work pool size, -1 is disable, 0 is hardware concurrency
 DEFINE_Int32(ingest_binlog_work_pool_size, "-1");
@@ -1313,6 +1430,25 @@ DEFINE_mInt32(variant_max_merged_tablet_schema_size, "2048");
 DEFINE_mBool(enable_column_type_check, "true");
 // 128 MB
 DEFINE_mInt64(local_exchange_buffer_mem_limit, "134217728");
+DEFINE_mDouble(local_exchange_skew_factor, "0");
+DEFINE_mInt64(local_exchange_skew_min_rows, "65536");
+// 32 MB
+DEFINE_mInt64(hash_join_probe_prefetch_min_table_bytes, "33554432");
+DEFINE_mBool(enable_nested_loop_join_range_index, "true");
+DEFINE_mInt64(hash_join_parallel_build_min_rows, "1048576");
+DEFINE_mInt32(hash_join_parallel_build_max_threads, "8");
+// 1 GB
+DEFINE_mInt64(spill_hash_join_partition_max_bytes, "1073741824");
+DEFINE_mInt32(spill_hash_join_max_repartition_depth, "3");
+DEFINE_mInt32(spill_aggregation_retain_partition_percent, "0");
+DEFINE_mInt64(streaming_agg_sample_window_rows, "65536");
+DEFINE_mInt32(streaming_agg_hot_key_cache_size, "16384");
+DEFINE_mInt64(agg_parallel_merge_min_groups, "1048576");
+DEFINE_mInt32(agg_parallel_merge_buckets, "8");
+DEFINE_mBool(enable_dict_code_aggregation, "false");
+DEFINE_mBool(enable_sort_normalized_key, "true");
+DEFINE_mInt64(full_sort_parallel_min_rows, "1048576");
+DEFINE_mInt32(full_sort_parallel_max_threads, "8");
 
 // Default 300s, if its value <= 0, then log is disabled
 DEFINE_mInt64(enable_debug_log_timeout_secs, "0");
@@ -1345,10 +1481,18 @@ DEFINE_Validator(spill_io_thread_pool_thread_num, [](const int config) -> bool {
     return true;
 });
 DEFINE_Int32(spill_io_thread_pool_queue_size, "102400");
+DEFINE_mBool(enable_spill_async_io, "true");
+DEFINE_mBool(enable_spill_to_remote_storage, "false");
+// 1TB
+DEFINE_mInt64(spill_remote_storage_limit_bytes, "1099511627776");
 
 // paused query in queue timeout(ms) will be resumed or canceled
 DEFINE_Int64(spill_in_paused_queue_timeout_ms, "60000");
 
+DEFINE_mInt32(spill_ahead_process_memory_percent, "0");
+// 256M
+DEFINE_mInt64(spill_ahead_min_revocable_bytes, "268435456");
+
 DEFINE_mBool(check_segment_when_build_rowset_meta, "false");
 
 DEFINE_mBool(force_azure_blob_global_endpoint, "false");
@@ -1356,6 +1500,11 @@ DEFINE_mBool(force_azure_blob_global_endpoint, "false");
 DEFINE_mInt32(max_s3_client_retry, "10");
 DEFINE_mInt32(s3_read_base_wait_time_ms, "100");
 DEFINE_mInt32(s3_read_max_wait_time_ms, "800");
+DEFINE_mInt64(s3_read_split_size, "0");
+DEFINE_mDouble(s3_hedged_read_percentile, "0");
+DEFINE_mInt64(s3_hedged_read_max_bytes, "8388608");
+DEFINE_mInt32(s3_hedged_read_min_delay_ms, "50");
+DEFINE_Int32(s3_file_read_thread_num, "32");
 DEFINE_mBool(enable_s3_object_check_after_upload, "true");
 
 DEFINE_mBool(enable_s3_rate_limiter, "false");
@@ -1395,6 +1544,9 @@ DEFINE_mInt64(table_sink_partition_write_min_partition_data_processed_rebalance_
               "15728640"); // 15MB
 // Maximum processed partition nums of per writer when partition writing
 DEFINE_mInt32(table_sink_partition_write_max_partition_nums_per_writer, "128");
+// Maximum bytes buffered by the open partition writers of per writer when partition writing
+DEFINE_mInt64(table_sink_partition_write_max_buffered_bytes_per_writer,
+              "1073741824"); // 1GB
 
 /** Hive sink configurations **/
 DEFINE_mInt64(hive_sink_max_file_size, "1073741824"); // 1GB
@@ -1430,6 +1582,7 @@ DEFINE_mDouble(max_hdfs_wirter_jni_heap_usage_ratio, "0.5");
 DEFINE_mInt64(hdfs_jni_write_sleep_milliseconds, "300");
 // The max retry times when hdfs write failed
 DEFINE_mInt64(hdfs_jni_write_max_retry_time, "3");
+DEFINE_mBool(enable_jni_arrow_c_data_interface, "true");
 
 // The min thread num for NonBlockCloseThreadPool
 DEFINE_Int64(min_nonblock_close_thread_num, "12");
@@ -1447,6 +1600,7 @@ DEFINE_Int64(s3_file_system_local_upload_buffer_size, "5242880");
 DEFINE_Bool(enable_jvm_monitor, "false");
 
 DEFINE_Int32(load_data_dirs_threads, "-1");
+DEFINE_Int32(load_tablet_meta_threads_per_data_dir, "8");
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DEFINE_mBool(skip_loading_stale_rowset_meta, "false");
@@ -1455,6 +1609,7 @@ DEFINE_Bool(enable_file_logger, "true");
 
 // The minimum row group size when exporting Parquet files. default 128MB
 DEFINE_Int64(min_row_group_size, "134217728");
+DEFINE_Int32(parquet_writer_encode_thread_num, "8");
 
 DEFINE_mInt64(compaction_memory_bytes_limit, "1073741824");
 
@@ -1487,6 +1642,7 @@ DEFINE_mBool(enable_pipeline_task_leakage_detect, "false");
 DEFINE_mInt32(check_score_rounds_num, "1000");
 
 DEFINE_Int32(query_cache_size, "512");
+DEFINE_mBool(enable_query_cache_incremental_merge, "true");
 
 // Enable validation to check the correctness of table size.
 DEFINE_Bool(enable_table_size_correctness_check, "false");
@@ -1494,6 +1650,9 @@ DEFINE_Bool(force_regenerate_rowsetid_on_start_error, "false");
 DEFINE_mBool(enable_sleep_between_delete_cumu_compaction, "false");
 
 DEFINE_mInt32(compaction_num_per_round, "4");
+DEFINE_mBool(enable_read_aware_compaction_score, "false");
+DEFINE_mDouble(compaction_score_read_weight, "1.0");
+DEFINE_mDouble(compaction_score_delete_bitmap_weight, "0.5");
 
 DEFINE_mInt32(check_tablet_delete_bitmap_interval_seconds, "300");
 DEFINE_mInt32(check_tablet_delete_bitmap_score_top_n, "10");
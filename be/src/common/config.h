@@ -172,6 +172,11 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
 
+// The mmapped allocations (see mmap_threshold) of at least this size are aligned to 2 MB and
+// advised to be backed by transparent huge pages, which needs THP in the `madvise` or `always`
+// mode. It reduces the TLB misses of the big hash tables and columns. -1 means disabled.
+DECLARE_Int64(mmap_huge_page_threshold); // bytes
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DECLARE_mInt32(hash_table_double_grow_degree);
@@ -272,6 +277,11 @@ DECLARE_Int32(alter_tablet_worker_count);
 DECLARE_Int32(alter_index_worker_count);
 // the count of thread to clone
 DECLARE_Int32(clone_worker_count);
+// the count of thread to clone only the tablets the FE marks as high priority, e.g. the
+// under-replicated ones; the clone threads above also take them first
+DECLARE_Int32(clone_high_prior_worker_count);
+// the max number of files downloaded into each disk at the same time by all the clone tasks
+DECLARE_mInt32(clone_download_concurrency_per_disk);
 // the count of thread to clone
 DECLARE_Int32(storage_medium_migrate_count);
 // the count of thread to check consistency
@@ -367,16 +377,44 @@ DECLARE_mInt32(doris_scanner_row_num);
 DECLARE_mInt32(doris_scanner_row_bytes);
 // single read execute fragment max run time millseconds
 DECLARE_mInt32(doris_scanner_max_run_time_ms);
+// Whether to adjust the number of running scanners of a scan operator at runtime, based on
+// whether the consumer waits for blocks, the scanners wait for IO and the queued blocks use up
+// the memory of the scan queue.
+DECLARE_mBool(enable_adaptive_scan_concurrency);
+// min interval in millseconds between two adjustments of the scan concurrency
+DECLARE_mInt32(adaptive_scan_concurrency_interval_ms);
 // (Advanced) Maximum size of per-query receive-side buffer
 DECLARE_mInt32(exchg_node_buffer_size_bytes);
 DECLARE_mInt32(exchg_buffer_queue_capacity_factor);
+// If the query does not set `exchange_multi_blocks_byte_size`, the blocks queued for one
+// destination instance are packed into one rpc up to this size. 0 means one block per rpc.
+DECLARE_mInt32(exchange_sink_coalesce_blocks_byte_size);
+// Choose the compression codec of exchange blocks (none, LZ4 or ZSTD) by the sampled compression
+// ratio, the compression cost and the measured network throughput.
+DECLARE_mBool(enable_exchange_adaptive_compression);
+// Send the column values of large exchange blocks as brpc attachment instead of in the protobuf
+// request, which saves one copy of the data on the sender. Only enable it when all the BEs
+// support it, an older receiver would see an empty block.
+DECLARE_mBool(enable_transmit_block_by_attachment);
+DECLARE_mInt64(transmit_block_attachment_min_bytes);
+// Resample the compression codecs every this many blocks.
+DECLARE_mInt32(exchange_adaptive_compression_sample_interval);
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DECLARE_mInt64(memory_limitation_per_thread_for_schema_change_bytes);
+// The max number of historical rowsets of a tablet converted concurrently by a schema change.
+// Each of them may use memory_limitation_per_thread_for_schema_change_bytes.
+DECLARE_mInt32(schema_change_rowset_parallelism);
 
 // all cache prune interval, used by GC and periodic thread.
 DECLARE_mInt32(cache_prune_interval_sec);
 DECLARE_mInt32(cache_periodic_prune_stale_sweep_sec);
+// Move the capacity between the caches in bytes by their hits per MB, every
+// `cache_capacity_arbitration_interval_sec`. A cache gets at most `max_weighted` times of its
+// configured capacity, and at least 1 / `max_weighted` of it.
+DECLARE_mBool(enable_cache_capacity_arbitration);
+DECLARE_mInt32(cache_capacity_arbitration_interval_sec);
+DECLARE_mDouble(cache_capacity_arbitration_max_weighted);
 // the clean interval of tablet lookup cache
 DECLARE_mInt32(tablet_lookup_cache_stale_sweep_time_sec);
 DECLARE_mInt32(point_query_row_cache_stale_sweep_time_sec);
@@ -424,6 +462,12 @@ DECLARE_Int32(storage_page_cache_shard_size);
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DECLARE_Int32(index_page_cache_percentage);
+// Percentage of the data page cache holding compressed data pages, which are decompressed on hit.
+// 0 means all data pages are cached decompressed.
+DECLARE_Int32(compressed_data_page_cache_percentage);
+// A page in the compressed data page cache is also cached decompressed once it is hit so many
+// times. 0 caches every compressed page in both tiers.
+DECLARE_mInt32(compressed_data_page_cache_promote_hits);
 // whether to disable page cache feature in storage
 // TODO delete it. Divided into Data page, Index page, pk index page
 DECLARE_Bool(disable_storage_page_cache);
@@ -443,6 +487,32 @@ DECLARE_mInt32(data_page_cache_stale_sweep_time_sec);
 DECLARE_mInt32(index_page_cache_stale_sweep_time_sec);
 // great impact on the performance of MOW, so it can be longer.
 DECLARE_mInt32(pk_index_page_cache_stale_sweep_time_sec);
+// Whether the cache admits new entries by TinyLFU once it is full, a new entry only replaces
+// the least recently used one if it is looked up more often. It replaces the LRU-K admission of
+// the data page cache.
+DECLARE_Bool(data_page_cache_enable_tiny_lfu);
+DECLARE_Bool(index_page_cache_enable_tiny_lfu);
+DECLARE_Bool(pk_index_page_cache_enable_tiny_lfu);
+DECLARE_Bool(segment_cache_enable_tiny_lfu);
+DECLARE_Bool(inverted_index_query_cache_enable_tiny_lfu);
+DECLARE_Bool(file_meta_range_cache_enable_tiny_lfu);
+
+// Whether to write the float and double columns with ALP encoding instead of bitshuffle.
+// The segments written with it can't be read by a BE without ALP encoding.
+DECLARE_mBool(enable_alp_encoding);
+// Whether the data pages of a string column written after its dictionary gets full are
+// encoded with FSST instead of plain. The segments written with it can't be read by a BE
+// without FSST encoding.
+DECLARE_mBool(enable_fsst_encoding);
+// Whether to write the int and bigint columns with delta encoding, and the datetimev2
+// columns with delta of delta encoding, instead of bitshuffle. It suits the nearly monotonic
+// columns, e.g. auto increment ids and timestamps. The segments written with it can't be read
+// by a BE without delta encoding.
+DECLARE_mBool(enable_delta_encoding);
+// Whether to write the page level bloom filters for all the string columns, not only for the
+// bloom_filter_columns of the table. The equal and in predicates on unsorted strings, e.g. trace
+// ids, skip the pages their zone maps can't rule out.
+DECLARE_mBool(enable_string_page_bloom_filter);
 
 DECLARE_Bool(enable_low_cardinality_optimize);
 DECLARE_Bool(enable_low_cardinality_cache_code);
@@ -462,6 +532,30 @@ DECLARE_mInt32(vertical_compaction_num_columns_per_group);
 DECLARE_Int32(vertical_compaction_max_row_source_memory_mb);
 // In vertical compaction, max dest segment file size
 DECLARE_mInt64(vertical_compaction_max_segment_size);
+// In vertical compaction, merged blocks of a value column group waiting to be written by another
+// thread, 0 writes them on the merging thread
+DECLARE_mInt32(vertical_compaction_pipeline_blocks);
+// threads writing the merged value column groups of vertical compactions
+DECLARE_Int32(vertical_compaction_write_thread_num);
+
+// whether to limit the disk IO of compaction and schema change by the foreground read latency
+DECLARE_mBool(enable_background_disk_io_throttle);
+// background IO bytes per second of a data dir when its foreground reads are fast or idle
+DECLARE_mInt64(background_disk_io_max_bytes_per_second);
+// background IO bytes per second of a data dir never go below this
+DECLARE_mInt64(background_disk_io_min_bytes_per_second);
+// the background rate of a data dir is halved while its foreground reads are slower than this
+DECLARE_mInt64(background_disk_io_target_read_latency_us);
+// a data dir without foreground reads for this long is idle
+DECLARE_mInt32(background_disk_io_idle_ms);
+// how compaction, schema change and spill write local files, so they don't evict the hot
+// segments of queries from the OS page cache: "cached", "drop_behind" (evict the written pages)
+// or "direct" (O_DIRECT, drop_behind if the file system doesn't support it)
+DECLARE_mString(background_write_page_cache_mode);
+// the drop_behind writes start the writeback of each window and evict the previous one
+DECLARE_mInt64(drop_behind_write_window_bytes);
+// the aligned buffer of a direct IO writer, a multiple of 4096
+DECLARE_mInt32(direct_io_write_buffer_size);
 
 // If enabled, segments will be flushed column by column
 DECLARE_mBool(enable_vertical_segment_writer);
@@ -591,6 +685,9 @@ DECLARE_String(ssl_private_key_path);
 DECLARE_Bool(enable_all_http_auth);
 // Number of webserver workers
 DECLARE_Int32(webserver_num_workers);
+// Every webserver worker listens on its own socket with SO_REUSEPORT, so the kernel spreads the
+// connections over the workers instead of waking up all of them for every new connection.
+DECLARE_Bool(enable_webserver_reuse_port);
 
 DECLARE_Bool(enable_single_replica_load);
 // Number of download workers for single replica load
@@ -669,10 +766,23 @@ DECLARE_Int32(min_buffer_size); // 1024, The minimum read buffer size (in bytes)
 DECLARE_String(pprof_profile_dir);
 // for jeprofile in jemalloc
 DECLARE_mString(jeprofile_dir);
+// Dump a jemalloc heap profile every this many seconds, keeping the recent
+// continuous_heap_profile_ring_size profiles in jeprofile_dir for `/jeheap/profiles`. It samples
+// an allocation every 2^continuous_heap_profile_lg_sample bytes on average, the threads running
+// a task are named by the query id and the workload group in the profiles. It needs `prof:true`
+// in JEMALLOC_CONF. 0 means disabled.
+DECLARE_Int32(continuous_heap_profile_interval_s);
+DECLARE_mInt32(continuous_heap_profile_ring_size);
+DECLARE_Int32(continuous_heap_profile_lg_sample);
 // Purge all unused dirty pages for all arenas.
 DECLARE_mBool(enable_je_purge_dirty_pages);
 // Jemalloc `arenas.dirty_decay_ms`, equal to `dirty_decay_ms` in JEMALLOC_CONF in be.conf.
 DECLARE_mInt32(je_dirty_decay_ms);
+// The max number of the dedicated jemalloc arenas of the queries and loads whose memory limit is
+// at least je_query_arena_min_mem_limit, 0 means all of them use the shared arenas. The threads
+// of such a query allocate from its arena, whose unused pages are purged at once when it ends.
+DECLARE_Int32(je_query_arena_num);
+DECLARE_mInt64(je_query_arena_min_mem_limit);
 
 // to forward compatibility, will be removed later
 DECLARE_mBool(enable_token_check);
@@ -699,6 +809,15 @@ DECLARE_mInt32(memory_gc_sleep_time_ms);
 DECLARE_mInt64(write_buffer_size);
 // max buffer size used in memtable for the aggregated table, default 400MB
 DECLARE_mInt64(write_buffer_size_for_agg);
+// threads sorting the parts of the new rows of a large memtable at the same time,
+// 1 sorts them on the flushing thread
+DECLARE_Int32(memtable_sort_thread_num);
+// rows of each part sorted at the same time, fewer new rows are sorted as one
+DECLARE_mInt64(memtable_sort_part_rows);
+// threads encoding the columns of a segment at the same time, 1 encodes them on the flushing thread
+DECLARE_Int32(segment_column_encode_thread_num);
+// fewer columns of a segment than this are encoded on the flushing thread
+DECLARE_mInt32(segment_parallel_encode_min_columns);
 // max parallel flush task per memtable writer
 DECLARE_mInt32(memtable_flush_running_count_limit);
 
@@ -726,6 +845,9 @@ DECLARE_mInt32(result_buffer_cancelled_interval_time);
 
 // arrow flight result sink buffer rows size, default 4096 * 8
 DECLARE_mInt32(arrow_flight_result_sink_buffer_size_rows);
+// The max bytes of the arrow flight result blocks queued for one result sink instance, the
+// instance is blocked until the client fetches them. <= 0 means only limited by rows.
+DECLARE_mInt64(arrow_flight_result_sink_buffer_size_bytes);
 // The timeout for ADBC Client to wait for data using arrow flight reader.
 // If the query is very complex and no result is generated after this time, consider increasing this timeout.
 DECLARE_mInt32(arrow_flight_reader_brpc_controller_timeout_ms);
@@ -750,6 +872,9 @@ DECLARE_Bool(enable_metric_calculator);
 
 // max consumer num in one data consumer group, for routine load
 DECLARE_mInt32(max_consumer_num_per_group);
+// max number of kafka messages a routine load consumer hands over to its group at a time,
+// the messages already fetched by the consumer are taken without waiting up to this number
+DECLARE_mInt32(routine_load_consume_batch_size);
 
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
@@ -769,6 +894,10 @@ DECLARE_String(es_scroll_keepalive);
 // HTTP connection timeout for es
 DECLARE_mInt32(es_http_timeout_ms);
 
+// number of sliced scrolls every es shard is split into, each slice is read by its own scanner.
+// 1 reads a shard with one scroll.
+DECLARE_mInt32(es_scroll_slices_per_shard);
+
 // the max client cache number per each host
 // There are variety of client cache in BE, but currently we use the
 // same cache size configuration.
@@ -798,6 +927,10 @@ DECLARE_Int32(high_priority_flush_thread_num_per_store);
 // number of threads = min(flush_thread_num_per_store * num_store,
 //                         max_flush_thread_num_per_cpu * num_cpu)
 DECLARE_Int32(max_flush_thread_num_per_cpu);
+// The last memtable of a writer, which its close waits for, is flushed by the high priority
+// flush threads if it is not larger than this, so that a small load doesn't wait behind the
+// flushes of big loads to commit. <= 0 means disable.
+DECLARE_mInt64(blocking_flush_memtable_max_bytes);
 
 // config for tablet meta checkpoint
 DECLARE_mInt32(tablet_meta_checkpoint_min_new_rowsets_num);
@@ -890,6 +1023,10 @@ DECLARE_mInt32(remote_storage_read_buffer_mb);
 // Decreasing this value will increase the frequency of consume/release.
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DECLARE_mInt32(mem_tracker_consume_min_size_bytes);
+// If true, the thread also accumulates the memory of the consumer trackers, e.g. of
+// SCOPED_CONSUME_MEM_TRACKER, up to mem_tracker_consume_min_size_bytes before consuming them,
+// instead of updating each of them on every allocation. The limiter trackers are not affected.
+DECLARE_mBool(enable_consumer_mem_tracker_batch_consume);
 
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
@@ -937,10 +1074,19 @@ DECLARE_mInt32(segment_compression_threshold_kb);
 // Time to clean up useless JDBC connection pool cache
 DECLARE_mInt32(jdbc_connection_pool_cache_clear_time_sec);
 
+// The jdbc sink collects the rows of small blocks up to this number and writes them as one
+// batched insert, so every round trip to the database carries enough rows.
+DECLARE_mInt32(jdbc_sink_batch_rows);
+// Number of connections a jdbc sink without transaction writes with, every connection has one
+// batch in flight. A sink with transaction always writes with one connection.
+DECLARE_mInt32(jdbc_sink_parallel_connections);
+
 // Global bitmap cache capacity for aggregation cache, size in bytes
 DECLARE_Int64(delete_bitmap_agg_cache_capacity);
 DECLARE_String(delete_bitmap_dynamic_agg_cache_limit);
 DECLARE_mInt32(delete_bitmap_agg_cache_stale_sweep_time_sec);
+// compact the delete bitmaps of published versions and of the agg cache into run containers
+DECLARE_mBool(enable_seal_delete_bitmap);
 
 // A common object cache depends on an Sharded LRU Cache.
 DECLARE_mInt32(common_obj_lru_cache_stale_sweep_time_sec);
@@ -1003,6 +1149,11 @@ DECLARE_mInt32(parquet_header_max_size_mb);
 DECLARE_mInt32(parquet_rowgroup_max_buffer_mb);
 // Max buffer size for parquet chunk column
 DECLARE_mInt32(parquet_column_max_buffer_mb);
+// The column chunks of the predicates of this many next row groups are prefetched while a
+// parquet reader decodes a row group, 0 disables it.
+DECLARE_mInt32(parquet_prefetch_row_group_num);
+// Max bytes of the prefetched column chunks of a parquet reader
+DECLARE_mInt64(parquet_prefetch_row_group_max_bytes);
 // Merge small IO, the max amplified read ratio
 DECLARE_mDouble(max_amplified_read_ratio);
 // Equivalent min size of each IO that can reach the maximum storage speed limit
@@ -1016,6 +1167,10 @@ DECLARE_mInt64(big_column_size_buffer);
 DECLARE_mInt64(small_column_size_buffer);
 
 DECLARE_mInt32(runtime_filter_sampling_frequency);
+// The estimated downstream cost saved by every row a runtime filter removes. A runtime filter
+// whose execute time exceeds the saved cost of the rows it removed is ignored for the rest of
+// the sampling period. 0 means filters are only judged by the rows they remove.
+DECLARE_mInt32(runtime_filter_filtered_row_benefit_ns);
 DECLARE_mInt32(execution_max_rpc_timeout_sec);
 DECLARE_mBool(execution_ignore_eovercrowded);
 
@@ -1034,6 +1189,9 @@ DECLARE_Bool(enable_time_lut);
 DECLARE_mBool(enable_simdjson_reader);
 
 DECLARE_mBool(enable_query_like_bloom_filter);
+// Whether to push the regexp predicates with a constant pattern down to the storage, which
+// prune the pages by the ngram bloom filter of the literals every match contains.
+DECLARE_mBool(enable_query_regexp_bloom_filter);
 // number of s3 scanner thread pool size
 DECLARE_Int32(doris_remote_scanner_thread_pool_thread_num);
 // number of s3 scanner thread pool queue size
@@ -1089,6 +1247,10 @@ DECLARE_Int64(segcompaction_task_max_bytes);
 // Global segcompaction thread pool size.
 DECLARE_mInt32(segcompaction_num_threads);
 
+// Do not submit segcompaction tasks while the memory of loads is beyond the soft limit, so that
+// memtable flushes go first.
+DECLARE_mBool(segcompaction_defer_on_load_memory_pressure);
+
 // enable java udf and jdbc scannode
 DECLARE_Bool(enable_java_support);
 
@@ -1101,6 +1263,29 @@ DECLARE_Bool(enable_fuzzy_mode);
 DECLARE_Bool(enable_debug_points);
 
 DECLARE_Int32(pipeline_executor_size);
+// Group pipeline task queues by NUMA node, prefer stealing tasks inside the local node and bind
+// pipeline executor threads to the cpus of their node.
+DECLARE_Bool(enable_pipeline_numa_aware_scheduling);
+// Charge the runtime of pipeline tasks to the workload group weighted by its cpu share, and
+// throttle the executors of a group whose virtual runtime is ahead of the slowest busy group
+// by more than `pipeline_fair_schedule_max_lag_ms`.
+DECLARE_mBool(enable_pipeline_workload_group_fair_schedule);
+DECLARE_mInt32(pipeline_fair_schedule_max_lag_ms);
+// A woken up pipeline task goes back to the queue of the core it ran on last time, unless that
+// queue holds more than this number of tasks. <= 0 means always go back to the last core.
+DECLARE_mInt32(pipeline_task_affinity_queue_threshold);
+// When the runnable queue of a pipeline scheduler is deeper than its executors, limit the number
+// of concurrently executing tasks of each fragment in proportion to its share of the queue, the
+// other tasks are parked. A fragment always keeps at least
+// `adaptive_pipeline_min_running_tasks` executing tasks.
+DECLARE_mBool(enable_adaptive_pipeline_parallelism);
+DECLARE_mInt32(adaptive_pipeline_min_running_tasks);
+// Number of events kept per core by the sampled pipeline tracing.
+DECLARE_Int32(pipeline_trace_ring_buffer_size);
+// Read the per-thread hardware counters (cycles, instructions, LLC/branch/dTLB misses) around
+// the get block and sink calls of pipeline tasks and add them to the task profiles. Takes effect
+// for the tasks created after it's enabled.
+DECLARE_mBool(enable_pipeline_task_perf_counters);
 
 // block file cache
 DECLARE_Bool(enable_file_cache);
@@ -1120,6 +1305,9 @@ DECLARE_Bool(enable_file_cache);
 DECLARE_String(file_cache_path);
 DECLARE_Int64(file_cache_each_block_size);
 DECLARE_Bool(clear_file_cache);
+// Split every file cache path into this many caches with their own lock and queues, the keys are
+// spread over them by hash. Changing it drops the cached data of the paths.
+DECLARE_Int32(file_cache_shards_per_path);
 DECLARE_Bool(enable_file_cache_query_limit);
 DECLARE_Int32(file_cache_enter_disk_resource_limit_mode_percent);
 DECLARE_Int32(file_cache_exit_disk_resource_limit_mode_percent);
@@ -1130,10 +1318,28 @@ DECLARE_mInt32(file_cache_evict_in_advance_interval_ms);
 DECLARE_mInt64(file_cache_evict_in_advance_batch_bytes);
 DECLARE_mInt64(file_cache_evict_in_advance_recycle_keys_num_threshold);
 DECLARE_mBool(enable_read_cache_file_directly);
+// Write the blocks downloaded on a file cache miss in a thread pool, the reader returns once
+// the remote read is done instead of waiting for the cache file writes.
+DECLARE_mBool(enable_file_cache_write_behind);
+// The max bytes waiting for the write-behind, a miss beyond it writes the cache by itself.
+DECLARE_mInt64(file_cache_write_behind_max_bytes);
+DECLARE_Int32(file_cache_write_behind_thread_num);
+// Read the downloaded blocks of a file cache read at once by io_uring, see IOUringReader.
+DECLARE_mBool(enable_file_cache_io_uring);
+// The number of entries of the io_uring of each thread.
+DECLARE_Int32(io_uring_queue_depth);
 DECLARE_Bool(file_cache_enable_evict_from_other_queue_by_size);
 // If true, evict the ttl cache using LRU when full.
 // Otherwise, only expiration can evict ttl and new data won't add to cache when full.
 DECLARE_Bool(enable_ttl_cache_evict_using_lru);
+// The file cache queues (normal, index, disposable, ttl, separated by comma) evicted by a
+// segmented FIFO instead of LRU, see BlockFileCache::LRUQueue::enable_segmented_fifo.
+DECLARE_String(file_cache_segmented_fifo_queues);
+// The share of the probation segment in a segmented FIFO queue, in percent.
+DECLARE_Int32(file_cache_segmented_fifo_probation_percent);
+// Save the blocks meta of the file cache on a clean close and restore it on start instead of
+// scanning the cache directory. The directory is still scanned after a crash.
+DECLARE_Bool(enable_file_cache_meta_checkpoint);
 DECLARE_mBool(enbale_dump_error_file);
 // limit the max size of error log on disk
 DECLARE_mInt64(file_cache_error_log_limit_bytes);
@@ -1146,6 +1352,9 @@ DECLARE_mInt64(cache_lock_held_long_tail_threshold_us);
 // If your file cache is ample enough to accommodate all the data in your database,
 // enable this option; otherwise, it is recommended to leave it disabled.
 DECLARE_mBool(enable_file_cache_keep_base_compaction_output);
+// The output of a base or full compaction is kept in the file cache as well when at least this
+// share of its inputs is cached, a value above 1 never keeps it
+DECLARE_mDouble(file_cache_keep_compaction_output_min_cached_ratio);
 DECLARE_mInt64(file_cache_remove_block_qps_limit);
 DECLARE_mInt64(file_cache_background_gc_interval_ms);
 DECLARE_mBool(enable_reader_dryrun_when_download_file_cache);
@@ -1170,10 +1379,16 @@ DECLARE_Int32(inverted_index_query_cache_shards);
 
 // inverted index match bitmap cache size
 DECLARE_String(inverted_index_query_cache_limit);
+// Whether a MATCH_ANY or MATCH_ALL of some terms is answered from the cached bitmaps of each
+// term, so the queries sharing terms in different combinations reuse them.
+DECLARE_mBool(enable_inverted_index_term_cache);
 
 // inverted index
 DECLARE_mDouble(inverted_index_ram_buffer_size);
 DECLARE_mInt32(inverted_index_max_buffered_docs);
+// when positive, an inverted index writer whose buffered postings take more memory than this
+// flushes them as an intermediate run, the runs are merged when the segment is finished
+DECLARE_mInt64(inverted_index_writer_flush_threshold_bytes);
 // dict path for chinese analyzer
 DECLARE_String(inverted_index_dict_path);
 DECLARE_Int32(inverted_index_read_buffer_size);
@@ -1181,18 +1396,30 @@ DECLARE_Int32(inverted_index_read_buffer_size);
 DECLARE_Int32(max_depth_in_bkd_tree);
 // index compaction
 DECLARE_mBool(inverted_index_compaction_enable);
+// threads merging the indexes of different columns of a compaction at the same time
+DECLARE_Int32(inverted_index_compaction_thread_num);
+// memory limit of merging the index of one column, a column exceeding it is not merged but
+// rebuilt from the data in later compactions, -1 means no limit
+DECLARE_mInt64(inverted_index_compaction_task_mem_limit_bytes);
 // Only for debug, do not use in production
 DECLARE_mBool(debug_inverted_index_compaction);
 // index by RAM directory
 DECLARE_mBool(inverted_index_ram_dir_enable);
 // wheather index by RAM directory when base compaction
 DECLARE_mBool(inverted_index_ram_dir_enable_when_base_compaction);
+// in_list runtime filters with no more values than this are applied by the inverted index,
+// producing the row bitmap before any column page is read. -1 disables it.
+DECLARE_mInt32(inverted_index_max_runtime_filter_in_list_size);
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DECLARE_Int32(num_broadcast_buffer);
 
 // max depth of expression tree allowed.
 DECLARE_Int32(max_depth_of_expr_tree);
 
+// Whether to compute the subexpressions appearing more than once in the projections of an
+// operator only once per block.
+DECLARE_Bool(enable_projection_common_subexpr_reuse);
+
 // Report a tablet as bad when io errors occurs more than this value.
 DECLARE_mInt64(max_tablet_io_errors);
 
@@ -1202,6 +1429,17 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 
 // it must be larger than or equal to 5MB
 DECLARE_mInt64(s3_write_buffer_size);
+// The part size of a multipart upload doubles every this many parts, up to
+// s3_write_max_part_size, so a large file stays under the 10000 parts limit of S3.
+// 0 keeps the part size at s3_write_buffer_size.
+DECLARE_mInt32(s3_write_part_size_grow_interval);
+DECLARE_mInt64(s3_write_max_part_size);
+// The memory reserved for the first part of a file, it grows on demand up to the part size,
+// so the small files don't take a whole part each. 0 reserves the whole part.
+DECLARE_mInt64(s3_write_buffer_initial_size);
+// The max parts in uploading to one endpoint at the same time of all the s3 file writers,
+// the writers wait for a slot before submitting a part. 0 means no limit.
+DECLARE_mInt32(s3_upload_max_concurrency_per_host);
 // Log interval when doing s3 upload task
 DECLARE_mInt32(s3_file_writer_log_interval_second);
 // the max number of cached file handle for block segemnt
@@ -1218,6 +1456,9 @@ DECLARE_Int32(segment_cache_capacity);
 DECLARE_Int32(segment_cache_fd_percentage);
 DECLARE_Int32(segment_cache_memory_percentage);
 DECLARE_mInt32(estimated_mem_per_column_reader);
+// The max number of column readers kept by a segment, the least recently used ones beyond it
+// are dropped when they are not in use. 0 means no limit.
+DECLARE_mInt32(max_column_readers_per_segment);
 
 // enable binlog
 DECLARE_Bool(enable_feature_binlog);
@@ -1231,6 +1472,15 @@ DECLARE_Int32(max_hdfs_file_handle_cache_time_sec);
 
 // max number of meta info of external files, such as parquet footer
 DECLARE_Int64(max_external_file_meta_cache_num);
+// max bytes of the metadata ranges of external files, such as the page indexes of parquet
+// row groups, 0 to disable
+DECLARE_Int64(max_external_file_meta_range_cache_bytes);
+// max bytes of the positions deleted from external data files, decoded from the position
+// delete files of iceberg and the deletion vectors of paimon, 0 to disable
+DECLARE_Int64(max_external_deletion_vector_cache_bytes);
+// max bytes of the hyperscan databases compiled from the patterns of LIKE and REGEXP, shared by
+// the queries, 0 to disable
+DECLARE_Int64(max_hyperscan_database_cache_bytes);
 // Apply delete pred in cumu compaction
 DECLARE_mBool(enable_delete_when_cumu_compaction);
 
@@ -1268,6 +1518,11 @@ DECLARE_mInt64(auto_inc_low_water_level_mark_size_ratio);
 DECLARE_mInt64(auto_inc_fetch_thread_num);
 // Max connection cache num for point lookup queries
 DECLARE_mInt64(lookup_connection_cache_capacity);
+// Share the descriptor tables built from thrift between the queries with the same descriptor
+// table, to reduce the prepare time of repeated short queries.
+DECLARE_Bool(enable_descriptor_tbl_cache);
+DECLARE_Int64(descriptor_tbl_cache_capacity);
+DECLARE_mInt32(descriptor_tbl_cache_stale_sweep_time_sec);
 
 // level of compression when using LZ4_HC, whose defalut value is LZ4HC_CLEVEL_DEFAULT
 DECLARE_mInt64(LZ4_HC_compression_level);
@@ -1340,6 +1595,12 @@ DECLARE_mInt32(group_commit_queue_mem_limit);
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DECLARE_mString(group_commit_wal_max_disk_limit);
 DECLARE_Bool(group_commit_wait_replay_wal_finish);
+// Compress the blocks written to the wal of group commit with LZ4.
+DECLARE_mBool(enable_group_commit_wal_compression);
+// Tune the commit interval of the group commit of each table from its load rate and commit
+// latency, between group_commit_min_interval_ms and the group_commit_interval_ms of the table.
+DECLARE_mBool(enable_adaptive_group_commit_interval);
+DECLARE_mInt32(group_commit_min_interval_ms);
 
 // The configuration item is used to lower the priority of the scanner thread,
 // typically employed to ensure CPU scheduling for write operations.
@@ -1366,6 +1627,19 @@ DECLARE_Bool(enable_flush_file_cache_async);
 // Remove predicate that is always true for a segment.
 DECLARE_Bool(ignore_always_true_predicate_for_segment);
 
+// Reorder the short circuit predicates of a segment by their measured cost per row and
+// selectivity, so that the cheap and selective ones run first.
+DECLARE_mBool(enable_adaptive_predicate_order);
+
+// Whether a segment iterator prefetches the data pages of its row ranges into the file cache,
+// up to segment_prefetch_window_bytes ahead of the rows read.
+DECLARE_mBool(enable_segment_data_page_prefetch);
+DECLARE_mInt64(segment_prefetch_window_bytes);
+// Pages closer than this are prefetched by one read, which is at most
+// segment_prefetch_max_read_bytes.
+DECLARE_mInt64(segment_prefetch_merge_distance_bytes);
+DECLARE_mInt64(segment_prefetch_max_read_bytes);
+
 // Ingest binlog work pool size
 DECLARE_Int32(ingest_binlog_work_pool_size);
 
@@ -1387,6 +1661,63 @@ DECLARE_Bool(enable_snapshot_action);
 DECLARE_mInt32(variant_max_merged_tablet_schema_size);
 
 DECLARE_mInt64(local_exchange_buffer_mem_limit);
+// A hash shuffle local exchange whose downstream does not need key affinity (e.g. partial
+// aggregation) spreads the rows of an instance over all instances once the instance has received
+// more than `local_exchange_skew_factor` times the average rows. 0 means disabled.
+DECLARE_mDouble(local_exchange_skew_factor);
+// Skew detection starts after the local exchange has received this many rows.
+DECLARE_mInt64(local_exchange_skew_min_rows);
+
+// The hash join probe prefetches the build rows of the following probe rows once the hash table
+// (buckets, chains and keys) takes at least this many bytes, i.e. it is larger than the cache.
+// 0 means disabled.
+DECLARE_mInt64(hash_join_probe_prefetch_min_table_bytes);
+
+// Index the build side of a nested loop join on a `probe_slot <op> build_slot` join conjunct, so
+// a probe row is only joined with the build rows which may satisfy it.
+DECLARE_mBool(enable_nested_loop_join_range_index);
+
+// The shared hash table of a broadcast join with at least this many build rows is built by up to
+// `hash_join_parallel_build_max_threads` threads, each inserting a range of buckets.
+// 0 means disabled.
+DECLARE_mInt64(hash_join_parallel_build_min_rows);
+DECLARE_mInt32(hash_join_parallel_build_max_threads);
+
+// A spilled hash join partition whose build data is larger than this is split into sub
+// partitions again, up to `spill_hash_join_max_repartition_depth` times. When it still can not
+// be split, the build data is joined chunk by chunk if the join type allows it. 0 means disabled.
+DECLARE_mInt64(spill_hash_join_partition_max_bytes);
+DECLARE_mInt32(spill_hash_join_max_repartition_depth);
+
+// When a spilled aggregation revokes memory, the partitions that were never spilled and hold the
+// fewest groups stay in memory, up to this percent of the groups. They are output straight from
+// memory at the end. 0 means every partition is spilled, which is the default.
+DECLARE_mInt32(spill_aggregation_retain_partition_percent);
+
+// The streaming pre-aggregation counts the group keys of every window of this many input rows
+// with a HLL sketch, and picks for the next window whether to aggregate all rows, to pass them
+// through, or to only aggregate the keys of a small hot key cache. 0 means disabled.
+DECLARE_mInt64(streaming_agg_sample_window_rows);
+// The max number of keys kept by the hot key cache of the streaming pre-aggregation.
+DECLARE_mInt32(streaming_agg_hot_key_cache_size);
+
+// When the hash table of a final merge aggregation has this many groups, the groups are split
+// into `agg_parallel_merge_buckets` buckets by their key hash, which are merged by several
+// threads and output one after another. 0 means disabled.
+DECLARE_mInt64(agg_parallel_merge_min_groups);
+DECLARE_mInt32(agg_parallel_merge_buckets);
+
+// Read the dictionary encoded string columns of a query with their dictionary codes, so an
+// aggregation on such a single string key finds the states by code instead of hashing the
+// strings. Needs enable_low_cardinality_optimize.
+DECLARE_mBool(enable_dict_code_aggregation);
+// Sort blocks by several columns with fixed width memcmp-able prefixes of their sort keys, and
+// compare the columns one by one only for the rows with equal prefixes.
+DECLARE_mBool(enable_sort_normalized_key);
+// A full sort without limit of at least this many rows sorts its last buffered rows and merges its
+// sorted runs with up to `full_sort_parallel_max_threads` threads. 0 means disabled.
+DECLARE_mInt64(full_sort_parallel_min_rows);
+DECLARE_mInt32(full_sort_parallel_max_threads);
 
 DECLARE_mInt64(enable_debug_log_timeout_secs);
 
@@ -1417,7 +1748,20 @@ DECLARE_mInt32(spill_gc_interval_ms);
 DECLARE_mInt32(spill_gc_work_time_ms);
 DECLARE_Int32(spill_io_thread_pool_thread_num);
 DECLARE_Int32(spill_io_thread_pool_queue_size);
+// Read spill files one block ahead and write them one block behind on the spill io thread
+// pool, overlapping the file io with (de)serializing blocks.
+DECLARE_mBool(enable_spill_async_io);
+// In cloud mode, spill to the remote storage vault when the local spill disks are full.
+DECLARE_mBool(enable_spill_to_remote_storage);
+// The max bytes of spill data a backend keeps on remote storage.
+DECLARE_mInt64(spill_remote_storage_limit_bytes);
 DECLARE_Int64(spill_in_paused_queue_timeout_ms);
+// When the process memory, including the reserved memory, reaches this percentage of the soft
+// limit, the spillable sinks holding at least spill_ahead_min_revocable_bytes revocable memory
+// spill after reserving, before the reservations of the process would fail at the soft limit.
+// 0 means disabled.
+DECLARE_mInt32(spill_ahead_process_memory_percent);
+DECLARE_mInt64(spill_ahead_min_revocable_bytes);
 
 DECLARE_mBool(check_segment_when_build_rowset_meta);
 
@@ -1442,6 +1786,16 @@ DECLARE_mInt32(max_s3_client_retry);
 // and the max retry time is max_s3_client_retry
 DECLARE_mInt32(s3_read_base_wait_time_ms);
 DECLARE_mInt32(s3_read_max_wait_time_ms);
+// A read of S3FileReader larger than this is split into sub-range GETs of this size, which are
+// issued in parallel by the S3FileReadThreadPool. 0 to disable.
+DECLARE_mInt64(s3_read_split_size);
+// A GET slower than this percentile (e.g. 0.95) of the recent GETs gets a duplicate request, and
+// the first one succeeded is used. 0 to disable. Only the reads no larger than
+// `s3_hedged_read_max_bytes` are hedged, and never sooner than `s3_hedged_read_min_delay_ms`.
+DECLARE_mDouble(s3_hedged_read_percentile);
+DECLARE_mInt64(s3_hedged_read_max_bytes);
+DECLARE_mInt32(s3_hedged_read_min_delay_ms);
+DECLARE_Int32(s3_file_read_thread_num);
 DECLARE_mBool(enable_s3_object_check_after_upload);
 
 // write as inverted index tmp directory
@@ -1462,6 +1816,9 @@ DECLARE_mInt64(table_sink_partition_write_min_data_processed_rebalance_threshold
 DECLARE_mInt64(table_sink_partition_write_min_partition_data_processed_rebalance_threshold);
 // Maximum processed partition nums of per writer when partition writing
 DECLARE_mInt32(table_sink_partition_write_max_partition_nums_per_writer);
+// Maximum bytes buffered by the open partition writers of per writer when partition writing, the
+// least recently written partition files are closed when it's exceeded, 0 means no limit
+DECLARE_mInt64(table_sink_partition_write_max_buffered_bytes_per_writer);
 
 /** Hive sink configurations **/
 DECLARE_mInt64(hive_sink_max_file_size);
@@ -1495,6 +1852,9 @@ DECLARE_mDouble(max_hdfs_wirter_jni_heap_usage_ratio);
 DECLARE_mInt64(hdfs_jni_write_sleep_milliseconds);
 // The max retry times when hdfs write failed
 DECLARE_mInt64(hdfs_jni_write_max_retry_time);
+// Whether to read the batches of the java jni scanners through the arrow c data interface if
+// the scanners export them in this way
+DECLARE_mBool(enable_jni_arrow_c_data_interface);
 
 // The min thread num for NonBlockCloseThreadPool
 DECLARE_Int64(min_nonblock_close_thread_num);
@@ -1514,6 +1874,9 @@ DECLARE_Bool(enable_jvm_monitor);
 
 // Num threads to load data dirs, default value -1 indicates the same number of threads as the number of data dirs
 DECLARE_Int32(load_data_dirs_threads);
+// Num threads to parse the rowset metas and build the tablets of each data dir when loading it,
+// a value no more than 1 loads them serially
+DECLARE_Int32(load_tablet_meta_threads_per_data_dir);
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DECLARE_mBool(skip_loading_stale_rowset_meta);
@@ -1525,6 +1888,9 @@ DECLARE_Bool(enable_file_logger);
 
 // The minimum row group size when exporting Parquet files.
 DECLARE_Int64(min_row_group_size);
+// The threads shared by the parquet writers to encode and compress the columns of a row group in
+// parallel, 0 encodes them on the thread of the writer.
+DECLARE_Int32(parquet_writer_encode_thread_num);
 
 DECLARE_mInt64(compaction_memory_bytes_limit);
 
@@ -1555,6 +1921,9 @@ DECLARE_mInt32(check_score_rounds_num);
 
 // MB
 DECLARE_Int32(query_cache_size);
+// Reuse the query cache entry of an older version of a duplicate key tablet: only the rowsets
+// loaded after it are scanned, and their partial result is merged with the cached one.
+DECLARE_mBool(enable_query_cache_incremental_merge);
 DECLARE_Bool(force_regenerate_rowsetid_on_start_error);
 
 // Enable validation to check the correctness of table size.
@@ -1563,6 +1932,14 @@ DECLARE_Bool(enable_table_size_correctness_check);
 DECLARE_mBool(enable_sleep_between_delete_cumu_compaction);
 
 DECLARE_mInt32(compaction_num_per_round);
+// rank the tablets to compact by their compaction score weighed by how often they are scanned
+// and by their delete bitmap entries per version, the reported max compaction scores are weighed
+// as well
+DECLARE_mBool(enable_read_aware_compaction_score);
+// weight of log2(1 + scans per second of a tablet)
+DECLARE_mDouble(compaction_score_read_weight);
+// weight of log2(1 + delete bitmap entries per version of a merge-on-write tablet)
+DECLARE_mDouble(compaction_score_delete_bitmap_weight);
 
 DECLARE_mInt32(check_tablet_delete_bitmap_interval_seconds);
 DECLARE_mInt32(check_tablet_delete_bitmap_score_top_n);
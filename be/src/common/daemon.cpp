@@ -49,6 +49,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
 #include "runtime/memory/global_memory_arbitrator.h"
+#include "runtime/memory/heap_profiler.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/memory/memory_reclamation.h"
 #include "runtime/process_profile.h"
@@ -567,6 +568,25 @@ void Daemon::cache_prune_stale_thread() {
     }
 }
 
+void Daemon::cache_arbitrate_capacity_thread() {
+    int32_t interval = std::max(config::cache_capacity_arbitration_interval_sec, 1);
+    while (!_stop_background_threads_latch.wait_for(std::chrono::seconds(interval))) {
+        interval = std::max(config::cache_capacity_arbitration_interval_sec, 1);
+        if (!config::enable_cache_capacity_arbitration || config::disable_memory_gc) {
+            continue;
+        }
+        std::unique_ptr<RuntimeProfile> profile = std::make_unique<RuntimeProfile>("");
+        auto freed_mem = CacheManager::instance()->for_each_cache_arbitrate_capacity(profile.get());
+        if (freed_mem != 0) {
+            std::stringstream ss;
+            profile->pretty_print(&ss);
+            LOG(INFO) << fmt::format(
+                    "[MemoryGC] arbitrate cache capacity end, free memory {}, details: {}",
+                    PrettyPrinter::print(freed_mem, TUnit::BYTES), ss.str());
+        }
+    }
+}
+
 void Daemon::be_proc_monitor_thread() {
     while (!_stop_background_threads_latch.wait_for(
             std::chrono::milliseconds(config::be_proc_monitor_interval_ms))) {
@@ -581,6 +601,16 @@ void Daemon::calculate_workload_group_metrics_thread() {
     }
 }
 
+void Daemon::continuous_heap_profile_thread() {
+    if (!HeapProfiler::instance()->start_continuous_heap_profile()) {
+        return;
+    }
+    while (!_stop_background_threads_latch.wait_for(
+            std::chrono::seconds(config::continuous_heap_profile_interval_s))) {
+        HeapProfiler::instance()->dump_continuous_heap_profile();
+    }
+}
+
 void Daemon::start() {
     Status st;
     st = Thread::create(
@@ -614,6 +644,10 @@ void Daemon::start() {
             "Daemon", "cache_prune_stale_thread", [this]() { this->cache_prune_stale_thread(); },
             &_threads.emplace_back());
     CHECK(st.ok()) << st;
+    st = Thread::create(
+            "Daemon", "cache_arbitrate_capacity_thread",
+            [this]() { this->cache_arbitrate_capacity_thread(); }, &_threads.emplace_back());
+    CHECK(st.ok()) << st;
     st = Thread::create(
             "Daemon", "query_runtime_statistics_thread",
             [this]() { this->report_runtime_query_statistics_thread(); }, &_threads.emplace_back());
@@ -631,6 +665,13 @@ void Daemon::start() {
             [this]() { this->calculate_workload_group_metrics_thread(); },
             &_threads.emplace_back());
     CHECK(st.ok()) << st;
+
+    if (config::continuous_heap_profile_interval_s > 0) {
+        st = Thread::create(
+                "Daemon", "continuous_heap_profile_thread",
+                [this]() { this->continuous_heap_profile_thread(); }, &_threads.emplace_back());
+        CHECK(st.ok()) << st;
+    }
 }
 
 void Daemon::stop() {
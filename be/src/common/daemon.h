@@ -43,9 +43,11 @@ private:
     void je_reset_dirty_decay_thread() const;
     void cache_adjust_capacity_thread();
     void cache_prune_stale_thread();
+    void cache_arbitrate_capacity_thread();
     void report_runtime_query_statistics_thread();
     void be_proc_monitor_thread();
     void calculate_workload_group_metrics_thread();
+    void continuous_heap_profile_thread();
 
     CountDownLatch _stop_background_threads_latch;
     std::vector<scoped_refptr<Thread>> _threads;
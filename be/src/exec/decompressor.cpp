@@ -19,6 +19,7 @@
 
 #include <strings.h>
 
+#include <algorithm>
 #include <memory>
 #include <ostream>
 
@@ -349,6 +350,89 @@ std::string ZstdDecompressor::debug_info() {
     return ss.str();
 }
 
+// Seek_Table_Footer: Number_Of_Frames (4 bytes), Seek_Table_Descriptor (1 byte),
+// Seekable_Magic_Number (4 bytes), all little endian.
+Status ZstdSeekTable::parse_footer(const uint8_t* footer, size_t file_size, size_t* table_size) {
+    *table_size = 0;
+    if (file_size < SKIPPABLE_HEADER_SIZE + FOOTER_SIZE ||
+        LittleEndian::Load32(footer + 5) != SEEKABLE_MAGIC) {
+        return Status::OK();
+    }
+    uint32_t num_frames = LittleEndian::Load32(footer);
+    uint8_t descriptor = footer[4];
+    if ((descriptor & 0x7C) != 0) {
+        return Status::InternalError("Invalid zstd seek table descriptor {}", descriptor);
+    }
+    // the entries have a checksum if the bit 7 is set
+    size_t entry_size = (descriptor & 0x80) ? 12 : 8;
+    size_t size = SKIPPABLE_HEADER_SIZE + num_frames * entry_size + FOOTER_SIZE;
+    if (size > file_size) {
+        return Status::InternalError("Invalid zstd seek table of {} frames in a file of {} bytes",
+                                     num_frames, file_size);
+    }
+    *table_size = size;
+    return Status::OK();
+}
+
+Status ZstdSeekTable::parse(const uint8_t* table, size_t table_size) {
+    if (table_size < SKIPPABLE_HEADER_SIZE + FOOTER_SIZE ||
+        LittleEndian::Load32(table) != SKIPPABLE_MAGIC ||
+        LittleEndian::Load32(table + 4) != table_size - SKIPPABLE_HEADER_SIZE) {
+        return Status::InternalError("Invalid zstd seek table frame");
+    }
+    const uint8_t* footer = table + table_size - FOOTER_SIZE;
+    uint32_t num_frames = LittleEndian::Load32(footer);
+    size_t entry_size = (footer[4] & 0x80) ? 12 : 8;
+    if (SKIPPABLE_HEADER_SIZE + num_frames * entry_size + FOOTER_SIZE != table_size) {
+        return Status::InternalError("Invalid zstd seek table of {} frames", num_frames);
+    }
+    _frames.clear();
+    _frames.reserve(num_frames);
+    int64_t compressed_offset = 0;
+    _decompressed_size = 0;
+    const uint8_t* entry = table + SKIPPABLE_HEADER_SIZE;
+    for (uint32_t i = 0; i < num_frames; ++i, entry += entry_size) {
+        Frame frame {compressed_offset, _decompressed_size, LittleEndian::Load32(entry),
+                     LittleEndian::Load32(entry + 4)};
+        compressed_offset += frame.compressed_size;
+        _decompressed_size += frame.decompressed_size;
+        _frames.push_back(frame);
+    }
+    return Status::OK();
+}
+
+ZstdSeekTable::SplitRange ZstdSeekTable::split_range(int64_t start, int64_t size) const {
+    auto compare = [](const Frame& frame, int64_t offset) {
+        return frame.compressed_offset < offset;
+    };
+    size_t first = std::lower_bound(_frames.begin(), _frames.end(), start, compare) -
+                   _frames.begin();
+    size_t last = std::lower_bound(_frames.begin() + first, _frames.end(), start + size, compare) -
+                  _frames.begin();
+    SplitRange range;
+    if (first == last) {
+        // no frame starts in this split
+        return range;
+    }
+    int64_t end = last < _frames.size() ? _frames[last].decompressed_offset : _decompressed_size;
+    // Decompress the previous non-empty frame to know whether its last byte ends a line, the
+    // reading starts at this byte and the first line is skipped.
+    size_t prev = first;
+    while (prev > 0 && _frames[prev - 1].decompressed_size == 0) {
+        --prev;
+    }
+    if (prev == 0) {
+        range.read_offset = _frames[first].compressed_offset;
+        range.length = end - _frames[first].decompressed_offset;
+        return range;
+    }
+    range.read_offset = _frames[prev - 1].compressed_offset;
+    range.skip_bytes = _frames[prev - 1].decompressed_size - 1;
+    range.length = end - _frames[first].decompressed_offset + 1;
+    range.skip_first_line = true;
+    return range;
+}
+
 // Lz4Frame
 // Lz4 version: 1.7.5
 // define LZ4F_VERSION = 100
@@ -29,6 +29,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "common/status.h"
 #include "gen_cpp/PlanNodes_types.h"
@@ -156,6 +157,52 @@ private:
     ZSTD_DStream* _zstd_strm {nullptr};
 };
 
+// The seek table of the zstd seekable format, a skippable frame at the end of the file listing
+// the sizes of the frames. The frames are compressed independently, so a file is split at the
+// frame boundaries and every split is decompressed on its own.
+class ZstdSeekTable {
+public:
+    struct Frame {
+        int64_t compressed_offset;
+        int64_t decompressed_offset;
+        uint32_t compressed_size;
+        uint32_t decompressed_size;
+    };
+
+    static constexpr size_t FOOTER_SIZE = 9;
+
+    // Parse the footer, the last FOOTER_SIZE bytes of the file. *table_size is set to the size of
+    // the whole seek table frame, or 0 if the file is not in the seekable format.
+    static Status parse_footer(const uint8_t* footer, size_t file_size, size_t* table_size);
+
+    // Parse the seek table frame, the last table_size bytes of the file.
+    Status parse(const uint8_t* table, size_t table_size);
+
+    const std::vector<Frame>& frames() const { return _frames; }
+
+    int64_t decompressed_size() const { return _decompressed_size; }
+
+    // The decompressed data to read the lines beginning in the frames starting in the compressed
+    // range [start, start + size). The decompression starts at read_offset, skip_bytes bytes are
+    // skipped and then length bytes are read, where the first line belongs to the previous split
+    // if skip_first_line is set, like the uncompressed split which starts one byte before.
+    struct SplitRange {
+        int64_t read_offset = 0;
+        size_t skip_bytes = 0;
+        size_t length = 0;
+        bool skip_first_line = false;
+    };
+    SplitRange split_range(int64_t start, int64_t size) const;
+
+private:
+    static constexpr uint32_t SKIPPABLE_MAGIC = 0x184D2A5E;
+    static constexpr uint32_t SEEKABLE_MAGIC = 0x8F92EAB1;
+    static constexpr size_t SKIPPABLE_HEADER_SIZE = 8;
+
+    std::vector<Frame> _frames;
+    int64_t _decompressed_size = 0;
+};
+
 class Lz4FrameDecompressor : public Decompressor {
 public:
     ~Lz4FrameDecompressor() override;
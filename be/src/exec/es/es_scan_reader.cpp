@@ -22,6 +22,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -177,7 +178,7 @@ Status ESScanReader::get_next(bool* scan_eos, std::unique_ptr<ScrollParser>& scr
     }
 
     if (_is_first) {
-        response = _cached_response;
+        response = std::move(_cached_response);
         _is_first = false;
     } else {
         if (_exactly_once) {
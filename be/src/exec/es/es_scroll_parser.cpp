@@ -598,9 +598,10 @@ Status ScrollParser::parse(const std::string& scroll_result, bool exactly_once)
     if (!inner_hits_node.IsArray()) {
         return Status::OK();
     }
-    _inner_hits_node.CopyFrom(inner_hits_node, _document_node.GetAllocator());
+    // refer to the hits in the document instead of copying every hit of the batch
+    _inner_hits_node = &inner_hits_node;
     // how many documents contains in this batch
-    _size = _inner_hits_node.Size();
+    _size = _inner_hits_node->Size();
     return Status::OK();
 }
 
@@ -623,7 +624,7 @@ Status ScrollParser::fill_columns(const TupleDescriptor* tuple_desc,
         return Status::OK();
     }
 
-    const rapidjson::Value& obj = _inner_hits_node[_line_index++];
+    const rapidjson::Value& obj = (*_inner_hits_node)[_line_index++];
     bool pure_doc_value = false;
     if (obj.HasMember("fields")) {
         pure_doc_value = true;
@@ -659,7 +660,9 @@ Status ScrollParser::fill_columns(const TupleDescriptor* tuple_desc,
         const char* col_name = pure_doc_value ? docvalue_context.at(slot_desc->col_name()).c_str()
                                               : slot_desc->col_name().c_str();
 
-        if (line == nullptr || line->FindMember(col_name) == line->MemberEnd()) {
+        auto col_it = line == nullptr ? rapidjson::Value::ConstMemberIterator()
+                                      : line->FindMember(col_name);
+        if (line == nullptr || col_it == line->MemberEnd()) {
             if (slot_desc->is_nullable()) {
                 auto* nullable_column = reinterpret_cast<vectorized::ColumnNullable*>(col_ptr);
                 nullable_column->insert_data(nullptr, 0);
@@ -670,7 +673,7 @@ Status ScrollParser::fill_columns(const TupleDescriptor* tuple_desc,
             }
         }
 
-        const rapidjson::Value& col = (*line)[col_name];
+        const rapidjson::Value& col = col_it->value;
 
         auto type = slot_desc->type()->get_primitive_type();
 
@@ -138,6 +138,15 @@ std::string ESScrollQueryBuilder::build(const std::map<std::string, std::string>
         sort_node.PushBack(field, allocator);
         es_query_dsl.AddMember("sort", sort_node, allocator);
     }
+    // a sliced scroll reads a part of the documents of the shard, the slices are read in parallel
+    if (properties.find(ESScanReader::KEY_SLICE_MAX) != properties.end()) {
+        rapidjson::Value slice_node(rapidjson::kObjectType);
+        slice_node.AddMember("id", atoi(properties.at(ESScanReader::KEY_SLICE_ID).c_str()),
+                             allocator);
+        slice_node.AddMember("max", atoi(properties.at(ESScanReader::KEY_SLICE_MAX).c_str()),
+                             allocator);
+        es_query_dsl.AddMember("slice", slice_node, allocator);
+    }
     // number of documents returned
     es_query_dsl.AddMember("size", size, allocator);
     rapidjson::StringBuffer buffer;
@@ -612,6 +612,12 @@ Status RowIdStorageReader::read_batch_doris_format_row(
         }
     }
 
+    if (!request_block_desc.fetch_row_store()) {
+        return read_batch_doris_format_columns(request_block_desc, id_file_map, slots, query_id,
+                                               full_read_schema, result_block, stats,
+                                               acquire_tablet_ms, acquire_rowsets_ms,
+                                               acquire_segments_ms);
+    }
     for (size_t j = 0; j < request_block_desc.row_id_size(); ++j) {
         auto file_id = request_block_desc.file_id(j);
         auto file_mapping = id_file_map->get_file_mapping(file_id);
@@ -629,6 +635,61 @@ Status RowIdStorageReader::read_batch_doris_format_row(
     return Status::OK();
 }
 
+Status RowIdStorageReader::read_batch_doris_format_columns(
+        const PRequestBlockDesc& request_block_desc, const std::shared_ptr<IdFileMap>& id_file_map,
+        std::vector<SlotDescriptor>& slots, const TUniqueId& query_id,
+        const TabletSchema& full_read_schema, vectorized::Block& result_block,
+        OlapReaderStatistics& stats, int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms,
+        int64_t* acquire_segments_ms) {
+    // file id -> (row id, position in the request)
+    std::map<uint32_t, std::vector<std::pair<uint32_t, size_t>>> segment_rows;
+    for (size_t j = 0; j < request_block_desc.row_id_size(); ++j) {
+        segment_rows[request_block_desc.file_id(j)].emplace_back(
+                static_cast<uint32_t>(request_block_desc.row_id(j)), j);
+    }
+
+    // the rows are read segment by segment, perm maps a requested row to the row read
+    auto read_columns = result_block.clone_empty_columns();
+    vectorized::IColumn::Permutation perm(request_block_desc.row_id_size());
+    std::vector<uint32_t> row_ids;
+    for (auto& [file_id, rows] : segment_rows) {
+        auto file_mapping = id_file_map->get_file_mapping(file_id);
+        if (!file_mapping) {
+            return Status::InternalError(
+                    "Backend:{} file_mapping not found, query_id: {}, file_id: {}",
+                    BackendOptions::get_localhost(), print_id(query_id), file_id);
+        }
+        BaseTabletSPtr tablet;
+        BetaRowsetSharedPtr rowset;
+        SegmentCacheHandle segment_cache;
+        segment_v2::SegmentSharedPtr segment;
+        RETURN_IF_ERROR(get_doris_format_segment(id_file_map, file_mapping, rows[0].first, &tablet,
+                                                 &rowset, &segment_cache, &segment,
+                                                 acquire_tablet_ms, acquire_rowsets_ms,
+                                                 acquire_segments_ms));
+        std::sort(rows.begin(), rows.end());
+        size_t offset = read_columns.empty() ? 0 : read_columns[0]->size();
+        row_ids.clear();
+        for (const auto& [row_id, pos] : rows) {
+            // a row asked for twice is read once
+            if (row_ids.empty() || row_ids.back() != row_id) {
+                row_ids.push_back(row_id);
+            }
+            perm[pos] = offset + row_ids.size() - 1;
+        }
+        for (int x = 0; x < slots.size(); ++x) {
+            std::unique_ptr<segment_v2::ColumnIterator> iterator;
+            RETURN_IF_ERROR(segment->seek_and_read_by_rowids(full_read_schema, &slots[x],
+                                                             row_ids.data(), row_ids.size(),
+                                                             read_columns[x], stats, iterator));
+        }
+    }
+    for (int x = 0; x < slots.size(); ++x) {
+        result_block.replace_by_position(x, read_columns[x]->permute(perm, 0));
+    }
+    return Status::OK();
+}
+
 Status RowIdStorageReader::read_batch_external_row(const PRequestBlockDesc& request_block_desc,
                                                    std::shared_ptr<IdFileMap> id_file_map,
                                                    std::vector<SlotDescriptor>& slots,
@@ -727,15 +788,12 @@ Status RowIdStorageReader::read_batch_external_row(const PRequestBlockDesc& requ
     return Status::OK();
 }
 
-Status RowIdStorageReader::read_doris_format_row(
+Status RowIdStorageReader::get_doris_format_segment(
         const std::shared_ptr<IdFileMap>& id_file_map,
         const std::shared_ptr<FileMapping>& file_mapping, int64_t row_id,
-        std::vector<SlotDescriptor>& slots, const TabletSchema& full_read_schema,
-        RowStoreReadStruct& row_store_read_struct, OlapReaderStatistics& stats,
-        int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms, int64_t* acquire_segments_ms,
-        int64_t* lookup_row_data_ms,
-        std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey>& iterator_map,
-        vectorized::Block& result_block) {
+        BaseTabletSPtr* tablet_ptr, BetaRowsetSharedPtr* rowset_ptr,
+        SegmentCacheHandle* segment_cache, segment_v2::SegmentSharedPtr* segment,
+        int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms, int64_t* acquire_segments_ms) {
     auto [tablet_id, rowset_id, segment_id] = file_mapping->get_doris_format_info();
     BaseTabletSPtr tablet = scope_timer_run(
             [&]() {
@@ -763,26 +821,47 @@ Status RowIdStorageReader::read_doris_format_row(
                 row_id);
     }
 
-    SegmentCacheHandle segment_cache;
     RETURN_IF_ERROR(scope_timer_run(
             [&]() {
-                return SegmentLoader::instance()->load_segments(rowset, &segment_cache, true);
+                return SegmentLoader::instance()->load_segments(rowset, segment_cache, true);
             },
             acquire_segments_ms));
 
-    auto it =
-            std::find_if(segment_cache.get_segments().cbegin(), segment_cache.get_segments().cend(),
-                         [segment_id](const segment_v2::SegmentSharedPtr& seg) {
-                             return seg->id() == segment_id;
-                         });
-    if (it == segment_cache.get_segments().end()) {
+    auto it = std::find_if(segment_cache->get_segments().cbegin(),
+                           segment_cache->get_segments().cend(),
+                           [segment_id](const segment_v2::SegmentSharedPtr& seg) {
+                               return seg->id() == segment_id;
+                           });
+    if (it == segment_cache->get_segments().end()) {
         return Status::InternalError(
                 "Backend:{} segment not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
                 "row_id: {}",
                 BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
                 row_id);
     }
-    segment_v2::SegmentSharedPtr segment = *it;
+    *tablet_ptr = std::move(tablet);
+    *rowset_ptr = std::move(rowset);
+    *segment = *it;
+    return Status::OK();
+}
+
+Status RowIdStorageReader::read_doris_format_row(
+        const std::shared_ptr<IdFileMap>& id_file_map,
+        const std::shared_ptr<FileMapping>& file_mapping, int64_t row_id,
+        std::vector<SlotDescriptor>& slots, const TabletSchema& full_read_schema,
+        RowStoreReadStruct& row_store_read_struct, OlapReaderStatistics& stats,
+        int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms, int64_t* acquire_segments_ms,
+        int64_t* lookup_row_data_ms,
+        std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey>& iterator_map,
+        vectorized::Block& result_block) {
+    auto [tablet_id, rowset_id, segment_id] = file_mapping->get_doris_format_info();
+    BaseTabletSPtr tablet;
+    BetaRowsetSharedPtr rowset;
+    SegmentCacheHandle segment_cache;
+    segment_v2::SegmentSharedPtr segment;
+    RETURN_IF_ERROR(get_doris_format_segment(id_file_map, file_mapping, row_id, &tablet, &rowset,
+                                             &segment_cache, &segment, acquire_tablet_ms,
+                                             acquire_rowsets_ms, acquire_segments_ms));
 
     // if row_store_read_struct not empty, means the line we should read from row_store
     if (!row_store_read_struct.default_values.empty()) {
@@ -28,6 +28,7 @@
 #include "common/status.h"
 #include "exec/tablet_info.h" // DorisNodesInfo
 #include "olap/id_manager.h"
+#include "olap/segment_loader.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type.h"
 
@@ -90,6 +91,16 @@ public:
     static Status read_by_rowids(const PMultiGetRequestV2& request, PMultiGetResponseV2* response);
 
 private:
+    // Find the tablet, the rowset and the segment of a doris format file.
+    static Status get_doris_format_segment(const std::shared_ptr<IdFileMap>& id_file_map,
+                                           const std::shared_ptr<FileMapping>& file_mapping,
+                                           int64_t row_id, BaseTabletSPtr* tablet,
+                                           BetaRowsetSharedPtr* rowset,
+                                           SegmentCacheHandle* segment_cache,
+                                           segment_v2::SegmentSharedPtr* segment,
+                                           int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms,
+                                           int64_t* acquire_segments_ms);
+
     static Status read_doris_format_row(
             const std::shared_ptr<IdFileMap>& id_file_map,
             const std::shared_ptr<FileMapping>& file_mapping, int64_t row_id,
@@ -107,6 +118,15 @@ private:
             int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms, int64_t* acquire_segments_ms,
             int64_t* lookup_row_data_ms);
 
+    // Read the rows of each segment column by column in the order of their row ids, instead of
+    // seeking to each row on its own, then put the rows back in the requested order.
+    static Status read_batch_doris_format_columns(
+            const PRequestBlockDesc& request_block_desc,
+            const std::shared_ptr<IdFileMap>& id_file_map, std::vector<SlotDescriptor>& slots,
+            const TUniqueId& query_id, const TabletSchema& full_read_schema,
+            vectorized::Block& result_block, OlapReaderStatistics& stats,
+            int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms, int64_t* acquire_segments_ms);
+
     static Status read_batch_external_row(const PRequestBlockDesc& request_block_desc,
                                           std::shared_ptr<IdFileMap> id_file_map,
                                           std::vector<SlotDescriptor>& slots,
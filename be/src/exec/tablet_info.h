@@ -220,12 +220,22 @@ public:
         return (partition != nullptr);
     }
 
+    // find_partition() of the rows [0, rows) of block. For range partitions a row is checked
+    // against the partition of the previous row first, the rows of a partition usually come
+    // together, e.g. a time series loaded into partitions by day.
+    void find_partitions(vectorized::Block* block, int rows,
+                         std::vector<VOlapTablePartition*>& partitions) const;
+
     ALWAYS_INLINE void find_tablets(
             vectorized::Block* block, const std::vector<uint32_t>& indexes,
             const std::vector<VOlapTablePartition*>& partitions,
             std::vector<uint32_t>& tablet_indexes /*result*/,
             /*TODO: check if flat hash map will be better*/
             std::map<VOlapTablePartition*, int64_t>* partition_tablets_buffer = nullptr) const {
+        if (!_distributed_slot_locs.empty() && partition_tablets_buffer == nullptr) {
+            _find_hash_tablets(block, indexes, partitions, tablet_indexes);
+            return;
+        }
         std::function<uint32_t(vectorized::Block*, uint32_t, const VOlapTablePartition&)>
                 compute_function;
         if (!_distributed_slot_locs.empty()) {
@@ -310,6 +320,11 @@ private:
     // check if this partition contain this key
     bool _part_contains(VOlapTablePartition* part, BlockRowWithIndicator key) const;
 
+    // find_tablets() of hash distribution, the rows are hashed column by column.
+    void _find_hash_tablets(vectorized::Block* block, const std::vector<uint32_t>& indexes,
+                            const std::vector<VOlapTablePartition*>& partitions,
+                            std::vector<uint32_t>& tablet_indexes) const;
+
     // this partition only valid in this schema
     std::shared_ptr<OlapTableSchemaParam> _schema;
     TOlapTablePartitionParam _t_param;
@@ -123,6 +123,10 @@ public:
         return false;
     }
 
+    // Finds 'n' hashes and sets results[i] to whether hashes[i] is found. On CPUs with
+    // AVX-512 the bucket indexes and masks of 16 hashes are computed at once.
+    void find_batch(const uint32_t* hashes, size_t n, uint8_t* results) const noexcept;
+
 #ifdef __ARM_NEON
     void make_find_mask(uint32_t key, uint32x4_t* masks) const noexcept {
         uint32x4_t hash_data_1 = vdupq_n_u32(key);
@@ -254,6 +258,11 @@ private:
     static void or_equal_array_avx2(size_t n, const uint8_t* __restrict__ in,
                                     uint8_t* __restrict__ out) __attribute__((target("avx2")));
 
+    // Finds the hashes of find_batch() 16 at a time with AVX-512 and returns how many of the
+    // 'n' hashes are done, the rest are left to the caller.
+    size_t find_batch_avx512(const uint32_t* hashes, size_t n, uint8_t* results) const noexcept
+            __attribute__((target("avx512f")));
+
 #endif
     // Size of the internal directory structure in bytes.
     size_t directory_size() const { return 1ULL << log_space_bytes(); }
@@ -60,5 +60,58 @@ void BlockBloomFilter::or_equal_array_avx2(size_t n, const uint8_t* __restrict__
                          _mm256_or_pd(_mm256_loadu_pd(double_out), _mm256_loadu_pd(double_in)));
     }
 }
+
+size_t BlockBloomFilter::find_batch_avx512(const uint32_t* hashes, size_t n,
+                                           uint8_t* results) const noexcept {
+    // rehash32to32() is the high half of hash * m + a, AVX-512F only multiplies 32-bit lanes
+    // into 64 bits, so the low word of m goes through _mm512_mul_epu32 and the high word is
+    // added to the high half of the product by a 32-bit multiplication.
+    static constexpr uint32_t m_lo = 0xc6d14889U;
+    static constexpr uint32_t m_hi = 0x7850f11eU;
+    static constexpr uint64_t a = 0x6773610597ca4c63ULL;
+    const __m512i mul_lo = _mm512_set1_epi64(m_lo);
+    const __m512i mul_hi = _mm512_set1_epi32(m_hi);
+    const __m512i add = _mm512_set1_epi64(a);
+    const __m512i directory_mask = _mm512_set1_epi32(_directory_mask);
+    // Two buckets share a register, lanes 0-7 test the first hash and lanes 8-15 the second.
+    const __m512i rehash =
+            _mm512_broadcast_i64x4(_mm256_load_si256(reinterpret_cast<const __m256i*>(kRehash)));
+    const __m512i pair_lanes = _mm512_setr_epi32(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+    const __m512i two = _mm512_set1_epi32(2);
+    const __m512i ones = _mm512_set1_epi32(1);
+    const __m256i* const directory = reinterpret_cast<const __m256i*>(_directory);
+
+    alignas(64) uint32_t bucket_idx[16];
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m512i hash = _mm512_loadu_si512(hashes + i);
+        const __m512i even = _mm512_add_epi64(_mm512_mul_epu32(hash, mul_lo), add);
+        const __m512i odd =
+                _mm512_add_epi64(_mm512_mul_epu32(_mm512_srli_epi64(hash, 32), mul_lo), add);
+        __m512i idx = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd);
+        idx = _mm512_add_epi32(idx, _mm512_mullo_epi32(hash, mul_hi));
+        _mm512_store_si512(bucket_idx, _mm512_and_si512(idx, directory_mask));
+
+        uint32_t found = 0;
+        __m512i pair = pair_lanes;
+        for (uint32_t k = 0; k < 16; k += 2, pair = _mm512_add_epi32(pair, two)) {
+            const __m512i pair_hash = _mm512_permutexvar_epi32(pair, hash);
+            const __m512i mask = _mm512_sllv_epi32(
+                    ones, _mm512_srli_epi32(_mm512_mullo_epi32(rehash, pair_hash), shift_num));
+            const __m512i buckets =
+                    _mm512_inserti64x4(_mm512_castsi256_si512(directory[bucket_idx[k]]),
+                                       directory[bucket_idx[k + 1]], 1);
+            // The lanes where 'mask' has a one that the bucket misses.
+            const __m512i missing = _mm512_andnot_si512(buckets, mask);
+            const auto missing_lanes = _mm512_test_epi32_mask(missing, missing);
+            found |= uint32_t((missing_lanes & 0xFF) == 0) << k;
+            found |= uint32_t((missing_lanes >> 8) == 0) << (k + 1);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(results + i),
+                         _mm512_cvtepi32_epi8(_mm512_maskz_set1_epi32(__mmask16(found), 1)));
+    }
+    _mm256_zeroupper();
+    return i;
+}
 } // namespace doris
 #endif
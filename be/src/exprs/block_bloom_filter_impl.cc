@@ -32,6 +32,7 @@
 
 #include "common/status.h"
 #include "exprs/block_bloom_filter.hpp"
+#include "util/cpu_info.h"
 // IWYU pragma: no_include <emmintrin.h>
 #include "util/sse_util.hpp"
 
@@ -192,6 +193,23 @@ void BlockBloomFilter::insert(const uint32_t hash) noexcept {
 #endif
 }
 
+void BlockBloomFilter::find_batch(const uint32_t* hashes, size_t n,
+                                  uint8_t* results) const noexcept {
+    if (_always_false) {
+        memset(results, 0, n);
+        return;
+    }
+    size_t i = 0;
+#ifdef __AVX2__
+    if (CpuInfo::is_supported(CpuInfo::AVX512F)) {
+        i = find_batch_avx512(hashes, n, results);
+    }
+#endif
+    for (; i < n; ++i) {
+        results[i] = find(hashes[i]);
+    }
+}
+
 void BlockBloomFilter::or_equal_array_internal(size_t n, const uint8_t* __restrict__ in,
                                                uint8_t* __restrict__ out) {
 #ifdef __AVX2__
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "common/status.h"
 #include "exprs/block_bloom_filter.hpp"
 #include "exprs/filter_base.h"
@@ -56,6 +58,10 @@ public:
 
     bool test(uint32_t data) const { return _bloom_filter->find(data); }
 
+    void test_batch(const uint32_t* data, size_t n, uint8_t* results) const {
+        _bloom_filter->find_batch(data, n, results);
+    }
+
     template <typename fixed_len_to_uint32_method, typename T>
     bool test_element(T element) const {
         if constexpr (std::is_same_v<T, StringRef>) {
@@ -138,19 +144,24 @@ struct CommonFindOp {
             data = (T*)column->get_raw_data().data;
         }
 
+        // Hash a chunk of keys first, so that the bloom filter tests them together.
+        static constexpr size_t HASH_BATCH_SIZE = 256;
+        uint32_t hashes[HASH_BATCH_SIZE];
         const auto size = column->size();
+        for (size_t begin = 0; begin < size; begin += HASH_BATCH_SIZE) {
+            const size_t n = std::min(HASH_BATCH_SIZE, size - begin);
+            for (size_t i = 0; i < n; i++) {
+                hashes[i] = fixed_len_to_uint32_method()(data[begin + i]);
+            }
+            bloom_filter.test_batch(hashes, n, results + begin);
+        }
         if (nullmap) {
+            const bool contain_null = bloom_filter.contain_null();
             for (size_t i = 0; i < size; i++) {
-                if (!nullmap[i]) {
-                    results[i] = bloom_filter.test_element<fixed_len_to_uint32_method>(data[i]);
-                } else {
-                    results[i] = bloom_filter.contain_null();
+                if (nullmap[i]) {
+                    results[i] = contain_null;
                 }
             }
-        } else {
-            for (size_t i = 0; i < size; i++) {
-                results[i] = bloom_filter.test_element<fixed_len_to_uint32_method>(data[i]);
-            }
         }
     }
 };
@@ -23,6 +23,8 @@
 #include <s2/s2builderutil_s2polygon_layer.h>
 #include <s2/s2builderutil_s2polyline_vector_layer.h>
 #include <s2/s2cap.h>
+#include <s2/s2cell_id.h>
+#include <s2/s2cell_union.h>
 #include <s2/s2earth.h>
 #include <s2/s2edge_crosser.h>
 #include <s2/s2latlng.h>
@@ -30,6 +32,7 @@
 #include <s2/s2point.h>
 #include <s2/s2polygon.h>
 #include <s2/s2polyline.h>
+#include <s2/s2region_coverer.h>
 #include <s2/util/coding/coder.h>
 #include <s2/util/units/length-units.h>
 #include <string.h>
@@ -1583,6 +1586,48 @@ double GeoCircle::getArea() const {
     return _cap->GetArea();
 }
 
+GeoCellCovering::GeoCellCovering() = default;
+
+GeoCellCovering::~GeoCellCovering() = default;
+
+std::unique_ptr<GeoCellCovering> GeoCellCovering::create(const GeoShape& shape) {
+    S2RegionCoverer::Options options;
+    options.set_max_cells(MAX_CELLS);
+    S2RegionCoverer coverer(options);
+    auto covering = std::make_unique<GeoCellCovering>();
+    switch (shape.type()) {
+    case GEO_SHAPE_POLYGON: {
+        const auto& polygon = assert_cast<const GeoPolygon&>(shape);
+        covering->_cells =
+                std::make_unique<S2CellUnion>(coverer.GetCovering(*polygon.polygon()));
+        break;
+    }
+    case GEO_SHAPE_MULTI_POLYGON: {
+        const auto& multi_polygon = assert_cast<const GeoMultiPolygon&>(shape);
+        std::vector<S2CellId> cell_ids;
+        for (const auto& polygon : multi_polygon.polygons()) {
+            auto cells = coverer.GetCovering(*polygon->polygon());
+            cell_ids.insert(cell_ids.end(), cells.cell_ids().begin(), cells.cell_ids().end());
+        }
+        // the constructor normalizes the cells of all polygons
+        covering->_cells = std::make_unique<S2CellUnion>(std::move(cell_ids));
+        break;
+    }
+    case GEO_SHAPE_CIRCLE: {
+        const auto& circle = assert_cast<const GeoCircle&>(shape);
+        covering->_cells = std::make_unique<S2CellUnion>(coverer.GetCovering(*circle.circle()));
+        break;
+    }
+    default:
+        return nullptr;
+    }
+    return covering;
+}
+
+bool GeoCellCovering::may_contain(const GeoPoint& point) const {
+    return _cells->Contains(S2CellId(*point.point()));
+}
+
 bool GeoShape::ComputeArea(GeoShape* rhs, double* area, std::string square_unit) {
     double steradians;
     switch (rhs->type()) {
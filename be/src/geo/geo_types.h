@@ -30,6 +30,7 @@
 class S2Polyline;
 class S2Polygon;
 class S2Cap;
+class S2CellUnion;
 class S2Loop;
 template <typename T>
 class Vector3;
@@ -246,4 +247,25 @@ private:
     std::unique_ptr<S2Cap> _cap;
 };
 
+// The S2 cells covering a polygon, a multi polygon or a circle. Checking whether the cells
+// contain a point is a binary search, which rejects most points outside of a shape with
+// many edges before the exact test.
+class GeoCellCovering {
+public:
+    GeoCellCovering();
+    ~GeoCellCovering();
+
+    // return nullptr if the shape is of other types
+    static std::unique_ptr<GeoCellCovering> create(const GeoShape& shape);
+
+    // false means the shape doesn't contain the point, true means it may contain the point
+    bool may_contain(const GeoPoint& point) const;
+
+private:
+    // the maximum number of cells covering each polygon
+    static constexpr int MAX_CELLS = 32;
+
+    std::unique_ptr<S2CellUnion> _cells;
+};
+
 } // namespace doris
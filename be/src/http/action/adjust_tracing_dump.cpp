@@ -19,9 +19,12 @@
 
 #include "common/logging.h"
 #include "http/http_channel.h"
+#include "http/http_headers.h"
 #include "http/http_request.h"
 #include "http/http_status.h"
+#include "pipeline/pipeline_tracing.h"
 #include "runtime/exec_env.h"
+#include "util/uid_util.h"
 
 namespace doris {
 void AdjustTracingDump::handle(HttpRequest* req) {
@@ -34,4 +37,18 @@ void AdjustTracingDump::handle(HttpRequest* req) {
         HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, status.msg().data());
     }
 }
+
+void ExportPipelineTrace::handle(HttpRequest* req) {
+    auto* sampler = ExecEnv::GetInstance()->pipeline_tracer_context()->sampler();
+    const auto& query_id_str = req->param("query_id");
+    TUniqueId query_id;
+    if (!query_id_str.empty() && !parse_id(query_id_str, &query_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "invalid query_id " + query_id_str + "\n");
+        return;
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+    HttpChannel::send_reply(req, HttpStatus::OK,
+                            sampler->export_trace(query_id_str.empty() ? nullptr : &query_id));
+}
 } // namespace doris
@@ -32,4 +32,15 @@ public:
 
     void handle(HttpRequest* req) override;
 };
+
+// Export the events of sampled queries in Chrome trace event format for Perfetto UI.
+// Optional param `query_id` only exports the events of one query.
+class ExportPipelineTrace : public HttpHandlerWithAuth {
+public:
+    ExportPipelineTrace(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~ExportPipelineTrace() override = default;
+
+    void handle(HttpRequest* req) override;
+};
 } // namespace doris
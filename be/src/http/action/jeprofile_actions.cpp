@@ -20,6 +20,8 @@
 #include <jemalloc/jemalloc.h>
 #include <unistd.h>
 
+#include <fstream>
+#include <sstream>
 #include <string>
 
 #include "http/ev_http_server.h"
@@ -142,4 +144,45 @@ void DumpJeHeapProfileActions::handle(HttpRequest* req) {
     }
 }
 
+void GetJeHeapContinuousProfileActions::handle(HttpRequest* req) {
+    if (!compile_check(req)) {
+        return;
+    }
+    auto profiles = HeapProfiler::instance()->continuous_heap_profiles();
+    const auto& index_str = req->param("index");
+    if (index_str.empty()) {
+        std::string msg = fmt::format(
+                "{} continuous heap profiles, the oldest first, get one by "
+                "`/jeheap/profiles?index=i` and analyze it by jeprof or pprof:\n",
+                profiles.size());
+        for (size_t i = 0; i < profiles.size(); ++i) {
+            msg += fmt::format("{}: {}\n", i, profiles[i]);
+        }
+        if (profiles.empty()) {
+            msg += "set `continuous_heap_profile_interval_s` to start continuous heap profile.\n";
+        }
+        HttpChannel::send_reply(req, HttpStatus::OK, msg);
+        return;
+    }
+    size_t index = 0;
+    try {
+        index = std::stoul(index_str);
+    } catch (...) {
+        index = profiles.size();
+    }
+    std::ifstream file;
+    if (index < profiles.size()) {
+        file.open(profiles[index], std::ios::binary);
+    }
+    if (!file.is_open()) {
+        HttpChannel::send_reply(req, HttpStatus::NOT_FOUND,
+                                fmt::format("heap profile {} not found\n", index_str));
+        return;
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/octet-stream");
+    HttpChannel::send_reply(req, HttpStatus::OK, content.str());
+}
+
 } // namespace doris
@@ -53,4 +53,12 @@ public:
     void handle(HttpRequest* req) override;
 };
 
+// Lists the recent continuous heap profiles, or returns the one of `index` in the pprof format.
+class GetJeHeapContinuousProfileActions final : public HttpHandlerWithAuth {
+public:
+    GetJeHeapContinuousProfileActions(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+    ~GetJeHeapContinuousProfileActions() override = default;
+    void handle(HttpRequest* req) override;
+};
+
 } // namespace doris
@@ -17,9 +17,11 @@
 
 #include "show_hotspot_action.h"
 
+#include <limits>
 #include <queue>
 #include <string>
 
+#include "cloud/cloud_tablet_hotspot.h"
 #include "cloud/cloud_tablet_mgr.h"
 #include "http/http_channel.h"
 #include "http/http_request.h"
@@ -34,6 +36,7 @@ enum class Metrics {
     NUM_ROWSETS = 3,
     NUM_BASE_ROWSETS = 4,
     NUM_CUMU_ROWSETS = 5,
+    QUERY = 6,
     UNKNOWN = 100000,
 };
 
@@ -67,6 +70,8 @@ Status check_param(HttpRequest* req, int& top_n, Metrics& metrics) {
         metrics = Metrics::NUM_CUMU_ROWSETS;
     } else if (metrics_str == "num_base_rowsets") {
         metrics = Metrics::NUM_BASE_ROWSETS;
+    } else if (metrics_str == "query") {
+        metrics = Metrics::QUERY;
     } else {
         return Status::InternalError("unknown metrics: {}", metrics_str);
     }
@@ -98,6 +103,20 @@ void ShowHotspotAction::handle(HttpRequest* req) {
         return;
     }
 
+    if (metrics == Metrics::QUERY) {
+        // The queries of the last day, other compute groups pull this to warm up their caches
+        std::vector<HotTablet> hot_tablets;
+        _storage_engine.tablet_hotspot().get_top_n_hot_tablets(
+                topn <= 0 ? std::numeric_limits<size_t>::max() : topn, &hot_tablets);
+        std::string res;
+        res.reserve(hot_tablets.size() * 20);
+        for (const auto& hot_tablet : hot_tablets) {
+            res += fmt::format("{} {}\n", hot_tablet.tablet_id, hot_tablet.qpd);
+        }
+        HttpChannel::send_reply(req, HttpStatus::OK, res);
+        return;
+    }
+
     std::function<int64_t(CloudTablet&)> count_fn;
     switch (metrics) {
     case Metrics::READ_BLOCK:
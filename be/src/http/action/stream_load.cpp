@@ -29,6 +29,7 @@
 #include <sys/time.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
@@ -106,6 +107,9 @@ void StreamLoadAction::handle(HttpRequest* req) {
         return;
     }
 
+    // the body which did not fit into the pipe while it was read
+    _append_held_body(req, ctx, true);
+
     // status already set to fail
     if (ctx->status.ok()) {
         ctx->status = _handle(ctx);
@@ -352,27 +356,11 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     struct evhttp_request* ev_req = req->get_evhttp_request();
     auto evbuf = evhttp_request_get_input_buffer(ev_req);
 
-    SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->stream_load_pipe_tracker());
-
     int64_t start_read_data_time = MonotonicNanos();
-    while (evbuffer_get_length(evbuf) > 0) {
-        ByteBufferPtr bb;
-        Status st = ByteBuffer::allocate(128 * 1024, &bb);
-        if (!st.ok()) {
-            ctx->status = st;
-            return;
-        }
-        auto remove_bytes = evbuffer_remove(evbuf, bb->ptr, bb->capacity);
-        bb->pos = remove_bytes;
-        bb->flip();
-        st = ctx->body_sink->append(bb);
-        if (!st.ok()) {
-            LOG(WARNING) << "append body content failed. errmsg=" << st << ", " << ctx->brief();
-            ctx->status = st;
-            return;
-        }
-        ctx->receive_bytes += remove_bytes;
-    }
+    // libevent drains the input buffer after this callback, move the chunk without copying it
+    // so the part which does not fit into the pipe now is kept until the pipe is read
+    evbuffer_add_buffer(req->held_body(), evbuf);
+    _append_held_body(req, ctx, false);
     int64_t read_data_time = MonotonicNanos() - start_read_data_time;
     int64_t last_receive_and_read_data_cost_nanos = ctx->receive_and_read_data_cost_nanos;
     ctx->read_data_cost_nanos += read_data_time;
@@ -384,6 +372,57 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
                        1000000;
 }
 
+void StreamLoadAction::_append_held_body(HttpRequest* req,
+                                         const std::shared_ptr<StreamLoadContext>& ctx,
+                                         bool blocking) {
+    if (!ctx->status.ok() || ctx->body_sink == nullptr) {
+        return;
+    }
+    SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->stream_load_pipe_tracker());
+
+    auto* held_body = req->held_body();
+    while (evbuffer_get_length(held_body) > 0) {
+        if (!blocking) {
+            std::weak_ptr<StreamLoadContext> weak_ctx = ctx;
+            auto on_writable = req->event_loop_callback([this, weak_ctx](HttpRequest* req) {
+                auto ctx = weak_ctx.lock();
+                if (ctx == nullptr) {
+                    return;
+                }
+                _append_held_body(req, ctx, false);
+                if (!ctx->status.ok() || evbuffer_get_length(req->held_body()) == 0) {
+                    req->resume_reading_body();
+                }
+            });
+            if (!ctx->body_sink->writable(std::move(on_writable))) {
+                // stop reading the body instead of blocking the event loop until the pipe is
+                // read, the reading is resumed by the callback
+                req->pause_reading_body();
+                return;
+            }
+        }
+        // a read of the held body returns up to one chunk of the pipe in a few buffer segments
+        constexpr int MAX_IOVECS = 16;
+        struct evbuffer_iovec iovecs[MAX_IOVECS];
+        int num_iovecs = evbuffer_peek(held_body, MIN_CHUNK_SIZE, nullptr, iovecs, MAX_IOVECS);
+        num_iovecs = std::min(num_iovecs, MAX_IOVECS);
+        size_t appended_bytes = 0;
+        for (int i = 0; i < num_iovecs && appended_bytes < MIN_CHUNK_SIZE; ++i) {
+            size_t len = std::min(iovecs[i].iov_len, MIN_CHUNK_SIZE - appended_bytes);
+            Status st = ctx->body_sink->append(static_cast<const char*>(iovecs[i].iov_base), len);
+            if (!st.ok()) {
+                LOG(WARNING) << "append body content failed. errmsg=" << st << ", "
+                             << ctx->brief();
+                ctx->status = st;
+                return;
+            }
+            appended_bytes += len;
+        }
+        evbuffer_drain(held_body, appended_bytes);
+        ctx->receive_bytes += appended_bytes;
+    }
+}
+
 void StreamLoadAction::free_handler_ctx(std::shared_ptr<void> param) {
     std::shared_ptr<StreamLoadContext> ctx = std::static_pointer_cast<StreamLoadContext>(param);
     if (ctx == nullptr) {
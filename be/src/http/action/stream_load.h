@@ -51,6 +51,10 @@ private:
     Status _process_put(HttpRequest* http_req, std::shared_ptr<StreamLoadContext> ctx);
     void _save_stream_load_record(std::shared_ptr<StreamLoadContext> ctx, const std::string& str);
     Status _handle_group_commit(HttpRequest* http_req, std::shared_ptr<StreamLoadContext> ctx);
+    // Appends the held body of the request to the body sink. If not `blocking`, stops once
+    // appending would wait for the sink and pauses reading the request until it is writable.
+    void _append_held_body(HttpRequest* req, const std::shared_ptr<StreamLoadContext>& ctx,
+                           bool blocking);
 
 private:
     ExecEnv* _exec_env;
@@ -35,6 +35,7 @@
 #include <memory>
 #include <sstream>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "http/http_channel.h"
 #include "http/http_handler.h"
@@ -65,6 +66,7 @@ static void on_request(struct evhttp_request* ev_req, void* arg) {
         // In this case, request's on_header return -1
         return;
     }
+    request->on_body_complete();
     request->handler()->handle(request);
 }
 
@@ -130,7 +132,8 @@ void EvHttpServer::start() {
                                          [](evhttp* http) { evhttp_free(http); });
             CHECK(http != nullptr) << "Couldn't create an evhttp.";
 
-            auto res = evhttp_accept_socket(http.get(), _server_fd);
+            int server_fd = _server_fds.size() == 1 ? _server_fds[0] : _server_fds[i];
+            auto res = evhttp_accept_socket(http.get(), server_fd);
             CHECK(res >= 0) << "evhttp accept socket failed, res=" << res;
 
             evhttp_set_newreqcb(http.get(), on_connection, this);
@@ -151,40 +154,79 @@ void EvHttpServer::stop() {
         _event_bases.clear();
     }
     _workers->shutdown();
-    close(_server_fd);
+    for (int fd : _server_fds) {
+        close(fd);
+    }
+    _server_fds.clear();
     _started = false;
 }
 
 void EvHttpServer::join() {}
 
 Status EvHttpServer::_bind() {
+    // With SO_REUSEPORT the kernel spreads the new connections over the sockets of the workers,
+    // instead of waking up all workers on the shared socket for every connection.
+    bool reuse_port = config::enable_webserver_reuse_port && _num_workers > 1;
+    int num_fds = reuse_port ? _num_workers : 1;
+    int port = _port;
+    for (int i = 0; i < num_fds; ++i) {
+        int fd = -1;
+        RETURN_IF_ERROR(_listen(port, reuse_port, &fd));
+        _server_fds.push_back(fd);
+        if (_port == 0 && i == 0) {
+            struct sockaddr_in addr;
+            socklen_t socklen = sizeof(addr);
+            const int rc = getsockname(fd, (struct sockaddr*)&addr, &socklen);
+            if (rc == 0) {
+                _real_port = ntohs(addr.sin_port);
+            }
+            // the other sockets listen on the port chosen by the os
+            port = _real_port;
+        }
+    }
+    return Status::OK();
+}
+
+Status EvHttpServer::_listen(int port, bool reuse_port, int* fd) {
     butil::EndPoint point;
-    auto res = butil::str2endpoint(_host.c_str(), _port, &point);
+    auto res = butil::str2endpoint(_host.c_str(), port, &point);
     if (res < 0) {
-        return Status::InternalError("convert address failed, host={}, port={}", _host, _port);
+        return Status::InternalError("convert address failed, host={}, port={}", _host, port);
+    }
+    if (reuse_port) {
+        struct sockaddr_storage addr;
+        socklen_t addr_len = 0;
+        if (butil::endpoint2sockaddr(point, &addr, &addr_len) == 0) {
+            *fd = socket(addr.ss_family, SOCK_STREAM, 0);
+        }
+        int on = 1;
+        if (*fd >= 0 && (setsockopt(*fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) != 0 ||
+                         setsockopt(*fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) != 0 ||
+                         bind(*fd, (struct sockaddr*)&addr, addr_len) != 0 ||
+                         listen(*fd, SOMAXCONN) != 0)) {
+            int saved_errno = errno;
+            close(*fd);
+            *fd = -1;
+            errno = saved_errno;
+        }
+    } else {
+        *fd = butil::tcp_listen(point);
     }
-    _server_fd = butil::tcp_listen(point);
-    if (_server_fd < 0) {
+    if (*fd < 0) {
         char buf[64];
         std::stringstream ss;
         ss << "tcp listen failed, errno=" << errno
            << ", errmsg=" << strerror_r(errno, buf, sizeof(buf));
         return Status::InternalError(ss.str());
     }
-    if (_port == 0) {
-        struct sockaddr_in addr;
-        socklen_t socklen = sizeof(addr);
-        const int rc = getsockname(_server_fd, (struct sockaddr*)&addr, &socklen);
-        if (rc == 0) {
-            _real_port = ntohs(addr.sin_port);
-        }
-    }
-    res = butil::make_non_blocking(_server_fd);
+    res = butil::make_non_blocking(*fd);
     if (res < 0) {
         char buf[64];
         std::stringstream ss;
         ss << "make socket to non_blocking failed, errno=" << errno
            << ", errmsg=" << strerror_r(errno, buf, sizeof(buf));
+        close(*fd);
+        *fd = -1;
         return Status::InternalError(ss.str());
     }
     return Status::OK();
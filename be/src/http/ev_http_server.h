@@ -62,6 +62,7 @@ public:
 
 private:
     Status _bind();
+    Status _listen(int port, bool reuse_port, int* fd);
     HttpHandler* _find_handler(HttpRequest* req);
 
 private:
@@ -72,7 +73,9 @@ private:
     // used for unittest, set port to 0, os will choose a free port;
     int _real_port;
 
-    int _server_fd = -1;
+    // one socket shared by all workers, or one socket for each worker if they listen with
+    // SO_REUSEPORT
+    std::vector<int> _server_fds;
     std::unique_ptr<ThreadPool> _workers;
     std::mutex _event_bases_lock; // protect _event_bases
     std::vector<std::shared_ptr<event_base>> _event_bases;
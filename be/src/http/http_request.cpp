@@ -18,6 +18,8 @@
 #include "http/http_request.h"
 
 #include <event2/buffer.h>
+#include <event2/bufferevent.h>
+#include <event2/event.h>
 #include <event2/http.h>
 #include <event2/http_struct.h>
 #include <event2/keyvalq_struct.h>
@@ -40,6 +42,56 @@ HttpRequest::~HttpRequest() {
         DCHECK(_handler != nullptr);
         _handler->free_handler_ctx(_handler_ctx);
     }
+    if (_held_body != nullptr) {
+        evbuffer_free(_held_body);
+    }
+}
+
+struct evbuffer* HttpRequest::held_body() {
+    if (_held_body == nullptr) {
+        _held_body = evbuffer_new();
+    }
+    return _held_body;
+}
+
+void HttpRequest::pause_reading_body() {
+    if (_body_reading_paused) {
+        return;
+    }
+    auto* bev = evhttp_connection_get_bufferevent(evhttp_request_get_connection(_ev_req));
+    bufferevent_disable(bev, EV_READ);
+    _body_reading_paused = true;
+}
+
+void HttpRequest::resume_reading_body() {
+    if (!_body_reading_paused) {
+        return;
+    }
+    auto* bev = evhttp_connection_get_bufferevent(evhttp_request_get_connection(_ev_req));
+    bufferevent_enable(bev, EV_READ);
+    _body_reading_paused = false;
+}
+
+std::function<void()> HttpRequest::event_loop_callback(std::function<void(HttpRequest*)> fn) {
+    auto* base = evhttp_connection_get_base(evhttp_request_get_connection(_ev_req));
+    std::weak_ptr<HttpRequest*> weak_self = _self;
+    return [base, weak_self = std::move(weak_self), fn = std::move(fn)]() {
+        auto* task = new std::function<void()>([weak_self, fn]() {
+            // the request is freed in the event loop thread too, so it is alive while running
+            if (auto self = weak_self.lock()) {
+                fn(*self);
+            }
+        });
+        auto run_task = [](evutil_socket_t, short, void* arg) {
+            std::unique_ptr<std::function<void()>> task(static_cast<std::function<void()>*>(arg));
+            (*task)();
+        };
+        // a timeout without time runs the task in the next round of the event loop
+        if (event_base_once(base, -1, EV_TIMEOUT, run_task, task, nullptr) != 0) {
+            LOG(WARNING) << "failed to schedule a task in the event loop of a http request";
+            delete task;
+        }
+    };
 }
 
 int HttpRequest::init_from_evhttp() {
@@ -19,6 +19,7 @@
 
 #include <glog/logging.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -26,6 +27,7 @@
 #include "http/http_method.h"
 #include "util/string_util.h"
 
+struct evbuffer;
 struct evhttp_request;
 
 namespace doris {
@@ -79,6 +81,22 @@ public:
 
     const char* remote_host() const;
 
+    // The body read by the chunk callbacks but not consumed by the handler yet. libevent drops
+    // the input buffer of the request after every chunk callback, so the handler moves the
+    // chunks it can not consume now to this buffer.
+    struct evbuffer* held_body();
+
+    // Stops reading the body from the connection until resume_reading_body(), so a slow
+    // consumer of a large body pushes back on the client instead of the body being buffered.
+    void pause_reading_body();
+    void resume_reading_body();
+    // the whole body is read, the connection is not read for the body anymore
+    void on_body_complete() { _body_reading_paused = false; }
+
+    // Returns a function which can be called from any thread to run `fn` with this request in
+    // the event loop thread of the request. `fn` is not run if the request is freed by then.
+    std::function<void()> event_loop_callback(std::function<void(HttpRequest*)> fn);
+
 private:
     HttpMethod _method;
     std::string _uri;
@@ -93,6 +111,11 @@ private:
 
     std::shared_ptr<void> _handler_ctx;
     std::string _request_body;
+
+    struct evbuffer* _held_body = nullptr;
+    bool _body_reading_paused = false;
+    // expires when the request is freed, only accessed in the event loop thread
+    std::shared_ptr<HttpRequest*> _self = std::make_shared<HttpRequest*>(this);
 };
 
 } // namespace doris
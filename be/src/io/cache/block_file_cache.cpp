@@ -29,6 +29,7 @@
 #include <sys/statfs.h>
 #endif
 
+#include <boost/algorithm/string/trim.hpp>
 #include <chrono> // IWYU pragma: keep
 #include <mutex>
 #include <ranges>
@@ -42,6 +43,7 @@
 #include "io/cache/mem_file_cache_storage.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
+#include "util/string_util.h"
 #include "util/time.h"
 #include "vec/common/sip_hash.h"
 #include "vec/common/uint128.h"
@@ -234,6 +236,26 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
                              24 * 60 * 60);
     _ttl_queue = LRUQueue(cache_settings.ttl_queue_size, cache_settings.ttl_queue_elements,
                           std::numeric_limits<int>::max());
+    std::vector<std::string> segmented_queues =
+            split(config::file_cache_segmented_fifo_queues, ",");
+    size_t probation_percent = config::file_cache_segmented_fifo_probation_percent;
+    for (auto& name : segmented_queues) {
+        boost::algorithm::trim(name);
+        if (name.empty()) {
+            continue;
+        }
+        if (name == "normal") {
+            _normal_queue.enable_segmented_fifo(probation_percent);
+        } else if (name == "index") {
+            _index_queue.enable_segmented_fifo(probation_percent);
+        } else if (name == "disposable") {
+            _disposable_queue.enable_segmented_fifo(probation_percent);
+        } else if (name == "ttl") {
+            _ttl_queue.enable_segmented_fifo(probation_percent);
+        } else {
+            LOG(WARNING) << "unknown queue " << name << " in file_cache_segmented_fifo_queues";
+        }
+    }
     if (cache_settings.storage == "memory") {
         _storage = std::make_unique<MemFileCacheStorage>();
         _cache_base_path = "memory";
@@ -1486,8 +1508,26 @@ BlockFileCache::LRUQueue::Iterator BlockFileCache::LRUQueue::add(
         const UInt128Wrapper& hash, size_t offset, size_t size,
         std::lock_guard<std::mutex>& /* cache_lock */) {
     cache_size += size;
-    auto iter = queue.insert(queue.end(), FileKeyAndOffset(hash, offset, size));
-    map.insert(std::make_pair(std::make_pair(hash, offset), iter));
+    auto key = std::make_pair(hash, offset);
+    Iterator iter;
+    if (!segmented) {
+        iter = queue.insert(queue.end(), FileKeyAndOffset(hash, offset, size));
+    } else if (ghost_keys.erase(key) > 0) {
+        // evicted from probation not long ago, it is worth protecting
+        ++ghost_hits;
+        iter = queue.insert(queue.end(), FileKeyAndOffset(hash, offset, size));
+        if (!protected_begin) {
+            protected_begin = iter;
+        }
+    } else {
+        if (cache_size > max_size) {
+            _demote();
+        }
+        iter = queue.insert(_probation_end(), FileKeyAndOffset(hash, offset, size));
+        probation_keys.insert(key);
+        probation_size += size;
+    }
+    map.insert(std::make_pair(key, iter));
     return iter;
 }
 
@@ -1495,7 +1535,17 @@ template <class T>
     requires IsXLock<T>
 void BlockFileCache::LRUQueue::remove(Iterator queue_it, T& /* cache_lock */) {
     cache_size -= queue_it->size;
-    map.erase(std::make_pair(queue_it->hash, queue_it->offset));
+    auto key = std::make_pair(queue_it->hash, queue_it->offset);
+    if (segmented) {
+        if (probation_keys.erase(key) > 0) {
+            probation_size -= queue_it->size;
+            _add_ghost(queue_it->hash, queue_it->offset);
+        } else if (protected_begin && *protected_begin == queue_it) {
+            auto next = std::next(queue_it);
+            protected_begin = next == queue.end() ? std::nullopt : std::make_optional(next);
+        }
+    }
+    map.erase(key);
     queue.erase(queue_it);
 }
 
@@ -1503,12 +1553,57 @@ void BlockFileCache::LRUQueue::remove_all(std::lock_guard<std::mutex>& /* cache_
     queue.clear();
     map.clear();
     cache_size = 0;
+    _clear_segments();
 }
 
 void BlockFileCache::LRUQueue::move_to_end(Iterator queue_it,
                                            std::lock_guard<std::mutex>& /* cache_lock */) {
+    if (segmented) {
+        if (probation_keys.erase(std::make_pair(queue_it->hash, queue_it->offset)) > 0) {
+            ++probation_hits;
+            probation_size -= queue_it->size;
+            if (!protected_begin) {
+                protected_begin = queue_it;
+            }
+        } else {
+            ++protected_hits;
+            if (*protected_begin == queue_it && std::next(queue_it) != queue.end()) {
+                protected_begin = std::next(queue_it);
+            }
+        }
+    }
     queue.splice(queue.end(), queue, queue_it);
 }
+
+void BlockFileCache::LRUQueue::enable_segmented_fifo(size_t probation_percent) {
+    DCHECK(queue.empty());
+    segmented = true;
+    probation_max_size = std::max<size_t>(max_size * std::min<size_t>(probation_percent, 100) / 100,
+                                          1);
+}
+
+void BlockFileCache::LRUQueue::_add_ghost(const UInt128Wrapper& hash, size_t offset) {
+    // as many ghosts as the blocks in the queue are enough to catch a reuse
+    while (!ghost_fifo.empty() && ghost_fifo.size() >= std::max<size_t>(queue.size(), 1)) {
+        ghost_keys.erase(ghost_fifo.front());
+        ghost_fifo.pop_front();
+    }
+    auto key = std::make_pair(hash, offset);
+    if (ghost_keys.insert(key).second) {
+        ghost_fifo.push_back(key);
+    }
+}
+
+void BlockFileCache::LRUQueue::_demote() {
+    while (protected_begin && probation_size < probation_max_size) {
+        auto it = *protected_begin;
+        probation_keys.emplace(it->hash, it->offset);
+        probation_size += it->size;
+        auto next = std::next(it);
+        protected_begin = next == queue.end() ? std::nullopt : std::make_optional(next);
+    }
+}
+
 bool BlockFileCache::LRUQueue::contains(const UInt128Wrapper& hash, size_t offset,
                                         std::lock_guard<std::mutex>& /* cache_lock */) const {
     return map.find(std::make_pair(hash, offset)) != map.end();
@@ -2181,9 +2276,27 @@ std::map<std::string, double> BlockFileCache::get_stats() {
     stats["need_evict_cache_in_advance"] = (double)_need_evict_cache_in_advance;
     stats["disk_resource_limit_mode"] = (double)_disk_resource_limit_mode;
 
+    SCOPED_CACHE_LOCK(_mutex, this);
+    add_segmented_fifo_stats(stats);
     return stats;
 }
 
+void BlockFileCache::add_segmented_fifo_stats(std::map<std::string, double>& stats) const {
+    for (const auto& [name, queue] :
+         {std::make_pair("index", &_index_queue), std::make_pair("ttl", &_ttl_queue),
+          std::make_pair("normal", &_normal_queue),
+          std::make_pair("disposable", &_disposable_queue)}) {
+        if (!queue->is_segmented_fifo()) {
+            continue;
+        }
+        std::string prefix = std::string(name) + "_queue_";
+        stats[prefix + "probation_size"] = (double)queue->probation_size;
+        stats[prefix + "probation_hits"] = (double)queue->probation_hits;
+        stats[prefix + "protected_hits"] = (double)queue->protected_hits;
+        stats[prefix + "ghost_hits"] = (double)queue->ghost_hits;
+    }
+}
+
 // for be UTs
 std::map<std::string, double> BlockFileCache::get_stats_unsafe() {
     std::map<std::string, double> stats;
@@ -2211,6 +2324,7 @@ std::map<std::string, double> BlockFileCache::get_stats_unsafe() {
     stats["disposable_queue_max_elements"] = (double)_disposable_queue.get_max_element_size();
     stats["disposable_queue_curr_elements"] = (double)_disposable_queue.get_elements_num_unsafe();
 
+    add_segmented_fifo_stats(stats);
     return stats;
 }
 
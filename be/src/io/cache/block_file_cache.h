@@ -21,10 +21,12 @@
 #include <concurrentqueue.h>
 
 #include <boost/lockfree/spsc_queue.hpp>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <thread>
+#include <unordered_set>
 
 #include "io/cache/file_block.h"
 #include "io/cache/file_cache_common.h"
@@ -112,6 +114,9 @@ public:
         if (_cache_background_evict_in_advance_thread.joinable()) {
             _cache_background_evict_in_advance_thread.join();
         }
+        if (_storage) {
+            _storage->save_meta_checkpoint(this);
+        }
     }
 
     /// Restore cache from local filesystem.
@@ -216,6 +221,9 @@ public:
     // for be UTs
     std::map<std::string, double> get_stats_unsafe();
 
+    // the hits of the queues evicted by a segmented FIFO, must hold the cache lock
+    void add_segmented_fifo_stats(std::map<std::string, double>& stats) const;
+
     class LRUQueue {
     public:
         LRUQueue() = default;
@@ -286,14 +294,54 @@ public:
             queue.clear();
             map.clear();
             cache_size = 0;
+            _clear_segments();
         }
 
+        // Evict in the spirit of S3-FIFO instead of LRU. New blocks enter a probation segment
+        // at the head of the queue, which is evicted first, and only a hit moves a block to
+        // the protected tail. So a scan touching blocks once doesn't flush the hot ones.
+        // Blocks evicted from probation are remembered in a ghost set and go to the protected
+        // segment directly when they are added again.
+        void enable_segmented_fifo(size_t probation_percent);
+
+        bool is_segmented_fifo() const { return segmented; }
+
         size_t max_size;
         size_t max_element_size;
         std::list<FileKeyAndOffset> queue;
         std::unordered_map<std::pair<UInt128Wrapper, size_t>, Iterator, HashFileKeyAndOffset> map;
         size_t cache_size = 0;
         int64_t hot_data_interval {0};
+
+        // only used by the segmented FIFO
+        bool segmented = false;
+        size_t probation_max_size = 0;
+        size_t probation_size = 0;
+        // the first block of the protected segment, nullopt when there is none
+        std::optional<Iterator> protected_begin;
+        std::unordered_set<std::pair<UInt128Wrapper, size_t>, HashFileKeyAndOffset> probation_keys;
+        std::unordered_set<std::pair<UInt128Wrapper, size_t>, HashFileKeyAndOffset> ghost_keys;
+        std::deque<std::pair<UInt128Wrapper, size_t>> ghost_fifo;
+        size_t probation_hits = 0;
+        size_t protected_hits = 0;
+        size_t ghost_hits = 0;
+
+    private:
+        Iterator _probation_end() { return protected_begin ? *protected_begin : queue.end(); }
+
+        void _add_ghost(const UInt128Wrapper& hash, size_t offset);
+
+        // move the oldest protected blocks to probation while it is below its share, so the
+        // protected segment is evicted too once the queue is full
+        void _demote();
+
+        void _clear_segments() {
+            probation_size = 0;
+            protected_begin.reset();
+            probation_keys.clear();
+            ghost_keys.clear();
+            ghost_fifo.clear();
+        }
     };
 
     using AccessRecord =
@@ -31,12 +31,16 @@
 #endif
 
 #include <algorithm>
+#include <charconv>
+#include <filesystem>
 #include <ostream>
+#include <system_error>
 #include <utility>
 
 #include "common/config.h"
 #include "exec/schema_scanner/schema_scanner_helper.h"
 #include "io/cache/file_cache_common.h"
+#include "io/cache/fs_file_cache_storage.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 #include "service/backend_options.h"
@@ -60,6 +64,13 @@ size_t FileCacheFactory::try_release() {
 }
 
 size_t FileCacheFactory::try_release(const std::string& base_path) {
+    if (auto iter = _base_path_to_caches.find(base_path); iter != _base_path_to_caches.end()) {
+        size_t elements = 0;
+        for (auto* cache : iter->second) {
+            elements += cache->try_release();
+        }
+        return elements;
+    }
     auto iter = _path_to_cache.find(base_path);
     if (iter != _path_to_cache.end()) {
         return iter->second->try_release();
@@ -106,18 +117,111 @@ Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
                   << " total_size: " << file_cache_settings.capacity
                   << " disk_total_size: " << disk_capacity;
     }
-    auto cache = std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings);
-    RETURN_IF_ERROR(cache->initialize());
-    {
+    size_t num_shards = static_cast<size_t>(std::max(config::file_cache_shards_per_path, 1));
+    if (file_cache_settings.storage == "memory") {
+        num_shards = 1;
+    }
+    if (file_cache_settings.storage != "memory") {
+        remove_stale_shards(cache_base_path, num_shards);
+    }
+    if (num_shards == 1) {
+        auto cache = std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings);
+        RETURN_IF_ERROR(cache->initialize());
         std::lock_guard lock(_mtx);
+        _base_path_to_caches[cache_base_path] = {cache.get()};
         _path_to_cache[cache_base_path] = cache.get();
         _caches.push_back(std::move(cache));
         _capacity += file_cache_settings.capacity;
+        return Status::OK();
     }
 
+    // Every shard is a cache of its own in a sub directory, with its own lock and queues. A key
+    // is mapped to a cache by its hash, so the shards get the same share of the blocks and each
+    // one takes the same share of the capacity.
+    FileCacheSettings shard_settings = get_shard_settings(file_cache_settings, num_shards);
+    std::vector<std::unique_ptr<BlockFileCache>> shards;
+    for (size_t i = 0; i < num_shards; ++i) {
+        std::string shard_path =
+                (std::filesystem::path(cache_base_path) / fmt::format("{}{}", SHARD_DIR_PREFIX, i))
+                        .native();
+        bool exists = false;
+        RETURN_IF_ERROR(global_local_filesystem()->exists(shard_path, &exists));
+        if (!exists) {
+            RETURN_IF_ERROR(global_local_filesystem()->create_directory(shard_path));
+        }
+        auto cache = std::make_unique<BlockFileCache>(shard_path, shard_settings);
+        RETURN_IF_ERROR(cache->initialize());
+        shards.push_back(std::move(cache));
+    }
+    std::lock_guard lock(_mtx);
+    auto& base_caches = _base_path_to_caches[cache_base_path];
+    for (auto& cache : shards) {
+        base_caches.push_back(cache.get());
+        _path_to_cache[cache->get_base_path()] = cache.get();
+        _caches.push_back(std::move(cache));
+        _capacity += shard_settings.capacity;
+    }
     return Status::OK();
 }
 
+FileCacheSettings FileCacheFactory::get_shard_settings(const FileCacheSettings& settings,
+                                                       size_t num_shards) {
+    auto elements = [num_shards](size_t num) {
+        return std::max(num / num_shards, REMOTE_FS_OBJECTS_CACHE_DEFAULT_ELEMENTS);
+    };
+    FileCacheSettings shard_settings = settings;
+    shard_settings.capacity = settings.capacity / num_shards;
+    shard_settings.disposable_queue_size = settings.disposable_queue_size / num_shards;
+    shard_settings.disposable_queue_elements = elements(settings.disposable_queue_elements);
+    shard_settings.index_queue_size = settings.index_queue_size / num_shards;
+    shard_settings.index_queue_elements = elements(settings.index_queue_elements);
+    shard_settings.query_queue_size = settings.query_queue_size / num_shards;
+    shard_settings.query_queue_elements = elements(settings.query_queue_elements);
+    shard_settings.ttl_queue_size = settings.ttl_queue_size / num_shards;
+    shard_settings.ttl_queue_elements = elements(settings.ttl_queue_elements);
+    shard_settings.max_query_cache_size = settings.max_query_cache_size / num_shards;
+    return shard_settings;
+}
+
+void FileCacheFactory::remove_stale_shards(const std::string& cache_base_path,
+                                           size_t num_shards) {
+    // The blocks of a path are either in its key prefix directories or in its shard directories,
+    // the other layout is left from a different file_cache_shards_per_path and never read.
+    std::error_code ec;
+    std::filesystem::directory_iterator it {cache_base_path, ec};
+    if (ec) {
+        LOG(WARNING) << "failed to list file cache path " << cache_base_path << ": "
+                     << ec.message();
+        return;
+    }
+    for (; it != std::filesystem::directory_iterator(); ++it) {
+        if (!it->is_directory()) {
+            continue;
+        }
+        std::string name = it->path().filename().native();
+        bool stale = false;
+        if (name.starts_with(SHARD_DIR_PREFIX)) {
+            size_t shard = 0;
+            auto [ptr, err] = std::from_chars(name.data() + SHARD_DIR_PREFIX.size(),
+                                              name.data() + name.size(), shard);
+            stale = num_shards == 1 || err != std::errc() || ptr != name.data() + name.size() ||
+                    shard >= num_shards;
+        } else {
+            stale = num_shards > 1 &&
+                    name.size() == static_cast<size_t>(FSFileCacheStorage::KEY_PREFIX_LENGTH);
+        }
+        if (stale) {
+            LOG(INFO) << "remove " << it->path().native() << " of file cache path "
+                      << cache_base_path << ", " << num_shards << " shards are used";
+            std::filesystem::remove_all(it->path(), ec);
+            if (ec) {
+                LOG(WARNING) << "failed to remove " << it->path().native() << ": "
+                             << ec.message();
+            }
+        }
+    }
+}
+
 std::vector<std::string> FileCacheFactory::get_cache_file_by_path(const UInt128Wrapper& hash) {
     io::BlockFileCache* cache = io::FileCacheFactory::instance()->get_by_path(hash);
     auto blocks = cache->get_blocks_by_key(hash);
@@ -197,32 +301,38 @@ std::string validate_capacity(const std::string& path, int64_t new_capacity,
 
 std::string FileCacheFactory::reset_capacity(const std::string& path, int64_t new_capacity) {
     std::stringstream ss;
-    size_t total_capacity = 0;
+    // the capacity of a sharded path is split among its shards
+    auto reset_base_path = [&](const std::string& base_path,
+                               const std::vector<BlockFileCache*>& caches) {
+        int64_t valid_capacity = 0;
+        ss << validate_capacity(base_path, new_capacity, valid_capacity);
+        if (valid_capacity <= 0) {
+            return false;
+        }
+        for (auto* cache : caches) {
+            ss << cache->reset_capacity(valid_capacity / static_cast<int64_t>(caches.size()));
+        }
+        return true;
+    };
+    auto update_total_capacity = [this]() {
+        size_t total_capacity = 0;
+        for (const auto& cache : _caches) {
+            total_capacity += cache->capacity();
+        }
+        _capacity = total_capacity;
+    };
     if (path.empty()) {
-        for (auto& [p, cache] : _path_to_cache) {
-            int64_t valid_capacity = 0;
-            ss << validate_capacity(p, new_capacity, valid_capacity);
-            if (valid_capacity <= 0) {
+        for (auto& [p, caches] : _base_path_to_caches) {
+            if (!reset_base_path(p, caches)) {
                 return ss.str();
             }
-            ss << cache->reset_capacity(valid_capacity);
-            total_capacity += cache->capacity();
         }
-        _capacity = total_capacity;
+        update_total_capacity();
         return ss.str();
     } else {
-        if (auto iter = _path_to_cache.find(path); iter != _path_to_cache.end()) {
-            int64_t valid_capacity = 0;
-            ss << validate_capacity(path, new_capacity, valid_capacity);
-            if (valid_capacity <= 0) {
-                return ss.str();
-            }
-            ss << iter->second->reset_capacity(valid_capacity);
-
-            for (auto& [p, cache] : _path_to_cache) {
-                total_capacity += cache->capacity();
-            }
-            _capacity = total_capacity;
+        if (auto iter = _base_path_to_caches.find(path); iter != _base_path_to_caches.end()) {
+            reset_base_path(path, iter->second);
+            update_total_capacity();
             return ss.str();
         }
     }
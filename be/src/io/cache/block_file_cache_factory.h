@@ -95,9 +95,20 @@ public:
     FileCacheFactory(const FileCacheFactory&) = delete;
 
 private:
+    static constexpr std::string_view SHARD_DIR_PREFIX = "shard_";
+
+    static FileCacheSettings get_shard_settings(const FileCacheSettings& settings,
+                                                size_t num_shards);
+
+    // Remove the directories of cache_base_path which num_shards shards don't use.
+    static void remove_stale_shards(const std::string& cache_base_path, size_t num_shards);
+
     std::mutex _mtx;
     std::vector<std::unique_ptr<BlockFileCache>> _caches;
+    // the path of every cache, a shard has its own
     std::unordered_map<std::string, BlockFileCache*> _path_to_cache;
+    // the caches of every configured path, more than one if it's split into shards
+    std::unordered_map<std::string, std::vector<BlockFileCache*>> _base_path_to_caches;
     size_t _capacity = 0;
     std::atomic_size_t _next_index {0}; // use for round-robin
 };
@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <list>
 #include <vector>
 
@@ -36,6 +37,8 @@
 #include "io/fs/file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "io/io_common.h"
+#include "runtime/exec_env.h"
+#include "runtime/thread_context.h"
 #include "util/bit_util.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
@@ -43,6 +46,10 @@
 namespace doris::io {
 
 bvar::Adder<uint64_t> s3_read_counter("cached_remote_reader_s3_read");
+bvar::Adder<int64_t> g_write_behind_bytes("cached_remote_reader_write_behind_bytes");
+bvar::Adder<int64_t> g_write_behind_rejected_bytes(
+        "cached_remote_reader_write_behind_rejected_bytes");
+std::atomic<int64_t> g_write_behind_pending_bytes {0};
 bvar::LatencyRecorder g_skip_cache_num("cached_remote_reader_skip_cache_num");
 bvar::Adder<uint64_t> g_skip_cache_sum("cached_remote_reader_skip_cache_sum");
 bvar::Adder<uint64_t> g_skip_local_cache_io_sum_bytes(
@@ -110,6 +117,62 @@ std::pair<size_t, size_t> CachedRemoteFileReader::s_align_size(size_t offset, si
     return std::make_pair(align_left, align_size);
 }
 
+bool CachedRemoteFileReader::_write_behind(const std::vector<FileBlockSPtr>& empty_blocks,
+                                           size_t buffer_offset, std::unique_ptr<char[]>& buffer,
+                                           ReadStatistics* stats) {
+    auto* pool = ExecEnv::GetInstance()->file_cache_write_behind_thread_pool();
+    if (!config::enable_file_cache_write_behind || pool == nullptr) {
+        return false;
+    }
+    FileBlocks blocks;
+    int64_t bytes = 0;
+    for (const auto& block : empty_blocks) {
+        if (block->state() != FileBlock::State::SKIP_CACHE) {
+            blocks.push_back(block);
+            bytes += block->range().size();
+        }
+    }
+    if (blocks.empty()) {
+        return true;
+    }
+    // a full queue pushes the writes back to the readers
+    if (g_write_behind_pending_bytes.fetch_add(bytes) + bytes >
+        config::file_cache_write_behind_max_bytes) {
+        g_write_behind_pending_bytes.fetch_sub(bytes);
+        g_write_behind_rejected_bytes << bytes;
+        return false;
+    }
+    for (auto& block : blocks) {
+        block->detach_downloader();
+    }
+    stats->bytes_write_into_file_cache += bytes;
+    // readers of the blocks wait for the write as they do for a download by another reader
+    auto task = [holder = std::make_shared<FileBlocksHolder>(std::move(blocks)),
+                 data = std::shared_ptr<char[]>(buffer.release()), buffer_offset, bytes]() {
+        SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->orphan_mem_tracker());
+        for (auto& block : holder->file_blocks) {
+            char* cur_ptr = data.get() + block->range().left - buffer_offset;
+            Status st = block->append(Slice(cur_ptr, block->range().size()));
+            if (st.ok()) {
+                // resets the block itself on failure
+                st = block->finalize();
+            } else {
+                block->reset_detached_download();
+            }
+            if (!st.ok()) {
+                LOG_EVERY_N(WARNING, 100) << "Write data to file cache failed. err=" << st.msg();
+            }
+        }
+        g_write_behind_pending_bytes.fetch_sub(bytes);
+        g_write_behind_bytes << bytes;
+    };
+    if (!pool->submit_func(task).ok()) {
+        // the blocks are detached already, finish them here
+        task();
+    }
+    return true;
+}
+
 Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                                             const IOContext* io_ctx) {
     const bool is_dryrun = io_ctx->is_dryrun;
@@ -226,24 +289,6 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             RETURN_IF_ERROR(_remote_file_reader->read_at(empty_start, Slice(buffer.get(), size),
                                                          &size, io_ctx));
         }
-        for (auto& block : empty_blocks) {
-            if (block->state() == FileBlock::State::SKIP_CACHE) {
-                continue;
-            }
-            SCOPED_RAW_TIMER(&stats.local_write_timer);
-            char* cur_ptr = buffer.get() + block->range().left - empty_start;
-            size_t block_size = block->range().size();
-            Status st = block->append(Slice(cur_ptr, block_size));
-            if (st.ok()) {
-                st = block->finalize();
-            }
-            if (!st.ok()) {
-                LOG_EVERY_N(WARNING, 100) << "Write data to file cache failed. err=" << st.msg();
-            } else {
-                _insert_file_reader(block);
-            }
-            stats.bytes_write_into_file_cache += block_size;
-        }
         // copy from memory directly
         size_t right_offset = offset + bytes_req - 1;
         if (empty_start <= right_offset && empty_end >= offset && !is_dryrun) {
@@ -254,15 +299,70 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             size_t copy_size = copy_right_offset - copy_left_offset + 1;
             memcpy(dst, src, copy_size);
         }
+        if (!_write_behind(empty_blocks, empty_start, buffer, &stats)) {
+            for (auto& block : empty_blocks) {
+                if (block->state() == FileBlock::State::SKIP_CACHE) {
+                    continue;
+                }
+                SCOPED_RAW_TIMER(&stats.local_write_timer);
+                char* cur_ptr = buffer.get() + block->range().left - empty_start;
+                size_t block_size = block->range().size();
+                Status st = block->append(Slice(cur_ptr, block_size));
+                if (st.ok()) {
+                    st = block->finalize();
+                }
+                if (!st.ok()) {
+                    LOG_EVERY_N(WARNING, 100)
+                            << "Write data to file cache failed. err=" << st.msg();
+                } else {
+                    _insert_file_reader(block);
+                }
+                stats.bytes_write_into_file_cache += block_size;
+            }
+        }
     }
 
     size_t current_offset = offset;
     size_t end_offset = offset + bytes_req - 1;
+    // read the downloaded blocks at once, the loop below reads the others
+    std::vector<char> read_in_batch(holder.file_blocks.size(), false);
+    if (config::enable_file_cache_io_uring && !is_dryrun && holder.file_blocks.size() > 1) {
+        std::vector<FileBlock*> blocks;
+        std::vector<Slice> buffers;
+        std::vector<size_t> read_offsets;
+        std::vector<size_t> block_indexes;
+        size_t index = 0;
+        for (auto& block : holder.file_blocks) {
+            size_t left = block->range().left;
+            size_t right = block->range().right;
+            if (right >= offset && left <= end_offset &&
+                !(empty_start <= left && right <= empty_end) &&
+                block->state() == FileBlock::State::DOWNLOADED) {
+                size_t read_left = std::max(left, offset);
+                size_t read_size = std::min(right, end_offset) - read_left + 1;
+                blocks.push_back(block.get());
+                buffers.emplace_back(result.data + (read_left - offset), read_size);
+                read_offsets.push_back(read_left - left);
+                block_indexes.push_back(index);
+            }
+            ++index;
+        }
+        if (blocks.size() > 1) {
+            SCOPED_RAW_TIMER(&stats.local_read_timer);
+            std::vector<Status> statuses;
+            FileBlock::read_batch(blocks, buffers, read_offsets, &statuses);
+            for (size_t i = 0; i < statuses.size(); ++i) {
+                read_in_batch[block_indexes[i]] = statuses[i].ok();
+            }
+        }
+    }
     *bytes_read = 0;
+    size_t block_index = 0;
     for (auto& block : holder.file_blocks) {
         if (current_offset > end_offset) {
             break;
         }
+        bool block_read = read_in_batch[block_index++];
         size_t left = block->range().left;
         size_t right = block->range().right;
         if (right < offset) {
@@ -270,7 +370,7 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         }
         size_t read_size =
                 end_offset > right ? right - current_offset + 1 : end_offset - current_offset + 1;
-        if (empty_start <= left && right <= empty_end) {
+        if ((empty_start <= left && right <= empty_end) || block_read) {
             *bytes_read += read_size;
             current_offset = right + 1;
             continue;
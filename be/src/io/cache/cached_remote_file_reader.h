@@ -60,6 +60,12 @@ protected:
 
 private:
     void _insert_file_reader(FileBlockSPtr file_block);
+
+    // Write the downloaded blocks into the cache in the write-behind thread pool, buffer is
+    // taken over on success. Return false if the writes should be done by the caller.
+    bool _write_behind(const std::vector<FileBlockSPtr>& empty_blocks, size_t buffer_offset,
+                       std::unique_ptr<char[]>& buffer, ReadStatistics* stats);
+
     bool _is_doris_table;
     FileReaderSPtr _remote_file_reader;
     UInt128Wrapper _cache_hash;
@@ -27,6 +27,7 @@
 #include "common/status.h"
 #include "cpp/sync_point.h"
 #include "io/cache/block_file_cache.h"
+#include "runtime/thread_context.h"
 
 namespace doris {
 namespace io {
@@ -139,6 +140,21 @@ bool FileBlock::is_downloader_impl(std::lock_guard<std::mutex>& /* block_lock */
     return get_caller_id() == _downloader_id;
 }
 
+void FileBlock::detach_downloader() {
+    std::lock_guard block_lock(_mutex);
+    DCHECK(is_downloader_impl(block_lock));
+    _downloader_id = DETACHED_DOWNLOADER_ID;
+}
+
+void FileBlock::reset_detached_download() {
+    std::lock_guard block_lock(_mutex);
+    DCHECK_EQ(_downloader_id, DETACHED_DOWNLOADER_ID);
+    _downloaded_size = 0;
+    _download_state = State::EMPTY;
+    _downloader_id = 0;
+    _cv.notify_all();
+}
+
 Status FileBlock::append(Slice data) {
     DCHECK(data.size != 0) << "Writing zero size is not allowed";
     RETURN_IF_ERROR(_mgr->_storage->append(_key, data));
@@ -162,7 +178,39 @@ Status FileBlock::finalize() {
 }
 
 Status FileBlock::read(Slice buffer, size_t read_offset) {
-    return _mgr->_storage->read(_key, read_offset, buffer);
+    size_t bytes_read = 0;
+    SCOPED_RECORD_READ_TIER(doris::IOContext::ReadTier::FILE_CACHE, &bytes_read);
+    RETURN_IF_ERROR(_mgr->_storage->read(_key, read_offset, buffer));
+    bytes_read = buffer.size;
+    return Status::OK();
+}
+
+void FileBlock::read_batch(const std::vector<FileBlock*>& blocks, const std::vector<Slice>& buffers,
+                           const std::vector<size_t>& read_offsets, std::vector<Status>* statuses) {
+    DCHECK_EQ(blocks.size(), buffers.size());
+    DCHECK_EQ(blocks.size(), read_offsets.size());
+    statuses->clear();
+    if (blocks.empty()) {
+        return;
+    }
+    std::vector<FileCacheReadRequest> requests;
+    requests.reserve(blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        DCHECK_EQ(blocks[i]->_mgr, blocks[0]->_mgr);
+        requests.push_back({.key = blocks[i]->_key,
+                            .value_offset = read_offsets[i],
+                            .buffer = buffers[i]});
+    }
+    // the batch is recorded as a single read of the file cache
+    size_t bytes_read = 0;
+    SCOPED_RECORD_READ_TIER(doris::IOContext::ReadTier::FILE_CACHE, &bytes_read);
+    blocks[0]->_mgr->_storage->read_batch(&requests);
+    for (auto& request : requests) {
+        if (request.status.ok()) {
+            bytes_read += request.buffer.size;
+        }
+        statuses->push_back(std::move(request.status));
+    }
 }
 
 Status FileBlock::change_cache_type_between_ttl_and_others(FileCacheType new_type) {
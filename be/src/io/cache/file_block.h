@@ -22,11 +22,13 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <limits>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "io/cache/file_cache_common.h"
@@ -98,6 +100,12 @@ public:
     // read data from cache file
     [[nodiscard]] Status read(Slice buffer, size_t read_offset);
 
+    // Read from the cache files of some blocks of the same cache at once, statuses[i] is the
+    // status of blocks[i].
+    static void read_batch(const std::vector<FileBlock*>& blocks,
+                           const std::vector<Slice>& buffers,
+                           const std::vector<size_t>& read_offsets, std::vector<Status>* statuses);
+
     // finish write, release the file writer
     [[nodiscard]] Status finalize();
 
@@ -110,6 +118,12 @@ public:
 
     bool is_downloader() const;
 
+    // Hand the download over to a write-behind task, so the holders of the caller don't reset
+    // the block when released. The task ends it by finalize() or reset_detached_download().
+    void detach_downloader();
+
+    void reset_detached_download();
+
     FileCacheType cache_type() const { return _key.meta.type; }
 
     static uint64_t get_caller_id();
@@ -145,6 +159,8 @@ private:
 
     void reset_downloader_impl(std::lock_guard<std::mutex>& block_lock);
 
+    static constexpr uint64_t DETACHED_DOWNLOADER_ID = std::numeric_limits<uint64_t>::max();
+
     Range _block_range;
 
     State _download_state;
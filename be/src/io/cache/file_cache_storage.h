@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include "common/status.h"
 #include "io/cache/file_cache_common.h"
 #include "util/slice.h"
 
@@ -40,6 +43,13 @@ struct FileWriterMapKeyHash {
     }
 };
 
+struct FileCacheReadRequest {
+    FileCacheKey key;
+    size_t value_offset;
+    Slice buffer;
+    Status status;
+};
+
 // The interface is for organizing datas in disk
 class FileCacheStorage {
 public:
@@ -53,6 +63,12 @@ public:
     virtual Status finalize(const FileCacheKey& key) = 0;
     // read the block
     virtual Status read(const FileCacheKey& key, size_t value_offset, Slice result) = 0;
+    // read the blocks of the requests, the status of each is set in place
+    virtual void read_batch(std::vector<FileCacheReadRequest>* requests) {
+        for (auto& request : *requests) {
+            request.status = read(request.key, request.value_offset, request.buffer);
+        }
+    }
     // remove the block
     virtual Status remove(const FileCacheKey& key) = 0;
     // change the block meta
@@ -62,6 +78,8 @@ public:
     // use when lazy load cache
     virtual void load_blocks_directly_unlocked(BlockFileCache* _mgr, const FileCacheKey& key,
                                                std::lock_guard<std::mutex>& cache_lock) {}
+    // persist the blocks meta on close, so the next init may restore it without a scan
+    virtual void save_meta_checkpoint(BlockFileCache* _mgr) {}
     // force clear all current data in the cache
     virtual Status clear(std::string& msg) = 0;
     virtual FileCacheStorageType get_type() = 0;
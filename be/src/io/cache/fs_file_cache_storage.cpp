@@ -28,11 +28,15 @@
 #include "io/cache/file_cache_common.h"
 #include "io/fs/file_reader_writer_fwd.h"
 #include "io/fs/file_writer.h"
+#include "io/fs/io_uring_reader.h"
 #include "io/fs/local_file_reader.h"
 #include "io/fs/local_file_writer.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+#include "util/stopwatch.hpp"
 #include "vec/common/hex.h"
 
 namespace doris::io {
@@ -127,7 +131,14 @@ Status FSFileCacheStorage::init(BlockFileCache* _mgr) {
                 throw doris::Exception(Status::InternalError(msg));
             }
         }
-        load_cache_info_into_memory(mgr);
+        st = load_meta_checkpoint(mgr);
+        if (!st.ok()) {
+            if (!st.is<ErrorCode::NOT_FOUND>()) {
+                LOG(WARNING) << "failed to load file cache meta checkpoint of " << _cache_base_path
+                             << ", scan the cache directory instead. st=" << st;
+            }
+            load_cache_info_into_memory(mgr);
+        }
         mgr->_async_open_done = true;
         LOG_INFO("file cache {} lazy load done.", _cache_base_path);
     });
@@ -177,7 +188,7 @@ Status FSFileCacheStorage::finalize(const FileCacheKey& key) {
     return fs->rename(file_writer->path(), true_file);
 }
 
-Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Slice buffer) {
+Status FSFileCacheStorage::get_file_reader(const FileCacheKey& key, FileReaderSPtr* reader) {
     AccessKeyAndOffset fd_key = std::make_pair(key.hash, key.offset);
     FileReaderSPtr file_reader = FDCache::instance()->get_file_reader(fd_key);
     if (!file_reader) {
@@ -208,6 +219,13 @@ Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Sl
 
         FDCache::instance()->insert_file_reader(fd_key, file_reader);
     }
+    *reader = std::move(file_reader);
+    return Status::OK();
+}
+
+Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Slice buffer) {
+    FileReaderSPtr file_reader;
+    RETURN_IF_ERROR(get_file_reader(key, &file_reader));
     size_t bytes_read = 0;
     auto s = file_reader->read_at(value_offset, buffer, &bytes_read);
     if (!s.ok()) {
@@ -219,6 +237,48 @@ Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Sl
     return Status::OK();
 }
 
+void FSFileCacheStorage::read_batch(std::vector<FileCacheReadRequest>* requests) {
+    if (!config::enable_file_cache_io_uring || requests->size() < 2) {
+        FileCacheStorage::read_batch(requests);
+        return;
+    }
+    // keep the readers, so their fds stay open until the reads are done
+    std::vector<FileReaderSPtr> file_readers(requests->size());
+    std::vector<IOUringReadRequest> reads;
+    std::vector<size_t> read_to_request;
+    for (size_t i = 0; i < requests->size(); ++i) {
+        auto& request = (*requests)[i];
+        request.status = get_file_reader(request.key, &file_readers[i]);
+        if (!request.status.ok()) {
+            continue;
+        }
+        auto* local_reader = dynamic_cast<LocalFileReader*>(file_readers[i].get());
+        if (local_reader == nullptr) {
+            request.status = read(request.key, request.value_offset, request.buffer);
+            continue;
+        }
+        reads.push_back({.fd = local_reader->fd(),
+                         .offset = request.value_offset,
+                         .buffer = request.buffer});
+        read_to_request.push_back(i);
+    }
+    IOUringReader::read(&reads);
+    for (size_t i = 0; i < reads.size(); ++i) {
+        auto& request = (*requests)[read_to_request[i]];
+        request.status = std::move(reads[i].status);
+        if (request.status.ok() && reads[i].bytes_read != request.buffer.size) {
+            request.status = Status::InternalError(
+                    "short read of file cache file {}, expected={}, read={}",
+                    file_readers[read_to_request[i]]->path().native(), request.buffer.size,
+                    reads[i].bytes_read);
+        }
+        if (!request.status.ok()) {
+            LOG(WARNING) << "read file failed, file=" << file_readers[read_to_request[i]]->path()
+                         << ", error=" << request.status.to_string();
+        }
+    }
+}
+
 Status FSFileCacheStorage::remove(const FileCacheKey& key) {
     std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
     std::string file = get_path_in_local_cache(dir, key.offset, key.meta.type);
@@ -825,6 +885,192 @@ void FSFileCacheStorage::load_blocks_directly_unlocked(BlockFileCache* mgr, cons
     }
 }
 
+namespace {
+
+constexpr uint32_t META_CHECKPOINT_MAGIC = 0x4643444d; // "MDCF"
+constexpr uint32_t META_CHECKPOINT_VERSION = 1;
+// magic, version and the number of blocks
+constexpr size_t META_CHECKPOINT_HEADER_SIZE = 4 + 4 + 8;
+// hash, expiration time, offset, size, cache type and whether the block is downloaded
+constexpr size_t META_CHECKPOINT_ENTRY_SIZE = 16 + 8 + 8 + 8 + 1 + 1;
+
+struct MetaCheckpointEntry {
+    UInt128Wrapper hash;
+    uint64_t expiration_time;
+    uint64_t offset;
+    uint64_t size;
+    FileCacheType type;
+    bool downloaded;
+};
+
+void encode_meta_checkpoint_entry(const MetaCheckpointEntry& entry, std::string* buffer) {
+    uint8_t buf[META_CHECKPOINT_ENTRY_SIZE];
+    encode_fixed128_le(buf, entry.hash.value_);
+    encode_fixed64_le(buf + 16, entry.expiration_time);
+    encode_fixed64_le(buf + 24, entry.offset);
+    encode_fixed64_le(buf + 32, entry.size);
+    encode_fixed8(buf + 40, static_cast<uint8_t>(entry.type));
+    encode_fixed8(buf + 41, entry.downloaded);
+    buffer->append(reinterpret_cast<const char*>(buf), sizeof(buf));
+}
+
+MetaCheckpointEntry decode_meta_checkpoint_entry(const uint8_t* buf) {
+    MetaCheckpointEntry entry;
+    entry.hash = UInt128Wrapper(decode_fixed128_le(buf));
+    entry.expiration_time = decode_fixed64_le(buf + 16);
+    entry.offset = decode_fixed64_le(buf + 24);
+    entry.size = decode_fixed64_le(buf + 32);
+    entry.type = static_cast<FileCacheType>(decode_fixed8(buf + 40));
+    entry.downloaded = decode_fixed8(buf + 41) != 0;
+    return entry;
+}
+
+} // namespace
+
+std::string FSFileCacheStorage::get_meta_checkpoint_path() const {
+    return Path(_cache_base_path) / "meta_checkpoint";
+}
+
+void FSFileCacheStorage::save_meta_checkpoint(BlockFileCache* _mgr) {
+    if (!config::enable_file_cache_meta_checkpoint || !_mgr->_async_open_done) {
+        return;
+    }
+    MonotonicStopWatch watch;
+    watch.start();
+    std::string buffer(META_CHECKPOINT_HEADER_SIZE, '\0');
+    uint64_t num_blocks = 0;
+    {
+        SCOPED_CACHE_LOCK(_mgr->_mutex, _mgr);
+        auto add_block = [&](const FileBlockCell& cell) {
+            const auto& block = cell.file_block;
+            MetaCheckpointEntry entry {.hash = block->get_hash_value(),
+                                       .expiration_time = block->expiration_time(),
+                                       .offset = block->offset(),
+                                       .size = block->range().size(),
+                                       .type = block->cache_type(),
+                                       .downloaded = block->state_unsafe() ==
+                                                     FileBlock::State::DOWNLOADED};
+            encode_meta_checkpoint_entry(entry, &buffer);
+            ++num_blocks;
+        };
+        // in the LRU order, the blocks are added to the queues in the same order on load
+        for (auto type : {FileCacheType::INDEX, FileCacheType::NORMAL, FileCacheType::DISPOSABLE,
+                          FileCacheType::TTL}) {
+            for (const auto& entry : _mgr->get_queue(type)) {
+                if (auto* cell = _mgr->get_cell(entry.hash, entry.offset, cache_lock)) {
+                    add_block(*cell);
+                }
+            }
+        }
+        // the ttl blocks not in the ttl queue
+        for (const auto& [hash, blocks] : _mgr->_files) {
+            for (const auto& [offset, cell] : blocks) {
+                if (!cell.queue_iterator) {
+                    add_block(cell);
+                }
+            }
+        }
+    }
+    auto* header = reinterpret_cast<uint8_t*>(buffer.data());
+    encode_fixed32_le(header, META_CHECKPOINT_MAGIC);
+    encode_fixed32_le(header + 4, META_CHECKPOINT_VERSION);
+    encode_fixed64_le(header + 8, num_blocks);
+    uint8_t checksum[4];
+    encode_fixed32_le(checksum, crc32c::Value(buffer.data(), buffer.size()));
+    buffer.append(reinterpret_cast<const char*>(checksum), sizeof(checksum));
+
+    std::string path = get_meta_checkpoint_path();
+    std::string tmp_path = path + ".tmp";
+    auto st = [&]() -> Status {
+        FileWriterPtr writer;
+        RETURN_IF_ERROR(fs->create_file(tmp_path, &writer));
+        RETURN_IF_ERROR(writer->append(buffer));
+        RETURN_IF_ERROR(writer->close());
+        return fs->rename(tmp_path, path);
+    }();
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to save file cache meta checkpoint " << path << ", st=" << st;
+        static_cast<void>(fs->delete_file(tmp_path));
+        return;
+    }
+    LOG(INFO) << "saved file cache meta checkpoint " << path << ", blocks=" << num_blocks
+              << ", bytes=" << buffer.size() << ", cost=" << watch.elapsed_time() / 1000 << "us";
+}
+
+Status FSFileCacheStorage::load_meta_checkpoint(BlockFileCache* _mgr) const {
+    std::string path = get_meta_checkpoint_path();
+    bool exists = false;
+    RETURN_IF_ERROR(fs->exists(path, &exists));
+    if (!exists) {
+        return Status::NotFound("no file cache meta checkpoint {}", path);
+    }
+    std::string buffer;
+    if (config::enable_file_cache_meta_checkpoint) {
+        int64_t file_size = -1;
+        RETURN_IF_ERROR(fs->file_size(path, &file_size));
+        buffer.resize(file_size);
+        FileReaderSPtr reader;
+        RETURN_IF_ERROR(fs->open_file(path, &reader));
+        size_t bytes_read = 0;
+        RETURN_IF_ERROR(reader->read_at(0, Slice(buffer.data(), file_size), &bytes_read));
+        RETURN_IF_ERROR(reader->close());
+    }
+    // the blocks change once the cache is running, a checkpoint is only valid for one load
+    RETURN_IF_ERROR(fs->delete_file(path));
+    if (!config::enable_file_cache_meta_checkpoint) {
+        return Status::NotFound("file cache meta checkpoint is disabled");
+    }
+
+    const auto* data = reinterpret_cast<const uint8_t*>(buffer.data());
+    if (buffer.size() < META_CHECKPOINT_HEADER_SIZE + 4) {
+        return Status::Corruption("file cache meta checkpoint {} is too short", path);
+    }
+    size_t body_size = buffer.size() - 4;
+    if (decode_fixed32_le(data + body_size) != crc32c::Value(buffer.data(), body_size)) {
+        return Status::Corruption("bad checksum of file cache meta checkpoint {}", path);
+    }
+    if (decode_fixed32_le(data) != META_CHECKPOINT_MAGIC ||
+        decode_fixed32_le(data + 4) != META_CHECKPOINT_VERSION) {
+        return Status::Corruption("unknown file cache meta checkpoint {}", path);
+    }
+    uint64_t num_blocks = decode_fixed64_le(data + 8);
+    if (body_size != META_CHECKPOINT_HEADER_SIZE + num_blocks * META_CHECKPOINT_ENTRY_SIZE) {
+        return Status::Corruption("bad size of file cache meta checkpoint {}", path);
+    }
+
+    constexpr size_t batch_size = 10000;
+    for (size_t begin = 0; begin < num_blocks; begin += batch_size) {
+        SCOPED_CACHE_LOCK(_mgr->_mutex, _mgr);
+        for (size_t i = begin; i < std::min<size_t>(begin + batch_size, num_blocks); ++i) {
+            auto entry = decode_meta_checkpoint_entry(data + META_CHECKPOINT_HEADER_SIZE +
+                                                      i * META_CHECKPOINT_ENTRY_SIZE);
+            if (!entry.downloaded) {
+                // the download was cut by the close, drop whatever it left
+                auto dir = get_path_in_local_cache(entry.hash, entry.expiration_time);
+                for (bool is_tmp : {true, false}) {
+                    std::error_code ec;
+                    std::filesystem::remove(
+                            get_path_in_local_cache(dir, entry.offset, entry.type, is_tmp), ec);
+                }
+                continue;
+            }
+            if (_mgr->_files.contains(entry.hash) &&
+                _mgr->_files[entry.hash].contains(entry.offset)) {
+                continue;
+            }
+            CacheContext context;
+            context.query_id = TUniqueId();
+            context.expiration_time = entry.expiration_time;
+            context.cache_type = entry.type;
+            _mgr->add_cell(entry.hash, context, entry.offset, entry.size,
+                           FileBlock::State::DOWNLOADED, cache_lock);
+        }
+    }
+    LOG(INFO) << "restored " << num_blocks << " blocks of file cache " << _cache_base_path
+              << " from the meta checkpoint";
+    return Status::OK();
+}
+
 Status FSFileCacheStorage::clear(std::string& msg) {
     LOG(INFO) << "clear file storage, path=" << _cache_base_path;
     std::error_code ec;
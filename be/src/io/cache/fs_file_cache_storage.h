@@ -66,6 +66,7 @@ public:
     Status append(const FileCacheKey& key, const Slice& value) override;
     Status finalize(const FileCacheKey& key) override;
     Status read(const FileCacheKey& key, size_t value_offset, Slice buffer) override;
+    void read_batch(std::vector<FileCacheReadRequest>* requests) override;
     Status remove(const FileCacheKey& key) override;
     Status change_key_meta_type(const FileCacheKey& key, const FileCacheType type) override;
     Status change_key_meta_expiration(const FileCacheKey& key, const uint64_t expiration) override;
@@ -73,6 +74,7 @@ public:
                                        std::lock_guard<std::mutex>& cache_lock) override;
     Status clear(std::string& msg) override;
     std::string get_local_file(const FileCacheKey& key) override;
+    void save_meta_checkpoint(BlockFileCache* _mgr) override;
 
     [[nodiscard]] static std::string get_path_in_local_cache(const std::string& dir, size_t offset,
                                                              FileCacheType type,
@@ -91,6 +93,8 @@ public:
 private:
     void remove_old_version_directories();
 
+    Status get_file_reader(const FileCacheKey& key, FileReaderSPtr* reader);
+
     Status collect_directory_entries(const std::filesystem::path& dir_path,
                                      std::vector<std::string>& file_list) const;
 
@@ -109,6 +113,12 @@ private:
 
     void load_cache_info_into_memory(BlockFileCache* _mgr) const;
 
+    // Restore the blocks and their LRU order from the checkpoint of the last close. The
+    // checkpoint is removed before being applied, so a crash later falls back to the scan.
+    Status load_meta_checkpoint(BlockFileCache* _mgr) const;
+
+    [[nodiscard]] std::string get_meta_checkpoint_path() const;
+
     [[nodiscard]] std::vector<std::string> get_path_in_local_cache_all_candidates(
             const std::string& dir, size_t offset);
 
@@ -52,6 +52,8 @@ Status BenchmarkFactory::getBm(const std::string fs_type, const std::string op_t
             *bm = new S3ExistsBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "list") {
             *bm = new S3ListBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "mixed") {
+            *bm = new S3MixedBenchmark(threads, iterations, file_size, conf_map);
         } else {
             return Status::Error<ErrorCode::INVALID_ARGUMENT>(
                     "unknown params: fs_type: {}, op_type: {}, iterations: {}", fs_type, op_type,
@@ -68,6 +70,8 @@ Status BenchmarkFactory::getBm(const std::string fs_type, const std::string op_t
             *bm = new HdfsRenameBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "exists") {
             *bm = new HdfsExistsBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "mixed") {
+            *bm = new HdfsMixedBenchmark(threads, iterations, file_size, conf_map);
         } else {
             return Status::Error<ErrorCode::INVALID_ARGUMENT>(
                     "unknown params: fs_type: {}, op_type: {}, iterations: {}", fs_type, op_type,
@@ -100,7 +104,15 @@ public:
         if (!doris::config::init(conffile.c_str(), true, true, true)) {
             return Status::Error<INTERNAL_ERROR>("error read config file.");
         }
+        // the reads of the mixed benchmark go through a file cache of the size
+        if (_conf_map.contains("file_cache_path") && _conf_map.contains("file_cache_size")) {
+            doris::config::enable_file_cache = true;
+            doris::config::file_cache_path =
+                    fmt::format(R"([{{"path":"{}","total_size":{}}}])",
+                                _conf_map["file_cache_path"], _conf_map["file_cache_size"]);
+        }
         doris::CpuInfo::init();
+        RETURN_IF_ERROR(ExecEnv::GetInstance()->init_io_for_tool());
         Status status = Status::OK();
         if (doris::config::enable_java_support) {
             // Init jni
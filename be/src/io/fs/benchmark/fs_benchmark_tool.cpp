@@ -20,13 +20,12 @@
 #include <fstream>
 
 #include "io/fs/benchmark/benchmark_factory.hpp"
-#include "io/fs/s3_file_bufferpool.h"
 #include "util/cpu_info.h"
-#include "util/threadpool.h"
 
 DEFINE_string(fs_type, "hdfs", "Supported File System: s3, hdfs");
 DEFINE_string(operation, "create_write",
-              "Supported Operations: create_write, open_read, open, rename, delete, exists");
+              "Supported Operations: create_write, open_read, open, rename, delete, exists, "
+              "mixed");
 DEFINE_string(threads, "1", "Number of threads");
 DEFINE_string(iterations, "1", "Number of runs of each thread");
 DEFINE_string(repetitions, "1", "Number of iterations");
@@ -48,6 +47,9 @@ std::string get_usage(const std::string& progname) {
     ss << "\nop_type:\n";
     ss << "     read\n";
     ss << "     write\n";
+    ss << "     mixed: random ranged reads, scans and writes interleaved by the weights, with\n";
+    ss << "            the latency percentiles and the IOPS over time, see mixed_benchmark.hpp\n";
+    ss << "            for the keys in the conf file\n";
     ss << "\nthreads:\n";
     ss << "     num of threads\n";
     ss << "\niterations:\n";
@@ -60,6 +62,9 @@ std::string get_usage(const std::string& progname) {
     ss << progname
        << " --conf my.conf --fs_type=hdfs --operation=create_write --threads=2 --iterations=100 "
           "--file_size=1048576\n";
+    ss << progname
+       << " --conf my.conf --fs_type=s3 --operation=mixed --threads=16 --iterations=1 "
+          "--file_size=67108864\n";
     return ss.str();
 }
 
@@ -111,18 +116,6 @@ int main(int argc, char** argv) {
     }
 
     doris::CpuInfo::init();
-    int num_cores = doris::CpuInfo::num_cores();
-
-    // init s3 write buffer pool
-    std::unique_ptr<doris::ThreadPool> s3_file_upload_thread_pool;
-    doris::Status st = doris::ThreadPoolBuilder("S3FileUploadThreadPool")
-                               .set_min_threads(num_cores)
-                               .set_max_threads(num_cores)
-                               .build(&s3_file_upload_thread_pool);
-    if (!st.ok()) {
-        std::cerr << "init s3 write buffer pool failed" << std::endl;
-        return 1;
-    }
 
     try {
         doris::io::MultiBenchmark multi_bm(FLAGS_fs_type, FLAGS_operation, std::stoi(FLAGS_threads),
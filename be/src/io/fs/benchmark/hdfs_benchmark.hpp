@@ -19,6 +19,7 @@
 
 #include "io/file_factory.h"
 #include "io/fs/benchmark/base_benchmark.h"
+#include "io/fs/benchmark/mixed_benchmark.hpp"
 #include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/hdfs_file_reader.h"
@@ -159,4 +160,19 @@ public:
     }
 };
 
+class HdfsMixedBenchmark : public MixedBenchmark {
+public:
+    HdfsMixedBenchmark(int threads, int iterations, size_t file_size,
+                       const std::map<std::string, std::string>& conf_map)
+            : MixedBenchmark("HdfsMixedBenchmark", threads, iterations, file_size, conf_map) {}
+    ~HdfsMixedBenchmark() override = default;
+
+    Status get_fs(const std::string& path, std::shared_ptr<FileSystem>* fs) override {
+        THdfsParams hdfs_params = parse_properties(_conf_map);
+        *fs = DORIS_TRY(io::HdfsFileSystem::create(hdfs_params, hdfs_params.fs_name,
+                                                   io::FileSystem::TMP_FS_ID, nullptr));
+        return Status::OK();
+    }
+};
+
 } // namespace doris::io
@@ -0,0 +1,371 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "io/fs/benchmark/base_benchmark.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_system.h"
+#include "io/fs/file_writer.h"
+#include "io/io_common.h"
+#include "util/slice.h"
+
+namespace doris::io {
+
+// Histogram of latencies in microseconds, lock free to record from all the threads.
+// Values under 16 have a bucket each, the larger ones have 16 buckets per power of 2,
+// so a percentile is off by less than 1/16.
+class LatencyHistogram {
+public:
+    static constexpr size_t SUB_BUCKETS = 16;
+    static constexpr size_t NUM_BUCKETS = SUB_BUCKETS + (64 - 4) * SUB_BUCKETS;
+
+    void record(int64_t us) {
+        auto value = static_cast<uint64_t>(std::max<int64_t>(us, 0));
+        _buckets[_bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+        _count.fetch_add(1, std::memory_order_relaxed);
+        _sum.fetch_add(value, std::memory_order_relaxed);
+        uint64_t max = _max.load(std::memory_order_relaxed);
+        while (value > max && !_max.compare_exchange_weak(max, value)) {
+        }
+    }
+
+    uint64_t count() const { return _count.load(std::memory_order_relaxed); }
+
+    uint64_t max() const { return _max.load(std::memory_order_relaxed); }
+
+    double avg() const {
+        uint64_t n = count();
+        return n == 0 ? 0 : static_cast<double>(_sum.load(std::memory_order_relaxed)) / n;
+    }
+
+    // The latency which p (0 to 1) of the records are not larger than.
+    uint64_t percentile(double p) const {
+        uint64_t n = count();
+        if (n == 0) {
+            return 0;
+        }
+        auto target = std::max<uint64_t>(1, static_cast<uint64_t>(p * n + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+            seen += _buckets[i].load(std::memory_order_relaxed);
+            if (seen >= target) {
+                return std::min(_upper_bound_of(i), max());
+            }
+        }
+        return max();
+    }
+
+    void reset() {
+        for (auto& bucket : _buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        _count = 0;
+        _sum = 0;
+        _max = 0;
+    }
+
+    std::string to_string() const {
+        return fmt::format("count={} avg={:.0f}us p50={}us p99={}us p999={}us max={}us", count(),
+                           avg(), percentile(0.5), percentile(0.99), percentile(0.999), max());
+    }
+
+private:
+    static size_t _bucket_of(uint64_t value) {
+        if (value < SUB_BUCKETS) {
+            return value;
+        }
+        int exp = 63 - std::countl_zero(value); // >= 4
+        size_t sub = (value >> (exp - 4)) & (SUB_BUCKETS - 1);
+        return SUB_BUCKETS + (exp - 4) * SUB_BUCKETS + sub;
+    }
+
+    static uint64_t _upper_bound_of(size_t bucket) {
+        if (bucket < SUB_BUCKETS) {
+            return bucket;
+        }
+        size_t exp = (bucket - SUB_BUCKETS) / SUB_BUCKETS + 4;
+        uint64_t sub = (bucket - SUB_BUCKETS) % SUB_BUCKETS;
+        return ((SUB_BUCKETS + sub + 1) << (exp - 4)) - 1;
+    }
+
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> _buckets {};
+    std::atomic<uint64_t> _count {0};
+    std::atomic<uint64_t> _sum {0};
+    std::atomic<uint64_t> _max {0};
+};
+
+// Replay a mix of the io a BE does on a remote file system for a while: random small ranged
+// reads (point queries, index lookups), sequential scans and multipart writes (loads,
+// compactions), interleaved in each thread by the weights. The reads go through the file
+// cache with use_file_cache, its path and size are file_cache_path and file_cache_size of the
+// conf, see MultiBenchmark::init_env().
+//
+// conf:
+//   read_files          the files to read, separated by comma, file_path if not set
+//   duration_s          seconds of each run, default 30
+//   random_read_weight  default 80
+//   scan_weight         default 15
+//   write_weight        default 5
+//   random_read_size    bytes of a random read, default 64KB
+//   scan_size           bytes of a scan, read by buffer_size each time, default 8MB
+//   use_file_cache      read through the file cache, default false
+//   report_interval_s   seconds between the IOPS reports, default 1
+// A write creates a file of file_size bytes (default 64MB) in base_dir and appends it by
+// buffer_size each time.
+class MixedBenchmark : public BaseBenchmark {
+public:
+    enum Op { RANDOM_READ = 0, SCAN, WRITE, NUM_OPS };
+
+    MixedBenchmark(const std::string& name, int threads, int iterations, size_t file_size,
+                   const std::map<std::string, std::string>& conf_map)
+            : BaseBenchmark(name, threads, iterations, file_size, conf_map) {
+        if (_file_size <= 0) {
+            _file_size = 64 * 1024 * 1024;
+        }
+        set_repetition(1);
+    }
+    ~MixedBenchmark() override = default;
+
+    // Get the file system of path.
+    virtual Status get_fs(const std::string& path, std::shared_ptr<FileSystem>* fs) = 0;
+
+    Status run(benchmark::State& state) override {
+        std::string files = _conf_map.contains("read_files") ? _conf_map["read_files"]
+                                                             : _conf_map["file_path"];
+        std::vector<std::string> paths;
+        std::stringstream ss(files);
+        for (std::string path; std::getline(ss, path, ',');) {
+            if (!path.empty()) {
+                paths.push_back(path);
+            }
+        }
+        int weights[NUM_OPS] = {_conf_int("random_read_weight", 80), _conf_int("scan_weight", 15),
+                                _conf_int("write_weight", 5)};
+        if (paths.empty()) {
+            if (weights[WRITE] <= 0) {
+                return Status::InvalidArgument("no read_files or file_path to read");
+            }
+            weights[RANDOM_READ] = weights[SCAN] = 0;
+        }
+        if (std::all_of(std::begin(weights), std::end(weights), [](int w) { return w <= 0; })) {
+            return Status::InvalidArgument("all the weights of the operations are 0");
+        }
+        std::shared_ptr<FileSystem> fs;
+        RETURN_IF_ERROR(get_fs(paths.empty() ? get_file_path(state) : paths[0], &fs));
+
+        ThreadContext ctx;
+        ctx.io_ctx.file_cache_stats = &ctx.cache_stats;
+        io::FileReaderOptions reader_opts;
+        if (_conf_map["use_file_cache"] == "true") {
+            reader_opts.cache_type = FileCachePolicy::FILE_BLOCK_CACHE;
+        }
+        for (const auto& path : paths) {
+            FileReaderSPtr reader;
+            RETURN_IF_ERROR(fs->open_file(path, &reader, &reader_opts));
+            ctx.readers.push_back(std::move(reader));
+        }
+        ctx.buffer.resize(std::max(_conf_size("buffer_size", 1000000L),
+                                   _conf_size("random_read_size", 64 * 1024L)));
+        ctx.rng.seed(std::random_device()() + state.thread_index());
+        std::discrete_distribution<int> pick_op(std::begin(weights), std::end(weights));
+
+        _running.fetch_add(1);
+        auto start = std::chrono::steady_clock::now();
+        auto deadline = start + std::chrono::seconds(_conf_int("duration_s", 30));
+        Status st;
+        while (st.ok() && std::chrono::steady_clock::now() < deadline) {
+            switch (pick_op(ctx.rng)) {
+            case RANDOM_READ:
+                st = _random_read(&ctx);
+                break;
+            case SCAN:
+                st = _scan(&ctx);
+                break;
+            default:
+                st = _write(state, fs.get(), &ctx);
+            }
+            _maybe_report();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        state.SetIterationTime(elapsed.count());
+        state.counters["IOPS"] = benchmark::Counter(ctx.ops, benchmark::Counter::kIsRate);
+        state.counters["Bytes(B/S)"] = benchmark::Counter(ctx.bytes, benchmark::Counter::kIsRate);
+        if (ctx.cache_stats.num_local_io_total + ctx.cache_stats.num_remote_io_total > 0) {
+            state.counters["CacheHitBytes(B)"] = ctx.cache_stats.bytes_read_from_local;
+            state.counters["CacheMissBytes(B)"] = ctx.cache_stats.bytes_read_from_remote;
+        }
+        for (int op = 0; op < NUM_OPS; ++op) {
+            const auto& hist = _histograms[op];
+            if (hist.count() == 0) {
+                continue;
+            }
+            // the threads see the same histogram, average them to keep it as it is
+            for (auto [suffix, p] : PERCENTILES) {
+                state.counters[fmt::format("{}{}(us)", OP_NAMES[op], suffix)] = benchmark::Counter(
+                        hist.percentile(p), benchmark::Counter::kAvgThreads);
+            }
+        }
+        if (_running.fetch_sub(1) == 1) {
+            for (int op = 0; op < NUM_OPS; ++op) {
+                bm_log("{} {}: {}", _name, OP_NAMES[op], _histograms[op].to_string());
+                _histograms[op].reset();
+            }
+        }
+        return st;
+    }
+
+private:
+    static constexpr const char* OP_NAMES[NUM_OPS] = {"RandomRead", "Scan", "Write"};
+    static constexpr std::pair<const char*, double> PERCENTILES[] = {
+            {"P50", 0.5}, {"P99", 0.99}, {"P999", 0.999}};
+
+    struct ThreadContext {
+        std::vector<FileReaderSPtr> readers;
+        std::vector<char> buffer;
+        std::mt19937_64 rng;
+        // the file and the offset the next scan reads from
+        size_t scan_file = 0;
+        size_t scan_offset = 0;
+        int64_t write_seq = 0;
+        uint64_t ops = 0;
+        uint64_t bytes = 0;
+        FileCacheStatistics cache_stats;
+        IOContext io_ctx;
+    };
+
+    int _conf_int(const std::string& key, int default_value) {
+        return _conf_map.contains(key) ? std::stoi(_conf_map[key]) : default_value;
+    }
+
+    size_t _conf_size(const std::string& key, size_t default_value) {
+        return _conf_map.contains(key) ? std::stol(_conf_map[key]) : default_value;
+    }
+
+    Status _timed_read(Op op, ThreadContext* ctx, const FileReaderSPtr& reader, size_t offset,
+                       size_t size, size_t* bytes_read) {
+        auto start = std::chrono::steady_clock::now();
+        RETURN_IF_ERROR(reader->read_at(offset, Slice(ctx->buffer.data(), size), bytes_read,
+                                        &ctx->io_ctx));
+        _record(op, ctx, start, *bytes_read);
+        return Status::OK();
+    }
+
+    void _record(Op op, ThreadContext* ctx, std::chrono::steady_clock::time_point start,
+                 size_t bytes) {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+        _histograms[op].record(us);
+        ++ctx->ops;
+        ctx->bytes += bytes;
+        _interval_ops.fetch_add(1, std::memory_order_relaxed);
+        _interval_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    Status _random_read(ThreadContext* ctx) {
+        const auto& reader = ctx->readers[ctx->rng() % ctx->readers.size()];
+        size_t size = std::min(_conf_size("random_read_size", 64 * 1024L), reader->size());
+        size_t offset = reader->size() > size ? ctx->rng() % (reader->size() - size) : 0;
+        size_t bytes_read = 0;
+        return _timed_read(RANDOM_READ, ctx, reader, offset, size, &bytes_read);
+    }
+
+    Status _scan(ThreadContext* ctx) {
+        size_t buffer_size = _conf_size("buffer_size", 1000000L);
+        for (size_t remain = _conf_size("scan_size", 8 * 1024 * 1024L); remain > 0;) {
+            const auto& reader = ctx->readers[ctx->scan_file];
+            if (ctx->scan_offset >= reader->size()) {
+                // go on with the next file
+                ctx->scan_file = (ctx->scan_file + 1) % ctx->readers.size();
+                ctx->scan_offset = 0;
+                if (reader->size() == 0) {
+                    return Status::OK();
+                }
+                continue;
+            }
+            size_t size = std::min({buffer_size, remain, reader->size() - ctx->scan_offset});
+            size_t bytes_read = 0;
+            RETURN_IF_ERROR(_timed_read(SCAN, ctx, reader, ctx->scan_offset, size, &bytes_read));
+            if (bytes_read == 0) {
+                ctx->scan_offset = reader->size();
+                continue;
+            }
+            ctx->scan_offset += bytes_read;
+            remain -= bytes_read;
+        }
+        return Status::OK();
+    }
+
+    Status _write(benchmark::State& state, FileSystem* fs, ThreadContext* ctx) {
+        // a few files for each thread, they are overwritten by the later runs
+        auto path = fmt::format("{}_mixed_{}", get_file_path(state), ctx->write_seq++ % 4);
+        size_t buffer_size = _conf_size("buffer_size", 1000000L);
+        auto start = std::chrono::steady_clock::now();
+        FileWriterPtr writer;
+        RETURN_IF_ERROR(fs->create_file(path, &writer));
+        for (size_t remain = _file_size; remain > 0;) {
+            size_t size = std::min(buffer_size, remain);
+            RETURN_IF_ERROR(writer->append(Slice(ctx->buffer.data(), size)));
+            remain -= size;
+        }
+        RETURN_IF_ERROR(writer->close());
+        _record(WRITE, ctx, start, _file_size);
+        return Status::OK();
+    }
+
+    // Log the IOPS and the throughput of all the threads every report_interval_s.
+    void _maybe_report() {
+        auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+        int64_t last = _last_report_ns.load(std::memory_order_relaxed);
+        int64_t interval_ns = _conf_int("report_interval_s", 1) * 1000000000L;
+        if (last == 0) {
+            _last_report_ns.compare_exchange_strong(last, now);
+            return;
+        }
+        if (now - last < interval_ns || !_last_report_ns.compare_exchange_strong(last, now)) {
+            return;
+        }
+        double seconds = static_cast<double>(now - last) / 1e9;
+        uint64_t ops = _interval_ops.exchange(0);
+        uint64_t bytes = _interval_bytes.exchange(0);
+        bm_log("{} iops={:.0f} throughput={:.2f}MB/s random_read_p99={}us scan_p99={}us", _name,
+               ops / seconds, bytes / seconds / 1024 / 1024,
+               _histograms[RANDOM_READ].percentile(0.99), _histograms[SCAN].percentile(0.99));
+    }
+
+    std::array<LatencyHistogram, NUM_OPS> _histograms;
+    std::atomic<int> _running {0};
+    std::atomic<int64_t> _last_report_ns {0};
+    std::atomic<uint64_t> _interval_ops {0};
+    std::atomic<uint64_t> _interval_bytes {0};
+};
+
+} // namespace doris::io
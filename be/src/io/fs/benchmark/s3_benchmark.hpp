@@ -19,6 +19,7 @@
 
 #include "io/file_factory.h"
 #include "io/fs/benchmark/base_benchmark.h"
+#include "io/fs/benchmark/mixed_benchmark.hpp"
 #include "io/fs/buffered_reader.h"
 #include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
@@ -242,4 +243,22 @@ public:
     }
 };
 
+class S3MixedBenchmark : public MixedBenchmark {
+public:
+    S3MixedBenchmark(int threads, int iterations, size_t file_size,
+                     const std::map<std::string, std::string>& conf_map)
+            : MixedBenchmark("S3MixedBenchmark", threads, iterations, file_size, conf_map) {}
+    ~S3MixedBenchmark() override = default;
+
+    Status get_fs(const std::string& path, std::shared_ptr<FileSystem>* fs) override {
+        S3URI s3_uri(path);
+        RETURN_IF_ERROR(s3_uri.parse());
+        S3Conf s3_conf;
+        RETURN_IF_ERROR(
+                S3ClientFactory::convert_properties_to_s3_conf(_conf_map, s3_uri, &s3_conf));
+        *fs = DORIS_TRY(io::S3FileSystem::create(std::move(s3_conf), io::FileSystem::TMP_FS_ID));
+        return Status::OK();
+    }
+};
+
 } // namespace doris::io
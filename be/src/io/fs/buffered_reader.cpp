@@ -971,5 +971,125 @@ void RangeCacheFileReader::_collect_profile_before_close() {
     }
 }
 
+RangePrefetchFileReader::RangePrefetchFileReader(RuntimeProfile* profile,
+                                                 io::FileReaderSPtr inner_reader,
+                                                 io::FileReaderSPtr fallback_reader,
+                                                 std::vector<io::PrefetchRange> ranges)
+        : _profile(profile),
+          _inner_reader(std::move(inner_reader)),
+          _fallback_reader(std::move(fallback_reader)) {
+    _ranges.resize(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        DCHECK(i == 0 || ranges[i - 1].end_offset <= ranges[i].start_offset);
+        _ranges[i].range = ranges[i];
+        _prefetch_bytes += ranges[i].end_offset - ranges[i].start_offset;
+    }
+    if (_profile != nullptr) {
+        const char* prefetch_profile = "RangePrefetchFileReader";
+        ADD_TIMER_WITH_LEVEL(_profile, prefetch_profile, 1);
+        _prefetch_bytes_counter = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "PrefetchBytes",
+                                                               TUnit::BYTES, prefetch_profile, 1);
+        _hit_bytes_counter = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "PrefetchHitBytes",
+                                                          TUnit::BYTES, prefetch_profile, 1);
+        _wait_timer = ADD_CHILD_TIMER_WITH_LEVEL(_profile, "PrefetchWaitTime", prefetch_profile, 1);
+    }
+}
+
+RangePrefetchFileReader::~RangePrefetchFileReader() {
+    // the reads in flight write to the ranges
+    _wait_all();
+}
+
+void RangePrefetchFileReader::prefetch(const IOContext* io_ctx) {
+    for (auto& range : _ranges) {
+        // allocated by the query thread, so the memory is charged to the query
+        range.data = std::make_unique_for_overwrite<char[]>(range.range.end_offset -
+                                                            range.range.start_offset);
+        {
+            std::lock_guard lock(_lock);
+            ++_pending;
+        }
+        Status st = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->submit_func(
+                [this, range_ptr = &range, io_ctx]() { _read_range(range_ptr, io_ctx); });
+        if (!st.ok()) {
+            // read on demand
+            std::lock_guard lock(_lock);
+            --_pending;
+            range.data.reset();
+            range.status = st;
+            range.done = true;
+        }
+    }
+}
+
+void RangePrefetchFileReader::_read_range(Range* range, const IOContext* io_ctx) {
+    size_t size = range->range.end_offset - range->range.start_offset;
+    size_t bytes_read = 0;
+    Status st = _inner_reader->read_at(range->range.start_offset, Slice(range->data.get(), size),
+                                       &bytes_read, io_ctx);
+    if (st.ok() && bytes_read != size) {
+        st = Status::InternalError("prefetched {} bytes at {} of {}, only {} bytes are read", size,
+                                   range->range.start_offset, path().native(), bytes_read);
+    }
+    std::lock_guard lock(_lock);
+    range->status = std::move(st);
+    range->done = true;
+    --_pending;
+    _range_done.notify_all();
+}
+
+void RangePrefetchFileReader::_wait_all() {
+    std::unique_lock lock(_lock);
+    _range_done.wait(lock, [this]() { return _pending == 0; });
+}
+
+Status RangePrefetchFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                                             const IOContext* io_ctx) {
+    auto it = std::upper_bound(_ranges.begin(), _ranges.end(), offset,
+                               [](size_t off, const Range& range) {
+                                   return off < range.range.start_offset;
+                               });
+    if (it != _ranges.begin()) {
+        Range& range = *(--it);
+        if (offset + result.size <= range.range.end_offset && range.data != nullptr) {
+            {
+                SCOPED_RAW_TIMER(&_wait_time);
+                std::unique_lock lock(_lock);
+                _range_done.wait(lock, [&range]() { return range.done; });
+            }
+            if (range.status.ok()) {
+                memcpy(result.data, range.data.get() + (offset - range.range.start_offset),
+                       result.size);
+                *bytes_read = result.size;
+                _hit_bytes += result.size;
+                return Status::OK();
+            }
+            // the prefetching may fail by a transient error, the fallback reader retries
+            LOG(INFO) << "failed to prefetch " << path().native() << ": " << range.status;
+            range.data.reset();
+        }
+    }
+    return _fallback_reader->read_at(offset, result, bytes_read, io_ctx);
+}
+
+Status RangePrefetchFileReader::close() {
+    if (!_closed) {
+        _wait_all();
+        _closed = true;
+    }
+    return Status::OK();
+}
+
+void RangePrefetchFileReader::_collect_profile_before_close() {
+    if (_profile != nullptr) {
+        COUNTER_UPDATE(_prefetch_bytes_counter, _prefetch_bytes);
+        COUNTER_UPDATE(_hit_bytes_counter, _hit_bytes);
+        COUNTER_UPDATE(_wait_timer, _wait_time);
+        if (_fallback_reader != nullptr) {
+            _fallback_reader->collect_profile_before_close();
+        }
+    }
+}
+
 } // namespace io
 } // namespace doris
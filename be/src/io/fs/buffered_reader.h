@@ -602,6 +602,69 @@ private:
     bool _closed = false;
 };
 
+/**
+ * A file reader that reads the given ranges asynchronously before they are used, such as the
+ * column chunks of the next row groups of a parquet file, so their IO overlaps with decoding.
+ * A read within a range waits for its prefetching and is served from memory, the other reads
+ * are passed to the fallback reader. The ranges must be sorted and not overlap.
+ */
+class RangePrefetchFileReader final : public io::FileReader {
+public:
+    RangePrefetchFileReader(RuntimeProfile* profile, io::FileReaderSPtr inner_reader,
+                            io::FileReaderSPtr fallback_reader,
+                            std::vector<io::PrefetchRange> ranges);
+
+    ~RangePrefetchFileReader() override;
+
+    // Submit the reads of the ranges, io_ctx must outlive the reader.
+    void prefetch(const IOContext* io_ctx);
+
+    // The bytes held by the ranges.
+    size_t prefetch_bytes() const { return _prefetch_bytes; }
+
+    Status close() override;
+
+    const io::Path& path() const override { return _inner_reader->path(); }
+
+    size_t size() const override { return _inner_reader->size(); }
+
+    bool closed() const override { return _closed; }
+
+protected:
+    Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                        const IOContext* io_ctx) override;
+
+    void _collect_profile_before_close() override;
+
+private:
+    struct Range {
+        io::PrefetchRange range;
+        std::unique_ptr<char[]> data;
+        Status status;
+        bool done = false;
+    };
+
+    void _read_range(Range* range, const IOContext* io_ctx);
+    void _wait_all();
+
+    RuntimeProfile* _profile = nullptr;
+    io::FileReaderSPtr _inner_reader;
+    io::FileReaderSPtr _fallback_reader;
+    std::vector<Range> _ranges;
+    size_t _prefetch_bytes = 0;
+    bool _closed = false;
+
+    std::mutex _lock;
+    std::condition_variable _range_done;
+    int _pending = 0;
+
+    int64_t _hit_bytes = 0;
+    int64_t _wait_time = 0;
+    RuntimeProfile::Counter* _prefetch_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _hit_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _wait_timer = nullptr;
+};
+
 /**
  * Load all the needed data in underlying buffer, so the caller does not need to prepare the data container.
  */
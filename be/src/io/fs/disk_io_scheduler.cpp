@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "io/fs/disk_io_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris::io {
+
+static constexpr int64_t ADJUST_INTERVAL_US = 100 * 1000;
+static constexpr double LATENCY_SMOOTHING = 0.2;
+
+DiskIOScheduler* DiskIOScheduler::instance() {
+    static DiskIOScheduler scheduler;
+    return &scheduler;
+}
+
+DiskIOScheduler::DiskState* DiskIOScheduler::_disk(const std::string& data_dir) {
+    {
+        std::shared_lock rlock(_lock);
+        auto it = _disks.find(data_dir);
+        if (it != _disks.end()) {
+            return it->second.get();
+        }
+    }
+    std::unique_lock wlock(_lock);
+    auto& disk = _disks[data_dir];
+    if (disk == nullptr) {
+        disk = std::make_unique<DiskState>();
+        disk->rate = std::max<int64_t>(config::background_disk_io_max_bytes_per_second, 1);
+        // a new disk starts with the burst of an idle one
+        disk->tokens = static_cast<double>(disk->rate);
+        disk->last_refill_us = MonotonicMicros();
+        disk->last_adjust_us = disk->last_refill_us;
+    }
+    return disk.get();
+}
+
+void DiskIOScheduler::_adjust(DiskState* disk, int64_t now_us) {
+    if (now_us - disk->last_adjust_us < ADJUST_INTERVAL_US) {
+        return;
+    }
+    disk->last_adjust_us = now_us;
+    int64_t max_rate = std::max<int64_t>(config::background_disk_io_max_bytes_per_second, 1);
+    int64_t min_rate = std::clamp<int64_t>(config::background_disk_io_min_bytes_per_second, 1,
+                                           max_rate);
+    bool idle = now_us - disk->last_foreground_io_us >
+                config::background_disk_io_idle_ms * MICROS_PER_MILLI;
+    if (idle) {
+        disk->rate = max_rate;
+    } else if (disk->foreground_latency_us >
+               static_cast<double>(config::background_disk_io_target_read_latency_us)) {
+        disk->rate = std::max(min_rate, disk->rate / 2);
+    } else {
+        disk->rate = std::min(max_rate, disk->rate + max_rate / 10);
+    }
+    disk->rate = std::clamp(disk->rate, min_rate, max_rate);
+}
+
+void DiskIOScheduler::record_foreground_io(const std::string& data_dir, int64_t latency_us) {
+    if (!config::enable_background_disk_io_throttle || data_dir.empty()) {
+        return;
+    }
+    DiskState* disk = _disk(data_dir);
+    std::lock_guard lock(disk->lock);
+    int64_t now_us = MonotonicMicros();
+    if (now_us - disk->last_foreground_io_us >
+        config::background_disk_io_idle_ms * MICROS_PER_MILLI) {
+        // the latency measured before the disk went idle is stale
+        disk->foreground_latency_us = static_cast<double>(latency_us);
+    } else {
+        disk->foreground_latency_us += LATENCY_SMOOTHING * (static_cast<double>(latency_us) -
+                                                            disk->foreground_latency_us);
+    }
+    disk->last_foreground_io_us = now_us;
+}
+
+void DiskIOScheduler::acquire_background_io(const std::string& data_dir, int64_t bytes) {
+    if (!config::enable_background_disk_io_throttle || data_dir.empty() || bytes <= 0) {
+        return;
+    }
+    DiskState* disk = _disk(data_dir);
+    int64_t wait_us = 0;
+    {
+        std::lock_guard lock(disk->lock);
+        int64_t now_us = MonotonicMicros();
+        _adjust(disk, now_us);
+        bool idle = now_us - disk->last_foreground_io_us >
+                    config::background_disk_io_idle_ms * MICROS_PER_MILLI;
+        // an idle disk allows a burst of a second, a busy one the IO of an adjust interval
+        double capacity = idle ? static_cast<double>(disk->rate)
+                               : static_cast<double>(disk->rate) * ADJUST_INTERVAL_US /
+                                         MICROS_PER_SEC;
+        double refill = static_cast<double>(now_us - disk->last_refill_us) *
+                        static_cast<double>(disk->rate) / MICROS_PER_SEC;
+        disk->tokens = std::min(capacity, disk->tokens + refill);
+        disk->last_refill_us = now_us;
+        // the bytes are taken at once, the caller waits until the debt is paid back
+        disk->tokens -= static_cast<double>(bytes);
+        if (disk->tokens < 0) {
+            wait_us = static_cast<int64_t>(-disk->tokens * MICROS_PER_SEC / disk->rate);
+        }
+    }
+    if (wait_us > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+    }
+}
+
+int64_t DiskIOScheduler::background_rate(const std::string& data_dir) {
+    if (!config::enable_background_disk_io_throttle || data_dir.empty()) {
+        return -1;
+    }
+    DiskState* disk = _disk(data_dir);
+    std::lock_guard lock(disk->lock);
+    _adjust(disk, MonotonicMicros());
+    return disk->rate;
+}
+
+} // namespace doris::io
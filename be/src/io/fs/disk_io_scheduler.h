@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "io/io_common.h"
+
+namespace doris::io {
+
+// Limits the IO of background work, i.e. compaction and schema change, on each data dir with a
+// token bucket. Foreground reads are never blocked, their latency is measured instead: the
+// background rate is halved while it is above background_disk_io_target_read_latency_us and grows
+// back otherwise. When the disk has no foreground reads, the background work runs at the max rate
+// and may burst a second of it.
+class DiskIOScheduler {
+public:
+    static DiskIOScheduler* instance();
+
+    static bool is_background(ReaderType reader_type) {
+        return reader_type != ReaderType::READER_QUERY && reader_type != ReaderType::UNKNOWN;
+    }
+
+    // Record a foreground read on data_dir which took latency_us.
+    void record_foreground_io(const std::string& data_dir, int64_t latency_us);
+
+    // Take bytes of background IO on data_dir, waiting until the bucket has them.
+    void acquire_background_io(const std::string& data_dir, int64_t bytes);
+
+    // The current background rate of data_dir in bytes per second, -1 if it is not throttled.
+    int64_t background_rate(const std::string& data_dir);
+
+private:
+    struct DiskState {
+        std::mutex lock;
+        int64_t rate = 0;
+        double tokens = 0;
+        int64_t last_refill_us = 0;
+        int64_t last_adjust_us = 0;
+        int64_t last_foreground_io_us = 0;
+        // moving average of the foreground read latency
+        double foreground_latency_us = 0;
+    };
+
+    DiskState* _disk(const std::string& data_dir);
+
+    // Adapt the rate to the foreground latency, called with the lock of disk held.
+    static void _adjust(DiskState* disk, int64_t now_us);
+
+    std::shared_mutex _lock;
+    std::unordered_map<std::string, std::unique_ptr<DiskState>> _disks;
+};
+
+} // namespace doris::io
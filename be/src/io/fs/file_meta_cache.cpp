@@ -17,15 +17,23 @@
 
 #include "io/fs/file_meta_cache.h"
 
+#include <fmt/format.h>
+
+#include "io/fs/file_reader.h"
+#include "vec/exec/format/parquet/vparquet_file_metadata.h"
 #include "vec/exec/format/parquet/parquet_thrift_util.h"
 
 namespace doris {
 
+std::string FileMetaCache::get_key(const io::FileReaderSPtr& file_reader, int64_t mtime) {
+    return fmt::format("{}:{}:{}", file_reader->path().native(), mtime, file_reader->size());
+}
+
 Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
                                          int64_t mtime, size_t* meta_size,
                                          ObjLRUCache::CacheHandle* handle) {
     ObjLRUCache::CacheHandle cache_handle;
-    std::string cache_key = file_reader->path().native() + std::to_string(mtime);
+    std::string cache_key = get_key(file_reader, mtime);
     auto hit_cache = _cache.lookup({cache_key}, &cache_handle);
     if (hit_cache) {
         *handle = std::move(cache_handle);
@@ -33,10 +41,37 @@ Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOC
     } else {
         vectorized::FileMetaData* meta = nullptr;
         RETURN_IF_ERROR(vectorized::parse_thrift_footer(file_reader, &meta, meta_size, io_ctx));
-        _cache.insert({cache_key}, meta, handle);
+        _cache.insert({cache_key}, meta, handle, meta->get_mem_size());
     }
 
     return Status::OK();
 }
 
+Status FileMetaCache::read_meta_range(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
+                                      int64_t mtime, size_t offset, size_t size,
+                                      ObjLRUCache::CacheHandle* handle, Slice* data,
+                                      size_t* bytes_read) {
+    DCHECK(_range_cache_enabled);
+    std::string key = fmt::format("{}:{}:{}", get_key(file_reader, mtime), offset, size);
+    *bytes_read = 0;
+    auto* lru_handle = _range_cache->lookup(key);
+    if (lru_handle == nullptr) {
+        auto bytes = std::make_unique<std::string>();
+        bytes->resize(size);
+        RETURN_IF_ERROR(file_reader->read_at(offset, Slice(bytes->data(), size), bytes_read,
+                                             io_ctx));
+        if (*bytes_read != size) {
+            return Status::IOError("read {} bytes at {} of {}, only {} bytes are read", size,
+                                   offset, file_reader->path().native(), *bytes_read);
+        }
+        auto* value = new ObjLRUCache::ObjValue<std::string>(bytes.release());
+        // the handle is valid even if the admission rejects it, the bytes are released with it
+        lru_handle = _range_cache->insert(key, value, size, size, CachePriority::NORMAL);
+    }
+    *handle = ObjLRUCache::CacheHandle(_range_cache.get(), lru_handle);
+    const auto* bytes = static_cast<const std::string*>(handle->data<std::string>());
+    *data = Slice(bytes->data(), bytes->size());
+    return Status::OK();
+}
+
 } // namespace doris
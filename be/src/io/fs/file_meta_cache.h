@@ -17,23 +17,52 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include "io/fs/file_reader_writer_fwd.h"
 #include "util/obj_lru_cache.h"
+#include "util/slice.h"
 
 namespace doris {
+namespace io {
+struct IOContext;
+} // namespace io
+
+// The byte ranges of the metadata of external files which are read by each query, such as the
+// page indexes of parquet row groups. It's charged by the bytes, and with TinyLFU admission a
+// scan over a large table doesn't flush the ranges of the hot files.
+class FileMetaRangeCache : public LRUCachePolicy {
+public:
+    FileMetaRangeCache(size_t capacity)
+            : LRUCachePolicy(CachePolicy::CacheType::FILE_META_RANGE_CACHE, capacity,
+                             LRUCacheType::SIZE, config::common_obj_lru_cache_stale_sweep_time_sec,
+                             DEFAULT_LRU_CACHE_NUM_SHARDS, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY,
+                             true, DEFAULT_LRU_CACHE_IS_LRU_K,
+                             config::file_meta_range_cache_enable_tiny_lfu) {}
+};
 
 // A file meta cache depends on a LRU cache.
 // Such as parsed parquet footer.
 // The capacity will limit the number of cache entries in cache.
 class FileMetaCache {
 public:
-    FileMetaCache(int64_t capacity) : _cache(capacity) {}
+    FileMetaCache(int64_t capacity, int64_t range_capacity_bytes = 0)
+            : _cache(capacity), _range_cache_enabled(range_capacity_bytes > 0) {
+        if (_range_cache_enabled) {
+            _range_cache = std::make_unique<FileMetaRangeCache>(range_capacity_bytes);
+        }
+    }
 
     FileMetaCache(const FileMetaCache&) = delete;
     const FileMetaCache& operator=(const FileMetaCache&) = delete;
 
     ObjLRUCache& cache() { return _cache; }
 
+    // A file rewritten at the same path has another mtime or size, mtime may be 0 if the
+    // file system doesn't provide it.
+    static std::string get_key(const io::FileReaderSPtr& file_reader, int64_t mtime);
+
     Status get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
                               size_t* meta_size, ObjLRUCache::CacheHandle* handle);
 
@@ -42,8 +71,19 @@ public:
         return Status::OK();
     }
 
+    bool range_cache_enabled() const { return _range_cache_enabled; }
+
+    // Read [offset, offset + size) of the file through the range cache, it must be enabled.
+    // *data points to the bytes held by *handle, *bytes_read is the bytes read from the file,
+    // 0 if it's a hit.
+    Status read_meta_range(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
+                           size_t offset, size_t size, ObjLRUCache::CacheHandle* handle,
+                           Slice* data, size_t* bytes_read);
+
 private:
     ObjLRUCache _cache;
+    bool _range_cache_enabled;
+    std::unique_ptr<FileMetaRangeCache> _range_cache;
 };
 
 } // namespace doris
@@ -30,6 +30,20 @@ namespace doris::io {
 class FileSystem;
 struct FileCacheAllocatorBuilder;
 
+// How a local file writer treats the OS page cache
+enum class PageCacheMode : uint8_t {
+    // write through the page cache
+    CACHED = 0,
+    // write through the page cache, and evict the pages once they are written back
+    DROP_BEHIND,
+    // O_DIRECT with aligned buffers, DROP_BEHIND if the file system doesn't support it
+    DIRECT,
+};
+
+// The mode of the local writes of compaction, schema change and spill, by
+// config::background_write_page_cache_mode.
+PageCacheMode background_write_page_cache_mode();
+
 // Only affects remote file writers
 struct FileWriterOptions {
     // S3 committer will start multipart uploading all files on BE side,
@@ -44,6 +58,11 @@ struct FileWriterOptions {
     bool is_cold_data = false;
     bool sync_file_data = true;         // Whether flush data into storage system
     uint64_t file_cache_expiration = 0; // Absolute time
+    // Whether the writes are background IO of compaction or schema change, limited by the
+    // DiskIOScheduler of local disks
+    bool background_io = false;
+    // Only affects local file writers
+    PageCacheMode page_cache_mode = PageCacheMode::CACHED;
 };
 
 struct AsyncCloseStatusPack {
@@ -135,6 +135,8 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
     }
 
     LIMIT_REMOTE_SCAN_IO(bytes_read);
+    SCOPED_RECORD_READ_TIER(doris::IOContext::ReadTier::REMOTE_STORAGE, bytes_read);
+    SCOPED_HISTOGRAM_LATENCY_US(DorisMetrics::instance()->hdfs_file_read_latency_us);
 
     size_t has_read = 0;
     while (has_read < bytes_req) {
@@ -201,6 +203,8 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
     }
 
     LIMIT_REMOTE_SCAN_IO(bytes_read);
+    SCOPED_RECORD_READ_TIER(doris::IOContext::ReadTier::REMOTE_STORAGE, bytes_read);
+    SCOPED_HISTOGRAM_LATENCY_US(DorisMetrics::instance()->hdfs_file_read_latency_us);
 
     size_t has_read = 0;
     while (has_read < bytes_req) {
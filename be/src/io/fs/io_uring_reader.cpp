@@ -0,0 +1,236 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "io/fs/io_uring_reader.h"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "common/config.h"
+#include "common/logging.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define DORIS_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace doris::io {
+
+namespace {
+// set once creating a ring failed, io_uring isn't tried again then
+std::atomic<bool> s_unsupported {false};
+} // namespace
+
+IOUringReader::~IOUringReader() {
+#ifdef DORIS_HAS_IO_URING
+    if (_sqes != nullptr) {
+        munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ptr != nullptr && _cq_ptr != _sq_ptr) {
+        munmap(_cq_ptr, _cq_size);
+    }
+    if (_sq_ptr != nullptr) {
+        munmap(_sq_ptr, _sq_size);
+    }
+    if (_ring_fd >= 0) {
+        close(_ring_fd);
+    }
+#endif
+}
+
+bool IOUringReader::is_supported() {
+#ifdef DORIS_HAS_IO_URING
+    return !s_unsupported.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif
+}
+
+Status IOUringReader::_init(unsigned entries) {
+#ifdef DORIS_HAS_IO_URING
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    _ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (_ring_fd < 0) {
+        return Status::IOError("failed to setup io_uring: {}", strerror(errno));
+    }
+    _entries = params.sq_entries;
+    _sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    _cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        _sq_size = _cq_size = std::max(_sq_size, _cq_size);
+    }
+    _sq_ptr = mmap(nullptr, _sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd,
+                   IORING_OFF_SQ_RING);
+    if (_sq_ptr == MAP_FAILED) {
+        _sq_ptr = nullptr;
+        return Status::IOError("failed to mmap the io_uring sq: {}", strerror(errno));
+    }
+    if (single_mmap) {
+        _cq_ptr = _sq_ptr;
+    } else {
+        _cq_ptr = mmap(nullptr, _cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       _ring_fd, IORING_OFF_CQ_RING);
+        if (_cq_ptr == MAP_FAILED) {
+            _cq_ptr = nullptr;
+            return Status::IOError("failed to mmap the io_uring cq: {}", strerror(errno));
+        }
+    }
+    _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    _sqes = mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd,
+                 IORING_OFF_SQES);
+    if (_sqes == MAP_FAILED) {
+        _sqes = nullptr;
+        return Status::IOError("failed to mmap the io_uring sqes: {}", strerror(errno));
+    }
+    auto* sq = static_cast<char*>(_sq_ptr);
+    _sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    _sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    _sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    _sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto* cq = static_cast<char*>(_cq_ptr);
+    _cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    _cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    _cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    _cqes = cq + params.cq_off.cqes;
+    return Status::OK();
+#else
+    return Status::NotSupported("io_uring is not supported");
+#endif
+}
+
+Status IOUringReader::_read(IOUringReadRequest* requests, size_t num) {
+#ifdef DORIS_HAS_IO_URING
+    DCHECK_LE(num, _entries);
+    std::vector<iovec> iovecs(num);
+    auto* sqes = static_cast<io_uring_sqe*>(_sqes);
+    // this thread is the only producer of the sq and the only consumer of the cq
+    unsigned tail = *_sq_tail;
+    for (size_t i = 0; i < num; ++i) {
+        iovecs[i].iov_base = requests[i].buffer.data;
+        iovecs[i].iov_len = requests[i].buffer.size;
+        unsigned index = tail & *_sq_mask;
+        io_uring_sqe* sqe = &sqes[index];
+        memset(sqe, 0, sizeof(*sqe));
+        // READV rather than READ, which needs 5.6
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = requests[i].fd;
+        sqe->addr = reinterpret_cast<uint64_t>(&iovecs[i]);
+        sqe->len = 1;
+        sqe->off = requests[i].offset;
+        sqe->user_data = i;
+        _sq_array[index] = index;
+        ++tail;
+    }
+    __atomic_store_n(_sq_tail, tail, __ATOMIC_RELEASE);
+
+    size_t completed = 0;
+    while (completed < num) {
+        unsigned to_submit = tail - __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE);
+        long ret = syscall(__NR_io_uring_enter, _ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS,
+                           nullptr, 0);
+        if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            // The submitted reads may still write the buffers, nothing is safe but waiting
+            // for them, which the errno tells us we can't.
+            LOG(FATAL) << "failed to enter io_uring: " << strerror(errno);
+        }
+        unsigned head = *_cq_head;
+        auto* cqes = static_cast<io_uring_cqe*>(_cqes);
+        while (head != __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE)) {
+            const io_uring_cqe& cqe = cqes[head & *_cq_mask];
+            auto& request = requests[cqe.user_data];
+            if (cqe.res < 0) {
+                request.status = Status::IOError("failed to read by io_uring: {}",
+                                                 strerror(-cqe.res));
+            } else {
+                request.bytes_read = cqe.res;
+                request.status = Status::OK();
+            }
+            ++head;
+            ++completed;
+        }
+        __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+    }
+    return Status::OK();
+#else
+    return Status::NotSupported("io_uring is not supported");
+#endif
+}
+
+IOUringReader* IOUringReader::_thread_local_reader() {
+    thread_local std::unique_ptr<IOUringReader> reader;
+    thread_local bool failed = false;
+    if (reader == nullptr && !failed && is_supported()) {
+        std::unique_ptr<IOUringReader> new_reader(new IOUringReader());
+        Status st = new_reader->_init(config::io_uring_queue_depth);
+        if (st.ok()) {
+            reader = std::move(new_reader);
+        } else {
+            LOG(WARNING) << "io_uring is not available, read by pread instead. st=" << st;
+            failed = true;
+            s_unsupported = true;
+        }
+    }
+    return reader.get();
+}
+
+void IOUringReader::_pread(IOUringReadRequest* request) {
+    request->bytes_read = 0;
+    while (request->bytes_read < request->buffer.size) {
+        ssize_t res = ::pread(request->fd, request->buffer.data + request->bytes_read,
+                              request->buffer.size - request->bytes_read,
+                              request->offset + request->bytes_read);
+        if (res < 0 && errno == EINTR) {
+            continue;
+        }
+        if (res < 0) {
+            request->status = Status::IOError("failed to read: {}", strerror(errno));
+            return;
+        }
+        if (res == 0) {
+            break;
+        }
+        request->bytes_read += res;
+    }
+    request->status = Status::OK();
+}
+
+void IOUringReader::read(std::vector<IOUringReadRequest>* requests) {
+    IOUringReader* reader = requests->size() > 1 ? _thread_local_reader() : nullptr;
+    if (reader == nullptr) {
+        for (auto& request : *requests) {
+            _pread(&request);
+        }
+        return;
+    }
+    for (size_t begin = 0; begin < requests->size(); begin += reader->_entries) {
+        size_t num = std::min<size_t>(reader->_entries, requests->size() - begin);
+        static_cast<void>(reader->_read(requests->data() + begin, num));
+    }
+}
+
+} // namespace doris::io
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/status.h"
+#include "util/slice.h"
+
+namespace doris::io {
+
+struct IOUringReadRequest {
+    int fd = -1;
+    size_t offset = 0;
+    Slice buffer;
+    size_t bytes_read = 0;
+    Status status;
+};
+
+// Reads a batch of local files with io_uring, so a thread keeps all the reads of the batch in
+// flight instead of waiting for them one by one. Each thread owns a ring, created on its first
+// batch. Without io_uring support, i.e. a kernel before 5.1 or a seccomp policy forbidding it,
+// the requests are read by pread one after another.
+class IOUringReader {
+public:
+    ~IOUringReader();
+
+    // Read every request, the status of each is set in place. A short read is not an error,
+    // bytes_read tells it.
+    static void read(std::vector<IOUringReadRequest>* requests);
+
+    static bool is_supported();
+
+private:
+    IOUringReader() = default;
+
+    Status _init(unsigned entries);
+
+    // read at most _entries requests
+    Status _read(IOUringReadRequest* requests, size_t num);
+
+    static IOUringReader* _thread_local_reader();
+
+    static void _pread(IOUringReadRequest* request);
+
+    int _ring_fd = -1;
+    unsigned _entries = 0;
+    void* _sq_ptr = nullptr;
+    size_t _sq_size = 0;
+    void* _cq_ptr = nullptr;
+    size_t _cq_size = 0;
+    void* _sqes = nullptr;
+    size_t _sqes_size = 0;
+    unsigned* _sq_head = nullptr;
+    unsigned* _sq_tail = nullptr;
+    unsigned* _sq_mask = nullptr;
+    unsigned* _sq_array = nullptr;
+    unsigned* _cq_head = nullptr;
+    unsigned* _cq_tail = nullptr;
+    unsigned* _cq_mask = nullptr;
+    void* _cqes = nullptr;
+};
+
+} // namespace doris::io
@@ -33,6 +33,7 @@
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "cpp/sync_point.h"
+#include "io/fs/disk_io_scheduler.h"
 #include "io/fs/err_utils.h"
 #include "olap/data_dir.h"
 #include "olap/olap_common.h"
@@ -42,6 +43,7 @@
 #include "util/async_io.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
+#include "util/time.h"
 
 namespace doris {
 namespace io {
@@ -125,7 +127,7 @@ Status LocalFileReader::close() {
 }
 
 Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                     const IOContext* /*io_ctx*/) {
+                                     const IOContext* io_ctx) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileReader::read_at_impl",
                                       Status::IOError("inject io error"));
     if (closed()) [[unlikely]] {
@@ -143,6 +145,11 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
     *bytes_read = 0;
 
     LIMIT_LOCAL_SCAN_IO(get_data_dir_path(), bytes_read);
+    SCOPED_RECORD_READ_TIER(doris::IOContext::ReadTier::LOCAL_DISK, bytes_read);
+    if (io_ctx != nullptr && DiskIOScheduler::is_background(io_ctx->reader_type)) {
+        DiskIOScheduler::instance()->acquire_background_io(_data_dir_path, bytes_req);
+    }
+    int64_t start_us = MonotonicMicros();
 
     while (bytes_req != 0) {
         auto res = SYNC_POINT_HOOK_RETURN_VALUE(::pread(_fd, to, bytes_req, offset),
@@ -169,6 +176,11 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
             *bytes_read += res;
         }
     }
+    int64_t read_us = MonotonicMicros() - start_us;
+    if (io_ctx != nullptr && io_ctx->reader_type == ReaderType::READER_QUERY) {
+        DiskIOScheduler::instance()->record_foreground_io(_data_dir_path, read_us);
+    }
+    DorisMetrics::instance()->local_file_read_latency_us->add(read_us);
     DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
     return Status::OK();
 }
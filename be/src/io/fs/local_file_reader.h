@@ -62,6 +62,8 @@ public:
 
     const std::string& get_data_dir_path() override { return _data_dir_path; }
 
+    int fd() const { return _fd; }
+
 private:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
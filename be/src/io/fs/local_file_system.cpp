@@ -60,7 +60,25 @@ Status LocalFileSystem::create_file_impl(const Path& file, FileWriterPtr* writer
                << ", sync_data: " << (opts ? opts->sync_file_data : true);
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileSystem::create_file_impl",
                                       Status::IOError("inject io error"));
-    int fd = ::open(file.c_str(), O_TRUNC | O_WRONLY | O_CREAT | O_CLOEXEC, 0666);
+    int flags = O_TRUNC | O_WRONLY | O_CREAT | O_CLOEXEC;
+    PageCacheMode page_cache_mode = opts != nullptr ? opts->page_cache_mode : PageCacheMode::CACHED;
+#if defined(__linux__)
+    if (page_cache_mode == PageCacheMode::DIRECT) {
+        flags |= O_DIRECT;
+    }
+#else
+    if (page_cache_mode == PageCacheMode::DIRECT) {
+        page_cache_mode = PageCacheMode::DROP_BEHIND;
+    }
+#endif
+    int fd = ::open(file.c_str(), flags, 0666);
+#if defined(__linux__)
+    if (-1 == fd && errno == EINVAL && page_cache_mode == PageCacheMode::DIRECT) {
+        // the file system doesn't support O_DIRECT, such as tmpfs
+        page_cache_mode = PageCacheMode::DROP_BEHIND;
+        fd = ::open(file.c_str(), flags & ~O_DIRECT, 0666);
+    }
+#endif
     DBUG_EXECUTE_IF("LocalFileSystem.create_file_impl.open_file_failed", {
         // spare '.testfile' to make bad disk checker happy
         auto sub_path = dp->param<std::string>("sub_path", "");
@@ -76,7 +94,9 @@ Status LocalFileSystem::create_file_impl(const Path& file, FileWriterPtr* writer
         return localfs_error(errno, fmt::format("failed to create file {}", file.native()));
     }
     bool sync_data = opts != nullptr ? opts->sync_file_data : true;
-    *writer = std::make_unique<LocalFileWriter>(file, fd, sync_data);
+    bool background_io = opts != nullptr && opts->background_io;
+    *writer = std::make_unique<LocalFileWriter>(file, fd, sync_data, background_io,
+                                                page_cache_mode);
     return Status::OK();
 }
 
@@ -25,17 +25,22 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 // IWYU pragma: no_include <opentelemetry/common/threadlocal.h>
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/macros.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
+#include "io/fs/disk_io_scheduler.h"
 #include "io/fs/err_utils.h"
 #include "io/fs/file_writer.h"
+#include "io/fs/local_file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/path.h"
 #include "olap/data_dir.h"
@@ -65,10 +70,89 @@ Status sync_dir(const io::Path& dirname) {
     return Status::OK();
 }
 
+constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+
+// The aligned buffers of the direct IO writers, compaction keeps creating writers.
+class DirectIOBufferPool {
+public:
+    static DirectIOBufferPool* instance() {
+        static auto* pool = new DirectIOBufferPool();
+        return pool;
+    }
+
+    char* acquire(size_t size) {
+        {
+            std::lock_guard lock(_lock);
+            while (!_free_buffers.empty()) {
+                auto [buffer_size, buffer] = _free_buffers.back();
+                _free_buffers.pop_back();
+                if (buffer_size == size) {
+                    return buffer;
+                }
+                // the size is changed by config
+                free(buffer);
+            }
+        }
+        void* buffer = nullptr;
+        if (posix_memalign(&buffer, DIRECT_IO_ALIGNMENT, size) != 0) {
+            return nullptr;
+        }
+        return static_cast<char*>(buffer);
+    }
+
+    void release(char* buffer, size_t size) {
+        std::lock_guard lock(_lock);
+        if (_free_buffers.size() >= MAX_FREE_BUFFERS) {
+            free(buffer);
+            return;
+        }
+        _free_buffers.emplace_back(size, buffer);
+    }
+
+private:
+    static constexpr size_t MAX_FREE_BUFFERS = 64;
+
+    std::mutex _lock;
+    std::vector<std::pair<size_t, char*>> _free_buffers;
+};
+
 } // namespace
 
-LocalFileWriter::LocalFileWriter(Path path, int fd, bool sync_data)
-        : _path(std::move(path)), _fd(fd), _sync_data(sync_data) {
+PageCacheMode background_write_page_cache_mode() {
+    const std::string mode = config::background_write_page_cache_mode;
+    if (mode == "direct") {
+        return PageCacheMode::DIRECT;
+    }
+    if (mode == "drop_behind") {
+        return PageCacheMode::DROP_BEHIND;
+    }
+    return PageCacheMode::CACHED;
+}
+
+LocalFileWriter::LocalFileWriter(Path path, int fd, bool sync_data, bool background_io,
+                                 PageCacheMode page_cache_mode)
+        : _path(std::move(path)),
+          _fd(fd),
+          _sync_data(sync_data),
+          _page_cache_mode(page_cache_mode) {
+    if (background_io) {
+        BeConfDataDirReader::get_data_dir_by_file_path(&_path, &_background_io_data_dir);
+    }
+    if (_page_cache_mode == PageCacheMode::DIRECT) {
+        _direct_buffer_size = config::direct_io_write_buffer_size;
+        _direct_buffer = DirectIOBufferPool::instance()->acquire(_direct_buffer_size);
+        if (_direct_buffer == nullptr) {
+            LOG(WARNING) << "failed to allocate the direct IO buffer of " << _path.native()
+                         << ", write it through the page cache";
+#if defined(__linux__)
+            int flags = fcntl(_fd, F_GETFL);
+            if (flags >= 0) {
+                static_cast<void>(fcntl(_fd, F_SETFL, flags & ~O_DIRECT));
+            }
+#endif
+            _page_cache_mode = PageCacheMode::DROP_BEHIND;
+        }
+    }
     DorisMetrics::instance()->local_file_open_writing->increment(1);
     DorisMetrics::instance()->local_file_writer_total->increment(1);
 }
@@ -84,6 +168,9 @@ LocalFileWriter::~LocalFileWriter() {
     DorisMetrics::instance()->local_file_open_writing->increment(-1);
     DorisMetrics::instance()->file_created_total->increment(1);
     DorisMetrics::instance()->local_bytes_written_total->increment(_bytes_appended);
+    if (_direct_buffer != nullptr) {
+        DirectIOBufferPool::instance()->release(_direct_buffer, _direct_buffer_size);
+    }
 }
 
 Status LocalFileWriter::close(bool non_block) {
@@ -105,6 +192,13 @@ Status LocalFileWriter::close(bool non_block) {
     } else {
         _state = State::CLOSED;
     }
+    if (_page_cache_mode != PageCacheMode::CACHED) {
+        if (Status st = _flush_direct_buffer(true); !st.ok()) {
+            static_cast<void>(_close(false));
+            return st;
+        }
+        _drop_behind(true);
+    }
     return _close(_sync_data);
 }
 
@@ -137,6 +231,37 @@ Status LocalFileWriter::appendv(const Slice* data, size_t data_cnt) {
         iov[i] = {result.data, result.size};
     }
 
+    if (!_background_io_data_dir.empty()) {
+        DiskIOScheduler::instance()->acquire_background_io(_background_io_data_dir, bytes_req);
+    }
+
+    if (_page_cache_mode == PageCacheMode::DIRECT) {
+        for (size_t i = 0; i < data_cnt; i++) {
+            const char* src = data[i].data;
+            size_t left = data[i].size;
+            while (left > 0) {
+                size_t n = std::min(left, _direct_buffer_size - _direct_buffer_used);
+                memcpy(_direct_buffer + _direct_buffer_used, src, n);
+                _direct_buffer_used += n;
+                src += n;
+                left -= n;
+                if (_direct_buffer_used == _direct_buffer_size) {
+                    RETURN_IF_ERROR(_flush_direct_buffer(false));
+                }
+            }
+        }
+    } else {
+        RETURN_IF_ERROR(_writev(iov.data(), data_cnt, bytes_req));
+        _bytes_written += bytes_req;
+        if (_page_cache_mode == PageCacheMode::DROP_BEHIND) {
+            _drop_behind(false);
+        }
+    }
+    _bytes_appended += bytes_req;
+    return Status::OK();
+}
+
+Status LocalFileWriter::_writev(iovec* iov, size_t data_cnt, size_t bytes_req) {
     size_t completed_iov = 0;
     size_t n_left = bytes_req;
     while (n_left > 0) {
@@ -144,7 +269,7 @@ Status LocalFileWriter::appendv(const Slice* data, size_t data_cnt) {
         size_t iov_count = std::min(data_cnt - completed_iov, static_cast<size_t>(IOV_MAX));
         ssize_t res;
         RETRY_ON_EINTR(res, SYNC_POINT_HOOK_RETURN_VALUE(
-                                    ::writev(_fd, iov.data() + completed_iov, iov_count),
+                                    ::writev(_fd, iov + completed_iov, iov_count),
                                     "LocalFileWriter::writev", _fd));
         DBUG_EXECUTE_IF("LocalFileWriter::appendv.io_error", {
             auto sub_path = dp->param<std::string>("sub_path", "");
@@ -182,10 +307,61 @@ Status LocalFileWriter::appendv(const Slice* data, size_t data_cnt) {
         n_left -= res;
     }
     DCHECK_EQ(0, n_left);
-    _bytes_appended += bytes_req;
     return Status::OK();
 }
 
+Status LocalFileWriter::_flush_direct_buffer(bool eof) {
+    if (_direct_buffer_used == 0) {
+        return Status::OK();
+    }
+    size_t aligned = _direct_buffer_used / DIRECT_IO_ALIGNMENT * DIRECT_IO_ALIGNMENT;
+    if (aligned > 0) {
+        iovec iov {_direct_buffer, aligned};
+        RETURN_IF_ERROR(_writev(&iov, 1, aligned));
+    }
+    size_t rest = _direct_buffer_used - aligned;
+    if (rest > 0) {
+        DCHECK(eof);
+#if defined(__linux__)
+        // the tail isn't a full block, it's written through the page cache and evicted on close
+        int flags = fcntl(_fd, F_GETFL);
+        if (flags < 0 || fcntl(_fd, F_SETFL, flags & ~O_DIRECT) < 0) {
+            return localfs_error(errno, fmt::format("failed to clear O_DIRECT {}", _path.native()));
+        }
+#endif
+        iovec iov {_direct_buffer + aligned, rest};
+        RETURN_IF_ERROR(_writev(&iov, 1, rest));
+    }
+    _bytes_written += _direct_buffer_used;
+    _direct_buffer_used = 0;
+    return Status::OK();
+}
+
+void LocalFileWriter::_drop_behind(bool eof) {
+#if defined(__linux__)
+    if (!eof && _bytes_written - _writeback_offset <
+                        static_cast<size_t>(config::drop_behind_write_window_bytes)) {
+        return;
+    }
+    // they are only hints, a failure leaves the pages in the page cache
+    if (_bytes_written > _writeback_offset) {
+        static_cast<void>(sync_file_range(_fd, _writeback_offset,
+                                          _bytes_written - _writeback_offset,
+                                          SYNC_FILE_RANGE_WRITE));
+    }
+    size_t evict_end = eof ? _bytes_written : _writeback_offset;
+    if (evict_end > _dropped_offset) {
+        static_cast<void>(sync_file_range(_fd, _dropped_offset, evict_end - _dropped_offset,
+                                          SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+                                                  SYNC_FILE_RANGE_WAIT_AFTER));
+        static_cast<void>(posix_fadvise(_fd, _dropped_offset, evict_end - _dropped_offset,
+                                        POSIX_FADV_DONTNEED));
+        _dropped_offset = evict_end;
+    }
+    _writeback_offset = _bytes_written;
+#endif
+}
+
 // TODO(ByteYue): Refactor this function as FileWriter::flush()
 Status LocalFileWriter::_finalize() {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileWriter::finalize",
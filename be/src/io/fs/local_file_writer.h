@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <sys/uio.h>
+
 #include <cstddef>
+#include <string>
 
 #include "common/status.h"
 #include "io/fs/file_writer.h"
@@ -28,7 +31,9 @@ namespace doris::io {
 struct FileCacheAllocatorBuilder;
 class LocalFileWriter final : public FileWriter {
 public:
-    LocalFileWriter(Path path, int fd, bool sync_data = true);
+    // fd is opened with O_DIRECT if page_cache_mode is DIRECT.
+    LocalFileWriter(Path path, int fd, bool sync_data = true, bool background_io = false,
+                    PageCacheMode page_cache_mode = PageCacheMode::CACHED);
     ~LocalFileWriter() override;
 
     Status appendv(const Slice* data, size_t data_cnt) override;
@@ -44,12 +49,29 @@ private:
     Status _finalize();
     void _abort();
     Status _close(bool sync);
+    Status _writev(iovec* iov, size_t data_cnt, size_t bytes_req);
+    // Write the full blocks of the direct IO buffer, and the rest too without O_DIRECT if
+    // it's the end of the file.
+    Status _flush_direct_buffer(bool eof);
+    // Start the writeback of the bytes written since the last window, and evict the window
+    // before it, which is waited for so its pages are clean.
+    void _drop_behind(bool eof);
 
     Path _path;
     int _fd; // owned
     bool _dirty = false;
     const bool _sync_data = true;
     size_t _bytes_appended = 0;
+    // the data dir whose background IO limit the writes take, empty if they are not limited
+    std::string _background_io_data_dir;
+    PageCacheMode _page_cache_mode;
+    // the bytes written to fd, the bytes of the direct IO buffer are not
+    size_t _bytes_written = 0;
+    size_t _writeback_offset = 0;
+    size_t _dropped_offset = 0;
+    char* _direct_buffer = nullptr;
+    size_t _direct_buffer_size = 0;
+    size_t _direct_buffer_used = 0;
     State _state {State::OPENED};
 };
 
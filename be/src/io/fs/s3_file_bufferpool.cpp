@@ -19,6 +19,7 @@
 
 #include <bvar/bvar.h>
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 
@@ -53,6 +54,10 @@ struct Memory : boost::noncopyable, Allocator {
         s3_file_buffer_allocated << -1;
     }
     void alloc(size_t size) { _data = static_cast<char*>(Allocator::alloc(size, 0)); }
+    void realloc(size_t size) {
+        _data = static_cast<char*>(Allocator::realloc(_data, _size, size));
+        _size = size;
+    }
     void dealloc() {
         if (_data == nullptr) {
             return;
@@ -66,8 +71,9 @@ struct Memory : boost::noncopyable, Allocator {
 
 struct FileBuffer::PartData {
     Memory<> _memory;
-    PartData() : _memory(config::s3_write_buffer_size) {}
+    explicit PartData(size_t size) : _memory(size) {}
     ~PartData() = default;
+    void reserve(size_t size) { _memory.realloc(size); }
     [[nodiscard]] Slice data() const { return Slice {_memory._data, _memory._size}; }
     [[nodiscard]] size_t size() const { return _memory._size; }
 };
@@ -77,14 +83,15 @@ Slice FileBuffer::get_slice() const {
 }
 
 FileBuffer::FileBuffer(BufferType type, std::function<FileBlocksHolderPtr()> alloc_holder,
-                       size_t offset, OperationState state)
+                       size_t offset, OperationState state, size_t capacity,
+                       size_t reserved_size)
         : _type(type),
           _alloc_holder(std::move(alloc_holder)),
           _offset(offset),
           _size(0),
           _state(std::move(state)),
-          _inner_data(std::make_unique<FileBuffer::PartData>()),
-          _capacity(_inner_data->size()) {}
+          _inner_data(std::make_unique<FileBuffer::PartData>(reserved_size)),
+          _capacity(capacity) {}
 
 FileBuffer::~FileBuffer() {
     SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->s3_file_buffer_tracker());
@@ -98,6 +105,18 @@ FileBuffer::~FileBuffer() {
 Status UploadFileBuffer::append_data(const Slice& data) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("UploadFileBuffer::append_data", Status::OK(), this,
                                       data.get_size());
+    size_t size = _size + data.get_size();
+    if (size > _inner_data->size()) [[unlikely]] {
+        if (size > _capacity) {
+            return Status::InternalError("append {} bytes to upload buffer of {}/{} bytes",
+                                         data.get_size(), _size, _capacity);
+        }
+        // The memory is reserved on demand up to the capacity, it doubles each time so the
+        // data is copied at most once more in amortization.
+        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->s3_file_buffer_tracker());
+        RETURN_IF_CATCH_EXCEPTION(_inner_data->reserve(
+                std::min(_capacity, std::max(size, _inner_data->size() * 2))));
+    }
     std::memcpy((void*)(_inner_data->data().get_data() + _size), data.get_data(), data.get_size());
     _size += data.get_size();
     _crc_value = crc32c::Extend(_crc_value, data.get_data(), data.get_size());
@@ -242,11 +261,14 @@ FileBufferBuilder& FileBufferBuilder::set_allocate_file_blocks_holder(
 Status FileBufferBuilder::build(std::shared_ptr<FileBuffer>* buf) {
     SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->s3_file_buffer_tracker());
     OperationState state(_sync_after_complete_task, _is_cancelled);
+    size_t capacity = _capacity > 0 ? _capacity : config::s3_write_buffer_size;
+    size_t reserved_size = _reserved_size > 0 ? std::min(_reserved_size, capacity) : capacity;
 
     if (_type == BufferType::UPLOAD) {
         RETURN_IF_CATCH_EXCEPTION(*buf = std::make_shared<UploadFileBuffer>(
                                           std::move(_upload_cb), std::move(state), _offset,
-                                          std::move(_alloc_holder_cb)));
+                                          std::move(_alloc_holder_cb), capacity,
+                                          reserved_size));
         return Status::OK();
     }
     if (_type == BufferType::DOWNLOAD) {
@@ -254,7 +276,7 @@ Status FileBufferBuilder::build(std::shared_ptr<FileBuffer>* buf) {
                                           std::move(_download),
                                           std::move(_write_to_local_file_cache),
                                           std::move(_write_to_use_buffer), std::move(state),
-                                          _offset, std::move(_alloc_holder_cb)));
+                                          _offset, std::move(_alloc_holder_cb), capacity));
         return Status::OK();
     }
     // should never come here
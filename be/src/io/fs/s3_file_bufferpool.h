@@ -77,7 +77,7 @@ struct OperationState {
 
 struct FileBuffer {
     FileBuffer(BufferType type, std::function<FileBlocksHolderPtr()> alloc_holder, size_t offset,
-               OperationState state);
+               OperationState state, size_t capacity, size_t reserved_size);
     virtual ~FileBuffer();
     /**
     * submit the correspoding task to async executor
@@ -126,6 +126,7 @@ struct FileBuffer {
     OperationState _state;
     struct PartData;
     std::unique_ptr<PartData> _inner_data;
+    // the max bytes of the buffer, the memory may be reserved on demand
     size_t _capacity;
 };
 
@@ -133,8 +134,9 @@ struct DownloadFileBuffer final : public FileBuffer {
     DownloadFileBuffer(std::function<Status(Slice&)> download,
                        std::function<void(FileBlocksHolderPtr, Slice)> write_to_cache,
                        std::function<void(Slice, size_t)> write_to_use_buffer, OperationState state,
-                       size_t offset, std::function<FileBlocksHolderPtr()> alloc_holder)
-            : FileBuffer(BufferType::DOWNLOAD, alloc_holder, offset, state),
+                       size_t offset, std::function<FileBlocksHolderPtr()> alloc_holder,
+                       size_t capacity)
+            : FileBuffer(BufferType::DOWNLOAD, alloc_holder, offset, state, capacity, capacity),
               _download(std::move(download)),
               _write_to_local_file_cache(std::move(write_to_cache)),
               _write_to_use_buffer(std::move(write_to_use_buffer)) {}
@@ -153,8 +155,10 @@ struct DownloadFileBuffer final : public FileBuffer {
 
 struct UploadFileBuffer final : public FileBuffer {
     UploadFileBuffer(std::function<void(UploadFileBuffer&)> upload_cb, OperationState state,
-                     size_t offset, std::function<FileBlocksHolderPtr()> alloc_holder)
-            : FileBuffer(BufferType::UPLOAD, alloc_holder, offset, state),
+                     size_t offset, std::function<FileBlocksHolderPtr()> alloc_holder,
+                     size_t capacity, size_t reserved_size)
+            : FileBuffer(BufferType::UPLOAD, alloc_holder, offset, state, capacity,
+                         reserved_size),
               _upload_to_remote(std::move(upload_cb)) {}
     ~UploadFileBuffer() override = default;
     Status append_data(const Slice& s) override;
@@ -265,6 +269,25 @@ struct FileBufferBuilder {
         return *this;
     }
     /**
+    * set the max bytes of the file buffer, config::s3_write_buffer_size if not set
+    *
+    * @param capacity
+    */
+    FileBufferBuilder& set_capacity(size_t capacity) {
+        _capacity = capacity;
+        return *this;
+    }
+    /**
+    * set the memory reserved when the upload buffer is built, the rest is reserved
+    * on demand when data is appended. The whole capacity is reserved if not set
+    *
+    * @param reserved_size
+    */
+    FileBufferBuilder& set_reserved_size(size_t reserved_size) {
+        _reserved_size = reserved_size;
+        return *this;
+    }
+    /**
     * set the callback which write the content into local file cache
     *
     * @param cb 
@@ -293,6 +316,8 @@ struct FileBufferBuilder {
     std::function<Status(Slice&)> _download;
     std::function<void(Slice, size_t)> _write_to_use_buffer;
     size_t _offset;
+    size_t _capacity = 0;
+    size_t _reserved_size = 0;
 };
 } // namespace io
 } // namespace doris
@@ -23,24 +23,35 @@
 #include <aws/s3/S3Errors.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/GetObjectResult.h>
+#include <bthread/countdown_event.h>
 #include <bvar/latency_recorder.h>
 #include <bvar/reducer.h>
 #include <fmt/format.h>
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "io/fs/err_utils.h"
 #include "io/fs/obj_storage_client.h"
 #include "io/fs/s3_common.h"
+#include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/bvar_helper.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/s3_util.h"
+#include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -56,6 +67,77 @@ bvar::PerSecond<bvar::Adder<uint64_t>> s3_read_througthput("s3_file_reader", "s3
 // record successfull request, and s3_get_request_qps will record all request.
 bvar::PerSecond<bvar::Adder<uint64_t>> s3_get_request_qps("s3_file_reader", "s3_get_request",
                                                           &s3_file_reader_read_counter);
+// the latency of the successful GETs in us, the hedged requests are issued by its percentile
+bvar::LatencyRecorder s3_get_latency("s3_file_reader", "get_latency");
+bvar::Adder<uint64_t> s3_file_reader_split_read_counter("s3_file_reader", "split_read");
+bvar::Adder<uint64_t> s3_file_reader_hedged_read_counter("s3_file_reader", "hedged_read");
+bvar::Adder<uint64_t> s3_file_reader_hedged_read_win_counter("s3_file_reader",
+                                                             "hedged_read_win");
+
+namespace {
+
+Status get_object(ObjStorageClient& client, const ObjectStoragePathOptions& opts,
+                  const std::string& path, size_t file_size, size_t offset, size_t bytes_req,
+                  char* to, S3FileReader::GetObjectStats* stats) {
+    int retry_count = 0;
+    const int base_wait_time = config::s3_read_base_wait_time_ms; // Base wait time in milliseconds
+    const int max_wait_time = config::s3_read_max_wait_time_ms; // Maximum wait time in milliseconds
+    const int max_retries = config::max_s3_client_retry; // wait 1s, 2s, 4s, 8s for each backoff
+
+    int total_sleep_time = 0;
+    size_t bytes_read = 0;
+    while (retry_count <= max_retries) {
+        bytes_read = 0;
+        s3_file_reader_read_counter << 1;
+        MonotonicStopWatch watch;
+        watch.start();
+        auto resp = client.get_object(opts, to, offset, bytes_req, &bytes_read);
+        stats->total_get_request_counter++;
+        if (resp.status.code != ErrorCode::OK) {
+            if (resp.http_code ==
+                static_cast<int>(Aws::Http::HttpResponseCode::TOO_MANY_REQUESTS)) {
+                s3_file_reader_too_many_request_counter << 1;
+                retry_count++;
+                int wait_time = std::min(base_wait_time * (1 << retry_count),
+                                         max_wait_time); // Exponential backoff
+                std::this_thread::sleep_for(std::chrono::milliseconds(wait_time));
+                stats->too_many_request_err_counter++;
+                stats->too_many_request_sleep_time_ms += wait_time;
+                total_sleep_time += wait_time;
+                continue;
+            } else {
+                // Handle other errors
+                return std::move(Status(resp.status.code, std::move(resp.status.msg))
+                                         .append("failed to read"));
+            }
+        }
+        if (bytes_read != bytes_req) {
+            std::string msg = fmt::format(
+                    "failed to get object, path={} offset={} bytes_req={} bytes_read={} "
+                    "file_size={} tries={}",
+                    path, offset, bytes_req, bytes_read, file_size, (retry_count + 1));
+            LOG(WARNING) << msg;
+            return Status::InternalError(msg);
+        }
+        s3_get_latency << watch.elapsed_time() / 1000;
+        s3_bytes_read_total << bytes_req;
+        s3_bytes_per_read << bytes_req;
+        DorisMetrics::instance()->s3_bytes_read_total->increment(bytes_req);
+        if (retry_count > 0) {
+            LOG(INFO) << fmt::format("read s3 file {} succeed after {} times with {} ms sleeping",
+                                     path, retry_count, total_sleep_time);
+        }
+        return Status::OK();
+    }
+    std::string msg = fmt::format(
+            "failed to get object, path={} offset={} bytes_req={} bytes_read={} file_size={} "
+            "tries={}",
+            path, offset, bytes_req, bytes_read, file_size, (max_retries + 1));
+    LOG(WARNING) << msg;
+    return Status::InternalError(msg);
+}
+
+} // namespace
 
 Result<FileReaderSPtr> S3FileReader::create(std::shared_ptr<const ObjClientHolder> client,
                                             std::string bucket, std::string key, int64_t file_size,
@@ -123,64 +205,149 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
         return Status::InternalError("init s3 client error");
     }
 
-    int retry_count = 0;
-    const int base_wait_time = config::s3_read_base_wait_time_ms; // Base wait time in milliseconds
-    const int max_wait_time = config::s3_read_max_wait_time_ms; // Maximum wait time in milliseconds
-    const int max_retries = config::max_s3_client_retry; // wait 1s, 2s, 4s, 8s for each backoff
-
     LIMIT_REMOTE_SCAN_IO(bytes_read);
+    SCOPED_RECORD_READ_TIER(doris::IOContext::ReadTier::REMOTE_STORAGE, bytes_read);
+    SCOPED_HISTOGRAM_LATENCY_US(DorisMetrics::instance()->s3_file_read_latency_us);
 
-    int total_sleep_time = 0;
-    while (retry_count <= max_retries) {
-        *bytes_read = 0;
-        s3_file_reader_read_counter << 1;
-        // clang-format off
-        auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
-                to, offset, bytes_req, bytes_read);
-        // clang-format on
-        _s3_stats.total_get_request_counter++;
-        if (resp.status.code != ErrorCode::OK) {
-            if (resp.http_code ==
-                static_cast<int>(Aws::Http::HttpResponseCode::TOO_MANY_REQUESTS)) {
-                s3_file_reader_too_many_request_counter << 1;
-                retry_count++;
-                int wait_time = std::min(base_wait_time * (1 << retry_count),
-                                         max_wait_time); // Exponential backoff
-                std::this_thread::sleep_for(std::chrono::milliseconds(wait_time));
-                _s3_stats.too_many_request_err_counter++;
-                _s3_stats.too_many_request_sleep_time_ms += wait_time;
-                total_sleep_time += wait_time;
-                continue;
-            } else {
-                // Handle other errors
-                return std::move(Status(resp.status.code, std::move(resp.status.msg))
-                                         .append("failed to read"));
-            }
+    *bytes_read = 0;
+    auto split_size = static_cast<size_t>(std::max<int64_t>(config::s3_read_split_size, 0));
+    if (split_size > 0 && bytes_req > split_size) {
+        RETURN_IF_ERROR(_get_object_split(client, offset, bytes_req, to, split_size));
+    } else if (config::s3_hedged_read_percentile > 0 &&
+               bytes_req <= static_cast<size_t>(config::s3_hedged_read_max_bytes)) {
+        RETURN_IF_ERROR(_get_object_hedged(client, offset, bytes_req, to));
+    } else {
+        GetObjectStats stats;
+        Status st = get_object(*client, {.bucket = _bucket, .key = _key}, _path.native(),
+                               _file_size, offset, bytes_req, to, &stats);
+        _merge_stats(stats);
+        RETURN_IF_ERROR(st);
+    }
+    *bytes_read = bytes_req;
+    _s3_stats.total_bytes_read += bytes_req;
+    return Status::OK();
+}
+
+Status S3FileReader::_get_object_split(const std::shared_ptr<ObjStorageClient>& client,
+                                       size_t offset, size_t bytes_req, char* to,
+                                       size_t split_size) {
+    size_t num_ranges = (bytes_req + split_size - 1) / split_size;
+    std::vector<GetObjectStats> stats(num_ranges);
+    std::vector<Status> statuses(num_ranges);
+    auto wait = std::make_shared<bthread::CountdownEvent>(0);
+    // the last range is read by this thread
+    for (size_t i = 0; i < num_ranges; ++i) {
+        size_t range_offset = i * split_size;
+        size_t range_size = std::min(split_size, bytes_req - range_offset);
+        auto task = [&, i, range_offset, range_size]() {
+            statuses[i] = get_object(*client, {.bucket = _bucket, .key = _key}, _path.native(),
+                                     _file_size, offset + range_offset, range_size,
+                                     to + range_offset, &stats[i]);
+        };
+        auto* pool = ExecEnv::GetInstance()->s3_file_read_thread_pool();
+        wait->add_count();
+        bool submitted = i + 1 < num_ranges && pool != nullptr &&
+                         pool->submit_func([task, wait]() {
+                                 SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->orphan_mem_tracker());
+                                 task();
+                                 wait->signal();
+                             }).ok();
+        if (!submitted) {
+            task();
+            wait->signal();
         }
-        if (*bytes_read != bytes_req) {
-            std::string msg = fmt::format(
-                    "failed to get object, path={} offset={} bytes_req={} bytes_read={} "
-                    "file_size={} tries={}",
-                    _path.native(), offset, bytes_req, *bytes_read, _file_size, (retry_count + 1));
-            LOG(WARNING) << msg;
-            return Status::InternalError(msg);
+    }
+    wait->wait();
+    s3_file_reader_split_read_counter << num_ranges;
+    Status st = Status::OK();
+    for (size_t i = 0; i < num_ranges; ++i) {
+        _merge_stats(stats[i]);
+        if (st.ok() && !statuses[i].ok()) {
+            st = std::move(statuses[i]);
         }
-        _s3_stats.total_bytes_read += bytes_req;
-        s3_bytes_read_total << bytes_req;
-        s3_bytes_per_read << bytes_req;
-        DorisMetrics::instance()->s3_bytes_read_total->increment(bytes_req);
-        if (retry_count > 0) {
-            LOG(INFO) << fmt::format("read s3 file {} succeed after {} times with {} ms sleeping",
-                                     _path.native(), retry_count, total_sleep_time);
+    }
+    return st;
+}
+
+Status S3FileReader::_get_object_hedged(const std::shared_ptr<ObjStorageClient>& client,
+                                        size_t offset, size_t bytes_req, char* to) {
+    // The requests are shared with the pool threads, because the slower one is not waited for
+    // and may outlive this reader.
+    struct HedgedGet {
+        std::mutex mtx;
+        std::condition_variable cv;
+        int num_finished = 0;
+        // the index of the first request succeeded, -1 if none
+        int winner = -1;
+        Status status;
+        std::array<std::unique_ptr<char[]>, 2> buffers;
+        std::array<GetObjectStats, 2> stats;
+    };
+    auto* pool = ExecEnv::GetInstance()->s3_file_read_thread_pool();
+    auto state = std::make_shared<HedgedGet>();
+    auto submit = [&](int idx) {
+        state->buffers[idx].reset(new char[bytes_req]);
+        auto task = [state, idx, client, bucket = _bucket, key = _key, path = _path.native(),
+                     file_size = _file_size, offset, bytes_req]() {
+            SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->orphan_mem_tracker());
+            GetObjectStats stats;
+            Status st = get_object(*client, {.bucket = bucket, .key = key}, path, file_size,
+                                   offset, bytes_req, state->buffers[idx].get(), &stats);
+            std::lock_guard lock(state->mtx);
+            state->stats[idx] = stats;
+            state->num_finished++;
+            if (st.ok() && state->winner < 0) {
+                state->winner = idx;
+            } else if (!st.ok()) {
+                state->status = std::move(st);
+            }
+            state->cv.notify_all();
+        };
+        return pool->submit_func(std::move(task));
+    };
+
+    if (pool == nullptr || !submit(0).ok()) {
+        GetObjectStats stats;
+        Status st = get_object(*client, {.bucket = _bucket, .key = _key}, _path.native(),
+                               _file_size, offset, bytes_req, to, &stats);
+        _merge_stats(stats);
+        return st;
+    }
+    int num_submitted = 1;
+    int64_t delay_us = std::max<int64_t>(
+            s3_get_latency.latency_percentile(config::s3_hedged_read_percentile),
+            config::s3_hedged_read_min_delay_ms * 1000L);
+    std::unique_lock lock(state->mtx);
+    if (!state->cv.wait_for(lock, std::chrono::microseconds(delay_us),
+                            [&]() { return state->num_finished > 0; })) {
+        lock.unlock();
+        if (submit(1).ok()) {
+            num_submitted = 2;
+            s3_file_reader_hedged_read_counter << 1;
         }
-        return Status::OK();
+        lock.lock();
     }
-    std::string msg = fmt::format(
-            "failed to get object, path={} offset={} bytes_req={} bytes_read={} file_size={} "
-            "tries={}",
-            _path.native(), offset, bytes_req, *bytes_read, _file_size, (max_retries + 1));
-    LOG(WARNING) << msg;
-    return Status::InternalError(msg);
+    state->cv.wait(lock, [&]() {
+        return state->winner >= 0 || state->num_finished == num_submitted;
+    });
+    for (int i = 0; i < 2; ++i) {
+        // the stats of the request still running are not counted
+        _merge_stats(state->stats[i]);
+    }
+    if (state->winner < 0) {
+        return state->status;
+    }
+    if (state->winner == 1) {
+        s3_file_reader_hedged_read_win_counter << 1;
+    }
+    memcpy(to, state->buffers[state->winner].get(), bytes_req);
+    return Status::OK();
+}
+
+void S3FileReader::_merge_stats(const GetObjectStats& stats) {
+    _s3_stats.total_get_request_counter += stats.total_get_request_counter;
+    _s3_stats.too_many_request_err_counter += stats.too_many_request_err_counter;
+    _s3_stats.too_many_request_sleep_time_ms += stats.too_many_request_sleep_time_ms;
 }
 
 void S3FileReader::_collect_profile_before_close() {
@@ -53,6 +53,13 @@ public:
 
     bool closed() const override { return _closed.load(std::memory_order_acquire); }
 
+    // The GETs issued for a read, the requests of a split or hedged read run in other threads.
+    struct GetObjectStats {
+        int64_t total_get_request_counter = 0;
+        int64_t too_many_request_err_counter = 0;
+        int64_t too_many_request_sleep_time_ms = 0;
+    };
+
 protected:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
@@ -60,6 +67,17 @@ protected:
     void _collect_profile_before_close() override;
 
 private:
+    // Read a range larger than split_size by sub-range GETs of split_size in parallel.
+    Status _get_object_split(const std::shared_ptr<ObjStorageClient>& client, size_t offset,
+                             size_t bytes_req, char* to, size_t split_size);
+
+    // Issue a duplicate GET if the first one is slower than the `s3_hedged_read_percentile` of
+    // the recent GETs, the first one succeeded is used.
+    Status _get_object_hedged(const std::shared_ptr<ObjStorageClient>& client, size_t offset,
+                              size_t bytes_req, char* to);
+
+    void _merge_stats(const GetObjectStats& stats);
+
     struct S3Statistics {
         int64_t total_get_request_counter = 0;
         int64_t too_many_request_err_counter = 0;
@@ -22,8 +22,13 @@
 #include <fmt/core.h>
 #include <glog/logging.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include "common/config.h"
@@ -50,14 +55,69 @@ bvar::Adder<uint64_t> s3_file_being_written("s3_file_writer_file_being_written")
 bvar::Adder<uint64_t> s3_file_writer_async_close_queuing("s3_file_writer_async_close_queuing");
 bvar::Adder<uint64_t> s3_file_writer_async_close_processing(
         "s3_file_writer_async_close_processing");
+bvar::Adder<uint64_t> s3_file_writer_upload_slot_waiting("s3_file_writer_upload_slot_waiting");
+
+// The parts in uploading to one endpoint of all the S3FileWriters, the buffers of the writers
+// to the same endpoint share the bandwidth to it, so the memory parked in the upload queue
+// is bounded by the limit instead of growing with the number of writers.
+class S3UploadSlots {
+public:
+    static S3UploadSlots* for_endpoint(const std::string& endpoint) {
+        static std::mutex mtx;
+        // never destructed, the writers closed asynchronously may outlive the static variables
+        static auto* slots = new std::unordered_map<std::string, std::unique_ptr<S3UploadSlots>>();
+        std::lock_guard lock(mtx);
+        auto& s = (*slots)[endpoint];
+        if (s == nullptr) {
+            s = std::make_unique<S3UploadSlots>();
+        }
+        return s.get();
+    }
+
+    void acquire(std::string_view path) {
+        std::unique_lock lock(_mtx);
+        auto has_slot = [this]() {
+            int limit = config::s3_upload_max_concurrency_per_host;
+            return limit <= 0 || _in_flight < limit;
+        };
+        if (!has_slot()) {
+            s3_file_writer_upload_slot_waiting << 1;
+            while (!_cv.wait_for(lock,
+                                 std::chrono::seconds(config::s3_file_writer_log_interval_second),
+                                 has_slot)) {
+                LOG(WARNING) << "wait for upload slot of " << path << " too long, in flight "
+                             << _in_flight;
+            }
+            s3_file_writer_upload_slot_waiting << -1;
+        }
+        ++_in_flight;
+    }
+
+    void release() {
+        {
+            std::lock_guard lock(_mtx);
+            --_in_flight;
+        }
+        _cv.notify_one();
+    }
+
+private:
+    std::mutex _mtx;
+    std::condition_variable _cv;
+    int _in_flight = 0;
+};
 
 S3FileWriter::S3FileWriter(std::shared_ptr<ObjClientHolder> client, std::string bucket,
                            std::string key, const FileWriterOptions* opts)
         : _obj_storage_path_opts({.path = fmt::format("s3://{}/{}", bucket, key),
                                   .bucket = std::move(bucket),
                                   .key = std::move(key)}),
+          _base_part_size(config::s3_write_buffer_size),
+          _max_part_size(std::max<size_t>(config::s3_write_max_part_size, _base_part_size)),
+          _part_size_grow_interval(config::s3_write_part_size_grow_interval),
           _used_by_s3_committer(opts ? opts->used_by_s3_committer : false),
-          _obj_client(std::move(client)) {
+          _obj_client(std::move(client)),
+          _upload_slots(S3UploadSlots::for_endpoint(_obj_client->s3_client_conf().endpoint)) {
     s3_file_writer_total << 1;
     s3_file_being_written << 1;
     Aws::Http::SetCompliantRfc3986Encoding(true);
@@ -168,6 +228,7 @@ bool S3FileWriter::_complete_part_task_callback(Status s) {
         ret = true;
         _st = std::move(s);
     }
+    _upload_slots->release();
     // After the signal, there is a scenario where the previous invocation of _wait_until_finish
     // returns to the caller, and subsequently, the S3 file writer is destructed.
     // This means that accessing _failed afterwards would result in a heap use after free vulnerability.
@@ -175,25 +236,64 @@ bool S3FileWriter::_complete_part_task_callback(Status s) {
     return ret;
 }
 
+size_t S3FileWriter::_part_size(int part_num) const {
+    if (_part_size_grow_interval <= 0) {
+        return _base_part_size;
+    }
+    // the part size doubles every _part_size_grow_interval parts, e.g. with the 5MB base and
+    // the 1000 interval, 10000 parts take up to 5MB * 1000 * (2^10 - 1), about 5TB
+    int shift = std::min((part_num - 1) / _part_size_grow_interval, 32);
+    if ((_max_part_size >> shift) < _base_part_size) {
+        return _max_part_size;
+    }
+    return _base_part_size << shift;
+}
+
+int S3FileWriter::_expected_num_parts() const {
+    int num_parts = 0;
+    for (size_t remain = _bytes_appended; remain > 0;) {
+        remain -= std::min(remain, _part_size(++num_parts));
+    }
+    return num_parts;
+}
+
+Status S3FileWriter::_submit_pending_buf() {
+    _upload_slots->acquire(_obj_storage_path_opts.path.native());
+    _countdown_event.add_count();
+    auto st = FileBuffer::submit(std::move(_pending_buf));
+    _pending_buf = nullptr;
+    if (!st.ok()) {
+        _upload_slots->release();
+    }
+    return st;
+}
+
 Status S3FileWriter::_build_upload_buffer() {
+    _cur_part_size = _part_size(_cur_part_num);
     auto builder = FileBufferBuilder();
     builder.set_type(BufferType::UPLOAD)
             .set_upload_callback([part_num = _cur_part_num, this](UploadFileBuffer& buf) {
                 _upload_one_part(part_num, buf);
             })
             .set_file_offset(_bytes_appended)
+            .set_capacity(_cur_part_size)
             .set_sync_after_complete_task([this](auto&& PH1) {
                 return _complete_part_task_callback(std::forward<decltype(PH1)>(PH1));
             })
             .set_is_cancelled([this]() { return _failed.load(); });
+    if (_cur_part_num == 1) {
+        // the file may be a small one which needs much less memory than a part
+        builder.set_reserved_size(config::s3_write_buffer_initial_size);
+    }
     if (_cache_builder != nullptr) {
         // We would load the data into file cache asynchronously which indicates
         // that this instance of S3FileWriter might have been destructed when we
         // try to do writing into file cache, so we make the lambda capture the variable
         // we need by value to extend their lifetime
         builder.set_allocate_file_blocks_holder(
-                [builder = *_cache_builder, offset = _bytes_appended]() -> FileBlocksHolderPtr {
-                    return builder.allocate_cache_holder(offset, config::s3_write_buffer_size);
+                [builder = *_cache_builder, offset = _bytes_appended,
+                 size = _cur_part_size]() -> FileBlocksHolderPtr {
+                    return builder.allocate_cache_holder(offset, size);
                 });
     }
     RETURN_IF_ERROR(builder.build(&_pending_buf));
@@ -205,7 +305,7 @@ Status S3FileWriter::_build_upload_buffer() {
 Status S3FileWriter::_close_impl() {
     VLOG_DEBUG << "S3FileWriter::close, path: " << _obj_storage_path_opts.path.native();
 
-    if (_cur_part_num == 1 && _pending_buf) { // data size is less than config::s3_write_buffer_size
+    if (_cur_part_num == 1 && _pending_buf) { // data size is less than the first part size
         RETURN_IF_ERROR(_set_upload_to_remote_less_than_buffer_size());
     }
 
@@ -222,9 +322,7 @@ Status S3FileWriter::_close_impl() {
     }
 
     if (_pending_buf != nullptr) { // there is remaining data in buffer need to be uploaded
-        _countdown_event.add_count();
-        RETURN_IF_ERROR(FileBuffer::submit(std::move(_pending_buf)));
-        _pending_buf = nullptr;
+        RETURN_IF_ERROR(_submit_pending_buf());
     }
 
     RETURN_IF_ERROR(_complete());
@@ -239,7 +337,6 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                                      _obj_storage_path_opts.path.native());
     }
 
-    size_t buffer_size = config::s3_write_buffer_size;
     TEST_SYNC_POINT_RETURN_WITH_VALUE("s3_file_writer::appenv", Status());
     for (size_t i = 0; i < data_cnt; i++) {
         size_t data_size = data[i].get_size();
@@ -252,8 +349,9 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
             }
             // we need to make sure all parts except the last one to be 5MB or more
             // and shouldn't be larger than buf
-            data_size_to_append = std::min(data_size - pos, _pending_buf->get_file_offset() +
-                                                                    buffer_size - _bytes_appended);
+            data_size_to_append =
+                    std::min(data_size - pos,
+                             _pending_buf->get_file_offset() + _cur_part_size - _bytes_appended);
 
             // if the buffer has memory buf inside, the data would be written into memory first then S3 then file cache
             // it would be written to cache then S3 if the buffer doesn't have memory preserved
@@ -261,20 +359,18 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                     Slice {data[i].get_data() + pos, data_size_to_append}));
             TEST_SYNC_POINT_CALLBACK("s3_file_writer::appenv_1", &_pending_buf, _cur_part_num);
 
-            // If this is the last part and the data size is less than s3_write_buffer_size,
+            // If this is the last part and the data size is less than the part size,
             // the pending_buf will be handled by _close_impl() and _complete()
-            // If this is the last part and the data size is equal to s3_write_buffer_size,
+            // If this is the last part and the data size is equal to the part size,
             // the pending_buf is handled here and submitted. it will be waited by _complete()
-            if (_pending_buf->get_size() == buffer_size) {
+            if (_pending_buf->get_size() == _cur_part_size) {
                 // only create multiple upload request when the data size is
-                // larger or equal to s3_write_buffer_size than one memory buffer
+                // larger or equal to the part size than one memory buffer
                 if (_cur_part_num == 1) {
                     RETURN_IF_ERROR(_create_multi_upload_request());
                 }
                 _cur_part_num++;
-                _countdown_event.add_count();
-                RETURN_IF_ERROR(FileBuffer::submit(std::move(_pending_buf)));
-                _pending_buf = nullptr;
+                RETURN_IF_ERROR(_submit_pending_buf());
             }
             _bytes_appended += data_size_to_append;
         }
@@ -386,13 +482,16 @@ Status S3FileWriter::_complete() {
     }
 
     // check number of parts
-    int expected_num_parts1 = (_bytes_appended / config::s3_write_buffer_size) +
-                              !!(_bytes_appended % config::s3_write_buffer_size);
+    int expected_num_parts1 = _expected_num_parts();
+    size_t bytes_of_full_parts = 0;
+    for (int i = 1; i < _cur_part_num; ++i) {
+        bytes_of_full_parts += _part_size(i);
+    }
     int expected_num_parts2 =
-            (_bytes_appended % config::s3_write_buffer_size) ? _cur_part_num : _cur_part_num - 1;
+            _bytes_appended > bytes_of_full_parts ? _cur_part_num : _cur_part_num - 1;
     DCHECK_EQ(expected_num_parts1, expected_num_parts2)
             << " bytes_appended=" << _bytes_appended << " cur_part_num=" << _cur_part_num
-            << " s3_write_buffer_size=" << config::s3_write_buffer_size;
+            << " part_size=" << _cur_part_size;
     if (_failed || _completed_parts.size() != expected_num_parts1 ||
         expected_num_parts1 != expected_num_parts2) {
         _st = Status::InternalError(
@@ -410,7 +509,7 @@ Status S3FileWriter::_complete() {
     TEST_SYNC_POINT_CALLBACK("S3FileWriter::_complete:2", &_completed_parts);
     LOG(INFO) << "complete_multipart_upload " << _obj_storage_path_opts.path.native()
               << " size=" << _bytes_appended << " number_parts=" << _completed_parts.size()
-              << " s3_write_buffer_size=" << config::s3_write_buffer_size;
+              << " last_part_size=" << _cur_part_size;
     auto resp = client->complete_multipart_upload(_obj_storage_path_opts, _completed_parts);
     if (resp.status.code != ErrorCode::OK) {
         LOG_WARNING("failed to complete multipart upload, err={}, file_path={}", resp.status.msg,
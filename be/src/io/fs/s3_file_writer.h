@@ -45,6 +45,7 @@ struct S3FileBuffer;
 class S3FileSystem;
 struct AsyncCloseStatusPack;
 class ObjClientHolder;
+class S3UploadSlots;
 
 class S3FileWriter final : public FileWriter {
 public:
@@ -86,11 +87,20 @@ private:
     void _upload_one_part(int64_t part_num, UploadFileBuffer& buf);
     bool _complete_part_task_callback(Status s);
     Status _build_upload_buffer();
+    // Submit _pending_buf after taking an upload slot of the endpoint
+    Status _submit_pending_buf();
+    size_t _part_size(int part_num) const;
+    int _expected_num_parts() const;
 
     ObjectStoragePathOptions _obj_storage_path_opts;
 
     // Current Part Num for CompletedPart
     int _cur_part_num = 1;
+    // The size of the current part, see _part_size()
+    size_t _cur_part_size = 0;
+    const size_t _base_part_size;
+    const size_t _max_part_size;
+    const int _part_size_grow_interval;
     std::mutex _completed_lock;
     std::vector<ObjectCompleteMultiPart> _completed_parts;
 
@@ -117,6 +127,7 @@ private:
     std::unique_ptr<AsyncCloseStatusPack> _async_close_pack;
     State _state {State::OPENED};
     std::shared_ptr<ObjClientHolder> _obj_client;
+    S3UploadSlots* _upload_slots;
 };
 
 } // namespace io
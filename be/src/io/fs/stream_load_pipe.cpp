@@ -57,6 +57,7 @@ Status StreamLoadPipe::read_at_impl(size_t /*offset*/, Slice result, size_t* byt
         return Status::OK();
     }
     while (*bytes_read < bytes_req) {
+        std::function<void()> on_writable;
         std::unique_lock<std::mutex> l(_lock);
         while (!_cancelled && !_finished && _buf_queue.empty()) {
             _get_cond.wait(l);
@@ -80,6 +81,11 @@ Status StreamLoadPipe::read_at_impl(size_t /*offset*/, Slice result, size_t* byt
             _buf_queue.pop_front();
             _buffered_bytes -= buf->limit;
             _put_cond.notify_one();
+            on_writable = _take_on_writable();
+        }
+        l.unlock();
+        if (on_writable) {
+            on_writable();
         }
     }
     DCHECK(*bytes_read == bytes_req)
@@ -193,6 +199,11 @@ Status StreamLoadPipe::_read_next_buffer(std::unique_ptr<uint8_t[]>* data, size_
         row_ptr.release();
     }
     _put_cond.notify_one();
+    auto on_writable = _take_on_writable();
+    l.unlock();
+    if (on_writable) {
+        on_writable();
+    }
     return Status::OK();
 }
 
@@ -242,13 +253,38 @@ Status StreamLoadPipe::finish() {
 
 // called when producer/consumer failed
 void StreamLoadPipe::cancel(const std::string& reason) {
+    std::function<void()> on_writable;
     {
         std::lock_guard<std::mutex> l(_lock);
         _cancelled = true;
         _cancelled_reason = reason;
+        on_writable = std::move(_on_writable);
+        _on_writable = nullptr;
     }
     _get_cond.notify_all();
     _put_cond.notify_all();
+    if (on_writable) {
+        on_writable();
+    }
+}
+
+bool StreamLoadPipe::writable(std::function<void()> on_writable) {
+    std::lock_guard<std::mutex> l(_lock);
+    // the size of the rows appended with proto is not known before they are built
+    if (_use_proto || _cancelled || _is_writable()) {
+        return true;
+    }
+    _on_writable = std::move(on_writable);
+    return false;
+}
+
+std::function<void()> StreamLoadPipe::_take_on_writable() {
+    std::function<void()> on_writable;
+    if (_on_writable && _is_writable()) {
+        on_writable = std::move(_on_writable);
+        _on_writable = nullptr;
+    }
+    return on_writable;
 }
 
 TUniqueId StreamLoadPipe::calculate_pipe_id(const UniqueId& query_id, int32_t fragment_id) {
@@ -23,6 +23,7 @@
 
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -74,6 +75,8 @@ public:
     // called when producer/consumer failed
     virtual void cancel(const std::string& reason) override;
 
+    bool writable(std::function<void()> on_writable) override;
+
     Status read_one_message(std::unique_ptr<uint8_t[]>* data, size_t* length);
 
     size_t get_queue_size() { return _buf_queue.size(); }
@@ -101,6 +104,14 @@ private:
 
     Status _append(const ByteBufferPtr& buf, size_t proto_byte_size = 0);
 
+    // whether a chunk can be appended without waiting, must hold _lock
+    bool _is_writable() const {
+        return _buf_queue.empty() || _buffered_bytes + _min_chunk_size <= _max_buffered_bytes;
+    }
+
+    // takes the callback of writable() if the pipe became writable, must hold _lock
+    std::function<void()> _take_on_writable();
+
     // Blocking queue
     std::mutex _lock;
     size_t _buffered_bytes;
@@ -120,6 +131,7 @@ private:
     std::deque<std::unique_ptr<PDataRow>> _data_row_ptrs;
     std::condition_variable _put_cond;
     std::condition_variable _get_cond;
+    std::function<void()> _on_writable;
 
     ByteBufferPtr _write_buf;
 
@@ -21,6 +21,7 @@
 #include <fmt/format.h>
 #include <rapidjson/prettywriter.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <iterator>
 #include <random>
@@ -485,8 +486,7 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
             delete_bitmap == nullptr ? _tablet_meta->delete_bitmap_ptr() : delete_bitmap;
     for (size_t i = 0; i < specified_rowsets.size(); i++) {
         const auto& rs = specified_rowsets[i];
-        std::vector<KeyBoundsPB> segments_key_bounds;
-        rs->rowset_meta()->get_segments_key_bounds(&segments_key_bounds);
+        const auto& segments_key_bounds = rs->rowset_meta()->get_segments_key_bounds();
         int num_segments = cast_set<int>(rs->num_segments());
         DCHECK_EQ(segments_key_bounds.size(), num_segments);
         std::vector<uint32_t> picked_segments;
@@ -632,10 +632,29 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     bool exact_match = false;
     std::string last_key;
     int batch_size = 1024;
+    // Rowsets none of whose segments overlap the keys of this segment are never looked up.
+    std::vector<RowsetSharedPtr> candidate_rowsets;
+    std::string seg_min_key = seg->min_key();
+    std::string seg_max_key = seg->max_key();
+    if (seg_min_key.empty() || seg_max_key.empty()) {
+        candidate_rowsets = specified_rowsets;
+    } else {
+        for (const auto& rs : specified_rowsets) {
+            const auto& segments_key_bounds = rs->rowset_meta()->get_segments_key_bounds();
+            bool truncated = rs->rowset_meta()->is_segments_key_bounds_truncated();
+            if (std::any_of(segments_key_bounds.begin(), segments_key_bounds.end(),
+                            [&](const KeyBoundsPB& bounds) {
+                                return !key_range_is_not_in_segment(seg_min_key, seg_max_key,
+                                                                    bounds, truncated);
+                            })) {
+                candidate_rowsets.push_back(rs);
+            }
+        }
+    }
     // The data for each segment may be lookup multiple times. Creating a SegmentCacheHandle
     // will update the lru cache, and there will be obvious lock competition in multithreading
     // scenarios, so using a segment_caches to cache SegmentCacheHandle.
-    std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(candidate_rowsets.size());
     while (remaining > 0) {
         std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
         RETURN_IF_ERROR(pk_idx->new_iterator(&iter, nullptr));
@@ -707,11 +726,11 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
             RowsetSharedPtr rowset_find;
             Status st = Status::OK();
             if (tablet_delete_bitmap == nullptr) {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
+                st = lookup_row_key(key, rowset_schema.get(), true, candidate_rowsets, &loc,
                                     cast_set<uint32_t>(dummy_version.first - 1), segment_caches,
                                     &rowset_find);
             } else {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
+                st = lookup_row_key(key, rowset_schema.get(), true, candidate_rowsets, &loc,
                                     cast_set<uint32_t>(dummy_version.first - 1), segment_caches,
                                     &rowset_find, true, nullptr, nullptr, tablet_delete_bitmap);
             }
@@ -1784,6 +1803,7 @@ Status BaseTablet::update_delete_bitmap_without_lock(
         delete_bitmap->remove_sentinel_marks();
     }
     for (auto& iter : delete_bitmap->delete_bitmap) {
+        DeleteBitmap::seal(&iter.second);
         self->_tablet_meta->delete_bitmap().merge(
                 {std::get<0>(iter.first), std::get<1>(iter.first), cur_version}, iter.second);
     }
@@ -1830,6 +1850,7 @@ void BaseTablet::agg_delete_bitmap_for_stale_rowsets(
                        << ", end_version=" << end_version << ", delete_bitmap=" << d->cardinality();
             DeleteBitmap::BitmapKey start_key {rowset->rowset_id(), seg_id, start_version};
             DeleteBitmap::BitmapKey end_key {rowset->rowset_id(), seg_id, end_version};
+            DeleteBitmap::seal(d.get());
             new_delete_bitmap->set(end_key, *d);
             remove_delete_bitmap_key_ranges.emplace_back(start_key, end_key);
         }
@@ -19,6 +19,8 @@
 
 #include <string.h>
 
+#include "olap/rowset/segment_v2/bloom_filter.h"
+
 namespace roaring {
 class Roaring;
 } // namespace roaring
@@ -154,7 +156,8 @@ bool AndBlockColumnPredicate::evaluate_and(
 
 bool AndBlockColumnPredicate::evaluate_and(const segment_v2::BloomFilter* bf) const {
     for (auto& block_column_predicate : _block_column_predicate_vec) {
-        if (!block_column_predicate->evaluate_and(bf)) {
+        if (block_column_predicate->can_do_bloom_filter(bf->is_ngram_bf()) &&
+            !block_column_predicate->evaluate_and(bf)) {
             return false;
         }
     }
@@ -211,13 +211,15 @@ public:
 
     bool evaluate_and(const StringRef* dict_words, const size_t dict_num) const override;
 
+    // The conjuncts are ANDed, so a page is pruned as soon as the bloom filter rules out one of
+    // them, the conjuncts a bloom filter can't evaluate are taken as true.
     bool can_do_bloom_filter(bool ngram) const override {
         for (auto& pred : _block_column_predicate_vec) {
-            if (!pred->can_do_bloom_filter(ngram)) {
-                return false;
+            if (pred->can_do_bloom_filter(ngram)) {
+                return true;
             }
         }
-        return true;
+        return false;
     }
 
     bool can_do_apply_safely(PrimitiveType input_type, bool is_null) const override {
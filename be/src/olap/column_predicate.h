@@ -178,6 +178,9 @@ public:
 
     virtual double get_ignore_threshold() const { return 0; }
 
+    // the number of values in the set of an in_list or not_in_list predicate
+    virtual size_t in_list_size() const { return 0; }
+
     // evaluate predicate on IColumn
     // a short circuit eval way
     uint16_t evaluate(const vectorized::IColumn& column, uint16_t* sel, uint16_t size) const {
@@ -42,9 +42,12 @@
 #include "common/config.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
+#include "io/cache/block_file_cache.h"
 #include "io/cache/block_file_cache_factory.h"
+#include "io/cache/file_block.h"
 #include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
 #include "io/fs/remote_file_system.h"
 #include "io/io_common.h"
 #include "olap/cumulative_compaction.h"
@@ -66,6 +69,7 @@
 #include "olap/rowset/segment_v2/inverted_index_file_reader.h"
 #include "olap/rowset/segment_v2/inverted_index_file_writer.h"
 #include "olap/rowset/segment_v2/inverted_index_fs_directory.h"
+#include "olap/rowset/segment_v2/segment.h"
 #include "olap/storage_engine.h"
 #include "olap/storage_policy.h"
 #include "olap/tablet.h"
@@ -74,9 +78,11 @@
 #include "olap/task/engine_checksum_task.h"
 #include "olap/txn_manager.h"
 #include "olap/utils.h"
+#include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
 #include "util/doris_metrics.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 #include "util/trace.h"
 
@@ -87,15 +93,24 @@ using namespace ErrorCode;
 
 namespace {
 
+// Whether the key range lhs ends before the key range rhs begins. Duplicate keys are not merged,
+// so a duplicate-key rowset may begin with the key the previous one ends with.
+bool is_key_range_before(const std::string& lhs_max, bool lhs_truncated, const std::string& rhs_min,
+                         bool rhs_truncated, bool allow_equal_keys) {
+    if (Slice::lhs_is_strictly_less_than_rhs(Slice {lhs_max}, lhs_truncated, Slice {rhs_min},
+                                             rhs_truncated)) {
+        return true;
+    }
+    // a truncated max key is a prefix of the real one, which may still be larger than rhs_min
+    return allow_equal_keys && !lhs_truncated && Slice {lhs_max}.compare(Slice {rhs_min}) <= 0;
+}
+
 bool is_rowset_tidy(std::string& pre_max_key, bool& pre_rs_key_bounds_truncated,
-                    const RowsetSharedPtr& rhs) {
+                    const RowsetSharedPtr& rhs, bool allow_equal_keys) {
     size_t min_tidy_size = config::ordered_data_compaction_min_segment_size;
     if (rhs->num_segments() == 0) {
         return true;
     }
-    if (rhs->is_segments_overlapping()) {
-        return false;
-    }
     // check segment size
     auto* beta_rowset = reinterpret_cast<BetaRowset*>(rhs.get());
     std::vector<size_t> segments_size;
@@ -106,21 +121,54 @@ bool is_rowset_tidy(std::string& pre_max_key, bool& pre_rs_key_bounds_truncated,
             return false;
         }
     }
-    std::string min_key;
-    auto ret = rhs->first_key(&min_key);
-    if (!ret) {
+    // The segments of a load are marked overlapping as soon as there are more than one, but the
+    // segments of time series data rarely overlap. So the key bounds of every segment are checked
+    // instead of the overlapping flag.
+    const auto& key_bounds = rhs->rowset_meta()->get_segments_key_bounds();
+    if (static_cast<int64_t>(key_bounds.size()) != rhs->num_segments()) {
         return false;
     }
     bool cur_rs_key_bounds_truncated {rhs->is_segments_key_bounds_truncated()};
-    if (!Slice::lhs_is_strictly_less_than_rhs(Slice {pre_max_key}, pre_rs_key_bounds_truncated,
-                                              Slice {min_key}, cur_rs_key_bounds_truncated)) {
-        return false;
+    for (const auto& segment_key_bounds : key_bounds) {
+        if (!is_key_range_before(pre_max_key, pre_rs_key_bounds_truncated,
+                                 segment_key_bounds.min_key(), cur_rs_key_bounds_truncated,
+                                 allow_equal_keys)) {
+            return false;
+        }
+        pre_max_key = segment_key_bounds.max_key();
+        pre_rs_key_bounds_truncated = cur_rs_key_bounds_truncated;
     }
-    CHECK(rhs->last_key(&pre_max_key));
-    pre_rs_key_bounds_truncated = cur_rs_key_bounds_truncated;
     return true;
 }
 
+// The share of the segment data of the rowsets which is in the file cache.
+double file_cache_cached_ratio(const std::vector<RowsetSharedPtr>& rowsets) {
+    int64_t total_size = 0;
+    int64_t cached_size = 0;
+    for (const auto& rowset : rowsets) {
+        for (int seg_id = 0; seg_id < rowset->num_segments(); ++seg_id) {
+            int64_t segment_size = rowset->rowset_meta()->segment_file_size(seg_id);
+            if (segment_size <= 0) {
+                continue;
+            }
+            total_size += segment_size;
+            auto file_key = segment_v2::Segment::file_cache_key(rowset->rowset_id().to_string(),
+                                                                seg_id);
+            auto* file_cache = io::FileCacheFactory::instance()->get_by_path(file_key);
+            if (file_cache == nullptr) {
+                continue;
+            }
+            for (const auto& [_, block] : file_cache->get_blocks_by_key(file_key)) {
+                cached_size += block->range().size();
+            }
+        }
+    }
+    if (total_size == 0) {
+        return 0;
+    }
+    return std::min(1.0, static_cast<double>(cached_size) / static_cast<double>(total_size));
+}
+
 } // namespace
 
 Compaction::Compaction(BaseTabletSPtr tablet, const std::string& label)
@@ -416,8 +464,10 @@ bool CompactionMixin::handle_ordered_data_compaction() {
     auto input_size = _input_rowsets.size();
     std::string pre_max_key;
     bool pre_rs_key_bounds_truncated {false};
+    bool allow_equal_keys = _tablet->keys_type() == KeysType::DUP_KEYS;
     for (auto i = 0; i < input_size; ++i) {
-        if (!is_rowset_tidy(pre_max_key, pre_rs_key_bounds_truncated, _input_rowsets[i])) {
+        if (!is_rowset_tidy(pre_max_key, pre_rs_key_bounds_truncated, _input_rowsets[i],
+                            allow_equal_keys)) {
             if (i <= input_size / 2) {
                 return false;
             } else {
@@ -438,6 +488,7 @@ bool CompactionMixin::handle_ordered_data_compaction() {
 }
 
 Status CompactionMixin::execute_compact() {
+    SCOPED_HISTOGRAM_LATENCY_US(DorisMetrics::instance()->compaction_task_latency_us);
     uint32_t checksum_before;
     uint32_t checksum_after;
     bool enable_compaction_checksum = config::enable_compaction_checksum;
@@ -767,6 +818,15 @@ Status Compaction::do_inverted_index_compaction() {
               << ", destination index size=" << dest_segment_num << ".";
 
     Status status = Status::OK();
+    // the source and destination directories are opened here, the columns are merged in
+    // parallel on the index compaction pool
+    struct IndexCompactionTask {
+        int64_t index_id;
+        int64_t column_uniq_id;
+        std::vector<std::unique_ptr<DorisCompoundReader>> src_idx_dirs;
+        std::vector<lucene::store::Directory*> dest_index_dirs;
+    };
+    std::vector<IndexCompactionTask> tasks;
     for (auto&& column_uniq_id : ctx.columns_to_do_index_compaction) {
         auto col = _cur_tablet_schema->column_by_uid(column_uniq_id);
         const auto* index_meta = _cur_tablet_schema->inverted_index(col);
@@ -782,9 +842,12 @@ Status Compaction::do_inverted_index_compaction() {
             break;
         }
 
-        std::vector<lucene::store::Directory*> dest_index_dirs(dest_segment_num);
+        IndexCompactionTask task {index_meta->index_id(), column_uniq_id, {}, {}};
+        auto& src_idx_dirs = task.src_idx_dirs;
+        auto& dest_index_dirs = task.dest_index_dirs;
+        src_idx_dirs.resize(src_segment_num);
+        dest_index_dirs.resize(dest_segment_num);
         try {
-            std::vector<std::unique_ptr<DorisCompoundReader>> src_idx_dirs(src_segment_num);
             for (int src_segment_id = 0; src_segment_id < src_segment_num; src_segment_id++) {
                 auto res = inverted_index_file_readers[src_segment_id]->open(index_meta);
                 DBUG_EXECUTE_IF("Compaction::open_inverted_index_file_reader", {
@@ -819,12 +882,7 @@ Status Compaction::do_inverted_index_compaction() {
                 // but their lifecycle must be managed by inverted_index_file_writers.
                 dest_index_dirs[dest_segment_id] = res.value().get();
             }
-            auto st = compact_column(index_meta->index_id(), src_idx_dirs, dest_index_dirs,
-                                     index_tmp_path.native(), trans_vec, dest_segment_num_rows);
-            if (!st.ok()) {
-                error_handler(index_meta->index_id(), column_uniq_id);
-                status = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(st.msg());
-            }
+            tasks.push_back(std::move(task));
         } catch (CLuceneError& e) {
             error_handler(index_meta->index_id(), column_uniq_id);
             status = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(e.what());
@@ -834,6 +892,65 @@ Status Compaction::do_inverted_index_compaction() {
         }
     }
 
+    std::mutex status_mutex;
+    auto compact_task = [&](IndexCompactionTask& task) {
+        auto mem_tracker = MemTrackerLimiter::create_shared(
+                MemTrackerLimiter::Type::COMPACTION,
+                fmt::format("IndexCompaction:tablet={}:index={}", _tablet->tablet_id(),
+                            task.index_id),
+                config::inverted_index_compaction_task_mem_limit_bytes);
+        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(mem_tracker);
+        // each column merges in its own tmp dir, they run at the same time
+        auto tmp_path = index_tmp_path / std::to_string(task.index_id);
+        Status st;
+        try {
+            st = compact_column(task.index_id, task.src_idx_dirs, task.dest_index_dirs,
+                                tmp_path.native(), trans_vec, dest_segment_num_rows);
+        } catch (CLuceneError& e) {
+            st = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(e.what());
+        } catch (const Exception& e) {
+            st = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(e.what());
+        }
+        // CLucene doesn't allocate through the limited allocator, a merge which took more than
+        // the limit rebuilds the index of the column from the data next time
+        int64_t limit = mem_tracker->limit();
+        if (st.ok() && limit > 0 && mem_tracker->peak_consumption() > limit) {
+            st = Status::MemoryLimitExceeded(
+                    "index compaction of index {} used {} bytes, limit {} bytes", task.index_id,
+                    mem_tracker->peak_consumption(), limit);
+        }
+        if (!st.ok()) {
+            std::lock_guard lock(status_mutex);
+            error_handler(task.index_id, task.column_uniq_id);
+            status = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(st.msg());
+        }
+    };
+
+    auto* pool = ExecEnv::GetInstance()->inverted_index_compaction_thread_pool();
+    if (!status.ok()) {
+        // the compaction fails anyway, don't merge the other columns
+    } else if (pool == nullptr || tasks.size() <= 1) {
+        for (auto& task : tasks) {
+            compact_task(task);
+        }
+    } else {
+        auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+        for (auto& task : tasks) {
+            auto st = token->submit_func([&, mem_tracker = _mem_tracker]() {
+                SCOPED_ATTACH_TASK(mem_tracker);
+                compact_task(task);
+            });
+            if (!st.ok()) {
+                // the pool is shutting down, run the rest on this thread
+                compact_task(task);
+            }
+        }
+        token->wait();
+    }
+    if (!config::inverted_index_ram_dir_enable) {
+        static_cast<void>(io::global_local_filesystem()->delete_directory(index_tmp_path.native()));
+    }
+
     // check index compaction status. If status is not ok, we should return error and end this compaction round.
     if (!status.ok()) {
         return status;
@@ -1455,6 +1572,7 @@ int64_t CloudCompactionMixin::initiator() const {
 
 Status CloudCompactionMixin::execute_compact() {
     TEST_INJECTION_POINT("Compaction::do_compaction");
+    SCOPED_HISTOGRAM_LATENCY_US(DorisMetrics::instance()->compaction_task_latency_us);
     int64_t permits = get_compaction_permits();
     HANDLE_EXCEPTION_IF_CATCH_EXCEPTION(
             execute_compact_impl(permits), [&](const doris::Exception& ex) {
@@ -1516,6 +1634,20 @@ Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext&
     ctx.write_file_cache = (compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION) ||
                            (config::enable_file_cache_keep_base_compaction_output &&
                             compaction_type() == ReaderType::READER_BASE_COMPACTION);
+    // The inputs of a base or full compaction which are mostly cached are read by queries, so
+    // the output is written through the cache too. Otherwise the first queries after the rowsets
+    // are swapped read all of it from the remote storage. The inputs are removed from the cache
+    // when they are no longer used.
+    if (!ctx.write_file_cache && config::enable_file_cache &&
+        (compaction_type() == ReaderType::READER_BASE_COMPACTION ||
+         compaction_type() == ReaderType::READER_FULL_COMPACTION)) {
+        double cached_ratio = file_cache_cached_ratio(_input_rowsets);
+        ctx.write_file_cache =
+                cached_ratio >= config::file_cache_keep_compaction_output_min_cached_ratio;
+        VLOG_NOTICE << "tablet " << _tablet->tablet_id() << " " << compaction_name()
+                    << " input cached ratio " << cached_ratio
+                    << ", write output to file cache: " << ctx.write_file_cache;
+    }
     ctx.file_cache_ttl_sec = _tablet->ttl_seconds();
     _output_rs_writer = DORIS_TRY(_tablet->create_rowset_writer(ctx, _is_vertical));
     RETURN_IF_ERROR(
@@ -29,6 +29,7 @@
 #include <chrono> // IWYU pragma: keep
 #include <cstddef>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <new>
 #include <roaring/roaring.hh>
@@ -36,6 +37,7 @@
 #include <sstream>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <utility>
 
 #include "common/config.h"
@@ -61,9 +63,11 @@
 #include "olap/tablet_meta_manager.h"
 #include "olap/txn_manager.h"
 #include "olap/utils.h" // for check_dir_existed
+#include "runtime/thread_context.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -103,6 +107,37 @@ Status _write_cluster_id_to_path(const std::string& path, int32_t cluster_id) {
     return Status::OK();
 }
 
+// The number of metas iterated from the meta env before they are loaded in parallel
+constexpr size_t LOAD_META_BATCH_SIZE = 4096;
+
+// Run `func(i)` for each i in [0, n) with the threads of `pool` and the calling thread, or only
+// the calling thread if `pool` is nullptr, and wait for all of them to finish.
+void parallel_for(ThreadPool* pool, size_t n, const std::function<void(size_t)>& func) {
+    std::atomic<size_t> next = 0;
+    auto run = [&] {
+        for (size_t i = next++; i < n; i = next++) {
+            func(i);
+        }
+    };
+    if (pool != nullptr) {
+        auto num_tasks = std::min(n, static_cast<size_t>(pool->max_threads()));
+        for (size_t i = 0; i < num_tasks; ++i) {
+            auto st = pool->submit_func([&run] {
+                SCOPED_INIT_THREAD_CONTEXT();
+                run();
+            });
+            if (!st.ok()) {
+                // the calling thread runs the left items
+                break;
+            }
+        }
+    }
+    run();
+    if (pool != nullptr) {
+        pool->wait();
+    }
+}
+
 } // namespace
 
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_total_capacity, MetricUnit::BYTES);
@@ -353,16 +388,35 @@ Status DataDir::load() {
     // necessarily check incompatible old format. when there are old metas, it may load to data missing
     RETURN_IF_ERROR(_check_incompatible_old_format_tablet());
 
+    // The metas are iterated from the meta env sequentially, which is cheap, while the costly
+    // parsing of rowset metas and building of tablets run in parallel, one batch at a time.
+    std::unique_ptr<ThreadPool> load_meta_pool;
+    if (config::load_tablet_meta_threads_per_data_dir > 1) {
+        // the calling thread also works on the batches
+        auto st = ThreadPoolBuilder("load_tablet_meta")
+                          .set_min_threads(config::load_tablet_meta_threads_per_data_dir - 1)
+                          .set_max_threads(config::load_tablet_meta_threads_per_data_dir - 1)
+                          .build(&load_meta_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to build load tablet meta pool, load metas serially. st="
+                         << st << ", data dir: " << _path;
+            load_meta_pool.reset();
+        }
+    }
+
     std::vector<RowsetMetaSharedPtr> dir_rowset_metas;
     LOG(INFO) << "begin loading rowset from meta";
-    auto load_rowset_func = [&dir_rowset_metas, this](TabletUid tablet_uid, RowsetId rowset_id,
-                                                      std::string_view meta_str) -> bool {
-        RowsetMetaSharedPtr rowset_meta(new RowsetMeta());
+    // set `rowset_meta` to nullptr to skip the rowset
+    auto parse_rowset_func = [this](const TabletUid& tablet_uid, const RowsetId& rowset_id,
+                                    std::string_view meta_str,
+                                    RowsetMetaSharedPtr& rowset_meta) -> Status {
+        rowset_meta = std::make_shared<RowsetMeta>();
         bool parsed = rowset_meta->init(meta_str);
         if (!parsed) {
             LOG(WARNING) << "parse rowset meta string failed for rowset_id:" << rowset_id;
-            // return false will break meta iterator, return true to skip this error
-            return true;
+            rowset_meta.reset();
+            // skip this error
+            return Status::OK();
         }
 
         if (rowset_meta->has_delete_predicate()) {
@@ -400,12 +454,46 @@ Status DataDir::load() {
                          << " load from meta but partition id eq 0";
         }
 
-        dir_rowset_metas.push_back(rowset_meta);
-        return true;
+        return Status::OK();
+    };
+    std::vector<std::tuple<TabletUid, RowsetId, std::string>> rowset_meta_batch;
+    auto flush_rowset_metas = [&]() -> Status {
+        std::vector<RowsetMetaSharedPtr> rowset_metas(rowset_meta_batch.size());
+        std::mutex st_mtx;
+        Status st;
+        parallel_for(load_meta_pool.get(), rowset_meta_batch.size(), [&](size_t i) {
+            const auto& [tablet_uid, rowset_id, meta_str] = rowset_meta_batch[i];
+            auto parse_st = parse_rowset_func(tablet_uid, rowset_id, meta_str, rowset_metas[i]);
+            if (!parse_st.ok()) {
+                rowset_metas[i].reset();
+                std::lock_guard lock(st_mtx);
+                st = std::move(parse_st);
+            }
+        });
+        rowset_meta_batch.clear();
+        for (auto& rowset_meta : rowset_metas) {
+            if (rowset_meta != nullptr) {
+                dir_rowset_metas.push_back(std::move(rowset_meta));
+            }
+        }
+        return st;
+    };
+    Status flush_rowset_status;
+    auto load_rowset_func = [&](const TabletUid& tablet_uid, const RowsetId& rowset_id,
+                                std::string_view meta_str) -> bool {
+        rowset_meta_batch.emplace_back(tablet_uid, rowset_id, std::string(meta_str));
+        if (rowset_meta_batch.size() >= LOAD_META_BATCH_SIZE) {
+            flush_rowset_status = flush_rowset_metas();
+        }
+        // return false will break meta iterator
+        return flush_rowset_status.ok();
     };
     MonotonicStopWatch rs_timer;
     rs_timer.start();
     Status load_rowset_status = RowsetMetaManager::traverse_rowset_metas(_meta, load_rowset_func);
+    if (load_rowset_status.ok()) {
+        load_rowset_status = flush_rowset_status.ok() ? flush_rowset_metas() : flush_rowset_status;
+    }
     rs_timer.stop();
     if (!load_rowset_status) {
         LOG(WARNING) << "errors when load rowset meta from meta env, skip this data dir:" << _path;
@@ -417,11 +505,11 @@ Status DataDir::load() {
     // load tablet
     // create tablet from tablet meta and add it to tablet mgr
     LOG(INFO) << "begin loading tablet from meta";
+    std::mutex tablet_ids_mtx;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
-                                    int64_t tablet_id, int32_t schema_hash,
-                                    std::string_view value) -> bool {
+    auto load_tablet = [this, &tablet_ids_mtx, &tablet_ids, &failed_tablet_ids](
+                               int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
@@ -442,15 +530,33 @@ Status DataDir::load() {
             // failure.
             LOG(WARNING) << "load tablet from header failed. status:" << status
                          << ", tablet=" << tablet_id << "." << schema_hash;
+            std::lock_guard lock(tablet_ids_mtx);
             failed_tablet_ids.insert(tablet_id);
         } else {
+            std::lock_guard lock(tablet_ids_mtx);
             tablet_ids.insert(tablet_id);
         }
+    };
+    std::vector<std::tuple<int64_t, int32_t, std::string>> tablet_meta_batch;
+    auto flush_tablet_metas = [&]() {
+        parallel_for(load_meta_pool.get(), tablet_meta_batch.size(), [&](size_t i) {
+            const auto& [tablet_id, schema_hash, value] = tablet_meta_batch[i];
+            load_tablet(tablet_id, schema_hash, value);
+        });
+        tablet_meta_batch.clear();
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash,
+                                std::string_view value) -> bool {
+        tablet_meta_batch.emplace_back(tablet_id, schema_hash, std::string(value));
+        if (tablet_meta_batch.size() >= LOAD_META_BATCH_SIZE) {
+            flush_tablet_metas();
+        }
         return true;
     };
     MonotonicStopWatch tablet_timer;
     tablet_timer.start();
     Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    flush_tablet_metas();
     tablet_timer.stop();
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
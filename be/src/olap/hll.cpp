@@ -17,6 +17,7 @@
 
 #include "olap/hll.h"
 
+#include <array>
 #include <cmath>
 #include <map>
 #include <ostream>
@@ -139,6 +140,47 @@ void HyperLogLog::merge(const HyperLogLog& other) {
     }
 }
 
+void HyperLogLog::merge_batch(const HyperLogLog* others, size_t num) {
+    auto has_registers = [](const HyperLogLog& hll) {
+        return hll._type == HLL_DATA_SPARSE || hll._type == HLL_DATA_FULL;
+    };
+    bool to_registers = has_registers(*this);
+    for (size_t i = 0; i < num && !to_registers; ++i) {
+        to_registers = has_registers(others[i]);
+    }
+    if (!to_registers) {
+        // only explicit values, they may stay explicit
+        for (size_t i = 0; i < num; ++i) {
+            merge(others[i]);
+        }
+        return;
+    }
+
+    if (_type == HLL_DATA_EXPLICIT) {
+        _convert_explicit_to_register();
+    } else if (_type == HLL_DATA_EMPTY) {
+        _registers = new uint8_t[HLL_REGISTERS_COUNT];
+        memset(_registers, 0, HLL_REGISTERS_COUNT);
+    }
+    _type = HLL_DATA_FULL;
+    for (size_t i = 0; i < num; ++i) {
+        const auto& other = others[i];
+        switch (other._type) {
+        case HLL_DATA_EXPLICIT:
+            for (auto hash_value : other._hash_set) {
+                _update_registers(hash_value);
+            }
+            break;
+        case HLL_DATA_SPARSE:
+        case HLL_DATA_FULL:
+            _merge_registers(other._registers);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
 size_t HyperLogLog::max_serialized_size() const {
     switch (_type) {
     case HLL_DATA_EMPTY:
@@ -334,15 +376,23 @@ int64_t HyperLogLog::estimate_cardinality() const {
         alpha = 0.7213F / (1 + 1.079F / num_streams);
     }
 
+    // 2^-x of every possible register value, the same values as computed by powf
+    static const auto inverse_powers = [] {
+        std::array<float, 256> powers {};
+        for (int i = 0; i < 256; ++i) {
+            powers[i] = powf(2.0F, static_cast<float>(-i));
+        }
+        return powers;
+    }();
+
+    // the sum keeps the order of registers, so the estimate does not change
     float harmonic_mean = 0;
+    for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
+        harmonic_mean += inverse_powers[_registers[i]];
+    }
     int num_zero_registers = 0;
-
     for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += powf(2.0F, -_registers[i]);
-
-        if (_registers[i] == 0) {
-            ++num_zero_registers;
-        }
+        num_zero_registers += (_registers[i] == 0);
     }
 
     harmonic_mean = 1.0F / harmonic_mean;
@@ -25,6 +25,8 @@
 
 #ifdef __x86_64__
 #include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
 #endif
 
 #include "vec/common/hash_table/phmap_fwd_decl.h"
@@ -207,6 +209,11 @@ public:
 
     void merge(const HyperLogLog& other);
 
+    // Merge `num` values at once. When any of them has registers, this value turns into
+    // registers only once and every other value is absorbed into them, instead of going
+    // through the explicit set of every value.
+    void merge_batch(const HyperLogLog* others, size_t num);
+
     // Return max size of serialized binary
     size_t max_serialized_size() const;
 
@@ -287,6 +294,11 @@ private:
             src += 32;
             dst += 32;
         }
+#elif defined(__aarch64__)
+        for (int i = 0; i < HLL_REGISTERS_COUNT; i += 16) {
+            vst1q_u8(_registers + i,
+                     vmaxq_u8(vld1q_u8(_registers + i), vld1q_u8(other_registers + i)));
+        }
 #else
         for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
             _registers[i] =
@@ -360,6 +360,8 @@ public:
         return get_in_list_ignore_thredhold(_values->size());
     }
 
+    size_t in_list_size() const override { return _values->size(); }
+
 private:
     uint16_t _evaluate_inner(const vectorized::IColumn& column, uint16_t* sel,
                              uint16_t size) const override {
@@ -19,6 +19,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <unordered_map>
 
 #include "common/status.h"
 #include "io/io_common.h"
@@ -43,8 +44,13 @@ struct IteratorRowRef;
 
 namespace segment_v2 {
 struct SubstreamIterator;
+class VariantRootColumnReader;
 }
 
+// variant unique id -> the root column reader shared by the iterators of its sparse paths
+using VariantRootReaders =
+        std::unordered_map<int32_t, std::shared_ptr<segment_v2::VariantRootColumnReader>>;
+
 class StorageReadOptions {
 public:
     struct KeyRange {
@@ -119,6 +125,8 @@ public:
     std::map<std::string, PrimitiveType> target_cast_type_for_variants;
     RowRanges row_ranges;
     size_t topn_limit = 0;
+    // each segment iterator sets its own, so a variant root is read once per batch
+    std::shared_ptr<VariantRootReaders> variant_root_readers;
 };
 
 struct CompactionSampleInfo {
@@ -19,6 +19,10 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
 #include "util/simd/vstring_function.h"
 
 namespace doris {
@@ -76,4 +80,137 @@ bool NgramTokenExtractor::next_in_string_like(const char* data, size_t length, s
 
     return false;
 }
+
+void NgramTokenExtractor::string_to_bloom_filter(const char* data, size_t length,
+                                                 segment_v2::BloomFilter& bloom_filter) const {
+    if (!simd::VStringFunctions::is_ascii(StringRef(data, length))) {
+        ITokenExtractorHelper<NgramTokenExtractor>::string_to_bloom_filter(data, length,
+                                                                           bloom_filter);
+        return;
+    }
+    for (size_t i = 0; i + n <= length; ++i) {
+        bloom_filter.add_bytes(data + i, n);
+    }
+}
+
+void extract_regexp_literals(const char* data, size_t length, std::vector<std::string>* literals) {
+    literals->clear();
+    std::string current;
+    // the bytes of the last char of current, which a quantifier may make optional
+    size_t last_char_size = 0;
+    auto flush = [&]() {
+        if (!current.empty()) {
+            literals->push_back(std::move(current));
+            current.clear();
+        }
+        last_char_size = 0;
+    };
+    auto give_up = [&]() { literals->clear(); };
+    // skip the char class starting at i, return the position after it
+    auto skip_class = [&](size_t i) {
+        ++i;
+        if (i < length && data[i] == '^') {
+            ++i;
+        }
+        if (i < length && data[i] == ']') {
+            ++i;
+        }
+        while (i < length && data[i] != ']') {
+            i += data[i] == '\\' ? 2 : 1;
+        }
+        return i + 1;
+    };
+
+    for (size_t i = 0; i < length;) {
+        char c = data[i];
+        switch (c) {
+        case '|':
+            give_up();
+            return;
+        case '(': {
+            if (i + 1 < length && data[i + 1] == '?') {
+                // the flags may change how the rest of the pattern matches, e.g. (?i)
+                give_up();
+                return;
+            }
+            // the group may be optional or hold an alternation, none of it is required
+            flush();
+            int depth = 0;
+            for (; i < length; ++i) {
+                if (data[i] == '\\') {
+                    ++i;
+                } else if (data[i] == '[') {
+                    i = skip_class(i) - 1;
+                } else if (data[i] == '(') {
+                    ++depth;
+                } else if (data[i] == ')' && --depth == 0) {
+                    break;
+                }
+            }
+            if (depth != 0) {
+                give_up();
+                return;
+            }
+            ++i;
+            break;
+        }
+        case '[':
+            flush();
+            i = skip_class(i);
+            break;
+        case '.':
+        case '^':
+        case '$':
+            flush();
+            ++i;
+            break;
+        case '*':
+        case '?':
+        case '{':
+            // the last char may be repeated zero times
+            current.resize(current.size() - last_char_size);
+            flush();
+            if (c == '{') {
+                while (i < length && data[i] != '}') {
+                    ++i;
+                }
+            }
+            ++i;
+            break;
+        case '+':
+            // the last char is there at least once, but may be repeated
+            flush();
+            ++i;
+            break;
+        case '\\': {
+            if (i + 1 >= length) {
+                give_up();
+                return;
+            }
+            char next = data[i + 1];
+            auto next_byte = static_cast<unsigned char>(next);
+            if (next_byte < 0x80 && !std::isalnum(next_byte)) {
+                current += next;
+                last_char_size = 1;
+            } else if (std::strchr("dDwWsSbBAzZ", next) != nullptr) {
+                flush();
+            } else {
+                // e.g. \x41, \pL or \Q...\E, which are not worth parsing here
+                give_up();
+                return;
+            }
+            i += 2;
+            break;
+        }
+        default: {
+            size_t sz = std::min<size_t>(get_utf8_byte_length(static_cast<uint8_t>(c)), length - i);
+            current.append(data + i, sz);
+            last_char_size = sz;
+            i += sz;
+            break;
+        }
+        }
+    }
+    flush();
+}
 } // namespace doris
@@ -21,12 +21,18 @@
 #include <stddef.h>
 
 #include <string>
+#include <vector>
 
 #include "olap/rowset/segment_v2/bloom_filter.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
 
+/// Collect the literals every match of the regular expression contains. It is conservative,
+/// a part of the pattern it doesn't understand never yields a literal, and a pattern with an
+/// alternation or flags yields none.
+void extract_regexp_literals(const char* data, size_t length, std::vector<std::string>* literals);
+
 /// Interface for string parsers.
 struct ITokenExtractor {
     virtual ~ITokenExtractor() = default;
@@ -48,6 +54,11 @@ struct ITokenExtractor {
 
     virtual bool string_like_to_bloom_filter(const char* data, size_t length,
                                              segment_v2::BloomFilter& bloom_filter) const = 0;
+
+    /// Special implementation for creating bloom filter for REGEXP function, from the tokens of
+    /// the literals every match contains. Returns false if there is no token.
+    virtual bool string_regexp_to_bloom_filter(const char* data, size_t length,
+                                               segment_v2::BloomFilter& bloom_filter) const = 0;
 };
 
 template <typename Derived>
@@ -78,6 +89,25 @@ public:
 
         return added;
     }
+
+    bool string_regexp_to_bloom_filter(const char* data, size_t length,
+                                       segment_v2::BloomFilter& bloom_filter) const override {
+        std::vector<std::string> literals;
+        extract_regexp_literals(data, length, &literals);
+        bool added = false;
+        for (const auto& literal : literals) {
+            size_t cur = 0;
+            size_t token_start = 0;
+            size_t token_len = 0;
+            while (cur < literal.size() &&
+                   static_cast<const Derived*>(this)->next_in_string(
+                           literal.data(), literal.size(), &cur, &token_start, &token_len)) {
+                bloom_filter.add_bytes(literal.data() + token_start, token_len);
+                added = true;
+            }
+        }
+        return added;
+    }
 };
 
 /// Parser extracting all ngrams from string.
@@ -92,6 +122,11 @@ public:
     bool next_in_string_like(const char* data, size_t length, size_t* pos,
                              std::string& token) const override;
 
+    /// The ngrams of an ASCII string are its windows of n bytes, they are added without looking
+    /// up the length of each char.
+    void string_to_bloom_filter(const char* data, size_t length,
+                                segment_v2::BloomFilter& bloom_filter) const override;
+
 private:
     size_t n;
 };
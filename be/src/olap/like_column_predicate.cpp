@@ -61,16 +61,12 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
             auto* nested_col_ptr =
                     vectorized::check_and_get_column<vectorized::ColumnDictI32>(nested_col);
             auto& data_array = nested_col_ptr->get_data();
+            const auto& value_in_dict_flags = _find_dict_flags(*nested_col_ptr);
             if (!nullable_col->has_null()) {
                 for (uint16_t i = 0; i != size; i++) {
                     uint16_t idx = sel[i];
                     sel[new_size] = idx;
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[idx]);
-                    unsigned char flag = 0;
-                    THROW_IF_ERROR((_state->scalar_function)(
-                            const_cast<vectorized::LikeSearchState*>(&_like_state),
-                            StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                    new_size += _opposite ^ flag;
+                    new_size += _opposite ^ value_in_dict_flags[data_array[idx]];
                 }
             } else {
                 for (uint16_t i = 0; i != size; i++) {
@@ -80,13 +76,7 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
                         new_size += _opposite;
                         continue;
                     }
-
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[idx]);
-                    unsigned char flag = 0;
-                    THROW_IF_ERROR((_state->scalar_function)(
-                            const_cast<vectorized::LikeSearchState*>(&_like_state),
-                            StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                    new_size += _opposite ^ flag;
+                    new_size += _opposite ^ value_in_dict_flags[data_array[idx]];
                 }
             }
         } else {
@@ -126,15 +116,11 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
             auto* nested_col_ptr =
                     vectorized::check_and_get_column<vectorized::ColumnDictI32>(column);
             auto& data_array = nested_col_ptr->get_data();
+            const auto& value_in_dict_flags = _find_dict_flags(*nested_col_ptr);
             for (uint16_t i = 0; i != size; i++) {
                 uint16_t idx = sel[i];
                 sel[new_size] = idx;
-                StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[idx]);
-                unsigned char flag = 0;
-                THROW_IF_ERROR((_state->scalar_function)(
-                        const_cast<vectorized::LikeSearchState*>(&_like_state),
-                        StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                new_size += _opposite ^ flag;
+                new_size += _opposite ^ value_in_dict_flags[data_array[idx]];
             }
         } else {
             const vectorized::PredicateColumnType<T>* str_col =
@@ -155,6 +141,24 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
     return new_size;
 }
 
+template <PrimitiveType T>
+const std::vector<vectorized::UInt8>& LikeColumnPredicate<T>::_find_dict_flags(
+        const vectorized::ColumnDictI32& column) const {
+    auto& value_in_dict_flags = _segment_id_to_value_in_dict_flags[column.get_rowset_segment_id()];
+    if (value_in_dict_flags.size() != column.dict_size()) {
+        value_in_dict_flags.resize(column.dict_size());
+        for (size_t code = 0; code < column.dict_size(); ++code) {
+            StringRef dict_value = column.get_shrink_value(static_cast<Int32>(code));
+            unsigned char flag = 0;
+            THROW_IF_ERROR((_state->scalar_function)(
+                    const_cast<vectorized::LikeSearchState*>(&_like_state), dict_value, pattern,
+                    &flag));
+            value_in_dict_flags[code] = flag;
+        }
+    }
+    return value_in_dict_flags;
+}
+
 template class LikeColumnPredicate<TYPE_CHAR>;
 template class LikeColumnPredicate<TYPE_STRING>;
 
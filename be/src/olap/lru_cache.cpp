@@ -4,6 +4,7 @@
 
 #include "olap/lru_cache.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <mutex>
 #include <new>
@@ -164,7 +165,60 @@ uint32_t HandleTable::element_count() const {
     return _elems;
 }
 
-LRUCache::LRUCache(LRUCacheType type, bool is_lru_k) : _type(type), _is_lru_k(is_lru_k) {
+void FrequencySketch::init(size_t num_counters) {
+    size_t row_counters = 64;
+    while (row_counters < num_counters && row_counters < (1UL << 24)) {
+        row_counters <<= 1;
+    }
+    _row_words = row_counters / 16;
+    _table.assign(NUM_ROWS * _row_words, 0);
+    _additions = 0;
+    _sample_size = 10 * row_counters;
+}
+
+size_t FrequencySketch::_counter_index(uint32_t hash, int row) const {
+    static constexpr uint64_t SEEDS[NUM_ROWS] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                                 0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+    uint64_t h = (hash + SEEDS[row]) * SEEDS[row];
+    h ^= h >> 32;
+    return h & (_row_words * 16 - 1);
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    bool added = false;
+    for (int row = 0; row < NUM_ROWS; ++row) {
+        size_t index = _counter_index(hash, row);
+        uint64_t& word = _table[row * _row_words + index / 16];
+        const auto shift = (index % 16) * 4;
+        if (((word >> shift) & 0xf) < 0xf) {
+            word += 1ULL << shift;
+            added = true;
+        }
+    }
+    if (added && ++_additions >= _sample_size) {
+        _reset();
+    }
+}
+
+uint32_t FrequencySketch::frequency(uint32_t hash) const {
+    uint32_t min_count = 0xf;
+    for (int row = 0; row < NUM_ROWS; ++row) {
+        size_t index = _counter_index(hash, row);
+        uint64_t word = _table[row * _row_words + index / 16];
+        min_count = std::min(min_count, static_cast<uint32_t>((word >> ((index % 16) * 4)) & 0xf));
+    }
+    return min_count;
+}
+
+void FrequencySketch::_reset() {
+    for (auto& word : _table) {
+        word = (word >> 1) & 0x7777777777777777ULL;
+    }
+    _additions /= 2;
+}
+
+LRUCache::LRUCache(LRUCacheType type, bool is_lru_k, bool is_tiny_lfu)
+        : _type(type), _is_lru_k(is_lru_k), _is_tiny_lfu(is_tiny_lfu) {
     // Make empty circular linked list
     _lru_normal.next = &_lru_normal;
     _lru_normal.prev = &_lru_normal;
@@ -181,6 +235,10 @@ PrunedInfo LRUCache::set_capacity(size_t capacity) {
     {
         std::lock_guard l(_mutex);
         _capacity = capacity;
+        if (_is_tiny_lfu && !_frequency_sketch.initialized()) {
+            // about a counter per entry, taking 8KB as the size of an entry of a SIZE cache
+            _frequency_sketch.init(_type == LRUCacheType::SIZE ? capacity / 8192 : capacity);
+        }
         _evict_from_lru(0, &last_ref_list);
     }
 
@@ -288,6 +346,9 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     std::lock_guard l(_mutex);
     ++_lookup_count;
+    if (_is_tiny_lfu) {
+        _frequency_sketch.increment(hash);
+    }
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
@@ -456,6 +517,35 @@ bool LRUCache::_lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key
     return false;
 }
 
+// After cache is full, return true to reject the new entry if it is not looked up more often
+// than the entry it would evict first.
+bool LRUCache::_tiny_lfu_reject(const CacheKey& key, size_t total_size, uint32_t hash) {
+    if (_usage + total_size <= _capacity && !_check_element_count_limit()) {
+        return false;
+    }
+    // replacing an entry of the same key is always allowed
+    if (_table.lookup(key, hash) != nullptr) {
+        return false;
+    }
+    LRUHandle* victim = nullptr;
+    if (_cache_value_check_timestamp) {
+        if (!_sorted_normal_entries_with_timestamp.empty()) {
+            victim = _sorted_normal_entries_with_timestamp.begin()->second;
+        } else if (!_sorted_durable_entries_with_timestamp.empty()) {
+            victim = _sorted_durable_entries_with_timestamp.begin()->second;
+        }
+    } else if (_lru_normal.next != &_lru_normal) {
+        victim = _lru_normal.next;
+    } else if (_lru_durable.next != &_lru_durable) {
+        victim = _lru_durable.next;
+    }
+    // all entries are in use, nothing can be evicted anyway
+    if (victim == nullptr) {
+        return false;
+    }
+    return _frequency_sketch.frequency(hash) <= _frequency_sketch.frequency(victim->hash);
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 CachePriority priority) {
     size_t handle_size = sizeof(LRUHandle) - 1 + key.size();
@@ -479,7 +569,11 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     {
         std::lock_guard l(_mutex);
 
-        if (_is_lru_k && _lru_k_insert_visits_list(e->total_size, hash)) {
+        if (_is_tiny_lfu) {
+            if (_tiny_lfu_reject(key, e->total_size, hash)) {
+                return reinterpret_cast<Cache::Handle*>(e);
+            }
+        } else if (_is_lru_k && _lru_k_insert_visits_list(e->total_size, hash)) {
             return reinterpret_cast<Cache::Handle*>(e);
         }
 
@@ -640,7 +734,7 @@ inline uint32_t ShardedLRUCache::_hash_slice(const CacheKey& s) {
 
 ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCacheType type,
                                  uint32_t num_shards, uint32_t total_element_count_capacity,
-                                 bool is_lru_k)
+                                 bool is_lru_k, bool is_tiny_lfu)
         : _name(name),
           _num_shard_bits(__builtin_ctz(num_shards)),
           _num_shards(num_shards),
@@ -655,7 +749,7 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
             (total_element_count_capacity + (_num_shards - 1)) / _num_shards;
     auto** shards = new (std::nothrow) LRUCache*[_num_shards];
     for (int s = 0; s < _num_shards; s++) {
-        shards[s] = new LRUCache(type, is_lru_k);
+        shards[s] = new LRUCache(type, is_lru_k, is_tiny_lfu);
         shards[s]->set_capacity(per_shard);
         shards[s]->set_element_count_capacity(per_shard_element_count_capacity);
     }
@@ -686,9 +780,10 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
                                  uint32_t num_shards,
                                  CacheValueTimeExtractor cache_value_time_extractor,
                                  bool cache_value_check_timestamp,
-                                 uint32_t total_element_count_capacity, bool is_lru_k)
+                                 uint32_t total_element_count_capacity, bool is_lru_k,
+                                 bool is_tiny_lfu)
         : ShardedLRUCache(name, capacity, type, num_shards, total_element_count_capacity,
-                          is_lru_k) {
+                          is_lru_k, is_tiny_lfu) {
     for (int s = 0; s < _num_shards; s++) {
         _shards[s]->set_cache_value_time_extractor(cache_value_time_extractor);
         _shards[s]->set_cache_value_check_timestamp(cache_value_check_timestamp);
@@ -789,6 +884,22 @@ size_t ShardedLRUCache::get_element_count() {
     return total_element_count;
 }
 
+uint64_t ShardedLRUCache::get_lookup_count() {
+    uint64_t total_lookup_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_lookup_count += _shards[i]->get_lookup_count();
+    }
+    return total_lookup_count;
+}
+
+uint64_t ShardedLRUCache::get_hit_count() {
+    uint64_t total_hit_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_hit_count += _shards[i]->get_hit_count();
+    }
+    return total_hit_count;
+}
+
 void ShardedLRUCache::update_cache_metrics() const {
     size_t capacity = 0;
     size_t total_usage = 0;
@@ -19,6 +19,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "runtime/memory/lru_cache_value_base.h"
 #include "util/doris_metrics.h"
@@ -40,6 +41,7 @@ static constexpr LRUCacheType DEFAULT_LRU_CACHE_TYPE = LRUCacheType::SIZE;
 static constexpr uint32_t DEFAULT_LRU_CACHE_NUM_SHARDS = 32;
 static constexpr size_t DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY = 0;
 static constexpr bool DEFAULT_LRU_CACHE_IS_LRU_K = false;
+static constexpr bool DEFAULT_LRU_CACHE_IS_TINY_LFU = false;
 
 class CacheKey {
 public:
@@ -214,6 +216,10 @@ public:
 
     virtual size_t get_element_count() = 0;
 
+    // The lookups and hits since the cache is created.
+    virtual uint64_t get_lookup_count() { return 0; }
+    virtual uint64_t get_hit_count() { return 0; }
+
 private:
     DISALLOW_COPY_AND_ASSIGN(Cache);
 };
@@ -305,10 +311,34 @@ private:
 // because the begin element's timestamp is the oldest.
 using LRUHandleSortedSet = std::set<std::pair<int64_t, LRUHandle*>>;
 
+// A count-min sketch of 4-bit counters, estimating how often a key hash was looked up.
+// All counters are halved every `10 * counters` additions, so the estimate follows the
+// recent accesses.
+class FrequencySketch {
+public:
+    // `num_counters` is rounded up to a power of two, of at least 64.
+    void init(size_t num_counters);
+    bool initialized() const { return !_table.empty(); }
+    void increment(uint32_t hash);
+    uint32_t frequency(uint32_t hash) const;
+
+private:
+    static constexpr int NUM_ROWS = 4;
+    size_t _counter_index(uint32_t hash, int row) const;
+    void _reset();
+
+    // NUM_ROWS rows of `_row_words` words, each word holds 16 counters
+    std::vector<uint64_t> _table;
+    size_t _row_words = 0;
+    size_t _additions = 0;
+    size_t _sample_size = 0;
+};
+
 // A single shard of sharded cache.
 class LRUCache {
 public:
-    LRUCache(LRUCacheType type, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K);
+    LRUCache(LRUCacheType type, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K,
+             bool is_tiny_lfu = DEFAULT_LRU_CACHE_IS_TINY_LFU);
     ~LRUCache();
 
     // visits_lru_cache_key is the hash value of CacheKey.
@@ -355,6 +385,7 @@ private:
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
     bool _lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key visits_key);
+    bool _tiny_lfu_reject(const CacheKey& key, size_t total_size, uint32_t hash);
 
 private:
     LRUCacheType _type;
@@ -392,6 +423,11 @@ private:
     std::unordered_map<visits_lru_cache_key, std::list<visits_lru_cache_pair>::iterator>
             _visits_lru_cache_map;
     size_t _visits_lru_cache_usage = 0;
+
+    // TinyLFU admission, once the cache is full a new entry only replaces the least recently
+    // used one when it was looked up more often, so a large scan does not flush the hot entries.
+    bool _is_tiny_lfu = false;
+    FrequencySketch _frequency_sketch;
 };
 
 class ShardedLRUCache : public Cache {
@@ -410,18 +446,21 @@ public:
     size_t get_element_count() override;
     PrunedInfo set_capacity(size_t capacity) override;
     size_t get_capacity() override;
+    uint64_t get_lookup_count() override;
+    uint64_t get_hit_count() override;
 
 private:
     // LRUCache can only be created and managed with LRUCachePolicy.
     friend class LRUCachePolicy;
 
     explicit ShardedLRUCache(const std::string& name, size_t capacity, LRUCacheType type,
-                             uint32_t num_shards, uint32_t element_count_capacity, bool is_lru_k);
+                             uint32_t num_shards, uint32_t element_count_capacity, bool is_lru_k,
+                             bool is_tiny_lfu);
     explicit ShardedLRUCache(const std::string& name, size_t capacity, LRUCacheType type,
                              uint32_t num_shards,
                              CacheValueTimeExtractor cache_value_time_extractor,
                              bool cache_value_check_timestamp, uint32_t element_count_capacity,
-                             bool is_lru_k);
+                             bool is_lru_k, bool is_tiny_lfu);
 
     void update_cache_metrics() const;
 
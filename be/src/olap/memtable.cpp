@@ -37,6 +37,7 @@
 #include "util/debug_points.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
@@ -68,6 +69,7 @@ MemTable::MemTable(int64_t tablet_id, std::shared_ptr<TabletSchema> tablet_schem
             _resource_ctx->memory_context()->mem_tracker()->write_tracker());
     SCOPED_CONSUME_MEM_TRACKER(_mem_tracker);
     _arena = std::make_unique<vectorized::Arena>();
+    _row_arena = std::make_unique<vectorized::Arena>();
     _vec_row_comparator = std::make_shared<RowInBlockComparator>(_tablet_schema);
     _num_columns = _tablet_schema->num_columns();
     if (partial_update_info != nullptr) {
@@ -169,11 +171,10 @@ MemTable::~MemTable() {
             }
         }
 
-        std::for_each(_row_in_blocks->begin(), _row_in_blocks->end(),
-                      std::default_delete<RowInBlock>());
         // Arena has to be destroyed after agg state, because some agg state's memory may be
         // allocated in arena.
         _arena.reset();
+        _row_arena.reset();
         _vec_row_comparator.reset();
         _row_in_blocks.reset();
         _agg_functions.clear();
@@ -202,6 +203,7 @@ Status MemTable::insert(const vectorized::Block* input_block,
 
     if (_is_first_insertion) {
         _is_first_insertion = false;
+        _row_in_blocks->reserve(_estimated_rows);
         auto clone_block = input_block->clone_without_columns(&_column_offset);
         _input_mutable_block = vectorized::MutableBlock::build_mutable_block(&clone_block);
         _vec_row_comparator->set_block(&_input_mutable_block);
@@ -240,7 +242,7 @@ Status MemTable::insert(const vectorized::Block* input_block,
     RETURN_IF_ERROR(_input_mutable_block.add_rows(input_block, row_idxs.data(),
                                                   row_idxs.data() + num_rows, &_column_offset));
     for (int i = 0; i < num_rows; i++) {
-        _row_in_blocks->emplace_back(new RowInBlock {cursor_in_mutableblock + i});
+        _row_in_blocks->emplace_back(_new_row_in_block(cursor_in_mutableblock + i));
     }
 
     _stat.raw_rows += num_rows;
@@ -305,12 +307,9 @@ Status MemTable::_put_into_output(vectorized::Block& in_block) {
                                           row_pos_vec.data() + in_block.rows());
 }
 
-size_t MemTable::_sort() {
-    SCOPED_RAW_TIMER(&_stat.sort_ns);
-    _stat.sort_times++;
+size_t MemTable::_sort_rows(size_t begin, size_t end) {
     size_t same_keys_num = 0;
-    // sort new rows
-    Tie tie = Tie(_last_sorted_pos, _row_in_blocks->size());
+    Tie tie = Tie(begin, end);
     for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
         auto cmp = [&](const RowInBlock* lhs, const RowInBlock* rhs) -> int {
             return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
@@ -328,6 +327,53 @@ size_t MemTable::_sort() {
                 });
         same_keys_num += iter.right() - iter.left();
     }
+    return same_keys_num;
+}
+
+size_t MemTable::_sort() {
+    SCOPED_RAW_TIMER(&_stat.sort_ns);
+    _stat.sort_times++;
+    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
+    size_t num_rows = _row_in_blocks->size();
+    size_t num_new_rows = num_rows - _last_sorted_pos;
+    // a large batch of new rows is sorted in parts at the same time, the parts are then merged
+    // like the new rows with the old ones
+    size_t num_parts = 1;
+    if (config::memtable_sort_thread_num > 1 && config::memtable_sort_part_rows > 0) {
+        num_parts = std::min<size_t>(config::memtable_sort_thread_num,
+                                     num_new_rows / config::memtable_sort_part_rows);
+        num_parts = std::max<size_t>(num_parts, 1);
+    }
+    std::vector<size_t> bounds(num_parts + 1);
+    for (size_t i = 0; i <= num_parts; ++i) {
+        bounds[i] = _last_sorted_pos + num_new_rows * i / num_parts;
+    }
+    std::vector<size_t> part_same_keys_num(num_parts, 0);
+    auto* pool = ExecEnv::GetInstance()->memtable_sort_thread_pool();
+    if (num_parts == 1 || pool == nullptr) {
+        for (size_t i = 0; i < num_parts; ++i) {
+            part_same_keys_num[i] = _sort_rows(bounds[i], bounds[i + 1]);
+        }
+    } else {
+        auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+        for (size_t i = 0; i < num_parts; ++i) {
+            auto st = token->submit_func([this, i, &bounds, &part_same_keys_num]() {
+                SCOPED_ATTACH_TASK(_resource_ctx);
+                SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(
+                        _resource_ctx->memory_context()->mem_tracker()->write_tracker());
+                part_same_keys_num[i] = _sort_rows(bounds[i], bounds[i + 1]);
+            });
+            if (!st.ok()) {
+                part_same_keys_num[i] = _sort_rows(bounds[i], bounds[i + 1]);
+            }
+        }
+        token->wait();
+    }
+    size_t same_keys_num = 0;
+    for (size_t num : part_same_keys_num) {
+        same_keys_num += num;
+    }
+
     // merge new rows and old rows
     _vec_row_comparator->set_block(&_input_mutable_block);
     auto cmp_func = [this, is_dup, &same_keys_num](const RowInBlock* l,
@@ -340,6 +386,11 @@ size_t MemTable::_sort() {
             return value < 0;
         }
     };
+    for (size_t i = 1; i < num_parts; ++i) {
+        std::inplace_merge(std::next(_row_in_blocks->begin(), _last_sorted_pos),
+                           std::next(_row_in_blocks->begin(), bounds[i]),
+                           std::next(_row_in_blocks->begin(), bounds[i + 1]), cmp_func);
+    }
     auto new_row_it = std::next(_row_in_blocks->begin(), _last_sorted_pos);
     std::inplace_merge(_row_in_blocks->begin(), new_row_it, _row_in_blocks->end(), cmp_func);
     _last_sorted_pos = _row_in_blocks->size();
@@ -357,13 +408,9 @@ Status MemTable::_sort_by_cluster_keys() {
     _output_mutable_block = vectorized::MutableBlock::build_mutable_block(&clone_block);
 
     DorisVector<RowInBlock*> row_in_blocks;
-    std::unique_ptr<int, std::function<void(int*)>> row_in_blocks_deleter((int*)0x01, [&](int*) {
-        std::for_each(row_in_blocks.begin(), row_in_blocks.end(),
-                      std::default_delete<RowInBlock>());
-    });
     row_in_blocks.reserve(mutable_block.rows());
     for (size_t i = 0; i < mutable_block.rows(); i++) {
-        row_in_blocks.emplace_back(new RowInBlock {i});
+        row_in_blocks.emplace_back(_new_row_in_block(i));
     }
     Tie tie = Tie(0, mutable_block.rows());
 
@@ -23,6 +23,7 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "common/status.h"
@@ -48,7 +49,8 @@ enum KeysType : int;
 // FLUSH: the memtable is under flushing, write segment to disk.
 enum MemType { ACTIVE = 0, WRITE_FINISHED = 1, FLUSH = 2 };
 
-// row pos in _input_mutable_block
+// row pos in _input_mutable_block, allocated from the row arena of the memtable and freed with it,
+// so it must stay trivially destructible.
 struct RowInBlock {
     size_t _row_pos;
     char* _agg_mem = nullptr;
@@ -69,6 +71,7 @@ struct RowInBlock {
 
     inline void remove_init_agg() { _has_init_agg = false; }
 };
+static_assert(std::is_trivially_destructible_v<RowInBlock>);
 
 class Tie {
 public:
@@ -204,6 +207,10 @@ public:
 
     void update_mem_type(MemType memtype) { _mem_type = memtype; }
 
+    // The rows of the previous memtable of the same writer, used to reserve the row refs on the
+    // first insertion.
+    void set_estimated_rows(size_t rows) { _estimated_rows = rows; }
+
 private:
     // for vectorized
     template <bool has_skip_bitmap_col>
@@ -231,6 +238,9 @@ private:
     // In this way, we can make MemTable::memory_usage() to be more accurate, and eventually
     // reduce the number of segment files that are generated by current load
     std::unique_ptr<vectorized::Arena> _arena;
+    // RowInBlock of the rows, they are not freed one by one but all at once with the memtable.
+    std::unique_ptr<vectorized::Arena> _row_arena;
+    size_t _estimated_rows = 0;
 
     void _init_columns_offset_by_slot_descs(const std::vector<SlotDescriptor*>* slot_descs,
                                             const TupleDescriptor* tuple_desc);
@@ -248,6 +258,11 @@ private:
 
     //return number of same keys
     size_t _sort();
+    RowInBlock* _new_row_in_block(size_t row_pos) {
+        return new (_row_arena->alloc<RowInBlock>()) RowInBlock {row_pos};
+    }
+    // sort the rows of [begin, end) by the keys, return number of same keys
+    size_t _sort_rows(size_t begin, size_t end);
     Status _sort_by_cluster_keys();
     void _sort_one_column(DorisVector<RowInBlock*>& row_in_blocks, Tie& tie,
                           std::function<int(const RowInBlock*, const RowInBlock*)> cmp);
@@ -83,7 +83,7 @@ std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat) {
     return os;
 }
 
-Status FlushToken::submit(std::shared_ptr<MemTable> mem_table) {
+Status FlushToken::submit(std::shared_ptr<MemTable> mem_table, bool is_blocking) {
     {
         std::shared_lock rdlk(_flush_status_lock);
         DBUG_EXECUTE_IF("FlushToken.submit_flush_error", {
@@ -108,8 +108,17 @@ Status FlushToken::submit(std::shared_ptr<MemTable> mem_table) {
     if (wg_sptr) {
         wg_thread_pool = wg_sptr->get_memtable_flush_pool();
     }
-    Status ret = wg_thread_pool ? wg_thread_pool->submit(std::move(task))
-                                : _thread_pool->submit(std::move(task));
+    ThreadPool* thread_pool = _thread_pool;
+    if (wg_thread_pool) {
+        thread_pool = wg_thread_pool;
+    } else if (is_blocking && _blocking_thread_pool != nullptr &&
+               static_cast<int64_t>(mem_table->memory_usage()) <=
+                       config::blocking_flush_memtable_max_bytes) {
+        // Don't queue behind the big memtables of other loads, the commit of the load is
+        // waiting for this one.
+        thread_pool = _blocking_thread_pool;
+    }
+    Status ret = thread_pool->submit(std::move(task));
     if (ret.ok()) {
         // _wait_running_task_finish was executed after this function, so no need to notify _cond here
         _stats.flush_running_count++;
@@ -207,6 +216,7 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
     _memtable_stat += memtable->stat();
     DorisMetrics::instance()->memtable_flush_total->increment(1);
     DorisMetrics::instance()->memtable_flush_duration_us->increment(duration_ns / 1000);
+    DorisMetrics::instance()->memtable_flush_latency_us->add(duration_ns / 1000);
     VLOG_CRITICAL << "after flush memtable for tablet: " << memtable->tablet_id()
                   << ", flushsize: " << PrettyPrinter::print_bytes(*flush_size);
     return Status::OK();
@@ -305,7 +315,7 @@ Status MemTableFlushExecutor::create_flush_token(std::shared_ptr<FlushToken>& fl
     case BETA_ROWSET: {
         // beta rowset can be flush in CONCURRENT, because each memtable using a new segment writer.
         ThreadPool* pool = is_high_priority ? _high_prio_flush_pool.get() : _flush_pool.get();
-        flush_token = FlushToken::create_shared(pool, wg_sptr);
+        flush_token = FlushToken::create_shared(pool, _high_prio_flush_pool.get(), wg_sptr);
         flush_token->set_rowset_writer(rowset_writer);
         return Status::OK();
     }
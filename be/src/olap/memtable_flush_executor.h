@@ -60,10 +60,15 @@ class FlushToken : public std::enable_shared_from_this<FlushToken> {
     ENABLE_FACTORY_CREATOR(FlushToken);
 
 public:
-    FlushToken(ThreadPool* thread_pool, std::shared_ptr<WorkloadGroup> wg_sptr)
-            : _flush_status(Status::OK()), _thread_pool(thread_pool), _wg_wptr(wg_sptr) {}
+    FlushToken(ThreadPool* thread_pool, ThreadPool* blocking_thread_pool,
+               std::shared_ptr<WorkloadGroup> wg_sptr)
+            : _flush_status(Status::OK()),
+              _thread_pool(thread_pool),
+              _blocking_thread_pool(blocking_thread_pool),
+              _wg_wptr(wg_sptr) {}
 
-    Status submit(std::shared_ptr<MemTable> mem_table);
+    // is_blocking means the writer will wait for this flush, see blocking_flush_memtable_max_bytes.
+    Status submit(std::shared_ptr<MemTable> mem_table, bool is_blocking = false);
 
     // error has happens, so we cancel this token
     // And remove all tasks in the queue.
@@ -110,6 +115,8 @@ private:
 
     std::atomic<bool> _shutdown = false;
     ThreadPool* _thread_pool = nullptr;
+    // the pool of the small memtables the writer is blocked on
+    ThreadPool* _blocking_thread_pool = nullptr;
 
     std::mutex _mutex;
     std::condition_variable _cond;
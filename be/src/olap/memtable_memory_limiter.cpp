@@ -239,8 +239,19 @@ int64_t MemTableMemoryLimiter::_flush_active_memtables(uint64_t wg_id, int64_t n
         return 0;
     }
 
-    using WriterMem = std::pair<std::weak_ptr<MemTableWriter>, int64_t>;
-    auto cmp = [](WriterMem left, WriterMem right) { return left.second < right.second; };
+    struct WriterMem {
+        std::weak_ptr<MemTableWriter> writer;
+        int64_t mem;
+        bool is_high_priority;
+    };
+    // The biggest memtables of the normal loads are flushed first, a high priority load is only
+    // made to flush when they are not enough, its latency is what the priority is for.
+    auto cmp = [](const WriterMem& left, const WriterMem& right) {
+        if (left.is_high_priority != right.is_high_priority) {
+            return left.is_high_priority;
+        }
+        return left.mem < right.mem;
+    };
     std::priority_queue<WriterMem, std::vector<WriterMem>, decltype(cmp)> heap(cmp);
 
     for (auto writer : _active_writers) {
@@ -248,14 +259,15 @@ int64_t MemTableMemoryLimiter::_flush_active_memtables(uint64_t wg_id, int64_t n
         if (w == nullptr) {
             continue;
         }
-        heap.emplace(w, w->active_memtable_mem_consumption());
+        heap.push({w, w->active_memtable_mem_consumption(), w->is_high_priority()});
     }
 
     int64_t mem_flushed = 0;
     int64_t num_flushed = 0;
 
     while (mem_flushed < need_flush && !heap.empty()) {
-        auto [writer, sort_mem] = heap.top();
+        auto writer = heap.top().writer;
+        auto sort_mem = heap.top().mem;
         heap.pop();
         auto w = writer.lock();
         if (w == nullptr) {
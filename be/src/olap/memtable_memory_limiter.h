@@ -53,6 +53,10 @@ public:
 
     int64_t mem_usage() const { return _mem_usage; }
 
+    // Whether the memory of loads is beyond the soft limit, background work of loads
+    // e.g. segcompaction should yield to memtable flushes then.
+    bool soft_limit_reached() { return _soft_limit_reached(); }
+
 private:
     // check if the total mem consumption exceeds limit.
     // If yes, it will flush memtable to try to reduce memory consumption.
@@ -137,7 +137,7 @@ Status MemTableWriter::write(const vectorized::Block* block,
     return Status::OK();
 }
 
-Status MemTableWriter::_flush_memtable_async() {
+Status MemTableWriter::_flush_memtable_async(bool is_blocking) {
     DCHECK(_flush_token != nullptr);
     std::shared_ptr<MemTable> memtable;
     {
@@ -145,12 +145,13 @@ Status MemTableWriter::_flush_memtable_async() {
         memtable = _mem_table;
         _mem_table = nullptr;
     }
+    _last_memtable_rows = memtable->stat().raw_rows;
     {
         std::lock_guard<std::mutex> l(_mem_table_ptr_lock);
         memtable->update_mem_type(MemType::WRITE_FINISHED);
         _freezed_mem_tables.push_back(memtable);
     }
-    return _flush_token->submit(memtable);
+    return _flush_token->submit(memtable, is_blocking);
 }
 
 Status MemTableWriter::flush_async() {
@@ -202,6 +203,7 @@ void MemTableWriter::_reset_mem_table() {
         std::lock_guard<std::mutex> l(_mem_table_ptr_lock);
         _mem_table.reset(new MemTable(_req.tablet_id, _tablet_schema, _req.slots, _req.tuple_desc,
                                       _unique_key_mow, _partial_update_info.get(), _resource_ctx));
+        _mem_table->set_estimated_rows(_last_memtable_rows);
     }
 
     _segment_num++;
@@ -223,7 +225,7 @@ Status MemTableWriter::close() {
         return Status::OK();
     }
 
-    auto s = _flush_memtable_async();
+    auto s = _flush_memtable_async(true);
     {
         std::lock_guard<std::mutex> l(_mem_table_ptr_lock);
         _mem_table.reset();
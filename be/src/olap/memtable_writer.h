@@ -100,6 +100,8 @@ public:
 
     uint64_t flush_running_count() const;
 
+    bool is_high_priority() const { return _req.is_high_priority; }
+
     uint64_t workload_group_id() const {
         auto wg = _resource_ctx->workload_group();
         if (wg != nullptr) {
@@ -110,7 +112,8 @@ public:
 
 private:
     // push a full memtable to flush executor
-    Status _flush_memtable_async();
+    // is_blocking means the caller will wait for the flush of this memtable.
+    Status _flush_memtable_async(bool is_blocking = false);
 
     void _reset_mem_table();
 
@@ -143,6 +146,8 @@ private:
     int64_t _wait_flush_time_ns = 0;
     int64_t _close_wait_time_ns = 0;
     int64_t _segment_num = 0;
+    // raw rows of the last flushed memtable, the next one is sized by it
+    size_t _last_memtable_rows = 0;
 
     MonotonicStopWatch _lock_watch;
 
@@ -23,6 +23,8 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -35,6 +37,7 @@
 
 #include "cloud/config.h"
 #include "common/config.h"
+#include "common/exception.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "olap/base_tablet.h"
@@ -52,7 +55,10 @@
 #include "olap/tablet_meta.h"
 #include "olap/tablet_reader.h"
 #include "olap/utils.h"
+#include "runtime/exec_env.h"
+#include "runtime/thread_context.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "vec/core/block.h"
 #include "vec/olap/block_reader.h"
 #include "vec/olap/vertical_block_reader.h"
@@ -240,6 +246,115 @@ void Merger::vertical_split_columns(const TabletSchema& tablet_schema,
     }
 }
 
+namespace {
+
+// Writes the merged blocks of a value column group to the rowset on a task of the vertical
+// compaction write pool, so merging the next blocks overlaps with encoding the written ones.
+// The blocks are written in the order they are added, at most max_blocks of them wait.
+class PipelinedGroupWriter {
+public:
+    PipelinedGroupWriter(RowsetWriter* writer, const std::vector<uint32_t>& column_group,
+                         int64_t max_rows_per_segment, bool has_cluster_key, size_t max_blocks)
+            : _writer(writer),
+              _column_group(column_group),
+              _max_rows_per_segment(max_rows_per_segment),
+              _has_cluster_key(has_cluster_key),
+              _max_blocks(max_blocks) {}
+
+    ~PipelinedGroupWriter() {
+        std::unique_lock<std::mutex> lock(_lock);
+        _pending.clear();
+        _closed = true;
+        _cv.notify_all();
+        _cv.wait(lock, [this] { return !_running; });
+    }
+
+    Status start(ThreadPool* pool) {
+        _running = true;
+        auto resource_ctx = thread_context()->resource_ctx();
+        Status st = pool->submit_func([this, resource_ctx]() {
+            SCOPED_ATTACH_TASK(resource_ctx);
+            _write();
+        });
+        if (!st.ok()) {
+            _running = false;
+        }
+        return st;
+    }
+
+    // Hand the rows of block to the writing task, block is replaced by an empty one.
+    Status add(vectorized::Block* block) {
+        if (block->rows() == 0) {
+            return Status::OK();
+        }
+        std::unique_lock<std::mutex> lock(_lock);
+        _cv.wait(lock, [this] { return _pending.size() < _max_blocks || !_status.ok(); });
+        RETURN_IF_ERROR(_status);
+        _pending.push_back(std::move(*block));
+        if (_free.empty()) {
+            *block = _pending.back().clone_empty();
+        } else {
+            *block = std::move(_free.back());
+            _free.pop_back();
+        }
+        _cv.notify_all();
+        return Status::OK();
+    }
+
+    // Wait for the added blocks to be written.
+    Status finish() {
+        std::unique_lock<std::mutex> lock(_lock);
+        _closed = true;
+        _cv.notify_all();
+        _cv.wait(lock, [this] { return !_running; });
+        return _status;
+    }
+
+private:
+    void _write() {
+        std::unique_lock<std::mutex> lock(_lock);
+        while (true) {
+            _cv.wait(lock, [this] { return !_pending.empty() || _closed; });
+            if (_pending.empty() || !_status.ok()) {
+                break;
+            }
+            vectorized::Block block = std::move(_pending.front());
+            _pending.pop_front();
+            lock.unlock();
+            Status st = [&]() -> Status {
+                RETURN_IF_ERROR_OR_CATCH_EXCEPTION(_writer->add_columns(
+                        &block, _column_group, false, _max_rows_per_segment, _has_cluster_key));
+                return Status::OK();
+            }();
+            block.clear_column_data();
+            lock.lock();
+            if (!st.ok()) {
+                _status = st;
+            }
+            _free.push_back(std::move(block));
+            _cv.notify_all();
+        }
+        _running = false;
+        _cv.notify_all();
+    }
+
+    RowsetWriter* _writer;
+    const std::vector<uint32_t>& _column_group;
+    int64_t _max_rows_per_segment;
+    bool _has_cluster_key;
+    size_t _max_blocks;
+
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::deque<vectorized::Block> _pending;
+    std::vector<vectorized::Block> _free;
+    bool _closed = false;
+    bool _running = false;
+    Status _status;
+};
+
+} // namespace
+
 Status Merger::vertical_compact_one_group(
         BaseTabletSPtr tablet, ReaderType reader_type, const TabletSchema& tablet_schema,
         bool is_key, const std::vector<uint32_t>& column_group,
@@ -292,6 +407,22 @@ Status Merger::vertical_compact_one_group(
     reader_params.batch_size = batch_size;
     RETURN_IF_ERROR(reader.init(reader_params, sample_info));
 
+    // the key group records the row sources and row locations of the written rows as it goes,
+    // only value groups are written by another thread
+    std::unique_ptr<PipelinedGroupWriter> group_writer;
+    auto* write_pool = ExecEnv::GetInstance()->vertical_compaction_write_thread_pool();
+    if (!is_key && config::vertical_compaction_pipeline_blocks > 0 && write_pool != nullptr) {
+        group_writer = std::make_unique<PipelinedGroupWriter>(
+                dst_rowset_writer, column_group, max_rows_per_segment, has_cluster_key,
+                config::vertical_compaction_pipeline_blocks);
+        Status st = group_writer->start(write_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to start writing column group of tablet " << tablet->tablet_id()
+                         << " in background, write it on the merging thread: " << st;
+            group_writer.reset();
+        }
+    }
+
     vectorized::Block block = tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
     bool eof = false;
@@ -306,6 +437,13 @@ Status Merger::vertical_compact_one_group(
         RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
                                        "failed to read next block when merging rowsets of tablet " +
                                                std::to_string(tablet->tablet_id()));
+        if (group_writer != nullptr) {
+            output_rows += block.rows();
+            RETURN_NOT_OK_STATUS_WITH_WARN(group_writer->add(&block),
+                                           "failed to write block when merging rowsets of tablet " +
+                                                   std::to_string(tablet->tablet_id()));
+            continue;
+        }
         RETURN_NOT_OK_STATUS_WITH_WARN(
                 dst_rowset_writer->add_columns(&block, column_group, is_key, max_rows_per_segment,
                                                has_cluster_key),
@@ -325,6 +463,11 @@ Status Merger::vertical_compact_one_group(
         return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
                                              tablet->tablet_id());
     }
+    if (group_writer != nullptr) {
+        RETURN_NOT_OK_STATUS_WITH_WARN(group_writer->finish(),
+                                       "failed to write block when merging rowsets of tablet " +
+                                               std::to_string(tablet->tablet_id()));
+    }
 
     if (is_key && stats_output != nullptr) {
         stats_output->output_rows = output_rows;
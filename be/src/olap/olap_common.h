@@ -357,6 +357,10 @@ struct OlapReaderStatistics {
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    // the hits of the compressed tier of the page cache, which are not in `cached_pages_num`
+    int64_t compressed_cached_pages_num = 0;
+    // bytes of the pages read from the page cache of both tiers
+    int64_t cached_pages_bytes = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
@@ -99,6 +99,7 @@ static const std::string INCREMENTAL_DELTA_PREFIX = "incremental_delta";
 static const std::string CLONE_PREFIX = "clone";
 static const std::string SPILL_DIR_PREFIX = "spill";
 static const std::string SPILL_GC_DIR_PREFIX = "spill_gc";
+static const std::string SPILL_REMOTE_DIR_PREFIX = "spill_remote";
 
 static inline std::string local_segment_path(std::string_view tablet_path,
                                              std::string_view rowset_id, int64_t seg_id) {
@@ -38,14 +38,27 @@ MemoryTrackedPageBase<T>::MemoryTrackedPageBase(size_t size, bool use_cache,
     }
 }
 
+template <typename T>
+MemoryTrackedPageBase<T>::MemoryTrackedPageBase(size_t size,
+                                                std::shared_ptr<MemTrackerLimiter> mem_tracker)
+        : _size(size), _mem_tracker_by_allocator(std::move(mem_tracker)) {}
+
 MemoryTrackedPageWithPageEntity::MemoryTrackedPageWithPageEntity(size_t size, bool use_cache,
                                                                  segment_v2::PageTypePB page_type)
         : MemoryTrackedPageBase<char*>(size, use_cache, page_type), _capacity(size) {
-    {
-        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(this->_mem_tracker_by_allocator);
-        this->_data = reinterpret_cast<char*>(
-                Allocator<false>::alloc(this->_capacity, ALLOCATOR_ALIGNMENT_16));
-    }
+    _allocate();
+}
+
+MemoryTrackedPageWithPageEntity::MemoryTrackedPageWithPageEntity(
+        size_t size, std::shared_ptr<MemTrackerLimiter> mem_tracker)
+        : MemoryTrackedPageBase<char*>(size, std::move(mem_tracker)), _capacity(size) {
+    _allocate();
+}
+
+void MemoryTrackedPageWithPageEntity::_allocate() {
+    SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(this->_mem_tracker_by_allocator);
+    this->_data = reinterpret_cast<char*>(
+            Allocator<false>::alloc(this->_capacity, ALLOCATOR_ALIGNMENT_16));
 }
 
 MemoryTrackedPageWithPageEntity::~MemoryTrackedPageWithPageEntity() {
@@ -74,26 +87,36 @@ MemoryTrackedPageWithPagePtr<T>::~MemoryTrackedPageWithPagePtr() {
 StoragePageCache* StoragePageCache::create_global_cache(size_t capacity,
                                                         int32_t index_cache_percentage,
                                                         int64_t pk_index_cache_capacity,
-                                                        uint32_t num_shards) {
+                                                        uint32_t num_shards,
+                                                        int32_t compressed_cache_percentage) {
     return new StoragePageCache(capacity, index_cache_percentage, pk_index_cache_capacity,
-                                num_shards);
+                                num_shards, compressed_cache_percentage);
 }
 
 StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                                   int64_t pk_index_cache_capacity, uint32_t num_shards)
+                                   int64_t pk_index_cache_capacity, uint32_t num_shards,
+                                   int32_t compressed_cache_percentage)
         : _index_cache_percentage(index_cache_percentage) {
-    if (index_cache_percentage == 0) {
-        _data_page_cache = std::make_unique<DataPageCache>(capacity, num_shards);
-    } else if (index_cache_percentage == 100) {
-        _index_page_cache = std::make_unique<IndexPageCache>(capacity, num_shards);
-    } else if (index_cache_percentage > 0 && index_cache_percentage < 100) {
-        _data_page_cache = std::make_unique<DataPageCache>(
-                capacity * (100 - index_cache_percentage) / 100, num_shards);
+    CHECK(compressed_cache_percentage >= 0 && compressed_cache_percentage < 100)
+            << "invalid compressed data page cache percentage";
+    size_t data_capacity = capacity;
+    if (index_cache_percentage > 0 && index_cache_percentage <= 100) {
+        data_capacity = capacity * (100 - index_cache_percentage) / 100;
         _index_page_cache = std::make_unique<IndexPageCache>(
                 capacity * index_cache_percentage / 100, num_shards);
-    } else {
+    } else if (index_cache_percentage != 0) {
         CHECK(false) << "invalid index page cache percentage";
     }
+    if (index_cache_percentage != 100) {
+        // the compressed tier is carved out of the data page cache
+        size_t compressed_capacity = data_capacity * compressed_cache_percentage / 100;
+        _data_page_cache =
+                std::make_unique<DataPageCache>(data_capacity - compressed_capacity, num_shards);
+        if (compressed_capacity > 0) {
+            _compressed_data_page_cache =
+                    std::make_unique<CompressedDataPageCache>(compressed_capacity, num_shards);
+        }
+    }
 
     _pk_index_page_cache = std::make_unique<PKIndexPageCache>(pk_index_cache_capacity, num_shards);
 }
@@ -122,6 +145,29 @@ void StoragePageCache::insert(const CacheKey& key, DataPage* data, PageCacheHand
     *handle = PageCacheHandle(cache, lru_handle);
 }
 
+bool StoragePageCache::lookup_compressed(const CacheKey& key, PageCacheHandle* handle,
+                                         int32_t* hits) {
+    DCHECK(has_compressed_page_cache());
+    auto* cache = _compressed_data_page_cache.get();
+    auto* lru_handle = cache->lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *hits = ((CompressedDataPage*)cache->value(lru_handle))->add_hit();
+    *handle = PageCacheHandle(cache, lru_handle);
+    return true;
+}
+
+void StoragePageCache::insert_compressed(const CacheKey& key, CompressedDataPage* data,
+                                         PageCacheHandle* handle, bool in_memory) {
+    DCHECK(has_compressed_page_cache());
+    CachePriority priority = in_memory ? CachePriority::DURABLE : CachePriority::NORMAL;
+    auto* cache = _compressed_data_page_cache.get();
+    auto* lru_handle = cache->insert(key.encode(), data, data->capacity(), 0, priority);
+    DCHECK(lru_handle != nullptr);
+    *handle = PageCacheHandle(cache, lru_handle);
+}
+
 template <typename T>
 void StoragePageCache::insert(const CacheKey& key, T data, size_t size, PageCacheHandle* handle,
                               segment_v2::PageTypePB page_type, bool in_memory) {
@@ -22,6 +22,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -42,6 +43,7 @@ class MemoryTrackedPageBase : public LRUCacheValueBase {
 public:
     MemoryTrackedPageBase() = default;
     MemoryTrackedPageBase(size_t b, bool use_cache, segment_v2::PageTypePB page_type);
+    MemoryTrackedPageBase(size_t b, std::shared_ptr<MemTrackerLimiter> mem_tracker);
 
     MemoryTrackedPageBase(const MemoryTrackedPageBase&) = delete;
     MemoryTrackedPageBase& operator=(const MemoryTrackedPageBase&) = delete;
@@ -59,6 +61,7 @@ protected:
 class MemoryTrackedPageWithPageEntity : Allocator<false>, public MemoryTrackedPageBase<char*> {
 public:
     MemoryTrackedPageWithPageEntity(size_t b, bool use_cache, segment_v2::PageTypePB page_type);
+    MemoryTrackedPageWithPageEntity(size_t b, std::shared_ptr<MemTrackerLimiter> mem_tracker);
 
     size_t capacity() { return this->_capacity; }
 
@@ -70,6 +73,8 @@ public:
     }
 
 private:
+    void _allocate();
+
     size_t _capacity = 0;
 };
 
@@ -86,6 +91,20 @@ public:
 using SemgnetFooterPBPage = MemoryTrackedPageWithPagePtr<segment_v2::SegmentFooterPB>;
 using DataPage = MemoryTrackedPageWithPageEntity;
 
+// The still compressed bytes of a data page, kept in the compressed tier of StoragePageCache.
+// It counts its hits so that the hot pages can be promoted to the decompressed tier.
+class CompressedDataPage : public DataPage {
+public:
+    CompressedDataPage(size_t b, std::shared_ptr<MemTrackerLimiter> mem_tracker)
+            : DataPage(b, std::move(mem_tracker)) {}
+
+    // Return the number of hits including this one.
+    int32_t add_hit() { return _hits.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+private:
+    std::atomic<int32_t> _hits = 0;
+};
+
 // Wrapper around Cache, and used for cache page of column data
 // in Segment.
 // TODO(zc): We should add some metric to see cache hit/miss rate.
@@ -118,8 +137,9 @@ public:
         DataPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::DATA_PAGE_CACHE, capacity,
                                  LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
-                                 num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true, true) {
-        }
+                                 num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true,
+                                 !config::data_page_cache_enable_tiny_lfu,
+                                 config::data_page_cache_enable_tiny_lfu) {}
     };
 
     class IndexPageCache : public LRUCachePolicy {
@@ -127,7 +147,9 @@ public:
         IndexPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::INDEXPAGE_CACHE, capacity,
                                  LRUCacheType::SIZE, config::index_page_cache_stale_sweep_time_sec,
-                                 num_shards) {}
+                                 num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true,
+                                 DEFAULT_LRU_CACHE_IS_LRU_K,
+                                 config::index_page_cache_enable_tiny_lfu) {}
     };
 
     class PKIndexPageCache : public LRUCachePolicy {
@@ -135,22 +157,38 @@ public:
         PKIndexPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::PK_INDEX_PAGE_CACHE, capacity,
                                  LRUCacheType::SIZE,
-                                 config::pk_index_page_cache_stale_sweep_time_sec, num_shards) {}
+                                 config::pk_index_page_cache_stale_sweep_time_sec, num_shards,
+                                 DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true,
+                                 DEFAULT_LRU_CACHE_IS_LRU_K,
+                                 config::pk_index_page_cache_enable_tiny_lfu) {}
+    };
+
+    class CompressedDataPageCache : public LRUCachePolicy {
+    public:
+        CompressedDataPageCache(size_t capacity, uint32_t num_shards)
+                : LRUCachePolicy(CachePolicy::CacheType::COMPRESSED_DATA_PAGE_CACHE, capacity,
+                                 LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
+                                 num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true,
+                                 DEFAULT_LRU_CACHE_IS_LRU_K,
+                                 config::data_page_cache_enable_tiny_lfu) {}
     };
 
     static constexpr uint32_t kDefaultNumShards = 16;
 
     // Create global instance of this class
+    // compressed_cache_percentage of the data page cache capacity goes to its compressed tier.
     static StoragePageCache* create_global_cache(size_t capacity, int32_t index_cache_percentage,
                                                  int64_t pk_index_cache_capacity,
-                                                 uint32_t num_shards = kDefaultNumShards);
+                                                 uint32_t num_shards = kDefaultNumShards,
+                                                 int32_t compressed_cache_percentage = 0);
 
     // Return global instance.
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return ExecEnv::GetInstance()->get_storage_page_cache(); }
 
     StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                     int64_t pk_index_cache_capacity, uint32_t num_shards);
+                     int64_t pk_index_cache_capacity, uint32_t num_shards,
+                     int32_t compressed_cache_percentage = 0);
 
     // Lookup the given page in the cache.
     //
@@ -186,6 +224,22 @@ public:
         return _get_page_cache(page_type)->mem_tracker();
     }
 
+    // The compressed tier only holds data pages. It is missed by lookup() and insert(), the page
+    // read decompresses its pages and promotes the hot ones to the decompressed tier.
+    bool has_compressed_page_cache() const { return _compressed_data_page_cache != nullptr; }
+
+    std::shared_ptr<MemTrackerLimiter> compressed_mem_tracker() {
+        DCHECK(has_compressed_page_cache());
+        return _compressed_data_page_cache->mem_tracker();
+    }
+
+    // Lookup the compressed bytes of a data page, hits is set to the number of times the page is
+    // found in the compressed tier.
+    bool lookup_compressed(const CacheKey& key, PageCacheHandle* handle, int32_t* hits);
+
+    void insert_compressed(const CacheKey& key, CompressedDataPage* data, PageCacheHandle* handle,
+                           bool in_memory = false);
+
 private:
     StoragePageCache();
 
@@ -196,6 +250,7 @@ private:
     // page cache to make it for flexible. we need this cache When construct
     // delete bitmap in unique key with mow
     std::unique_ptr<PKIndexPageCache> _pk_index_page_cache;
+    std::unique_ptr<CompressedDataPageCache> _compressed_data_page_cache;
 
     LRUCachePolicy* _get_page_cache(segment_v2::PageTypePB page_type) {
         switch (page_type) {
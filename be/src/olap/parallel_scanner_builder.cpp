@@ -17,6 +17,7 @@
 
 #include "parallel_scanner_builder.h"
 
+#include <algorithm>
 #include <cstddef>
 
 #include "cloud/cloud_storage_engine.h"
@@ -32,6 +33,21 @@ namespace doris {
 
 using namespace vectorized;
 
+namespace {
+
+// Rows per scanner for a tablet of `tablet_rows` rows, so that the rows of the tablet are split
+// into scanners of about `rows_per_scanner` rows evenly, instead of several full scanners followed
+// by a small one.
+size_t balanced_rows_per_scanner(size_t tablet_rows, size_t rows_per_scanner) {
+    if (tablet_rows <= rows_per_scanner) {
+        return rows_per_scanner;
+    }
+    size_t num_scanners = (tablet_rows + rows_per_scanner / 2) / rows_per_scanner;
+    return (tablet_rows + num_scanners - 1) / num_scanners;
+}
+
+} // namespace
+
 Status ParallelScannerBuilder::build_scanners(std::list<ScannerSPtr>& scanners) {
     RETURN_IF_ERROR(_load());
     if (_is_dup_mow_key) {
@@ -45,6 +61,8 @@ Status ParallelScannerBuilder::build_scanners(std::list<ScannerSPtr>& scanners)
 Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>& scanners) {
     DCHECK_GE(_rows_per_scanner, _min_rows_per_scanner);
 
+    // <estimated rows, scanner>
+    std::vector<std::pair<size_t, ScannerSPtr>> built_scanners;
     for (auto&& [tablet, version] : _tablets) {
         DCHECK(_all_read_sources.contains(tablet->tablet_id()));
         auto& entire_read_source = _all_read_sources[tablet->tablet_id()];
@@ -59,6 +77,11 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
         // share the same delete predicates from their corresponding entire read source.
         TabletReader::ReadSource partitial_read_source;
         int64_t rows_collected = 0;
+        size_t tablet_rows = 0;
+        for (auto& rs_split : entire_read_source.rs_splits) {
+            tablet_rows += rs_split.rs_reader->rowset()->num_rows();
+        }
+        const size_t rows_per_scanner = balanced_rows_per_scanner(tablet_rows, _rows_per_scanner);
         for (auto& rs_split : entire_read_source.rs_splits) {
             auto reader = rs_split.rs_reader;
             auto rowset = reader->rowset();
@@ -81,7 +104,7 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
                 // try to split large segments into RowRanges
                 while (offset_in_segment < rows_of_segment) {
                     const int64_t remaining_rows = rows_of_segment - offset_in_segment;
-                    auto rows_need = _rows_per_scanner - rows_collected;
+                    auto rows_need = rows_per_scanner - rows_collected;
 
                     // 0.9: try to avoid splitting the segments into excessively small parts.
                     if (rows_need >= remaining_rows * 0.9) {
@@ -96,7 +119,7 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
                     offset_in_segment += rows_need;
 
                     // If collected enough rows, build a new scanner
-                    if (rows_collected >= _rows_per_scanner) {
+                    if (rows_collected >= rows_per_scanner) {
                         split.segment_offsets.first = segment_start,
                         split.segment_offsets.second = i + 1;
                         split.segment_row_ranges.emplace_back(std::move(row_ranges));
@@ -106,7 +129,8 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
 
                         partitial_read_source.rs_splits.emplace_back(std::move(split));
 
-                        scanners.emplace_back(
+                        built_scanners.emplace_back(
+                                rows_collected,
                                 _build_scanner(tablet, version, _key_ranges,
                                                {std::move(partitial_read_source.rs_splits),
                                                 entire_read_source.delete_predicates}));
@@ -128,7 +152,7 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
                 }
             }
 
-            DCHECK_LE(rows_collected, _rows_per_scanner);
+            DCHECK_LE(rows_collected, rows_per_scanner);
             if (rows_collected > 0) {
                 split.segment_offsets.first = segment_start;
                 split.segment_offsets.second = segments_rows.size();
@@ -139,7 +163,7 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
             }
         } // end `for (auto& rowset : rowsets)`
 
-        DCHECK_LE(rows_collected, _rows_per_scanner);
+        DCHECK_LE(rows_collected, rows_per_scanner);
         if (rows_collected > 0) {
             DCHECK_GT(partitial_read_source.rs_splits.size(), 0);
 #ifndef NDEBUG
@@ -150,12 +174,23 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
                           split.segment_offsets.second - split.segment_offsets.first);
             }
 #endif
-            scanners.emplace_back(_build_scanner(tablet, version, _key_ranges,
-                                                 {std::move(partitial_read_source.rs_splits),
-                                                  entire_read_source.delete_predicates}));
+            built_scanners.emplace_back(
+                    rows_collected,
+                    _build_scanner(tablet, version, _key_ranges,
+                                   {std::move(partitial_read_source.rs_splits),
+                                    entire_read_source.delete_predicates}));
         }
     }
 
+    // `ScannerContext` keeps the pending scanners in a stack, so put the largest scanners at the
+    // end to schedule them first. Then the small ones fill in the gaps at the end of the scan,
+    // instead of a large one running alone.
+    std::stable_sort(built_scanners.begin(), built_scanners.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    for (auto& [_, scanner] : built_scanners) {
+        scanners.emplace_back(std::move(scanner));
+    }
+
     return Status::OK();
 }
 
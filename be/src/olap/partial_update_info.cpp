@@ -19,6 +19,8 @@
 
 #include <gen_cpp/olap_file.pb.h>
 
+#include <algorithm>
+
 #include "common/consts.h"
 #include "common/logging.h"
 #include "olap/base_tablet.h"
@@ -288,6 +290,20 @@ void PartialUpdateInfo::_generate_default_values_for_missing_cids(
     CHECK_EQ(missing_cids.size(), default_values.size());
 }
 
+// The rows of a segment are planned in the order of the new keys, which isn't the order of their
+// row ids when the old segment is sorted by cluster keys or the rows come from several loads.
+// Reading them in row id order goes over the pages once instead of seeking back and forth.
+static const std::vector<RidAndPos>& sorted_by_rid(const std::vector<RidAndPos>& mappings,
+                                                   std::vector<RidAndPos>* buffer) {
+    auto rid_less = [](const RidAndPos& lhs, const RidAndPos& rhs) { return lhs.rid < rhs.rid; };
+    if (std::is_sorted(mappings.begin(), mappings.end(), rid_less)) {
+        return mappings;
+    }
+    *buffer = mappings;
+    std::sort(buffer->begin(), buffer->end(), rid_less);
+    return *buffer;
+}
+
 void FixedReadPlan::prepare_to_read(const RowLocation& row_location, size_t pos) {
     plan[row_location.rowset_id][row_location.segment_id].emplace_back(row_location.row_id, pos);
 }
@@ -317,7 +333,8 @@ Status FixedReadPlan::read_columns_by_plan(
             auto rowset_iter = rsid_to_rowset.find(rowset_id);
             CHECK(rowset_iter != rsid_to_rowset.end());
             std::vector<uint32_t> rids;
-            for (auto [rid, pos] : mappings) {
+            std::vector<RidAndPos> sorted_mappings;
+            for (auto [rid, pos] : sorted_by_rid(mappings, &sorted_mappings)) {
                 if (cur_delete_signs && cur_delete_signs[pos]) {
                     continue;
                 }
@@ -461,7 +478,8 @@ Status FlexibleReadPlan::read_columns_by_plan(
                 DCHECK_NE(cid, -1);
                 DCHECK_GE(cid, tablet_schema.num_key_columns());
                 std::vector<uint32_t> rids;
-                for (auto [rid, pos] : mappings) {
+                std::vector<RidAndPos> sorted_mappings;
+                for (auto [rid, pos] : sorted_by_rid(mappings, &sorted_mappings)) {
                     rids.emplace_back(rid);
                     (*read_index)[cid][pos] = next_read_idx[cid]++;
                 }
@@ -491,7 +509,8 @@ Status FlexibleReadPlan::read_columns_by_plan(
             auto rowset_iter = rsid_to_rowset.find(rowset_id);
             CHECK(rowset_iter != rsid_to_rowset.end());
             std::vector<uint32_t> rids;
-            for (auto [rid, pos] : mappings) {
+            std::vector<RidAndPos> sorted_mappings;
+            for (auto [rid, pos] : sorted_by_rid(mappings, &sorted_mappings)) {
                 rids.emplace_back(rid);
                 (*read_index)[pos] = read_idx++;
             }
@@ -50,6 +50,7 @@
 #include "olap/schema_change.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_schema.h"
+#include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "util/debug_points.h"
 #include "util/slice.h"
@@ -609,7 +610,8 @@ Status BetaRowsetWriter::_segcompaction_if_necessary() {
     } else {
         status = _check_segment_number_limit(_num_segcompacted);
     }
-    if (status.ok() && (_num_segment - _segcompacted_point) >= config::segcompaction_batch_size) {
+    if (status.ok() && (_num_segment - _segcompacted_point) >= config::segcompaction_batch_size &&
+        !_defer_segcompaction()) {
         SegCompactionCandidatesSharedPtr segments;
         status = _find_longest_consecutive_small_segment(segments);
         if (LIKELY(status.ok()) && (!segments->empty())) {
@@ -630,6 +632,27 @@ Status BetaRowsetWriter::_segcompaction_if_necessary() {
     return status;
 }
 
+bool BetaRowsetWriter::_defer_segcompaction() {
+    if (!config::segcompaction_defer_on_load_memory_pressure) {
+        return false;
+    }
+    // Segcompaction reads and rewrites segments, while memtable flushes free load memory. So
+    // it waits for later flushes under memory pressure, unless the deferred segments may
+    // exceed the segment number limit.
+    auto* limiter = ExecEnv::GetInstance()->memtable_memory_limiter();
+    if (limiter == nullptr || !limiter->soft_limit_reached()) {
+        return false;
+    }
+    int64_t num_segments = _num_segcompacted + (_num_segment - _segcompacted_point);
+    if (num_segments >= config::max_segment_num_per_rowset / 2) {
+        return false;
+    }
+    VLOG_DEBUG << "defer segcompaction under load memory pressure, tablet_id:"
+               << _context.tablet_id << " rowset_id:" << _context.rowset_id
+               << " segment num:" << _num_segment;
+    return true;
+}
+
 Status BetaRowsetWriter::_segcompaction_rename_last_segments() {
     DCHECK_EQ(_is_doing_segcompaction, false);
     if (!config::enable_segcompaction) {
@@ -294,6 +294,7 @@ private:
     int64_t _num_seg() const override;
     Status _wait_flying_segcompaction();
     Status _segcompaction_if_necessary();
+    bool _defer_segcompaction();
     Status _segcompaction_rename_last_segments();
     Status _load_noncompacted_segment(segment_v2::SegmentSharedPtr& segment, int32_t segment_id);
     Status _find_longest_consecutive_small_segment(SegCompactionCandidatesSharedPtr& segments);
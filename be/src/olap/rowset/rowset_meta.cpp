@@ -171,6 +171,23 @@ void RowsetMeta::set_tablet_schema(const TabletSchemaPB& tablet_schema) {
     _schema = pair.second;
 }
 
+void RowsetMeta::share_tablet_schema(const RowsetMeta& other) {
+    if (other._handle != nullptr) {
+        auto pair = TabletSchemaCache::instance()->acquire(other._handle);
+        if (pair.first != nullptr) {
+            if (_handle) {
+                TabletSchemaCache::instance()->release(_handle);
+            }
+            _handle = pair.first;
+            _schema = std::move(pair.second);
+            return;
+        }
+    }
+    if (other._schema) {
+        set_tablet_schema(other._schema);
+    }
+}
+
 bool RowsetMeta::_deserialize_from_pb(std::string_view value) {
     if (!_rowset_meta_pb.ParseFromArray(value.data(), value.size())) {
         _rowset_meta_pb.Clear();
@@ -341,6 +341,8 @@ public:
 
     void set_tablet_schema(const TabletSchemaSPtr& tablet_schema);
     void set_tablet_schema(const TabletSchemaPB& tablet_schema);
+    // Share the cached tablet schema of `other`, without serializing the schema to look it up
+    void share_tablet_schema(const RowsetMeta& other);
 
     const TabletSchemaSPtr& tablet_schema() const { return _schema; }
 
@@ -112,6 +112,10 @@ public:
         if (_context.compaction_type == ReaderType::READER_BASE_COMPACTION) {
             can_use_ram_dir = config::inverted_index_ram_dir_enable_when_base_compaction;
         }
+        // the runs flushed by a memory bounded index writer would stay in memory otherwise
+        if (config::inverted_index_writer_flush_threshold_bytes > 0) {
+            can_use_ram_dir = false;
+        }
         *index_file_writer = std::make_unique<InvertedIndexFileWriter>(
                 _context.fs(), segment_prefix, _context.rowset_id.to_string(), segment_id,
                 _context.tablet_schema->get_inverted_index_storage_format(),
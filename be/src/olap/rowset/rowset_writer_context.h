@@ -149,7 +149,12 @@ struct RowsetWriterContext {
                 .is_cold_data = is_hot_data,
                 .file_cache_expiration = file_cache_ttl_sec > 0 && newest_write_timestamp > 0
                                                  ? newest_write_timestamp + file_cache_ttl_sec
-                                                 : 0};
+                                                 : 0,
+                .background_io = write_type == DataWriteType::TYPE_COMPACTION ||
+                                 write_type == DataWriteType::TYPE_SCHEMA_CHANGE};
+        if (opts.background_io) {
+            opts.page_cache_mode = io::background_write_page_cache_mode();
+        }
         return opts;
     }
 };
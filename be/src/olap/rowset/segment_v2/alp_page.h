@@ -0,0 +1,549 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// ALP (Adaptive Lossless floating-Point) encodes the floats which are decimals at heart, e.g.
+// 12.34, as integers. A value v is stored as its digits d = round(v * 10^e * 10^-f) when
+// d * 10^f * 10^-e gives v back exactly, the digits of a vector are frame-of-reference bit
+// packed and the values which don't come back are stored as exceptions.
+//
+// The page format is as follows:
+//
+// 1. Header: (4 bytes total)
+//
+//    <num_elements> [32-bit]
+//
+// 2. Vectors of ALP_VECTOR_SIZE values, the last one may be shorter:
+//
+//    <exponent> [8-bit] <factor> [8-bit] <bit_width> [8-bit] <unused> [8-bit]
+//    <num_exceptions> [32-bit]
+//    <frame_of_reference> [64-bit]
+//      The minimal digits of the vector.
+//    <digits> [(num_values * bit_width + 7) / 8 bytes]
+//      The digits minus the frame of reference, the exceptions are packed as 0.
+//    <exception_positions> [16-bit * num_exceptions]
+//    <exception_values> [sizeof(CppType) * num_exceptions]
+//
+//    A vector whose exponent is ALP_RAW_EXPONENT stores its values as they are after the
+//    header, it is used when the encoding doesn't make the vector smaller.
+//
+//   NOTE: all on-disk ints are encoded little-endian
+//
+// The exponent and factor are searched in two levels: the combinations best for the samples
+// of the vectors in the page are kept, then each vector picks the best of them on its sample.
+enum { ALP_PAGE_HEADER_SIZE = 4, ALP_VECTOR_HEADER_SIZE = 16 };
+
+static constexpr size_t ALP_VECTOR_SIZE = 1024;
+static constexpr size_t ALP_SAMPLES_PER_VECTOR = 32;
+static constexpr size_t ALP_MAX_COMBINATIONS = 5;
+static constexpr uint8_t ALP_RAW_EXPONENT = 0xFF;
+
+template <typename T>
+struct AlpTraits;
+
+template <>
+struct AlpTraits<double> {
+    static constexpr uint8_t MAX_EXPONENT = 18;
+    // a double below it keeps the integer part exact after the rounding
+    static constexpr double ENCODING_LIMIT = 2251799813685248.0; // 2^51
+    // adding and subtracting it rounds a double below ENCODING_LIMIT to an integer
+    static constexpr double MAGIC_NUMBER = 6755399441055744.0; // 2^52 + 2^51
+    static constexpr double EXP[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                     1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+    static constexpr double FRAC[] = {1e0,   1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,
+                                      1e-7,  1e-8,  1e-9,  1e-10, 1e-11, 1e-12, 1e-13,
+                                      1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+};
+
+template <>
+struct AlpTraits<float> {
+    static constexpr uint8_t MAX_EXPONENT = 10;
+    static constexpr float ENCODING_LIMIT = 4194304.0F; // 2^22
+    static constexpr float MAGIC_NUMBER = 12582912.0F;  // 2^23 + 2^22
+    static constexpr float EXP[] = {1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F,
+                                    1e6F, 1e7F, 1e8F, 1e9F, 1e10F};
+    static constexpr float FRAC[] = {1e0F,  1e-1F, 1e-2F, 1e-3F, 1e-4F, 1e-5F,
+                                     1e-6F, 1e-7F, 1e-8F, 1e-9F, 1e-10F};
+};
+
+template <typename T>
+struct AlpCodec {
+    using Traits = AlpTraits<T>;
+
+    // Return false when the digits don't give v back, v is an exception then.
+    static bool encode(T v, uint8_t exponent, uint8_t factor, int64_t* digits) {
+        T scaled = v * Traits::EXP[exponent] * Traits::FRAC[factor];
+        // also false for nan and inf
+        if (!(std::abs(scaled) < Traits::ENCODING_LIMIT)) {
+            return false;
+        }
+        *digits = static_cast<int64_t>(scaled + Traits::MAGIC_NUMBER - Traits::MAGIC_NUMBER);
+        T decoded = decode(*digits, exponent, factor);
+        // compare the bits, -0.0 is an exception
+        return memcmp(&decoded, &v, sizeof(T)) == 0;
+    }
+
+    // The decoder must multiply in the same order to get the very same value.
+    static T decode(int64_t digits, uint8_t exponent, uint8_t factor) {
+        return static_cast<T>(digits) * Traits::EXP[factor] * Traits::FRAC[exponent];
+    }
+};
+
+inline uint8_t alp_bit_width(uint64_t delta) {
+    return delta == 0 ? 0 : static_cast<uint8_t>(64 - __builtin_clzll(delta));
+}
+
+template <FieldType Type>
+class AlpPageBuilder : public PageBuilderHelper<AlpPageBuilder<Type>> {
+public:
+    using Self = AlpPageBuilder<Type>;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        if (is_page_full()) {
+            *count = 0;
+            return Status::OK();
+        }
+        size_t to_add = std::min(_max_count - _values.size(), *count);
+        const auto* src = reinterpret_cast<const CppType*>(vals);
+        // This may need a large memory, should return error if could not allocated
+        // successfully, to avoid BE OOM.
+        RETURN_IF_CATCH_EXCEPTION(_values.insert(_values.end(), src, src + to_add));
+        *count = to_add;
+        return Status::OK();
+    }
+
+    Status finish(OwnedSlice* slice) override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _buffer.clear();
+            put_fixed32_le(&_buffer, static_cast<uint32_t>(_values.size()));
+            _find_combinations();
+            for (size_t start = 0; start < _values.size(); start += ALP_VECTOR_SIZE) {
+                _encode_vector(_values.data() + start,
+                               std::min(ALP_VECTOR_SIZE, _values.size() - start));
+            }
+            *slice = _buffer.build();
+        });
+        return Status::OK();
+    }
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _values.clear();
+            _values.reserve(_max_count);
+            _buffer.clear();
+            _combinations.clear();
+        });
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _values.size() * SIZE_OF_TYPE; }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.front(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.back(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Codec = AlpCodec<CppType>;
+    // exponent and factor
+    using Combination = std::pair<uint8_t, uint8_t>;
+
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+
+    AlpPageBuilder(const PageBuilderOptions& options)
+            : _options(options),
+              _max_count(std::max<size_t>(1, options.data_page_size / SIZE_OF_TYPE)) {}
+
+    void _sample(const CppType* vals, size_t n) {
+        _samples.clear();
+        size_t step = std::max<size_t>(1, n / ALP_SAMPLES_PER_VECTOR);
+        for (size_t i = 0; i < n; i += step) {
+            _samples.push_back(vals[i]);
+        }
+    }
+
+    // The estimated bits of the samples encoded with the combination.
+    uint64_t _estimate_bits(Combination combination) const {
+        int64_t min = std::numeric_limits<int64_t>::max();
+        int64_t max = std::numeric_limits<int64_t>::min();
+        size_t exceptions = 0;
+        for (CppType value : _samples) {
+            int64_t digits = 0;
+            if (Codec::encode(value, combination.first, combination.second, &digits)) {
+                min = std::min(min, digits);
+                max = std::max(max, digits);
+            } else {
+                ++exceptions;
+            }
+        }
+        uint64_t bits = exceptions * (sizeof(uint16_t) + SIZE_OF_TYPE) * 8;
+        if (exceptions < _samples.size()) {
+            bits += (_samples.size() - exceptions) *
+                    alp_bit_width(static_cast<uint64_t>(max) - static_cast<uint64_t>(min));
+        }
+        return bits;
+    }
+
+    Combination _best_combination(const std::vector<Combination>& candidates) const {
+        Combination best = candidates.front();
+        uint64_t best_bits = _estimate_bits(best);
+        for (size_t i = 1; i < candidates.size(); ++i) {
+            uint64_t bits = _estimate_bits(candidates[i]);
+            if (bits < best_bits) {
+                best = candidates[i];
+                best_bits = bits;
+            }
+        }
+        return best;
+    }
+
+    // Keep the combinations best for most vectors of the page.
+    void _find_combinations() {
+        if (_all_combinations.empty()) {
+            for (uint8_t e = 0; e <= Codec::Traits::MAX_EXPONENT; ++e) {
+                for (uint8_t f = 0; f <= e; ++f) {
+                    _all_combinations.emplace_back(e, f);
+                }
+            }
+        }
+        std::vector<std::pair<Combination, size_t>> counts;
+        for (size_t start = 0; start < _values.size(); start += ALP_VECTOR_SIZE) {
+            _sample(_values.data() + start, std::min(ALP_VECTOR_SIZE, _values.size() - start));
+            Combination best = _best_combination(_all_combinations);
+            auto it = std::find_if(counts.begin(), counts.end(),
+                                   [&](const auto& count) { return count.first == best; });
+            if (it == counts.end()) {
+                counts.emplace_back(best, 1);
+            } else {
+                ++it->second;
+            }
+        }
+        // the more vectors the better, then the larger exponent and factor
+        std::sort(counts.begin(), counts.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second != rhs.second ? lhs.second > rhs.second : lhs.first > rhs.first;
+        });
+        _combinations.clear();
+        for (size_t i = 0; i < counts.size() && i < ALP_MAX_COMBINATIONS; ++i) {
+            _combinations.push_back(counts[i].first);
+        }
+    }
+
+    void _encode_vector(const CppType* vals, size_t n) {
+        Combination combination = _combinations.front();
+        if (_combinations.size() > 1) {
+            _sample(vals, n);
+            combination = _best_combination(_combinations);
+        }
+        auto [exponent, factor] = combination;
+
+        _digits.resize(n);
+        _exception_positions.clear();
+        int64_t min = std::numeric_limits<int64_t>::max();
+        int64_t max = std::numeric_limits<int64_t>::min();
+        for (size_t i = 0; i < n; ++i) {
+            if (Codec::encode(vals[i], exponent, factor, &_digits[i])) {
+                min = std::min(min, _digits[i]);
+                max = std::max(max, _digits[i]);
+            } else {
+                _exception_positions.push_back(static_cast<uint16_t>(i));
+            }
+        }
+        size_t num_exceptions = _exception_positions.size();
+        if (num_exceptions == n) {
+            min = max = 0;
+        }
+        for (uint16_t position : _exception_positions) {
+            _digits[position] = min;
+        }
+        uint8_t bit_width =
+                alp_bit_width(static_cast<uint64_t>(max) - static_cast<uint64_t>(min));
+        size_t packed_bytes = (n * bit_width + 7) / 8;
+        if (packed_bytes + num_exceptions * (sizeof(uint16_t) + SIZE_OF_TYPE) >=
+            n * SIZE_OF_TYPE) {
+            uint8_t header[ALP_VECTOR_HEADER_SIZE] = {ALP_RAW_EXPONENT};
+            _buffer.append(header, sizeof(header));
+            _buffer.append(vals, n * SIZE_OF_TYPE);
+            return;
+        }
+
+        _buffer.push_back(static_cast<char>(exponent));
+        _buffer.push_back(static_cast<char>(factor));
+        _buffer.push_back(static_cast<char>(bit_width));
+        _buffer.push_back(0);
+        put_fixed32_le(&_buffer, static_cast<uint32_t>(num_exceptions));
+        put_fixed64_le(&_buffer, static_cast<uint64_t>(min));
+        if (bit_width > 0) {
+            BitWriter writer(&_packed);
+            for (size_t i = 0; i < n; ++i) {
+                writer.PutValue(static_cast<uint64_t>(_digits[i]) - static_cast<uint64_t>(min),
+                                bit_width);
+            }
+            writer.Flush();
+            DCHECK_EQ(_packed.size(), packed_bytes);
+            _buffer.append(_packed.data(), _packed.size());
+        }
+        for (uint16_t position : _exception_positions) {
+            uint8_t buf[sizeof(uint16_t)];
+            encode_fixed16_le(buf, position);
+            _buffer.append(buf, sizeof(buf));
+        }
+        for (uint16_t position : _exception_positions) {
+            _buffer.append(&vals[position], SIZE_OF_TYPE);
+        }
+    }
+
+    PageBuilderOptions _options;
+    size_t _max_count;
+    std::vector<CppType> _values;
+    faststring _buffer;
+
+    std::vector<Combination> _all_combinations;
+    std::vector<Combination> _combinations;
+    std::vector<CppType> _samples;
+    std::vector<int64_t> _digits;
+    std::vector<uint16_t> _exception_positions;
+    faststring _packed;
+};
+
+// The page is decoded as a whole in init(), like a bitshuffle page is when it is read.
+template <FieldType Type>
+class AlpPageDecoder : public PageDecoder {
+public:
+    AlpPageDecoder(Slice data, const PageDecoderOptions& options)
+            : _data(data), _options(options), _parsed(false), _num_elements(0), _cur_index(0) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < ALP_PAGE_HEADER_SIZE) {
+            return Status::InternalError(
+                    "file corruption: invalid data size:{}, header size:{}", _data.size,
+                    ALP_PAGE_HEADER_SIZE);
+        }
+        _num_elements = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data));
+        RETURN_IF_CATCH_EXCEPTION(_decoded.resize(_num_elements));
+
+        const auto* pos = reinterpret_cast<const uint8_t*>(_data.data) + ALP_PAGE_HEADER_SIZE;
+        const auto* end = reinterpret_cast<const uint8_t*>(_data.data) + _data.size;
+        for (size_t start = 0; start < _num_elements; start += ALP_VECTOR_SIZE) {
+            RETURN_IF_ERROR(_decode_vector(&pos, end, _decoded.data() + start,
+                                           std::min(ALP_VECTOR_SIZE, _num_elements - start)));
+        }
+        if (pos != end) {
+            return Status::InternalError("file corruption: {} bytes left after {} values",
+                                         end - pos, _num_elements);
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        if (_num_elements == 0) [[unlikely]] {
+            if (pos != 0) {
+                return Status::Error<ErrorCode::INTERNAL_ERROR, false>(
+                        "seek pos {} is larger than total elements  {}", pos, _num_elements);
+            }
+        }
+        DCHECK_LE(pos, _num_elements);
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    template <bool forward_index = true>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        size_t max_fetch = std::min(*n, _num_elements - _cur_index);
+        dst->insert_many_fix_len_data(reinterpret_cast<const char*>(&_decoded[_cur_index]),
+                                      max_fetch);
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        auto total = *n;
+        size_t read_count = 0;
+        _buffer.resize(total);
+        for (size_t i = 0; i < total; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= _num_elements)) {
+                break;
+            }
+            _buffer[read_count++] = _decoded[ord];
+        }
+
+        if (LIKELY(read_count > 0)) {
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()),
+                                          read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<false>(n, dst);
+    }
+
+    size_t count() const override { return _num_elements; }
+
+    size_t current_index() const override { return _cur_index; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Traits = AlpTraits<CppType>;
+
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+
+    Status _decode_vector(const uint8_t** pos, const uint8_t* end, CppType* out, size_t n) {
+        const uint8_t* p = *pos;
+        if (end - p < ALP_VECTOR_HEADER_SIZE) {
+            return Status::InternalError("file corruption: not enough bytes for vector header");
+        }
+        uint8_t exponent = p[0];
+        uint8_t factor = p[1];
+        uint8_t bit_width = p[2];
+        uint32_t num_exceptions = decode_fixed32_le(p + 4);
+        auto frame_of_reference = decode_fixed64_le(p + 8);
+        p += ALP_VECTOR_HEADER_SIZE;
+
+        if (exponent == ALP_RAW_EXPONENT) {
+            if (static_cast<size_t>(end - p) < n * SIZE_OF_TYPE) {
+                return Status::InternalError("file corruption: not enough bytes for raw vector");
+            }
+            memcpy(out, p, n * SIZE_OF_TYPE);
+            *pos = p + n * SIZE_OF_TYPE;
+            return Status::OK();
+        }
+        if (exponent > Traits::MAX_EXPONENT || factor > exponent ||
+            bit_width > BitPacking::MAX_BITWIDTH || num_exceptions > n) {
+            return Status::InternalError(
+                    "file corruption: invalid vector, exponent:{}, factor:{}, bit width:{}, "
+                    "exceptions:{}",
+                    exponent, factor, bit_width, num_exceptions);
+        }
+        size_t packed_bytes = (n * bit_width + 7) / 8;
+        size_t exceptions_bytes = num_exceptions * (sizeof(uint16_t) + SIZE_OF_TYPE);
+        if (static_cast<size_t>(end - p) < packed_bytes + exceptions_bytes) {
+            return Status::InternalError("file corruption: not enough bytes for vector");
+        }
+
+        _digits.resize(n);
+        if (bit_width == 0) {
+            std::fill(_digits.begin(), _digits.end(), 0);
+        } else {
+            BitPacking::UnpackValues(bit_width, p, packed_bytes, n, _digits.data());
+        }
+        p += packed_bytes;
+        // a plain loop over the unpacked digits, the compiler vectorizes it
+        const uint64_t* __restrict digits = _digits.data();
+        const CppType exp = Traits::EXP[factor];
+        const CppType frac = Traits::FRAC[exponent];
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = static_cast<CppType>(static_cast<int64_t>(digits[i] + frame_of_reference)) *
+                     exp * frac;
+        }
+
+        const uint8_t* values = p + num_exceptions * sizeof(uint16_t);
+        for (uint32_t i = 0; i < num_exceptions; ++i) {
+            uint16_t position = decode_fixed16_le(p + i * sizeof(uint16_t));
+            if (position >= n) {
+                return Status::InternalError("file corruption: exception position {} >= {}",
+                                             position, n);
+            }
+            memcpy(&out[position], values + i * SIZE_OF_TYPE, SIZE_OF_TYPE);
+        }
+        *pos = p + exceptions_bytes;
+        return Status::OK();
+    }
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed;
+    size_t _num_elements;
+    size_t _cur_index;
+
+    std::vector<CppType> _decoded;
+    std::vector<uint64_t> _digits;
+    std::vector<CppType> _buffer;
+};
+
+} // namespace segment_v2
+} // namespace doris
@@ -24,9 +24,11 @@
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "olap/rowset/segment_v2/bitshuffle_page.h"
+#include "olap/rowset/segment_v2/fsst_page.h"
 #include "util/coding.h"
 #include "util/slice.h" // for Slice
 #include "vec/columns/column.h"
@@ -133,7 +135,7 @@ Status BinaryDictPageBuilder::add(const uint8_t* vals, size_t* count) {
         *count = num_added;
         return Status::OK();
     } else {
-        DCHECK_EQ(_encoding_type, PLAIN_ENCODING);
+        DCHECK(_encoding_type == PLAIN_ENCODING || _encoding_type == FSST_ENCODING);
         return _data_page_builder->add(vals, count);
     }
 }
@@ -164,10 +166,15 @@ Status BinaryDictPageBuilder::reset() {
 
         if (_encoding_type == DICT_ENCODING && _dict_builder->is_page_full()) {
             PageBuilder* data_page_builder_ptr = nullptr;
-            RETURN_IF_ERROR(BinaryPlainPageBuilder<FieldType::OLAP_FIELD_TYPE_VARCHAR>::create(
-                    &data_page_builder_ptr, _options));
+            if (config::enable_fsst_encoding) {
+                RETURN_IF_ERROR(FsstPageBuilder::create(&data_page_builder_ptr, _options));
+                _encoding_type = FSST_ENCODING;
+            } else {
+                RETURN_IF_ERROR(BinaryPlainPageBuilder<FieldType::OLAP_FIELD_TYPE_VARCHAR>::create(
+                        &data_page_builder_ptr, _options));
+                _encoding_type = PLAIN_ENCODING;
+            }
             _data_page_builder.reset(data_page_builder_ptr);
-            _encoding_type = PLAIN_ENCODING;
         } else {
             RETURN_IF_ERROR(_data_page_builder->reset());
         }
@@ -237,6 +244,8 @@ Status BinaryDictPageDecoder::init() {
         DCHECK_EQ(_encoding_type, PLAIN_ENCODING);
         _data_page_decoder.reset(
                 new BinaryPlainPageDecoder<FieldType::OLAP_FIELD_TYPE_INT>(_data, _options));
+    } else if (_encoding_type == FSST_ENCODING) {
+        _data_page_decoder.reset(new FsstPageDecoder(_data, _options));
     } else {
         LOG(WARNING) << "invalid encoding type:" << _encoding_type;
         return Status::Corruption("invalid encoding type:{}", _encoding_type);
@@ -263,7 +272,7 @@ void BinaryDictPageDecoder::set_dict_decoder(PageDecoder* dict_decoder, StringRe
 };
 
 Status BinaryDictPageDecoder::next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
-    if (_encoding_type == PLAIN_ENCODING) {
+    if (_encoding_type != DICT_ENCODING) {
         dst = dst->convert_to_predicate_column_if_dictionary();
         return _data_page_decoder->next_batch(n, dst);
     }
@@ -293,7 +302,7 @@ Status BinaryDictPageDecoder::next_batch(size_t* n, vectorized::MutableColumnPtr
 
 Status BinaryDictPageDecoder::read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal,
                                              size_t* n, vectorized::MutableColumnPtr& dst) {
-    if (_encoding_type == PLAIN_ENCODING) {
+    if (_encoding_type != DICT_ENCODING) {
         dst = dst->convert_to_predicate_column_if_dictionary();
         return _data_page_decoder->read_by_rowids(rowids, page_first_ordinal, n, dst);
     }
@@ -56,7 +56,8 @@ enum { BINARY_DICT_PAGE_HEADER_SIZE = 4 };
 // Or     header + embedded BinaryPlainPage, when mode_ = PLAIN_ENCODING.
 // Data pages start with mode_ = DICT_ENCODING, when the size of dictionary
 // page go beyond the option_->dict_page_size, the subsequent data pages will switch
-// to string plain page automatically.
+// to string plain page automatically, or to FsstPage (mode_ = FSST_ENCODING) when
+// config::enable_fsst_encoding is on.
 class BinaryDictPageBuilder : public PageBuilderHelper<BinaryDictPageBuilder> {
 public:
     using Self = BinaryDictPageBuilder;
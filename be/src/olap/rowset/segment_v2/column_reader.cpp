@@ -1478,6 +1478,24 @@ Status FileColumnIterator::get_row_ranges_by_dict(const AndBlockColumnPredicate*
     return Status::OK();
 }
 
+Status FileColumnIterator::get_data_pages(const roaring::Roaring& row_bitmap,
+                                          std::vector<std::pair<ordinal_t, PagePointer>>* pages) {
+    if (_reader->is_empty() || row_bitmap.isEmpty()) {
+        return Status::OK();
+    }
+    OrdinalPageIndexIterator iter;
+    RETURN_IF_ERROR(_reader->seek_at_or_before(row_bitmap.minimum(), &iter, _opts));
+    for (; iter.valid() && iter.first_ordinal() <= row_bitmap.maximum(); iter.next()) {
+        // rank(x) is the number of rows not larger than x
+        auto first = static_cast<uint32_t>(iter.first_ordinal());
+        auto last = static_cast<uint32_t>(iter.last_ordinal());
+        if (row_bitmap.rank(last) > (first == 0 ? 0 : row_bitmap.rank(first - 1))) {
+            pages->emplace_back(iter.first_ordinal(), iter.page());
+        }
+    }
+    return Status::OK();
+}
+
 Status DefaultValueColumnIterator::init(const ColumnIteratorOptions& opts) {
     _opts = opts;
     // be consistent with segment v1
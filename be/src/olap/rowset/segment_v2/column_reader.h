@@ -50,6 +50,10 @@
 #include "vec/data_types/data_type.h"
 #include "vec/json/path_in_data.h"
 
+namespace roaring {
+class Roaring;
+} // namespace roaring
+
 namespace doris {
 
 class BlockCompressionCodec;
@@ -344,8 +348,23 @@ public:
 
     virtual bool is_all_dict_encoding() const { return false; }
 
+    // Appends the first ordinal and the pointer of every data page holding any row of
+    // `row_bitmap`, in ordinal order. They are used to prefetch the pages to be read.
+    virtual Status get_data_pages(const roaring::Roaring& row_bitmap,
+                                  std::vector<std::pair<ordinal_t, PagePointer>>* pages) {
+        return Status::OK();
+    }
+
+    // Keep the reader alive as long as the iterator, a segment drops its cold readers.
+    void hold_column_reader(std::shared_ptr<ColumnReader> reader) {
+        _column_reader_holder = std::move(reader);
+    }
+
 protected:
     ColumnIteratorOptions _opts;
+
+private:
+    std::shared_ptr<ColumnReader> _column_reader_holder;
 };
 
 // This iterator is used to read column data from file
@@ -389,6 +408,9 @@ public:
 
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
 
+    Status get_data_pages(const roaring::Roaring& row_bitmap,
+                          std::vector<std::pair<ordinal_t, PagePointer>>* pages) override;
+
 private:
     Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const;
     Status _load_next_page(bool* eos);
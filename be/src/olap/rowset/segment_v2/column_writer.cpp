@@ -418,6 +418,20 @@ Status ScalarColumnWriter::init() {
 
     PageBuilder* page_builder = nullptr;
 
+    if (config::enable_alp_encoding && _opts.meta->encoding() == DEFAULT_ENCODING &&
+        (get_field()->type() == FieldType::OLAP_FIELD_TYPE_FLOAT ||
+         get_field()->type() == FieldType::OLAP_FIELD_TYPE_DOUBLE)) {
+        _opts.meta->set_encoding(ALP_ENCODING);
+    }
+    if (config::enable_delta_encoding && _opts.meta->encoding() == DEFAULT_ENCODING) {
+        if (get_field()->type() == FieldType::OLAP_FIELD_TYPE_INT ||
+            get_field()->type() == FieldType::OLAP_FIELD_TYPE_BIGINT) {
+            _opts.meta->set_encoding(DELTA_ENCODING);
+        } else if (get_field()->type() == FieldType::OLAP_FIELD_TYPE_DATETIMEV2) {
+            // timestamps come at a nearly fixed interval
+            _opts.meta->set_encoding(DELTA_OF_DELTA_ENCODING);
+        }
+    }
     RETURN_IF_ERROR(
             EncodingInfo::get(get_field()->type_info(), _opts.meta->encoding(), &_encoding_info));
     _opts.meta->set_encoding(_encoding_info->encoding());
@@ -0,0 +1,410 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// Delta encoding for nearly monotonic integers, e.g. auto increment ids and timestamps.
+// The differences between adjacent values (DELTA_ENCODING), or the differences between
+// adjacent differences (DELTA_OF_DELTA_ENCODING), are frame-of-reference bit packed.
+//
+// The page format is as follows:
+//
+// 1. Header:
+//
+//    <num_elements> [32-bit]
+//    <block_offsets> [32-bit * num_blocks]
+//      The offset of each block from the beginning of the page.
+//
+// 2. Blocks of DELTA_BLOCK_SIZE values, the last one may be shorter:
+//
+//    <first_value> [64-bit]
+//    <first_delta> [64-bit], only for DELTA_OF_DELTA_ENCODING
+//    <min_residual> [64-bit]
+//    <bit_width> [8-bit]
+//    <residuals> [(num_residuals * bit_width + 7) / 8 bytes]
+//      The deltas (or deltas of deltas) after the ones in the header, minus min_residual.
+//
+//   NOTE: all on-disk ints are encoded little-endian
+//
+// Every block starts from a value of its own, so seeking to an ordinal decodes only the
+// block holding it.
+static constexpr size_t DELTA_BLOCK_SIZE = 128;
+enum { DELTA_PAGE_HEADER_SIZE = 4 };
+
+inline uint8_t delta_bit_width(uint64_t range) {
+    return range == 0 ? 0 : static_cast<uint8_t>(64 - __builtin_clzll(range));
+}
+
+// ORDER is 1 for DELTA_ENCODING and 2 for DELTA_OF_DELTA_ENCODING.
+template <FieldType Type, int ORDER>
+class DeltaPageBuilder : public PageBuilderHelper<DeltaPageBuilder<Type, ORDER>> {
+public:
+    using Self = DeltaPageBuilder<Type, ORDER>;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        if (is_page_full()) {
+            *count = 0;
+            return Status::OK();
+        }
+        size_t to_add = std::min(_max_count - _values.size(), *count);
+        const auto* src = reinterpret_cast<const CppType*>(vals);
+        // This may need a large memory, should return error if could not allocated
+        // successfully, to avoid BE OOM.
+        RETURN_IF_CATCH_EXCEPTION(_values.insert(_values.end(), src, src + to_add));
+        *count = to_add;
+        return Status::OK();
+    }
+
+    Status finish(OwnedSlice* slice) override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _buffer.clear();
+            size_t num_blocks = (_values.size() + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE;
+            _buffer.resize(DELTA_PAGE_HEADER_SIZE + num_blocks * sizeof(uint32_t));
+            encode_fixed32_le(reinterpret_cast<uint8_t*>(_buffer.data()),
+                              static_cast<uint32_t>(_values.size()));
+            for (size_t block = 0; block < num_blocks; ++block) {
+                encode_fixed32_le(reinterpret_cast<uint8_t*>(_buffer.data()) +
+                                          DELTA_PAGE_HEADER_SIZE + block * sizeof(uint32_t),
+                                  static_cast<uint32_t>(_buffer.size()));
+                size_t start = block * DELTA_BLOCK_SIZE;
+                _encode_block(_values.data() + start,
+                              std::min(DELTA_BLOCK_SIZE, _values.size() - start));
+            }
+            *slice = _buffer.build();
+        });
+        return Status::OK();
+    }
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _values.clear();
+            _values.reserve(_max_count);
+            _buffer.clear();
+        });
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _values.size() * SIZE_OF_TYPE; }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.front(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.back(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(std::is_integral_v<CppType> && sizeof(CppType) <= sizeof(uint64_t));
+    static_assert(ORDER == 1 || ORDER == 2);
+
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+
+    DeltaPageBuilder(const PageBuilderOptions& options)
+            : _options(options),
+              _max_count(std::max<size_t>(1, options.data_page_size / SIZE_OF_TYPE)) {}
+
+    void _encode_block(const CppType* vals, size_t n) {
+        // the arithmetic is done on uint64_t and wraps, the decoder wraps back the same way
+        uint64_t first_delta = n > 1 ? static_cast<uint64_t>(vals[1]) - vals[0] : 0;
+        _residuals.clear();
+        if constexpr (ORDER == 1) {
+            for (size_t i = 1; i < n; ++i) {
+                _residuals.push_back(static_cast<uint64_t>(vals[i]) - vals[i - 1]);
+            }
+        } else {
+            uint64_t prev_delta = first_delta;
+            for (size_t i = 2; i < n; ++i) {
+                uint64_t delta = static_cast<uint64_t>(vals[i]) - vals[i - 1];
+                _residuals.push_back(delta - prev_delta);
+                prev_delta = delta;
+            }
+        }
+        int64_t min = _residuals.empty() ? 0 : std::numeric_limits<int64_t>::max();
+        int64_t max = _residuals.empty() ? 0 : std::numeric_limits<int64_t>::min();
+        for (uint64_t residual : _residuals) {
+            min = std::min(min, static_cast<int64_t>(residual));
+            max = std::max(max, static_cast<int64_t>(residual));
+        }
+        uint8_t bit_width =
+                delta_bit_width(static_cast<uint64_t>(max) - static_cast<uint64_t>(min));
+
+        put_fixed64_le(&_buffer, static_cast<uint64_t>(vals[0]));
+        if constexpr (ORDER == 2) {
+            put_fixed64_le(&_buffer, first_delta);
+        }
+        put_fixed64_le(&_buffer, static_cast<uint64_t>(min));
+        _buffer.push_back(static_cast<char>(bit_width));
+        if (bit_width > 0) {
+            _packed.clear();
+            BitWriter writer(&_packed);
+            for (uint64_t residual : _residuals) {
+                writer.PutValue(residual - static_cast<uint64_t>(min), bit_width);
+            }
+            writer.Flush();
+            _buffer.append(_packed.data(), _packed.size());
+        }
+    }
+
+    PageBuilderOptions _options;
+    size_t _max_count;
+    std::vector<CppType> _values;
+    faststring _buffer;
+
+    std::vector<uint64_t> _residuals;
+    faststring _packed;
+};
+
+// Blocks are decoded when they are read, a seek only moves the index.
+template <FieldType Type, int ORDER>
+class DeltaPageDecoder : public PageDecoder {
+public:
+    DeltaPageDecoder(Slice data, const PageDecoderOptions& options)
+            : _data(data), _options(options), _parsed(false), _num_elements(0), _cur_index(0) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < DELTA_PAGE_HEADER_SIZE) {
+            return Status::InternalError(
+                    "file corruption: invalid data size:{}, header size:{}", _data.size,
+                    DELTA_PAGE_HEADER_SIZE);
+        }
+        _num_elements = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data));
+        _num_blocks = (_num_elements + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE;
+        if (_data.size < DELTA_PAGE_HEADER_SIZE + _num_blocks * sizeof(uint32_t)) {
+            return Status::InternalError(
+                    "file corruption: not enough bytes for {} block offsets, data size:{}",
+                    _num_blocks, _data.size);
+        }
+        size_t prev = DELTA_PAGE_HEADER_SIZE + _num_blocks * sizeof(uint32_t);
+        for (size_t block = 0; block < _num_blocks; ++block) {
+            size_t offset = _block_offset(block);
+            if (offset < prev || offset > _data.size) {
+                return Status::InternalError("file corruption: invalid offset {} of block {}",
+                                             offset, block);
+            }
+            prev = offset;
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        if (_num_elements == 0) [[unlikely]] {
+            if (pos != 0) {
+                return Status::Error<ErrorCode::INTERNAL_ERROR, false>(
+                        "seek pos {} is larger than total elements  {}", pos, _num_elements);
+            }
+        }
+        DCHECK_LE(pos, _num_elements);
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    template <bool forward_index = true>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        size_t max_fetch = std::min(*n, _num_elements - _cur_index);
+        size_t index = _cur_index;
+        size_t end = _cur_index + max_fetch;
+        while (index < end) {
+            RETURN_IF_ERROR(_load_block(index / DELTA_BLOCK_SIZE));
+            size_t in_block = index % DELTA_BLOCK_SIZE;
+            size_t num = std::min(end - index, _block_size - in_block);
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(&_block[in_block]), num);
+            index += num;
+        }
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index = end;
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        auto total = *n;
+        size_t read_count = 0;
+        _buffer.resize(total);
+        for (size_t i = 0; i < total; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= _num_elements)) {
+                break;
+            }
+            RETURN_IF_ERROR(_load_block(ord / DELTA_BLOCK_SIZE));
+            _buffer[read_count++] = _block[ord % DELTA_BLOCK_SIZE];
+        }
+
+        if (LIKELY(read_count > 0)) {
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()),
+                                          read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<false>(n, dst);
+    }
+
+    size_t count() const override { return _num_elements; }
+
+    size_t current_index() const override { return _cur_index; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    // first_value, first_delta for DELTA_OF_DELTA_ENCODING, min_residual and bit_width
+    static constexpr size_t BLOCK_HEADER_SIZE = sizeof(uint64_t) * (ORDER + 1) + 1;
+
+    size_t _block_offset(size_t block) const {
+        return decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data) +
+                                 DELTA_PAGE_HEADER_SIZE + block * sizeof(uint32_t));
+    }
+
+    Status _load_block(size_t block) {
+        if (block == _loaded_block) {
+            return Status::OK();
+        }
+        size_t start = _block_offset(block);
+        size_t end = block + 1 < _num_blocks ? _block_offset(block + 1) : _data.size;
+        size_t n = std::min(DELTA_BLOCK_SIZE, _num_elements - block * DELTA_BLOCK_SIZE);
+        if (end - start < BLOCK_HEADER_SIZE) {
+            return Status::InternalError("file corruption: not enough bytes for block {}",
+                                         block);
+        }
+        const auto* p = reinterpret_cast<const uint8_t*>(_data.data) + start;
+        uint64_t value = decode_fixed64_le(p);
+        p += sizeof(uint64_t);
+        uint64_t delta = 0;
+        if constexpr (ORDER == 2) {
+            delta = decode_fixed64_le(p);
+            p += sizeof(uint64_t);
+        }
+        uint64_t min = decode_fixed64_le(p);
+        uint8_t bit_width = p[sizeof(uint64_t)];
+        p += sizeof(uint64_t) + 1;
+        size_t num_residuals = n > ORDER ? n - ORDER : 0;
+        size_t packed_bytes = (num_residuals * bit_width + 7) / 8;
+        if (bit_width > BitPacking::MAX_BITWIDTH ||
+            end - start - BLOCK_HEADER_SIZE < packed_bytes) {
+            return Status::InternalError(
+                    "file corruption: invalid block {}, bit width:{}, size:{}", block, bit_width,
+                    end - start);
+        }
+
+        _residuals.resize(num_residuals);
+        if (bit_width == 0) {
+            std::fill(_residuals.begin(), _residuals.end(), 0);
+        } else {
+            BitPacking::UnpackValues(bit_width, p, packed_bytes, num_residuals,
+                                     _residuals.data());
+        }
+        _block[0] = static_cast<CppType>(value);
+        if constexpr (ORDER == 1) {
+            for (size_t i = 0; i < num_residuals; ++i) {
+                value += _residuals[i] + min;
+                _block[i + 1] = static_cast<CppType>(value);
+            }
+        } else {
+            if (n > 1) {
+                value += delta;
+                _block[1] = static_cast<CppType>(value);
+            }
+            for (size_t i = 0; i < num_residuals; ++i) {
+                delta += _residuals[i] + min;
+                value += delta;
+                _block[i + 2] = static_cast<CppType>(value);
+            }
+        }
+        _loaded_block = block;
+        _block_size = n;
+        return Status::OK();
+    }
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed;
+    size_t _num_elements;
+    size_t _num_blocks = 0;
+    size_t _cur_index;
+
+    size_t _loaded_block = std::numeric_limits<size_t>::max();
+    size_t _block_size = 0;
+    CppType _block[DELTA_BLOCK_SIZE];
+    std::vector<uint64_t> _residuals;
+    std::vector<CppType> _buffer;
+};
+
+} // namespace segment_v2
+} // namespace doris
@@ -25,11 +25,13 @@
 #include <utility>
 
 #include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/alp_page.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h"
 #include "olap/rowset/segment_v2/binary_plain_page.h"
 #include "olap/rowset/segment_v2/binary_prefix_page.h"
 #include "olap/rowset/segment_v2/bitshuffle_page.h"
 #include "olap/rowset/segment_v2/bitshuffle_page_pre_decoder.h"
+#include "olap/rowset/segment_v2/delta_page.h"
 #include "olap/rowset/segment_v2/frame_of_reference_page.h"
 #include "olap/rowset/segment_v2/plain_page.h"
 #include "olap/rowset/segment_v2/rle_page.h"
@@ -164,6 +166,45 @@ struct TypeEncodingTraits<type, FOR_ENCODING, CppType,
     }
 };
 
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, ALP_ENCODING, CppType,
+                          typename std::enable_if<std::is_floating_point<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        return AlpPageBuilder<type>::create(builder, opts);
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new AlpPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, DELTA_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        return DeltaPageBuilder<type, 1>::create(builder, opts);
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new DeltaPageDecoder<type, 1>(data, opts);
+        return Status::OK();
+    }
+};
+
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, DELTA_OF_DELTA_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        return DeltaPageBuilder<type, 2>::create(builder, opts);
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new DeltaPageDecoder<type, 2>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <FieldType type>
 struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
@@ -241,10 +282,14 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<FieldType::OLAP_FIELD_TYPE_INT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_INT, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_INT, DELTA_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_INT, DELTA_OF_DELTA_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_INT, PLAIN_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, DELTA_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, DELTA_OF_DELTA_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_BIGINT, PLAIN_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_UNSIGNED_BIGINT, BIT_SHUFFLE>();
@@ -256,9 +301,11 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, ALP_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, ALP_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, PLAIN_ENCODING>();
@@ -296,6 +343,8 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, FOR_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, DELTA_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, DELTA_OF_DELTA_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DATETIME, PLAIN_ENCODING>();
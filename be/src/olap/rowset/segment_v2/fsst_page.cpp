@@ -0,0 +1,431 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/fsst_page.h"
+
+#include <parallel_hashmap/phmap.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "common/status.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// symbols are learned in some generations, each one keeps the single symbols and the
+// concatenations of adjacent symbols which gained the most in the previous one
+static constexpr int FSST_TRAIN_GENERATIONS = 5;
+// the bytes of strings sampled to train the symbol table of a page
+static constexpr size_t FSST_SAMPLE_BYTES = 16 * 1024;
+// a byte without a symbol is counted as the code FSST_BYTE_CODE_BASE + byte
+static constexpr uint32_t FSST_BYTE_CODE_BASE = 256;
+
+FsstSymbolTable::FsstSymbolTable() {
+    _symbols.fill(0);
+    _lengths.fill(0);
+}
+
+void FsstSymbolTable::_add_symbol(const char* data, size_t length) {
+    DCHECK_LT(_num_symbols, MAX_SYMBOLS);
+    DCHECK(length > 0 && length <= MAX_SYMBOL_LENGTH);
+    uint64_t symbol = 0;
+    memcpy(&symbol, data, length);
+    _symbols[_num_symbols] = symbol;
+    _lengths[_num_symbols] = static_cast<uint8_t>(length);
+    ++_num_symbols;
+}
+
+void FsstSymbolTable::_build_index() {
+    for (auto& codes : _codes_by_first_byte) {
+        codes.clear();
+    }
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        _codes_by_first_byte[_symbols[code] & 0xFF].push_back(static_cast<uint8_t>(code));
+    }
+    for (auto& codes : _codes_by_first_byte) {
+        std::sort(codes.begin(), codes.end(),
+                  [this](uint8_t lhs, uint8_t rhs) { return _lengths[lhs] > _lengths[rhs]; });
+    }
+}
+
+int FsstSymbolTable::_find(const uint8_t* pos, size_t remain) const {
+    uint64_t word = 0;
+    memcpy(&word, pos, std::min(remain, MAX_SYMBOL_LENGTH));
+    for (uint8_t code : _codes_by_first_byte[*pos]) {
+        size_t length = _lengths[code];
+        uint64_t mask = length == MAX_SYMBOL_LENGTH ? ~0ULL : (1ULL << (length * 8)) - 1;
+        if (length <= remain && (word & mask) == _symbols[code]) {
+            return code;
+        }
+    }
+    return -1;
+}
+
+void FsstSymbolTable::train(const std::vector<Slice>& samples) {
+    _num_symbols = 0;
+    _build_index();
+    std::vector<uint32_t> counts(FSST_BYTE_CODE_BASE + 256);
+    phmap::flat_hash_map<uint32_t, uint32_t> pair_counts;
+    phmap::flat_hash_map<std::string, uint64_t> gains;
+    std::vector<std::pair<uint64_t, std::string>> candidates;
+    for (int generation = 0; generation < FSST_TRAIN_GENERATIONS; ++generation) {
+        std::fill(counts.begin(), counts.end(), 0);
+        pair_counts.clear();
+        for (const Slice& sample : samples) {
+            const auto* pos = reinterpret_cast<const uint8_t*>(sample.data);
+            const auto* end = pos + sample.size;
+            int64_t prev = -1;
+            while (pos < end) {
+                int code = _find(pos, end - pos);
+                size_t length = 1;
+                if (code < 0) {
+                    code = FSST_BYTE_CODE_BASE + *pos;
+                } else {
+                    length = _lengths[code];
+                }
+                ++counts[code];
+                if (prev >= 0) {
+                    ++pair_counts[static_cast<uint32_t>(prev << 9 | code)];
+                }
+                prev = code;
+                pos += length;
+            }
+        }
+
+        auto symbol_of = [this](uint32_t code) {
+            if (code >= FSST_BYTE_CODE_BASE) {
+                return std::string(1, static_cast<char>(code - FSST_BYTE_CODE_BASE));
+            }
+            return std::string(reinterpret_cast<const char*>(&_symbols[code]), _lengths[code]);
+        };
+        gains.clear();
+        for (uint32_t code = 0; code < counts.size(); ++code) {
+            if (counts[code] > 0) {
+                std::string symbol = symbol_of(code);
+                gains[symbol] += static_cast<uint64_t>(counts[code]) * symbol.size();
+            }
+        }
+        for (const auto& [pair, count] : pair_counts) {
+            std::string symbol = symbol_of(pair >> 9) + symbol_of(pair & 0x1FF);
+            if (symbol.size() <= MAX_SYMBOL_LENGTH) {
+                gains[symbol] += static_cast<uint64_t>(count) * symbol.size();
+            }
+        }
+
+        candidates.clear();
+        for (auto& [symbol, gain] : gains) {
+            candidates.emplace_back(gain, symbol);
+        }
+        size_t num_symbols = std::min(MAX_SYMBOLS, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + num_symbols, candidates.end(),
+                          [](const auto& lhs, const auto& rhs) {
+                              return lhs.first != rhs.first ? lhs.first > rhs.first
+                                                            : lhs.second < rhs.second;
+                          });
+        _num_symbols = 0;
+        for (size_t i = 0; i < num_symbols; ++i) {
+            _add_symbol(candidates[i].second.data(), candidates[i].second.size());
+        }
+        _build_index();
+    }
+}
+
+void FsstSymbolTable::compress(const Slice& value, faststring* dst) const {
+    const auto* pos = reinterpret_cast<const uint8_t*>(value.data);
+    const auto* end = pos + value.size;
+    while (pos < end) {
+        int code = _find(pos, end - pos);
+        if (code < 0) {
+            dst->push_back(static_cast<char>(ESCAPE_CODE));
+            dst->push_back(static_cast<char>(*pos));
+            ++pos;
+        } else {
+            dst->push_back(static_cast<char>(code));
+            pos += _lengths[code];
+        }
+    }
+}
+
+size_t FsstSymbolTable::decompress(const uint8_t* src, size_t size, char* dst) const {
+    char* out = dst;
+    const uint8_t* end = src + size;
+    while (src < end) {
+        uint8_t code = *src++;
+        if (code == ESCAPE_CODE) [[unlikely]] {
+            if (src == end) [[unlikely]] {
+                break;
+            }
+            *out++ = static_cast<char>(*src++);
+        } else {
+            // copy the whole padded symbol, the unused code has length 0
+            memcpy(out, &_symbols[code], MAX_SYMBOL_LENGTH);
+            out += _lengths[code];
+        }
+    }
+    return out - dst;
+}
+
+void FsstSymbolTable::serialize(faststring* dst) const {
+    dst->push_back(static_cast<char>(_num_symbols));
+    dst->append(_lengths.data(), _num_symbols);
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        dst->append(&_symbols[code], _lengths[code]);
+    }
+}
+
+Status FsstSymbolTable::deserialize(const Slice& data, size_t* size) {
+    _symbols.fill(0);
+    _lengths.fill(0);
+    _num_symbols = 0;
+    if (data.size < 1) {
+        return Status::Corruption("file corruption: not enough bytes for fsst symbol table");
+    }
+    const auto* pos = reinterpret_cast<const uint8_t*>(data.data);
+    size_t num_symbols = pos[0];
+    if (data.size < 1 + num_symbols) {
+        return Status::Corruption("file corruption: not enough bytes for {} fsst symbols",
+                                  num_symbols);
+    }
+    const uint8_t* lengths = pos + 1;
+    const auto* symbols = reinterpret_cast<const char*>(lengths + num_symbols);
+    size_t offset = 1 + num_symbols;
+    for (size_t code = 0; code < num_symbols; ++code) {
+        if (lengths[code] == 0 || lengths[code] > MAX_SYMBOL_LENGTH ||
+            offset + lengths[code] > data.size) {
+            return Status::Corruption("file corruption: invalid fsst symbol length {}",
+                                      lengths[code]);
+        }
+        _add_symbol(symbols, lengths[code]);
+        symbols += lengths[code];
+        offset += lengths[code];
+    }
+    _build_index();
+    *size = offset;
+    return Status::OK();
+}
+
+Status FsstPageBuilder::add(const uint8_t* vals, size_t* count) {
+    DCHECK(!_finished);
+    size_t i = 0;
+    // If the page is full, should stop adding more items.
+    while (!is_page_full() && i < *count) {
+        const auto* src = reinterpret_cast<const Slice*>(vals);
+        _offsets.push_back(static_cast<uint32_t>(_raw.size()));
+        // This may need a large memory, should return error if could not allocated
+        // successfully, to avoid BE OOM.
+        RETURN_IF_CATCH_EXCEPTION(_raw.append(src->data, src->size));
+        _size_estimate += src->size + sizeof(uint32_t);
+        i++;
+        vals += sizeof(Slice);
+    }
+    *count = i;
+    return Status::OK();
+}
+
+Status FsstPageBuilder::finish(OwnedSlice* slice) {
+    DCHECK(!_finished);
+    _finished = true;
+    RETURN_IF_CATCH_EXCEPTION({
+        std::vector<Slice> samples;
+        size_t step = std::max<size_t>(1, _raw.size() / FSST_SAMPLE_BYTES);
+        for (size_t i = 0; i < _offsets.size(); i += step) {
+            samples.push_back(_value_at(i));
+        }
+        _table.train(samples);
+
+        std::vector<uint32_t> offsets;
+        offsets.reserve(_offsets.size() + 1);
+        _buffer.clear();
+        _table.serialize(&_buffer);
+        for (size_t i = 0; i < _offsets.size(); ++i) {
+            offsets.push_back(static_cast<uint32_t>(_buffer.size()));
+            _table.compress(_value_at(i), &_buffer);
+        }
+        if (_buffer.size() > _raw.size()) {
+            // keep the strings as they are
+            _buffer.clear();
+            _buffer.push_back(0);
+            _buffer.append(_raw.data(), _raw.size());
+            offsets.clear();
+            for (uint32_t offset : _offsets) {
+                offsets.push_back(offset + 1);
+            }
+        }
+        offsets.push_back(static_cast<uint32_t>(_buffer.size()));
+        for (uint32_t offset : offsets) {
+            put_fixed32_le(&_buffer, offset);
+        }
+        put_fixed32_le(&_buffer, static_cast<uint32_t>(_offsets.size()));
+        if (!_offsets.empty()) {
+            Slice first = _value_at(0);
+            Slice last = _value_at(_offsets.size() - 1);
+            _first_value.assign_copy(reinterpret_cast<const uint8_t*>(first.data), first.size);
+            _last_value.assign_copy(reinterpret_cast<const uint8_t*>(last.data), last.size);
+        }
+        *slice = _buffer.build();
+    });
+    return Status::OK();
+}
+
+Status FsstPageBuilder::reset() {
+    RETURN_IF_CATCH_EXCEPTION({
+        _offsets.clear();
+        _raw.clear();
+        _raw.reserve(_options.data_page_size == 0 ? 1024 : _options.data_page_size);
+        _buffer.clear();
+        _size_estimate = sizeof(uint32_t);
+        _finished = false;
+    });
+    return Status::OK();
+}
+
+Status FsstPageBuilder::get_first_value(void* value) const {
+    DCHECK(_finished);
+    if (_offsets.empty()) {
+        return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = Slice(_first_value);
+    return Status::OK();
+}
+
+Status FsstPageBuilder::get_last_value(void* value) const {
+    DCHECK(_finished);
+    if (_offsets.empty()) {
+        return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = Slice(_last_value);
+    return Status::OK();
+}
+
+Status FsstPageDecoder::init() {
+    CHECK(!_parsed);
+    if (_data.size < sizeof(uint32_t)) {
+        return Status::Corruption(
+                "file corruption: not enough bytes for trailer in FsstPageDecoder, data size:{}",
+                _data.size);
+    }
+    _num_elems = decode_fixed32_le(
+            reinterpret_cast<const uint8_t*>(&_data[_data.size - sizeof(uint32_t)]));
+    size_t trailer_size = (static_cast<size_t>(_num_elems) + 2) * sizeof(uint32_t);
+    if (trailer_size > _data.size) {
+        return Status::Corruption("file corruption: data size:{} < trailer size:{}", _data.size,
+                                  trailer_size);
+    }
+    _offsets_pos = _data.size - trailer_size;
+    size_t table_size = 0;
+    RETURN_IF_ERROR(_table.deserialize(Slice(_data.data, _offsets_pos), &table_size));
+    if (_offset(0) < table_size || _offset(_num_elems) > _offsets_pos) {
+        return Status::Corruption(
+                "file corruption: strings [{}, {}) out of [{}, {}), num elements:{}",
+                _offset(0), _offset(_num_elems), table_size, _offsets_pos, _num_elems);
+    }
+    _parsed = true;
+    return Status::OK();
+}
+
+Status FsstPageDecoder::seek_to_position_in_page(size_t pos) {
+    if (_num_elems == 0) [[unlikely]] {
+        if (pos != 0) {
+            return Status::Error<ErrorCode::INTERNAL_ERROR, false>(
+                    "seek pos {} is larger than total elements  {}", pos, _num_elems);
+        }
+    }
+    DCHECK_LE(pos, _num_elems);
+    _cur_idx = pos;
+    return Status::OK();
+}
+
+template <typename OrdinalFunc>
+Status FsstPageDecoder::_decode(size_t num, OrdinalFunc ordinal_at) {
+    size_t compressed_size = 0;
+    for (size_t i = 0; i < num; ++i) {
+        size_t ord = ordinal_at(i);
+        uint32_t start = _offset(ord);
+        uint32_t end = _offset(ord + 1);
+        if (start > end || end > _offsets_pos) [[unlikely]] {
+            return Status::Corruption("file corruption: invalid string [{}, {}) at {}", start,
+                                      end, ord);
+        }
+        compressed_size += end - start;
+    }
+    bool compressed = _table.num_symbols() > 0;
+    _decoded.resize(compressed ? FsstSymbolTable::max_decompressed_size(compressed_size)
+                               : compressed_size);
+    _decoded_offsets.resize(num + 1);
+    _decoded_offsets[0] = 0;
+    size_t pos = 0;
+    for (size_t i = 0; i < num; ++i) {
+        size_t ord = ordinal_at(i);
+        uint32_t start = _offset(ord);
+        uint32_t size = _offset(ord + 1) - start;
+        const auto* src = reinterpret_cast<const uint8_t*>(&_data[start]);
+        if (compressed) {
+            pos += _table.decompress(src, size, _decoded.data() + pos);
+        } else {
+            memcpy(_decoded.data() + pos, src, size);
+            pos += size;
+        }
+        _decoded_offsets[i + 1] = static_cast<uint32_t>(pos);
+    }
+    return Status::OK();
+}
+
+Status FsstPageDecoder::next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+    DCHECK(_parsed);
+    if (*n == 0 || _cur_idx >= _num_elems) [[unlikely]] {
+        *n = 0;
+        return Status::OK();
+    }
+    const size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+    const size_t first = _cur_idx;
+    RETURN_IF_ERROR(_decode(max_fetch, [first](size_t i) { return first + i; }));
+    dst->insert_many_continuous_binary_data(_decoded.data(), _decoded_offsets.data(), max_fetch);
+    _cur_idx += max_fetch;
+    *n = max_fetch;
+    return Status::OK();
+}
+
+Status FsstPageDecoder::read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal,
+                                       size_t* n, vectorized::MutableColumnPtr& dst) {
+    DCHECK(_parsed);
+    if (*n == 0) [[unlikely]] {
+        *n = 0;
+        return Status::OK();
+    }
+    size_t read_count = 0;
+    while (read_count < *n && rowids[read_count] - page_first_ordinal < _num_elems) {
+        ++read_count;
+    }
+    if (LIKELY(read_count > 0)) {
+        RETURN_IF_ERROR(_decode(read_count, [rowids, page_first_ordinal](size_t i) {
+            return static_cast<size_t>(rowids[i] - page_first_ordinal);
+        }));
+        dst->insert_many_continuous_binary_data(_decoded.data(), _decoded_offsets.data(),
+                                                read_count);
+    }
+    *n = read_count;
+    return Status::OK();
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,196 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// FSST (Fast Static Symbol Table) page encoding for strings.
+//
+// Each page learns a table of up to 255 symbols of 1 to 8 bytes from its strings, and every
+// string is compressed on its own into symbol codes, a byte without a symbol is escaped. So a
+// single string is decompressed without touching the others.
+//
+// The page consists of:
+// Header
+//   <num_symbols> [8-bit]
+//     0 means the strings are stored as they are, used when FSST doesn't make the page smaller.
+//   <symbol_lengths> [8-bit * num_symbols]
+//   <symbols> [sum of symbol_lengths]
+// Strings:
+//   compressed strings
+// Trailer
+//  Offsets:
+//    offsets pointing to the beginning of each string, then to the end of the last one
+//  num_elems (32-bit fixed)
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "common/logging.h"
+#include "common/status.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class FsstSymbolTable {
+public:
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr size_t MAX_SYMBOLS = 255;
+    static constexpr size_t MAX_SYMBOL_LENGTH = 8;
+    // decompressing writes whole symbols, the output needs this many bytes beyond the string
+    static constexpr size_t DECOMPRESS_PADDING = MAX_SYMBOL_LENGTH;
+
+    FsstSymbolTable();
+
+    // Learn the symbols which compress the samples best.
+    void train(const std::vector<Slice>& samples);
+
+    size_t num_symbols() const { return _num_symbols; }
+
+    // Append the codes of value to dst, the longest symbol is taken first.
+    void compress(const Slice& value, faststring* dst) const;
+
+    // Return the size of the decompressed string. dst must have room for
+    // max_decompressed_size(size) bytes.
+    size_t decompress(const uint8_t* src, size_t size, char* dst) const;
+
+    static size_t max_decompressed_size(size_t size) {
+        return size * MAX_SYMBOL_LENGTH + DECOMPRESS_PADDING;
+    }
+
+    void serialize(faststring* dst) const;
+
+    // Parse the table at the beginning of data, *size is set to the bytes it takes.
+    Status deserialize(const Slice& data, size_t* size);
+
+private:
+    // The code of the longest symbol at pos, or -1 if there is none.
+    int _find(const uint8_t* pos, size_t remain) const;
+
+    void _add_symbol(const char* data, size_t length);
+
+    void _build_index();
+
+    size_t _num_symbols = 0;
+    // the symbol bytes padded with zero
+    std::array<uint64_t, MAX_SYMBOLS> _symbols;
+    std::array<uint8_t, MAX_SYMBOLS> _lengths;
+    // the codes of the symbols starting with a byte, the longest first
+    std::array<std::vector<uint8_t>, 256> _codes_by_first_byte;
+};
+
+class FsstPageBuilder : public PageBuilderHelper<FsstPageBuilder> {
+public:
+    using Self = FsstPageBuilder;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override {
+        return _options.data_page_size != 0 && _size_estimate > _options.data_page_size;
+    }
+
+    Status add(const uint8_t* vals, size_t* count) override;
+
+    Status finish(OwnedSlice* slice) override;
+
+    Status reset() override;
+
+    size_t count() const override { return _offsets.size(); }
+
+    uint64_t size() const override { return _size_estimate; }
+
+    Status get_first_value(void* value) const override;
+
+    Status get_last_value(void* value) const override;
+
+private:
+    FsstPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    Slice _value_at(size_t idx) const {
+        size_t end = idx + 1 < _offsets.size() ? _offsets[idx + 1] : _raw.size();
+        return {&_raw[_offsets[idx]], end - _offsets[idx]};
+    }
+
+    PageBuilderOptions _options;
+    bool _finished = false;
+    size_t _size_estimate = 0;
+    // the strings as they are added, compressed in finish()
+    faststring _raw;
+    std::vector<uint32_t> _offsets;
+    FsstSymbolTable _table;
+    faststring _buffer;
+    faststring _first_value;
+    faststring _last_value;
+};
+
+class FsstPageDecoder : public PageDecoder {
+public:
+    FsstPageDecoder(Slice data, const PageDecoderOptions& options)
+            : _data(data), _options(options) {}
+
+    Status init() override;
+
+    Status seek_to_position_in_page(size_t pos) override;
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override;
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override;
+
+    size_t count() const override {
+        DCHECK(_parsed);
+        return _num_elems;
+    }
+
+    size_t current_index() const override {
+        DCHECK(_parsed);
+        return _cur_idx;
+    }
+
+private:
+    uint32_t _offset(size_t idx) const {
+        return decode_fixed32_le(reinterpret_cast<const uint8_t*>(&_data[_offsets_pos]) +
+                                 idx * sizeof(uint32_t));
+    }
+
+    // Decompress the strings of the ordinals into _decoded and set _decoded_offsets.
+    template <typename OrdinalFunc>
+    Status _decode(size_t num, OrdinalFunc ordinal_at);
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+    uint32_t _num_elems = 0;
+    size_t _offsets_pos = 0;
+    size_t _cur_idx = 0;
+    FsstSymbolTable _table;
+
+    std::vector<char> _decoded;
+    std::vector<uint32_t> _decoded_offsets;
+};
+
+} // namespace segment_v2
+} // namespace doris
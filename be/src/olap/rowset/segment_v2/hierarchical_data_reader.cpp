@@ -17,6 +17,7 @@
 
 #include "olap/rowset/segment_v2/hierarchical_data_reader.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "common/status.h"
@@ -145,22 +146,62 @@ ordinal_t HierarchicalDataReader::get_current_ordinal() const {
     return (*_substream_reader.begin())->data.iterator->get_current_ordinal();
 }
 
-Status ExtractReader::init(const ColumnIteratorOptions& opts) {
-    if (!_root_reader->inited) {
-        RETURN_IF_ERROR(_root_reader->iterator->init(opts));
-        _root_reader->inited = true;
+Status VariantRootColumnReader::init(const ColumnIteratorOptions& opts) {
+    if (!_root->inited) {
+        RETURN_IF_ERROR(_root->iterator->init(opts));
+        _root->inited = true;
+    }
+    return Status::OK();
+}
+
+Status VariantRootColumnReader::next_batch(ordinal_t ord, size_t* n,
+                                           const vectorized::IColumn** column) {
+    DCHECK(_root->inited);
+    if (!_has_range || _range_ordinal != ord || _range_requested != *n) {
+        _root->column->clear();
+        _has_rowids = false;
+        _has_range = false;
+        if (_root->iterator->get_current_ordinal() != ord) {
+            RETURN_IF_ERROR(_root->iterator->seek_to_ordinal(ord));
+        }
+        _range_requested = *n;
+        RETURN_IF_ERROR(_root->iterator->next_batch(n, _root->column));
+        _has_range = true;
+        _range_ordinal = ord;
+        _range_read = *n;
     }
+    *n = _range_read;
+    *column = _root->column.get();
     return Status::OK();
 }
 
+Status VariantRootColumnReader::read_by_rowids(const rowid_t* rowids, size_t count,
+                                               const vectorized::IColumn** column) {
+    DCHECK(_root->inited);
+    if (!_has_rowids || _rowids.size() != count ||
+        !std::equal(_rowids.begin(), _rowids.end(), rowids)) {
+        _root->column->clear();
+        _has_range = false;
+        _has_rowids = false;
+        RETURN_IF_ERROR(_root->iterator->read_by_rowids(rowids, count, _root->column));
+        _rowids.assign(rowids, rowids + count);
+        _has_rowids = true;
+    }
+    *column = _root->column.get();
+    return Status::OK();
+}
+
+Status ExtractReader::init(const ColumnIteratorOptions& opts) {
+    return _root_reader->init(opts);
+}
+
 Status ExtractReader::seek_to_ordinal(ordinal_t ord) {
-    CHECK(_root_reader->inited);
-    return _root_reader->iterator->seek_to_ordinal(ord);
+    _current_ordinal = ord;
+    return Status::OK();
 }
 
-Status ExtractReader::extract_to(vectorized::MutableColumnPtr& dst, size_t nrows) {
-    DCHECK(_root_reader);
-    DCHECK(_root_reader->inited);
+Status ExtractReader::extract_to(const vectorized::IColumn& root_column,
+                                 vectorized::MutableColumnPtr& dst, size_t nrows) {
     vectorized::ColumnNullable* nullable_column = nullptr;
     if (dst->is_nullable()) {
         nullable_column = assert_cast<vectorized::ColumnNullable*>(dst.get());
@@ -170,11 +211,11 @@ Status ExtractReader::extract_to(vectorized::MutableColumnPtr& dst, size_t nrows
                     ? assert_cast<vectorized::ColumnVariant&>(*dst)
                     : assert_cast<vectorized::ColumnVariant&>(nullable_column->get_nested_column());
     const auto& root =
-            _root_reader->column->is_nullable()
-                    ? assert_cast<vectorized::ColumnVariant&>(
-                              assert_cast<vectorized::ColumnNullable&>(*_root_reader->column)
+            root_column.is_nullable()
+                    ? assert_cast<const vectorized::ColumnVariant&>(
+                              assert_cast<const vectorized::ColumnNullable&>(root_column)
                                       .get_nested_column())
-                    : assert_cast<const vectorized::ColumnVariant&>(*_root_reader->column);
+                    : assert_cast<const vectorized::ColumnVariant&>(root_column);
     // extract root value with path, we can't modify the original root column
     // since some other column may depend on it.
     vectorized::MutableColumnPtr extracted_column;
@@ -206,7 +247,6 @@ Status ExtractReader::extract_to(vectorized::MutableColumnPtr& dst, size_t nrows
                 assert_cast<vectorized::ColumnNullable&>(*variant.get_root()).get_null_map_column();
         dst_null_map.insert_range_from(src_null_map, 0, src_null_map.size());
     }
-    _root_reader->column->clear();
 #ifndef NDEBUG
     variant.check_consistency();
 #endif
@@ -214,20 +254,23 @@ Status ExtractReader::extract_to(vectorized::MutableColumnPtr& dst, size_t nrows
 }
 
 Status ExtractReader::next_batch(size_t* n, vectorized::MutableColumnPtr& dst, bool* has_null) {
-    RETURN_IF_ERROR(_root_reader->iterator->next_batch(n, _root_reader->column));
-    RETURN_IF_ERROR(extract_to(dst, *n));
+    const vectorized::IColumn* root_column = nullptr;
+    RETURN_IF_ERROR(_root_reader->next_batch(_current_ordinal, n, &root_column));
+    _current_ordinal += *n;
+    RETURN_IF_ERROR(extract_to(*root_column, dst, *n));
     return Status::OK();
 }
 
 Status ExtractReader::read_by_rowids(const rowid_t* rowids, const size_t count,
                                      vectorized::MutableColumnPtr& dst) {
-    RETURN_IF_ERROR(_root_reader->iterator->read_by_rowids(rowids, count, _root_reader->column));
-    RETURN_IF_ERROR(extract_to(dst, count));
+    const vectorized::IColumn* root_column = nullptr;
+    RETURN_IF_ERROR(_root_reader->read_by_rowids(rowids, count, &root_column));
+    RETURN_IF_ERROR(extract_to(*root_column, dst, count));
     return Status::OK();
 }
 
 ordinal_t ExtractReader::get_current_ordinal() const {
-    return _root_reader->iterator->get_current_ordinal();
+    return _current_ordinal;
 }
 
 } // namespace segment_v2
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "io/io_common.h"
 #include "olap/field.h"
@@ -271,11 +272,37 @@ private:
     }
 };
 
+// The root column of a variant, read for all the ExtractReaders of its sparse paths in a
+// segment iterator. A batch read by one of them is kept and reused by the others reading the
+// same rows, instead of each one reading and decoding the root column again.
+class VariantRootColumnReader {
+public:
+    explicit VariantRootColumnReader(std::unique_ptr<SubstreamIterator>&& root)
+            : _root(std::move(root)) {}
+
+    Status init(const ColumnIteratorOptions& opts);
+
+    // Read *n rows from ord into *column, *n is set to the rows read.
+    Status next_batch(ordinal_t ord, size_t* n, const vectorized::IColumn** column);
+
+    Status read_by_rowids(const rowid_t* rowids, size_t count, const vectorized::IColumn** column);
+
+private:
+    std::unique_ptr<SubstreamIterator> _root;
+    // the rows held by _root->column
+    bool _has_range = false;
+    ordinal_t _range_ordinal = 0;
+    size_t _range_requested = 0;
+    size_t _range_read = 0;
+    bool _has_rowids = false;
+    std::vector<rowid_t> _rowids;
+};
+
 // Extract from root column of variant, since root column of variant
 // encodes sparse columns that are not materialized
 class ExtractReader : public ColumnIterator {
 public:
-    ExtractReader(const TabletColumn& col, std::unique_ptr<SubstreamIterator>&& root_reader,
+    ExtractReader(const TabletColumn& col, std::shared_ptr<VariantRootColumnReader> root_reader,
                   vectorized::DataTypePtr target_type_hint)
             : _col(col),
               _root_reader(std::move(root_reader)),
@@ -293,12 +320,14 @@ public:
     ordinal_t get_current_ordinal() const override;
 
 private:
-    Status extract_to(vectorized::MutableColumnPtr& dst, size_t nrows);
+    Status extract_to(const vectorized::IColumn& root_column, vectorized::MutableColumnPtr& dst,
+                      size_t nrows);
 
     TabletColumn _col;
     // may shared among different column iterators
-    std::unique_ptr<SubstreamIterator> _root_reader;
+    std::shared_ptr<VariantRootColumnReader> _root_reader;
     vectorized::DataTypePtr _target_type_hint;
+    ordinal_t _current_ordinal = 0;
 };
 
 } // namespace doris::segment_v2
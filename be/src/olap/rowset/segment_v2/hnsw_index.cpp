@@ -0,0 +1,493 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/hnsw_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <queue>
+#include <roaring/roaring.hh>
+
+#include "util/coding.h"
+#include "vec/columns/column_array.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::segment_v2 {
+
+HnswIndex::HnswIndex(uint32_t dim, AnnMetric metric, const Options& options)
+        : _dim(dim),
+          _metric(metric),
+          _m(std::max<uint32_t>(options.m, 2)),
+          _ef_construction(std::max(options.ef_construction, _m)),
+          _level_mult(1 / std::log(double(_m))),
+          _random_state(options.seed) {}
+
+float HnswIndex::_distance(const float* x, const float* y) const {
+    float sum = 0;
+    if (_metric == AnnMetric::L2) {
+        for (uint32_t i = 0; i < _dim; ++i) {
+            float diff = x[i] - y[i];
+            sum += diff * diff;
+        }
+        return sum;
+    }
+    for (uint32_t i = 0; i < _dim; ++i) {
+        sum += x[i] * y[i];
+    }
+    return 1 - sum;
+}
+
+float HnswIndex::_user_distance(float distance) const {
+    return _metric == AnnMetric::L2 ? std::sqrt(distance) : distance;
+}
+
+int HnswIndex::_random_level() {
+    // splitmix64
+    uint64_t z = (_random_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    double u = double((z >> 11) + 1) * (1.0 / double(1ULL << 53));
+    return std::min(int(-std::log(u) * _level_mult), 16);
+}
+
+bool HnswIndex::_normalize(const float* vector, std::vector<float>* normalized) const {
+    normalized->assign(vector, vector + _dim);
+    if (_metric == AnnMetric::L2) {
+        return true;
+    }
+    double squared = 0;
+    for (float x : *normalized) {
+        squared += double(x) * x;
+    }
+    if (squared == 0) {
+        return false;
+    }
+    float scale = float(1 / std::sqrt(squared));
+    for (float& x : *normalized) {
+        x *= scale;
+    }
+    return true;
+}
+
+void HnswIndex::add(rowid_t rowid, const float* vector) {
+    std::vector<float> normalized;
+    if (!_normalize(vector, &normalized)) {
+        return;
+    }
+    auto node = uint32_t(_rowids.size());
+    int level = _random_level();
+    if (!_rowids.empty() && rowid < _rowids.back()) {
+        _rowids_sorted = false;
+    }
+    _rowids.push_back(rowid);
+    _levels.push_back(uint8_t(level));
+    _vectors.insert(_vectors.end(), normalized.begin(), normalized.end());
+    _level0_links.resize(_level0_links.size() + 2 * _m + 1, 0);
+    _upper_links.emplace_back(size_t(level) * (_m + 1), 0);
+    if (_max_level < 0) {
+        _entry_point = node;
+        _max_level = level;
+        return;
+    }
+
+    const float* query = _vector(node);
+    uint32_t entry_point = _search_upper_layers(query, level);
+    for (int l = std::min(level, _max_level); l >= 0; --l) {
+        std::vector<Candidate> candidates =
+                _search_layer(query, entry_point, _ef_construction, l, nullptr);
+        entry_point = candidates.front().second;
+        _select_neighbors(&candidates, _m);
+        for (const auto& [_, neighbor] : candidates) {
+            _link(node, neighbor, l);
+            _link(neighbor, node, l);
+        }
+    }
+    if (level > _max_level) {
+        _max_level = level;
+        _entry_point = node;
+    }
+}
+
+Status HnswIndex::add_array_column(const vectorized::IColumn& column, rowid_t first_rowid) {
+    const vectorized::IColumn* array_column = &column;
+    const vectorized::NullMap* null_map = nullptr;
+    if (const auto* nullable =
+                vectorized::check_and_get_column<vectorized::ColumnNullable>(column)) {
+        null_map = &nullable->get_null_map_data();
+        array_column = &nullable->get_nested_column();
+    }
+    const auto* array = vectorized::check_and_get_column<vectorized::ColumnArray>(*array_column);
+    if (array == nullptr) {
+        return Status::InvalidArgument("HNSW index only supports ARRAY<FLOAT>, but got {}",
+                                       column.get_name());
+    }
+    const vectorized::IColumn* data = &array->get_data();
+    const vectorized::NullMap* element_null_map = nullptr;
+    if (const auto* nullable =
+                vectorized::check_and_get_column<vectorized::ColumnNullable>(*data)) {
+        element_null_map = &nullable->get_null_map_data();
+        data = &nullable->get_nested_column();
+    }
+    const auto* floats = vectorized::check_and_get_column<vectorized::ColumnFloat32>(*data);
+    if (floats == nullptr) {
+        return Status::InvalidArgument("HNSW index only supports ARRAY<FLOAT>, but got {}",
+                                       column.get_name());
+    }
+    for (size_t i = 0; i < array->size(); ++i) {
+        if ((null_map != nullptr && (*null_map)[i]) || array->size_at(i) != _dim) {
+            continue;
+        }
+        size_t offset = array->offset_at(i);
+        if (element_null_map != nullptr &&
+            std::any_of(element_null_map->begin() + offset,
+                        element_null_map->begin() + offset + _dim, [](uint8_t v) { return v; })) {
+            continue;
+        }
+        add(first_rowid + rowid_t(i), &floats->get_data()[offset]);
+    }
+    return Status::OK();
+}
+
+Status HnswIndex::add_index(const HnswIndex& other,
+                            const std::function<bool(rowid_t, rowid_t*)>& rowid_map) {
+    if (other._dim != _dim || other._metric != _metric) {
+        return Status::InternalError("Can't merge the HNSW index of dim {} metric {} to {} {}",
+                                     other._dim, int(other._metric), _dim, int(_metric));
+    }
+    for (uint32_t node = 0; node < other.size(); ++node) {
+        rowid_t rowid = 0;
+        if (rowid_map(other._rowids[node], &rowid)) {
+            add(rowid, other._vector(node));
+        }
+    }
+    return Status::OK();
+}
+
+uint32_t HnswIndex::_search_upper_layers(const float* query, int target_level) const {
+    uint32_t node = _entry_point;
+    float distance = _distance(query, _vector(node));
+    for (int level = _max_level; level > target_level; --level) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            const uint32_t* links = _links(node, level);
+            for (uint32_t i = 1; i <= links[0]; ++i) {
+                float d = _distance(query, _vector(links[i]));
+                if (d < distance) {
+                    distance = d;
+                    node = links[i];
+                    changed = true;
+                }
+            }
+        }
+    }
+    return node;
+}
+
+std::vector<HnswIndex::Candidate> HnswIndex::_search_layer(const float* query,
+                                                           uint32_t entry_point, size_t ef,
+                                                           int level,
+                                                           const roaring::Roaring* filter) const {
+    auto passes = [&](uint32_t node) {
+        return filter == nullptr || filter->contains(_rowids[node]);
+    };
+    std::vector<bool> visited(size(), false);
+    // the candidates to explore, the nearest first
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> candidates;
+    // the nearest nodes found, the farthest first
+    std::priority_queue<Candidate> nearest;
+
+    float distance = _distance(query, _vector(entry_point));
+    visited[entry_point] = true;
+    candidates.emplace(distance, entry_point);
+    if (passes(entry_point)) {
+        nearest.emplace(distance, entry_point);
+    }
+    while (!candidates.empty()) {
+        auto [candidate_distance, node] = candidates.top();
+        if (nearest.size() >= ef && candidate_distance > nearest.top().first) {
+            break;
+        }
+        candidates.pop();
+        const uint32_t* links = _links(node, level);
+        for (uint32_t i = 1; i <= links[0]; ++i) {
+            uint32_t neighbor = links[i];
+            if (visited[neighbor]) {
+                continue;
+            }
+            visited[neighbor] = true;
+            float d = _distance(query, _vector(neighbor));
+            if (nearest.size() < ef || d < nearest.top().first) {
+                candidates.emplace(d, neighbor);
+                if (passes(neighbor)) {
+                    nearest.emplace(d, neighbor);
+                    if (nearest.size() > ef) {
+                        nearest.pop();
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<Candidate> result(nearest.size());
+    for (size_t i = result.size(); i > 0; --i) {
+        result[i - 1] = nearest.top();
+        nearest.pop();
+    }
+    return result;
+}
+
+void HnswIndex::_select_neighbors(std::vector<Candidate>* candidates, uint32_t max_links) const {
+    if (candidates->size() <= max_links) {
+        return;
+    }
+    std::vector<Candidate> selected;
+    selected.reserve(max_links);
+    for (const auto& candidate : *candidates) {
+        if (selected.size() >= max_links) {
+            break;
+        }
+        const float* candidate_vector = _vector(candidate.second);
+        bool keep = std::none_of(selected.begin(), selected.end(), [&](const Candidate& s) {
+            return _distance(candidate_vector, _vector(s.second)) < candidate.first;
+        });
+        if (keep) {
+            selected.push_back(candidate);
+        }
+    }
+    *candidates = std::move(selected);
+}
+
+void HnswIndex::_link(uint32_t node, uint32_t neighbor, int level) {
+    uint32_t* links = _links(node, level);
+    uint32_t max_links = _max_links(level);
+    if (links[0] < max_links) {
+        links[++links[0]] = neighbor;
+        return;
+    }
+    // keep the best of the links and the new one
+    const float* node_vector = _vector(node);
+    std::vector<Candidate> candidates;
+    candidates.reserve(max_links + 1);
+    for (uint32_t i = 1; i <= links[0]; ++i) {
+        candidates.emplace_back(_distance(node_vector, _vector(links[i])), links[i]);
+    }
+    candidates.emplace_back(_distance(node_vector, _vector(neighbor)), neighbor);
+    std::sort(candidates.begin(), candidates.end());
+    _select_neighbors(&candidates, max_links);
+    links[0] = uint32_t(candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        links[i + 1] = candidates[i].second;
+    }
+}
+
+std::vector<HnswIndex::Candidate> HnswIndex::_filtered_candidates(
+        const float* query, const roaring::Roaring& filter) const {
+    std::vector<Candidate> candidates;
+    auto add_node = [&](uint32_t node) {
+        candidates.emplace_back(_distance(query, _vector(node)), node);
+    };
+    if (_rowids_sorted) {
+        for (rowid_t rowid : filter) {
+            auto iter = std::lower_bound(_rowids.begin(), _rowids.end(), rowid);
+            if (iter != _rowids.end() && *iter == rowid) {
+                add_node(uint32_t(iter - _rowids.begin()));
+            }
+        }
+    } else {
+        for (uint32_t node = 0; node < size(); ++node) {
+            if (filter.contains(_rowids[node])) {
+                add_node(node);
+            }
+        }
+    }
+    return candidates;
+}
+
+void HnswIndex::search(const float* query, size_t k, size_t ef, const roaring::Roaring* filter,
+                       std::vector<Neighbor>* result) const {
+    result->clear();
+    std::vector<float> normalized;
+    if (_rowids.empty() || k == 0 || !_normalize(query, &normalized)) {
+        return;
+    }
+    std::vector<Candidate> candidates;
+    if (filter != nullptr && filter->cardinality() <= BRUTE_FORCE_MAX_ROWS) {
+        candidates = _filtered_candidates(normalized.data(), *filter);
+        size_t num = std::min(k, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + num, candidates.end());
+        candidates.resize(num);
+    } else {
+        uint32_t entry_point = _search_upper_layers(normalized.data(), 0);
+        candidates = _search_layer(normalized.data(), entry_point, std::max(ef, k), 0, filter);
+        candidates.resize(std::min(k, candidates.size()));
+    }
+    result->reserve(candidates.size());
+    for (const auto& [distance, node] : candidates) {
+        result->emplace_back(_user_distance(distance), _rowids[node]);
+    }
+}
+
+void HnswIndex::range_search(const float* query, float radius, size_t ef,
+                             const roaring::Roaring* filter, roaring::Roaring* result) const {
+    std::vector<float> normalized;
+    if (_rowids.empty() || !_normalize(query, &normalized)) {
+        return;
+    }
+    float threshold = _metric == AnnMetric::L2 ? radius * radius : radius;
+    if (filter != nullptr && filter->cardinality() <= BRUTE_FORCE_MAX_ROWS) {
+        for (const auto& [distance, node] : _filtered_candidates(normalized.data(), *filter)) {
+            if (distance <= threshold) {
+                result->add(_rowids[node]);
+            }
+        }
+        return;
+    }
+    // Find the nearest nodes, then expand the ones within the radius through their links.
+    uint32_t entry_point = _search_upper_layers(normalized.data(), 0);
+    std::vector<bool> visited(size(), false);
+    std::vector<uint32_t> queue;
+    for (const auto& [distance, node] :
+         _search_layer(normalized.data(), entry_point, std::max<size_t>(ef, 1), 0, nullptr)) {
+        visited[node] = true;
+        if (distance <= threshold) {
+            queue.push_back(node);
+        }
+    }
+    while (!queue.empty()) {
+        uint32_t node = queue.back();
+        queue.pop_back();
+        if (filter == nullptr || filter->contains(_rowids[node])) {
+            result->add(_rowids[node]);
+        }
+        const uint32_t* links = _links(node, 0);
+        for (uint32_t i = 1; i <= links[0]; ++i) {
+            uint32_t neighbor = links[i];
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                if (_distance(normalized.data(), _vector(neighbor)) <= threshold) {
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+    }
+}
+
+void HnswIndex::serialize(faststring* buf) const {
+    put_fixed32_le(buf, MAGIC);
+    put_fixed32_le(buf, _dim);
+    buf->push_back(char(_metric));
+    put_fixed32_le(buf, _m);
+    put_fixed32_le(buf, _ef_construction);
+    put_fixed32_le(buf, uint32_t(size()));
+    put_fixed32_le(buf, uint32_t(_max_level));
+    put_fixed32_le(buf, _entry_point);
+    for (size_t node = 0; node < size(); ++node) {
+        put_fixed32_le(buf, _rowids[node]);
+        buf->push_back(char(_levels[node]));
+    }
+    buf->append(_vectors.data(), _vectors.size() * sizeof(float));
+    buf->append(_level0_links.data(), _level0_links.size() * sizeof(uint32_t));
+    for (const auto& links : _upper_links) {
+        buf->append(links.data(), links.size() * sizeof(uint32_t));
+    }
+}
+
+Status HnswIndex::deserialize(const Slice& data, std::unique_ptr<HnswIndex>* index) {
+    const auto* pos = reinterpret_cast<const uint8_t*>(data.data);
+    const uint8_t* end = pos + data.size;
+    auto corrupted = [](const char* reason) {
+        return Status::Corruption("Corrupted HNSW index: {}", reason);
+    };
+    constexpr size_t HEADER_SIZE = 4 * 7 + 1;
+    if (data.size < HEADER_SIZE || decode_fixed32_le(pos) != MAGIC) {
+        return corrupted("bad header");
+    }
+    uint32_t dim = decode_fixed32_le(pos + 4);
+    uint8_t metric = pos[8];
+    Options options;
+    options.m = decode_fixed32_le(pos + 9);
+    options.ef_construction = decode_fixed32_le(pos + 13);
+    uint32_t num_nodes = decode_fixed32_le(pos + 17);
+    auto max_level = int32_t(decode_fixed32_le(pos + 21));
+    uint32_t entry_point = decode_fixed32_le(pos + 25);
+    pos += HEADER_SIZE;
+    if (dim == 0 || metric > uint8_t(AnnMetric::COSINE) || options.m < 2 ||
+        (num_nodes == 0 ? max_level != -1 : (entry_point >= num_nodes || max_level < 0))) {
+        return corrupted("bad header");
+    }
+
+    auto result = std::make_unique<HnswIndex>(dim, AnnMetric(metric), options);
+    if (uint64_t(end - pos) < uint64_t(num_nodes) * 5) {
+        return corrupted("truncated nodes");
+    }
+    result->_rowids.resize(num_nodes);
+    result->_levels.resize(num_nodes);
+    uint64_t num_upper_links = 0;
+    for (uint32_t node = 0; node < num_nodes; ++node, pos += 5) {
+        result->_rowids[node] = decode_fixed32_le(pos);
+        result->_levels[node] = pos[4];
+        if (pos[4] > max_level) {
+            return corrupted("bad level");
+        }
+        num_upper_links += uint64_t(pos[4]) * (result->_m + 1);
+        if (node > 0 && result->_rowids[node] < result->_rowids[node - 1]) {
+            result->_rowids_sorted = false;
+        }
+    }
+    uint64_t vectors_bytes = uint64_t(num_nodes) * dim * sizeof(float);
+    uint64_t level0_bytes = uint64_t(num_nodes) * (2 * result->_m + 1) * sizeof(uint32_t);
+    if (uint64_t(end - pos) != vectors_bytes + level0_bytes + num_upper_links * sizeof(uint32_t)) {
+        return corrupted("bad size");
+    }
+    result->_vectors.resize(size_t(num_nodes) * dim);
+    memcpy(result->_vectors.data(), pos, vectors_bytes);
+    pos += vectors_bytes;
+    result->_level0_links.resize(size_t(num_nodes) * (2 * result->_m + 1));
+    memcpy(result->_level0_links.data(), pos, level0_bytes);
+    pos += level0_bytes;
+    result->_upper_links.resize(num_nodes);
+    for (uint32_t node = 0; node < num_nodes; ++node) {
+        auto& links = result->_upper_links[node];
+        links.resize(size_t(result->_levels[node]) * (result->_m + 1));
+        memcpy(links.data(), pos, links.size() * sizeof(uint32_t));
+        pos += links.size() * sizeof(uint32_t);
+    }
+    if (num_nodes > 0 && result->_levels[entry_point] != max_level) {
+        return corrupted("bad entry point");
+    }
+    for (uint32_t node = 0; node < num_nodes; ++node) {
+        for (int level = 0; level <= result->_levels[node]; ++level) {
+            const uint32_t* links = result->_links(node, level);
+            if (links[0] > result->_max_links(level) ||
+                std::any_of(links + 1, links + 1 + links[0],
+                            [&](uint32_t neighbor) { return neighbor >= num_nodes; })) {
+                return corrupted("bad links");
+            }
+        }
+    }
+    result->_max_level = max_level;
+    result->_entry_point = entry_point;
+    *index = std::move(result);
+    return Status::OK();
+}
+
+} // namespace doris::segment_v2
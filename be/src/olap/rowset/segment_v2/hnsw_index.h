@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// HNSW (Hierarchical Navigable Small World) index of the vectors of an ARRAY<FLOAT> column.
+//
+// Every indexed row is a node of a graph with several layers, a node is in the layers up to its
+// randomly chosen level, and is linked to its nearest nodes in each of them. A search descends
+// greedily through the upper sparse layers and then explores the candidates of the bottom layer,
+// so the nearest rows are found by visiting a small part of the segment.
+//
+// The distances are the ones of l2_distance and cosine_distance, the vectors are kept in the index
+// to compute them.
+//
+// The serialized index consists of:
+// Header
+//   <magic> [32-bit] <dim> [32-bit] <metric> [8-bit] <m> [32-bit] <ef_construction> [32-bit]
+//   <num_nodes> [32-bit] <max_level> [32-bit] <entry_point> [32-bit]
+// Nodes
+//   <rowid> [32-bit] <level> [8-bit] of every node
+//   <vectors> [float * dim * num_nodes]
+//   <level 0 links> [32-bit * (2 * m + 1) * num_nodes], the count and the linked nodes
+//   <upper level links> [32-bit * (m + 1) * level] of every node with a level above 0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace roaring {
+class Roaring;
+} // namespace roaring
+
+namespace doris {
+namespace vectorized {
+class IColumn;
+} // namespace vectorized
+
+namespace segment_v2 {
+
+enum class AnnMetric : uint8_t { L2 = 0, COSINE = 1 };
+
+class HnswIndex {
+public:
+    struct Options {
+        // the max links of a node in the upper layers, twice of it in the bottom layer
+        uint32_t m = 16;
+        // the candidates explored to find the links of a new node
+        uint32_t ef_construction = 200;
+        uint32_t seed = 0x5eed;
+    };
+
+    // (distance, rowid) of a search result
+    using Neighbor = std::pair<float, rowid_t>;
+
+    HnswIndex(uint32_t dim, AnnMetric metric) : HnswIndex(dim, metric, Options()) {}
+
+    HnswIndex(uint32_t dim, AnnMetric metric, const Options& options);
+
+    // Add the vector of dim floats of a row. A zero vector has no cosine distance, it's not
+    // indexed for COSINE.
+    void add(rowid_t rowid, const float* vector);
+
+    // Add the rows [first_rowid, first_rowid + column.size()) of an ARRAY<FLOAT> column, maybe
+    // nullable. The null rows and the arrays which aren't of dim not null floats are not indexed.
+    Status add_array_column(const vectorized::IColumn& column, rowid_t first_rowid);
+
+    // Add the rows of other, with the rowids mapped by rowid_map, which returns false if the row
+    // is deleted. Used to merge the indexes of the compacted segments without reading the columns.
+    Status add_index(const HnswIndex& other,
+                     const std::function<bool(rowid_t, rowid_t*)>& rowid_map);
+
+    // Set *result to the k nearest rows to query, sorted by the distance. Only the rows in filter
+    // are returned if it's not nullptr. The ef nearest candidates are explored, the larger the
+    // more accurate, it's at least k.
+    void search(const float* query, size_t k, size_t ef, const roaring::Roaring* filter,
+                std::vector<Neighbor>* result) const;
+
+    // Add the rows whose distances to query are at most radius to *result. Only the rows in filter
+    // are returned if it's not nullptr. Like search(), the rows are found approximately.
+    void range_search(const float* query, float radius, size_t ef, const roaring::Roaring* filter,
+                      roaring::Roaring* result) const;
+
+    void serialize(faststring* buf) const;
+
+    static Status deserialize(const Slice& data, std::unique_ptr<HnswIndex>* index);
+
+    size_t size() const { return _rowids.size(); }
+
+    uint32_t dim() const { return _dim; }
+
+    AnnMetric metric() const { return _metric; }
+
+private:
+    static constexpr uint32_t MAGIC = 0x57534E48; // "HNSW"
+    // the filters with rows no more than this are searched by computing all the distances
+    static constexpr uint64_t BRUTE_FORCE_MAX_ROWS = 2048;
+
+    // (distance, node) of a candidate
+    using Candidate = std::pair<float, uint32_t>;
+
+    const float* _vector(uint32_t node) const { return &_vectors[size_t(node) * _dim]; }
+
+    uint32_t* _links(uint32_t node, int level) {
+        return level == 0 ? &_level0_links[size_t(node) * (2 * _m + 1)]
+                          : &_upper_links[node][size_t(level - 1) * (_m + 1)];
+    }
+
+    const uint32_t* _links(uint32_t node, int level) const {
+        return const_cast<HnswIndex*>(this)->_links(node, level);
+    }
+
+    uint32_t _max_links(int level) const { return level == 0 ? 2 * _m : _m; }
+
+    // The distance used to order the nodes, the squared l2 distance or the cosine distance.
+    float _distance(const float* x, const float* y) const;
+
+    // The distance returned to the user.
+    float _user_distance(float distance) const;
+
+    int _random_level();
+
+    // Set *normalized to the vector, normalized for COSINE. Return false if it's a zero vector.
+    bool _normalize(const float* vector, std::vector<float>* normalized) const;
+
+    uint32_t _search_upper_layers(const float* query, int target_level) const;
+
+    // The ef nearest nodes to query in the layer, explored from entry_point. Only the nodes in
+    // filter are returned if it's not nullptr, the others are still explored.
+    std::vector<Candidate> _search_layer(const float* query, uint32_t entry_point, size_t ef,
+                                         int level, const roaring::Roaring* filter) const;
+
+    // Keep no more than max_links of the candidates sorted by the distance, skipping the ones
+    // closer to a kept node than to the new node, so the links reach different directions.
+    void _select_neighbors(std::vector<Candidate>* candidates, uint32_t max_links) const;
+
+    void _link(uint32_t node, uint32_t neighbor, int level);
+
+    // The distances of all the nodes in filter, used when it's selective.
+    std::vector<Candidate> _filtered_candidates(const float* query,
+                                                const roaring::Roaring& filter) const;
+
+    uint32_t _dim;
+    AnnMetric _metric;
+    uint32_t _m;
+    uint32_t _ef_construction;
+    double _level_mult;
+    uint64_t _random_state;
+
+    int _max_level = -1;
+    uint32_t _entry_point = 0;
+    std::vector<rowid_t> _rowids;
+    std::vector<uint8_t> _levels;
+    std::vector<float> _vectors;
+    std::vector<uint32_t> _level0_links;
+    std::vector<std::vector<uint32_t>> _upper_links;
+    // the rows are added in the order of rowids, the node of a rowid is found by binary search
+    bool _rowids_sorted = true;
+};
+
+} // namespace segment_v2
+} // namespace doris
@@ -17,6 +17,11 @@
 
 #include "conjunction_query.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "olap/rowset/segment_v2/inverted_index/util/doc_id_intersection.h"
+
 namespace doris::segment_v2 {
 
 ConjunctionQuery::ConjunctionQuery(const std::shared_ptr<lucene::search::IndexSearcher>& searcher,
@@ -79,36 +84,65 @@ void ConjunctionQuery::search(roaring::Roaring& roaring) {
 }
 
 void ConjunctionQuery::search_by_bitmap(roaring::Roaring& roaring) {
-    // can get a term of all doc_id
-    auto func = [&roaring](const TermIterPtr& term_docs, bool first) {
-        roaring::Roaring result;
-        DocRange doc_range;
-        while (term_docs->read_range(&doc_range)) {
+    // the docs of the rarest term are the candidates, each other term keeps the ones it has
+    // block by block, without building a bitmap of all its docs
+    std::vector<uint32_t> candidates;
+    DocRange doc_range;
+    while (_lead1->read_range(&doc_range)) {
+        if (doc_range.type_ == DocRangeType::kMany) {
+            candidates.insert(candidates.end(), doc_range.doc_many->data(),
+                              doc_range.doc_many->data() + doc_range.doc_many_size_);
+        } else {
+            for (uint32_t doc = doc_range.doc_range.first; doc < doc_range.doc_range.second;
+                 ++doc) {
+                candidates.push_back(doc);
+            }
+        }
+    }
+
+    std::vector<uint32_t> kept;
+    auto filter = [&](const TermIterPtr& term_docs) {
+        kept.clear();
+        auto pos = candidates.begin();
+        while (pos != candidates.end() && term_docs->read_range(&doc_range)) {
             if (doc_range.type_ == DocRangeType::kMany) {
-                result.addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
+                if (doc_range.doc_many_size_ == 0) {
+                    continue;
+                }
+                const uint32_t* docs = doc_range.doc_many->data();
+                auto end = std::upper_bound(pos, candidates.end(),
+                                            docs[doc_range.doc_many_size_ - 1]);
+                size_t size = kept.size();
+                kept.resize(size + (end - pos));
+                size_t n = inverted_index::intersect_doc_ids(&*pos, end - pos, docs,
+                                                             doc_range.doc_many_size_,
+                                                             kept.data() + size);
+                kept.resize(size + n);
+                pos = end;
             } else {
-                result.addRange(doc_range.doc_range.first, doc_range.doc_range.second);
+                auto first = std::lower_bound(pos, candidates.end(), doc_range.doc_range.first);
+                pos = std::lower_bound(first, candidates.end(), doc_range.doc_range.second);
+                kept.insert(kept.end(), first, pos);
             }
         }
-        if (first) {
-            roaring.swap(result);
-        } else {
-            roaring &= result;
-        }
+        candidates.swap(kept);
     };
 
-    // fill the bitmap for the first time
-    func(_lead1, true);
-
     // the second inverted list may be empty
     if (_lead2 != nullptr) {
-        func(_lead2, false);
+        filter(_lead2);
     }
 
     // The inverted index iterators contained in the _others array must not be empty
     for (auto& other : _others) {
-        func(other, false);
+        if (candidates.empty()) {
+            break;
+        }
+        filter(other);
     }
+    roaring::Roaring result;
+    result.addMany(candidates.size(), candidates.data());
+    roaring.swap(result);
 }
 
 void ConjunctionQuery::search_by_skiplist(roaring::Roaring& roaring) {
@@ -0,0 +1,48 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace doris::segment_v2::idx_query_v2 {
+
+// Okapi BM25 with the parameters and the idf of Lucene.
+struct Bm25Similarity {
+    static constexpr float K1 = 1.2F;
+    static constexpr float B = 0.75F;
+
+    // Always positive, even for a term in more than half of the docs.
+    static float idf(int64_t doc_freq, int64_t doc_count) {
+        return static_cast<float>(std::log(1 + (static_cast<double>(doc_count - doc_freq) + 0.5) /
+                                                       (static_cast<double>(doc_freq) + 0.5)));
+    }
+
+    // length_ratio is the length of the doc divided by the average length, 1 when the lengths
+    // are unknown.
+    static float tf_norm(int32_t freq, float length_ratio) {
+        auto tf = static_cast<float>(freq);
+        return tf * (K1 + 1) / (tf + K1 * (1 - B + B * length_ratio));
+    }
+
+    // The bound of tf_norm for any freq and length
+    static constexpr float max_tf_norm() { return K1 + 1; }
+};
+
+} // namespace doris::segment_v2::idx_query_v2
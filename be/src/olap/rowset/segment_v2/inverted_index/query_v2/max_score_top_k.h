@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <type_traits>
+#include <vector>
+
+#include "olap/rowset/segment_v2/inverted_index/query_v2/bm25_similarity.h"
+#include "olap/rowset/segment_v2/inverted_index/util/mock_iterator.h"
+#include "olap/rowset/segment_v2/inverted_index/util/term_iterator.h"
+
+namespace doris::segment_v2::idx_query_v2 {
+
+struct ScoredDoc {
+    int32_t doc = INT_MAX;
+    float score = 0;
+
+    // the better doc first, the smaller doc id wins a tie
+    bool operator<(const ScoredDoc& other) const {
+        return score > other.score || (score == other.score && doc < other.doc);
+    }
+};
+
+// The k docs with the highest BM25 score for a disjunction of terms, with MaxScore dynamic
+// pruning. The terms are ordered by the bound of their score. Once the bounds of the lowest
+// terms sum to no more than the k-th best score, a doc matching only those terms can't make
+// it, so they become non-essential. The candidates are then taken from the essential terms
+// only, and a non-essential term is advanced to a candidate only while the candidate may still
+// beat the k-th score, which skips over the blocks of the frequent terms.
+template <typename T>
+class MaxScoreTopK {
+public:
+    static_assert(std::is_same_v<T, TermIterator> ||
+                          std::is_same_v<T, inverted_index::MockIterator>,
+                  "T must be one of: TermIterator or MockIterator");
+    using IterPtr = std::shared_ptr<T>;
+    // the length of a doc divided by the average length
+    using LengthRatioFunc = std::function<float(int32_t)>;
+
+    MaxScoreTopK(const std::vector<IterPtr>& iters, int64_t doc_count, size_t k,
+                 LengthRatioFunc length_ratio = nullptr)
+            : _k(k), _length_ratio(std::move(length_ratio)) {
+        for (const auto& iter : iters) {
+            float idf = Bm25Similarity::idf(iter->doc_freq(), doc_count);
+            _clauses.push_back({iter.get(), idf, idf * Bm25Similarity::max_tf_norm()});
+        }
+        std::sort(_clauses.begin(), _clauses.end(),
+                  [](const Clause& a, const Clause& b) { return a.max_score < b.max_score; });
+        float sum = 0;
+        for (auto& clause : _clauses) {
+            sum += clause.max_score;
+            clause.bound_sum = sum;
+        }
+    }
+
+    // Sorted by score, the best first.
+    std::vector<ScoredDoc> collect() {
+        std::priority_queue<ScoredDoc> top;
+        if (_k == 0) {
+            return {};
+        }
+        for (auto& clause : _clauses) {
+            clause.iter->advance(0);
+        }
+        size_t first_essential = 0;
+        float threshold = 0;
+        while (first_essential < _clauses.size()) {
+            int32_t doc = INT_MAX;
+            for (size_t i = first_essential; i < _clauses.size(); ++i) {
+                doc = std::min(doc, _clauses[i].iter->doc_id());
+            }
+            if (doc == INT_MAX) {
+                break;
+            }
+
+            float score = 0;
+            for (size_t i = first_essential; i < _clauses.size(); ++i) {
+                if (_clauses[i].iter->doc_id() == doc) {
+                    score += _score(_clauses[i], doc);
+                    _clauses[i].iter->next_doc();
+                }
+            }
+            bool full = top.size() == _k;
+            bool pruned = false;
+            for (size_t i = first_essential; i-- > 0;) {
+                if (full && score + _clauses[i].bound_sum <= threshold) {
+                    pruned = true;
+                    break;
+                }
+                auto* iter = _clauses[i].iter;
+                if (iter->doc_id() < doc) {
+                    iter->advance(doc);
+                }
+                if (iter->doc_id() == doc) {
+                    score += _score(_clauses[i], doc);
+                }
+            }
+            ++_num_scored;
+            if (pruned || (full && score <= threshold)) {
+                continue;
+            }
+
+            top.push({doc, score});
+            if (top.size() > _k) {
+                top.pop();
+            }
+            if (top.size() == _k) {
+                threshold = top.top().score;
+                while (first_essential < _clauses.size() &&
+                       _clauses[first_essential].bound_sum <= threshold) {
+                    ++first_essential;
+                }
+            }
+        }
+
+        std::vector<ScoredDoc> result(top.size());
+        for (size_t i = result.size(); i-- > 0;) {
+            result[i] = top.top();
+            top.pop();
+        }
+        return result;
+    }
+
+    // The candidates taken from the essential terms, for the stats.
+    int64_t num_scored() const { return _num_scored; }
+
+private:
+    struct Clause {
+        T* iter = nullptr;
+        float idf = 0;
+        float max_score = 0;
+        // the sum of max_score of this clause and the ones before
+        float bound_sum = 0;
+    };
+
+    float _score(const Clause& clause, int32_t doc) const {
+        float length_ratio = _length_ratio ? _length_ratio(doc) : 1;
+        return clause.idf * Bm25Similarity::tf_norm(clause.iter->freq(), length_ratio);
+    }
+
+    size_t _k = 0;
+    LengthRatioFunc _length_ratio;
+    std::vector<Clause> _clauses;
+    int64_t _num_scored = 0;
+};
+
+} // namespace doris::segment_v2::idx_query_v2
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace doris::segment_v2::inverted_index {
+
+// Intersections of sorted doc id arrays without duplicates. out needs room for the smaller
+// input and may not overlap the inputs.
+
+// a lists fewer docs than b by far, each of them is searched in b from the last position on
+// with a step doubling each time.
+inline size_t intersect_galloping(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                                  uint32_t* out) {
+    size_t n = 0;
+    size_t pos = 0;
+    for (size_t i = 0; i < na && pos < nb; ++i) {
+        uint32_t doc = a[i];
+        if (b[pos] < doc) {
+            size_t lo = pos;
+            size_t step = 1;
+            while (lo + step < nb && b[lo + step] < doc) {
+                lo += step;
+                step <<= 1;
+            }
+            size_t hi = std::min(lo + step, nb);
+            pos = std::lower_bound(b + lo + 1, b + hi, doc) - b;
+            if (pos == nb) {
+                break;
+            }
+        }
+        if (b[pos] == doc) {
+            out[n++] = doc;
+            ++pos;
+        }
+    }
+    return n;
+}
+
+inline size_t intersect_merge_scalar(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                                     uint32_t* out) {
+    size_t n = 0;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < na && j < nb) {
+        uint32_t x = a[i];
+        uint32_t y = b[j];
+        out[n] = x;
+        n += x == y;
+        i += x <= y;
+        j += y <= x;
+    }
+    return n;
+}
+
+// Compares each block of 8 docs of a with all the 8 docs of the current block of b by rotating
+// it, then moves on with the block which ends first.
+inline size_t intersect_merge(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                              uint32_t* out) {
+#ifdef __AVX2__
+    size_t n = 0;
+    size_t i = 0;
+    size_t j = 0;
+    const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    while (i + 8 <= na && j + 8 <= nb) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+        __m256i eq = _mm256_cmpeq_epi32(va, vb);
+        for (int r = 1; r < 8; ++r) {
+            vb = _mm256_permutevar8x32_epi32(vb, rotate);
+            eq = _mm256_or_si256(eq, _mm256_cmpeq_epi32(va, vb));
+        }
+        auto mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+        while (mask != 0) {
+            out[n++] = a[i + __builtin_ctz(mask)];
+            mask &= mask - 1;
+        }
+        uint32_t a_max = a[i + 7];
+        uint32_t b_max = b[j + 7];
+        i += a_max <= b_max ? 8 : 0;
+        j += b_max <= a_max ? 8 : 0;
+    }
+    return n + intersect_merge_scalar(a + i, na - i, b + j, nb - j, out + n);
+#else
+    return intersect_merge_scalar(a, na, b, nb, out);
+#endif
+}
+
+// Gallops once a list is this many times the size of the other.
+static constexpr size_t GALLOPING_RATIO = 32;
+
+inline size_t intersect_doc_ids(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                                uint32_t* out) {
+    if (na * GALLOPING_RATIO < nb) {
+        return intersect_galloping(a, na, b, nb, out);
+    }
+    if (nb * GALLOPING_RATIO < na) {
+        return intersect_galloping(b, nb, a, na, out);
+    }
+    return intersect_merge(a, na, b, nb, out);
+}
+
+} // namespace doris::segment_v2::inverted_index
@@ -229,7 +229,9 @@ public:
     InvertedIndexQueryCache(size_t capacity, uint32_t num_shards)
             : LRUCachePolicy(CachePolicy::CacheType::INVERTEDINDEX_QUERY_CACHE, capacity,
                              LRUCacheType::SIZE, config::inverted_index_cache_stale_sweep_time_sec,
-                             num_shards) {}
+                             num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true,
+                             DEFAULT_LRU_CACHE_IS_LRU_K,
+                             config::inverted_index_query_cache_enable_tiny_lfu) {}
 
     bool lookup(const CacheKey& key, InvertedIndexQueryCacheHandle* handle);
 
@@ -28,6 +28,7 @@
 #include <CLucene/util/bkd/bkd_docid_iterator.h>
 #include <CLucene/util/stringUtil.h>
 
+#include <algorithm>
 #include <memory>
 #include <ostream>
 #include <roaring/roaring.hh>
@@ -45,6 +46,7 @@
 #include "olap/rowset/segment_v2/inverted_index/analyzer/analyzer.h"
 #include "olap/rowset/segment_v2/inverted_index/query/phrase_query.h"
 #include "olap/rowset/segment_v2/inverted_index/query/query_factory.h"
+#include "olap/rowset/segment_v2/inverted_index/util/term_iterator.h"
 #include "olap/rowset/segment_v2/inverted_index_cache.h"
 #include "olap/rowset/segment_v2/inverted_index_file_reader.h"
 #include "olap/rowset/segment_v2/inverted_index_fs_directory.h"
@@ -383,8 +385,21 @@ Status FullTextIndexReader::query(const io::IOContext* io_ctx, OlapReaderStatist
         auto* searcher_ptr = std::get_if<FulltextIndexSearcherPtr>(&searcher_variant);
         if (searcher_ptr != nullptr) {
             term_match_bitmap = std::make_shared<roaring::Roaring>();
-            RETURN_IF_ERROR(match_index_search(io_ctx, stats, runtime_state, query_type, query_info,
-                                               *searcher_ptr, term_match_bitmap));
+            bool by_term = config::enable_inverted_index_term_cache &&
+                           queryOptions.enable_inverted_index_query_cache &&
+                           (query_type == InvertedIndexQueryType::MATCH_ANY_QUERY ||
+                            query_type == InvertedIndexQueryType::MATCH_ALL_QUERY) &&
+                           query_info.term_infos.size() > 1 &&
+                           std::all_of(query_info.term_infos.begin(), query_info.term_infos.end(),
+                                       [](const TermInfo& info) { return info.is_single_term(); });
+            if (by_term) {
+                RETURN_IF_ERROR(match_by_term_cache(io_ctx, stats, runtime_state, column_name,
+                                                    query_type, query_info, *searcher_ptr,
+                                                    term_match_bitmap));
+            } else {
+                RETURN_IF_ERROR(match_index_search(io_ctx, stats, runtime_state, query_type,
+                                                   query_info, *searcher_ptr, term_match_bitmap));
+            }
             term_match_bitmap->runOptimize();
             cache->insert(cache_key, term_match_bitmap, &cache_handler);
             bit_map = term_match_bitmap;
@@ -396,6 +411,63 @@ Status FullTextIndexReader::query(const io::IOContext* io_ctx, OlapReaderStatist
     }
 }
 
+Status FullTextIndexReader::match_by_term_cache(
+        const io::IOContext* io_ctx, OlapReaderStatistics* stats, RuntimeState* runtime_state,
+        const std::string& column_name, InvertedIndexQueryType query_type,
+        const InvertedIndexQueryInfo& query_info, const FulltextIndexSearcherPtr& index_searcher,
+        const std::shared_ptr<roaring::Roaring>& term_match_bitmap) {
+    auto index_file_key = _inverted_index_file_reader->get_index_file_cache_key(&_index_meta);
+    auto* cache = InvertedIndexQueryCache::instance();
+    bool is_match_all = query_type == InvertedIndexQueryType::MATCH_ALL_QUERY;
+
+    std::vector<std::shared_ptr<roaring::Roaring>> term_bitmaps;
+    std::vector<InvertedIndexQueryCacheHandle> cache_handles;
+    for (const auto& term_info : query_info.term_infos) {
+        // keyed as a MATCH_ANY of the term alone, which shares the entry with such queries
+        InvertedIndexQueryInfo term_query_info;
+        term_query_info.field_name = query_info.field_name;
+        term_query_info.term_infos.push_back(TermInfo {term_info.get_single_term(), 0});
+        InvertedIndexQueryCache::CacheKey cache_key {index_file_key, column_name,
+                                                     InvertedIndexQueryType::MATCH_ANY_QUERY,
+                                                     term_query_info.generate_tokens_key()};
+
+        InvertedIndexQueryCacheHandle cache_handle;
+        std::shared_ptr<roaring::Roaring> term_bitmap;
+        if (!handle_query_cache(runtime_state, cache, cache_key, &cache_handle, stats, term_bitmap)
+                     .ok()) {
+            term_bitmap = std::make_shared<roaring::Roaring>();
+            RETURN_IF_ERROR(match_index_search(io_ctx, stats, runtime_state,
+                                               InvertedIndexQueryType::MATCH_ANY_QUERY,
+                                               term_query_info, index_searcher, term_bitmap));
+            term_bitmap->runOptimize();
+            term_bitmap->shrinkToFit();
+            cache->insert(cache_key, term_bitmap, &cache_handle);
+        }
+        if (is_match_all && term_bitmap->isEmpty()) {
+            return Status::OK();
+        }
+        term_bitmaps.push_back(std::move(term_bitmap));
+        cache_handles.push_back(std::move(cache_handle));
+    }
+
+    if (is_match_all) {
+        // the smallest first, so each intersection is as cheap as it gets
+        std::sort(term_bitmaps.begin(), term_bitmaps.end(),
+                  [](const auto& a, const auto& b) { return a->cardinality() < b->cardinality(); });
+        *term_match_bitmap = *term_bitmaps[0];
+        for (size_t i = 1; i < term_bitmaps.size() && !term_match_bitmap->isEmpty(); ++i) {
+            *term_match_bitmap &= *term_bitmaps[i];
+        }
+    } else {
+        std::vector<const roaring::Roaring*> bitmaps;
+        for (const auto& term_bitmap : term_bitmaps) {
+            bitmaps.push_back(term_bitmap.get());
+        }
+        *term_match_bitmap = roaring::Roaring::fastunion(bitmaps.size(), bitmaps.data());
+    }
+    return Status::OK();
+}
+
 InvertedIndexReaderType FullTextIndexReader::type() {
     return InvertedIndexReaderType::FULLTEXT;
 }
@@ -534,6 +606,78 @@ Status StringTypeInvertedIndexReader::query(const io::IOContext* io_ctx,
     }
 }
 
+Status StringTypeInvertedIndexReader::count_by_terms(
+        const io::IOContext* io_ctx, OlapReaderStatistics* stats, RuntimeState* runtime_state,
+        const std::string& column_name, const roaring::Roaring& filter,
+        std::vector<std::pair<std::string, uint64_t>>* counts) {
+    SCOPED_RAW_TIMER(&stats->inverted_index_query_timer);
+    counts->clear();
+    if (filter.isEmpty()) {
+        return Status::OK();
+    }
+
+    InvertedIndexCacheHandle inverted_index_cache_handle;
+    RETURN_IF_ERROR(
+            handle_searcher_cache(runtime_state, &inverted_index_cache_handle, io_ctx, stats));
+    auto searcher_variant = inverted_index_cache_handle.get_index_searcher();
+    auto* searcher_ptr = std::get_if<FulltextIndexSearcherPtr>(&searcher_variant);
+    if (searcher_ptr == nullptr) {
+        return Status::Error<ErrorCode::INVERTED_INDEX_NOT_SUPPORTED>(
+                "count by terms needs a string index, column name: {}", column_name);
+    }
+
+    SCOPED_RAW_TIMER(&stats->inverted_index_searcher_search_timer);
+    std::wstring column_name_ws = StringUtil::string_to_wstring(column_name);
+    auto* reader = (*searcher_ptr)->getReader();
+    auto* first_term = _CLNEW lucene::index::Term(column_name_ws.c_str(), L"");
+    lucene::index::TermEnum* enumerator = nullptr;
+    lucene::index::Term* term = nullptr;
+    try {
+        enumerator = reader->terms(first_term, io_ctx);
+        // the terms are sorted by field, then text
+        const TCHAR* field = first_term->field();
+        do {
+            term = enumerator->term();
+            if (term == nullptr || term->field() != field) {
+                break;
+            }
+            auto term_docs = TermIterator::create(io_ctx, reader, column_name_ws,
+                                                  std::wstring(term->text(), term->textLength()));
+            roaring::Roaring docs;
+            DocRange doc_range;
+            while (term_docs->read_range(&doc_range)) {
+                if (doc_range.type_ == DocRangeType::kMany) {
+                    docs.addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
+                } else {
+                    docs.addRange(doc_range.doc_range.first, doc_range.doc_range.second);
+                }
+            }
+            uint64_t count = docs.and_cardinality(filter);
+            if (count > 0) {
+                counts->emplace_back(lucene_wcstoutf8string(term->text(), term->textLength()),
+                                     count);
+            }
+            _CLDECDELETE(term);
+        } while (enumerator->next());
+    } catch (const CLuceneError& e) {
+        LOG(ERROR) << "CLuceneError occurred, error msg: " << e.what()
+                   << ", column name: " << column_name;
+        if (enumerator != nullptr) {
+            enumerator->close();
+            _CLDELETE(enumerator);
+        }
+        _CLDECDELETE(term);
+        _CLDECDELETE(first_term);
+        return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
+                "CLuceneError occurred, error msg: {}, column name: {}", e.what(), column_name);
+    }
+    enumerator->close();
+    _CLDELETE(enumerator);
+    _CLDECDELETE(term);
+    _CLDECDELETE(first_term);
+    return Status::OK();
+}
+
 InvertedIndexReaderType StringTypeInvertedIndexReader::type() {
     return InvertedIndexReaderType::STRING_TYPE;
 }
@@ -263,6 +263,16 @@ public:
     }
 
     InvertedIndexReaderType type() override;
+
+private:
+    // Combine the bitmaps of each term of a MATCH_ANY or MATCH_ALL, taken from the query cache
+    // or searched and cached one by one.
+    Status match_by_term_cache(const io::IOContext* io_ctx, OlapReaderStatistics* stats,
+                               RuntimeState* runtime_state, const std::string& column_name,
+                               InvertedIndexQueryType query_type,
+                               const InvertedIndexQueryInfo& query_info,
+                               const FulltextIndexSearcherPtr& index_searcher,
+                               const std::shared_ptr<roaring::Roaring>& term_match_bitmap);
 };
 
 class StringTypeInvertedIndexReader : public InvertedIndexReader {
@@ -289,6 +299,13 @@ public:
         return Status::Error<ErrorCode::NOT_IMPLEMENTED_ERROR>(
                 "StringTypeInvertedIndexReader not support try_query");
     }
+    // Count the docs of filter holding each term of the column, terms without any are left
+    // out. This answers a count grouped by the column from the index, without the data pages.
+    // filter must already exclude the deleted rows.
+    Status count_by_terms(const io::IOContext* io_ctx, OlapReaderStatistics* stats,
+                          RuntimeState* runtime_state, const std::string& column_name,
+                          const roaring::Roaring& filter,
+                          std::vector<std::pair<std::string, uint64_t>>* counts);
     InvertedIndexReaderType type() override;
 };
 
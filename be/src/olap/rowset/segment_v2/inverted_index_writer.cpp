@@ -292,6 +292,7 @@ public:
             _index_writer->addDocument(_doc.get());
             DBUG_EXECUTE_IF("InvertedIndexColumnWriterImpl::add_document_throw_error",
                             { _CLTHROWA(CL_ERR_IO, "debug point: add_document io error"); })
+            flush_ram_buffer_if_needed();
         } catch (const CLuceneError& e) {
             close_on_error();
             return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
@@ -644,10 +645,24 @@ public:
     }
 
     int64_t size() const override {
-        //TODO: get memory size of inverted index
+        if constexpr (field_is_slice_type(field_type)) {
+            // the postings buffered in memory, the flushed runs are in the index directory
+            return _index_writer != nullptr ? _index_writer->ramSizeInBytes() : 0;
+        }
+        //TODO: get memory size of bkd index
         return 0;
     }
 
+    // Write the buffered postings as a run of the index once they take more memory than
+    // inverted_index_writer_flush_threshold_bytes, the runs are merged in finish().
+    void flush_ram_buffer_if_needed() {
+        int64_t threshold = config::inverted_index_writer_flush_threshold_bytes;
+        if (threshold > 0 && _index_writer->ramSizeInBytes() > threshold) {
+            _index_writer->flush();
+            _has_flushed_runs = true;
+        }
+    }
+
     void write_null_bitmap(lucene::store::IndexOutput* null_bitmap_out) {
         // write null_bitmap file
         _null_bitmap.runOptimize();
@@ -696,6 +711,9 @@ public:
                         _CLTHROWA(CL_ERR_IO, "Create output error with nullptr");
                     }
                 } else if constexpr (field_is_slice_type(field_type)) {
+                    if (_has_flushed_runs) {
+                        _index_writer->optimize();
+                    }
                     null_bitmap_out = std::unique_ptr<
                             lucene::store::IndexOutput>(_dir->createOutput(
                             InvertedIndexDescriptor::get_temporary_null_bitmap_file_name()));
@@ -749,6 +767,7 @@ private:
     // _dir must destruct after _index_writer, so _dir must be defined before _index_writer.
     std::shared_ptr<DorisFSDirectory> _dir = nullptr;
     std::unique_ptr<lucene::index::IndexWriter> _index_writer = nullptr;
+    bool _has_flushed_runs = false;
     std::shared_ptr<lucene::analysis::Analyzer> _analyzer = nullptr;
     std::unique_ptr<lucene::util::Reader> _char_string_reader = nullptr;
     std::shared_ptr<lucene::util::bkd::bkd_writer> _bkd_writer = nullptr;
@@ -139,6 +139,7 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         opts.stats->cached_pages_num++;
         // parse body and footer
         Slice page_slice = handle->data();
+        opts.stats->cached_pages_bytes += page_slice.size;
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
         std::string footer_buf(page_slice.data + page_slice.size - 4 - footer_size, footer_size);
         if (!footer->ParseFromString(footer_buf)) {
@@ -156,29 +157,45 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                                   opts.file_reader->path().native());
     }
 
-    // hold compressed page at first, reset to decompressed page later
-    std::unique_ptr<DataPage> page =
-            std::make_unique<DataPage>(page_size, opts.use_page_cache, opts.type);
-    Slice page_slice(page->data(), page_size);
-    {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
-        size_t bytes_read = 0;
-        RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice, &bytes_read,
-                                                  &opts.io_ctx));
-        DCHECK_EQ(bytes_read, page_size);
-        opts.stats->compressed_bytes_read += page_size;
-    }
+    // compressed data pages are kept in the compressed tier and decompressed on every hit, only
+    // the pages hit often enough are promoted to the decompressed tier
+    bool use_compressed_cache = opts.use_page_cache && cache && opts.type == DATA_PAGE &&
+                                cache->has_compressed_page_cache();
+    PageCacheHandle compressed_handle;
+    int32_t compressed_hits = 0;
+    std::unique_ptr<DataPage> page;
+    Slice page_slice;
+    if (use_compressed_cache &&
+        cache->lookup_compressed(cache_key, &compressed_handle, &compressed_hits)) {
+        // the checksum was verified before the page was cached
+        page_slice = compressed_handle.data();
+        opts.stats->compressed_cached_pages_num++;
+        opts.stats->cached_pages_bytes += page_slice.size;
+    } else {
+        // hold compressed page at first, reset to decompressed page later
+        page = std::make_unique<DataPage>(page_size, opts.use_page_cache, opts.type);
+        page_slice = Slice(page->data(), page_size);
+        {
+            SCOPED_RAW_TIMER(&opts.stats->io_ns);
+            size_t bytes_read = 0;
+            RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice,
+                                                      &bytes_read, &opts.io_ctx));
+            DCHECK_EQ(bytes_read, page_size);
+            opts.stats->compressed_bytes_read += page_size;
+        }
 
-    if (opts.verify_checksum) {
-        uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
-        uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
-        InjectionContext ctx = {&actual, const_cast<PageReadOptions*>(&opts)};
-        (void)ctx;
-        TEST_INJECTION_POINT_CALLBACK("PageIO::read_and_decompress_page:crc_failure_inj", &ctx);
-        if (expect != actual) {
-            return Status::Corruption(
-                    "Bad page: checksum mismatch (actual={} vs expect={}), file={}", actual, expect,
-                    opts.file_reader->path().native());
+        if (opts.verify_checksum) {
+            uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
+            uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
+            InjectionContext ctx = {&actual, const_cast<PageReadOptions*>(&opts)};
+            (void)ctx;
+            TEST_INJECTION_POINT_CALLBACK("PageIO::read_and_decompress_page:crc_failure_inj",
+                                          &ctx);
+            if (expect != actual) {
+                return Status::Corruption(
+                        "Bad page: checksum mismatch (actual={} vs expect={}), file={}", actual,
+                        expect, opts.file_reader->path().native());
+            }
         }
     }
 
@@ -191,6 +208,7 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                                   opts.file_reader->path().native());
     }
 
+    bool use_page_cache = opts.use_page_cache && cache;
     uint32_t body_size = page_slice.size - 4 - footer_size;
     if (body_size != footer->uncompressed_size()) { // need decompress body
         if (opts.codec == nullptr) {
@@ -198,9 +216,20 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                     "Bad page: page is compressed but codec is NO_COMPRESSION, file={}",
                     opts.file_reader->path().native());
         }
+        if (use_compressed_cache) {
+            if (page != nullptr) {
+                auto compressed_page = std::make_unique<CompressedDataPage>(
+                        page_size, cache->compressed_mem_tracker());
+                memcpy(compressed_page->data(), page->data(), page_size);
+                cache->insert_compressed(cache_key, compressed_page.get(), &compressed_handle,
+                                         opts.kept_in_memory);
+                compressed_page.release();
+            }
+            use_page_cache = compressed_hits >= config::compressed_data_page_cache_promote_hits;
+        }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
         std::unique_ptr<DataPage> decompressed_page = std::make_unique<DataPage>(
-                footer->uncompressed_size() + footer_size + 4, opts.use_page_cache, opts.type);
+                footer->uncompressed_size() + footer_size + 4, use_page_cache, opts.type);
 
         // decompress page body
         Slice compressed_body(page_slice.data, body_size);
@@ -219,6 +248,9 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         page = std::move(decompressed_page);
         page_slice = Slice(page->data(), footer->uncompressed_size() + footer_size + 4);
         opts.stats->uncompressed_bytes_read += page_slice.size;
+    } else if (page == nullptr) {
+        return Status::Corruption("Bad page: uncompressed page in compressed page cache, file={}",
+                                  opts.file_reader->path().native());
     } else {
         opts.stats->uncompressed_bytes_read += body_size;
     }
@@ -228,13 +260,13 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         if (pre_decoder) {
             RETURN_IF_ERROR(pre_decoder->decode(
                     &page, &page_slice, footer->data_page_footer().nullmap_size() + footer_size + 4,
-                    opts.use_page_cache, opts.type));
+                    use_page_cache, opts.type));
         }
     }
 
     *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
     page->reset_size(page_slice.size);
-    if (opts.use_page_cache && cache) {
+    if (use_page_cache) {
         // insert this page into cache and return the cache handle
         cache->insert(cache_key, page.get(), &cache_handle, opts.type, opts.kept_in_memory);
         *handle = PageHandle(std::move(cache_handle));
@@ -234,15 +234,13 @@ public:
         }
 
         size_t to_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
-        size_t remaining = to_fetch;
-        bool result = false;
-        CppType value;
-        while (remaining > 0) {
-            result = _rle_decoder.Get(&value);
-            DCHECK(result);
-            dst->insert_data((char*)(&value), SIZE_OF_TYPE);
-            remaining--;
-        }
+        // decode run by run into the buffer, a repeated run is a single fill, then append the
+        // values to dst at once instead of inserting them one by one
+        _buffer.resize(to_fetch);
+        size_t read_count =
+                _rle_decoder.get_values(reinterpret_cast<CppType*>(_buffer.data()), to_fetch);
+        DCHECK_EQ(read_count, to_fetch);
+        dst->insert_many_fix_len_data((const char*)_buffer.data(), to_fetch);
 
         _cur_index += to_fetch;
         *n = to_fetch;
@@ -260,23 +258,25 @@ public:
         auto total = *n;
         bool result = false;
         size_t read_count = 0;
-        CppType value;
+        _buffer.resize(total);
+        auto* values = reinterpret_cast<CppType*>(_buffer.data());
         for (size_t i = 0; i < total; ++i) {
             ordinal_t ord = rowids[i] - page_first_ordinal;
             if (UNLIKELY(ord >= _num_elements)) {
-                *n = read_count;
-                return Status::OK();
+                break;
             }
 
             _rle_decoder.Skip(ord - _cur_index);
             _cur_index = ord;
 
-            result = _rle_decoder.Get(&value);
+            result = _rle_decoder.Get(values + read_count);
             _cur_index++;
             DCHECK(result);
-            dst->insert_data((char*)(&value), SIZE_OF_TYPE);
             read_count++;
         }
+        if (read_count > 0) {
+            dst->insert_many_fix_len_data((const char*)_buffer.data(), read_count);
+        }
         *n = read_count;
         return Status::OK();
     }
@@ -296,6 +296,7 @@ private:
     size_t _cur_index;
     int _bit_width;
     RleDecoder<CppType> _rle_decoder;
+    std::vector<std::conditional_t<std::is_same_v<CppType, bool>, uint8_t, CppType>> _buffer;
 };
 
 } // namespace segment_v2
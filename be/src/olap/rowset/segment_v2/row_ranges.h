@@ -19,6 +19,7 @@
 
 #include <roaring/roaring.hh>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/substitute.h"
@@ -96,13 +97,22 @@ private:
     int64_t _to;
 };
 
+// RowRanges keeps disjunct ascending ranges. When unions and intersections make them
+// fragmented, they are kept in a roaring bitmap instead, whose containers are intersected and
+// unioned with SIMD instructions, and the ranges are only built when they are asked for.
 class RowRanges {
 public:
+    // Unions and intersections of more ranges than it switch to the bitmap.
+    static constexpr size_t BITMAP_THRESHOLD = 256;
+
     RowRanges() : _count(0) {}
 
     void clear() {
         _ranges.clear();
         _count = 0;
+        _use_bitmap = false;
+        _bitmap = roaring::Roaring();
+        _ranges_built = true;
     }
 
     // Creates a new RowRanges object with the single range [0, row_count).
@@ -120,6 +130,13 @@ public:
         return ranges;
     }
 
+    // Creates a new RowRanges object with the rows in the bitmap.
+    static RowRanges create_from_roaring(roaring::Roaring bitmap) {
+        RowRanges ranges;
+        ranges._set_bitmap(std::move(bitmap));
+        return ranges;
+    }
+
     // Calculates the union of the two specified RowRanges object. The union of two range is calculated if there are
     // elements between them. Otherwise, the two disjunct ranges are stored separately.
     // For example:
@@ -128,6 +145,13 @@ public:
     // while
     // [113, 230) ∪ [231, 340) = [113, 230), [231, 340)
     static void ranges_union(const RowRanges& left, const RowRanges& right, RowRanges* result) {
+        if (_prefer_bitmap(left, right)) {
+            _bitmap_operation(left, right, result,
+                              [](roaring::Roaring& lhs, const roaring::Roaring& rhs) {
+                                  lhs |= rhs;
+                              });
+            return;
+        }
         RowRanges tmp_range;
         auto it1 = left._ranges.begin();
         auto it2 = right._ranges.begin();
@@ -162,6 +186,13 @@ public:
     // The result RowRanges object will contain all the row indexes there were contained in both of the specified objects
     static void ranges_intersection(const RowRanges& left, const RowRanges& right,
                                     RowRanges* result) {
+        if (_prefer_bitmap(left, right)) {
+            _bitmap_operation(left, right, result,
+                              [](roaring::Roaring& lhs, const roaring::Roaring& rhs) {
+                                  lhs &= rhs;
+                              });
+            return;
+        }
         RowRanges tmp_range;
         int right_index = 0;
         for (auto it1 = left._ranges.begin(); it1 != left._ranges.end(); ++it1) {
@@ -184,6 +215,9 @@ public:
     }
 
     static roaring::Roaring ranges_to_roaring(const RowRanges& ranges) {
+        if (ranges._use_bitmap) {
+            return ranges._bitmap;
+        }
         roaring::Roaring result;
         for (auto it = ranges._ranges.begin(); it != ranges._ranges.end(); ++it) {
             result.addRange(it->from(), it->to());
@@ -196,14 +230,15 @@ public:
     bool is_empty() { return _count == 0; }
 
     bool contain(rowid_t from, rowid_t to) {
+        _build_ranges();
         // binary search
         RowRange tmp_range = RowRange(from, to);
         int32_t start = 0;
-        int32_t end = _ranges.size();
+        int32_t end = static_cast<int32_t>(_ranges.size()) - 1;
         while (start <= end) {
             int32_t mid = (start + end) / 2;
             if (_ranges[mid].is_before(tmp_range)) {
-                start = mid;
+                start = mid + 1;
             } else if (_ranges[mid].is_after(tmp_range)) {
                 end = mid - 1;
             } else {
@@ -215,23 +250,42 @@ public:
 
     int64_t from() {
         DCHECK(!is_empty());
+        if (_use_bitmap) {
+            return _bitmap.minimum();
+        }
         return _ranges[0].from();
     }
 
     int64_t to() {
         DCHECK(!is_empty());
+        if (_use_bitmap) {
+            return static_cast<int64_t>(_bitmap.maximum()) + 1;
+        }
         return _ranges[_ranges.size() - 1].to();
     }
 
-    size_t range_size() { return _ranges.size(); }
+    size_t range_size() {
+        _build_ranges();
+        return _ranges.size();
+    }
 
-    int64_t get_range_from(size_t range_index) { return _ranges[range_index].from(); }
+    int64_t get_range_from(size_t range_index) {
+        _build_ranges();
+        return _ranges[range_index].from();
+    }
 
-    int64_t get_range_to(size_t range_index) { return _ranges[range_index].to(); }
+    int64_t get_range_to(size_t range_index) {
+        _build_ranges();
+        return _ranges[range_index].to();
+    }
 
-    size_t get_range_count(size_t range_index) { return _ranges[range_index].count(); }
+    size_t get_range_count(size_t range_index) {
+        _build_ranges();
+        return _ranges[range_index].count();
+    }
 
     std::string to_string() {
+        _build_ranges();
         std::string result;
         for (auto range : _ranges) {
             result += range.to_string() + " ";
@@ -246,6 +300,12 @@ public:
         if (range.count() == 0) {
             return;
         }
+        if (_use_bitmap) {
+            _bitmap.addRange(range.from(), range.to());
+            _count = _bitmap.cardinality();
+            _ranges_built = false;
+            return;
+        }
         RowRange range_to_add = range;
         for (int i = _ranges.size() - 1; i >= 0; --i) {
             const RowRange last = _ranges[i];
@@ -264,9 +324,76 @@ public:
         _count += range_to_add.count();
     }
 
+    bool is_bitmap() const { return _use_bitmap; }
+
 private:
+    static bool _prefer_bitmap(const RowRanges& left, const RowRanges& right) {
+        return left._use_bitmap || right._use_bitmap ||
+               left._ranges.size() + right._ranges.size() > BITMAP_THRESHOLD;
+    }
+
+    // result may be left or right, the operation is done in place then.
+    template <typename Operation>
+    static void _bitmap_operation(const RowRanges& left, const RowRanges& right,
+                                  RowRanges* result, Operation operation) {
+        auto apply = [&](roaring::Roaring& bitmap, const RowRanges& other) {
+            if (other._use_bitmap) {
+                operation(bitmap, other._bitmap);
+            } else {
+                operation(bitmap, ranges_to_roaring(other));
+            }
+        };
+        if (result == &left && left._use_bitmap) {
+            apply(result->_bitmap, right);
+        } else if (result == &right && right._use_bitmap) {
+            apply(result->_bitmap, left);
+        } else {
+            roaring::Roaring bitmap = ranges_to_roaring(left);
+            apply(bitmap, right);
+            result->_bitmap = std::move(bitmap);
+        }
+        result->_use_bitmap = true;
+        result->_count = result->_bitmap.cardinality();
+        result->_ranges.clear();
+        result->_ranges_built = false;
+    }
+
+    void _set_bitmap(roaring::Roaring bitmap) {
+        _bitmap = std::move(bitmap);
+        _count = _bitmap.cardinality();
+        _use_bitmap = true;
+        _ranges.clear();
+        _ranges_built = false;
+    }
+
+    void _build_ranges() {
+        if (_ranges_built) {
+            return;
+        }
+        _ranges.clear();
+        int64_t from = -1;
+        int64_t to = -1;
+        for (uint32_t row : _bitmap) {
+            if (row != to) {
+                if (from >= 0) {
+                    _ranges.emplace_back(from, to);
+                }
+                from = row;
+            }
+            to = static_cast<int64_t>(row) + 1;
+        }
+        if (from >= 0) {
+            _ranges.emplace_back(from, to);
+        }
+        _ranges_built = true;
+    }
+
     std::vector<RowRange> _ranges;
     size_t _count;
+    // _bitmap holds the rows instead of _ranges, which are built from it when they are used
+    bool _use_bitmap = false;
+    roaring::Roaring _bitmap;
+    bool _ranges_built = true;
 };
 
 } // namespace segment_v2
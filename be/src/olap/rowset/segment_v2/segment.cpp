@@ -21,8 +21,11 @@
 #include <gen_cpp/olap_file.pb.h>
 #include <gen_cpp/segment_v2.pb.h>
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <utility>
 
 #include "cloud/config.h"
@@ -197,7 +200,7 @@ Status Segment::_open(OlapReaderStatistics* stats) {
     }
 
     _meta_mem_usage += sizeof(*this);
-    _meta_mem_usage += _tablet_schema->num_columns() * config::estimated_mem_per_column_reader;
+    // the column readers are counted when they are created
 
     // 1024 comes from SegmentWriterOptions
     _meta_mem_usage += (_num_rows + 1023) / 1024 * (36 + 4);
@@ -235,15 +238,16 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         }
         const TabletColumn& col = read_options.tablet_schema->column(column_id);
         ColumnReader* reader = nullptr;
+        std::shared_ptr<ColumnReader> column_reader;
         if (col.is_extracted_column()) {
             auto relative_path = col.path_info_ptr()->copy_pop_front();
             int32_t unique_id = col.unique_id() > 0 ? col.unique_id() : col.parent_unique_id();
             const auto* node = _sub_column_tree[unique_id].find_exact(relative_path);
             reader = node != nullptr ? node->data.reader.get() : nullptr;
         } else {
-            reader = _column_readers.contains(col.unique_id())
-                             ? _column_readers[col.unique_id()].get()
-                             : nullptr;
+            RETURN_IF_ERROR(
+                    _get_column_reader(col.unique_id(), &column_reader, read_options.stats));
+            reader = column_reader.get();
         }
         if (!reader || !reader->has_zone_map()) {
             continue;
@@ -271,10 +275,12 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             AndBlockColumnPredicate and_predicate;
             and_predicate.add_column_predicate(
                     SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-            if (_column_readers.contains(uid) &&
+            std::shared_ptr<ColumnReader> reader;
+            RETURN_IF_ERROR(_get_column_reader(uid, &reader, read_options.stats));
+            if (reader != nullptr &&
                 can_apply_predicate_safely(runtime_predicate->column_id(), runtime_predicate.get(),
                                            *schema, read_options.io_ctx.reader_type) &&
-                !_column_readers.at(uid)->match_condition(&and_predicate)) {
+                !reader->match_condition(&and_predicate)) {
                 // any condition not satisfied, return.
                 *iter = std::make_unique<EmptySegmentIterator>(*schema);
                 read_options.stats->filtered_segment_number++;
@@ -301,10 +307,20 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         !read_options.column_predicates.empty()) {
         auto pruned_predicates = read_options.column_predicates;
         auto pruned = false;
-        for (auto& it : _column_readers) {
-            const auto uid = it.first;
-            const auto column_id = read_options.tablet_schema->field_index(uid);
-            if (it.second->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
+        // only the columns with predicates, their readers are created if they are not yet
+        std::set<ColumnId> predicate_column_ids;
+        for (const auto* pred : read_options.column_predicates) {
+            predicate_column_ids.insert(pred->column_id());
+        }
+        for (ColumnId column_id : predicate_column_ids) {
+            const auto& col = read_options.tablet_schema->column(column_id);
+            if (col.is_extracted_column()) {
+                continue;
+            }
+            std::shared_ptr<ColumnReader> reader;
+            RETURN_IF_ERROR(_get_column_reader(col.unique_id(), &reader, read_options.stats));
+            if (reader != nullptr &&
+                reader->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
                 pruned = true;
             }
         }
@@ -631,22 +647,14 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
             column_id_to_footer_ordinal.emplace(column_pb.unique_id(), ordinal);
         }
     }
-    // init by unique_id
+    // init by unique_id, the readers are created by _get_column_reader() on the first use
     for (uint32_t ordinal = 0; ordinal < _tablet_schema->num_columns(); ++ordinal) {
         const auto& column = _tablet_schema->column(ordinal);
         auto iter = column_id_to_footer_ordinal.find(column.unique_id());
         if (iter == column_id_to_footer_ordinal.end()) {
             continue;
         }
-
-        ColumnReaderOptions opts {
-                .kept_in_memory = _tablet_schema->is_in_memory(),
-                .be_exec_version = _be_exec_version,
-        };
-        std::unique_ptr<ColumnReader> reader;
-        RETURN_IF_ERROR(ColumnReader::create(opts, footer.columns(iter->second), footer.num_rows(),
-                                             _file_reader, &reader));
-        _column_readers.emplace(column.unique_id(), std::move(reader));
+        _column_uid_to_footer_ordinal.emplace(column.unique_id(), iter->second);
     }
 
     // init by column path
@@ -730,16 +738,28 @@ Status Segment::new_default_iterator(const TabletColumn& tablet_column,
 Status Segment::_new_iterator_with_variant_root(const TabletColumn& tablet_column,
                                                 std::unique_ptr<ColumnIterator>* iter,
                                                 const SubcolumnColumnReaders::Node* root,
-                                                vectorized::DataTypePtr target_type_hint) {
-    ColumnIterator* it;
-    RETURN_IF_ERROR(root->data.reader->new_iterator(&it, &tablet_column));
-    auto* stream_iter = new ExtractReader(
-            tablet_column,
-            std::make_unique<SubstreamIterator>(root->data.file_column_type->create_column(),
-                                                std::unique_ptr<ColumnIterator>(it),
-                                                root->data.file_column_type),
-            target_type_hint);
-    iter->reset(stream_iter);
+                                                vectorized::DataTypePtr target_type_hint,
+                                                const StorageReadOptions* opt) {
+    int32_t unique_id = tablet_column.unique_id() > 0 ? tablet_column.unique_id()
+                                                      : tablet_column.parent_unique_id();
+    std::shared_ptr<VariantRootColumnReader> root_reader;
+    if (opt != nullptr && opt->variant_root_readers != nullptr) {
+        auto it = opt->variant_root_readers->find(unique_id);
+        if (it != opt->variant_root_readers->end()) {
+            root_reader = it->second;
+        }
+    }
+    if (root_reader == nullptr) {
+        ColumnIterator* it;
+        RETURN_IF_ERROR(root->data.reader->new_iterator(&it, &tablet_column));
+        root_reader = std::make_shared<VariantRootColumnReader>(std::make_unique<SubstreamIterator>(
+                root->data.file_column_type->create_column(), std::unique_ptr<ColumnIterator>(it),
+                root->data.file_column_type));
+        if (opt != nullptr && opt->variant_root_readers != nullptr) {
+            opt->variant_root_readers->emplace(unique_id, root_reader);
+        }
+    }
+    iter->reset(new ExtractReader(tablet_column, std::move(root_reader), target_type_hint));
     return Status::OK();
 }
 
@@ -818,7 +838,7 @@ Status Segment::new_column_iterator_with_path(const TabletColumn& tablet_column,
             // sparse_columns have this path, read from root
             if (sparse_node != nullptr && sparse_node->is_leaf_node()) {
                 RETURN_IF_ERROR(_new_iterator_with_variant_root(
-                        tablet_column, iter, root, sparse_node->data.file_column_type));
+                        tablet_column, iter, root, sparse_node->data.file_column_type, opt));
             } else {
                 if (tablet_column.is_nested_subcolumn()) {
                     // using the sibling of the nested column to fill the target nested column
@@ -858,8 +878,8 @@ Status Segment::new_column_iterator_with_path(const TabletColumn& tablet_column,
         // No such node, read from either sparse column or default column
         if (sparse_node != nullptr) {
             // sparse columns have this path, read from root
-            RETURN_IF_ERROR(_new_iterator_with_variant_root(tablet_column, iter, root,
-                                                            sparse_node->data.file_column_type));
+            RETURN_IF_ERROR(_new_iterator_with_variant_root(
+                    tablet_column, iter, root, sparse_node->data.file_column_type, opt));
         } else {
             // No such variant column in this segment, get a default one
             RETURN_IF_ERROR(new_default_iterator(tablet_column, iter));
@@ -888,24 +908,25 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
     if (tablet_column.has_path_info() || tablet_column.is_variant_type()) {
         return new_column_iterator_with_path(tablet_column, iter, opt);
     }
+    std::shared_ptr<ColumnReader> reader;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column.unique_id(), &reader, opt->stats));
     // init default iterator
-    if (!_column_readers.contains(tablet_column.unique_id())) {
+    if (reader == nullptr) {
         RETURN_IF_ERROR(new_default_iterator(tablet_column, iter));
         return Status::OK();
     }
     // init iterator by unique id
     ColumnIterator* it;
-    RETURN_IF_ERROR(
-            _column_readers.at(tablet_column.unique_id())->new_iterator(&it, &tablet_column));
+    RETURN_IF_ERROR(reader->new_iterator(&it, &tablet_column));
     iter->reset(it);
+    (*iter)->hold_column_reader(reader);
 
     if (config::enable_column_type_check && !tablet_column.is_agg_state_type() &&
-        tablet_column.type() != _column_readers.at(tablet_column.unique_id())->get_meta_type()) {
+        tablet_column.type() != reader->get_meta_type()) {
         LOG(WARNING) << "different type between schema and column reader,"
                      << " column schema name: " << tablet_column.name()
                      << " column schema type: " << int(tablet_column.type())
-                     << " column reader meta type: "
-                     << int(_column_readers.at(tablet_column.unique_id())->get_meta_type());
+                     << " column reader meta type: " << int(reader->get_meta_type());
         return Status::InternalError("different type between schema and column reader");
     }
     return Status::OK();
@@ -914,38 +935,116 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
 Status Segment::new_column_iterator(int32_t unique_id, const StorageReadOptions* opt,
                                     std::unique_ptr<ColumnIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once(opt->stats));
+    std::shared_ptr<ColumnReader> reader;
+    RETURN_IF_ERROR(_get_column_reader(unique_id, &reader, opt->stats));
+    if (reader == nullptr) {
+        return Status::InternalError("column {} is not found in segment {}", unique_id, id());
+    }
     ColumnIterator* it;
     TabletColumn tablet_column = _tablet_schema->column_by_uid(unique_id);
-    RETURN_IF_ERROR(_column_readers.at(unique_id)->new_iterator(&it, &tablet_column));
+    RETURN_IF_ERROR(reader->new_iterator(&it, &tablet_column));
     iter->reset(it);
+    (*iter)->hold_column_reader(reader);
     return Status::OK();
 }
 
-ColumnReader* Segment::_get_column_reader(const TabletColumn& col) {
+Status Segment::_get_column_reader(int32_t unique_id, std::shared_ptr<ColumnReader>* reader,
+                                   OlapReaderStatistics* stats) {
+    *reader = nullptr;
+    auto ordinal = _column_uid_to_footer_ordinal.find(unique_id);
+    if (ordinal == _column_uid_to_footer_ordinal.end()) {
+        return Status::OK();
+    }
+    {
+        std::lock_guard<std::mutex> lock(_column_readers_lock);
+        auto iter = _column_readers.find(unique_id);
+        if (iter != _column_readers.end()) {
+            _column_reader_lru.splice(_column_reader_lru.begin(), _column_reader_lru,
+                                      iter->second.lru_pos);
+            *reader = iter->second.reader;
+            return Status::OK();
+        }
+    }
+
+    // the footer may be read again if it has been evicted from the page cache
+    std::shared_ptr<SegmentFooterPB> footer_pb_shared;
+    RETURN_IF_ERROR(_get_segment_footer(footer_pb_shared, stats));
+    ColumnReaderOptions opts {
+            .kept_in_memory = _tablet_schema->is_in_memory(),
+            .be_exec_version = _be_exec_version,
+    };
+    std::unique_ptr<ColumnReader> new_reader;
+    RETURN_IF_ERROR(ColumnReader::create(opts, footer_pb_shared->columns(ordinal->second),
+                                         footer_pb_shared->num_rows(), _file_reader,
+                                         &new_reader));
+
+    std::lock_guard<std::mutex> lock(_column_readers_lock);
+    auto [iter, inserted] = _column_readers.try_emplace(unique_id);
+    if (inserted) {
+        // another thread may have created it meanwhile
+        _column_reader_lru.push_front(unique_id);
+        iter->second.reader = std::move(new_reader);
+        iter->second.lru_pos = _column_reader_lru.begin();
+        iter->second.mem_usage = config::estimated_mem_per_column_reader;
+        _meta_mem_usage += iter->second.mem_usage;
+        *reader = iter->second.reader;
+        _evict_cold_column_readers();
+        update_metadata_size();
+    } else {
+        _column_reader_lru.splice(_column_reader_lru.begin(), _column_reader_lru,
+                                  iter->second.lru_pos);
+        *reader = iter->second.reader;
+    }
+    return Status::OK();
+}
+
+void Segment::_evict_cold_column_readers() {
+    const int32_t capacity = config::max_column_readers_per_segment;
+    if (capacity <= 0) {
+        return;
+    }
+    auto pos = _column_reader_lru.end();
+    while (_column_readers.size() > static_cast<size_t>(capacity) &&
+           pos != _column_reader_lru.begin()) {
+        --pos;
+        auto iter = _column_readers.find(*pos);
+        DCHECK(iter != _column_readers.end());
+        // A reader held by an iterator stays. The bitmap index iterators don't hold the reader,
+        // so a reader with a bitmap index stays too.
+        if (iter->second.reader.use_count() > 1 || iter->second.reader->has_bitmap_index()) {
+            continue;
+        }
+        _meta_mem_usage -= iter->second.mem_usage;
+        _column_readers.erase(iter);
+        pos = _column_reader_lru.erase(pos);
+    }
+}
+
+Status Segment::_get_column_reader(const TabletColumn& col, std::shared_ptr<ColumnReader>* reader,
+                                   OlapReaderStatistics* stats) {
     // init column iterator by path info
     if (col.has_path_info() || col.is_variant_type()) {
+        *reader = nullptr;
         auto relative_path = col.path_info_ptr()->copy_pop_front();
         int32_t unique_id = col.unique_id() > 0 ? col.unique_id() : col.parent_unique_id();
         const auto* node = col.has_path_info()
                                    ? _sub_column_tree[unique_id].find_exact(relative_path)
                                    : nullptr;
         if (node != nullptr) {
-            return node->data.reader.get();
+            // the readers of variant sub columns live as long as the segment
+            *reader = std::shared_ptr<ColumnReader>(shared_from_this(), node->data.reader.get());
         }
-        return nullptr;
-    }
-    auto col_unique_id = col.unique_id();
-    if (_column_readers.contains(col_unique_id)) {
-        return _column_readers[col_unique_id].get();
+        return Status::OK();
     }
-    return nullptr;
+    return _get_column_reader(col.unique_id(), reader, stats);
 }
 
 Status Segment::new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                           const StorageReadOptions& read_options,
                                           std::unique_ptr<BitmapIndexIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once(read_options.stats));
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    std::shared_ptr<ColumnReader> reader;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, &reader, read_options.stats));
     if (reader != nullptr && reader->has_bitmap_index()) {
         BitmapIndexIterator* it;
         RETURN_IF_ERROR(reader->new_bitmap_index_iterator(&it));
@@ -963,7 +1062,8 @@ Status Segment::new_inverted_index_iterator(const TabletColumn& tablet_column,
         _be_exec_version = read_options.runtime_state->be_exec_version();
     }
     RETURN_IF_ERROR(_create_column_readers_once(read_options.stats));
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    std::shared_ptr<ColumnReader> reader;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, &reader, read_options.stats));
     if (reader != nullptr && index_meta) {
         // call DorisCallOnce.call without check if _inverted_index_file_reader is nullptr
         // to avoid data race during parallel method calls
@@ -1132,6 +1232,14 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                                        uint32_t row_id, vectorized::MutableColumnPtr& result,
                                        OlapReaderStatistics& stats,
                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
+    return seek_and_read_by_rowids(schema, slot, &row_id, 1, result, stats, iterator_hint);
+}
+
+Status Segment::seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                        const uint32_t* row_ids, size_t num_rows,
+                                        vectorized::MutableColumnPtr& result,
+                                        OlapReaderStatistics& stats,
+                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
     StorageReadOptions storage_read_opt;
     storage_read_opt.stats = &stats;
     storage_read_opt.io_ctx.reader_type = ReaderType::READER_QUERY;
@@ -1142,7 +1250,7 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             .io_ctx = io::IOContext {.reader_type = ReaderType::READER_QUERY,
                                      .file_cache_stats = &stats.file_cache_stats},
     };
-    std::vector<segment_v2::rowid_t> single_row_loc {row_id};
+    DCHECK(std::is_sorted(row_ids, row_ids + num_rows));
     if (!slot->column_paths().empty()) {
         vectorized::PathInDataPtr path = std::make_shared<vectorized::PathInData>(
                 schema.column_by_uid(slot->col_unique_id()).name_lower_case(),
@@ -1160,13 +1268,14 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             RETURN_IF_ERROR(new_column_iterator(column, &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(
-                iterator_hint->read_by_rowids(single_row_loc.data(), 1, file_storage_column));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, num_rows, file_storage_column));
         // iterator_hint.reset(nullptr);
         // Get it's inner field, for JSONB case
         vectorized::Field field = remove_nullable(storage_type)->get_default();
-        file_storage_column->get(0, field);
-        result->insert(field);
+        for (size_t i = 0; i < num_rows; ++i) {
+            file_storage_column->get(i, field);
+            result->insert(field);
+        }
     } else {
         int index = (slot->col_unique_id() >= 0) ? schema.field_index(slot->col_unique_id())
                                                  : schema.field_index(slot->col_name());
@@ -1182,7 +1291,7 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                     new_column_iterator(schema.column(index), &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(iterator_hint->read_by_rowids(single_row_loc.data(), 1, result));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, num_rows, result));
     }
     return Status::OK();
 }
@@ -23,8 +23,10 @@
 #include <glog/logging.h>
 
 #include <cstdint>
+#include <list>
 #include <map>
 #include <memory> // for unique_ptr
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -150,6 +152,13 @@ public:
                                   vectorized::MutableColumnPtr& result, OlapReaderStatistics& stats,
                                   std::unique_ptr<ColumnIterator>& iterator_hint);
 
+    // Same as above for rows in ascending order of row_ids, read with one pass over the pages.
+    Status seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                   const uint32_t* row_ids, size_t num_rows,
+                                   vectorized::MutableColumnPtr& result,
+                                   OlapReaderStatistics& stats,
+                                   std::unique_ptr<ColumnIterator>& iterator_hint);
+
     Status load_index(OlapReaderStatistics* stats);
 
     Status load_pk_index_and_bf(OlapReaderStatistics* stats);
@@ -234,13 +243,22 @@ private:
     Status _parse_footer(std::shared_ptr<SegmentFooterPB>& footer, OlapReaderStatistics* stats);
     Status _create_column_readers(const SegmentFooterPB& footer);
     Status _load_pk_bloom_filter(OlapReaderStatistics* stats);
-    ColumnReader* _get_column_reader(const TabletColumn& col);
+    // Get the reader of a column, it is created on the first use.
+    // *reader is nullptr if this segment has no data for the column.
+    Status _get_column_reader(int32_t unique_id, std::shared_ptr<ColumnReader>* reader,
+                              OlapReaderStatistics* stats);
+    Status _get_column_reader(const TabletColumn& col, std::shared_ptr<ColumnReader>* reader,
+                              OlapReaderStatistics* stats);
+    // Drop the least recently used readers beyond config::max_column_readers_per_segment.
+    // Must be called with _column_readers_lock held.
+    void _evict_cold_column_readers();
 
     // Get Iterator which will read variant root column and extract with paths and types info
     Status _new_iterator_with_variant_root(const TabletColumn& tablet_column,
                                            std::unique_ptr<ColumnIterator>* iter,
                                            const SubcolumnColumnReaders::Node* root,
-                                           vectorized::DataTypePtr target_type_hint);
+                                           vectorized::DataTypePtr target_type_hint,
+                                           const StorageReadOptions* opt);
     Status _write_error_file(size_t file_size, size_t offset, size_t bytes_read, char* data,
                              io::IOContext& io_ctx);
 
@@ -271,11 +289,23 @@ private:
     std::unique_ptr<PrimaryKeyIndexMetaPB> _pk_index_meta;
     PagePointerPB _sk_index_page;
 
+    // map column unique id ---> ordinal of its ColumnMetaPB in the footer
+    // A column in TabletSchema but not in the map has no data in this segment, it may be
+    // added after this segment is generated.
+    std::unordered_map<int32_t, uint32_t> _column_uid_to_footer_ordinal;
+
+    struct CachedColumnReader {
+        // the iterators of the column share it, so a reader in use is never dropped
+        std::shared_ptr<ColumnReader> reader;
+        std::list<int32_t>::iterator lru_pos;
+        int64_t mem_usage = 0;
+    };
     // map column unique id ---> column reader
-    // ColumnReader for each column in TabletSchema. If ColumnReader is nullptr,
-    // This means that this segment has no data for that column, which may be added
-    // after this segment is generated.
-    std::map<int32_t, std::unique_ptr<ColumnReader>> _column_readers;
+    // The readers are created on the first use, wide tables usually read only a few columns.
+    std::map<int32_t, CachedColumnReader> _column_readers;
+    // column unique ids, the most recently used first
+    std::list<int32_t> _column_reader_lru;
+    std::mutex _column_readers_lock;
 
     // Init from ColumnMetaPB in SegmentFooterPB
     // map column unique id ---> it's inner data type
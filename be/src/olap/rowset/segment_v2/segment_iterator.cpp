@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <set>
@@ -38,6 +39,8 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "io/cache/cached_remote_file_reader.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/io_common.h"
 #include "olap/bloom_filter_predicate.h"
@@ -61,6 +64,7 @@
 #include "olap/types.h"
 #include "olap/utils.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_predicate.h"
 #include "runtime/runtime_state.h"
@@ -71,6 +75,7 @@
 #include "util/simd/bits.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
+#include "vec/columns/column_dictionary.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_variant.h"
@@ -96,7 +101,11 @@ namespace doris {
 using namespace ErrorCode;
 namespace segment_v2 {
 
-SegmentIterator::~SegmentIterator() = default;
+SegmentIterator::~SegmentIterator() {
+    if (_prefetch_stopped != nullptr) {
+        _prefetch_stopped->store(true, std::memory_order_relaxed);
+    }
+}
 
 // A fast range iterator for roaring bitmap. Output ranges use closed-open form, like [from, to).
 // Example:
@@ -281,6 +290,7 @@ Status SegmentIterator::_init_impl(const StorageReadOptions& opts) {
         return Status::OK();
     }
     _opts = opts;
+    _opts.variant_root_readers = std::make_shared<VariantRootReaders>();
     SCOPED_RAW_TIMER(&_opts.stats->segment_iterator_init_timer_ns);
     _inited = true;
     _file_reader = _segment->_file_reader;
@@ -401,9 +411,109 @@ Status SegmentIterator::_lazy_init() {
     } else {
         _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
     }
+    RETURN_IF_ERROR(_init_data_page_prefetch());
+    return Status::OK();
+}
+
+Status SegmentIterator::_init_data_page_prefetch() {
+    // Only prefetch into the file cache, the pages of a local segment are read from the os
+    // page cache at a small cost per page.
+    if (!config::enable_segment_data_page_prefetch || _opts.read_orderby_key_reverse ||
+        _row_bitmap.isEmpty() ||
+        dynamic_cast<io::CachedRemoteFileReader*>(_file_reader.get()) == nullptr) {
+        return Status::OK();
+    }
+    for (auto cid : _schema->column_ids()) {
+        if (_column_iterators[cid] != nullptr) {
+            RETURN_IF_ERROR(_column_iterators[cid]->get_data_pages(_row_bitmap, &_prefetch_pages));
+        }
+    }
+    std::sort(_prefetch_pages.begin(), _prefetch_pages.end(), [](const auto& l, const auto& r) {
+        return l.first != r.first ? l.first < r.first : l.second.offset < r.second.offset;
+    });
+    _prefetch_stopped = std::make_shared<std::atomic<bool>>(false);
     return Status::OK();
 }
 
+void SegmentIterator::_prefetch_data_pages(rowid_t read_rowid) {
+    if (_prefetch_issued == _prefetch_pages.size() && _prefetch_consumed == _prefetch_issued) {
+        return;
+    }
+    // the pages starting at or before the rows read are being read now
+    while (_prefetch_consumed < _prefetch_issued &&
+           _prefetch_pages[_prefetch_consumed].first <= read_rowid) {
+        _prefetch_bytes_ahead -= _prefetch_pages[_prefetch_consumed].second.size;
+        ++_prefetch_consumed;
+    }
+    if (_prefetch_consumed == _prefetch_issued) {
+        while (_prefetch_issued < _prefetch_pages.size() &&
+               _prefetch_pages[_prefetch_issued].first <= read_rowid) {
+            ++_prefetch_issued;
+        }
+        _prefetch_consumed = _prefetch_issued;
+    }
+
+    std::vector<io::PrefetchRange> ranges;
+    while (_prefetch_issued < _prefetch_pages.size() &&
+           static_cast<int64_t>(_prefetch_bytes_ahead) < config::segment_prefetch_window_bytes) {
+        const auto& page = _prefetch_pages[_prefetch_issued++].second;
+        ranges.emplace_back(page.offset, page.offset + page.size);
+        _prefetch_bytes_ahead += page.size;
+    }
+    if (ranges.empty()) {
+        return;
+    }
+    std::sort(ranges.begin(), ranges.end(), [](const auto& l, const auto& r) {
+        return l.start_offset < r.start_offset;
+    });
+    ranges = io::PrefetchRange::merge_adjacent_seq_ranges(
+            ranges, config::segment_prefetch_merge_distance_bytes,
+            config::segment_prefetch_max_read_bytes);
+
+    // A dry run only downloads the data into the file cache without returning it. The task
+    // may outlive this iterator, so it keeps the file reader and no reference to the stats.
+    // It stops once the iterator is gone or the query is cancelled or done.
+    io::IOContext io_ctx = _opts.io_ctx;
+    io_ctx.is_dryrun = true;
+    io_ctx.query_id = nullptr;
+    io_ctx.file_cache_stats = nullptr;
+    std::weak_ptr<ResourceContext> resource_ctx;
+    bool has_resource_ctx = false;
+    if (thread_context()->is_attach_task()) {
+        resource_ctx = thread_context()->resource_ctx();
+        has_resource_ctx = true;
+    }
+    auto st = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->submit_func(
+            [file_reader = _file_reader, io_ctx, ranges = std::move(ranges),
+             stopped = _prefetch_stopped, resource_ctx, has_resource_ctx]() {
+                SCOPED_INIT_THREAD_CONTEXT();
+                for (const auto& range : ranges) {
+                    if (stopped->load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                    if (has_resource_ctx) {
+                        auto ctx = resource_ctx.lock();
+                        if (ctx == nullptr || ctx->task_controller()->is_cancelled()) {
+                            return;
+                        }
+                    }
+                    size_t bytes_read = 0;
+                    Slice result(static_cast<char*>(nullptr),
+                                 range.end_offset - range.start_offset);
+                    auto st = file_reader->read_at(range.start_offset, result, &bytes_read,
+                                                   &io_ctx);
+                    if (!st.ok()) {
+                        LOG(WARNING) << "failed to prefetch " << file_reader->path().native()
+                                     << ": " << st;
+                        return;
+                    }
+                }
+            });
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to submit the data page prefetch: " << st;
+    }
+}
+
 Status SegmentIterator::_get_row_ranges_by_keys() {
     SCOPED_RAW_TIMER(&_opts.stats->generate_row_ranges_by_keys_ns);
     DorisMetrics::instance()->segment_row_total->increment(num_rows());
@@ -788,8 +898,12 @@ bool SegmentIterator::_check_apply_by_inverted_index(ColumnPredicate* pred) {
     }
 
     if (pred->type() == PredicateType::IN_LIST || pred->type() == PredicateType::NOT_IN_LIST) {
-        // in_list or not_in_list predicate produced by runtime filter
-        if (pred->is_runtime_filter()) {
+        // in_list predicate produced by runtime filter looks up the inverted index only when
+        // its set is small, each value is a separate term query
+        if (pred->is_runtime_filter() &&
+            (pred->type() == PredicateType::NOT_IN_LIST || pred->always_true() ||
+             static_cast<int64_t>(pred->in_list_size()) >
+                     config::inverted_index_max_runtime_filter_in_list_size)) {
             return false;
         }
     }
@@ -1076,7 +1190,7 @@ Status SegmentIterator::_init_return_column_iterators() {
                     .use_page_cache = _opts.use_page_cache,
                     // If the col is predicate column, then should read the last page to check
                     // if the column is full dict encoding
-                    .is_predicate_column = tmp_is_pred_column[cid],
+                    .is_predicate_column = tmp_is_pred_column[cid] || _can_read_dict_codes(cid),
                     .file_reader = _file_reader.get(),
                     .stats = _opts.stats,
                     .io_ctx = _opts.io_ctx,
@@ -1649,6 +1763,10 @@ Status SegmentIterator::_init_current_block(
                             _schema->column(cid)->name());
                 }
                 current_columns[cid]->clear();
+            } else if (_is_dict_code_column[cid]) {
+                // keep the dictionary of the segment, the column is output by
+                // _output_dict_code_column().
+                current_columns[cid]->clear();
             } else { // non-predicate column
                 current_columns[cid] = std::move(*block->get_by_position(i).column).mutate();
                 current_columns[cid]->reserve(nrows_read_limit);
@@ -1658,16 +1776,95 @@ Status SegmentIterator::_init_current_block(
     return Status::OK();
 }
 
-void SegmentIterator::_output_non_pred_columns(vectorized::Block* block) {
+Status SegmentIterator::_output_non_pred_columns(vectorized::Block* block) {
     SCOPED_RAW_TIMER(&_opts.stats->output_col_ns);
     for (auto cid : _non_predicate_columns) {
         auto loc = _schema_block_id_map[cid];
         // if loc > block->columns() means the column is delete column and should
         // not output by block, so just skip the column.
         if (loc < block->columns()) {
-            block->replace_by_position(loc, std::move(_current_return_columns[cid]));
+            if (_is_dict_code_column[cid]) {
+                RETURN_IF_ERROR(_output_dict_code_column(block, cid, loc));
+            } else {
+                block->replace_by_position(loc, std::move(_current_return_columns[cid]));
+            }
         }
     }
+    return Status::OK();
+}
+
+bool SegmentIterator::_can_read_dict_codes(ColumnId cid) const {
+    if (!config::enable_dict_code_aggregation || !config::enable_low_cardinality_optimize ||
+        _opts.io_ctx.reader_type != ReaderType::READER_QUERY) {
+        return false;
+    }
+    auto type = _schema->column(cid)->type();
+    return type == FieldType::OLAP_FIELD_TYPE_VARCHAR || type == FieldType::OLAP_FIELD_TYPE_STRING;
+}
+
+void SegmentIterator::_init_dict_code_columns(vectorized::Block* block) {
+    _is_dict_code_column.resize(_schema->columns().size(), false);
+    // Only the columns output as they are read, the columns used by a predicate or an expr
+    // are read as plain columns.
+    for (auto cid : _non_predicate_columns) {
+        _is_dict_code_column[cid] = _can_read_dict_codes(cid) &&
+                                    _schema_block_id_map[cid] < block->columns() &&
+                                    _segment->same_with_storage_type(cid, *_schema, false) &&
+                                    _column_iterators[cid] != nullptr &&
+                                    _column_iterators[cid]->is_all_dict_encoding();
+    }
+}
+
+Status SegmentIterator::_output_dict_code_column(vectorized::Block* block, ColumnId cid,
+                                                 size_t loc) {
+    auto& column = _current_return_columns[cid];
+    const auto rows = column->size();
+    if (_dict_code_sel.size() < rows) {
+        auto old_size = _dict_code_sel.size();
+        _dict_code_sel.resize(rows);
+        std::iota(_dict_code_sel.begin() + old_size, _dict_code_sel.end(),
+                  static_cast<uint16_t>(old_size));
+    }
+    // The column of the block was cleared by _init_current_block().
+    auto output_column = std::move(*block->get_by_position(loc).column).mutate();
+    RETURN_IF_ERROR(column->filter_by_selector(_dict_code_sel.data(), rows, output_column.get()));
+    block->replace_by_position(loc, std::move(output_column));
+    _set_dict_codes(block, loc, *column, _dict_code_sel.data(), rows);
+    return Status::OK();
+}
+
+void SegmentIterator::_set_dict_codes(vectorized::Block* block, size_t loc,
+                                      const vectorized::IColumn& column, const uint16_t* sel,
+                                      size_t sel_size) {
+    if (!config::enable_dict_code_aggregation) {
+        return;
+    }
+    const vectorized::IColumn* nested = &column;
+    const vectorized::NullMap* null_map = nullptr;
+    if (column.is_nullable()) {
+        const auto& nullable_column = assert_cast<const vectorized::ColumnNullable&>(column);
+        nested = &nullable_column.get_nested_column();
+        null_map = &nullable_column.get_null_map_data();
+    }
+    if (!nested->is_column_dictionary()) {
+        // A page is not dictionary encoded.
+        return;
+    }
+    const auto& dict_column = assert_cast<const vectorized::ColumnDictI32&>(*nested);
+    // The codes of a sorted dictionary are only valid after they are converted.
+    if (dict_column.dict_id() == 0 ||
+        (dict_column.is_dict_sorted() && !dict_column.is_dict_code_converted())) {
+        return;
+    }
+    auto codes = std::make_shared<vectorized::ColumnDictCodes>();
+    codes->dict_id = dict_column.dict_id();
+    codes->dict_size = dict_column.dict_size();
+    codes->codes.resize(sel_size);
+    const auto& data = dict_column.get_data();
+    for (size_t i = 0; i < sel_size; ++i) {
+        codes->codes[i] = null_map != nullptr && (*null_map)[sel[i]] ? -1 : data[sel[i]];
+    }
+    block->set_dict_codes(loc, std::move(codes));
 }
 
 /**
@@ -1696,6 +1893,9 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     SCOPED_RAW_TIMER(&_opts.stats->predicate_column_read_ns);
 
     nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
+    if (nrows_read > 0) {
+        _prefetch_data_pages(_block_rowids[nrows_read - 1]);
+    }
     bool is_continuous = (nrows_read > 1) &&
                          (_block_rowids[nrows_read - 1] - _block_rowids[0] == nrows_read - 1);
 
@@ -1887,10 +2087,34 @@ uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_ro
     }
 
     uint16_t original_size = selected_size;
-    for (auto* predicate : _short_cir_eval_predicate) {
-        auto column_id = predicate->column_id();
-        auto& short_cir_column = _current_return_columns[column_id];
-        selected_size = predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+    const bool adaptive_order =
+            config::enable_adaptive_predicate_order && _short_cir_eval_predicate.size() > 1;
+    if (!adaptive_order) {
+        for (auto* predicate : _short_cir_eval_predicate) {
+            auto column_id = predicate->column_id();
+            auto& short_cir_column = _current_return_columns[column_id];
+            selected_size =
+                    predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+        }
+    } else {
+        if (_short_cir_pred_stats.size() != _short_cir_eval_predicate.size()) {
+            _short_cir_pred_stats.assign(_short_cir_eval_predicate.size(), {});
+        }
+        for (size_t i = 0; i < _short_cir_eval_predicate.size(); ++i) {
+            auto* predicate = _short_cir_eval_predicate[i];
+            auto& short_cir_column = _current_return_columns[predicate->column_id()];
+            auto& stats = _short_cir_pred_stats[i];
+            stats.input_rows += selected_size;
+            {
+                SCOPED_RAW_TIMER(&stats.cost_ns);
+                selected_size =
+                        predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+            }
+            stats.output_rows += selected_size;
+        }
+        if (++_short_cir_eval_batches % SHORT_CIRCUIT_PREDICATE_REORDER_BATCHES == 0) {
+            _reorder_short_circuit_predicates();
+        }
     }
 
     _opts.stats->short_circuit_cond_input_rows += original_size;
@@ -1904,6 +2128,40 @@ uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_ro
     return selected_size;
 }
 
+void SegmentIterator::_reorder_short_circuit_predicates() {
+    const auto num_predicates = _short_cir_eval_predicate.size();
+    std::vector<double> ranks(num_predicates);
+    for (size_t i = 0; i < num_predicates; ++i) {
+        const auto& stats = _short_cir_pred_stats[i];
+        if (stats.input_rows == 0) {
+            // never saw a row, the predicates before it filtered them all
+            ranks[i] = std::numeric_limits<double>::max();
+            continue;
+        }
+        const auto cost_per_row = (double)stats.cost_ns / (double)stats.input_rows;
+        const auto filtered_ratio = 1 - (double)stats.output_rows / (double)stats.input_rows;
+        ranks[i] = cost_per_row / std::max(filtered_ratio, 1e-6);
+    }
+
+    std::vector<size_t> order(num_predicates);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return ranks[a] < ranks[b]; });
+
+    std::vector<ColumnPredicate*> predicates(num_predicates);
+    std::vector<PredicateEvalStats> stats(num_predicates);
+    for (size_t i = 0; i < num_predicates; ++i) {
+        predicates[i] = _short_cir_eval_predicate[order[i]];
+        stats[i] = _short_cir_pred_stats[order[i]];
+        // decay the history, so the order follows changes of the data
+        stats[i].input_rows /= 2;
+        stats[i].output_rows /= 2;
+        stats[i].cost_ns /= 2;
+    }
+    _short_cir_eval_predicate.swap(predicates);
+    _short_cir_pred_stats.swap(stats);
+}
+
 Status SegmentIterator::_read_columns_by_rowids(std::vector<ColumnId>& read_column_ids,
                                                 std::vector<rowid_t>& rowid_vector,
                                                 uint16_t* sel_rowid_idx, size_t select_size,
@@ -2049,6 +2307,7 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
             _is_char_type.resize(_schema->columns().size(), false);
             _vec_init_char_column_id(block);
         }
+        _init_dict_code_columns(block);
         for (size_t i = 0; i < _schema->num_column_ids(); i++) {
             auto cid = _schema->column_id(i);
             auto column_desc = _schema->column(cid);
@@ -2065,6 +2324,15 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
                 _current_return_columns[cid]->set_rowset_segment_id(
                         {_segment->rowset_id(), _segment->id()});
                 _current_return_columns[cid]->reserve(nrows_reserve_limit);
+            } else if (_is_dict_code_column[cid]) {
+                auto storage_column_type = _storage_name_and_type[cid].second;
+                RETURN_IF_CATCH_EXCEPTION(
+                        _current_return_columns[cid] = Schema::get_predicate_column_ptr(
+                                storage_column_type->get_storage_field_type(),
+                                storage_column_type->is_nullable(), _opts.io_ctx.reader_type));
+                _current_return_columns[cid]->set_rowset_segment_id(
+                        {_segment->rowset_id(), _segment->id()});
+                _current_return_columns[cid]->reserve(nrows_reserve_limit);
             } else if (i >= block->columns()) {
                 // if i >= block->columns means the column and not the pred_column means `column i` is
                 // a delete condition column. but the column is not effective in the segment. so we just
@@ -2130,7 +2398,7 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
         for (int i = 0; i < block->columns(); i++) {
             auto cid = _schema->column_id(i);
             // todo(wb) abstract make column where
-            if (!_is_pred_column[cid]) {
+            if (!_is_pred_column[cid] && !_is_dict_code_column[cid]) {
                 block->replace_by_position(i, std::move(_current_return_columns[cid]));
             }
         }
@@ -2146,7 +2414,7 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
         }
         RETURN_IF_ERROR(_convert_to_expected_type(_predicate_column_ids));
         RETURN_IF_ERROR(_convert_to_expected_type(_non_predicate_columns));
-        _output_non_pred_columns(block);
+        RETURN_IF_ERROR(_output_non_pred_columns(block));
     } else {
         uint16_t selected_size = _current_batch_rows_read;
         _sel_rowid_idx.resize(selected_size);
@@ -2286,7 +2554,7 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
 
         RETURN_IF_ERROR(_convert_to_expected_type(_non_predicate_columns));
         // step5: output columns
-        _output_non_pred_columns(block);
+        RETURN_IF_ERROR(_output_non_pred_columns(block));
     }
 
     // shrink char_type suffix zero data
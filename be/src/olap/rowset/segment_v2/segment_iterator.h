@@ -21,6 +21,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -41,6 +42,7 @@
 #include "olap/row_cursor.h"
 #include "olap/row_cursor_cell.h"
 #include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/page_pointer.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "olap/schema.h"
 #include "util/runtime_profile.h"
@@ -230,8 +232,26 @@ private:
                                uint32_t nrows_read_limit);
     uint16_t _evaluate_vectorization_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
     uint16_t _evaluate_short_circuit_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
+    // Sorts the short circuit predicates by their measured cost per row / fraction of rows
+    // filtered, a cheap and selective predicate leaves fewer rows to the costly ones after it.
+    void _reorder_short_circuit_predicates();
+    // Collects the data pages of the columns to read when the segment is in the file cache.
+    [[nodiscard]] Status _init_data_page_prefetch();
+    // Prefetches the next data pages into the file cache, keeping at most
+    // `segment_prefetch_window_bytes` of them ahead of `read_rowid`.
+    void _prefetch_data_pages(rowid_t read_rowid);
     void _collect_runtime_filter_predicate();
-    void _output_non_pred_columns(vectorized::Block* block);
+    [[nodiscard]] Status _output_non_pred_columns(vectorized::Block* block);
+    // Whether the column can be read with its dictionary codes, see
+    // config::enable_dict_code_aggregation.
+    bool _can_read_dict_codes(ColumnId cid) const;
+    void _init_dict_code_columns(vectorized::Block* block);
+    // Outputs the column read as a dictionary column as a string column, and attaches the
+    // dictionary codes of its rows to the block.
+    [[nodiscard]] Status _output_dict_code_column(vectorized::Block* block, ColumnId cid,
+                                                  size_t loc);
+    void _set_dict_codes(vectorized::Block* block, size_t loc, const vectorized::IColumn& column,
+                         const uint16_t* sel, size_t sel_size);
     [[nodiscard]] Status _read_columns_by_rowids(std::vector<ColumnId>& read_column_ids,
                                                  std::vector<rowid_t>& rowid_vector,
                                                  uint16_t* sel_rowid_idx, size_t select_size,
@@ -281,6 +301,8 @@ private:
                 RETURN_IF_ERROR(copy_column_data_by_selector(_current_return_columns[cid].get(),
                                                              output_column, sel_rowid_idx,
                                                              select_size, _opts.block_row_max));
+                _set_dict_codes(block, block_cid, *_current_return_columns[cid], sel_rowid_idx,
+                                select_size);
             }
         }
         return Status::OK();
@@ -415,9 +437,30 @@ private:
     std::vector<bool> _is_pred_column; // columns hold _init segmentIter
     std::map<uint32_t, bool> _need_read_data_indices;
     std::vector<bool> _is_common_expr_column;
+    // The non predicate columns read as dictionary columns to output their codes.
+    std::vector<bool> _is_dict_code_column;
+    std::vector<uint16_t> _dict_code_sel;
     vectorized::MutableColumns _current_return_columns;
     std::vector<ColumnPredicate*> _pre_eval_block_predicate;
     std::vector<ColumnPredicate*> _short_cir_eval_predicate;
+    struct PredicateEvalStats {
+        int64_t input_rows = 0;
+        int64_t output_rows = 0;
+        int64_t cost_ns = 0;
+    };
+    // the short circuit predicates are reordered every this many batches
+    static constexpr size_t SHORT_CIRCUIT_PREDICATE_REORDER_BATCHES = 8;
+    // the stats of `_short_cir_eval_predicate`, in the same order
+    std::vector<PredicateEvalStats> _short_cir_pred_stats;
+    size_t _short_cir_eval_batches = 0;
+    // the data pages to read of all columns, in ordinal order. The pages in
+    // [_prefetch_consumed, _prefetch_issued) are prefetched and not read yet.
+    std::vector<std::pair<ordinal_t, PagePointer>> _prefetch_pages;
+    size_t _prefetch_issued = 0;
+    size_t _prefetch_consumed = 0;
+    uint64_t _prefetch_bytes_ahead = 0;
+    // set when the iterator is gone, so its prefetch tasks are dropped
+    std::shared_ptr<std::atomic<bool>> _prefetch_stopped;
     std::vector<uint32_t> _delete_range_column_ids;
     std::vector<uint32_t> _delete_bloom_filter_column_ids;
     // when lazy materialization is enabled, segmentIter need to read data at least twice
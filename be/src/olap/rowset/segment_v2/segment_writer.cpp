@@ -186,6 +186,9 @@ Status SegmentWriter::_create_column_writer(uint32_t cid, const TabletColumn& co
     // except for columns whose type don't support zone map.
     opts.need_zone_map = column.is_key() || schema->keys_type() != KeysType::AGG_KEYS;
     opts.need_bloom_filter = column.is_bf_column();
+    if (config::enable_string_page_bloom_filter && is_string_type(column.type())) {
+        opts.need_bloom_filter = true;
+    }
     if (opts.need_bloom_filter) {
         opts.bf_options.fpp = schema->has_bf_fpp() ? schema->bloom_filter_fpp() : 0.05;
     }
@@ -56,12 +56,14 @@
 #include "olap/utils.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
+#include "runtime/thread_context.h"
 #include "service/point_query_executor.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
 #include "util/debug_points.h"
 #include "util/faststring.h"
 #include "util/key_util.h"
+#include "util/threadpool.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
@@ -183,6 +185,9 @@ Status VerticalSegmentWriter::_create_column_writer(uint32_t cid, const TabletCo
     // except for columns whose type don't support zone map.
     opts.need_zone_map = column.is_key() || tablet_schema->keys_type() != KeysType::AGG_KEYS;
     opts.need_bloom_filter = column.is_bf_column();
+    if (config::enable_string_page_bloom_filter && is_string_type(column.type())) {
+        opts.need_bloom_filter = true;
+    }
     if (opts.need_bloom_filter) {
         opts.bf_options.fpp =
                 tablet_schema->has_bf_fpp() ? tablet_schema->bloom_filter_fpp() : 0.05;
@@ -1178,15 +1183,13 @@ Status VerticalSegmentWriter::write_batch() {
     std::map<uint32_t, vectorized::IOlapColumnDataAccessor*> cid_to_column;
     for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
         RETURN_IF_ERROR(_create_column_writer(cid, _tablet_schema->column(cid), _tablet_schema));
-        for (auto& data : _batched_blocks) {
-            RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
-                    data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
-
-            // convert column data from engine format to storage layer format
-            auto [status, column] = _olap_data_convertor->convert_column_data(cid);
-            if (!status.ok()) {
-                return status;
-            }
+    }
+    std::vector<vectorized::IOlapColumnDataAccessor*> columns;
+    RETURN_IF_ERROR(_encode_columns(&columns));
+    // the pages are written in the order of the columns in the footer
+    for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
+        auto* column = columns[cid];
+        for ([[maybe_unused]] auto& data : _batched_blocks) {
             if (cid < _tablet_schema->num_key_columns()) {
                 key_columns.push_back(column);
             }
@@ -1200,16 +1203,12 @@ Status VerticalSegmentWriter::write_batch() {
                           column_unique_id) != _tablet_schema->cluster_key_uids().end()) {
                 cid_to_column[column_unique_id] = column;
             }
-            RETURN_IF_ERROR(_column_writers[cid]->append(column->get_nullmap(), column->get_data(),
-                                                         data.num_rows));
-            _olap_data_convertor->clear_source_content();
         }
         if (_data_dir != nullptr &&
             _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
             return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
                                                             _data_dir->path_hash());
         }
-        RETURN_IF_ERROR(_column_writers[cid]->finish());
         RETURN_IF_ERROR(_column_writers[cid]->write_data());
     }
 
@@ -1237,6 +1236,97 @@ Status VerticalSegmentWriter::write_batch() {
     return Status::OK();
 }
 
+Status VerticalSegmentWriter::_encode_column(uint32_t cid,
+                                             vectorized::IOlapColumnDataAccessor** column) {
+    for (auto& data : _batched_blocks) {
+        RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
+                data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
+
+        // convert column data from engine format to storage layer format
+        auto [status, converted] = _olap_data_convertor->convert_column_data(cid);
+        if (!status.ok()) {
+            return status;
+        }
+        *column = converted;
+        RETURN_IF_ERROR(_column_writers[cid]->append(converted->get_nullmap(),
+                                                     converted->get_data(), data.num_rows));
+        _olap_data_convertor->clear_source_content(cid);
+    }
+    return _column_writers[cid]->finish();
+}
+
+Status VerticalSegmentWriter::_encode_columns(
+        std::vector<vectorized::IOlapColumnDataAccessor*>* columns) {
+    auto num_columns = _tablet_schema->num_columns();
+    columns->assign(num_columns, nullptr);
+    // Variant columns add the writers of their subcolumns and the writers of inverted indexes
+    // share the index file writer, so these columns are encoded on this thread. The others are
+    // cut into groups of adjacent columns encoded by the pool meanwhile.
+    std::vector<uint32_t> serial_cids;
+    std::vector<uint32_t> parallel_cids;
+    for (uint32_t cid = 0; cid < num_columns; ++cid) {
+        const auto& column = _tablet_schema->column(cid);
+        if (column.is_variant_type() || _tablet_schema->inverted_index(column) != nullptr) {
+            serial_cids.push_back(cid);
+        } else {
+            parallel_cids.push_back(cid);
+        }
+    }
+    auto* pool = ExecEnv::GetInstance()->segment_column_encode_thread_pool();
+    size_t num_groups = 0;
+    if (pool != nullptr && thread_context()->is_attach_task() &&
+        config::segment_column_encode_thread_num > 1 &&
+        parallel_cids.size() >=
+                static_cast<size_t>(std::max(config::segment_parallel_encode_min_columns, 2))) {
+        num_groups = std::min<size_t>(config::segment_column_encode_thread_num,
+                                      parallel_cids.size());
+    }
+    if (num_groups == 0) {
+        for (uint32_t cid = 0; cid < num_columns; ++cid) {
+            RETURN_IF_ERROR(_encode_column(cid, &(*columns)[cid]));
+        }
+        return Status::OK();
+    }
+
+    auto resource_ctx = thread_context()->resource_ctx();
+    std::vector<Status> group_status(num_groups);
+    auto encode_group = [this, &parallel_cids, &group_status, columns, num_groups](size_t group) {
+        size_t begin = parallel_cids.size() * group / num_groups;
+        size_t end = parallel_cids.size() * (group + 1) / num_groups;
+        group_status[group] = [&]() -> Status {
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t cid = parallel_cids[i];
+                RETURN_IF_ERROR_OR_CATCH_EXCEPTION(_encode_column(cid, &(*columns)[cid]));
+            }
+            return Status::OK();
+        }();
+    };
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    for (size_t group = 0; group < num_groups; ++group) {
+        auto st = token->submit_func([&encode_group, &resource_ctx, group]() {
+            SCOPED_ATTACH_TASK(resource_ctx);
+            encode_group(group);
+        });
+        if (!st.ok()) {
+            encode_group(group);
+        }
+    }
+    Status st = Status::OK();
+    for (uint32_t cid : serial_cids) {
+        st = _encode_column(cid, &(*columns)[cid]);
+        if (!st.ok()) {
+            break;
+        }
+    }
+    // the groups still read the batched blocks, wait for them before returning
+    token->wait();
+    RETURN_IF_ERROR(st);
+    for (const auto& status : group_status) {
+        RETURN_IF_ERROR(status);
+    }
+    return Status::OK();
+}
+
 Status VerticalSegmentWriter::_generate_key_index(
         RowsInBlock& data, std::vector<vectorized::IOlapColumnDataAccessor*>& key_columns,
         vectorized::IOlapColumnDataAccessor* seq_column,
@@ -198,6 +198,10 @@ private:
             const std::vector<RowsetSharedPtr>& specified_rowsets,
             std::vector<std::unique_ptr<SegmentCacheHandle>>& segment_caches);
     Status _append_block_with_variant_subcolumns(RowsInBlock& data);
+    // Convert and append the batched rows of column cid, then finish its pages. Only the
+    // convertor and the writer of cid are touched, so columns are encoded at the same time.
+    Status _encode_column(uint32_t cid, vectorized::IOlapColumnDataAccessor** column);
+    Status _encode_columns(std::vector<vectorized::IOlapColumnDataAccessor*>* columns);
     Status _generate_key_index(
             RowsInBlock& data, std::vector<vectorized::IOlapColumnDataAccessor*>& key_columns,
             vectorized::IOlapColumnDataAccessor* seq_column,
@@ -22,6 +22,7 @@
 #include <thrift/protocol/TDebugProtocol.h>
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <map>
 #include <memory>
@@ -73,6 +74,7 @@
 #include "runtime/runtime_state.h"
 #include "util/debug_points.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
@@ -1204,65 +1206,19 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
         return process_alter_exit();
     }
 
-    // b. Generate historical data converter
-    auto sc_procedure = _get_sc_procedure(
-            changer, sc_sorting, sc_directly,
-            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change());
-
     DBUG_EXECUTE_IF("SchemaChangeJob::_convert_historical_rowsets.block", DBUG_BLOCK);
 
     // c.Convert historical data
+    const auto& rs_readers = sc_params.ref_rowset_readers;
+    std::vector<RowsetSharedPtr> new_rowsets(rs_readers.size());
+    std::vector<PendingRowsetGuard> pending_rs_guards(rs_readers.size());
     bool have_failure_rowset = false;
-    for (const auto& rs_reader : sc_params.ref_rowset_readers) {
-        // set status for monitor
-        // As long as there is a new_table as running, ref table is set as running
-        // NOTE If the first sub_table fails first, it will continue to go as normal here
-        // When tablet create new rowset writer, it may change rowset type, in this case
-        // linked schema change will not be used.
-        RowsetWriterContext context;
-        context.version = rs_reader->version();
-        context.rowset_state = VISIBLE;
-        context.segments_overlap = rs_reader->rowset()->rowset_meta()->segments_overlap();
-        context.tablet_schema = _new_tablet_schema;
-        context.newest_write_timestamp = rs_reader->newest_write_timestamp();
-
-        if (!rs_reader->rowset()->is_local()) {
-            context.storage_resource =
-                    *DORIS_TRY(rs_reader->rowset()->rowset_meta()->remote_storage_resource());
-        }
-
-        context.write_type = DataWriteType::TYPE_SCHEMA_CHANGE;
-        // TODO if support VerticalSegmentWriter, also need to handle cluster key primary key index
-        bool vertical = false;
-        if (sc_sorting && !_new_tablet->tablet_schema()->cluster_key_uids().empty()) {
-            // see VBaseSchemaChangeWithSorting::_external_sorting
-            vertical = true;
-        }
-        auto result = _new_tablet->create_rowset_writer(context, vertical);
-        if (!result.has_value()) {
-            res = Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
-                                                     result.error().to_string());
-            return process_alter_exit();
-        }
-        auto rowset_writer = std::move(result).value();
-        auto pending_rs_guard = _local_storage_engine.add_pending_rowset(context);
-
-        if (res = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet, _base_tablet,
-                                        _base_tablet_schema, _new_tablet_schema);
-            !res) {
-            LOG(WARNING) << "failed to process the version."
-                         << " version=" << rs_reader->version().first << "-"
-                         << rs_reader->version().second << ", " << res.to_string();
-            return process_alter_exit();
-        }
-        // Add the new version of the data to the header
+    // Add the new version of the data to the header
+    auto add_rowset = [&](size_t i) {
+        const auto& rs_reader = rs_readers[i];
         // In order to prevent the occurrence of deadlock, we must first lock the old table, and then lock the new table
         std::lock_guard lock(_new_tablet->get_push_lock());
-        RowsetSharedPtr new_rowset;
-        if (!(res = rowset_writer->build(new_rowset)).ok()) {
-            LOG(WARNING) << "failed to build rowset, exit alter process";
-            return process_alter_exit();
-        }
+        auto new_rowset = std::move(new_rowsets[i]);
         res = _new_tablet->add_rowset(new_rowset);
         if (res.is<PUSH_VERSION_ALREADY_EXIST>()) {
             LOG(WARNING) << "version already exist, version revert occurred. "
@@ -1277,7 +1233,7 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
                          << ", version=" << rs_reader->version().first << "-"
                          << rs_reader->version().second;
             _local_storage_engine.add_unused_rowset(new_rowset);
-            return process_alter_exit();
+            return;
         } else {
             VLOG_NOTICE << "register new version. tablet=" << _new_tablet->tablet_id()
                         << ", version=" << rs_reader->version().first << "-"
@@ -1290,12 +1246,135 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
         VLOG_TRACE << "succeed to convert a history version."
                    << " version=" << rs_reader->version().first << "-"
                    << rs_reader->version().second;
+    };
+
+    int parallelism = std::min<int>(config::schema_change_rowset_parallelism,
+                                    static_cast<int>(rs_readers.size()));
+    if (parallelism <= 1) {
+        for (size_t i = 0; i < rs_readers.size(); ++i) {
+            if (res = _convert_rowset(rs_readers[i], changer, sc_sorting, sc_directly,
+                                      &new_rowsets[i], &pending_rs_guards[i]);
+                !res) {
+                return process_alter_exit();
+            }
+            add_rowset(i);
+            if (!res) {
+                return process_alter_exit();
+            }
+        }
+        return process_alter_exit();
+    }
+
+    // The rowsets are independent, so they are converted concurrently and then added to the
+    // new tablet in the order of versions.
+    std::vector<Status> convert_statuses(rs_readers.size());
+    std::atomic<bool> has_failure = false;
+    auto convert = [&](size_t i) {
+        if (has_failure) {
+            convert_statuses[i] = Status::Cancelled("another rowset failed to convert");
+            return;
+        }
+        convert_statuses[i] = _convert_rowset(rs_readers[i], changer, sc_sorting, sc_directly,
+                                              &new_rowsets[i], &pending_rs_guards[i]);
+        if (!convert_statuses[i]) {
+            has_failure = true;
+        }
+    };
+    std::unique_ptr<ThreadPool> convert_pool;
+    if (res = ThreadPoolBuilder("SchemaChangeRowsetPool")
+                      .set_min_threads(0)
+                      .set_max_threads(parallelism)
+                      .build(&convert_pool);
+        !res) {
+        return process_alter_exit();
+    }
+    for (size_t i = 0; i < rs_readers.size(); ++i) {
+        if (!convert_pool->submit_func([&convert, i]() { convert(i); })) {
+            convert(i);
+        }
+    }
+    convert_pool->wait();
+    convert_pool->shutdown();
+
+    Defer defer {[&]() {
+        // the rowsets which are not added to the new tablet
+        for (auto& new_rowset : new_rowsets) {
+            if (new_rowset) {
+                _local_storage_engine.add_unused_rowset(new_rowset);
+            }
+        }
+    }};
+    for (size_t i = 0; i < rs_readers.size(); ++i) {
+        if (res = convert_statuses[i]; !res) {
+            return process_alter_exit();
+        }
+        add_rowset(i);
+        if (!res) {
+            return process_alter_exit();
+        }
     }
 
     // XXX:The SchemaChange state should not be canceled at this time, because the new Delta has to be converted to the old and new Schema version
     return process_alter_exit();
 }
 
+Status SchemaChangeJob::_convert_rowset(const RowsetReaderSharedPtr& rs_reader,
+                                       const BlockChanger& changer, bool sc_sorting,
+                                       bool sc_directly, RowsetSharedPtr* new_rowset,
+                                       PendingRowsetGuard* pending_rs_guard) {
+    // Generate historical data converter, every rowset has its own one because it keeps the
+    // state of the conversion
+    auto sc_procedure = _get_sc_procedure(
+            changer, sc_sorting, sc_directly,
+            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change());
+
+    // set status for monitor
+    // As long as there is a new_table as running, ref table is set as running
+    // NOTE If the first sub_table fails first, it will continue to go as normal here
+    // When tablet create new rowset writer, it may change rowset type, in this case
+    // linked schema change will not be used.
+    RowsetWriterContext context;
+    context.version = rs_reader->version();
+    context.rowset_state = VISIBLE;
+    context.segments_overlap = rs_reader->rowset()->rowset_meta()->segments_overlap();
+    context.tablet_schema = _new_tablet_schema;
+    context.newest_write_timestamp = rs_reader->newest_write_timestamp();
+
+    if (!rs_reader->rowset()->is_local()) {
+        context.storage_resource =
+                *DORIS_TRY(rs_reader->rowset()->rowset_meta()->remote_storage_resource());
+    }
+
+    context.write_type = DataWriteType::TYPE_SCHEMA_CHANGE;
+    // TODO if support VerticalSegmentWriter, also need to handle cluster key primary key index
+    bool vertical = false;
+    if (sc_sorting && !_new_tablet->tablet_schema()->cluster_key_uids().empty()) {
+        // see VBaseSchemaChangeWithSorting::_external_sorting
+        vertical = true;
+    }
+    auto result = _new_tablet->create_rowset_writer(context, vertical);
+    if (!result.has_value()) {
+        return Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
+                                                  result.error().to_string());
+    }
+    auto rowset_writer = std::move(result).value();
+    *pending_rs_guard = _local_storage_engine.add_pending_rowset(context);
+
+    if (auto st = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet, _base_tablet,
+                                        _base_tablet_schema, _new_tablet_schema);
+        !st) {
+        LOG(WARNING) << "failed to process the version."
+                     << " version=" << rs_reader->version().first << "-"
+                     << rs_reader->version().second << ", " << st.to_string();
+        return st;
+    }
+    if (auto st = rowset_writer->build(*new_rowset); !st) {
+        LOG(WARNING) << "failed to build rowset, exit alter process";
+        return st;
+    }
+    return Status::OK();
+}
+
 static const std::string WHERE_SIGN_LOWER = to_lower("__DORIS_WHERE_SIGN__");
 
 // @static
@@ -316,6 +316,12 @@ private:
     Status _convert_historical_rowsets(const SchemaChangeParams& sc_params,
                                        int64_t* real_alter_version);
 
+    // Convert a historical rowset into a rowset of the new tablet, which is not added to the
+    // new tablet yet. It is called concurrently for different rowsets.
+    Status _convert_rowset(const RowsetReaderSharedPtr& rs_reader, const BlockChanger& changer,
+                           bool sc_sorting, bool sc_directly, RowsetSharedPtr* new_rowset,
+                           PendingRowsetGuard* pending_rs_guard);
+
     // Initialization Settings for creating a default value
     static Status _init_column_mapping(ColumnMapping* column_mapping,
                                        const TabletColumn& column_schema, const std::string& value);
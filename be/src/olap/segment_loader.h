@@ -83,7 +83,8 @@ public:
     SegmentCache(size_t memory_bytes_limit, size_t segment_num_limit)
             : LRUCachePolicy(CachePolicy::CacheType::SEGMENT_CACHE, memory_bytes_limit,
                              LRUCacheType::SIZE, config::tablet_rowset_stale_sweep_time_sec,
-                             DEFAULT_LRU_CACHE_NUM_SHARDS * 2, segment_num_limit) {}
+                             DEFAULT_LRU_CACHE_NUM_SHARDS * 2, segment_num_limit, true,
+                             DEFAULT_LRU_CACHE_IS_LRU_K, config::segment_cache_enable_tiny_lfu) {}
 
     // Lookup the given segment in the cache.
     // If the segment is found, the cache entry will be written into handle.
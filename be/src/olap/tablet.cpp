@@ -42,6 +42,7 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
+#include <cmath>
 #include <filesystem>
 #include <iterator>
 #include <limits>
@@ -1074,6 +1075,40 @@ uint32_t Tablet::calc_compaction_score() {
     }
 }
 
+uint32_t Tablet::calc_read_aware_compaction_score(uint32_t score) {
+    double read_heat = 0;
+    {
+        std::lock_guard lock(_read_heat_lock);
+        int64_t now_ms = UnixMillis();
+        int64_t scan_count = query_scan_count->value();
+        if (_read_heat_update_ms == 0) {
+            _read_heat_scan_count = scan_count;
+            _read_heat_update_ms = now_ms;
+        } else if (now_ms - _read_heat_update_ms >= 1000) {
+            double rate = static_cast<double>(scan_count - _read_heat_scan_count) * 1000 /
+                          static_cast<double>(now_ms - _read_heat_update_ms);
+            _read_heat = (_read_heat + rate) / 2;
+            _read_heat_scan_count = scan_count;
+            _read_heat_update_ms = now_ms;
+        }
+        read_heat = _read_heat;
+    }
+    double weight = 1 + config::compaction_score_read_weight * std::log2(1 + read_heat);
+    if (keys_type() == UNIQUE_KEYS && enable_unique_key_merge_on_write()) {
+        const auto& delete_bitmap = _tablet_meta->delete_bitmap();
+        size_t num_entries = 0;
+        {
+            std::shared_lock lock(delete_bitmap.lock);
+            num_entries = delete_bitmap.delete_bitmap.size();
+        }
+        weight += config::compaction_score_delete_bitmap_weight *
+                  std::log2(1 + static_cast<double>(num_entries) /
+                                        static_cast<double>(std::max(1, version_count())));
+    }
+    return static_cast<uint32_t>(std::min<double>(score * std::max(weight, 1.0),
+                                                  std::numeric_limits<uint32_t>::max()));
+}
+
 bool Tablet::suitable_for_compaction(
         CompactionType compaction_type,
         std::shared_ptr<CumulativeCompactionPolicy> cumulative_compaction_policy) {
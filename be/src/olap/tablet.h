@@ -226,6 +226,10 @@ public:
 
     uint32_t calc_compaction_score();
 
+    // The score weighed by how often the tablet is scanned, and for merge-on-write tablets by
+    // the delete bitmap entries per version, so compaction goes first where reads gain from it.
+    uint32_t calc_read_aware_compaction_score(uint32_t score);
+
     // This function to find max continuous version from the beginning.
     // For example: If there are 1, 2, 3, 5, 6, 7 versions belongs tablet, then 3 is target.
     // 3 will be saved in "version", and 7 will be saved in "max_version", if max_version != nullptr
@@ -645,6 +649,13 @@ private:
 
     int32_t _compaction_score = -1;
     int32_t _score_check_cnt = 0;
+
+    // scans per second of the tablet, averaged over the calls of
+    // calc_read_aware_compaction_score()
+    std::mutex _read_heat_lock;
+    double _read_heat = 0;
+    int64_t _read_heat_scan_count = 0;
+    int64_t _read_heat_update_ms = 0;
 };
 
 inline CumulativeCompactionPolicy* Tablet::cumulative_compaction_policy() {
@@ -798,6 +798,10 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         if (current_compaction_score < 5) {
             tablet_ptr->set_skip_compaction(true, compaction_type, UnixSeconds());
         }
+        if (config::enable_read_aware_compaction_score) {
+            current_compaction_score =
+                    tablet_ptr->calc_read_aware_compaction_score(current_compaction_score);
+        }
 
         // tablet should do single compaction
         if (current_compaction_score > single_compact_highest_score &&
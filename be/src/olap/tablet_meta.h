@@ -551,6 +551,13 @@ public:
 
     void remove_sentinel_marks();
 
+    /**
+     * Compacts a bitmap which won't be changed any more, such as one merged into the tablet by
+     * a publish or kept by the agg cache: runs of deleted rows become run containers and the
+     * unused capacity of the containers is released.
+     */
+    static void seal(roaring::Roaring* bitmap);
+
     uint64_t get_delete_bitmap_count();
 
     void traverse_rowset_and_version(
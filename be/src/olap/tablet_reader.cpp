@@ -53,8 +53,10 @@
 #include "runtime/query_context.h"
 #include "runtime/runtime_predicate.h"
 #include "runtime/runtime_state.h"
+#include "udf/udf.h"
 #include "vec/common/arena.h"
 #include "vec/core/block.h"
+#include "vec/functions/like.h"
 
 namespace doris {
 using namespace ErrorCode;
@@ -562,7 +564,9 @@ Status TabletReader::_init_conditions_param(const ReaderParams& read_params) {
 
         const auto& col = _tablet_schema->column(pred->column_id());
         const auto* tablet_index = _tablet_schema->get_ngram_bf_index(col.unique_id());
-        if (is_like_predicate(pred) && tablet_index && config::enable_query_like_bloom_filter) {
+        // a page without the ngrams of the pattern may still match NOT LIKE
+        if (is_like_predicate(pred) && !filter._opposite && tablet_index &&
+            config::enable_query_like_bloom_filter) {
             std::unique_ptr<segment_v2::BloomFilter> ng_bf;
             std::string pattern = pred->get_search_str();
             auto gram_bf_size = tablet_index->get_gram_bf_size();
@@ -572,8 +576,14 @@ Status TabletReader::_init_conditions_param(const ReaderParams& read_params) {
                                                             gram_bf_size));
             NgramTokenExtractor _token_extractor(gram_size);
 
-            if (_token_extractor.string_like_to_bloom_filter(pattern.data(), pattern.length(),
-                                                             *ng_bf)) {
+            const auto* like_state = reinterpret_cast<const vectorized::LikeState*>(
+                    filter._fn_ctx->get_function_state(FunctionContext::THREAD_LOCAL));
+            bool added = like_state->search_state.is_regexp
+                                 ? _token_extractor.string_regexp_to_bloom_filter(
+                                           pattern.data(), pattern.length(), *ng_bf)
+                                 : _token_extractor.string_like_to_bloom_filter(
+                                           pattern.data(), pattern.length(), *ng_bf);
+            if (added) {
                 pred->set_page_ng_bf(std::move(ng_bf));
             }
         }
@@ -22,6 +22,7 @@
 #include <json2pb/pb_to_json.h>
 
 #include "bvar/bvar.h"
+#include "olap/lru_cache.h"
 #include "olap/tablet_schema.h"
 #include "util/sha.h"
 
@@ -64,6 +65,17 @@ std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::insert(const std:
     return std::make_pair(lru_handle, tablet_schema_ptr);
 }
 
+std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::acquire(
+        Cache::Handle* lru_handle) {
+    DCHECK(lru_handle != nullptr);
+    auto* new_handle = lookup(reinterpret_cast<LRUHandle*>(lru_handle)->key());
+    if (new_handle == nullptr) {
+        return {nullptr, nullptr};
+    }
+    g_tablet_schema_cache_hit_count << 1;
+    return {new_handle, ((CacheValue*)LRUCachePolicy::value(new_handle))->tablet_schema};
+}
+
 void TabletSchemaCache::release(Cache::Handle* lru_handle) {
     LRUCachePolicy::release(lru_handle);
 }
@@ -42,6 +42,11 @@ public:
 
     std::pair<Cache::Handle*, TabletSchemaSPtr> insert(const std::string& key);
 
+    // Acquire another handle of the schema cached by `lru_handle`, which is much cheaper than
+    // `insert` since the schema needn't be serialized as the key again.
+    // Return a nullptr handle if the schema is no longer in the cache.
+    std::pair<Cache::Handle*, TabletSchemaSPtr> acquire(Cache::Handle* lru_handle);
+
     void release(Cache::Handle*);
 
 private:
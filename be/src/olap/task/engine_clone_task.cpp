@@ -29,7 +29,11 @@
 #include <gen_cpp/Types_constants.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -65,6 +69,7 @@
 #include "util/network_util.h"
 #include "util/security.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -75,6 +80,91 @@ namespace doris {
 using namespace ErrorCode;
 
 namespace {
+// Limits the number of the downloads into each data dir of all the clone tasks
+class CloneDownloadLimiter {
+public:
+    static void acquire(DataDir* data_dir) {
+        std::unique_lock lock(_mtx);
+        _cv.wait(lock, [&] {
+            return _downloading[data_dir] <
+                   std::max(1, config::clone_download_concurrency_per_disk);
+        });
+        ++_downloading[data_dir];
+    }
+
+    static void release(DataDir* data_dir) {
+        {
+            std::lock_guard lock(_mtx);
+            --_downloading[data_dir];
+        }
+        _cv.notify_all();
+    }
+
+private:
+    static inline std::mutex _mtx;
+    static inline std::condition_variable _cv;
+    static inline std::unordered_map<DataDir*, int> _downloading;
+};
+
+// Run the downloads in parallel, with at most `clone_download_concurrency_per_disk` downloads of
+// all the clone tasks running into `data_dir` at the same time.
+// Stop at the first failed download and return its error.
+Status parallel_download(DataDir* data_dir, const std::vector<std::function<Status()>>& downloads) {
+    std::atomic<size_t> next = 0;
+    std::mutex st_mtx;
+    Status st;
+    auto run = [&] {
+        for (size_t i = next++; i < downloads.size(); i = next++) {
+            {
+                std::lock_guard lock(st_mtx);
+                if (!st.ok()) {
+                    return;
+                }
+            }
+            CloneDownloadLimiter::acquire(data_dir);
+            auto download_st = downloads[i]();
+            CloneDownloadLimiter::release(data_dir);
+            if (!download_st.ok()) {
+                std::lock_guard lock(st_mtx);
+                if (st.ok()) {
+                    st = std::move(download_st);
+                }
+                return;
+            }
+        }
+    };
+
+    auto num_threads = std::min(downloads.size(),
+                                (size_t)std::max(1, config::clone_download_concurrency_per_disk));
+    std::unique_ptr<ThreadPool> pool;
+    if (num_threads > 1) {
+        // the calling thread is one of the downloaders
+        auto build_st = ThreadPoolBuilder("clone_download")
+                                .set_max_threads(static_cast<int>(num_threads - 1))
+                                .build(&pool);
+        if (build_st.ok()) {
+            for (size_t i = 1; i < num_threads; ++i) {
+                auto submit_st = pool->submit_func([&run] {
+                    SCOPED_INIT_THREAD_CONTEXT();
+                    run();
+                });
+                if (!submit_st.ok()) {
+                    break;
+                }
+            }
+        } else {
+            LOG(WARNING) << "failed to build clone download pool, download serially. st="
+                         << build_st;
+            pool.reset();
+        }
+    }
+    run();
+    if (pool != nullptr) {
+        pool->wait();
+    }
+    return st;
+}
+
 /// if binlog file exist, then check if binlog file md5sum equal
 /// if equal, then skip link file
 /// if not equal, then return error
@@ -564,10 +654,10 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
+    std::atomic<uint64_t> total_file_size = 0;
     MonotonicStopWatch watch;
     watch.start();
-    for (auto& file_name : file_name_list) {
+    auto download_file = [&](const std::string& file_name) -> Status {
         auto remote_file_url = remote_url_prefix + file_name;
 
         // get file length
@@ -624,20 +714,31 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             return io::global_local_filesystem()->permission(local_file_path,
                                                              io::LocalFileSystem::PERMS_OWNER_RW);
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+    std::vector<std::function<Status()>> downloads;
+    for (size_t i = 0; i + 1 < file_name_list.size(); ++i) {
+        downloads.emplace_back([&, i] { return download_file(file_name_list[i]); });
+    }
+    RETURN_IF_ERROR(parallel_download(data_dir, downloads));
+    if (!file_name_list.empty()) {
+        // the header file is downloaded after all the others
+        RETURN_IF_ERROR(parallel_download(
+                data_dir, {[&] { return download_file(file_name_list.back()); }}));
+    }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
     double copy_rate = 0.0;
     if (total_time_ms > 0) {
-        copy_rate = total_file_size / ((double)total_time_ms) / 1000;
+        copy_rate = (double)total_file_size.load() / ((double)total_time_ms) / 1000;
     }
-    _copy_size = (int64_t)total_file_size;
+    _copy_size = (int64_t)total_file_size.load();
     _copy_time_ms = (int64_t)total_time_ms;
     LOG(INFO) << "succeed to copy tablet " << _signature
               << ", total files: " << file_name_list.size()
-              << ", total file size: " << total_file_size << " B, cost: " << total_time_ms << " ms"
+              << ", total file size: " << total_file_size.load() << " B, cost: " << total_time_ms
+              << " ms"
               << ", rate: " << copy_rate << " MB/s";
     return Status::OK();
 }
@@ -676,8 +777,9 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
 
     size_t total_file_size = 0;
     size_t total_files = file_info_list.size();
-    std::vector<std::pair<std::string, size_t>> batch_files;
+    std::vector<std::vector<std::pair<std::string, size_t>>> batches;
     for (size_t i = 0; i < total_files;) {
+        std::vector<std::pair<std::string, size_t>> batch_files;
         size_t batch_file_size = 0;
         for (size_t j = i; j < total_files; j++) {
             // Split batchs by file number and file size,
@@ -697,11 +799,23 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
                     batch_file_size);
         }
 
-        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batch_files));
-
         total_file_size += batch_file_size;
         i += batch_files.size();
-        batch_files.clear();
+        batches.push_back(std::move(batch_files));
+    }
+
+    auto download_batch = [&](const std::vector<std::pair<std::string, size_t>>& batch_files) {
+        return download_files_v2(address, token, remote_dir, local_dir, batch_files);
+    };
+    std::vector<std::function<Status()>> downloads;
+    for (size_t i = 0; i + 1 < batches.size(); ++i) {
+        downloads.emplace_back([&, i] { return download_batch(batches[i]); });
+    }
+    RETURN_IF_ERROR(parallel_download(data_dir, downloads));
+    if (!batches.empty()) {
+        // the batch of the header file is downloaded after all the others
+        RETURN_IF_ERROR(
+                parallel_download(data_dir, {[&] { return download_batch(batches.back()); }}));
     }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
@@ -64,23 +64,24 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
     }
     size_t total_size = 0;
     size_t offset = 0;
+    std::string content;
     for (const auto& block : blocks) {
         uint8_t len_buf[sizeof(uint64_t)];
         uint64_t block_length = block->ByteSizeLong();
         total_size += LENGTH_SIZE + block_length + CHECKSUM_SIZE;
         encode_fixed64_le(len_buf, block_length);
-        RETURN_IF_ERROR(_file_writer->append({len_buf, sizeof(uint64_t)}));
-        offset += LENGTH_SIZE;
 
-        std::string content = block->SerializeAsString();
-        RETURN_IF_ERROR(_file_writer->append(content));
-        offset += block_length;
+        content.clear();
+        block->SerializeToString(&content);
 
         uint8_t checksum_buf[sizeof(uint32_t)];
         uint32_t checksum = crc32c::Value(content.data(), block_length);
         encode_fixed32_le(checksum_buf, checksum);
-        RETURN_IF_ERROR(_file_writer->append({checksum_buf, sizeof(uint32_t)}));
-        offset += CHECKSUM_SIZE;
+
+        // the length, the block and its checksum take one write
+        Slice slices[3] = {{len_buf, sizeof(uint64_t)}, content, {checksum_buf, sizeof(uint32_t)}};
+        RETURN_IF_ERROR(_file_writer->appendv(slices, 3));
+        offset += LENGTH_SIZE + block_length + CHECKSUM_SIZE;
     }
     if (offset != total_size) {
         return Status::InternalError(
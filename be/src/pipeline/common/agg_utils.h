@@ -21,10 +21,12 @@
 #include <vector>
 
 #include "vec/common/arena.h"
+#include "vec/common/hash_table/fixed_hash_map.h"
 #include "vec/common/hash_table/hash_map_context.h"
 #include "vec/common/hash_table/hash_map_util.h"
 #include "vec/common/hash_table/ph_hash_map.h"
 #include "vec/common/hash_table/string_hash_map.h"
+#include "vec/core/block.h"
 
 namespace doris {
 
@@ -34,6 +36,9 @@ template <typename T>
 using AggDataNullable = vectorized::DataWithNullKey<AggData<T>>;
 
 using AggregatedDataWithoutKey = vectorized::AggregateDataPtr;
+// 8 and 16 bit keys address their states directly, without hashing.
+using AggregatedDataWithUInt8Key = FixedHashMap<vectorized::UInt8, vectorized::AggregateDataPtr>;
+using AggregatedDataWithUInt16Key = FixedHashMap<vectorized::UInt16, vectorized::AggregateDataPtr>;
 using AggregatedDataWithStringKey = PHHashMap<StringRef, vectorized::AggregateDataPtr>;
 using AggregatedDataWithShortStringKey = StringHashMap<vectorized::AggregateDataPtr>;
 
@@ -48,13 +53,16 @@ using AggregatedDataWithNullableUInt32KeyPhase2 =
         vectorized::DataWithNullKey<AggregatedDataWithUInt32KeyPhase2>;
 using AggregatedDataWithNullableUInt64KeyPhase2 =
         vectorized::DataWithNullKey<AggregatedDataWithUInt64KeyPhase2>;
+using AggregatedDataWithNullableUInt8Key = vectorized::DataWithNullKey<AggregatedDataWithUInt8Key>;
+using AggregatedDataWithNullableUInt16Key =
+        vectorized::DataWithNullKey<AggregatedDataWithUInt16Key>;
 using AggregatedDataWithNullableShortStringKey =
         vectorized::DataWithNullKey<AggregatedDataWithShortStringKey>;
 
 using AggregatedMethodVariants = std::variant<
         std::monostate, vectorized::MethodSerialized<AggregatedDataWithStringKey>,
-        vectorized::MethodOneNumber<vectorized::UInt8, AggData<vectorized::UInt8>>,
-        vectorized::MethodOneNumber<vectorized::UInt16, AggData<vectorized::UInt16>>,
+        vectorized::MethodOneNumber<vectorized::UInt8, AggregatedDataWithUInt8Key>,
+        vectorized::MethodOneNumber<vectorized::UInt16, AggregatedDataWithUInt16Key>,
         vectorized::MethodOneNumber<vectorized::UInt32, AggData<vectorized::UInt32>>,
         vectorized::MethodOneNumber<vectorized::UInt64, AggData<vectorized::UInt64>>,
         vectorized::MethodStringNoCache<AggregatedDataWithShortStringKey>,
@@ -62,10 +70,10 @@ using AggregatedMethodVariants = std::variant<
         vectorized::MethodOneNumber<vectorized::UInt256, AggData<vectorized::UInt256>>,
         vectorized::MethodOneNumber<vectorized::UInt32, AggregatedDataWithUInt32KeyPhase2>,
         vectorized::MethodOneNumber<vectorized::UInt64, AggregatedDataWithUInt64KeyPhase2>,
-        vectorized::MethodSingleNullableColumn<
-                vectorized::MethodOneNumber<vectorized::UInt8, AggDataNullable<vectorized::UInt8>>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
-                vectorized::UInt16, AggDataNullable<vectorized::UInt16>>>,
+                vectorized::UInt8, AggregatedDataWithNullableUInt8Key>>,
+        vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
+                vectorized::UInt16, AggregatedDataWithNullableUInt16Key>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
                 vectorized::UInt32, AggDataNullable<vectorized::UInt32>>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
@@ -100,10 +108,10 @@ struct AggregatedDataVariants
             method_variant.emplace<vectorized::MethodSerialized<AggregatedDataWithStringKey>>();
             break;
         case HashKeyType::int8_key:
-            emplace_single<vectorized::UInt8, AggData<vectorized::UInt8>>(nullable);
+            emplace_single<vectorized::UInt8, AggregatedDataWithUInt8Key>(nullable);
             break;
         case HashKeyType::int16_key:
-            emplace_single<vectorized::UInt16, AggData<vectorized::UInt16>>(nullable);
+            emplace_single<vectorized::UInt16, AggregatedDataWithUInt16Key>(nullable);
             break;
         case HashKeyType::int32_key:
             emplace_single<vectorized::UInt32, AggData<vectorized::UInt32>>(nullable);
@@ -318,4 +326,76 @@ private:
     uint32_t _total_count {};
     bool _inited = false;
 };
+
+/// Caches the aggregate state of every dictionary code of a single string key, so the rows of a
+/// block with dictionary codes (see vectorized::Block::get_dict_codes()) find their states
+/// without hashing the strings. Only the first row of a code unknown to the cache goes through
+/// the hash table. The cached states must stay at the same address until reset() is called.
+struct AggDictCodePlaces {
+    // `emplace(miss_keys, miss_places, num_misses)` finds or creates the states of the keys of
+    // the rows that miss the cache. Returns the number of rows that hit the cache.
+    template <typename Emplace>
+    size_t find_or_emplace(const vectorized::ColumnDictCodes& codes,
+                           const vectorized::IColumn& key_column,
+                           vectorized::AggregateDataPtr* places, size_t num_rows,
+                           Emplace&& emplace) {
+        DCHECK_EQ(codes.codes.size(), num_rows);
+        if (codes.dict_id != _dict_id) {
+            _dict_id = codes.dict_id;
+            // Slot 0 is the null key, slot code + 1 is the code.
+            _code_places.assign(codes.dict_size + 1, nullptr);
+            _pending.assign(codes.dict_size + 1, 0);
+        }
+
+        _miss_rows.clear();
+        _miss_slots.clear();
+        const auto* code_data = codes.codes.data();
+        for (uint32_t i = 0; i < num_rows; ++i) {
+            const auto slot = static_cast<size_t>(code_data[i] + 1);
+            DCHECK_LT(slot, _code_places.size());
+            places[i] = _code_places[slot];
+            if (places[i] == nullptr && !_pending[slot]) {
+                _pending[slot] = 1;
+                _miss_rows.push_back(i);
+                _miss_slots.push_back(slot);
+            }
+        }
+        if (_miss_rows.empty()) {
+            return num_rows;
+        }
+
+        auto miss_keys = key_column.clone_empty();
+        miss_keys->insert_indices_from(key_column, _miss_rows.data(),
+                                       _miss_rows.data() + _miss_rows.size());
+        _miss_places.resize(_miss_rows.size());
+        emplace(*miss_keys, _miss_places.data(), _miss_rows.size());
+        for (size_t i = 0; i < _miss_slots.size(); ++i) {
+            _code_places[_miss_slots[i]] = _miss_places[i];
+            _pending[_miss_slots[i]] = 0;
+        }
+
+        size_t hit_rows = num_rows;
+        for (uint32_t i = 0; i < num_rows; ++i) {
+            if (places[i] == nullptr) {
+                places[i] = _code_places[code_data[i] + 1];
+                --hit_rows;
+            }
+        }
+        return hit_rows;
+    }
+
+    void reset() {
+        _dict_id = 0;
+        _code_places.clear();
+        _pending.clear();
+    }
+
+private:
+    uint64_t _dict_id = 0;
+    std::vector<vectorized::AggregateDataPtr> _code_places;
+    std::vector<uint8_t> _pending;
+    std::vector<uint32_t> _miss_rows;
+    std::vector<size_t> _miss_slots;
+    std::vector<vectorized::AggregateDataPtr> _miss_places;
+};
 } // namespace doris
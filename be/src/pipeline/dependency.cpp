@@ -17,13 +17,17 @@
 
 #include "dependency.h"
 
+#include <parallel_hashmap/phmap.h>
+
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "common/logging.h"
 #include "pipeline/exec/multi_cast_data_streamer.h"
 #include "pipeline/pipeline_fragment_context.h"
 #include "pipeline/pipeline_task.h"
+#include "pipeline/task_queue.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime_filter/runtime_filter_consumer.h"
@@ -80,12 +84,37 @@ void Dependency::set_ready() {
         _ready = true;
         local_block_task.swap(_blocked_task);
     }
-    for (auto task : local_block_task) {
-        if (auto t = task.lock()) {
-            std::unique_lock<std::mutex> lc(_task_lock);
-            THROW_IF_ERROR(t->wake_up(this));
+    if (local_block_task.empty()) {
+        return;
+    }
+    // Wake up all the blocked tasks under one lock acquisition and submit them to the task
+    // queue in one batch after the lock is released.
+    std::vector<PipelineTaskSPtr> ready_tasks;
+    ready_tasks.reserve(local_block_task.size());
+    {
+        std::unique_lock<std::mutex> lc(_task_lock);
+        for (auto& task : local_block_task) {
+            if (auto t = task.lock()) {
+                THROW_IF_ERROR(t->wake_up(this, &ready_tasks));
+            }
         }
     }
+    // tasks blocked by the same dependency mostly belong to the same scheduler
+    size_t begin = 0;
+    while (begin < ready_tasks.size()) {
+        auto* task_queue = ready_tasks[begin]->get_task_queue();
+        size_t end = begin + 1;
+        while (end < ready_tasks.size() && ready_tasks[end]->get_task_queue() == task_queue) {
+            ++end;
+        }
+        if (begin == 0 && end == ready_tasks.size()) {
+            THROW_IF_ERROR(task_queue->push_back(ready_tasks));
+        } else {
+            THROW_IF_ERROR(task_queue->push_back(std::vector<PipelineTaskSPtr>(
+                    ready_tasks.begin() + begin, ready_tasks.begin() + end)));
+        }
+        begin = end;
+    }
 }
 
 Dependency* Dependency::is_blocked_by(std::shared_ptr<PipelineTask> task) {
@@ -112,7 +141,7 @@ std::string CountedFinishDependency::debug_string(int indentation_level) {
     fmt::format_to(debug_string_buffer,
                    "{}{}: id={}, block_task={}, ready={}, _always_ready={}, count={}",
                    std::string(indentation_level * 2, ' '), _name, _node_id, _blocked_task.size(),
-                   _ready, _always_ready, _counter);
+                   _ready, _always_ready, _counter.load());
     return fmt::to_string(debug_string_buffer);
 }
 
@@ -318,6 +347,35 @@ Status AggSharedState::reset_hash_table() {
             agg_data->method_variant);
 }
 
+void AggSharedState::next_merge_bucket() {
+    DCHECK(has_next_merge_bucket());
+    _close_with_serialized_key(*agg_data);
+    auto& bucket = merge_buckets[next_merge_bucket_idx++];
+    agg_data = std::move(bucket.agg_data);
+    aggregate_data_container = std::move(bucket.aggregate_data_container);
+    agg_arena_pool = std::move(bucket.agg_arena_pool);
+}
+
+size_t AggMergeBucket::size() const {
+    return std::visit(
+            vectorized::Overload {[&](const std::monostate& arg) -> size_t { return 0; },
+                                  [&](const auto& agg_method) -> size_t {
+                                      return agg_method.hash_table->size();
+                                  }},
+            agg_data->method_variant);
+}
+
+size_t AggMergeBucket::memory_usage() const {
+    size_t usage = agg_arena_pool->size() +
+                   static_cast<size_t>(aggregate_data_container->memory_usage());
+    std::visit(vectorized::Overload {[&](const std::monostate& arg) -> void {},
+                                     [&](const auto& agg_method) -> void {
+                                         usage += agg_method.hash_table->get_buffer_size_in_bytes();
+                                     }},
+               agg_data->method_variant);
+    return usage;
+}
+
 void PartitionedAggSharedState::init_spill_params(size_t spill_partition_count) {
     partition_count = spill_partition_count;
     max_partition_index = partition_count - 1;
@@ -474,8 +532,16 @@ void AggSharedState::refresh_top_limit(size_t row_id,
 }
 
 Status MaterializationSharedState::merge_multi_response(vectorized::Block* block) {
-    std::map<int64_t, std::pair<vectorized::Block, int>> _block_maps;
+    std::vector<uint32_t> indices;
     for (int i = 0; i < block_order_results.size(); ++i) {
+        // concat the response blocks of all backends and a default row for the NULL lines, so
+        // every column is filled by a single insert_indices_from
+        vectorized::MutableColumns source_columns;
+        for (int k = 0; k < response_blocks[i].columns(); ++k) {
+            source_columns.emplace_back(
+                    response_blocks[i].get_column_by_position(k)->clone_empty());
+        }
+        std::map<int64_t, uint32_t> backend_offsets;
         for (auto& [backend_id, rpc_struct] : rpc_struct_map) {
             vectorized::Block partial_block;
             DCHECK(rpc_struct.callback->response_->blocks_size() > i);
@@ -483,27 +549,35 @@ Status MaterializationSharedState::merge_multi_response(vectorized::Block* block
                     partial_block.deserialize(rpc_struct.callback->response_->blocks(i).block()));
 
             if (!partial_block.is_empty_column()) {
-                _block_maps[backend_id] = std::make_pair(std::move(partial_block), 0);
+                backend_offsets[backend_id] = cast_set<uint32_t>(source_columns[0]->size());
+                for (int k = 0; k < source_columns.size(); ++k) {
+                    source_columns[k]->insert_range_from(*partial_block.get_by_position(k).column,
+                                                         0, partial_block.rows());
+                }
             }
         }
+        auto default_row =
+                cast_set<uint32_t>(source_columns.empty() ? 0 : source_columns[0]->size());
+        for (auto& column : source_columns) {
+            column->insert_default();
+        }
 
-        for (int j = 0; j < block_order_results[i].size(); ++j) {
-            auto backend_id = block_order_results[i][j];
+        const auto& block_order = block_order_results[i];
+        indices.resize(block_order.size());
+        for (int j = 0; j < block_order.size(); ++j) {
+            auto backend_id = block_order[j];
             if (backend_id) {
-                auto& source_block_rows = _block_maps[backend_id];
-                DCHECK(source_block_rows.second < source_block_rows.first.rows());
-                for (int k = 0; k < response_blocks[i].columns(); ++k) {
-                    response_blocks[i].get_column_by_position(k)->insert_from(
-                            *source_block_rows.first.get_by_position(k).column,
-                            source_block_rows.second);
-                }
-                source_block_rows.second++;
+                DCHECK(backend_offsets.contains(backend_id));
+                indices[j] = backend_offsets[backend_id] + block_order_positions[i][j];
+                DCHECK(indices[j] < default_row);
             } else {
-                for (int k = 0; k < response_blocks[i].columns(); ++k) {
-                    response_blocks[i].get_column_by_position(k)->insert_default();
-                }
+                indices[j] = default_row;
             }
         }
+        for (int k = 0; k < response_blocks[i].columns(); ++k) {
+            response_blocks[i].get_column_by_position(k)->insert_indices_from(
+                    *source_columns[k], indices.data(), indices.data() + indices.size());
+        }
     }
 
     // clear request/response
@@ -549,6 +623,7 @@ Status MaterializationSharedState::create_muiltget_result(const vectorized::Colu
                                                           bool eos, bool gc_id_map) {
     const auto rows = columns.empty() ? 0 : columns[0]->size();
     block_order_results.resize(columns.size());
+    block_order_positions.resize(columns.size());
 
     for (int i = 0; i < columns.size(); ++i) {
         const uint8_t* null_map = nullptr;
@@ -565,6 +640,10 @@ Status MaterializationSharedState::create_muiltget_result(const vectorized::Colu
 
         auto& block_order = block_order_results[i];
         block_order.resize(rows);
+        auto& block_positions = block_order_positions[i];
+        block_positions.resize(rows);
+        // backend id -> (file id, row id) -> position in the request of the backend
+        std::map<int64_t, phmap::flat_hash_map<uint64_t, uint32_t>> row_positions;
 
         for (int j = 0; j < rows; ++j) {
             if (!null_map || !null_map[j]) {
@@ -577,13 +656,20 @@ Status MaterializationSharedState::create_muiltget_result(const vectorized::Colu
                             "MaterializationSinkOperatorX failed to find rpc_struct, backend_id={}",
                             row_location.backend_id);
                 }
-                rpc_struct->second.request.mutable_request_block_descs(i)->add_row_id(
-                        row_location.row_id);
-                rpc_struct->second.request.mutable_request_block_descs(i)->add_file_id(
-                        row_location.file_id);
+                auto* request_block_desc =
+                        rpc_struct->second.request.mutable_request_block_descs(i);
+                auto [it, inserted] = row_positions[row_location.backend_id].try_emplace(
+                        (uint64_t(row_location.file_id) << 32) | row_location.row_id,
+                        cast_set<uint32_t>(request_block_desc->row_id_size()));
+                if (inserted) {
+                    request_block_desc->add_row_id(row_location.row_id);
+                    request_block_desc->add_file_id(row_location.file_id);
+                }
                 block_order[j] = row_location.backend_id;
+                block_positions[j] = it->second;
             } else {
                 block_order[j] = 0;
+                block_positions[j] = 0;
             }
         }
     }
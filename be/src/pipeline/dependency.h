@@ -179,19 +179,23 @@ public:
     CountedFinishDependency(int id, int node_id, std::string name)
             : Dependency(id, node_id, std::move(name), true) {}
 
+    // Only the transitions between zero and non-zero take the lock, and the counter is checked
+    // again under the lock, so the final state always matches the latest counter.
     void add(uint32_t count = 1) {
-        std::unique_lock<std::mutex> l(_mtx);
-        if (!_counter) {
-            block();
+        if (_counter.fetch_add(count) == 0) {
+            std::unique_lock<std::mutex> l(_mtx);
+            if (_counter > 0) {
+                block();
+            }
         }
-        _counter += count;
     }
 
     void sub() {
-        std::unique_lock<std::mutex> l(_mtx);
-        _counter--;
-        if (!_counter) {
-            set_ready();
+        if (_counter.fetch_sub(1) == 1) {
+            std::unique_lock<std::mutex> l(_mtx);
+            if (_counter == 0) {
+                set_ready();
+            }
         }
     }
 
@@ -199,7 +203,7 @@ public:
 
 private:
     std::mutex _mtx;
-    uint32_t _counter = 0;
+    std::atomic<uint32_t> _counter = 0;
 };
 
 struct RuntimeFilterTimerQueue;
@@ -275,6 +279,17 @@ struct RuntimeFilterTimerQueue {
     std::list<std::shared_ptr<pipeline::RuntimeFilterTimer>> _que;
 };
 
+// The groups of a final merge may be split into buckets by the high bits of the key hash.
+// Each bucket has its own hash table, so the buckets can be merged in parallel.
+struct AggMergeBucket {
+    AggregatedDataVariantsUPtr agg_data;
+    std::unique_ptr<AggregateDataContainer> aggregate_data_container;
+    ArenaUPtr agg_arena_pool;
+
+    size_t size() const;
+    size_t memory_usage() const;
+};
+
 struct AggSharedState : public BasicSharedState {
     ENABLE_FACTORY_CREATOR(AggSharedState)
 public:
@@ -284,7 +299,12 @@ public:
     }
     ~AggSharedState() override {
         if (!probe_expr_ctxs.empty()) {
-            _close_with_serialized_key();
+            _close_with_serialized_key(*agg_data);
+            for (size_t i = next_merge_bucket_idx; i < merge_buckets.size(); ++i) {
+                if (merge_buckets[i].agg_data) {
+                    _close_with_serialized_key(*merge_buckets[i].agg_data);
+                }
+            }
         } else {
             _close_without_key();
         }
@@ -292,6 +312,11 @@ public:
 
     Status reset_hash_table();
 
+    bool has_next_merge_bucket() const { return next_merge_bucket_idx < merge_buckets.size(); }
+    // Destroys the aggregate states of the current hash table, and replaces it by the next
+    // merge bucket.
+    void next_merge_bucket();
+
     bool do_limit_filter(vectorized::Block* block, size_t num_rows,
                          const std::vector<int>* key_locs = nullptr);
     void build_limit_heap(size_t hash_table_size);
@@ -316,6 +341,11 @@ public:
     vectorized::Sizes offsets_of_aggregate_states;
     std::vector<size_t> make_nullable_keys;
 
+    // Not empty if the groups are split into merge buckets, the hash table above is the bucket
+    // being output.
+    std::vector<AggMergeBucket> merge_buckets;
+    size_t next_merge_bucket_idx = 0;
+
     bool agg_data_created_without_key = false;
     bool enable_spill = false;
     bool reach_limit = false;
@@ -384,7 +414,7 @@ public:
 private:
     vectorized::MutableColumns _get_keys_hash_table();
 
-    void _close_with_serialized_key() {
+    void _close_with_serialized_key(AggregatedDataVariants& data_variants) {
         std::visit(vectorized::Overload {[&](std::monostate& arg) -> void {
                                              // Do nothing
                                          },
@@ -405,7 +435,7 @@ private:
                                                  }
                                              }
                                          }},
-                   agg_data->method_variant);
+                   data_variants.method_variant);
     }
 
     void _close_without_key() {
@@ -746,8 +776,15 @@ struct DataDistribution {
     DataDistribution(const DataDistribution& other) = default;
     bool need_local_exchange() const { return distribution_type != ExchangeType::NOOP; }
     DataDistribution& operator=(const DataDistribution& other) = default;
+    DataDistribution& set_allow_key_split(bool allow) {
+        allow_key_split = allow;
+        return *this;
+    }
     ExchangeType distribution_type;
     std::vector<TExpr> partition_exprs;
+    // The operator does not need all the rows of a key in one task (e.g. a partial aggregation
+    // whose result is merged later), so a hash shuffle may split a skewed key into tasks.
+    bool allow_key_split = false;
 };
 
 class ExchangerBase;
@@ -842,6 +879,9 @@ public:
     // Register each line in which block to ensure the order of the result.
     // Zero means NULL value.
     std::vector<std::vector<int64_t>> block_order_results;
+    // The position of each line in the response block of its backend. The lines of the same row
+    // location, e.g. a build row matched by many probe rows of a join, are fetched only once.
+    std::vector<std::vector<uint32_t>> block_order_positions;
 };
 #include "common/compile_check_end.h"
 } // namespace doris::pipeline
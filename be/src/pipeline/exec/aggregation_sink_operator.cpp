@@ -17,20 +17,28 @@
 
 #include "aggregation_sink_operator.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
+#include "runtime/fragment_mgr.h"
 #include "runtime/primitive_type.h"
 #include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
 #include "util/runtime_profile.h"
+#include "util/threadpool.h"
 #include "vec/common/hash_table/hash.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
+// The rows buffered for the merge buckets before they are merged.
+static constexpr size_t MERGE_BUCKETS_FLUSH_ROWS = 256 * 1024;
+
 /// The minimum reduction factor (input rows divided by output rows) to grow hash tables
 /// in a streaming preaggregation, given that the hash tables are currently the given
 /// size or above. The sizes roughly correspond to hash table sizes where the bucket
@@ -76,6 +84,9 @@ Status AggSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& info) {
 
     _memory_usage_container = ADD_COUNTER(profile(), "MemoryUsageContainer", TUnit::BYTES);
     _memory_usage_arena = ADD_COUNTER(profile(), "MemoryUsageArena", TUnit::BYTES);
+    _merge_buckets_counter = ADD_COUNTER(profile(), "MergeBuckets", TUnit::UNIT);
+    _merge_buckets_flush_timer = ADD_TIMER(profile(), "MergeBucketsFlushTime");
+    _dict_code_hit_rows_counter = ADD_COUNTER(profile(), "DictCodeHitRows", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -112,25 +123,8 @@ Status AggSinkLocalState::open(RuntimeState* state) {
     } else {
         RETURN_IF_ERROR(_init_hash_method(Base::_shared_state->probe_expr_ctxs));
 
-        std::visit(vectorized::Overload {[&](std::monostate& arg) {
-                                             throw doris::Exception(ErrorCode::INTERNAL_ERROR,
-                                                                    "uninited hash table");
-                                         },
-                                         [&](auto& agg_method) {
-                                             using HashTableType =
-                                                     std::decay_t<decltype(agg_method)>;
-                                             using KeyType = typename HashTableType::Key;
-
-                                             /// some aggregate functions (like AVG for decimal) have align issues.
-                                             Base::_shared_state->aggregate_data_container =
-                                                     std::make_unique<AggregateDataContainer>(
-                                                             sizeof(KeyType),
-                                                             ((p._total_size_of_aggregate_states +
-                                                               p._align_aggregate_states - 1) /
-                                                              p._align_aggregate_states) *
-                                                                     p._align_aggregate_states);
-                                         }},
-                   _agg_data->method_variant);
+        Base::_shared_state->aggregate_data_container =
+                _create_aggregate_data_container(*_agg_data);
         if (p._is_merge) {
             _executor = std::make_unique<Executor<false, true>>();
         } else {
@@ -140,6 +134,10 @@ Status AggSinkLocalState::open(RuntimeState* state) {
         _should_limit_output = p._limit != -1 &&       // has limit
                                (!p._have_conjuncts) && // no having conjunct
                                !Base::_shared_state->enable_spill;
+        _can_use_merge_buckets = _need_split_into_merge_buckets();
+        _can_use_dict_codes = config::enable_dict_code_aggregation && !p._is_merge &&
+                              Base::_shared_state->probe_expr_ctxs.size() == 1 &&
+                              p._limit == -1 && !Base::_shared_state->enable_spill;
     }
     for (auto& evaluator : p._aggregate_evaluators) {
         Base::_shared_state->aggregate_evaluators.push_back(evaluator->clone(state, p._pool));
@@ -158,6 +156,28 @@ Status AggSinkLocalState::open(RuntimeState* state) {
     return Status::OK();
 }
 
+std::unique_ptr<AggregateDataContainer> AggSinkLocalState::_create_aggregate_data_container(
+        AggregatedDataVariants& agg_data) const {
+    auto& p = Base::_parent->template cast<AggSinkOperatorX>();
+    return std::visit(
+            vectorized::Overload {
+                    [&](std::monostate& arg) -> std::unique_ptr<AggregateDataContainer> {
+                        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
+                    },
+                    [&](auto& agg_method) -> std::unique_ptr<AggregateDataContainer> {
+                        using HashTableType = std::decay_t<decltype(agg_method)>;
+                        using KeyType = typename HashTableType::Key;
+
+                        /// some aggregate functions (like AVG for decimal) have align issues.
+                        return std::make_unique<AggregateDataContainer>(
+                                sizeof(KeyType), ((p._total_size_of_aggregate_states +
+                                                   p._align_aggregate_states - 1) /
+                                                  p._align_aggregate_states) *
+                                                         p._align_aggregate_states);
+                    }},
+            agg_data.method_variant);
+}
+
 Status AggSinkLocalState::_create_agg_status(vectorized::AggregateDataPtr data) {
     auto& shared_state = *Base::_shared_state;
     for (int i = 0; i < shared_state.aggregate_evaluators.size(); ++i) {
@@ -237,6 +257,10 @@ void AggSinkLocalState::_update_memusage_with_serialized_key() {
                            int64_t memory_usage_container =
                                    _shared_state->aggregate_data_container->memory_usage();
                            int64_t hash_table_memory_usage = data.get_buffer_size_in_bytes();
+                           for (const auto& bucket : _shared_state->merge_buckets) {
+                               hash_table_memory_usage +=
+                                       static_cast<int64_t>(bucket.memory_usage());
+                           }
 
                            COUNTER_SET(_memory_usage_arena, memory_usage_arena);
                            COUNTER_SET(_memory_usage_container, memory_usage_container);
@@ -498,7 +522,11 @@ Status AggSinkLocalState::_execute_with_serialized_key_helper(vectorized::Block*
                 RETURN_IF_ERROR(do_aggregate_evaluators());
             }
         } else {
-            _emplace_into_hash_table(_places.data(), key_columns, rows);
+            if (_can_use_dict_codes) {
+                _emplace_with_dict_codes(_places.data(), block, key_columns, rows);
+            } else {
+                _emplace_into_hash_table(_places.data(), key_columns, rows);
+            }
             RETURN_IF_ERROR(do_aggregate_evaluators());
 
             if (_should_limit_output && !Base::_shared_state->enable_spill) {
@@ -520,10 +548,15 @@ Status AggSinkLocalState::_execute_with_serialized_key_helper(vectorized::Block*
 }
 
 size_t AggSinkLocalState::_get_hash_table_size() const {
-    return std::visit(
+    size_t size = std::visit(
             vectorized::Overload {[&](std::monostate& arg) -> size_t { return 0; },
                                   [&](auto& agg_method) { return agg_method.hash_table->size(); }},
             _agg_data->method_variant);
+    const auto& merge_buckets = Base::_shared_state->merge_buckets;
+    for (size_t i = Base::_shared_state->next_merge_bucket_idx; i < merge_buckets.size(); ++i) {
+        size += merge_buckets[i].size();
+    }
+    return size;
 }
 
 void AggSinkLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* places,
@@ -576,6 +609,26 @@ void AggSinkLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* p
                _agg_data->method_variant);
 }
 
+void AggSinkLocalState::_emplace_with_dict_codes(vectorized::AggregateDataPtr* places,
+                                                 vectorized::Block* block,
+                                                 vectorized::ColumnRawPtrs& key_columns,
+                                                 size_t num_rows) {
+    const auto* codes = block->get_dict_codes(key_columns[0]);
+    if (codes == nullptr) {
+        _emplace_into_hash_table(places, key_columns, num_rows);
+        return;
+    }
+    auto hit_rows = _dict_code_places.find_or_emplace(
+            *codes, *key_columns[0], places, num_rows,
+            [&](vectorized::IColumn& miss_keys, vectorized::AggregateDataPtr* miss_places,
+                size_t num_misses) {
+                vectorized::ColumnRawPtrs miss_key_columns {&miss_keys};
+                _emplace_into_hash_table(miss_places, miss_key_columns, num_misses);
+            });
+    COUNTER_UPDATE(_dict_code_hit_rows_counter, hit_rows);
+    COUNTER_UPDATE(_hash_table_input_counter, hit_rows);
+}
+
 bool AggSinkLocalState::_emplace_into_hash_table_limit(vectorized::AggregateDataPtr* places,
                                                        vectorized::Block* block,
                                                        const std::vector<int>& key_locs,
@@ -697,6 +750,290 @@ Status AggSinkLocalState::_init_hash_method(const vectorized::VExprContextSPtrs&
     return Status::OK();
 }
 
+bool AggSinkLocalState::_need_split_into_merge_buckets() const {
+    auto& p = Base::_parent->template cast<AggSinkOperatorX>();
+    if (config::agg_parallel_merge_min_groups <= 0 || config::agg_parallel_merge_buckets <= 1 ||
+        !p._needs_finalize || p._limit != -1 || p._do_sort_limit ||
+        Base::_shared_state->enable_spill) {
+        return false;
+    }
+    // The buckets are merged by other threads, only the merge of states is thread safe.
+    return std::all_of(p._aggregate_evaluators.begin(), p._aggregate_evaluators.end(),
+                       [](const auto* evaluator) { return evaluator->is_merge(); });
+}
+
+Status AggSinkLocalState::_split_into_merge_buckets(RuntimeState* state) {
+    auto& p = Base::_parent->template cast<AggSinkOperatorX>();
+    auto& shared_state = *Base::_shared_state;
+    const auto num_buckets = static_cast<size_t>(config::agg_parallel_merge_buckets);
+    DCHECK(shared_state.merge_buckets.empty());
+
+    auto data_types = get_data_types(shared_state.probe_expr_ctxs);
+    shared_state.merge_buckets.resize(num_buckets);
+    for (auto& bucket : shared_state.merge_buckets) {
+        bucket.agg_data = std::make_unique<AggregatedDataVariants>();
+        RETURN_IF_ERROR(init_hash_method<AggregatedDataVariants>(bucket.agg_data.get(),
+                                                                 data_types, p._is_first_phase));
+        bucket.aggregate_data_container = _create_aggregate_data_container(*bucket.agg_data);
+        bucket.agg_arena_pool = std::make_unique<vectorized::Arena>();
+    }
+    _merge_bucket_buffers.resize(num_buckets);
+    _merge_bucket_selectors.resize(num_buckets);
+    COUNTER_SET(_merge_buckets_counter, static_cast<int64_t>(num_buckets));
+
+    // Move the groups merged so far to the buckets, as keys and serialized states.
+    const size_t key_size = shared_state.probe_expr_ctxs.size();
+    const size_t agg_size = shared_state.aggregate_evaluators.size();
+    vectorized::MutableColumns columns;
+    for (size_t i = 0; i < key_size; ++i) {
+        columns.emplace_back(shared_state.probe_expr_ctxs[i]->root()->data_type()->create_column());
+    }
+    for (size_t i = 0; i < agg_size; ++i) {
+        columns.emplace_back(
+                shared_state.aggregate_evaluators[i]->function()->create_serialize_column());
+    }
+    size_t num_rows = std::visit(
+            vectorized::Overload {
+                    [&](std::monostate& arg) -> size_t {
+                        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
+                    },
+                    [&](auto& agg_method) -> size_t {
+                        auto& data = *agg_method.hash_table;
+                        using KeyType = std::decay_t<decltype(agg_method)>::Key;
+                        std::vector<KeyType> keys(data.size());
+                        if (shared_state.values.size() < data.size()) {
+                            shared_state.values.resize(data.size());
+                        }
+
+                        size_t rows = 0;
+                        auto& container = *shared_state.aggregate_data_container;
+                        for (auto iter = container.begin(); iter != container.end(); ++iter) {
+                            keys[rows] = iter.template get_key<KeyType>();
+                            shared_state.values[rows] = iter.get_aggregate_data();
+                            ++rows;
+                        }
+                        vectorized::MutableColumns key_columns(key_size);
+                        for (size_t i = 0; i < key_size; ++i) {
+                            key_columns[i] = std::move(columns[i]);
+                        }
+                        agg_method.insert_keys_into_columns(keys, key_columns, rows);
+                        if (data.has_null_key_data()) {
+                            DCHECK(key_columns.size() == 1);
+                            key_columns[0]->insert_data(nullptr, 0);
+                            shared_state.values[rows++] =
+                                    data.template get_null_key_data<vectorized::AggregateDataPtr>();
+                        }
+                        for (size_t i = 0; i < key_size; ++i) {
+                            columns[i] = std::move(key_columns[i]);
+                        }
+                        return rows;
+                    }},
+            _agg_data->method_variant);
+    for (size_t i = 0; i < agg_size; ++i) {
+        shared_state.aggregate_evaluators[i]->function()->serialize_to_column(
+                shared_state.values, shared_state.offsets_of_aggregate_states[i],
+                columns[key_size + i], num_rows);
+    }
+    RETURN_IF_ERROR(shared_state.reset_hash_table());
+    _agg_arena_pool = shared_state.agg_arena_pool.get();
+
+    vectorized::ColumnRawPtrs raw_columns(columns.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+        raw_columns[i] = columns[i].get();
+    }
+    _scatter_to_merge_buckets(raw_columns, key_size, num_rows);
+    return _flush_merge_buckets(state);
+}
+
+Status AggSinkLocalState::_append_to_merge_buckets(RuntimeState* state, vectorized::Block* block) {
+    SCOPED_TIMER(_merge_timer);
+    auto& shared_state = *Base::_shared_state;
+    const size_t key_size = shared_state.probe_expr_ctxs.size();
+    const size_t agg_size = shared_state.aggregate_evaluators.size();
+    vectorized::Columns columns(key_size + agg_size);
+    for (size_t i = 0; i < key_size; ++i) {
+        int result_column_id = -1;
+        RETURN_IF_ERROR(shared_state.probe_expr_ctxs[i]->execute(block, &result_column_id));
+        columns[i] = block->get_by_position(result_column_id)
+                             .column->convert_to_full_column_if_const();
+    }
+    for (size_t i = 0; i < agg_size; ++i) {
+        int col_id = AggSharedState::get_slot_column_id(shared_state.aggregate_evaluators[i]);
+        auto column = block->get_by_position(col_id).column->convert_to_full_column_if_const();
+        if (column->is_nullable()) {
+            column = assert_cast<const vectorized::ColumnNullable&>(*column)
+                             .get_nested_column_ptr();
+        }
+        columns[key_size + i] = std::move(column);
+    }
+
+    vectorized::ColumnRawPtrs raw_columns(columns.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+        raw_columns[i] = columns[i].get();
+    }
+    _scatter_to_merge_buckets(raw_columns, key_size, block->rows());
+    if (_merge_bucket_buffered_rows >= MERGE_BUCKETS_FLUSH_ROWS) {
+        RETURN_IF_ERROR(_flush_merge_buckets(state));
+    }
+    return Status::OK();
+}
+
+void AggSinkLocalState::_scatter_to_merge_buckets(const vectorized::ColumnRawPtrs& columns,
+                                                  size_t key_size, size_t rows) {
+    _merge_bucket_hashes.assign(rows, 0);
+    for (size_t i = 0; i < key_size; ++i) {
+        columns[i]->update_hashes_with_value(_merge_bucket_hashes.data());
+    }
+    const auto num_buckets = _merge_bucket_selectors.size();
+    for (auto& selector : _merge_bucket_selectors) {
+        selector.clear();
+    }
+    // The low bits may have been used by the shuffle which sent the rows to this instance.
+    for (size_t i = 0; i < rows; ++i) {
+        _merge_bucket_selectors[(_merge_bucket_hashes[i] >> 32) % num_buckets].push_back(i);
+    }
+
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        const auto& selector = _merge_bucket_selectors[bucket];
+        if (selector.empty()) {
+            continue;
+        }
+        auto& buffer_columns = _merge_bucket_buffers[bucket].columns;
+        if (buffer_columns.empty()) {
+            for (const auto* column : columns) {
+                buffer_columns.emplace_back(column->clone_empty());
+            }
+        }
+        for (size_t i = 0; i < columns.size(); ++i) {
+            columns[i]->append_data_by_selector(buffer_columns[i], selector);
+        }
+    }
+    _merge_bucket_buffered_rows += rows;
+}
+
+Status AggSinkLocalState::_flush_merge_buckets(RuntimeState* state) {
+    if (_merge_bucket_buffered_rows == 0) {
+        return Status::OK();
+    }
+    SCOPED_TIMER(_merge_buckets_flush_timer);
+    const auto num_buckets = _merge_bucket_buffers.size();
+    std::vector<Status> statuses(num_buckets);
+    auto* fragment_mgr = ExecEnv::GetInstance()->fragment_mgr();
+    auto* thread_pool = fragment_mgr == nullptr ? nullptr : fragment_mgr->get_thread_pool();
+    CountDownLatch latch(static_cast<int>(num_buckets - 1));
+    for (size_t i = 1; i < num_buckets; ++i) {
+        auto st = Status::OK();
+        if (thread_pool != nullptr) {
+            st = thread_pool->submit_func([&, i]() {
+                SCOPED_ATTACH_TASK(state);
+                statuses[i] = _merge_into_bucket(i);
+                latch.count_down();
+            });
+        }
+        if (thread_pool == nullptr || !st.ok()) {
+            // merge it in the current thread
+            statuses[i] = _merge_into_bucket(i);
+            latch.count_down();
+        }
+    }
+    statuses[0] = _merge_into_bucket(0);
+    latch.wait();
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+
+    COUNTER_UPDATE(_hash_table_input_counter, static_cast<int64_t>(_merge_bucket_buffered_rows));
+    for (auto& buffer : _merge_bucket_buffers) {
+        for (auto& column : buffer.columns) {
+            column->clear();
+        }
+    }
+    _merge_bucket_buffered_rows = 0;
+    return Status::OK();
+}
+
+Status AggSinkLocalState::_merge_into_bucket(size_t bucket_idx) {
+    auto& buffer = _merge_bucket_buffers[bucket_idx];
+    auto& bucket = Base::_shared_state->merge_buckets[bucket_idx];
+    if (buffer.columns.empty() || buffer.columns[0]->empty()) {
+        return Status::OK();
+    }
+    auto& shared_state = *Base::_shared_state;
+    const size_t key_size = shared_state.probe_expr_ctxs.size();
+    const size_t rows = buffer.columns[0]->size();
+    vectorized::ColumnRawPtrs key_columns(key_size);
+    for (size_t i = 0; i < key_size; ++i) {
+        key_columns[i] = buffer.columns[i].get();
+    }
+    if (buffer.places.size() < rows) {
+        buffer.places.resize(rows);
+    }
+
+    RETURN_IF_CATCH_EXCEPTION(std::visit(
+            vectorized::Overload {
+                    [&](std::monostate& arg) -> void {
+                        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
+                    },
+                    [&](auto& agg_method) -> void {
+                        using HashMethodType = std::decay_t<decltype(agg_method)>;
+                        using AggState = typename HashMethodType::State;
+                        AggState agg_state(key_columns);
+                        agg_method.init_serialized_keys(key_columns, rows);
+
+                        auto creator = [&](const auto& ctor, auto& key, auto& origin) {
+                            HashMethodType::try_presis_key_and_origin(key, origin,
+                                                                      *bucket.agg_arena_pool);
+                            auto mapped = bucket.aggregate_data_container->append_data(origin);
+                            auto st = _create_agg_status(mapped);
+                            if (!st) {
+                                throw Exception(st.code(), st.to_string());
+                            }
+                            ctor(key, mapped);
+                        };
+
+                        auto creator_for_null_key = [&](auto& mapped) {
+                            mapped = bucket.agg_arena_pool->aligned_alloc(
+                                    shared_state.total_size_of_aggregate_states,
+                                    shared_state.align_aggregate_states);
+                            auto st = _create_agg_status(mapped);
+                            if (!st) {
+                                throw Exception(st.code(), st.to_string());
+                            }
+                        };
+
+                        for (size_t i = 0; i < rows; ++i) {
+                            buffer.places[i] = *agg_method.lazy_emplace(agg_state, i, creator,
+                                                                        creator_for_null_key);
+                        }
+                    }},
+            bucket.agg_data->method_variant));
+
+    for (size_t i = 0; i < shared_state.aggregate_evaluators.size(); ++i) {
+        const auto* function = shared_state.aggregate_evaluators[i]->function().get();
+        size_t buffer_size = function->size_of_data() * rows;
+        if (buffer.deserialize_buffer.size() < buffer_size) {
+            buffer.deserialize_buffer.resize(buffer_size);
+        }
+        RETURN_IF_CATCH_EXCEPTION(function->deserialize_and_merge_vec(
+                buffer.places.data(), shared_state.offsets_of_aggregate_states[i],
+                buffer.deserialize_buffer.data(), buffer.columns[key_size + i].get(),
+                bucket.agg_arena_pool.get(), rows));
+    }
+    return Status::OK();
+}
+
+Status AggSinkLocalState::_finish_merge_buckets(RuntimeState* state) {
+    RETURN_IF_ERROR(_flush_merge_buckets(state));
+    _merge_bucket_buffers.clear();
+    _merge_bucket_selectors.clear();
+    _merge_bucket_hashes.clear();
+    // The source outputs the buckets one by one, starting with the first one.
+    Base::_shared_state->next_merge_bucket();
+    _agg_data = Base::_shared_state->agg_data.get();
+    _agg_arena_pool = Base::_shared_state->agg_arena_pool.get();
+    return Status::OK();
+}
+
 size_t AggSinkLocalState::get_reserve_mem_size(RuntimeState* state, bool eos) const {
     size_t size_to_reserve = std::visit(
             [&](auto&& arg) -> size_t {
@@ -867,12 +1204,24 @@ Status AggSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block* in_
     COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
     local_state._shared_state->input_num_rows += in_block->rows();
     if (in_block->rows() > 0) {
-        RETURN_IF_ERROR(local_state._executor->execute(&local_state, in_block));
+        if (!local_state._shared_state->merge_buckets.empty()) {
+            RETURN_IF_ERROR(local_state._append_to_merge_buckets(state, in_block));
+        } else {
+            RETURN_IF_ERROR(local_state._executor->execute(&local_state, in_block));
+            if (local_state._can_use_merge_buckets &&
+                local_state._get_hash_table_size() >=
+                        static_cast<size_t>(config::agg_parallel_merge_min_groups)) {
+                RETURN_IF_ERROR(local_state._split_into_merge_buckets(state));
+            }
+        }
         local_state._executor->update_memusage(&local_state);
         COUNTER_SET(local_state._hash_table_size_counter,
                     (int64_t)local_state._get_hash_table_size());
     }
     if (eos) {
+        if (!local_state._shared_state->merge_buckets.empty()) {
+            RETURN_IF_ERROR(local_state._finish_merge_buckets(state));
+        }
         local_state._dependency->set_ready_to_read();
     }
     return Status::OK();
@@ -887,11 +1236,17 @@ Status AggSinkOperatorX::reset_hash_table(RuntimeState* state) {
     auto& local_state = get_local_state(state);
     auto& ss = *local_state.Base::_shared_state;
     RETURN_IF_ERROR(ss.reset_hash_table());
+    local_state._dict_code_places.reset();
     local_state._agg_arena_pool = ss.agg_arena_pool.get();
     local_state._serialize_key_arena_memory_usage->set((int64_t)0);
     return Status::OK();
 }
 
+Status AggSinkOperatorX::merge_spilled_block(RuntimeState* state, vectorized::Block* block) {
+    auto& local_state = get_local_state(state);
+    return local_state._merge_with_serialized_key_helper<false, true>(block);
+}
+
 size_t AggSinkOperatorX::get_reserve_mem_size(RuntimeState* state, bool eos) {
     auto& local_state = get_local_state(state);
     return local_state.get_reserve_mem_size(state, eos);
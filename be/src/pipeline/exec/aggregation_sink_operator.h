@@ -85,6 +85,8 @@ protected:
                              vectorized::ColumnRawPtrs& key_columns, size_t num_rows);
     void _emplace_into_hash_table(vectorized::AggregateDataPtr* places,
                                   vectorized::ColumnRawPtrs& key_columns, size_t num_rows);
+    void _emplace_with_dict_codes(vectorized::AggregateDataPtr* places, vectorized::Block* block,
+                                  vectorized::ColumnRawPtrs& key_columns, size_t num_rows);
     bool _emplace_into_hash_table_limit(vectorized::AggregateDataPtr* places,
                                         vectorized::Block* block, const std::vector<int>& key_locs,
                                         vectorized::ColumnRawPtrs& key_columns, size_t num_rows);
@@ -96,6 +98,19 @@ protected:
     Status _destroy_agg_status(vectorized::AggregateDataPtr data);
     Status _create_agg_status(vectorized::AggregateDataPtr data);
     size_t _memory_usage() const;
+    std::unique_ptr<AggregateDataContainer> _create_aggregate_data_container(
+            AggregatedDataVariants& agg_data) const;
+
+    // A final merge with many groups splits them into merge buckets by the high bits of the key
+    // hash. The rows of every bucket are buffered, and the buffers are merged in parallel.
+    bool _need_split_into_merge_buckets() const;
+    Status _split_into_merge_buckets(RuntimeState* state);
+    Status _append_to_merge_buckets(RuntimeState* state, vectorized::Block* block);
+    void _scatter_to_merge_buckets(const vectorized::ColumnRawPtrs& columns, size_t key_size,
+                                   size_t rows);
+    Status _flush_merge_buckets(RuntimeState* state);
+    Status _merge_into_bucket(size_t bucket_idx);
+    Status _finish_merge_buckets(RuntimeState* state);
 
     size_t get_reserve_mem_size(RuntimeState* state, bool eos) const;
 
@@ -112,8 +127,16 @@ protected:
     RuntimeProfile::Counter* _serialize_key_arena_memory_usage = nullptr;
     RuntimeProfile::Counter* _memory_usage_container = nullptr;
     RuntimeProfile::Counter* _memory_usage_arena = nullptr;
+    RuntimeProfile::Counter* _merge_buckets_counter = nullptr;
+    RuntimeProfile::Counter* _merge_buckets_flush_timer = nullptr;
+    RuntimeProfile::Counter* _dict_code_hit_rows_counter = nullptr;
 
     bool _should_limit_output = false;
+    bool _can_use_merge_buckets = false;
+    // A single string key of a block with dictionary codes finds its states by code, see
+    // config::enable_dict_code_aggregation.
+    bool _can_use_dict_codes = false;
+    AggDictCodePlaces _dict_code_places;
 
     vectorized::PODArray<vectorized::AggregateDataPtr> _places;
     std::vector<char> _deserialize_buffer;
@@ -127,6 +150,17 @@ protected:
     std::unique_ptr<ExecutorBase> _executor = nullptr;
 
     int64_t _memory_usage_last_executing = 0;
+
+    struct MergeBucketBuffer {
+        // the key columns, then the serialized aggregate states
+        vectorized::MutableColumns columns;
+        vectorized::PODArray<vectorized::AggregateDataPtr> places;
+        std::vector<char> deserialize_buffer;
+    };
+    std::vector<MergeBucketBuffer> _merge_bucket_buffers;
+    size_t _merge_bucket_buffered_rows = 0;
+    std::vector<uint64_t> _merge_bucket_hashes;
+    std::vector<vectorized::IColumn::Selector> _merge_bucket_selectors;
 };
 
 class AggSinkOperatorX MOCK_REMOVE(final) : public DataSinkOperatorX<AggSinkLocalState> {
@@ -162,7 +196,8 @@ public:
         }
         return _is_colocate && _require_bucket_distribution && !_followed_by_shuffled_operator
                        ? DataDistribution(ExchangeType::BUCKET_HASH_SHUFFLE, _partition_exprs)
-                       : DataDistribution(ExchangeType::HASH_SHUFFLE, _partition_exprs);
+                       : DataDistribution(ExchangeType::HASH_SHUFFLE, _partition_exprs)
+                                 .set_allow_key_split(!_needs_finalize);
     }
     bool require_data_distribution() const override { return _is_colocate; }
     size_t get_revocable_mem_size(RuntimeState* state) const;
@@ -174,6 +209,9 @@ public:
 
     Status reset_hash_table(RuntimeState* state);
 
+    // merges a block of keys and serialized agg states in the spill layout into the hash table
+    Status merge_spilled_block(RuntimeState* state, vectorized::Block* block);
+
     size_t get_reserve_mem_size(RuntimeState* state, bool eos) override;
 
     using DataSinkOperatorX<AggSinkLocalState>::node_id;
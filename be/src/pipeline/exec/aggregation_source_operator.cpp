@@ -315,6 +315,12 @@ Status AggLocalState::_get_with_serialized_key_result(RuntimeState* state, vecto
                     }},
             shared_state.agg_data->method_variant);
 
+    // The groups of each merge bucket are output after the ones of the previous bucket.
+    if (*eos && shared_state.has_next_merge_bucket()) {
+        shared_state.next_merge_bucket();
+        *eos = false;
+    }
+
     if (!mem_reuse) {
         *block = columns_with_schema;
         vectorized::MutableColumns columns(block->columns());
@@ -20,12 +20,14 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <string>
 
 #include "pipeline/exec/operator.h"
 #include "runtime/runtime_state.h"
+#include "util/simd/bits.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 
 namespace doris::pipeline {
@@ -114,6 +116,9 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
     _offsets_of_aggregate_states.resize(_agg_functions_size);
     _result_column_nullable_flags.resize(_agg_functions_size);
     _result_column_could_resize.resize(_agg_functions_size);
+    _sliding_modes.resize(_agg_functions_size);
+    _sliding_deques.resize(_agg_functions_size);
+    _sliding_not_null_rows.resize(_agg_functions_size);
 
     for (int i = 0; i < _agg_functions_size; ++i) {
         _agg_functions[i] = p._agg_functions[i]->clone(state, state->obj_pool());
@@ -132,6 +137,16 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
         if (PARTITION_FUNCTION_SET.contains(_agg_functions[i]->function()->get_name())) {
             _streaming_mode = false;
         }
+        const auto& function_name = _agg_functions[i]->function()->get_name();
+        if (_agg_functions[i]->function()->supports_remove()) {
+            _sliding_modes[i] = SlidingMode::REMOVE;
+        } else if (_agg_input_columns[i].size() == 1 && function_name == "min") {
+            _sliding_modes[i] = SlidingMode::MIN;
+        } else if (_agg_input_columns[i].size() == 1 && function_name == "max") {
+            _sliding_modes[i] = SlidingMode::MAX;
+        } else {
+            _sliding_modes[i] = SlidingMode::RECOMPUTE;
+        }
     }
 
     _partition_exprs_size = p._partition_by_eq_expr_ctxs.size();
@@ -185,8 +200,6 @@ Status AnalyticSinkLocalState::close(RuntimeState* state, Status exec_status) {
     return PipelineXSinkLocalState<AnalyticSharedState>::close(state, exec_status);
 }
 
-//TODO: eg sum/avg/count/min/max ROWS BETWEEN N PRECEDING AND M FOLLOWING
-//maybe could be optimized caculate at cumulative mode
 bool AnalyticSinkLocalState::_get_next_for_sliding_rows(int64_t current_block_rows,
                                                         int64_t current_block_base_pos) {
     const bool is_n_following_frame = _rows_end_offset > 0;
@@ -199,13 +212,7 @@ bool AnalyticSinkLocalState::_get_next_for_sliding_rows(int64_t current_block_ro
             _need_more_data = true;
             break;
         }
-        _reset_agg_status();
-
-        // Eg: rows between unbounded preceding and 10 preceding
-        // Make sure range_start <= range_end
-        current_row_start = std::min(current_row_start, current_row_end);
-        _execute_for_function(_partition_by_pose.start, _partition_by_pose.end, current_row_start,
-                              current_row_end);
+        _execute_for_sliding_frame(current_row_start, current_row_end);
         int64_t pos = current_pos_in_block();
         _insert_result_info(pos, pos + 1);
         _current_row_position++;
@@ -300,7 +307,6 @@ bool AnalyticSinkLocalState::_get_next_for_unbounded_range(int64_t current_block
 bool AnalyticSinkLocalState::_get_next_for_range_between(int64_t current_block_rows,
                                                          int64_t current_block_base_pos) {
     while (_current_row_position < _partition_by_pose.end) {
-        _reset_agg_status();
         if (!_parent->cast<AnalyticSinkOperatorX>()._window.__isset.window_start) {
             _order_by_pose.start = _partition_by_pose.start;
         } else {
@@ -316,8 +322,7 @@ bool AnalyticSinkLocalState::_get_next_for_range_between(int64_t current_block_r
                     _range_result_columns[1].get(), _order_by_columns[0].get(),
                     _current_row_position, _order_by_pose.end, _partition_by_pose.end);
         }
-        _execute_for_function(_partition_by_pose.start, _partition_by_pose.end,
-                              _order_by_pose.start, _order_by_pose.end);
+        _execute_for_sliding_frame(_order_by_pose.start, _order_by_pose.end);
         int64_t pos = current_pos_in_block();
         _insert_result_info(pos, pos + 1);
         _current_row_position++;
@@ -384,6 +389,132 @@ void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int6
     }
 }
 
+void AnalyticSinkLocalState::_execute_for_sliding_frame(int64_t frame_start, int64_t frame_end) {
+    // here is the core function, should not add timer
+    // Eg: rows between unbounded preceding and 10 preceding
+    // Make sure range_start <= range_end
+    frame_end = std::clamp(frame_end, _partition_by_pose.start, _partition_by_pose.end);
+    frame_start = std::clamp(frame_start, _partition_by_pose.start, frame_end);
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        if (_result_column_nullable_flags[i] && _current_window_empty) {
+            continue;
+        }
+        std::vector<const vectorized::IColumn*> agg_columns;
+        for (int j = 0; j < _agg_input_columns[i].size(); ++j) {
+            agg_columns.push_back(_agg_input_columns[i][j].get());
+        }
+        auto* place = _fn_place_ptr + _offsets_of_aggregate_states[i];
+        switch (_sliding_modes[i]) {
+        case SlidingMode::RECOMPUTE:
+            _agg_functions[i]->reset(place);
+            _agg_functions[i]->function()->add_range_single_place(
+                    _partition_by_pose.start, _partition_by_pose.end, frame_start, frame_end, place,
+                    agg_columns.data(), _agg_arena_pool.get());
+            break;
+        case SlidingMode::REMOVE:
+            _slide_removable_function(i, agg_columns.data(), frame_start, frame_end);
+            break;
+        case SlidingMode::MIN:
+            _slide_min_max_function<true>(i, agg_columns.data(), frame_start, frame_end);
+            break;
+        case SlidingMode::MAX:
+            _slide_min_max_function<false>(i, agg_columns.data(), frame_start, frame_end);
+            break;
+        }
+    }
+    _sliding_frame_start = frame_start;
+    _sliding_frame_end = frame_end;
+}
+
+void AnalyticSinkLocalState::_slide_removable_function(size_t i,
+                                                       const vectorized::IColumn** columns,
+                                                       int64_t frame_start, int64_t frame_end) {
+    auto* place = _fn_place_ptr + _offsets_of_aggregate_states[i];
+    const auto& function = _agg_functions[i]->function();
+    // The new rows start where the previous frame ended, unless the frames do not overlap.
+    int64_t add_start = _sliding_frame_end;
+    if (frame_start >= _sliding_frame_end) {
+        _agg_functions[i]->reset(place);
+        _sliding_not_null_rows[i] = 0;
+        add_start = frame_start;
+    } else if (_sliding_frame_start < frame_start) {
+        function->remove_range_single_place(_sliding_frame_start, frame_start, place, columns,
+                                            _agg_arena_pool.get());
+        _sliding_not_null_rows[i] -= _count_not_null_rows(i, _sliding_frame_start, frame_start);
+    }
+    if (add_start < frame_end) {
+        function->add_range_single_place(_partition_by_pose.start, _partition_by_pose.end,
+                                         add_start, frame_end, place, columns,
+                                         _agg_arena_pool.get());
+        _sliding_not_null_rows[i] += _count_not_null_rows(i, add_start, frame_end);
+    }
+    // A nullable function keeps its not null flag after the removal, so it is reset to get
+    // the null result of a frame without any not null row.
+    if (_sliding_not_null_rows[i] == 0) {
+        _agg_functions[i]->reset(place);
+    }
+}
+
+template <bool is_min>
+void AnalyticSinkLocalState::_slide_min_max_function(size_t i,
+                                                     const vectorized::IColumn** columns,
+                                                     int64_t frame_start, int64_t frame_end) {
+    auto& rows = _sliding_deques[i];
+    if (frame_start >= _sliding_frame_end) {
+        rows.clear();
+    }
+    const vectorized::IColumn* column = columns[0];
+    const vectorized::UInt8* null_map = nullptr;
+    if (column->is_nullable()) {
+        const auto& nullable_column = assert_cast<const vectorized::ColumnNullable&>(*column);
+        column = &nullable_column.get_nested_column();
+        null_map = nullable_column.get_null_map_data().data();
+    }
+    // The values of the rows in the deque are strictly increasing for min, and strictly
+    // decreasing for max, so a new row drops the rows at the back it is better than or equal to.
+    const int nan_direction_hint = is_min ? 1 : -1;
+    for (int64_t row = std::max(_sliding_frame_end, frame_start); row < frame_end; ++row) {
+        if (null_map != nullptr && null_map[row]) {
+            continue;
+        }
+        while (!rows.empty()) {
+            int cmp = column->compare_at(rows.back(), row, *column, nan_direction_hint);
+            if (is_min ? cmp < 0 : cmp > 0) {
+                break;
+            }
+            rows.pop_back();
+        }
+        rows.push_back(row);
+    }
+    while (!rows.empty() && rows.front() < frame_start) {
+        rows.pop_front();
+    }
+    auto* place = _fn_place_ptr + _offsets_of_aggregate_states[i];
+    _agg_functions[i]->reset(place);
+    if (!rows.empty()) {
+        _agg_functions[i]->function()->add(place, columns, rows.front(), _agg_arena_pool.get());
+    }
+}
+
+int64_t AnalyticSinkLocalState::_count_not_null_rows(size_t i, int64_t start, int64_t end) const {
+    if (_agg_input_columns[i].empty() || !_agg_input_columns[i][0]->is_nullable()) {
+        return end - start;
+    }
+    const auto& null_map =
+            assert_cast<const vectorized::ColumnNullable&>(*_agg_input_columns[i][0])
+                    .get_null_map_data();
+    return simd::count_zero_num(reinterpret_cast<const int8_t*>(null_map.data() + start),
+                                end - start);
+}
+
+void AnalyticSinkLocalState::_reset_sliding_frame() {
+    _sliding_frame_start = _partition_by_pose.start;
+    _sliding_frame_end = _partition_by_pose.start;
+    for (auto& rows : _sliding_deques) {
+        rows.clear();
+    }
+}
+
 void AnalyticSinkLocalState::_insert_result_info(int64_t start, int64_t end) {
     // here is the core function, should not add timer
     for (size_t i = 0; i < _agg_functions_size; ++i) {
@@ -465,6 +596,7 @@ void AnalyticSinkLocalState::_reset_state_for_next_partition() {
     _partition_by_pose.start = _partition_by_pose.end;
     _current_row_position = _partition_by_pose.start;
     _reset_agg_status();
+    _reset_sliding_frame();
 }
 
 void AnalyticSinkLocalState::_update_order_by_range() {
@@ -860,6 +992,20 @@ void AnalyticSinkLocalState::_remove_unused_rows() {
     _current_row_position -= remove_rows;
     _partition_by_pose.remove_unused_rows(remove_rows);
     _order_by_pose.remove_unused_rows(remove_rows);
+    _sliding_frame_start -= remove_rows;
+    _sliding_frame_end -= remove_rows;
+    if (_sliding_frame_start < 0) {
+        // the frame lost some of its rows, so the next frame is computed from scratch
+        _sliding_frame_start = _sliding_frame_end = 0;
+        for (auto& rows : _sliding_deques) {
+            rows.clear();
+        }
+    }
+    for (auto& rows : _sliding_deques) {
+        for (auto& row : rows) {
+            row -= remove_rows;
+        }
+    }
     int64_t candidate_partition_end_size = _next_partition_ends.size();
     while (--candidate_partition_end_size >= 0) {
         auto peek = _next_partition_ends.front();
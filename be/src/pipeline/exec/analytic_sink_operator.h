@@ -20,6 +20,8 @@
 
 #include <stdint.h>
 
+#include <deque>
+
 #include "operator.h"
 #include "pipeline/dependency.h"
 
@@ -90,6 +92,16 @@ private:
     void _init_result_columns();
     void _execute_for_function(int64_t partition_start, int64_t partition_end, int64_t frame_start,
                                int64_t frame_end);
+    // Moves the states from the previous frame to [frame_start, frame_end), both ends of the
+    // frames of a partition never go backwards.
+    void _execute_for_sliding_frame(int64_t frame_start, int64_t frame_end);
+    void _slide_removable_function(size_t i, const vectorized::IColumn** columns,
+                                   int64_t frame_start, int64_t frame_end);
+    template <bool is_min>
+    void _slide_min_max_function(size_t i, const vectorized::IColumn** columns,
+                                 int64_t frame_start, int64_t frame_end);
+    int64_t _count_not_null_rows(size_t i, int64_t start, int64_t end) const;
+    void _reset_sliding_frame();
     void _insert_result_info(int64_t start, int64_t end);
     int64_t current_pos_in_block() {
         return _current_row_position + _have_removed_rows -
@@ -138,6 +150,24 @@ private:
     std::vector<bool> _result_column_nullable_flags;
     std::vector<bool> _result_column_could_resize;
 
+    // How the state of a function follows a sliding frame.
+    enum class SlidingMode {
+        // reset the state and add all rows of the frame
+        RECOMPUTE,
+        // add the rows entering the frame and remove the rows leaving it
+        REMOVE,
+        // keep a monotonic deque of the rows of the frame, the front is the min or max
+        MIN,
+        MAX,
+    };
+    std::vector<SlidingMode> _sliding_modes;
+    std::vector<std::deque<int64_t>> _sliding_deques;
+    // the not null rows of the frame, for the REMOVE functions with a nullable argument
+    std::vector<int64_t> _sliding_not_null_rows;
+    // the frame [start, end) which the states of the sliding functions hold
+    int64_t _sliding_frame_start = 0;
+    int64_t _sliding_frame_end = 0;
+
     using vectorized_get_next = bool (AnalyticSinkLocalState::*)(int64_t, int64_t);
     struct executor {
         vectorized_get_next get_next_impl;
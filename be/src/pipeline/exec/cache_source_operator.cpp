@@ -42,9 +42,10 @@ Status CacheSourceLocalState::init(RuntimeState* state, LocalStateInfo& info) {
         return Status::InternalError("CacheSourceOperator only support one scan range, plan error");
     }
 
-    const auto& cache_param = _parent->cast<CacheSourceOperatorX>()._cache_param;
+    const auto& p = _parent->cast<CacheSourceOperatorX>();
+    const auto& cache_param = p._cache_param;
     // 1. init the slot orders
-    const auto& tuple_descs = _parent->cast<CacheSourceOperatorX>().row_desc().tuple_descriptors();
+    const auto& tuple_descs = p.row_desc().tuple_descriptors();
     for (auto tuple_desc : tuple_descs) {
         for (auto slot_desc : tuple_desc->slots()) {
             if (cache_param.output_slot_mapping.find(slot_desc->id()) !=
@@ -64,11 +65,15 @@ Status CacheSourceLocalState::init(RuntimeState* state, LocalStateInfo& info) {
             "CacheTabletId", std::to_string(scan_ranges[0].scan_range.palo_scan_range.tablet_id));
 
     // 3. lookup the cache and find proper slot order
-    hit_cache = _global_cache->lookup(_cache_key, _version, &_query_cache_handle);
+    RETURN_IF_ERROR(_global_cache->lookup_once(state->get_query_ctx(), scan_ranges, cache_param,
+                                               p._allow_incremental, &_query_cache_lookup));
+    hit_cache = _query_cache_lookup->hit;
+    _incremental = _query_cache_lookup->incremental;
     _runtime_profile->add_info_string("HitCache", std::to_string(hit_cache));
-    if (hit_cache && !cache_param.force_refresh_query_cache) {
-        _hit_cache_results = _query_cache_handle.get_cache_result();
-        auto hit_cache_slot_orders = _query_cache_handle.get_cache_slot_orders();
+    _runtime_profile->add_info_string("IncrementalHitCache", std::to_string(_incremental));
+    if (hit_cache || _incremental) {
+        _hit_cache_results = _query_cache_lookup->handle.get_cache_result();
+        auto hit_cache_slot_orders = _query_cache_lookup->handle.get_cache_slot_orders();
 
         if (_slot_orders != *hit_cache_slot_orders) {
             for (auto slot_id : _slot_orders) {
@@ -116,7 +121,32 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
     block->clear_column_data(_row_descriptor.num_materialized_slots());
     bool need_clone_empty = block->columns() == 0;
 
-    if (local_state._hit_cache_results == nullptr) {
+    if (local_state._hit_cache_results != nullptr &&
+        local_state._hit_cache_pos < local_state._hit_cache_results->size()) {
+        const auto& hit_cache_block =
+                local_state._hit_cache_results->at(local_state._hit_cache_pos++);
+        if (need_clone_empty) {
+            *block = hit_cache_block->clone_empty();
+        }
+        RETURN_IF_ERROR(
+                vectorized::MutableBlock::build_mutable_block(block).merge(*hit_cache_block));
+        if (!local_state._hit_cache_column_orders.empty()) {
+            auto datas = block->get_columns_with_type_and_name();
+            block->clear();
+            for (auto loc : local_state._hit_cache_column_orders) {
+                block->insert(datas[loc]);
+            }
+        }
+        if (local_state._incremental && local_state._need_insert_cache) {
+            // the refreshed entry starts with the cached blocks
+            auto cache_block = vectorized::Block::create_unique(block->clone_empty());
+            RETURN_IF_ERROR(vectorized::MutableBlock::build_mutable_block(cache_block.get())
+                                    .merge(*block));
+            local_state._current_query_cache_rows += cache_block->rows();
+            local_state._current_query_cache_bytes += cache_block->allocated_bytes();
+            local_state._local_cache_blocks.emplace_back(std::move(cache_block));
+        }
+    } else if (local_state._hit_cache_results == nullptr || local_state._incremental) {
         Defer insert_cache([&] {
             if (*eos) {
                 local_state._runtime_profile->add_info_string(
@@ -165,24 +195,7 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
             *block = std::move(*output_block);
         }
     } else {
-        if (local_state._hit_cache_pos < local_state._hit_cache_results->size()) {
-            const auto& hit_cache_block =
-                    local_state._hit_cache_results->at(local_state._hit_cache_pos++);
-            if (need_clone_empty) {
-                *block = hit_cache_block->clone_empty();
-            }
-            RETURN_IF_ERROR(
-                    vectorized::MutableBlock::build_mutable_block(block).merge(*hit_cache_block));
-            if (!local_state._hit_cache_column_orders.empty()) {
-                auto datas = block->get_columns_with_type_and_name();
-                block->clear();
-                for (auto loc : local_state._hit_cache_column_orders) {
-                    block->insert(datas[loc]);
-                }
-            }
-        } else {
-            *eos = true;
-        }
+        *eos = true;
     }
 
     local_state.reached_limit(block, eos);
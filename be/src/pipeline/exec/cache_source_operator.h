@@ -62,8 +62,10 @@ private:
     size_t _current_query_cache_rows = 0;
     bool _need_insert_cache = true;
 
-    QueryCacheHandle _query_cache_handle;
+    std::shared_ptr<QueryCacheLookup> _query_cache_lookup;
     std::vector<vectorized::BlockUPtr>* _hit_cache_results = nullptr;
+    // the cached blocks are followed by the result of the rowsets loaded after them
+    bool _incremental = false;
     std::vector<int> _hit_cache_column_orders;
     int _hit_cache_pos = 0;
 };
@@ -72,8 +74,10 @@ class CacheSourceOperatorX final : public OperatorX<CacheSourceLocalState> {
 public:
     using Base = OperatorX<CacheSourceLocalState>;
     CacheSourceOperatorX(ObjectPool* pool, int plan_node_id, int operator_id,
-                         const TQueryCacheParam& cache_param)
-            : Base(pool, plan_node_id, operator_id), _cache_param(cache_param) {
+                         const TQueryCacheParam& cache_param, bool allow_incremental)
+            : Base(pool, plan_node_id, operator_id),
+              _cache_param(cache_param),
+              _allow_incremental(allow_incremental) {
         _op_name = "CACHE_SOURCE_OPERATOR";
     };
 
@@ -94,6 +98,7 @@ public:
 
 private:
     TQueryCacheParam _cache_param;
+    bool _allow_incremental = false;
     bool _has_data(RuntimeState* state) const {
         auto& local_state = get_local_state(state);
         return local_state._shared_state->data_queue.remaining_has_data();
@@ -17,6 +17,9 @@
 
 #include "pipeline/exec/es_scan_operator.h"
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "exec/es/es_scan_reader.h"
 #include "exec/es/es_scroll_query.h"
 #include "vec/exec/scan/es_scanner.h"
@@ -86,16 +89,29 @@ Status EsScanLocalState::_init_scanners(std::list<vectorized::ScannerSPtr>* scan
             properties[ESScanReader::KEY_TERMINATE_AFTER] = std::to_string(p.limit());
         }
 
-        bool doc_value_mode = false;
-        properties[ESScanReader::KEY_QUERY] = ESScrollQueryBuilder::build(
-                properties, p._column_names, p._docvalue_context, &doc_value_mode);
-
-        std::shared_ptr<vectorized::EsScanner> scanner = vectorized::EsScanner::create_shared(
-                _state, this, p._limit, p._tuple_id, properties, p._docvalue_context,
-                doc_value_mode, _state->runtime_profile());
-
-        RETURN_IF_ERROR(scanner->prepare(_state, Base::_conjuncts));
-        scanners->push_back(scanner);
+        // split a shard into sliced scrolls read by parallel scanners, a limit pushed down is
+        // read with one search and a scan without a shard can not be sliced by shard
+        int num_slices = std::max(config::es_scroll_slices_per_shard, 1);
+        if (properties.contains(ESScanReader::KEY_TERMINATE_AFTER) ||
+            es_scan_range->shard_id < 0) {
+            num_slices = 1;
+        }
+        for (int slice_id = 0; slice_id < num_slices; ++slice_id) {
+            if (num_slices > 1) {
+                properties[ESScanReader::KEY_SLICE_ID] = std::to_string(slice_id);
+                properties[ESScanReader::KEY_SLICE_MAX] = std::to_string(num_slices);
+            }
+            bool doc_value_mode = false;
+            properties[ESScanReader::KEY_QUERY] = ESScrollQueryBuilder::build(
+                    properties, p._column_names, p._docvalue_context, &doc_value_mode);
+
+            std::shared_ptr<vectorized::EsScanner> scanner = vectorized::EsScanner::create_shared(
+                    _state, this, p._limit, p._tuple_id, properties, p._docvalue_context,
+                    doc_value_mode, _state->runtime_profile());
+
+            RETURN_IF_ERROR(scanner->prepare(_state, Base::_conjuncts));
+            scanners->push_back(scanner);
+        }
     }
 
     return Status::OK();
@@ -43,6 +43,7 @@
 #include "runtime/thread_context.h"
 #include "service/backend_options.h"
 #include "util/defer_op.h"
+#include "util/doris_metrics.h"
 #include "util/proto_util.h"
 #include "util/time.h"
 #include "vec/sink/vdata_stream_sender.h"
@@ -105,6 +106,9 @@ ExchangeSinkBuffer::ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_
                              state->query_options().exchange_multi_blocks_byte_size > 0) {
     if (_send_multi_blocks) {
         _send_multi_blocks_byte_size = state->query_options().exchange_multi_blocks_byte_size;
+    } else if (config::exchange_sink_coalesce_blocks_byte_size > 0) {
+        _send_multi_blocks = true;
+        _send_multi_blocks_byte_size = config::exchange_sink_coalesce_blocks_byte_size;
     }
 }
 
@@ -307,6 +311,8 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
         }
 
         instance_data.seq += requests.size();
+        _rpc_block_count += static_cast<int64_t>(requests.size());
+        _rpc_bytes += mem_byte;
         brpc_request->set_packet_seq(instance_data.seq);
         brpc_request->set_eos(requests.back().eos);
         auto send_callback = channel->get_send_callback(&instance_data, requests.back().eos);
@@ -370,6 +376,11 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
                                                       std::move(send_remote_block_closure),
                                                       channel->_brpc_dest_addr));
             } else {
+                // The block is owned by this rpc, so its column values can be moved into the
+                // attachment. Broadcast blocks are shared by channels, they are always copied.
+                if (!_send_multi_blocks && enable_attachment_send_block(*brpc_request)) {
+                    embed_block_column_values_in_attachment(send_remote_block_closure.get());
+                }
                 transmit_blockv2(*channel->_brpc_stub, std::move(send_remote_block_closure));
             }
         }
@@ -436,6 +447,8 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             }
         }
         instance_data.seq += requests.size();
+        _rpc_block_count += static_cast<int64_t>(requests.size());
+        _rpc_bytes += mem_byte;
         brpc_request->set_packet_seq(instance_data.seq);
         brpc_request->set_eos(requests.back().eos);
         auto send_callback = channel->get_send_callback(&instance_data, requests.back().eos);
@@ -619,6 +632,8 @@ void ExchangeSinkBuffer::update_rpc_time(RpcInstance& ins, int64_t start_rpc_tim
     _rpc_count++;
     int64_t rpc_spend_time = receive_rpc_time - start_rpc_time;
     if (rpc_spend_time > 0) {
+        DorisMetrics::instance()->transmit_block_latency_us->add(rpc_spend_time / 1000);
+        _rpc_total_time_ns += rpc_spend_time;
         auto& stats = ins.stats;
         ++stats.rpc_count;
         stats.sum_time += rpc_spend_time;
@@ -633,6 +648,7 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* _sum_rpc_timer = ADD_TIMER(profile, "RpcSumTime");
     auto* _count_rpc = ADD_COUNTER(profile, "RpcCount", TUnit::UNIT);
     auto* _avg_rpc_timer = ADD_TIMER(profile, "RpcAvgTime");
+    auto* _rpc_block_counter = ADD_COUNTER(profile, "RpcBlockCount", TUnit::UNIT);
 
     int64_t max_rpc_time = 0, min_rpc_time = 0;
     get_max_min_rpc_time(&max_rpc_time, &min_rpc_time);
@@ -640,6 +656,7 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     _min_rpc_timer->set(min_rpc_time);
 
     _count_rpc->set(_rpc_count);
+    _rpc_block_counter->set(_rpc_block_count);
     int64_t sum_time = get_sum_rpc_time();
     _sum_rpc_timer->set(sum_time);
     _avg_rpc_timer->set(sum_time / std::max(static_cast<int64_t>(1), _rpc_count.load()));
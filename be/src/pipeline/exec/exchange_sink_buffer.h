@@ -290,6 +290,13 @@ public:
     }
 
     void set_low_memory_mode() { _queue_capacity = 8; }
+
+    // The measured throughput of the rpcs sent by this buffer, 0 if no rpc has finished yet.
+    double network_bytes_per_ns() const {
+        auto time_ns = _rpc_total_time_ns.load(std::memory_order_relaxed);
+        return time_ns > 0 ? double(_rpc_bytes.load(std::memory_order_relaxed)) / double(time_ns)
+                           : 0;
+    }
     std::string debug_each_instance_queue_size();
 #ifdef BE_TEST
 public:
@@ -310,6 +317,10 @@ private:
 
     PlanNodeId _node_id;
     std::atomic<int64_t> _rpc_count = 0;
+    // The number of packets sent, more than `_rpc_count` if several blocks are packed in one rpc.
+    std::atomic<int64_t> _rpc_block_count = 0;
+    std::atomic<int64_t> _rpc_bytes = 0;
+    std::atomic<int64_t> _rpc_total_time_ns = 0;
     // The state may be from PipelineFragmentContext if it is shared among multi instances.
     RuntimeState* _state = nullptr;
     QueryContext* _context = nullptr;
@@ -17,9 +17,14 @@
 
 #pragma once
 
+#include "common/config.h"
 #include "join_build_sink_operator.h"
 #include "operator.h"
+#include "runtime/exec_env.h"
+#include "runtime/fragment_mgr.h"
 #include "runtime_filter/runtime_filter_producer_helper.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -92,6 +97,7 @@ protected:
     RuntimeProfile::Counter* _build_expr_call_timer = nullptr;
     RuntimeProfile::Counter* _build_table_insert_timer = nullptr;
     RuntimeProfile::Counter* _build_side_merge_block_timer = nullptr;
+    RuntimeProfile::Counter* _build_table_partitions = nullptr;
 
     RuntimeProfile::Counter* _build_blocks_memory_usage = nullptr;
     RuntimeProfile::Counter* _hash_table_memory_usage = nullptr;
@@ -147,6 +153,7 @@ public:
                _join_distribution != TJoinDistributionType::NONE;
     }
     std::vector<bool>& is_null_safe_eq_join() { return _is_null_safe_eq_join; }
+    bool use_shared_hash_table() const { return _use_shared_hash_table; }
 
 private:
     friend class HashJoinBuildSinkLocalState;
@@ -233,11 +240,18 @@ struct ProcessHashTableBuild {
             keep_null_key = true;
         }
 
-        hash_table_ctx.hash_table->build(hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(),
-                                         _rows, keep_null_key);
+        _build_hash_table(hash_table_ctx, keep_null_key);
         hash_table_ctx.bucket_nums.resize(_batch_size);
         hash_table_ctx.bucket_nums.shrink_to_fit();
 
+        // The probe is bound by memory latency once the table is far larger than the cache.
+        using KeyType = typename HashTableContext::Key;
+        size_t table_bytes = hash_table_ctx.hash_table->get_byte_size() + _rows * sizeof(KeyType) +
+                             hash_table_ctx.serialized_keys_size(true);
+        auto min_prefetch_bytes = config::hash_join_probe_prefetch_min_table_bytes;
+        hash_table_ctx.hash_table->set_prefetch_build_rows(
+                min_prefetch_bytes > 0 && static_cast<int64_t>(table_bytes) >= min_prefetch_bytes);
+
         COUNTER_SET(_parent->_hash_table_memory_usage,
                     (int64_t)hash_table_ctx.hash_table->get_byte_size());
         COUNTER_SET(_parent->_build_arena_memory_usage,
@@ -246,6 +260,55 @@ struct ProcessHashTableBuild {
     }
 
 private:
+    // The bucket ranges of a big shared hash table are inserted concurrently, the other instances
+    // of a broadcast join are only waiting for the table anyway.
+    int _num_build_partitions() const {
+        if (!_parent->parent()->cast<HashJoinBuildSinkOperatorX>().use_shared_hash_table() ||
+            config::hash_join_parallel_build_min_rows <= 0 ||
+            _rows < static_cast<size_t>(config::hash_join_parallel_build_min_rows)) {
+            return 1;
+        }
+        return std::max(config::hash_join_parallel_build_max_threads, 1);
+    }
+
+    void _build_hash_table(HashTableContext& hash_table_ctx, bool keep_null_key) {
+        auto& hash_table = *hash_table_ctx.hash_table;
+        const int num_partitions = _num_build_partitions();
+        if (num_partitions <= 1) {
+            hash_table.build(hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(), _rows,
+                             keep_null_key);
+            return;
+        }
+
+        // index = bucket_size is the bucket of null keys
+        const uint32_t num_buckets = hash_table.get_bucket_size() + 1;
+        const uint32_t* bucket_nums = hash_table_ctx.bucket_nums.data();
+        auto build_partition = [&, num_buckets, bucket_nums](int partition) {
+            auto begin = cast_set<uint32_t>(uint64_t(num_buckets) * partition / num_partitions);
+            auto end = cast_set<uint32_t>(uint64_t(num_buckets) * (partition + 1) / num_partitions);
+            hash_table.build_bucket_range(bucket_nums, _rows, begin, end);
+        };
+
+        auto* thread_pool = ExecEnv::GetInstance()->fragment_mgr()->get_thread_pool();
+        CountDownLatch latch(num_partitions - 1);
+        for (int i = 1; i < num_partitions; i++) {
+            auto st = thread_pool->submit_func([&, i]() {
+                SCOPED_ATTACH_TASK(_state);
+                build_partition(i);
+                latch.count_down();
+            });
+            if (!st.ok()) {
+                // build it in the current thread
+                build_partition(i);
+                latch.count_down();
+            }
+        }
+        build_partition(0);
+        latch.wait();
+        hash_table.finish_build(hash_table_ctx.keys, keep_null_key);
+        COUNTER_SET(_parent->_build_table_partitions, int64_t(num_partitions));
+    }
+
     const size_t _rows;
     vectorized::ColumnRawPtrs& _build_raw_ptrs;
     HashJoinBuildSinkLocalState* _parent = nullptr;
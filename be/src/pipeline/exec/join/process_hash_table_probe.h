@@ -24,6 +24,7 @@
 #include "vec/common/custom_allocator.h"
 
 namespace doris {
+class JoinVisitedFlags;
 namespace vectorized {
 class Block;
 class MutableBlock;
@@ -62,7 +63,7 @@ struct ProcessHashTableProbe {
     // each matching join column need to be processed by other join conjunct. so the struct of mutable block
     // and output block may be different
     // The output result is determined by the other join conjunct result and same_to_prev struct
-    Status do_other_join_conjuncts(vectorized::Block* output_block, DorisVector<uint8_t>& visited);
+    Status do_other_join_conjuncts(vectorized::Block* output_block, JoinVisitedFlags& visited);
 
     Status do_mark_join_conjuncts(vectorized::Block* output_block, const uint8_t* null_map);
 
@@ -566,7 +566,7 @@ Status ProcessHashTableProbe<JoinOpType>::do_mark_join_conjuncts(vectorized::Blo
 
 template <int JoinOpType>
 Status ProcessHashTableProbe<JoinOpType>::do_other_join_conjuncts(vectorized::Block* output_block,
-                                                                  DorisVector<uint8_t>& visited) {
+                                                                  JoinVisitedFlags& visited) {
     // dispose the other join conjunct exec
     auto row_count = output_block->rows();
     if (!row_count) {
@@ -618,7 +618,7 @@ Status ProcessHashTableProbe<JoinOpType>::do_other_join_conjuncts(vectorized::Bl
         for (size_t i = 0; i < row_count; ++i) {
             if (filter_map[i]) {
                 if constexpr (JoinOpType == TJoinOp::FULL_OUTER_JOIN) {
-                    visited[_build_indexs.get_element(i)] = 1;
+                    visited.set(_build_indexs.get_element(i));
                 }
             }
         }
@@ -657,11 +657,11 @@ Status ProcessHashTableProbe<JoinOpType>::do_other_join_conjuncts(vectorized::Bl
     } else if constexpr (JoinOpType == TJoinOp::RIGHT_SEMI_JOIN ||
                          JoinOpType == TJoinOp::RIGHT_ANTI_JOIN) {
         for (int i = 0; i < row_count; ++i) {
-            visited[_build_indexs.get_element(i)] |= filter_column_ptr[i];
+            visited.set_if(_build_indexs.get_element(i), filter_column_ptr[i]);
         }
     } else if constexpr (JoinOpType == TJoinOp::RIGHT_OUTER_JOIN) {
         for (int i = 0; i < row_count; ++i) {
-            visited[_build_indexs.get_element(i)] |= filter_column_ptr[i];
+            visited.set_if(_build_indexs.get_element(i), filter_column_ptr[i]);
         }
     }
 
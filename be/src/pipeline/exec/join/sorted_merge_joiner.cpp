@@ -0,0 +1,214 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/exec/join/sorted_merge_joiner.h"
+
+#include <algorithm>
+
+namespace doris::pipeline {
+#include "common/compile_check_begin.h"
+
+SortedMergeJoiner::SortedMergeJoiner(BlockSupplier left, BlockSupplier right,
+                                     std::vector<uint32_t> left_keys,
+                                     std::vector<uint32_t> right_keys, bool nulls_first,
+                                     size_t batch_size)
+        : _nan_direction_hint(nulls_first ? -1 : 1), _batch_size(std::max<size_t>(batch_size, 1)) {
+    DCHECK_EQ(left_keys.size(), right_keys.size());
+    _left.supplier = std::move(left);
+    _left.keys = std::move(left_keys);
+    _right.supplier = std::move(right);
+    _right.keys = std::move(right_keys);
+}
+
+Status SortedMergeJoiner::Side::ensure_row() {
+    while (row >= block.rows()) {
+        if (eos) {
+            return Status::OK();
+        }
+        vectorized::Block next_block;
+        RETURN_IF_ERROR(supplier(&next_block, &eos));
+        for (auto& column : next_block) {
+            column.column = column.column->convert_to_full_column_if_const();
+        }
+        block.swap(next_block);
+        row = 0;
+    }
+    return Status::OK();
+}
+
+bool SortedMergeJoiner::Side::has_null_key(size_t n) const {
+    return std::any_of(keys.begin(), keys.end(), [&](uint32_t key) {
+        return block.get_by_position(key).column->is_null_at(n);
+    });
+}
+
+int SortedMergeJoiner::_compare(size_t l, const vectorized::Block& right, size_t r) const {
+    for (size_t i = 0; i < _left.keys.size(); ++i) {
+        const auto& left_column = *_left.block.get_by_position(_left.keys[i]).column;
+        const auto& right_column = *right.get_by_position(_right.keys[i]).column;
+        int res = left_column.compare_at(l, r, right_column, _nan_direction_hint);
+        if (res != 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+void SortedMergeJoiner::_skip_left_less_than_right() {
+    // the current left row is known to be less
+    size_t lo = _left.row + 1;
+    size_t hi = _left.block.rows();
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (_compare(mid, _right.block, _right.row) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    _left.row = lo;
+}
+
+void SortedMergeJoiner::_skip_right_less_than_left() {
+    // the current right row is known to be less
+    size_t lo = _right.row + 1;
+    size_t hi = _right.block.rows();
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (_compare(_left.row, _right.block, mid) > 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    _right.row = lo;
+}
+
+Status SortedMergeJoiner::_collect_run() {
+    // The current left row holds the key of the run, and it does not move while the run is
+    // collected, even if the run spans several right blocks.
+    _run = _right.block.clone_empty();
+    auto run_columns = _right.block.clone_empty_columns();
+    while (true) {
+        RETURN_IF_ERROR(_right.ensure_row());
+        if (_right.exhausted()) {
+            break;
+        }
+        const size_t rows = _right.block.rows();
+        size_t lo = _right.row;
+        size_t hi = rows;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (_compare(_left.row, _right.block, mid) == 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        for (size_t i = 0; i < run_columns.size(); ++i) {
+            run_columns[i]->insert_range_from(*_right.block.get_by_position(i).column, _right.row,
+                                              lo - _right.row);
+        }
+        _right.row = lo;
+        if (lo < rows) {
+            break;
+        }
+    }
+    _run.set_columns(std::move(run_columns));
+    _max_run_rows = std::max(_max_run_rows, _run.rows());
+    _in_run = true;
+    _run_pos = 0;
+    return Status::OK();
+}
+
+size_t SortedMergeJoiner::_emit(vectorized::MutableColumns& columns, size_t max_rows) {
+    const size_t num_left_columns = _left.block.columns();
+    const size_t rows = std::min(_run.rows() - _run_pos, max_rows);
+    for (size_t i = 0; i < num_left_columns; ++i) {
+        columns[i]->insert_many_from(*_left.block.get_by_position(i).column, _left.row, rows);
+    }
+    for (size_t i = 0; i < _run.columns(); ++i) {
+        columns[num_left_columns + i]->insert_range_from(*_run.get_by_position(i).column, _run_pos,
+                                                         rows);
+    }
+    _run_pos += rows;
+    if (_run_pos == _run.rows()) {
+        // the next left row may have the same key, so keep the run
+        _run_pos = 0;
+        ++_left.row;
+    }
+    return rows;
+}
+
+Status SortedMergeJoiner::get_next(vectorized::Block* output, bool* eos) {
+    *eos = false;
+    RETURN_IF_ERROR(_left.ensure_row());
+    RETURN_IF_ERROR(_right.ensure_row());
+    if (_left.exhausted() || (!_in_run && _right.exhausted())) {
+        *eos = true;
+        return Status::OK();
+    }
+    if (_output_header.columns() == 0) {
+        _output_header = _left.block.clone_empty();
+        for (const auto& column : _right.block) {
+            _output_header.insert(column.clone_empty());
+        }
+    }
+
+    auto columns = _output_header.clone_empty_columns();
+    size_t rows = 0;
+    while (rows < _batch_size) {
+        RETURN_IF_ERROR(_left.ensure_row());
+        if (_left.exhausted()) {
+            *eos = true;
+            break;
+        }
+        if (_in_run) {
+            if (_compare(_left.row, _run, 0) != 0) {
+                // the left rows are sorted, so no more rows join with the run
+                _in_run = false;
+                _run.clear();
+                continue;
+            }
+            rows += _emit(columns, _batch_size - rows);
+            continue;
+        }
+
+        RETURN_IF_ERROR(_right.ensure_row());
+        if (_right.exhausted()) {
+            *eos = true;
+            break;
+        }
+        int cmp = _compare(_left.row, _right.block, _right.row);
+        if (cmp < 0) {
+            _skip_left_less_than_right();
+        } else if (cmp > 0) {
+            _skip_right_less_than_left();
+        } else if (_left.has_null_key(_left.row)) {
+            // null never equals null, the null right rows are skipped once the left side
+            // moves past them
+            ++_left.row;
+        } else {
+            RETURN_IF_ERROR(_collect_run());
+        }
+    }
+    *output = _output_header.clone_with_columns(std::move(columns));
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::pipeline
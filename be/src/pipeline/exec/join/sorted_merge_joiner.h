@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "common/status.h"
+#include "vec/core/block.h"
+
+namespace doris::pipeline {
+#include "common/compile_check_begin.h"
+
+// Inner equi join of two streams which are both sorted ascending on the join keys, without
+// building a hash table.
+//
+// Only the rows of the right stream sharing the current key (a duplicate key run) are buffered,
+// so the memory is bounded by the largest run instead of the whole right side. Rows with a null
+// key never match. The key columns must have the same types on both sides. The output block holds
+// all the left columns followed by all the right columns.
+class SortedMergeJoiner {
+public:
+    // Pulls the next block of a stream, sets `eos` once the stream is exhausted.
+    using BlockSupplier = std::function<Status(vectorized::Block* block, bool* eos)>;
+
+    // `nulls_first` is the position of nulls in the sort order of both streams.
+    SortedMergeJoiner(BlockSupplier left, BlockSupplier right, std::vector<uint32_t> left_keys,
+                      std::vector<uint32_t> right_keys, bool nulls_first, size_t batch_size);
+
+    Status get_next(vectorized::Block* output, bool* eos);
+
+    size_t max_run_rows() const { return _max_run_rows; }
+
+private:
+    struct Side {
+        BlockSupplier supplier;
+        std::vector<uint32_t> keys;
+        vectorized::Block block;
+        size_t row = 0;
+        bool eos = false;
+
+        // Makes `row` point to a valid row unless the stream is exhausted.
+        Status ensure_row();
+        bool exhausted() const { return row >= block.rows(); }
+        bool has_null_key(size_t n) const;
+    };
+
+    // Compares row `l` of the left block with row `r` of `right`, a block laid out like the
+    // right stream.
+    int _compare(size_t l, const vectorized::Block& right, size_t r) const;
+    Status _collect_run();
+    // Skip the rows of one side in its current block that are less than the current row of the
+    // other side, with a binary search.
+    void _skip_left_less_than_right();
+    void _skip_right_less_than_left();
+    // Joins the current left row with the rest of `_run`, returns the number of output rows.
+    size_t _emit(vectorized::MutableColumns& columns, size_t max_rows);
+
+    Side _left;
+    Side _right;
+    const int _nan_direction_hint;
+    const size_t _batch_size;
+    vectorized::Block _output_header;
+
+    // rows of the right stream with the key of `_run`'s first row
+    vectorized::Block _run;
+    bool _in_run = false;
+    // next row of `_run` to join with the current left row
+    size_t _run_pos = 0;
+    size_t _max_run_rows = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::pipeline
@@ -20,10 +20,14 @@
 #include <memory>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "pipeline/exec/operator.h"
 #include "vec/columns/column_filter_helper.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vslot_ref.h"
 
 namespace doris {
 class RuntimeState;
@@ -47,6 +51,7 @@ Status NestedLoopJoinProbeLocalState::init(RuntimeState* state, LocalStateInfo&
     _update_visited_flags_timer = ADD_TIMER(profile(), "UpdateVisitedFlagsTime");
     _join_conjuncts_evaluation_timer = ADD_TIMER(profile(), "JoinConjunctsEvaluationTime");
     _filtered_by_join_conjuncts_timer = ADD_TIMER(profile(), "FilteredByJoinConjunctsTime");
+    _range_index_pruned_rows_counter = ADD_COUNTER(profile(), "RangeIndexPrunedRows", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -59,6 +64,14 @@ Status NestedLoopJoinProbeLocalState::open(RuntimeState* state) {
     for (size_t i = 0; i < _join_conjuncts.size(); i++) {
         RETURN_IF_ERROR(p._join_conjuncts[i]->clone(state, _join_conjuncts[i]));
     }
+    // Pruning build rows is only safe when the unmatched build rows are not output and a
+    // conjunct evaluated to null means the same as false.
+    _use_range_index = config::enable_nested_loop_join_range_index &&
+                       p._range_join_index.has_value() && !p._is_mark_join &&
+                       (p._join_op == TJoinOp::INNER_JOIN ||
+                        p._join_op == TJoinOp::LEFT_OUTER_JOIN ||
+                        p._join_op == TJoinOp::LEFT_SEMI_JOIN ||
+                        p._join_op == TJoinOp::LEFT_ANTI_JOIN);
     _construct_mutable_join_block();
     return Status::OK();
 }
@@ -85,6 +98,56 @@ void NestedLoopJoinProbeLocalState::_update_additional_flags(vectorized::Block*
     }
 }
 
+void NestedLoopJoinProbeLocalState::_build_range_index() {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const auto build_column = p._range_join_index->build_column;
+    _range_index_rows.resize(_shared_state->build_blocks.size());
+    for (size_t i = 0; i < _shared_state->build_blocks.size(); ++i) {
+        const auto& column = _shared_state->build_blocks[i].get_by_position(build_column).column;
+        auto& rows = _range_index_rows[i];
+        rows.clear();
+        rows.reserve(column->size());
+        for (uint32_t j = 0; j < column->size(); ++j) {
+            if (!column->is_null_at(j)) {
+                rows.push_back(j);
+            }
+        }
+        const auto nested = vectorized::remove_nullable(column);
+        std::stable_sort(rows.begin(), rows.end(), [&](uint32_t lhs, uint32_t rhs) {
+            return nested->compare_at(lhs, rhs, *nested, 1) < 0;
+        });
+    }
+    _range_index_built = true;
+}
+
+void NestedLoopJoinProbeLocalState::_prepare_range_probe_column(const vectorized::Block& block) {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    _range_probe_column = block.get_by_position(p._range_join_index->probe_column)
+                                  .column->convert_to_full_column_if_const();
+}
+
+std::pair<size_t, size_t> NestedLoopJoinProbeLocalState::_range_candidates(
+        const vectorized::Block& build_block, size_t build_block_idx) const {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const auto& index = *p._range_join_index;
+    const auto& rows = _range_index_rows[build_block_idx];
+    if (_range_probe_column->is_null_at(_left_block_pos)) {
+        return {0, 0};
+    }
+    const auto probe_column = vectorized::remove_nullable(_range_probe_column);
+    const auto build_column =
+            vectorized::remove_nullable(build_block.get_by_position(index.build_column).column);
+    // the first sorted build row whose value is not less (or greater if `!inclusive`) than the
+    // probe value
+    auto bound = std::partition_point(rows.begin(), rows.end(), [&](uint32_t row) {
+        int cmp = build_column->compare_at(row, _left_block_pos, *probe_column, 1);
+        return index.inclusive == index.build_less ? cmp <= 0 : cmp < 0;
+    });
+    auto pos = static_cast<size_t>(bound - rows.begin());
+    return index.build_less ? std::pair<size_t, size_t> {0, pos}
+                            : std::pair<size_t, size_t> {pos, rows.size()};
+}
+
 void NestedLoopJoinProbeLocalState::_reset_with_next_probe_row() {
     // TODO: need a vector of left block to register the _probe_row_visited_flags
     _current_build_pos = 0;
@@ -99,6 +162,9 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
     _left_block_start_pos = _left_block_pos;
     _left_side_process_count = 0;
     DCHECK(!_need_more_input_data || !_matched_rows_done);
+    if (_use_range_index && !_range_index_built) {
+        _build_range_index();
+    }
 
     if (!_matched_rows_done && !_need_more_input_data) {
         // We should try to join rows if there still are some rows from probe side.
@@ -339,7 +405,25 @@ void NestedLoopJoinProbeLocalState::_process_left_child_block(
     SCOPED_TIMER(_output_temp_blocks_timer);
     auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
     auto dst_columns = block.mutate_columns();
-    const size_t max_added_rows = now_process_build_block.rows();
+    size_t max_added_rows = now_process_build_block.rows();
+    // the candidate build rows if the range index is used, otherwise all rows
+    const uint32_t* selector_begin = nullptr;
+    const uint32_t* selector_end = nullptr;
+    if (_use_range_index) {
+        auto build_block_idx = _current_build_pos - 1;
+        auto [begin, end] = _range_candidates(now_process_build_block, build_block_idx);
+        selector_begin = _range_index_rows[build_block_idx].data() + begin;
+        selector_end = _range_index_rows[build_block_idx].data() + end;
+        COUNTER_UPDATE(_range_index_pruned_rows_counter, max_added_rows - (end - begin));
+        max_added_rows = end - begin;
+    }
+    auto insert_build_rows = [&](vectorized::IColumn& dst, const vectorized::IColumn& src) {
+        if (selector_begin) {
+            dst.insert_indices_from(src, selector_begin, selector_end);
+        } else {
+            dst.insert_range_from(src, 0, max_added_rows);
+        }
+    };
     for (size_t i = 0; i < p._num_probe_side_columns; ++i) {
         const vectorized::ColumnWithTypeAndName& src_column = _child_block->get_by_position(i);
         if (!src_column.column->is_nullable() && dst_columns[i]->is_nullable()) {
@@ -366,18 +450,17 @@ void NestedLoopJoinProbeLocalState::_process_left_child_block(
             auto origin_sz = dst_columns[p._num_probe_side_columns + i]->size();
             DCHECK(p._join_op == TJoinOp::LEFT_OUTER_JOIN ||
                    p._join_op == TJoinOp::FULL_OUTER_JOIN);
-            assert_cast<vectorized::ColumnNullable*>(
-                    dst_columns[p._num_probe_side_columns + i].get())
-                    ->get_nested_column_ptr()
-                    ->insert_range_from(*src_column.column.get(), 0, max_added_rows);
+            insert_build_rows(*assert_cast<vectorized::ColumnNullable*>(
+                                       dst_columns[p._num_probe_side_columns + i].get())
+                                       ->get_nested_column_ptr(),
+                              *src_column.column);
             assert_cast<vectorized::ColumnNullable*>(
                     dst_columns[p._num_probe_side_columns + i].get())
                     ->get_null_map_column()
                     .get_data()
                     .resize_fill(origin_sz + max_added_rows, 0);
         } else {
-            dst_columns[p._num_probe_side_columns + i]->insert_range_from(*src_column.column.get(),
-                                                                          0, max_added_rows);
+            insert_build_rows(*dst_columns[p._num_probe_side_columns + i], *src_column.column);
         }
     }
     block.set_columns(std::move(dst_columns));
@@ -417,9 +500,57 @@ Status NestedLoopJoinProbeOperatorX::prepare(RuntimeState* state) {
     }
     _num_probe_side_columns = _child->row_desc().num_materialized_slots();
     _num_build_side_columns = _build_side_child->row_desc().num_materialized_slots();
+    for (const auto& conjunct : _join_conjuncts) {
+        if (_init_range_join_index(conjunct->root())) {
+            break;
+        }
+    }
     return vectorized::VExpr::open(_join_conjuncts, state);
 }
 
+bool NestedLoopJoinProbeOperatorX::_init_range_join_index(const vectorized::VExprSPtr& expr) {
+    if (expr->is_and_expr()) {
+        return std::any_of(expr->children().begin(), expr->children().end(),
+                           [&](const auto& child) { return _init_range_join_index(child); });
+    }
+    if (expr->node_type() != TExprNodeType::BINARY_PRED || expr->children().size() != 2) {
+        return false;
+    }
+    const auto& fn_name = expr->fn().name.function_name;
+    if (fn_name != "lt" && fn_name != "le" && fn_name != "gt" && fn_name != "ge") {
+        return false;
+    }
+    const auto& lhs = expr->children()[0];
+    const auto& rhs = expr->children()[1];
+    if (!lhs->is_slot_ref() || !rhs->is_slot_ref()) {
+        return false;
+    }
+    auto lhs_type = vectorized::remove_nullable(lhs->data_type());
+    auto rhs_type = vectorized::remove_nullable(rhs->data_type());
+    auto type = lhs_type->get_primitive_type();
+    if (!lhs_type->equals(*rhs_type) ||
+        !(is_int(type) || is_date_type(type) || is_decimal(type))) {
+        return false;
+    }
+    auto lhs_id = static_cast<size_t>(assert_cast<vectorized::VSlotRef*>(lhs.get())->column_id());
+    auto rhs_id = static_cast<size_t>(assert_cast<vectorized::VSlotRef*>(rhs.get())->column_id());
+    bool lhs_is_probe = lhs_id < _num_probe_side_columns;
+    bool rhs_is_probe = rhs_id < _num_probe_side_columns;
+    if (lhs_is_probe == rhs_is_probe) {
+        return false;
+    }
+
+    RangeJoinIndex index;
+    index.probe_column = lhs_is_probe ? lhs_id : rhs_id;
+    index.build_column = (lhs_is_probe ? rhs_id : lhs_id) - _num_probe_side_columns;
+    index.inclusive = fn_name == "le" || fn_name == "ge";
+    // `probe < build` means the build value is greater, `build < probe` means it is less
+    bool is_less = fn_name == "lt" || fn_name == "le";
+    index.build_less = lhs_is_probe ? !is_less : is_less;
+    _range_join_index = index;
+    return true;
+}
+
 bool NestedLoopJoinProbeOperatorX::need_more_input_data(RuntimeState* state) const {
     auto& local_state =
             state->get_local_state(operator_id())->cast<NestedLoopJoinProbeLocalState>();
@@ -439,6 +570,9 @@ Status NestedLoopJoinProbeOperatorX::push(doris::RuntimeState* state, vectorized
     local_state._left_block_pos = 0;
     local_state._need_more_input_data = false;
     local_state._shared_state->left_side_eos = eos;
+    if (local_state._use_range_index) {
+        local_state._prepare_range_probe_column(*block);
+    }
 
     if (!_is_output_left_side_only) {
         auto func = [&](auto&& join_op_variants, auto set_build_side_flag,
@@ -20,6 +20,8 @@
 #include <stdint.h>
 
 #include <cstdint>
+#include <optional>
+#include <vector>
 
 #include "common/cast_set.h"
 #include "common/status.h"
@@ -60,6 +62,12 @@ private:
     void _append_left_data_with_null(vectorized::Block& block) const;
     void _process_left_child_block(vectorized::Block& block,
                                    const vectorized::Block& now_process_build_block) const;
+    void _build_range_index();
+    void _prepare_range_probe_column(const vectorized::Block& block);
+    // The positions in `_range_index_rows[build_block_idx]` of the build rows that may satisfy the
+    // indexed join conjunct with the current probe row.
+    std::pair<size_t, size_t> _range_candidates(const vectorized::Block& build_block,
+                                                size_t build_block_idx) const;
     template <typename Filter, bool SetBuildSideFlag, bool SetProbeSideFlag>
     void _do_filtering_and_update_visited_flags_impl(vectorized::Block* block,
                                                      uint32_t column_to_keep,
@@ -191,11 +199,20 @@ private:
     uint64_t _output_null_idx_build_side = 0;
     vectorized::VExprContextSPtrs _join_conjuncts;
 
+    // Only the candidate build rows of the indexed range conjunct are joined with a probe row.
+    bool _use_range_index = false;
+    bool _range_index_built = false;
+    // The build rows with a non null value in the indexed column sorted by the value, per block.
+    std::vector<std::vector<uint32_t>> _range_index_rows;
+    // The indexed column of the current probe block.
+    vectorized::ColumnPtr _range_probe_column;
+
     RuntimeProfile::Counter* _loop_join_timer = nullptr;
     RuntimeProfile::Counter* _output_temp_blocks_timer = nullptr;
     RuntimeProfile::Counter* _update_visited_flags_timer = nullptr;
     RuntimeProfile::Counter* _join_conjuncts_evaluation_timer = nullptr;
     RuntimeProfile::Counter* _filtered_by_join_conjuncts_timer = nullptr;
+    RuntimeProfile::Counter* _range_index_pruned_rows_counter = nullptr;
 };
 
 class NestedLoopJoinProbeOperatorX final
@@ -232,11 +249,24 @@ public:
 
 private:
     friend class NestedLoopJoinProbeLocalState;
+
+    // A `probe_slot <op> build_slot` join conjunct on fixed width values, so the build rows which
+    // may satisfy it with one probe row are a contiguous range of the build rows sorted by value.
+    struct RangeJoinIndex {
+        size_t probe_column = 0;
+        size_t build_column = 0;
+        // The candidate build values are less (or greater) than the probe value.
+        bool build_less = true;
+        bool inclusive = true;
+    };
+    bool _init_range_join_index(const vectorized::VExprSPtr& expr);
+
     bool _is_output_left_side_only;
     vectorized::VExprContextSPtrs _join_conjuncts;
     size_t _num_probe_side_columns = 0;
     size_t _num_build_side_columns = 0;
     const bool _old_version_flag;
+    std::optional<RangeJoinIndex> _range_join_index;
 };
 
 } // namespace pipeline
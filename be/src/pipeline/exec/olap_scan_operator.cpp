@@ -50,7 +50,7 @@ Status OlapScanLocalState::_init_profile() {
     RETURN_IF_ERROR(ScanLocalState<OlapScanLocalState>::_init_profile());
     // Rows read from storage.
     // Include the rows read from doris page cache.
-    _scan_rows = ADD_COUNTER(_runtime_profile, "ScanRows", TUnit::UNIT);
+    _scan_rows = ADD_SHARDED_COUNTER(_runtime_profile, "ScanRows", TUnit::UNIT);
     // 1. init segment profile
     _segment_profile.reset(new RuntimeProfile("SegmentIterator"));
     _scanner_profile->add_child(_segment_profile.get(), true, nullptr);
@@ -59,7 +59,9 @@ Status OlapScanLocalState::_init_profile() {
     _reader_init_timer = ADD_TIMER(_scanner_profile, "ReaderInitTime");
     _scanner_init_timer = ADD_TIMER(_scanner_profile, "ScannerInitTime");
     _process_conjunct_timer = ADD_TIMER(_runtime_profile, "ProcessConjunctTime");
-    _read_compressed_counter = ADD_COUNTER(_segment_profile, "CompressedBytesRead", TUnit::BYTES);
+    // updated by all scanners for every block
+    _read_compressed_counter =
+            ADD_SHARDED_COUNTER(_segment_profile, "CompressedBytesRead", TUnit::BYTES);
     _read_uncompressed_counter =
             ADD_COUNTER(_segment_profile, "UncompressedBytesRead", TUnit::BYTES);
     _block_load_timer = ADD_TIMER(_segment_profile, "BlockLoadTime");
@@ -269,8 +271,11 @@ Status OlapScanLocalState::_should_push_down_function_filter(vectorized::Vectori
                                                              StringRef* constant_str,
                                                              doris::FunctionContext** fn_ctx,
                                                              PushDownType& pdt) {
-    // Now only `like` function filters is supported to push down
-    if (fn_call->fn().name.function_name != "like") {
+    // Now only `like` and `regexp` function filters are supported to push down, `regexp` only
+    // to prune the pages by its literals with the ngram bloom filter
+    const auto& fn_name = fn_call->fn().name.function_name;
+    bool is_regexp = fn_name == "regexp" || fn_name == "rlike";
+    if (fn_name != "like" && !(is_regexp && config::enable_query_regexp_bloom_filter)) {
         pdt = PushDownType::UNACCEPTABLE;
         return Status::OK();
     }
@@ -477,19 +482,30 @@ Status OlapScanLocalState::hold_tablets() {
                     auto tablet =
                             DORIS_TRY(ExecEnv::get_tablet(_scan_ranges[i]->tablet_id, sync_stats));
                     _tablets[i] = {std::move(tablet), version};
-                    SyncOptions options;
-                    options.query_version = version;
-                    options.merge_schema = true;
-                    RETURN_IF_ERROR(std::dynamic_pointer_cast<CloudTablet>(_tablets[i].tablet)
-                                            ->sync_rowsets(options, sync_stats));
-                    // FIXME(plat1ko): Avoid pointer cast
-                    ExecEnv::GetInstance()->storage_engine().to_cloud().tablet_hotspot().count(
-                            *_tablets[i].tablet);
                     return Status::OK();
                 });
             }
             RETURN_IF_ERROR(
                     cloud::bthread_fork_join(tasks, config::init_scanner_sync_rowsets_parallelism));
+
+            // FIXME(plat1ko): Avoid pointer cast
+            auto& cloud_engine = ExecEnv::GetInstance()->storage_engine().to_cloud();
+            std::vector<CloudTablet*> cloud_tablets;
+            std::vector<int64_t> query_versions;
+            cloud_tablets.reserve(_tablets.size());
+            query_versions.reserve(_tablets.size());
+            for (const auto& tablet : _tablets) {
+                cloud_tablets.push_back(static_cast<CloudTablet*>(tablet.tablet.get()));
+                query_versions.push_back(tablet.version);
+            }
+            SyncOptions options;
+            options.merge_schema = true;
+            RETURN_IF_ERROR(cloud_engine.meta_mgr().sync_tablets_rowsets(
+                    cloud_tablets, query_versions, options, &sync_statistics,
+                    config::init_scanner_sync_rowsets_parallelism));
+            for (const auto& tablet : _tablets) {
+                cloud_engine.tablet_hotspot().count(*tablet.tablet);
+            }
         }
         COUNTER_UPDATE(_sync_rowset_timer, duration_ns);
         auto total_rowsets = std::accumulate(
@@ -563,9 +579,18 @@ Status OlapScanLocalState::hold_tablets() {
     }
 
     for (size_t i = 0; i < _scan_ranges.size(); i++) {
-        RETURN_IF_ERROR(_tablets[i].tablet->capture_rs_readers({0, _tablets[i].version},
-                                                               &_read_sources[i].rs_splits,
-                                                               _state->skip_missing_version()));
+        if (_query_cache_lookup != nullptr && _query_cache_lookup->incremental) {
+            // only the rowsets loaded after the cached result are scanned
+            for (const auto& rowset : _query_cache_lookup->delta_rowsets) {
+                RowsetReaderSharedPtr rs_reader;
+                RETURN_IF_ERROR(rowset->create_reader(&rs_reader));
+                _read_sources[i].rs_splits.emplace_back(std::move(rs_reader));
+            }
+        } else {
+            RETURN_IF_ERROR(_tablets[i].tablet->capture_rs_readers(
+                    {0, _tablets[i].version}, &_read_sources[i].rs_splits,
+                    _state->skip_missing_version()));
+        }
         if (!PipelineXLocalState<>::_state->skip_delete_predicate()) {
             _read_sources[i].fill_delete_predicates();
         }
@@ -594,17 +619,17 @@ TOlapScanNode& OlapScanLocalState::olap_scan_node() const {
 
 void OlapScanLocalState::set_scan_ranges(RuntimeState* state,
                                          const std::vector<TScanRangeParams>& scan_ranges) {
-    const auto& cache_param = _parent->cast<OlapScanOperatorX>()._cache_param;
+    const auto& p = _parent->cast<OlapScanOperatorX>();
+    const auto& cache_param = p._cache_param;
     bool hit_cache = false;
     if (!cache_param.digest.empty() && !cache_param.force_refresh_query_cache) {
-        std::string cache_key;
-        int64_t version = 0;
-        auto status = QueryCache::build_cache_key(scan_ranges, cache_param, &cache_key, &version);
+        auto status = QueryCache::instance()->lookup_once(
+                state->get_query_ctx(), scan_ranges, cache_param,
+                p._query_cache_allow_incremental, &_query_cache_lookup);
         if (!status.ok()) {
             throw doris::Exception(doris::ErrorCode::INTERNAL_ERROR, status.msg());
         }
-        doris::QueryCacheHandle handle;
-        hit_cache = QueryCache::instance()->lookup(cache_key, version, &handle);
+        hit_cache = _query_cache_lookup->hit;
     }
 
     if (!hit_cache) {
@@ -757,10 +782,12 @@ Status OlapScanLocalState::_build_key_ranges_and_filters() {
 
 OlapScanOperatorX::OlapScanOperatorX(ObjectPool* pool, const TPlanNode& tnode, int operator_id,
                                      const DescriptorTbl& descs, int parallel_tasks,
-                                     const TQueryCacheParam& param)
+                                     const TQueryCacheParam& param,
+                                     bool query_cache_allow_incremental)
         : ScanOperatorX<OlapScanLocalState>(pool, tnode, operator_id, descs, parallel_tasks),
           _olap_scan_node(tnode.olap_scan_node),
-          _cache_param(param) {
+          _cache_param(param),
+          _query_cache_allow_incremental(query_cache_allow_incremental) {
     _output_tuple_id = tnode.olap_scan_node.tuple_id;
     if (_olap_scan_node.__isset.sort_info && _olap_scan_node.__isset.sort_limit) {
         _limit_per_scanner = _olap_scan_node.sort_limit;
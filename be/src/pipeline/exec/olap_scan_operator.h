@@ -29,6 +29,8 @@
 namespace doris {
 #include "common/compile_check_begin.h"
 
+struct QueryCacheLookup;
+
 namespace vectorized {
 class OlapScanner;
 }
@@ -227,19 +229,21 @@ private:
 
     std::vector<TabletWithVersion> _tablets;
     std::vector<TabletReader::ReadSource> _read_sources;
+    std::shared_ptr<QueryCacheLookup> _query_cache_lookup;
 };
 
 class OlapScanOperatorX final : public ScanOperatorX<OlapScanLocalState> {
 public:
     OlapScanOperatorX(ObjectPool* pool, const TPlanNode& tnode, int operator_id,
                       const DescriptorTbl& descs, int parallel_tasks,
-                      const TQueryCacheParam& cache_param);
+                      const TQueryCacheParam& cache_param, bool query_cache_allow_incremental);
     Status hold_tablets(RuntimeState* state) override;
 
 private:
     friend class OlapScanLocalState;
     TOlapScanNode _olap_scan_node;
     TQueryCacheParam _cache_param;
+    bool _query_cache_allow_incremental;
 };
 
 #include "common/compile_check_end.h"
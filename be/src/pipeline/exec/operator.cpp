@@ -17,6 +17,7 @@
 
 #include "operator.h"
 
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
@@ -236,6 +237,12 @@ Status OperatorXBase::prepare(RuntimeState* state) {
         RETURN_IF_ERROR(
                 vectorized::VExpr::check_expr_output_type(_projections, *_output_row_descriptor));
     }
+    if (config::enable_projection_common_subexpr_reuse) {
+        for (const auto& projections : _intermediate_projections) {
+            vectorized::VSharedExpr::share_common_subexprs(projections, &_num_shared_exprs);
+        }
+        vectorized::VSharedExpr::share_common_subexprs(_projections, &_num_shared_exprs);
+    }
 
     for (auto& conjunct : _conjuncts) {
         RETURN_IF_ERROR(conjunct->open(state));
@@ -298,6 +305,9 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
     std::vector<int> result_column_ids;
     size_t bytes_usage = 0;
     for (const auto& projections : local_state->_intermediate_projections) {
+        if (local_state->_shared_expr_results) {
+            local_state->_shared_expr_results->reset();
+        }
         result_column_ids.resize(projections.size());
         for (int i = 0; i < projections.size(); i++) {
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
@@ -332,10 +342,15 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
     vectorized::MutableBlock mutable_block =
             vectorized::VectorizedUtils::build_mutable_mem_reuse_block(output_block,
                                                                        *_output_row_descriptor);
+    if (local_state->_shared_expr_results) {
+        local_state->_shared_expr_results->reset();
+    }
     if (rows != 0) {
         auto& mutable_columns = mutable_block.mutable_columns();
         const size_t origin_columns_count = input_block.columns();
         DCHECK_EQ(mutable_columns.size(), local_state->_projections.size()) << debug_string();
+        // The dictionary codes of the projected slots, they are attached to the output columns.
+        std::vector<std::pair<size_t, vectorized::ColumnDictCodesPtr>> dict_codes;
         for (int i = 0; i < mutable_columns.size(); ++i) {
             auto result_column_id = -1;
             RETURN_IF_ERROR(local_state->_projections[i]->execute(&input_block, &result_column_id));
@@ -344,10 +359,16 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
             if (result_column_id >= origin_columns_count) {
                 bytes_usage += column_ptr->allocated_bytes();
             }
+            if (auto codes = input_block.get_dict_codes(column_ptr.get())) {
+                dict_codes.emplace_back(i, std::move(codes));
+            }
             insert_column_datas(mutable_columns[i], column_ptr, rows);
         }
         DCHECK(mutable_block.rows() == rows);
         output_block->set_columns(std::move(mutable_columns));
+        for (auto& [position, codes] : dict_codes) {
+            output_block->set_dict_codes(position, std::move(codes));
+        }
     }
 
     local_state->_estimate_memory_usage += bytes_usage;
@@ -564,6 +585,8 @@ Status PipelineXLocalState<SharedStateArg>::open(RuntimeState* state) {
                     state, _intermediate_projections[i][j]));
         }
     }
+    _shared_expr_results = vectorized::SharedExprResults::create(
+            _parent->_num_shared_exprs, _projections, _intermediate_projections);
     return Status::OK();
 }
 
@@ -41,6 +41,7 @@
 #include "runtime/thread_context.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
+#include "vec/exprs/vshared_expr.h"
 #include "vec/runtime/vdata_stream_recvr.h"
 
 namespace doris {
@@ -246,6 +247,8 @@ protected:
     vectorized::VExprContextSPtrs _projections;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // The columns of the subexpressions shared by the projections, see VSharedExpr.
+    std::unique_ptr<vectorized::SharedExprResults> _shared_expr_results;
 
     bool _closed = false;
     std::atomic<bool> _terminated = false;
@@ -944,6 +947,8 @@ private:
     vectorized::VExprContextSPtrs _projections;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // The number of the subexpressions shared by the projections of each level.
+    size_t _num_shared_exprs = 0;
 
 protected:
     RowDescriptor _row_descriptor;
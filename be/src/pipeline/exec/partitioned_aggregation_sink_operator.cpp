@@ -64,6 +64,7 @@ Status PartitionedAggSinkLocalState::init(doris::RuntimeState* state,
     }
 
     _rows_in_partitions.assign(Base::_shared_state->partition_count, 0);
+    _spilled_partitions.assign(Base::_shared_state->partition_count, false);
 
     _spill_dependency = Dependency::create_shared(parent.operator_id(), parent.node_id(),
                                                   "AggSinkSpillDependency", true);
@@ -94,6 +95,8 @@ void PartitionedAggSinkLocalState::_init_counters() {
 
     _spill_serialize_hash_table_timer =
             ADD_TIMER_WITH_LEVEL(Base::profile(), "SpillSerializeHashTableTime", 1);
+    _spill_retained_rows_counter =
+            ADD_COUNTER_WITH_LEVEL(Base::profile(), "SpillRetainedRows", TUnit::UNIT, 1);
 }
 #define UPDATE_PROFILE(name) \
     update_profile_from_inner_profile<spilled>(name, _profile, child_profile)
@@ -323,6 +326,13 @@ Status PartitionedAggSinkLocalState::revoke_memory(
                         agg_data->method_variant);
                 RETURN_IF_ERROR(status);
                 status = parent._agg_sink_operator->reset_hash_table(runtime_state);
+                RETURN_IF_ERROR(status);
+                // put the retained partitions back
+                for (auto& block : _retained_blocks) {
+                    status = parent._agg_sink_operator->merge_spilled_block(runtime_state, &block);
+                    RETURN_IF_ERROR(status);
+                }
+                _retained_blocks.clear();
                 return status;
             });
 
@@ -16,10 +16,13 @@
 // under the License.
 
 #pragma once
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "aggregation_sink_operator.h"
+#include "common/config.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "util/pretty_printer.h"
@@ -91,6 +94,7 @@ public:
 
         std::vector<TmpSpillInfo<typename HashTableType::key_type>> spill_infos(
                 Base::_shared_state->partition_count);
+        const auto retained = _get_retained_partitions(hash_table, total_rows);
         auto& iter = Base::_shared_state->in_mem_shared_state->aggregate_data_container->iterator;
         while (iter != Base::_shared_state->in_mem_shared_state->aggregate_data_container->end() &&
                !state->is_cancelled()) {
@@ -103,7 +107,8 @@ public:
                 row_count = 0;
                 for (int i = 0; i < Base::_shared_state->partition_count && !state->is_cancelled();
                      ++i) {
-                    if (spill_infos[i].keys_.size() >= spill_batch_rows) {
+                    if (!retained[i] && spill_infos[i].keys_.size() >= spill_batch_rows) {
+                        _spilled_partitions[i] = true;
                         _rows_in_partitions[i] += spill_infos[i].keys_.size();
                         status = _spill_partition(
                                 state, context, Base::_shared_state->spill_partitions[i],
@@ -119,7 +124,15 @@ public:
         for (int i = 0; i < Base::_shared_state->partition_count && !state->is_cancelled(); ++i) {
             auto spill_null_key_data =
                     (hash_null_key_data && i == Base::_shared_state->partition_count - 1);
-            if (spill_infos[i].keys_.size() > 0 || spill_null_key_data) {
+            if (retained[i]) {
+                status = _retain_partition(context, spill_infos[i].keys_, spill_infos[i].values_,
+                                           spill_null_key_data
+                                                   ? hash_table.template get_null_key_data<
+                                                             vectorized::AggregateDataPtr>()
+                                                   : nullptr);
+                RETURN_IF_ERROR(status);
+            } else if (spill_infos[i].keys_.size() > 0 || spill_null_key_data) {
+                _spilled_partitions[i] = true;
                 _rows_in_partitions[i] += spill_infos[i].keys_.size();
                 status = _spill_partition(state, context, Base::_shared_state->spill_partitions[i],
                                           spill_infos[i].keys_, spill_infos[i].values_,
@@ -142,6 +155,75 @@ public:
         return Status::OK();
     }
 
+    // Picks the partitions kept in memory by this spill: the never spilled ones with the fewest
+    // groups, up to `spill_aggregation_retain_partition_percent` of all the groups. Keeping them
+    // saves writing and reading them back, and since they never reach the disk, the source
+    // outputs them straight from the hash table.
+    template <typename HashTableType>
+    std::vector<bool> _get_retained_partitions(HashTableType& hash_table, size_t total_rows) {
+        const auto partition_count = Base::_shared_state->partition_count;
+        std::vector<bool> retained(partition_count, false);
+        const auto max_retained_rows =
+                size_t(total_rows) *
+                size_t(std::max(config::spill_aggregation_retain_partition_percent, 0)) / 100;
+        if (max_retained_rows == 0) {
+            return retained;
+        }
+
+        std::vector<size_t> partition_rows(partition_count, 0);
+        auto& container = *Base::_shared_state->in_mem_shared_state->aggregate_data_container;
+        for (auto it = container.begin(); it != container.end(); ++it) {
+            const auto& key = it.template get_key<typename HashTableType::key_type>();
+            ++partition_rows[Base::_shared_state->get_partition_index(hash_table.hash(key))];
+        }
+
+        std::vector<size_t> candidates;
+        for (size_t i = 0; i < partition_count; ++i) {
+            if (!_spilled_partitions[i]) {
+                candidates.emplace_back(i);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(),
+                  [&](size_t a, size_t b) { return partition_rows[a] < partition_rows[b]; });
+        size_t retained_rows = 0;
+        for (auto i : candidates) {
+            if (retained_rows + partition_rows[i] > max_retained_rows) {
+                break;
+            }
+            retained_rows += partition_rows[i];
+            retained[i] = true;
+        }
+        COUNTER_UPDATE(_spill_retained_rows_counter, retained_rows);
+        return retained;
+    }
+
+    // Serializes the groups of a retained partition into `_retained_blocks`, they are merged
+    // back into the hash table after it is reset.
+    template <typename HashTableCtxType, typename KeyType>
+    Status _retain_partition(HashTableCtxType& context, std::vector<KeyType>& keys,
+                             std::vector<vectorized::AggregateDataPtr>& values,
+                             const vectorized::AggregateDataPtr null_key_data) {
+        if (keys.empty() && !null_key_data) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(to_block(context, keys, values, null_key_data));
+        {
+            std::vector<KeyType> tmp_keys;
+            std::vector<vectorized::AggregateDataPtr> tmp_values;
+            keys.swap(tmp_keys);
+            values.swap(tmp_values);
+        }
+        vectorized::Block block;
+        block.swap(block_);
+        _retained_blocks.emplace_back(std::move(block));
+        // the retained block owns the columns now, `_reset_tmp_data` would clear them
+        key_block_ = key_block_.clone_empty();
+        value_block_ = value_block_.clone_empty();
+        key_columns_ = key_block_.mutate_columns();
+        value_columns_ = value_block_.mutate_columns();
+        return Status::OK();
+    }
+
     template <typename HashTableCtxType, typename KeyType>
     Status _spill_partition(RuntimeState* state, HashTableCtxType& context,
                             AggSpillPartitionSPtr& spill_partition, std::vector<KeyType>& keys,
@@ -280,10 +362,16 @@ public:
     vectorized::Block key_block_;
     vectorized::Block value_block_;
 
+    // the partitions that have data on disk
+    std::vector<bool> _spilled_partitions;
+    // the groups of the partitions kept in memory by the running spill
+    std::vector<vectorized::Block> _retained_blocks;
+
     std::unique_ptr<RuntimeProfile> _internal_runtime_profile;
     RuntimeProfile::Counter* _memory_usage_reserved = nullptr;
 
     RuntimeProfile::Counter* _spill_serialize_hash_table_timer = nullptr;
+    RuntimeProfile::Counter* _spill_retained_rows_counter = nullptr;
 
     std::atomic<bool> _eos = false;
 };
@@ -21,8 +21,10 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <numeric>
 #include <utility>
 
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/logging.h"
 #include "common/status.h"
@@ -30,6 +32,7 @@
 #include "runtime/fragment_mgr.h"
 #include "util/mem_info.h"
 #include "util/runtime_profile.h"
+#include "vec/common/assert_cast.h"
 #include "vec/core/block.h"
 #include "vec/spill/spill_stream.h"
 #include "vec/spill/spill_stream_manager.h"
@@ -53,6 +56,7 @@ Status PartitionedHashJoinProbeLocalState::init(RuntimeState* state, LocalStateI
 
     _partitioned_blocks.resize(p._partition_count);
     _probe_spilling_streams.resize(p._partition_count);
+    _partition_levels.resize(p._partition_count);
 
     _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
                                                   "HashJoinProbeSpillDependency", true);
@@ -75,6 +79,10 @@ void PartitionedHashJoinProbeLocalState::init_counters() {
     _spill_probe_timer = ADD_TIMER_WITH_LEVEL(profile(), "SpillProbeTime", 1);
     _recovery_probe_blocks = ADD_COUNTER(profile(), "SpillRecoveryProbeBlocks", TUnit::UNIT);
     _recovery_probe_timer = ADD_TIMER_WITH_LEVEL(profile(), "SpillRecoveryProbeTime", 1);
+    _repartition_timer = ADD_TIMER_WITH_LEVEL(profile(), "SpillRepartitionTime", 1);
+    _repartition_count = ADD_COUNTER(profile(), "SpillRepartitionCount", TUnit::UNIT);
+    _max_repartition_level = ADD_COUNTER(profile(), "SpillMaxRepartitionLevel", TUnit::UNIT);
+    _build_chunks = ADD_COUNTER(profile(), "SpillBuildChunks", TUnit::UNIT);
     _get_child_next_timer = ADD_TIMER_WITH_LEVEL(profile(), "GetChildNextTime", 1);
 
     _probe_blocks_bytes =
@@ -131,8 +139,10 @@ void PartitionedHashJoinProbeLocalState::update_profile_from_inner() {
 
 Status PartitionedHashJoinProbeLocalState::open(RuntimeState* state) {
     RETURN_IF_ERROR(PipelineXSpillLocalState::open(state));
-    return _parent->cast<PartitionedHashJoinProbeOperatorX>()._partitioner->clone(state,
-                                                                                  _partitioner);
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    RETURN_IF_ERROR(p._build_repartitioner->clone(state, _build_repartitioner));
+    RETURN_IF_ERROR(p._probe_repartitioner->clone(state, _probe_repartitioner));
+    return p._partitioner->clone(state, _partitioner);
 }
 Status PartitionedHashJoinProbeLocalState::close(RuntimeState* state) {
     SCOPED_TIMER(exec_time_counter());
@@ -241,7 +251,10 @@ Status PartitionedHashJoinProbeLocalState::finish_spilling(uint32_t partition_in
     auto& probe_spilling_stream = _probe_spilling_streams[partition_index];
 
     if (probe_spilling_stream) {
-        RETURN_IF_ERROR(probe_spilling_stream->spill_eof());
+        // The streams of the sub partitions are finished when repartitioning.
+        if (!probe_spilling_stream->ready_for_reading()) {
+            RETURN_IF_ERROR(probe_spilling_stream->spill_eof());
+        }
         probe_spilling_stream->set_read_counters(profile());
     }
 
@@ -392,7 +405,7 @@ Status PartitionedHashJoinProbeLocalState::recover_probe_blocks_from_disk(Runtim
                                                                           bool& has_data) {
     auto& spilled_stream = _probe_spilling_streams[partition_index];
     has_data = false;
-    if (!spilled_stream) {
+    if (!spilled_stream || (_build_in_chunks && !_probe_reader)) {
         return Status::OK();
     }
 
@@ -414,7 +427,14 @@ Status PartitionedHashJoinProbeLocalState::recover_probe_blocks_from_disk(Runtim
 
         size_t read_size = 0;
         while (!eos && !_state->is_cancelled() && st.ok()) {
-            st = spilled_stream->read_next_block_sync(&block, &eos);
+            if (_build_in_chunks) {
+                st = _probe_reader->open();
+                if (st.ok()) {
+                    st = _probe_reader->read(&block, &eos);
+                }
+            } else {
+                st = spilled_stream->read_next_block_sync(&block, &eos);
+            }
             if (!st.ok()) {
                 break;
             } else if (!block.empty()) {
@@ -433,8 +453,13 @@ Status PartitionedHashJoinProbeLocalState::recover_probe_blocks_from_disk(Runtim
                     "Query:{}, hash join probe:{}, task:{},"
                     " partition:{}, recovery probe data done",
                     print_id(query_id), _parent->node_id(), _state->task_id(), partition_index);
-            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spilled_stream);
-            spilled_stream.reset();
+            if (_build_in_chunks) {
+                // The stream is read again for the next chunk of build data.
+                _probe_reader.reset();
+            } else {
+                ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spilled_stream);
+                spilled_stream.reset();
+            }
         }
         return st;
     };
@@ -471,6 +496,215 @@ Status PartitionedHashJoinProbeLocalState::recover_probe_blocks_from_disk(Runtim
             exception_catch_func));
 }
 
+bool PartitionedHashJoinProbeLocalState::_need_repartition(uint32_t partition_index) const {
+    const auto max_bytes = config::spill_hash_join_partition_max_bytes;
+    const auto& build_block = _shared_state->partitioned_build_blocks[partition_index];
+    if (max_bytes <= 0 || !build_block ||
+        build_block->allocated_bytes() < static_cast<size_t>(max_bytes)) {
+        return false;
+    }
+    const auto& level = _partition_levels[partition_index];
+    return level.can_split &&
+           static_cast<int64_t>(level.level) < config::spill_hash_join_max_repartition_depth;
+}
+
+bool PartitionedHashJoinProbeLocalState::_can_build_in_chunks(uint32_t partition_index) const {
+    const auto max_bytes = config::spill_hash_join_partition_max_bytes;
+    const auto& build_block = _shared_state->partitioned_build_blocks[partition_index];
+    if (max_bytes <= 0 || !build_block ||
+        build_block->allocated_bytes() < static_cast<size_t>(max_bytes)) {
+        return false;
+    }
+
+    // Every probe row must see all the build rows, unless each chunk of build rows can be
+    // joined on its own.
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    if (p._is_mark_join ||
+        (p._join_op != TJoinOp::INNER_JOIN && p._join_op != TJoinOp::RIGHT_OUTER_JOIN &&
+         p._join_op != TJoinOp::RIGHT_SEMI_JOIN && p._join_op != TJoinOp::RIGHT_ANTI_JOIN)) {
+        return false;
+    }
+
+    // The probe data is read again from disk for each chunk, so it must all be on disk.
+    auto it = _probe_blocks.find(partition_index);
+    const auto& partitioned_block = _partitioned_blocks[partition_index];
+    return (it == _probe_blocks.end() || it->second.empty()) &&
+           (!partitioned_block || partitioned_block->empty());
+}
+
+Status PartitionedHashJoinProbeLocalState::_repartition_block(
+        RuntimeState* state, vectorized::PartitionerBase& partitioner, vectorized::Block& block,
+        const std::string& name, std::vector<vectorized::SpillStreamSPtr>& streams,
+        std::vector<size_t>& rows) {
+    RETURN_IF_ERROR(partitioner.do_partitioning(state, &block));
+
+    const auto block_rows = block.rows();
+    std::vector<std::vector<uint32_t>> partition_indexes(streams.size());
+    const auto* channel_ids = partitioner.get_channel_ids().get<uint32_t>();
+    for (uint32_t i = 0; i != block_rows; ++i) {
+        partition_indexes[channel_ids[i]].emplace_back(i);
+    }
+
+    for (size_t i = 0; i != streams.size(); ++i) {
+        const auto count = partition_indexes[i].size();
+        if (count == 0) {
+            continue;
+        }
+
+        if (!streams[i]) {
+            RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                    state, streams[i], print_id(state->query_id()), name, _parent->node_id(),
+                    std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(),
+                    _runtime_profile.get()));
+        }
+
+        auto sub_block = vectorized::MutableBlock::create_unique(block.clone_empty());
+        RETURN_IF_ERROR(sub_block->add_rows(&block, partition_indexes[i].data(),
+                                            partition_indexes[i].data() + count));
+        RETURN_IF_ERROR(streams[i]->spill_block(state, sub_block->to_block(), false));
+        rows[i] += count;
+    }
+    return Status::OK();
+}
+
+Status PartitionedHashJoinProbeLocalState::repartition(RuntimeState* state,
+                                                       uint32_t partition_index) {
+    const auto level = _partition_levels[partition_index].level + 1;
+    VLOG_DEBUG << fmt::format(
+            "Query:{}, hash join probe:{}, task:{},"
+            " partition:{}, repartition to level:{}",
+            print_id(state->query_id()), _parent->node_id(), state->task_id(), partition_index,
+            level);
+
+    RETURN_IF_ERROR(finish_spilling(partition_index));
+    auto& partitioned_block = _partitioned_blocks[partition_index];
+    if (partitioned_block && !partitioned_block->empty()) {
+        _probe_blocks[partition_index].emplace_back(partitioned_block->to_block());
+    }
+    partitioned_block.reset();
+
+    auto repartition_func = [this, state, partition_index, level] {
+        SCOPED_TIMER(_repartition_timer);
+        auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+
+        std::vector<vectorized::SpillStreamSPtr> build_streams(p._partition_count);
+        std::vector<vectorized::SpillStreamSPtr> probe_streams(p._partition_count);
+        std::vector<size_t> build_rows(p._partition_count);
+        std::vector<size_t> probe_rows(p._partition_count);
+        const auto build_name = fmt::format("hash_build_repartition_{}", level);
+        const auto probe_name = fmt::format("hash_probe_repartition_{}", level);
+
+        auto& build_partitioner =
+                assert_cast<vectorized::SpillRepartitioner&>(*_build_repartitioner);
+        build_partitioner.set_level(level);
+        auto& build_block = _shared_state->partitioned_build_blocks[partition_index];
+        if (build_block && !build_block->empty()) {
+            auto block = build_block->to_block();
+            RETURN_IF_ERROR(_repartition_block(state, build_partitioner, block, build_name,
+                                               build_streams, build_rows));
+        }
+        build_block.reset();
+
+        auto& build_stream = _shared_state->spilled_streams[partition_index];
+        if (build_stream) {
+            bool eos = false;
+            while (!eos) {
+                RETURN_IF_CANCELLED(state);
+                vectorized::Block block;
+                RETURN_IF_ERROR(build_stream->read_next_block_sync(&block, &eos));
+                if (block.empty()) {
+                    continue;
+                }
+                COUNTER_UPDATE(_recovery_build_rows, block.rows());
+                COUNTER_UPDATE(_recovery_build_blocks, 1);
+                RETURN_IF_ERROR(_repartition_block(state, build_partitioner, block, build_name,
+                                                   build_streams, build_rows));
+            }
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(build_stream);
+            build_stream.reset();
+        }
+
+        auto& probe_partitioner =
+                assert_cast<vectorized::SpillRepartitioner&>(*_probe_repartitioner);
+        probe_partitioner.set_level(level);
+        auto& probe_blocks = _probe_blocks[partition_index];
+        for (auto& block : probe_blocks) {
+            RETURN_IF_ERROR(_repartition_block(state, probe_partitioner, block, probe_name,
+                                               probe_streams, probe_rows));
+        }
+        probe_blocks.clear();
+
+        auto& probe_stream = _probe_spilling_streams[partition_index];
+        if (probe_stream) {
+            bool eos = false;
+            while (!eos) {
+                RETURN_IF_CANCELLED(state);
+                vectorized::Block block;
+                RETURN_IF_ERROR(probe_stream->read_next_block_sync(&block, &eos));
+                if (block.empty()) {
+                    continue;
+                }
+                COUNTER_UPDATE(_recovery_probe_rows, block.rows());
+                COUNTER_UPDATE(_recovery_probe_blocks, 1);
+                RETURN_IF_ERROR(_repartition_block(state, probe_partitioner, block, probe_name,
+                                                   probe_streams, probe_rows));
+            }
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(probe_stream);
+            probe_stream.reset();
+        }
+
+        const auto total_build_rows = std::accumulate(build_rows.begin(), build_rows.end(),
+                                                      static_cast<size_t>(0));
+        const auto total_probe_rows = std::accumulate(probe_rows.begin(), probe_rows.end(),
+                                                      static_cast<size_t>(0));
+        for (uint32_t i = 0; i != p._partition_count; ++i) {
+            if (!build_streams[i] && !probe_streams[i]) {
+                continue;
+            }
+            if (build_streams[i]) {
+                RETURN_IF_ERROR(build_streams[i]->spill_eof());
+            }
+            if (probe_streams[i]) {
+                RETURN_IF_ERROR(probe_streams[i]->spill_eof());
+            }
+            _shared_state->spilled_streams.emplace_back(std::move(build_streams[i]));
+            _shared_state->partitioned_build_blocks.emplace_back();
+            _probe_spilling_streams.emplace_back(std::move(probe_streams[i]));
+            _partitioned_blocks.emplace_back();
+            // All the build rows have the same hash, most likely a single hot key.
+            _partition_levels.push_back({level, build_rows[i] != total_build_rows});
+        }
+
+        COUNTER_UPDATE(_repartition_count, 1);
+        COUNTER_SET(_max_repartition_level,
+                    std::max(_max_repartition_level->value(), static_cast<int64_t>(level)));
+        COUNTER_UPDATE(ADD_COUNTER(profile(),
+                                   fmt::format("SpillRepartitionBuildRowsLevel{}", level),
+                                   TUnit::UNIT),
+                       total_build_rows);
+        COUNTER_UPDATE(ADD_COUNTER(profile(),
+                                   fmt::format("SpillRepartitionProbeRowsLevel{}", level),
+                                   TUnit::UNIT),
+                       total_probe_rows);
+        _partition_repartitioned = true;
+        return Status::OK();
+    };
+
+    auto exception_catch_func = [repartition_func]() {
+        auto status = [&]() {
+            RETURN_IF_ERROR_OR_CATCH_EXCEPTION(repartition_func());
+            return Status::OK();
+        }();
+        return status;
+    };
+
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    _spill_dependency->block();
+    return spill_io_pool->submit(std::make_shared<SpillRecoverRunnable>(
+            state, _spill_dependency, _runtime_profile.get(), _shared_state->shared_from_this(),
+            exception_catch_func));
+}
+
 PartitionedHashJoinProbeOperatorX::PartitionedHashJoinProbeOperatorX(ObjectPool* pool,
                                                                      const TPlanNode& tnode,
                                                                      int operator_id,
@@ -494,9 +728,14 @@ Status PartitionedHashJoinProbeOperatorX::init(const TPlanNode& tnode, RuntimeSt
 
     for (const auto& conjunct : tnode.hash_join_node.eq_join_conjuncts) {
         _probe_exprs.emplace_back(conjunct.left);
+        _build_exprs.emplace_back(conjunct.right);
     }
     _partitioner = std::make_unique<SpillPartitionerType>(_partition_count);
     RETURN_IF_ERROR(_partitioner->init(_probe_exprs));
+    _probe_repartitioner = std::make_unique<vectorized::SpillRepartitioner>(_partition_count);
+    RETURN_IF_ERROR(_probe_repartitioner->init(_probe_exprs));
+    _build_repartitioner = std::make_unique<vectorized::SpillRepartitioner>(_partition_count);
+    RETURN_IF_ERROR(_build_repartitioner->init(_build_exprs));
 
     return Status::OK();
 }
@@ -514,6 +753,10 @@ Status PartitionedHashJoinProbeOperatorX::prepare(RuntimeState* state) {
     _child = std::move(child);
     RETURN_IF_ERROR(_partitioner->prepare(state, _child->row_desc()));
     RETURN_IF_ERROR(_partitioner->open(state));
+    RETURN_IF_ERROR(_probe_repartitioner->prepare(state, _child->row_desc()));
+    RETURN_IF_ERROR(_probe_repartitioner->open(state));
+    RETURN_IF_ERROR(_build_repartitioner->prepare(state, _build_side_child->row_desc()));
+    RETURN_IF_ERROR(_build_repartitioner->open(state));
     return Status::OK();
 }
 
@@ -646,6 +889,15 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
                                                vectorized::Block* output_block, bool* eos) const {
     auto& local_state = get_local_state(state);
 
+    if (local_state._partition_repartitioned) {
+        // All the data of the partition was moved into the sub partitions.
+        local_state._partition_repartitioned = false;
+        local_state._partition_cursor++;
+        local_state._need_to_setup_internal_operators = true;
+        *eos = local_state._partition_cursor == local_state._partition_levels.size();
+        return Status::OK();
+    }
+
     const auto partition_index = local_state._partition_cursor;
     auto& probe_blocks = local_state._probe_blocks[partition_index];
 
@@ -662,14 +914,30 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
 
     if (local_state._need_to_setup_internal_operators) {
         bool has_data = false;
-        RETURN_IF_ERROR(local_state.recover_build_blocks_from_disk(
-                state, local_state._partition_cursor, has_data));
-        if (has_data) {
-            return Status::OK();
+        if (local_state._need_repartition(partition_index)) {
+            return local_state.repartition(state, partition_index);
+        } else if (local_state._can_build_in_chunks(partition_index)) {
+            // Build with the data recovered so far, the rest is joined with the probe data
+            // again in the next rounds.
+            local_state._build_in_chunks = true;
+        } else {
+            RETURN_IF_ERROR(local_state.recover_build_blocks_from_disk(
+                    state, local_state._partition_cursor, has_data));
+            if (has_data) {
+                return Status::OK();
+            }
         }
 
         *eos = false;
         RETURN_IF_ERROR(local_state.finish_spilling(partition_index));
+        if (local_state._build_in_chunks) {
+            COUNTER_UPDATE(local_state._build_chunks, 1);
+            auto& probe_stream = local_state._probe_spilling_streams[partition_index];
+            if (probe_stream) {
+                local_state._probe_reader = probe_stream->create_separate_reader();
+                local_state._probe_reader->set_counters(local_state.profile());
+            }
+        }
         RETURN_IF_ERROR(_setup_internal_operators(local_state, state));
         local_state._need_to_setup_internal_operators = false;
         auto& mutable_block = local_state._partitioned_blocks[partition_index];
@@ -715,9 +983,23 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
                 " partition:{}, probe done",
                 print_id(state->query_id()), node_id(), state->task_id(),
                 local_state._partition_cursor);
-        local_state._partition_cursor++;
         local_state.update_profile_from_inner();
-        if (local_state._partition_cursor == _partition_count) {
+        if (local_state._build_in_chunks) {
+            if (local_state._shared_state->spilled_streams[partition_index]) {
+                // Join the next chunk of build data with all the probe data again.
+                local_state._need_to_setup_internal_operators = true;
+                return Status::OK();
+            }
+            local_state._build_in_chunks = false;
+            local_state._probe_reader.reset();
+            auto& probe_stream = local_state._probe_spilling_streams[partition_index];
+            if (probe_stream) {
+                ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(probe_stream);
+                probe_stream.reset();
+            }
+        }
+        local_state._partition_cursor++;
+        if (local_state._partition_cursor == local_state._partition_levels.size()) {
             *eos = true;
         } else {
             local_state._need_to_setup_internal_operators = true;
@@ -796,7 +1078,7 @@ size_t PartitionedHashJoinProbeOperatorX::get_reserve_mem_size(RuntimeState* sta
 
         if (_join_op == TJoinOp::FULL_OUTER_JOIN || _join_op == TJoinOp::RIGHT_OUTER_JOIN ||
             _join_op == TJoinOp::RIGHT_ANTI_JOIN || _join_op == TJoinOp::RIGHT_SEMI_JOIN) {
-            size_to_reserve += rows * sizeof(uint8_t); // JoinHashTable::visited
+            size_to_reserve += (rows + 7) / 8; // JoinHashTable::visited
         }
     }
 
@@ -28,6 +28,7 @@
 #include "pipeline/exec/hashjoin_probe_operator.h"
 #include "pipeline/exec/join_build_sink_operator.h"
 #include "pipeline/exec/spill_utils.h"
+#include "vec/spill/spill_reader.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -58,6 +59,10 @@ public:
 
     Status finish_spilling(uint32_t partition_index);
 
+    // Moves all the build and probe data of the partition into new sub partitions, which are
+    // appended after the existing partitions.
+    Status repartition(RuntimeState* state, uint32_t partition_index);
+
     template <bool spilled>
     void update_build_profile(RuntimeProfile* child_profile);
 
@@ -76,8 +81,31 @@ private:
     template <typename LocalStateType>
     friend class StatefulOperatorX;
 
+    struct PartitionLevel {
+        uint32_t level = 0;
+        // false when one sub partition got all the build rows of its parent, the hash can not
+        // split it any further.
+        bool can_split = true;
+    };
+
+    bool _need_repartition(uint32_t partition_index) const;
+    bool _can_build_in_chunks(uint32_t partition_index) const;
+
+    Status _repartition_block(RuntimeState* state, vectorized::PartitionerBase& partitioner,
+                              vectorized::Block& block, const std::string& name,
+                              std::vector<vectorized::SpillStreamSPtr>& streams,
+                              std::vector<size_t>& rows);
+
     std::shared_ptr<BasicSharedState> _in_mem_shared_state_sptr;
     uint32_t _partition_cursor {0};
+    // One for each partition, including the sub partitions created by repartitioning.
+    std::vector<PartitionLevel> _partition_levels;
+    bool _partition_repartitioned {false};
+
+    // The build data of the current partition is too large and can not be split, it is joined
+    // chunk by chunk and the probe data is read again from disk for each chunk.
+    bool _build_in_chunks {false};
+    vectorized::SpillReaderUPtr _probe_reader;
 
     std::unique_ptr<vectorized::Block> _child_block;
     bool _child_eos {false};
@@ -89,6 +117,8 @@ private:
     std::vector<vectorized::SpillStreamSPtr> _probe_spilling_streams;
 
     std::unique_ptr<vectorized::PartitionerBase> _partitioner;
+    std::unique_ptr<vectorized::PartitionerBase> _build_repartitioner;
+    std::unique_ptr<vectorized::PartitionerBase> _probe_repartitioner;
     std::unique_ptr<RuntimeProfile> _internal_runtime_profile;
 
     bool _need_to_setup_internal_operators {true};
@@ -107,6 +137,10 @@ private:
     RuntimeProfile::Counter* _recovery_probe_rows = nullptr;
     RuntimeProfile::Counter* _recovery_probe_blocks = nullptr;
     RuntimeProfile::Counter* _recovery_probe_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_count = nullptr;
+    RuntimeProfile::Counter* _max_repartition_level = nullptr;
+    RuntimeProfile::Counter* _build_chunks = nullptr;
 
     RuntimeProfile::Counter* _probe_blocks_bytes = nullptr;
     RuntimeProfile::Counter* _memory_usage_reserved = nullptr;
@@ -177,6 +211,7 @@ private:
 
     // probe expr
     std::vector<TExpr> _probe_exprs;
+    std::vector<TExpr> _build_exprs;
 
     const std::vector<TExpr> _distribution_partition_exprs;
 
@@ -185,6 +220,8 @@ private:
 
     const uint32_t _partition_count;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner;
+    std::unique_ptr<vectorized::PartitionerBase> _build_repartitioner;
+    std::unique_ptr<vectorized::PartitionerBase> _probe_repartitioner;
 };
 
 } // namespace pipeline
@@ -19,10 +19,16 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
+#include <limits>
+
+#include "common/cast_set.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/exec/spill_utils.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/fragment_mgr.h"
+#include "runtime/query_context.h"
 #include "sort_source_operator.h"
 #include "util/runtime_profile.h"
 #include "vec/spill/spill_stream_manager.h"
@@ -62,9 +68,33 @@ Status SpillSortLocalState::close(RuntimeState* state) {
     return Base::close(state);
 }
 int SpillSortLocalState::_calc_spill_blocks_to_merge(RuntimeState* state) const {
-    int count = state->spill_sort_mem_limit() / state->spill_sort_batch_bytes();
+    int64_t mem_limit = state->spill_sort_mem_limit();
+    // do not plan a fan-in the query has no memory left for
+    if (auto* query_ctx = state->get_query_ctx(); query_ctx && query_ctx->resource_ctx()) {
+        const auto* memory_context = query_ctx->resource_ctx()->memory_context();
+        if (memory_context->mem_limit() > 0) {
+            auto available = memory_context->mem_limit() - memory_context->current_memory_bytes();
+            mem_limit = std::min(mem_limit, std::max<int64_t>(available, 0));
+        }
+    }
+    // every run keeps a block being merged, and one more being read ahead
+    const int64_t bytes_per_run =
+            state->spill_sort_batch_bytes() * (config::enable_spill_async_io ? 2 : 1);
+    auto count = cast_set<int>(std::min<int64_t>(mem_limit / std::max<int64_t>(bytes_per_run, 1),
+                                                 std::numeric_limits<int>::max()));
     return std::max(2, count);
 }
+
+int SpillSortLocalState::_calc_streams_to_merge(int fan_in) const {
+    const auto streams = _shared_state->sorted_streams.size();
+    if (streams <= size_t(fan_in)) {
+        return fan_in;
+    }
+    // Merge just enough runs that each of the later passes, up to the final one, has a full
+    // fan-in. Compared to always merging `fan_in` runs, fewer rows are written and read again.
+    const auto remainder = (streams - 1) % (fan_in - 1);
+    return remainder == 0 ? fan_in : cast_set<int>(remainder + 1);
+}
 Status SpillSortLocalState::initiate_merge_sort_spill_streams(RuntimeState* state) {
     auto& parent = Base::_parent->template cast<Parent>();
     VLOG_DEBUG << fmt::format("Query:{}, sort source:{}, task:{}, merge spill data",
@@ -97,7 +127,7 @@ Status SpillSortLocalState::initiate_merge_sort_spill_streams(RuntimeState* stat
         vectorized::Block merge_sorted_block;
         vectorized::SpillStreamSPtr tmp_stream;
         while (!state->is_cancelled()) {
-            int max_stream_count = _calc_spill_blocks_to_merge(state);
+            int max_stream_count = _calc_streams_to_merge(_calc_spill_blocks_to_merge(state));
             VLOG_DEBUG << fmt::format(
                     "Query:{}, sort source:{}, task:{}, merge spill streams, streams count:{}, "
                     "curren merge max stream count:{}",
@@ -48,6 +48,8 @@ public:
 
 protected:
     int _calc_spill_blocks_to_merge(RuntimeState* state) const;
+    // the number of streams the next merge pass takes with the fan-in
+    int _calc_streams_to_merge(int fan_in) const;
     Status _create_intermediate_merger(int num_blocks,
                                        const vectorized::SortDescription& sort_description);
     friend class SpillSortSourceOperatorX;
@@ -84,6 +84,7 @@ protected:
               _spill_fin_cb(std::move(spill_fin_cb)) {
         _exec_timer = profile->get_counter("ExecTime");
         _spill_total_timer = profile->get_counter("SpillTotalTime");
+        _spill_timer = profile->get_counter(is_write ? "SpillWriteTime" : "SpillRecoverTime");
 
         if (is_write) {
             _spill_write_wait_in_queue_timer =
@@ -116,9 +117,8 @@ public:
         SCOPED_TIMER(_exec_timer);
         SCOPED_TIMER(_spill_total_timer);
 
-        auto* spill_timer = _get_spill_timer();
-        DCHECK(spill_timer != nullptr);
-        SCOPED_TIMER(spill_timer);
+        DCHECK(_spill_timer != nullptr);
+        SCOPED_TIMER(_spill_timer);
 
         _on_task_started(submit_elapsed_time);
 
@@ -169,10 +169,6 @@ protected:
         }
     }
 
-    virtual RuntimeProfile::Counter* _get_spill_timer() {
-        return _profile->get_counter("SpillWriteTime");
-    }
-
     virtual void _on_task_started(uint64_t submit_elapsed_time) {
         VLOG_DEBUG << "Query: " << print_id(_state->query_id())
                    << " spill task started, pipeline task id: " << _state->task_id()
@@ -196,6 +192,8 @@ private:
 
     RuntimeProfile::Counter* _exec_timer = nullptr;
     RuntimeProfile::Counter* _spill_total_timer;
+    // resolved once, the profile lookup by name takes the lock of its counter map
+    RuntimeProfile::Counter* _spill_timer = nullptr;
 
     RuntimeProfile::Counter* _spill_write_wait_in_queue_timer = nullptr;
     RuntimeProfile::Counter* _write_wait_in_queue_task_count = nullptr;
@@ -247,10 +245,6 @@ public:
     }
 
 protected:
-    RuntimeProfile::Counter* _get_spill_timer() override {
-        return _profile->get_counter("SpillRecoverTime");
-    }
-
     void _on_task_started(uint64_t submit_elapsed_time) override {
         LOG(INFO) << "SpillRecoverRunnable, Query: " << print_id(_state->query_id())
                   << " spill task started, pipeline task id: " << _state->task_id()
@@ -19,12 +19,15 @@
 
 #include <gen_cpp/Metrics_types.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
+#include "util/hash_util.hpp"
 #include "vec/exprs/vectorized_agg_fn.h"
 #include "vec/exprs/vslot_ref.h"
 
@@ -77,6 +80,16 @@ static constexpr StreamingHtMinReductionEntry STREAMING_HT_MIN_REDUCTION[] = {
 static constexpr int STREAMING_HT_MIN_REDUCTION_SIZE =
         sizeof(STREAMING_HT_MIN_REDUCTION) / sizeof(STREAMING_HT_MIN_REDUCTION[0]);
 
+/// When `streaming_agg_sample_window_rows` is set, the reduction of a sampling window, i.e. its
+/// rows divided by the number of distinct keys estimated by the sketch, picks the mode of the
+/// next window. A large reduction is worth a big hash table, and an input that is almost unique
+/// is passed through. In between, e.g. a few hot keys and a long tail of rare ones, only the
+/// keys of a small hash table are aggregated and the other rows are passed through.
+static constexpr double PREAGG_FULL_MIN_REDUCTION = 2.0;
+static constexpr double PREAGG_PASS_THROUGH_MAX_REDUCTION = 1.1;
+/// Only one of this many windows is sampled while passing through, to notice the input changed.
+static constexpr size_t PASS_THROUGH_SAMPLE_INTERVAL = 8;
+
 StreamingAggLocalState::StreamingAggLocalState(RuntimeState* state, OperatorXBase* parent)
         : Base(state, parent),
           _agg_arena_pool(std::make_unique<vectorized::Arena>()),
@@ -109,6 +122,12 @@ Status StreamingAggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _get_results_timer = ADD_TIMER(profile(), "GetResultsTime");
     _hash_table_iterate_timer = ADD_TIMER(profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(profile(), "InsertKeysToColumnTime");
+    _preagg_full_windows = ADD_COUNTER(profile(), "PreAggFullWindows", TUnit::UNIT);
+    _preagg_pass_through_windows = ADD_COUNTER(profile(), "PreAggPassThroughWindows", TUnit::UNIT);
+    _preagg_hot_key_windows = ADD_COUNTER(profile(), "PreAggHotKeyCacheWindows", TUnit::UNIT);
+    _preagg_estimated_ndv = ADD_COUNTER(profile(), "PreAggEstimatedNDV", TUnit::UNIT);
+    _hot_key_cache_miss_rows = ADD_COUNTER(profile(), "HotKeyCacheMissRows", TUnit::UNIT);
+    _dict_code_hit_rows_counter = ADD_COUNTER(profile(), "DictCodeHitRows", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -325,11 +344,14 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
                     },
                     [&](auto& agg_method) {
                         auto& hash_tbl = *agg_method.hash_table;
+                        // Once the sketch picked the mode, the hash table heuristics are not used.
+                        const bool use_heuristics = _num_windows == 0;
                         /// If too much memory is used during the pre-aggregation stage,
                         /// it is better to output the data directly without performing further aggregation.
                         // do not try to do agg, just init and serialize directly return the out_block
-                        if (used_too_much_memory || (hash_tbl.add_elem_size_overflow(rows) &&
-                                                     !_should_expand_preagg_hash_tables())) {
+                        if (used_too_much_memory || _preagg_mode == PreAggMode::PASS_THROUGH ||
+                            (use_heuristics && hash_tbl.add_elem_size_overflow(rows) &&
+                             !_should_expand_preagg_hash_tables())) {
                             SCOPED_TIMER(_streaming_agg_timer);
                             ret_flag = true;
                         }
@@ -339,6 +361,159 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
     return ret_flag;
 }
 
+bool StreamingAggLocalState::_need_preagg_sketch() const {
+    if (config::streaming_agg_sample_window_rows <= 0) {
+        return false;
+    }
+    return _preagg_mode != PreAggMode::PASS_THROUGH ||
+           _num_windows % PASS_THROUGH_SAMPLE_INTERVAL == 0;
+}
+
+void StreamingAggLocalState::_update_preagg_sketch(const size_t* hash_values, size_t rows) {
+    for (size_t i = 0; i < rows; ++i) {
+        // The hash of the hash table may be weak, e.g. the identity of small integers.
+        uint64_t hash = hash_values[i];
+        _preagg_sketch.update(
+                HashUtil::murmur_hash64A(&hash, sizeof(hash), HashUtil::MURMUR_SEED));
+    }
+    _sketch_rows += rows;
+}
+
+void StreamingAggLocalState::_sketch_keys(vectorized::ColumnRawPtrs& key_columns, size_t rows) {
+    std::visit(vectorized::Overload {
+                       [&](std::monostate& arg) -> void {
+                           throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
+                       },
+                       [&](auto& agg_method) -> void {
+                           SCOPED_TIMER(_hash_table_compute_timer);
+                           agg_method.init_serialized_keys(key_columns, rows);
+                           _update_preagg_sketch(agg_method.hash_values.data(), rows);
+                       }},
+               _agg_data->method_variant);
+}
+
+void StreamingAggLocalState::_finish_preagg_window(size_t rows) {
+    const auto window_rows = config::streaming_agg_sample_window_rows;
+    if (window_rows <= 0) {
+        return;
+    }
+    _window_rows += rows;
+    if (_window_rows < static_cast<size_t>(window_rows)) {
+        return;
+    }
+    if (_sketch_rows > 0) {
+        _choose_preagg_mode();
+    }
+    _window_rows = 0;
+    _sketch_rows = 0;
+    _preagg_sketch.clear();
+    ++_num_windows;
+}
+
+void StreamingAggLocalState::_choose_preagg_mode() {
+    const auto ndv = std::max<int64_t>(_preagg_sketch.estimate_cardinality(), 1);
+    const double reduction = static_cast<double>(_sketch_rows) / static_cast<double>(ndv);
+    COUNTER_SET(_preagg_estimated_ndv, ndv);
+    if (reduction >= PREAGG_FULL_MIN_REDUCTION) {
+        _preagg_mode = PreAggMode::FULL;
+        COUNTER_UPDATE(_preagg_full_windows, 1);
+    } else if (reduction < PREAGG_PASS_THROUGH_MAX_REDUCTION) {
+        _preagg_mode = PreAggMode::PASS_THROUGH;
+        COUNTER_UPDATE(_preagg_pass_through_windows, 1);
+    } else {
+        _preagg_mode = PreAggMode::HOT_KEY_CACHE;
+        COUNTER_UPDATE(_preagg_hot_key_windows, 1);
+    }
+}
+
+Status StreamingAggLocalState::_output_without_agg(vectorized::Block* in_block,
+                                                   vectorized::ColumnRawPtrs& key_columns,
+                                                   size_t rows, vectorized::Block* out_block) {
+    auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
+    const auto key_size = key_columns.size();
+    bool mem_reuse = p._make_nullable_keys.empty() && out_block->mem_reuse();
+
+    std::vector<vectorized::DataTypePtr> data_types;
+    vectorized::MutableColumns value_columns;
+    for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
+        auto data_type = _aggregate_evaluators[i]->function()->get_serialized_type();
+        if (mem_reuse) {
+            value_columns.emplace_back(
+                    std::move(*out_block->get_by_position(i + key_size).column).mutate());
+        } else {
+            value_columns.emplace_back(
+                    _aggregate_evaluators[i]->function()->create_serialize_column());
+        }
+        data_types.emplace_back(data_type);
+    }
+
+    for (int i = 0; i != _aggregate_evaluators.size(); ++i) {
+        SCOPED_TIMER(_insert_values_to_column_timer);
+        RETURN_IF_ERROR(_aggregate_evaluators[i]->streaming_agg_serialize_to_column(
+                in_block, value_columns[i], rows, _agg_arena_pool.get()));
+    }
+
+    if (!mem_reuse) {
+        vectorized::ColumnsWithTypeAndName columns_with_schema;
+        for (int i = 0; i < key_size; ++i) {
+            columns_with_schema.emplace_back(key_columns[i]->clone_resized(rows),
+                                             _probe_expr_ctxs[i]->root()->data_type(),
+                                             _probe_expr_ctxs[i]->root()->expr_name());
+        }
+        for (int i = 0; i < value_columns.size(); ++i) {
+            columns_with_schema.emplace_back(std::move(value_columns[i]), data_types[i], "");
+        }
+        out_block->swap(vectorized::Block(columns_with_schema));
+    } else {
+        for (int i = 0; i < key_size; ++i) {
+            std::move(*out_block->get_by_position(i).column)
+                    .mutate()
+                    ->insert_range_from(*key_columns[i], 0, rows);
+        }
+    }
+    return Status::OK();
+}
+
+Status StreamingAggLocalState::_pre_agg_with_hot_key_cache(
+        vectorized::Block* in_block, const std::vector<int>& key_column_ids,
+        vectorized::Block* out_block) {
+    auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
+    const auto rows = in_block->rows();
+    vectorized::ColumnRawPtrs key_columns(key_column_ids.size());
+    for (size_t i = 0; i < key_column_ids.size(); ++i) {
+        key_columns[i] = in_block->get_by_position(key_column_ids[i]).column.get();
+    }
+
+    const auto hot_key_cache_size =
+            static_cast<size_t>(std::max(config::streaming_agg_hot_key_cache_size, 1));
+    _emplace_into_hash_table(_places.data(), key_columns, rows, hot_key_cache_size);
+    for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
+        RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add_selected(
+                in_block, p._offsets_of_aggregate_states[i], _places.data(),
+                _agg_arena_pool.get()));
+    }
+
+    vectorized::IColumn::Filter miss_filter(rows);
+    size_t miss_rows = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        miss_filter[i] = _places[i] == nullptr;
+        miss_rows += miss_filter[i];
+    }
+    if (miss_rows == 0) {
+        return Status::OK();
+    }
+
+    // The rows of the keys not in the cache are passed through.
+    COUNTER_UPDATE(_hot_key_cache_miss_rows, miss_rows);
+    if (miss_rows < rows) {
+        vectorized::Block::filter_block_internal(in_block, miss_filter);
+    }
+    for (size_t i = 0; i < key_column_ids.size(); ++i) {
+        key_columns[i] = in_block->get_by_position(key_column_ids[i]).column.get();
+    }
+    return _output_without_agg(in_block, key_columns, miss_rows, out_block);
+}
+
 Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                                             doris::vectorized::Block* out_block) {
     SCOPED_TIMER(_build_timer);
@@ -348,6 +523,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
 
     size_t key_size = _probe_expr_ctxs.size();
     vectorized::ColumnRawPtrs key_columns(key_size);
+    std::vector<int> key_column_ids(key_size);
     {
         SCOPED_TIMER(_expr_timer);
         for (size_t i = 0; i < key_size; ++i) {
@@ -357,6 +533,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                     in_block->get_by_position(result_column_id)
                             .column->convert_to_full_column_if_const();
             key_columns[i] = in_block->get_by_position(result_column_id).column.get();
+            key_column_ids[i] = result_column_id;
         }
     }
 
@@ -364,48 +541,18 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
     _places.resize(rows);
 
     if (_should_not_do_pre_agg(rows)) {
-        bool mem_reuse = p._make_nullable_keys.empty() && out_block->mem_reuse();
-
-        std::vector<vectorized::DataTypePtr> data_types;
-        vectorized::MutableColumns value_columns;
-        for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
-            auto data_type = _aggregate_evaluators[i]->function()->get_serialized_type();
-            if (mem_reuse) {
-                value_columns.emplace_back(
-                        std::move(*out_block->get_by_position(i + key_size).column).mutate());
-            } else {
-                value_columns.emplace_back(
-                        _aggregate_evaluators[i]->function()->create_serialize_column());
-            }
-            data_types.emplace_back(data_type);
+        if (_need_preagg_sketch()) {
+            _sketch_keys(key_columns, rows);
         }
-
-        for (int i = 0; i != _aggregate_evaluators.size(); ++i) {
-            SCOPED_TIMER(_insert_values_to_column_timer);
-            RETURN_IF_ERROR(_aggregate_evaluators[i]->streaming_agg_serialize_to_column(
-                    in_block, value_columns[i], rows, _agg_arena_pool.get()));
-        }
-
-        if (!mem_reuse) {
-            vectorized::ColumnsWithTypeAndName columns_with_schema;
-            for (int i = 0; i < key_size; ++i) {
-                columns_with_schema.emplace_back(key_columns[i]->clone_resized(rows),
-                                                 _probe_expr_ctxs[i]->root()->data_type(),
-                                                 _probe_expr_ctxs[i]->root()->expr_name());
-            }
-            for (int i = 0; i < value_columns.size(); ++i) {
-                columns_with_schema.emplace_back(std::move(value_columns[i]), data_types[i], "");
-            }
-            out_block->swap(vectorized::Block(columns_with_schema));
+        RETURN_IF_ERROR(_output_without_agg(in_block, key_columns, rows, out_block));
+    } else if (_preagg_mode == PreAggMode::HOT_KEY_CACHE) {
+        RETURN_IF_ERROR(_pre_agg_with_hot_key_cache(in_block, key_column_ids, out_block));
+    } else {
+        if (config::enable_dict_code_aggregation && key_size == 1 && !_should_limit_output) {
+            _emplace_with_dict_codes(_places.data(), in_block, key_columns, rows);
         } else {
-            for (int i = 0; i < key_size; ++i) {
-                std::move(*out_block->get_by_position(i).column)
-                        .mutate()
-                        ->insert_range_from(*key_columns[i], 0, rows);
-            }
+            _emplace_into_hash_table(_places.data(), key_columns, rows);
         }
-    } else {
-        _emplace_into_hash_table(_places.data(), key_columns, rows);
 
         for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
             RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add(
@@ -413,6 +560,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                     _agg_arena_pool.get(), _should_expand_hash_table));
         }
     }
+    _finish_preagg_window(rows);
 
     return Status::OK();
 }
@@ -564,7 +712,8 @@ void StreamingAggLocalState::_destroy_agg_status(vectorized::AggregateDataPtr da
 
 void StreamingAggLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* places,
                                                       vectorized::ColumnRawPtrs& key_columns,
-                                                      const size_t num_rows) {
+                                                      const size_t num_rows,
+                                                      size_t hot_key_cache_size) {
     std::visit(vectorized::Overload {
                        [&](std::monostate& arg) -> void {
                            throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
@@ -575,6 +724,9 @@ void StreamingAggLocalState::_emplace_into_hash_table(vectorized::AggregateDataP
                            using AggState = typename HashMethodType::State;
                            AggState state(key_columns);
                            agg_method.init_serialized_keys(key_columns, num_rows);
+                           if (_need_preagg_sketch()) {
+                               _update_preagg_sketch(agg_method.hash_values.data(), num_rows);
+                           }
 
                            auto creator = [this](const auto& ctor, auto& key, auto& origin) {
                                HashMethodType::try_presis_key_and_origin(key, origin,
@@ -600,9 +752,22 @@ void StreamingAggLocalState::_emplace_into_hash_table(vectorized::AggregateDataP
                            };
 
                            SCOPED_TIMER(_hash_table_emplace_timer);
-                           for (size_t i = 0; i < num_rows; ++i) {
-                               places[i] = *agg_method.lazy_emplace(state, i, creator,
-                                                                    creator_for_null_key);
+                           if (hot_key_cache_size == 0) {
+                               for (size_t i = 0; i < num_rows; ++i) {
+                                   places[i] = *agg_method.lazy_emplace(state, i, creator,
+                                                                        creator_for_null_key);
+                               }
+                           } else {
+                               for (size_t i = 0; i < num_rows; ++i) {
+                                   if (agg_method.hash_table->size() < hot_key_cache_size) {
+                                       places[i] = *agg_method.lazy_emplace(state, i, creator,
+                                                                            creator_for_null_key);
+                                       continue;
+                                   }
+                                   auto find_result = agg_method.find(state, i);
+                                   places[i] = find_result.is_found() ? find_result.get_mapped()
+                                                                      : nullptr;
+                               }
                            }
 
                            COUNTER_UPDATE(_hash_table_input_counter, num_rows);
@@ -610,6 +775,30 @@ void StreamingAggLocalState::_emplace_into_hash_table(vectorized::AggregateDataP
                _agg_data->method_variant);
 }
 
+void StreamingAggLocalState::_emplace_with_dict_codes(vectorized::AggregateDataPtr* places,
+                                                      vectorized::Block* block,
+                                                      vectorized::ColumnRawPtrs& key_columns,
+                                                      size_t num_rows) {
+    const auto* codes = block->get_dict_codes(key_columns[0]);
+    if (codes == nullptr) {
+        _emplace_into_hash_table(places, key_columns, num_rows);
+        return;
+    }
+    auto hit_rows = _dict_code_places.find_or_emplace(
+            *codes, *key_columns[0], places, num_rows,
+            [&](vectorized::IColumn& miss_keys, vectorized::AggregateDataPtr* miss_places,
+                size_t num_misses) {
+                vectorized::ColumnRawPtrs miss_key_columns {&miss_keys};
+                _emplace_into_hash_table(miss_places, miss_key_columns, num_misses);
+            });
+    // The hit rows repeat keys seen before, they only add to the rows of the window.
+    if (_need_preagg_sketch()) {
+        _sketch_rows += hit_rows;
+    }
+    COUNTER_UPDATE(_dict_code_hit_rows_counter, hit_rows);
+    COUNTER_UPDATE(_hash_table_input_counter, hit_rows);
+}
+
 StreamingAggOperatorX::StreamingAggOperatorX(ObjectPool* pool, int operator_id,
                                              const TPlanNode& tnode, const DescriptorTbl& descs)
         : StatefulOperatorX<StreamingAggLocalState>(pool, tnode, operator_id, descs),
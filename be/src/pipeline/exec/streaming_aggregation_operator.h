@@ -22,6 +22,7 @@
 #include <memory>
 
 #include "common/status.h"
+#include "olap/hll.h"
 #include "pipeline/exec/operator.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
@@ -54,6 +55,15 @@ private:
     template <typename LocalStateType>
     friend class StatefulOperatorX;
 
+    enum class PreAggMode : uint8_t {
+        // aggregate all the rows, the hash table may grow
+        FULL,
+        // output all the rows without aggregation
+        PASS_THROUGH,
+        // aggregate the rows whose key is in a small hash table, output the others
+        HOT_KEY_CACHE,
+    };
+
     size_t _memory_usage() const;
     Status _pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                         doris::vectorized::Block* out_block);
@@ -61,13 +71,34 @@ private:
 
     MOCK_FUNCTION bool _should_not_do_pre_agg(size_t rows);
 
+    // The group keys of a sampling window are counted by a HLL sketch, which decides the
+    // pre-aggregation mode of the next window.
+    bool _need_preagg_sketch() const;
+    void _update_preagg_sketch(const size_t* hash_values, size_t rows);
+    void _sketch_keys(vectorized::ColumnRawPtrs& key_columns, size_t rows);
+    void _finish_preagg_window(size_t rows);
+    void _choose_preagg_mode();
+
+    Status _pre_agg_with_hot_key_cache(vectorized::Block* in_block,
+                                       const std::vector<int>& key_column_ids,
+                                       vectorized::Block* out_block);
+    Status _output_without_agg(vectorized::Block* in_block, vectorized::ColumnRawPtrs& key_columns,
+                               size_t rows, vectorized::Block* out_block);
+
     Status _execute_with_serialized_key(vectorized::Block* block);
     void _update_memusage_with_serialized_key();
     Status _init_hash_method(const vectorized::VExprContextSPtrs& probe_exprs);
     Status _get_results_with_serialized_key(RuntimeState* state, vectorized::Block* block,
                                             bool* eos);
+    // With a non zero `hot_key_cache_size`, new keys are only inserted while the table has fewer
+    // keys, and the rows of the other new keys get a nullptr place.
     void _emplace_into_hash_table(vectorized::AggregateDataPtr* places,
-                                  vectorized::ColumnRawPtrs& key_columns, const size_t num_rows);
+                                  vectorized::ColumnRawPtrs& key_columns, const size_t num_rows,
+                                  size_t hot_key_cache_size = 0);
+    // A single string key of a block with dictionary codes finds its states by code, see
+    // config::enable_dict_code_aggregation.
+    void _emplace_with_dict_codes(vectorized::AggregateDataPtr* places, vectorized::Block* block,
+                                  vectorized::ColumnRawPtrs& key_columns, size_t num_rows);
     Status _create_agg_status(vectorized::AggregateDataPtr data);
     size_t _get_hash_table_size();
 
@@ -86,8 +117,20 @@ private:
     RuntimeProfile::Counter* _get_results_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_iterate_timer = nullptr;
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
+    RuntimeProfile::Counter* _preagg_full_windows = nullptr;
+    RuntimeProfile::Counter* _preagg_pass_through_windows = nullptr;
+    RuntimeProfile::Counter* _preagg_hot_key_windows = nullptr;
+    RuntimeProfile::Counter* _preagg_estimated_ndv = nullptr;
+    RuntimeProfile::Counter* _hot_key_cache_miss_rows = nullptr;
+    RuntimeProfile::Counter* _dict_code_hit_rows_counter = nullptr;
 
     bool _should_expand_hash_table = true;
+    PreAggMode _preagg_mode = PreAggMode::FULL;
+    HyperLogLog _preagg_sketch;
+    // input rows of the current sampling window, and how many of them are in the sketch
+    size_t _window_rows = 0;
+    size_t _sketch_rows = 0;
+    size_t _num_windows = 0;
     int64_t _cur_num_rows_returned = 0;
     std::unique_ptr<vectorized::Arena> _agg_arena_pool = nullptr;
     AggregatedDataVariantsUPtr _agg_data = nullptr;
@@ -98,6 +141,7 @@ private:
     std::unique_ptr<AggregateDataContainer> _aggregate_data_container = nullptr;
     bool _should_limit_output = false;
     bool _reach_limit = false;
+    AggDictCodePlaces _dict_code_places;
     size_t _input_num_rows = 0;
 
     vectorized::PODArray<vectorized::AggregateDataPtr> _places;
@@ -172,6 +172,12 @@ Status TableFunctionLocalState::get_expanded_block(RuntimeState* state,
             break;
         }
 
+        // a single table function expands many child rows at once
+        if (p._fn_num == 1 && _cur_child_offset != -1 && _current_row_insert_times == 0 &&
+            _fns[0]->at_row_start() && _get_batch_values(state, columns)) {
+            continue;
+        }
+
         bool skip_child_row = false;
         while (columns[p._child_slots.size()]->size() < state->batch_size()) {
             int idx = _find_last_fn_eos_idx();
@@ -226,6 +232,38 @@ Status TableFunctionLocalState::get_expanded_block(RuntimeState* state,
     return Status::OK();
 }
 
+bool TableFunctionLocalState::_get_batch_values(RuntimeState* state,
+                                                vectorized::MutableColumns& columns) {
+    auto& p = _parent->cast<TableFunctionOperatorX>();
+    auto& fn_column = columns[p._child_slots.size()];
+    auto start = static_cast<size_t>(_cur_child_offset);
+    _batch_offsets.clear();
+    size_t num_rows = _fns[0]->get_batch_values(start, _child_block->rows() - start, fn_column,
+                                                state->batch_size() - fn_column->size(),
+                                                _batch_offsets);
+    if (num_rows == 0) {
+        // the results of the current row don't fit, go on row by row
+        return false;
+    }
+
+    // replicate the child rows by their numbers of results
+    _batch_row_indices.resize(_batch_offsets.back());
+    for (size_t i = 0; i < num_rows; ++i) {
+        std::fill(_batch_row_indices.begin() + (i == 0 ? 0 : _batch_offsets[i - 1]),
+                  _batch_row_indices.begin() + _batch_offsets[i],
+                  static_cast<uint32_t>(start + i));
+    }
+    for (auto index : p._output_slot_indexs) {
+        columns[index]->insert_indices_from(*_child_block->get_by_position(index).column,
+                                            _batch_row_indices.data(),
+                                            _batch_row_indices.data() + _batch_row_indices.size());
+    }
+
+    _cur_child_offset = static_cast<int64_t>(start + num_rows - 1);
+    process_next_child_row();
+    return true;
+}
+
 void TableFunctionLocalState::process_next_child_row() {
     _cur_child_offset++;
 
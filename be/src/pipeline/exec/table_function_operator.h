@@ -64,12 +64,17 @@ private:
     // >0: some of fns are eos
     int _find_last_fn_eos_idx() const;
     bool _is_inner_and_empty();
+    // Expand the child rows from the current one by the batch interface of the only table
+    // function. Return false if nothing is expanded.
+    bool _get_batch_values(RuntimeState* state, vectorized::MutableColumns& columns);
 
     std::vector<vectorized::TableFunction*> _fns;
     vectorized::VExprContextSPtrs _vfn_ctxs;
     int64_t _cur_child_offset = -1;
     std::unique_ptr<vectorized::Block> _child_block;
     int _current_row_insert_times = 0;
+    vectorized::IColumn::Offsets _batch_offsets;
+    std::vector<uint32_t> _batch_row_indices;
     bool _child_eos = false;
 
     RuntimeProfile::Counter* _init_function_timer = nullptr;
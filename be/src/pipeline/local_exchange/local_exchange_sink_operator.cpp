@@ -82,6 +82,7 @@ Status LocalExchangeSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     SCOPED_TIMER(_init_timer);
     _compute_hash_value_timer = ADD_TIMER(profile(), "ComputeHashValueTime");
     _distribute_timer = ADD_TIMER(profile(), "DistributeDataTime");
+    _skew_rebalanced_rows_counter = ADD_COUNTER(profile(), "SkewRebalancedRows", TUnit::UNIT);
     if (_parent->cast<LocalExchangeSinkOperatorX>()._type == ExchangeType::HASH_SHUFFLE) {
         _profile->add_info_string(
                 "UseGlobalShuffle",
@@ -146,7 +147,8 @@ Status LocalExchangeSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
     }
     RETURN_IF_ERROR(local_state._exchanger->sink(
             state, in_block, eos,
-            {local_state._compute_hash_value_timer, local_state._distribute_timer, nullptr},
+            {local_state._compute_hash_value_timer, local_state._distribute_timer, nullptr,
+             local_state._skew_rebalanced_rows_counter},
             {&local_state._channel_id, local_state._partitioner.get(), &local_state,
              &_shuffle_idx_to_instance_idx}));
 
@@ -62,6 +62,7 @@ private:
     // Used by shuffle exchanger
     RuntimeProfile::Counter* _compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* _distribute_timer = nullptr;
+    RuntimeProfile::Counter* _skew_rebalanced_rows_counter = nullptr;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner = nullptr;
 
     // Used by random passthrough exchanger
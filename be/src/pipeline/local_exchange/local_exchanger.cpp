@@ -18,6 +18,7 @@
 #include "pipeline/local_exchange/local_exchanger.h"
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
@@ -125,7 +126,8 @@ Status ShuffleExchanger::sink(RuntimeState* state, vectorized::Block* in_block,
         SCOPED_TIMER(profile.distribute_timer);
         RETURN_IF_ERROR(_split_rows(state, sink_info.partitioner->get_channel_ids().get<uint32_t>(),
                                     in_block, *sink_info.channel_id, sink_info.local_state,
-                                    sink_info.shuffle_idx_to_instance_idx));
+                                    sink_info.shuffle_idx_to_instance_idx,
+                                    profile.skew_rebalanced_rows_counter));
     }
 
     sink_info.local_state->_memory_used_counter->set(
@@ -172,10 +174,21 @@ Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block
     return Status::OK();
 }
 
+bool ShuffleExchanger::_is_skewed(int instance_idx) const {
+    int64_t total_rows = _total_enqueued_rows;
+    if (config::local_exchange_skew_factor <= 0 ||
+        total_rows < config::local_exchange_skew_min_rows || _num_sources <= 1) {
+        return false;
+    }
+    return double(_enqueued_rows[instance_idx]) >
+           config::local_exchange_skew_factor * double(total_rows) / _num_sources;
+}
+
 Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                                      vectorized::Block* block, int channel_id,
                                      LocalExchangeSinkLocalState* local_state,
-                                     std::map<int, int>* shuffle_idx_to_instance_idx) {
+                                     std::map<int, int>* shuffle_idx_to_instance_idx,
+                                     RuntimeProfile::Counter* skew_rebalanced_rows_counter) {
     if (local_state == nullptr) {
         return _split_rows(state, channel_ids, block, channel_id);
     }
@@ -221,12 +234,38 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
                 << it.first << " : " << it.second << " " << _num_partitions;
         uint32_t start = partition_rows_histogram[it.first];
         uint32_t size = partition_rows_histogram[it.first + 1] - start;
-        if (size > 0) {
-            enqueue_rows += size;
+        if (size == 0) {
+            continue;
+        }
+        enqueue_rows += size;
+        if (_allow_key_split && _is_skewed(it.second)) {
+            // The rows of a skewed instance are split into chunks and spread round-robin over all
+            // the instances, so that one heavy key does not overload one task.
+            uint32_t chunk_size =
+                    std::max(size / cast_set<uint32_t>(_num_sources), MIN_SKEW_CHUNK_ROWS);
+            for (uint32_t offset = 0; offset < size; offset += chunk_size) {
+                uint32_t chunk_rows = std::min(chunk_size, size - offset);
+                auto instance_idx = cast_set<int>(_rebalance_idx.fetch_add(1) %
+                                                  cast_set<uint32_t>(_num_sources));
+                _enqueued_rows[instance_idx] += chunk_rows;
+                _enqueue_data_and_set_ready(instance_idx, local_state,
+                                            {new_block_wrapper, {row_idx, start + offset,
+                                                                 chunk_rows}});
+            }
+            if (skew_rebalanced_rows_counter) {
+                COUNTER_UPDATE(skew_rebalanced_rows_counter, size);
+            }
+        } else {
+            if (_allow_key_split) {
+                _enqueued_rows[it.second] += size;
+            }
             _enqueue_data_and_set_ready(it.second, local_state,
                                         {new_block_wrapper, {row_idx, start, size}});
         }
     }
+    if (_allow_key_split) {
+        _total_enqueued_rows += enqueue_rows;
+    }
     if (enqueue_rows != rows) [[unlikely]] {
         fmt::memory_buffer debug_string_buffer;
         fmt::format_to(debug_string_buffer, "Type: {}, Local Exchange Id: {}, Shuffled Map: ",
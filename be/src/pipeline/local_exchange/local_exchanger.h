@@ -37,6 +37,7 @@ struct Profile {
     RuntimeProfile::Counter* compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* distribute_timer = nullptr;
     RuntimeProfile::Counter* copy_data_timer = nullptr;
+    RuntimeProfile::Counter* skew_rebalanced_rows_counter = nullptr;
 };
 
 struct SinkInfo {
@@ -273,12 +274,19 @@ class ShuffleExchanger : public Exchanger<PartitionedBlock> {
 public:
     ENABLE_FACTORY_CREATOR(ShuffleExchanger);
     ShuffleExchanger(int running_sink_operators, int num_sources, int num_partitions,
-                     int free_block_limit)
+                     int free_block_limit, bool allow_key_split = false)
             : Exchanger<PartitionedBlock>(running_sink_operators, num_sources, num_partitions,
-                                          free_block_limit) {
+                                          free_block_limit),
+              _allow_key_split(allow_key_split) {
         DCHECK_GT(num_partitions, 0);
         DCHECK_GT(num_sources, 0);
         _partition_rows_histogram.resize(running_sink_operators);
+        if (_allow_key_split) {
+            _enqueued_rows.reset(new std::atomic<int64_t>[num_sources]);
+            for (int i = 0; i < num_sources; ++i) {
+                _enqueued_rows[i] = 0;
+            }
+        }
     }
     ~ShuffleExchanger() override = default;
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos, Profile&& profile,
@@ -293,10 +301,20 @@ protected:
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, int channel_id,
                        LocalExchangeSinkLocalState* local_state,
-                       std::map<int, int>* shuffle_idx_to_instance_idx);
+                       std::map<int, int>* shuffle_idx_to_instance_idx,
+                       RuntimeProfile::Counter* skew_rebalanced_rows_counter = nullptr);
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, int channel_id);
+    // Whether `instance_idx` has received much more rows than the average of all instances.
+    bool _is_skewed(int instance_idx) const;
     std::vector<std::vector<uint32_t>> _partition_rows_histogram;
+
+    // skew detection, only used if `_allow_key_split` is true
+    static constexpr uint32_t MIN_SKEW_CHUNK_ROWS = 1024;
+    const bool _allow_key_split;
+    std::unique_ptr<std::atomic<int64_t>[]> _enqueued_rows;
+    std::atomic<int64_t> _total_enqueued_rows = 0;
+    std::atomic<uint32_t> _rebalance_idx = 0;
 };
 
 class BucketShuffleExchanger final : public ShuffleExchanger {
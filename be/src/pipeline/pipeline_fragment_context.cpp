@@ -264,6 +264,8 @@ Status PipelineFragmentContext::prepare(const doris::TPipelineFragmentParams& re
     _plan_local_exchanger_timer = ADD_TIMER(_fragment_level_profile, "PlanLocalLocalExchangerTime");
     _build_tasks_timer = ADD_TIMER(_fragment_level_profile, "BuildTasksTime");
     _prepare_all_pipelines_timer = ADD_TIMER(_fragment_level_profile, "PrepareAllPipelinesTime");
+    _parked_task_counter =
+            ADD_COUNTER(_fragment_level_profile, "AdaptiveParkedTaskTimes", TUnit::UNIT);
     {
         SCOPED_TIMER(_init_context_timer);
         cast_set(_num_instances, request.local_params.size());
@@ -770,7 +772,8 @@ Status PipelineFragmentContext::_add_local_exchange_impl(
                 _runtime_state->query_options().__isset.local_exchange_free_blocks_limit
                         ? cast_set<int>(
                                   _runtime_state->query_options().local_exchange_free_blocks_limit)
-                        : 0);
+                        : 0,
+                data_distribution.allow_key_split && !use_global_hash_shuffle);
         break;
     case ExchangeType::BUCKET_HASH_SHUFFLE:
         shared_state->exchanger = BucketShuffleExchanger::create_unique(
@@ -1189,7 +1192,8 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
     case TPlanNodeType::OLAP_SCAN_NODE: {
         op.reset(new OlapScanOperatorX(
                 pool, tnode, next_operator_id(), descs, _num_instances,
-                enable_query_cache ? request.fragment.query_cache_param : TQueryCacheParam {}));
+                enable_query_cache ? request.fragment.query_cache_param : TQueryCacheParam {},
+                enable_query_cache && _query_cache_allow_incremental));
         RETURN_IF_ERROR(cur_pipe->add_operator(
                 op, request.__isset.parallel_instances ? request.parallel_instances : 0));
         fe_with_old_version = !tnode.__isset.is_serial_operator;
@@ -1254,8 +1258,11 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
         auto create_query_cache_operator = [&](PipelinePtr& new_pipe) {
             auto cache_node_id = request.local_params[0].per_node_scan_ranges.begin()->first;
             auto cache_source_id = next_operator_id();
+            // the partial agg results of the cached and the new rowsets are merged downstream
+            _query_cache_allow_incremental = !tnode.agg_node.need_finalize;
             op.reset(new CacheSourceOperatorX(pool, cache_node_id, cache_source_id,
-                                              request.fragment.query_cache_param));
+                                              request.fragment.query_cache_param,
+                                              _query_cache_allow_incremental));
             RETURN_IF_ERROR(cur_pipe->add_operator(
                     op, request.__isset.parallel_instances ? request.parallel_instances : 0));
 
@@ -1717,6 +1724,21 @@ Status PipelineFragmentContext::_build_operators_for_set_operation_node(
     return Status::OK();
 }
 
+bool PipelineFragmentContext::try_acquire_execution_slot(int64_t runnable_tasks, int cores) {
+    int limit = _total_tasks;
+    if (runnable_tasks > cores && cores > 0) {
+        // Every fragment keeps its share of the executors: total_tasks * cores / queue depth.
+        limit = std::max(config::adaptive_pipeline_min_running_tasks,
+                         int(int64_t(_total_tasks) * cores / runnable_tasks));
+    }
+    if (_executing_tasks.fetch_add(1) >= limit) {
+        _executing_tasks--;
+        COUNTER_UPDATE(_parked_task_counter, 1);
+        return false;
+    }
+    return true;
+}
+
 Status PipelineFragmentContext::submit() {
     if (_submitted) {
         return Status::InternalError("submitted");
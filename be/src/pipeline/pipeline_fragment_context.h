@@ -99,6 +99,13 @@ public:
 
     void decrement_running_task(PipelineId pipeline_id);
 
+    // Adaptive parallelism: when the scheduler is oversubscribed, only a part of the tasks of
+    // this fragment is allowed to execute at the same time and the others are parked back to
+    // the runnable queue. `runnable_tasks` is the queue depth of the scheduler and `cores` is
+    // the number of executors. Return false if the task should be parked.
+    bool try_acquire_execution_slot(int64_t runnable_tasks, int cores);
+    void release_execution_slot() { _executing_tasks--; }
+
     Status send_report(bool);
 
     void trigger_report_if_necessary();
@@ -206,6 +213,10 @@ private:
     RuntimeProfile::Counter* _plan_local_exchanger_timer = nullptr;
     RuntimeProfile::Counter* _prepare_all_pipelines_timer = nullptr;
     RuntimeProfile::Counter* _build_tasks_timer = nullptr;
+    RuntimeProfile::Counter* _parked_task_counter = nullptr;
+
+    // number of tasks executing by the scheduler now, used by adaptive parallelism
+    std::atomic<int> _executing_tasks = 0;
 
     std::function<void(RuntimeState*, Status*)> _call_back;
     bool _is_fragment_instance_closed = false;
@@ -323,6 +334,10 @@ private:
     // Total instance num running on all BEs
     int _total_instances = -1;
     bool _require_bucket_distribution = false;
+
+    // Whether the cached result of the query cache agg can be refreshed by scanning only the
+    // newly loaded rowsets. Set by the agg node and read by the olap scan node below it.
+    bool _query_cache_allow_incremental = false;
 };
 } // namespace pipeline
 } // namespace doris
\ No newline at end of file
@@ -23,6 +23,7 @@
 #include <glog/logging.h>
 
 #include <ostream>
+#include <thread>
 #include <vector>
 
 #include "common/logging.h"
@@ -40,9 +41,12 @@
 #include "runtime/thread_context.h"
 #include "runtime/workload_group/workload_group_manager.h"
 #include "util/container_util.hpp"
+#include "util/cpu_info.h"
 #include "util/defer_op.h"
 #include "util/mem_info.h"
+#include "util/perf_counters.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/spill/spill_stream.h"
@@ -81,6 +85,7 @@ PipelineTask::PipelineTask(PipelinePtr& pipeline, uint32_t task_id, RuntimeState
           _execution_dep(state->get_query_ctx()->get_execution_dependency()),
           _memory_sufficient_dependency(state->get_query_ctx()->get_memory_sufficient_dependency()),
           _pipeline_name(_pipeline->name()) {
+    _trace_sampled = state->get_query_ctx()->pipeline_trace_sampled();
     if (!_shared_state_map.contains(_sink->dests_id().front())) {
         auto shared_state = _sink->create_shared_state();
         if (shared_state) {
@@ -214,6 +219,10 @@ bool PipelineTask::inject_shared_state(std::shared_ptr<BasicSharedState> shared_
 void PipelineTask::_init_profile() {
     _task_profile =
             std::make_unique<RuntimeProfile>(fmt::format("PipelineTask (index={})", _index));
+    if (_state->profile_timers_disabled()) {
+        // before the counters and the profiles of the operators are added
+        _task_profile->set_timers_disabled();
+    }
     _parent_profile->add_child(_task_profile.get(), true, nullptr);
     _task_cpu_timer = ADD_TIMER(_task_profile, "TaskCpuTime");
 
@@ -234,6 +243,17 @@ void PipelineTask::_init_profile() {
     _memory_reserve_times = ADD_COUNTER(_task_profile, "MemoryReserveTimes", TUnit::UNIT);
     _memory_reserve_failed_times =
             ADD_COUNTER(_task_profile, "MemoryReserveFailedTimes", TUnit::UNIT);
+
+    if (config::enable_pipeline_task_perf_counters) {
+        for (int event = 0; event < ThreadPerfCounters::NUM_EVENTS; ++event) {
+            const auto* name =
+                    ThreadPerfCounters::event_name(static_cast<ThreadPerfCounters::Event>(event));
+            _get_block_perf_counters.push_back(ADD_CHILD_COUNTER(
+                    _task_profile, fmt::format("GetBlock{}", name), TUnit::UNIT, "GetBlockTime"));
+            _sink_perf_counters.push_back(ADD_CHILD_COUNTER(
+                    _task_profile, fmt::format("Sink{}", name), TUnit::UNIT, "SinkTime"));
+        }
+    }
 }
 
 void PipelineTask::_fresh_profile_counter() {
@@ -336,6 +356,38 @@ void PipelineTask::terminate() {
     }
 }
 
+namespace {
+// Adds the hardware events counted by the executing thread during the scope to the counters.
+class ScopedTaskPerfCounters {
+public:
+    explicit ScopedTaskPerfCounters(const std::vector<RuntimeProfile::Counter*>& counters)
+            : _counters(counters) {
+        if (_counters.empty()) {
+            return;
+        }
+        _thread_counters = ThreadPerfCounters::current();
+        if (_thread_counters != nullptr && !_thread_counters->read(&_start)) {
+            _thread_counters = nullptr;
+        }
+    }
+
+    ~ScopedTaskPerfCounters() {
+        ThreadPerfCounters::Values end;
+        if (_thread_counters == nullptr || !_thread_counters->read(&end)) {
+            return;
+        }
+        for (size_t i = 0; i < _counters.size(); ++i) {
+            COUNTER_UPDATE(_counters[i], end[i] - _start[i]);
+        }
+    }
+
+private:
+    const std::vector<RuntimeProfile::Counter*>& _counters;
+    const ThreadPerfCounters* _thread_counters = nullptr;
+    ThreadPerfCounters::Values _start;
+};
+} // namespace
+
 /**
  * `_eos` indicates whether the execution phase is done. `done` indicates whether we could close
  * this task.
@@ -476,6 +528,7 @@ Status PipelineTask::execute(bool* done) {
         // run, so we will resume execution using the block.
         if (!_eos && _block->empty()) {
             SCOPED_TIMER(_get_block_timer);
+            ScopedTaskPerfCounters get_block_perf_counters(_get_block_perf_counters);
             if (_state->low_memory_mode()) {
                 _sink->set_low_memory_mode(_state);
                 _root->set_low_memory_mode(_state);
@@ -503,6 +556,7 @@ Status PipelineTask::execute(bool* done) {
 
         if (!_block->empty() || _eos) {
             SCOPED_TIMER(_sink_timer);
+            ScopedTaskPerfCounters sink_perf_counters(_sink_perf_counters);
             Status status = Status::OK();
             DEFER_RELEASE_RESERVED();
             COUNTER_UPDATE(_memory_reserve_times, 1);
@@ -584,6 +638,15 @@ bool PipelineTask::_try_to_reserve_memory(const size_t reserve_size, OperatorBas
         sink_revocable_mem_size >= vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM) {
         st = Status(ErrorCode::QUERY_MEMORY_EXCEEDED, "Force Spill");
     }
+    // Spill the large revocable memory ahead of the soft limit, so the query is slower but not
+    // cancelled by the memory gc when the process runs out of memory later.
+    if (st.ok() && _sink->is_spillable() &&
+        sink_revocable_mem_size >=
+                std::max<size_t>(config::spill_ahead_min_revocable_bytes,
+                                 vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM) &&
+        GlobalMemoryArbitrator::is_exceed_spill_ahead_mem_limit()) {
+        st = Status(ErrorCode::QUERY_MEMORY_EXCEEDED, "Spill Ahead");
+    }
     if (!st.ok()) {
         COUNTER_UPDATE(_memory_reserve_failed_times, 1);
         auto debug_msg = fmt::format(
@@ -789,13 +852,54 @@ Status PipelineTask::revoke_memory(const std::shared_ptr<SpillContext>& spill_co
     return Status::OK();
 }
 
+TraceEvent PipelineTask::_make_trace_event(TraceEventType type) const {
+    TraceEvent event;
+    event.query_id_hi = _query_id.hi;
+    event.query_id_lo = _query_id.lo;
+    event.fragment_id = _state->fragment_id();
+    event.pipeline_id = _pipeline->id();
+    event.task_id = static_cast<int32_t>(_index);
+    std::thread::id tid = std::this_thread::get_id();
+    event.thread_id = *reinterpret_cast<uint64_t*>(&tid);
+    event.type = type;
+    return event;
+}
+
+void PipelineTask::_record_trace_event(TraceEventType type, Dependency* dependency) {
+    auto event = _make_trace_event(type);
+    event.core_id = static_cast<uint32_t>(CpuInfo::get_current_core());
+    event.start_time = event.end_time = MonotonicMicros();
+    if (dependency) {
+        event.set_detail(dependency->name());
+    }
+    ExecEnv::GetInstance()->pipeline_tracer_context()->sampler()->record(event);
+}
+
+void PipelineTask::record_trace_run(uint32_t core_id, uint64_t start_time, uint64_t end_time) {
+    auto event = _make_trace_event(TraceEventType::RUN);
+    event.core_id = core_id;
+    event.start_time = start_time;
+    event.end_time = end_time;
+    ExecEnv::GetInstance()->pipeline_tracer_context()->sampler()->record(event);
+}
+
 Status PipelineTask::wake_up(Dependency* dep) {
+    std::vector<PipelineTaskSPtr> ready_tasks;
+    RETURN_IF_ERROR(wake_up(dep, &ready_tasks));
+    RETURN_IF_ERROR(get_task_queue()->push_back(ready_tasks.front()));
+    return Status::OK();
+}
+
+Status PipelineTask::wake_up(Dependency* dep, std::vector<PipelineTaskSPtr>* ready_tasks) {
     // call by dependency
     DCHECK_EQ(_blocked_dep, dep) << "dep : " << dep->debug_string(0) << "task: " << debug_string();
     _blocked_dep = nullptr;
+    if (_trace_sampled) [[unlikely]] {
+        _record_trace_event(TraceEventType::WAKEUP, dep);
+    }
     auto holder = std::dynamic_pointer_cast<PipelineTask>(shared_from_this());
     RETURN_IF_ERROR(_state_transition(PipelineTask::State::RUNNABLE));
-    RETURN_IF_ERROR(get_task_queue()->push_back(holder));
+    ready_tasks->push_back(std::move(holder));
     return Status::OK();
 }
 
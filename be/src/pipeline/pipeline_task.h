@@ -26,6 +26,7 @@
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline.h"
+#include "pipeline/pipeline_tracing.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
 #include "vec/core/block.h"
@@ -112,6 +113,9 @@ public:
     }
 
     Status wake_up(Dependency* dep);
+    // Same as `wake_up` but leaves the task in `ready_tasks` instead of pushing it to the task
+    // queue, so that the caller could submit the tasks woken up together in one batch.
+    Status wake_up(Dependency* dep, std::vector<std::shared_ptr<PipelineTask>>* ready_tasks);
 
     DataSinkOperatorPtr sink() const { return _sink; }
 
@@ -144,7 +148,14 @@ public:
         _wait_worker_watcher.start();
     }
 
-    void pop_out_runnable_queue() { _wait_worker_watcher.stop(); }
+    void pop_out_runnable_queue() {
+        // elapsed_time() of a running watcher only contains the current round of waiting
+        _last_wait_worker_ns = _wait_worker_watcher.elapsed_time();
+        _wait_worker_watcher.stop();
+    }
+
+    // time spent in the runnable queue before the latest scheduling
+    uint64_t last_wait_worker_ns() const { return _last_wait_worker_ns; }
 
     bool is_running() { return _running.load(); }
     bool is_revoking() const;
@@ -167,9 +178,17 @@ public:
     Status blocked(Dependency* dependency) {
         DCHECK_EQ(_blocked_dep, nullptr) << "task: " << debug_string();
         _blocked_dep = dependency;
+        if (_trace_sampled) [[unlikely]] {
+            _record_trace_event(TraceEventType::BLOCK, dependency);
+        }
         return _state_transition(PipelineTask::State::BLOCKED);
     }
 
+    bool trace_sampled() const { return _trace_sampled; }
+
+    // record an event of this task into the pipeline trace sampler
+    void record_trace_run(uint32_t core_id, uint64_t start_time, uint64_t end_time);
+
 private:
     // Whether this task is blocked before execution (FE 2-phase commit trigger, runtime filters)
     bool _wait_to_start();
@@ -178,6 +197,9 @@ private:
     // Whether this task is blocked after execution (pending finish dependency)
     bool _is_pending_finish();
 
+    TraceEvent _make_trace_event(TraceEventType type) const;
+    void _record_trace_event(TraceEventType type, Dependency* dependency);
+
     Status _extract_dependencies();
     void _init_profile();
     void _fresh_profile_counter();
@@ -221,12 +243,18 @@ private:
     RuntimeProfile::Counter* _close_timer = nullptr;
     RuntimeProfile::Counter* _schedule_counts = nullptr;
     MonotonicStopWatch _wait_worker_watcher;
+    uint64_t _last_wait_worker_ns = 0;
+    bool _trace_sampled = false;
     RuntimeProfile::Counter* _wait_worker_timer = nullptr;
     // TODO we should calculate the time between when really runnable and runnable
     RuntimeProfile::Counter* _yield_counts = nullptr;
     RuntimeProfile::Counter* _core_change_times = nullptr;
     RuntimeProfile::Counter* _memory_reserve_times = nullptr;
     RuntimeProfile::Counter* _memory_reserve_failed_times = nullptr;
+    // hardware events of the get block and sink calls, empty if
+    // `enable_pipeline_task_perf_counters` is off when the task is prepared
+    std::vector<RuntimeProfile::Counter*> _get_block_perf_counters;
+    std::vector<RuntimeProfile::Counter*> _sink_perf_counters;
 
     Operators _operators; // left is _source, right is _root
     OperatorXBase* _source;
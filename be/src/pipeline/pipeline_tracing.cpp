@@ -19,22 +19,225 @@
 
 #include <absl/time/clock.h>
 #include <fcntl.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <sys/stat.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <chrono>
 #include <cstdint>
+#include <map>
 #include <mutex>
 #include <string>
+#include <tuple>
 
 #include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
 #include "io/fs/local_file_writer.h"
+#include "util/bit_util.h"
+#include "util/cpu_info.h"
 #include "util/time.h"
+#include "util/uid_util.h"
 
 namespace doris::pipeline {
 
+TraceRingBuffer::TraceRingBuffer(size_t capacity) {
+    capacity = size_t(BitUtil::RoundUpToPowerOfTwo(int64_t(std::max<size_t>(capacity, 2))));
+    _slots.reset(new Slot[capacity]);
+    _mask = capacity - 1;
+}
+
+void TraceRingBuffer::push(const TraceEvent& event) {
+    uint64_t pos = _head.fetch_add(1, std::memory_order_relaxed);
+    auto& slot = _slots[pos & _mask];
+    slot.seq.store(pos * 2 + 1, std::memory_order_release);
+    slot.event = event;
+    slot.seq.store(pos * 2 + 2, std::memory_order_release);
+}
+
+void TraceRingBuffer::collect(std::vector<TraceEvent>* events) const {
+    for (size_t i = 0; i <= _mask; ++i) {
+        const auto& slot = _slots[i];
+        uint64_t seq = slot.seq.load(std::memory_order_acquire);
+        if (seq == 0 || (seq & 1)) {
+            continue;
+        }
+        TraceEvent event = slot.event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) == seq) {
+            events->push_back(event);
+        }
+    }
+}
+
+bool PipelineTraceSampler::should_sample(const TUniqueId& query_id, uint64_t workload_group_id) {
+    if (!_enabled) {
+        return false;
+    }
+    double rate = _sample_rate;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        if (_traced_queries.erase(query_id) > 0) {
+            _refresh_enabled();
+            return true;
+        }
+        if (auto it = _workload_group_sample_rates.find(workload_group_id);
+            it != _workload_group_sample_rates.end()) {
+            rate = it->second;
+        }
+    }
+    if (rate <= 0) {
+        return false;
+    }
+    // decided by query id, so all the fragments of a query on different BEs agree
+    constexpr uint64_t SAMPLE_PRECISION = 1000000;
+    uint64_t hash = HashUtil::fnv_hash64(&query_id.lo, sizeof(query_id.lo),
+                                         static_cast<uint64_t>(query_id.hi));
+    return double(hash % SAMPLE_PRECISION) < rate * SAMPLE_PRECISION;
+}
+
+void PipelineTraceSampler::_init_ring_buffers() {
+    std::call_once(_init_flag, [this]() {
+        int num_buffers = std::max(CpuInfo::get_max_num_cores(), 1);
+        _ring_buffers.resize(num_buffers);
+        for (auto& buffer : _ring_buffers) {
+            buffer = std::make_unique<TraceRingBuffer>(config::pipeline_trace_ring_buffer_size);
+        }
+        _ring_buffers_ready = true;
+    });
+}
+
+void PipelineTraceSampler::record(const TraceEvent& event) {
+    if (!_ring_buffers_ready) [[unlikely]] {
+        _init_ring_buffers();
+    }
+    // events of a core are mostly recorded by the same thread, so there is little contention
+    _ring_buffers[CpuInfo::get_current_core() % _ring_buffers.size()]->push(event);
+}
+
+void PipelineTraceSampler::set_sample_rate(double rate) {
+    std::lock_guard<std::mutex> l(_lock);
+    _sample_rate = rate;
+    _refresh_enabled();
+}
+
+void PipelineTraceSampler::set_workload_group_sample_rate(uint64_t workload_group_id,
+                                                          double rate) {
+    std::lock_guard<std::mutex> l(_lock);
+    if (rate > 0) {
+        _workload_group_sample_rates[workload_group_id] = rate;
+    } else {
+        _workload_group_sample_rates.erase(workload_group_id);
+    }
+    _refresh_enabled();
+}
+
+void PipelineTraceSampler::add_traced_query(const TUniqueId& query_id) {
+    std::lock_guard<std::mutex> l(_lock);
+    _traced_queries.insert(query_id);
+    _refresh_enabled();
+}
+
+void PipelineTraceSampler::_refresh_enabled() {
+    _enabled = _sample_rate > 0 || !_workload_group_sample_rates.empty() ||
+               !_traced_queries.empty();
+}
+
+std::string PipelineTraceSampler::export_trace(const TUniqueId* query_id) const {
+    std::vector<TraceEvent> events;
+    if (_ring_buffers_ready) {
+        for (const auto& buffer : _ring_buffers) {
+            buffer->collect(&events);
+        }
+    }
+    std::sort(events.begin(), events.end(), [](const TraceEvent& lhs, const TraceEvent& rhs) {
+        return lhs.start_time < rhs.start_time;
+    });
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("displayTimeUnit");
+    writer.String("ns");
+    writer.Key("traceEvents");
+    writer.StartArray();
+    // one process per fragment of a query, one thread per pipeline task
+    std::map<std::tuple<int64_t, int64_t, int32_t>, int64_t> fragment_to_pid;
+    for (const auto& event : events) {
+        if (query_id != nullptr &&
+            (event.query_id_hi != query_id->hi || event.query_id_lo != query_id->lo)) {
+            continue;
+        }
+        auto key = std::make_tuple(event.query_id_hi, event.query_id_lo, event.fragment_id);
+        auto it = fragment_to_pid.find(key);
+        if (it == fragment_to_pid.end()) {
+            it = fragment_to_pid.emplace(key, int64_t(fragment_to_pid.size()) + 1).first;
+            TUniqueId id;
+            id.__set_hi(event.query_id_hi);
+            id.__set_lo(event.query_id_lo);
+            writer.StartObject();
+            writer.Key("name");
+            writer.String("process_name");
+            writer.Key("ph");
+            writer.String("M");
+            writer.Key("pid");
+            writer.Int64(it->second);
+            writer.Key("args");
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(fmt::format("query {} fragment {}", print_id(id), event.fragment_id)
+                                  .c_str());
+            writer.EndObject();
+            writer.EndObject();
+        }
+
+        writer.StartObject();
+        writer.Key("pid");
+        writer.Int64(it->second);
+        writer.Key("tid");
+        writer.Int(event.task_id);
+        writer.Key("ts");
+        writer.Uint64(event.start_time);
+        writer.Key("cat");
+        writer.String("pipeline");
+        switch (event.type) {
+        case TraceEventType::RUN:
+            writer.Key("name");
+            writer.String(fmt::format("run pipeline {}", event.pipeline_id).c_str());
+            writer.Key("ph");
+            writer.String("X");
+            writer.Key("dur");
+            writer.Uint64(event.end_time - event.start_time);
+            break;
+        case TraceEventType::BLOCK:
+        case TraceEventType::WAKEUP:
+            writer.Key("name");
+            writer.String(event.type == TraceEventType::BLOCK ? "block" : "wakeup");
+            writer.Key("ph");
+            writer.String("i");
+            writer.Key("s");
+            writer.String("t");
+            break;
+        }
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("core_id");
+        writer.Uint(event.core_id);
+        writer.Key("thread_id");
+        writer.Uint64(event.thread_id);
+        if (event.detail[0] != '\0') {
+            writer.Key("dependency");
+            writer.String(event.detail);
+        }
+        writer.EndObject();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return {buffer.GetString(), buffer.GetSize()};
+}
+
 void PipelineTracerContext::record(ScheduleRecord record) {
     if (_dump_type == RecordType::None) [[unlikely]] {
         return;
@@ -106,6 +309,25 @@ Status PipelineTracerContext::change_record_params(
         effective = true;
     }
 
+    // params of sampled tracing
+    if (auto it = params.find("sample_rate"); it != params.end()) {
+        double rate = std::stod(it->second);
+        if (auto wg_it = params.find("workload_group_id"); wg_it != params.end()) {
+            _sampler.set_workload_group_sample_rate(std::stoull(wg_it->second), rate);
+        } else {
+            _sampler.set_sample_rate(rate);
+        }
+        effective = true;
+    }
+    if (auto it = params.find("query_id"); it != params.end()) {
+        TUniqueId query_id;
+        if (!parse_id(it->second, &query_id)) {
+            return Status::InvalidArgument("invalid query id {}", it->second);
+        }
+        _sampler.add_traced_query(query_id);
+        effective = true;
+    }
+
     return effective ? Status::OK()
                      : Status::InvalidArgument(
                                "No qualified param in changing tracing record method");
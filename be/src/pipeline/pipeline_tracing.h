@@ -18,12 +18,18 @@
 #pragma once
 
 #include <concurrentqueue.h>
+#include <string.h>
 #include <fmt/format.h>
 #include <gen_cpp/Types_types.h>
 #include <parallel_hashmap/phmap.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "common/config.h"
 #include "util/hash_util.hpp" // IWYU pragma: keep
@@ -61,6 +67,93 @@ using OneQueryTraces = moodycamel::ConcurrentQueue<ScheduleRecord>;
 using OneQueryTracesSPtr = std::shared_ptr<moodycamel::ConcurrentQueue<ScheduleRecord>>;
 using QueryTracesMap = std::map<QueryID, OneQueryTracesSPtr>;
 
+enum class TraceEventType : uint8_t {
+    RUN,    // a round of PipelineTask::execute, has duration
+    BLOCK,  // task is blocked by a dependency
+    WAKEUP, // task is woken up by a dependency
+};
+
+// A trivially copyable event so that it could be stored in TraceRingBuffer.
+struct TraceEvent {
+    int64_t query_id_hi = 0;
+    int64_t query_id_lo = 0;
+    int32_t fragment_id = 0;
+    int32_t pipeline_id = 0;
+    int32_t task_id = 0;
+    uint32_t core_id = 0;
+    uint64_t thread_id = 0;
+    // in microseconds, `end_time` equals to `start_time` for instant events
+    uint64_t start_time = 0;
+    uint64_t end_time = 0;
+    TraceEventType type = TraceEventType::RUN;
+    // name of the dependency for BLOCK and WAKEUP events, truncated
+    char detail[31] = {0};
+
+    void set_detail(const std::string& str) {
+        size_t len = std::min(str.size(), sizeof(detail) - 1);
+        memcpy(detail, str.data(), len);
+        detail[len] = '\0';
+    }
+};
+
+// Fixed size ring buffer keeping the latest events, the oldest ones are overwritten.
+// Writers claim a slot by an atomic counter and publish it by the sequence of the slot, so
+// recording never takes a lock. Readers skip the slots which are being written.
+class TraceRingBuffer {
+public:
+    explicit TraceRingBuffer(size_t capacity);
+
+    void push(const TraceEvent& event);
+
+    // append all the published events in the buffer to `events`
+    void collect(std::vector<TraceEvent>* events) const;
+
+private:
+    struct Slot {
+        // odd: being written, even and not zero: published event of round (seq / 2 - 1)
+        std::atomic<uint64_t> seq = 0;
+        TraceEvent event;
+    };
+    std::unique_ptr<Slot[]> _slots;
+    size_t _mask;
+    std::atomic<uint64_t> _head = 0;
+};
+
+// Low overhead sampled tracing, always could be on in production. A query is sampled or not
+// when it is bound to a workload group, the events of sampled queries are kept in per core
+// ring buffers and could be exported as a Chrome/Perfetto trace.
+class PipelineTraceSampler {
+public:
+    bool should_sample(const TUniqueId& query_id, uint64_t workload_group_id);
+
+    void record(const TraceEvent& event);
+
+    // Export the events in Chrome trace event format, which could be opened by Perfetto UI.
+    // Only the events of `query_id` are exported if it is set.
+    std::string export_trace(const TUniqueId* query_id) const;
+
+    void set_sample_rate(double rate);
+    void set_workload_group_sample_rate(uint64_t workload_group_id, double rate);
+    // trace all the events of the query, regardless of the sample rate
+    void add_traced_query(const TUniqueId& query_id);
+
+    bool enabled() const { return _enabled; }
+
+private:
+    void _init_ring_buffers();
+    void _refresh_enabled();
+
+    std::once_flag _init_flag;
+    std::vector<std::unique_ptr<TraceRingBuffer>> _ring_buffers;
+    std::atomic<bool> _ring_buffers_ready = false;
+
+    std::atomic<bool> _enabled = false;
+    std::atomic<double> _sample_rate = 0;
+    std::mutex _lock;
+    phmap::flat_hash_map<uint64_t, double> _workload_group_sample_rates;
+    phmap::flat_hash_set<TUniqueId> _traced_queries;
+};
+
 // belongs to exec_env, for all query, if enabled
 class PipelineTracerContext {
 public:
@@ -77,6 +170,8 @@ public:
 
     bool enabled() const { return !(_dump_type == RecordType::None); }
 
+    PipelineTraceSampler* sampler() { return &_sampler; }
+
 private:
     // dump data to disk. one query or all.
     void _dump_query(TUniqueId query_id);
@@ -94,5 +189,7 @@ private:
     decltype(MonotonicSeconds()) _last_dump_time;
     decltype(MonotonicSeconds()) _dump_interval_s =
             60; // effective iff Periodic mode. 1 minute default.
+
+    PipelineTraceSampler _sampler;
 };
 } // namespace doris::pipeline
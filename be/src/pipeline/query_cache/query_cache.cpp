@@ -17,6 +17,11 @@
 
 #include "query_cache.h"
 
+#include "cloud/config.h"
+#include "olap/base_tablet.h"
+#include "olap/rowset/rowset.h"
+#include "runtime/query_context.h"
+
 namespace doris {
 
 std::vector<int>* QueryCacheHandle::get_cache_slot_orders() {
@@ -66,4 +71,83 @@ bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheH
     return false;
 }
 
+Status QueryCache::lookup_once(QueryContext* query_ctx,
+                               const std::vector<TScanRangeParams>& scan_ranges,
+                               const TQueryCacheParam& cache_param, bool allow_incremental,
+                               std::shared_ptr<QueryCacheLookup>* lookup) {
+    std::string cache_key;
+    int64_t version = 0;
+    RETURN_IF_ERROR(build_cache_key(scan_ranges, cache_param, &cache_key, &version));
+
+    std::unique_lock<std::mutex> l;
+    if (query_ctx != nullptr) {
+        l = std::unique_lock<std::mutex>(query_ctx->query_cache_lookups_lock);
+        auto it = query_ctx->query_cache_lookups.find(cache_key);
+        if (it != query_ctx->query_cache_lookups.end()) {
+            *lookup = it->second;
+            return Status::OK();
+        }
+    }
+    auto new_lookup = std::make_shared<QueryCacheLookup>();
+    if (!cache_param.force_refresh_query_cache) {
+        new_lookup->hit = this->lookup(cache_key, version, &new_lookup->handle);
+        if (!new_lookup->hit && allow_incremental &&
+            config::enable_query_cache_incremental_merge) {
+            _lookup_incremental(cache_key, scan_ranges[0].scan_range.palo_scan_range.tablet_id,
+                                version, new_lookup.get());
+        }
+    }
+    if (query_ctx != nullptr) {
+        query_ctx->query_cache_lookups.emplace(cache_key, new_lookup);
+    }
+    *lookup = std::move(new_lookup);
+    return Status::OK();
+}
+
+void QueryCache::_lookup_incremental(const CacheKey& key, int64_t tablet_id, int64_t version,
+                                     QueryCacheLookup* lookup) {
+    // the rowsets of the cloud tablets have to be synced by the scan before capturing them
+    if (config::is_cloud_mode()) {
+        return;
+    }
+    QueryCacheHandle handle;
+    {
+        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(
+                ExecEnv::GetInstance()->query_cache_mem_tracker());
+        auto* lru_handle = LRUCachePolicy::lookup(key);
+        if (lru_handle == nullptr) {
+            return;
+        }
+        handle = QueryCacheHandle(this, lru_handle);
+    }
+    int64_t cached_version = handle.get_cache_version();
+    if (cached_version >= version) {
+        return;
+    }
+    auto tablet = ExecEnv::get_tablet(tablet_id);
+    // the new rows of the other key types may replace or aggregate with the cached ones
+    if (!tablet.has_value() || tablet.value()->keys_type() != KeysType::DUP_KEYS) {
+        return;
+    }
+    std::vector<RowsetSharedPtr> rowsets;
+    {
+        std::shared_lock rlock(tablet.value()->get_header_lock());
+        // fails if the rowsets after the cached version were compacted with the earlier ones
+        if (!tablet.value()
+                     ->capture_consistent_rowsets_unlocked({cached_version + 1, version}, &rowsets)
+                     .ok()) {
+            return;
+        }
+    }
+    // a delete also applies to the cached rows
+    for (const auto& rowset : rowsets) {
+        if (rowset->rowset_meta()->has_delete_predicate()) {
+            return;
+        }
+    }
+    lookup->handle = std::move(handle);
+    lookup->incremental = true;
+    lookup->delta_rowsets = std::move(rowsets);
+}
+
 } // namespace doris
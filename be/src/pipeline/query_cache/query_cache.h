@@ -32,6 +32,7 @@
 #include "io/fs/file_system.h"
 #include "io/fs/path.h"
 #include "olap/lru_cache.h"
+#include "olap/rowset/rowset_fwd.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/lru_cache_policy.h"
 #include "runtime/memory/mem_tracker.h"
@@ -40,6 +41,7 @@
 #include "vec/core/block.h"
 
 namespace doris {
+class QueryContext;
 
 using CacheResult = std::vector<vectorized::BlockUPtr>;
 // A handle for mid-result from query lru cache.
@@ -87,6 +89,17 @@ private:
     DISALLOW_COPY_AND_ASSIGN(QueryCacheHandle);
 };
 
+// The lookup of the cache entry of one tablet. It is shared by the olap scan and the cache source
+// of the tablet, so that both agree on the entry even if it is replaced or evicted in between.
+struct QueryCacheLookup {
+    QueryCacheHandle handle;
+    bool hit = false;
+    // An entry of an older version is reused incrementally: the scan only reads the rowsets
+    // loaded after the cached version, and the cache source merges the cached result with theirs.
+    bool incremental = false;
+    std::vector<RowsetSharedPtr> delta_rowsets;
+};
+
 class QueryCache : public LRUCachePolicy {
 public:
     using LRUCachePolicy::insert;
@@ -146,7 +159,17 @@ public:
 
     bool lookup(const CacheKey& key, int64_t version, QueryCacheHandle* handle);
 
+    // Look up the cache entry of the scan range once per query, see QueryCacheLookup.
+    // `allow_incremental` is false if the cached result can't be merged, e.g. it is finalized.
+    Status lookup_once(QueryContext* query_ctx, const std::vector<TScanRangeParams>& scan_ranges,
+                       const TQueryCacheParam& cache_param, bool allow_incremental,
+                       std::shared_ptr<QueryCacheLookup>* lookup);
+
     void insert(const CacheKey& key, int64_t version, CacheResult& result,
                 const std::vector<int>& solt_orders, int64_t cache_size);
+
+private:
+    void _lookup_incremental(const CacheKey& key, int64_t tablet_id, int64_t version,
+                             QueryCacheLookup* lookup);
 };
 } // namespace doris
@@ -22,9 +22,11 @@
 #include <memory>
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/cpu_info.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -113,13 +115,7 @@ PipelineTaskSPtr PriorityTaskQueue::take(uint32_t timeout_ms) {
     }
 }
 
-Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
-    if (_closed) {
-        return Status::InternalError("WorkTaskQueue closed");
-    }
-    auto level = _compute_level(task->get_runtime_ns());
-    std::unique_lock<std::mutex> lock(_work_size_mutex);
-
+void PriorityTaskQueue::_push_unprotected(PipelineTaskSPtr task, int level) {
     // update empty queue's  runtime, to avoid too high priority
     if (_sub_queues[level].empty() &&
         double(_queue_level_min_vruntime) > _sub_queues[level].get_vruntime()) {
@@ -128,15 +124,69 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
 
     _sub_queues[level].push_back(task);
     _total_task_size++;
+}
+
+Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    auto level = _compute_level(task->get_runtime_ns());
+    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    _push_unprotected(task, level);
     DorisMetrics::instance()->pipeline_task_queue_size->increment(1);
     _wait_task.notify_one();
     return Status::OK();
 }
 
+Status PriorityTaskQueue::push(const std::vector<PipelineTaskSPtr>& tasks) {
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    for (const auto& task : tasks) {
+        _push_unprotected(task, _compute_level(task->get_runtime_ns()));
+    }
+    DorisMetrics::instance()->pipeline_task_queue_size->increment(int64_t(tasks.size()));
+    if (tasks.size() > 1) {
+        _wait_task.notify_all();
+    } else {
+        _wait_task.notify_one();
+    }
+    return Status::OK();
+}
+
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
 MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size)
-        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {}
+        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {
+    _init_numa_topology();
+}
+
+void MultiCoreTaskQueue::_init_numa_topology() {
+    if (!config::enable_pipeline_numa_aware_scheduling || CpuInfo::get_max_num_numa_nodes() <= 1 ||
+        CpuInfo::get_max_num_cores() <= 0) {
+        return;
+    }
+    int num_nodes = CpuInfo::get_max_num_numa_nodes();
+    _numa_node_queues.resize(num_nodes);
+    _numa_node_cpus.resize(num_nodes);
+    for (int node = 0; node < num_nodes; ++node) {
+        _numa_node_cpus[node] = CpuInfo::get_cores_of_numa_node(node);
+    }
+    _queue_numa_node.resize(_core_size);
+    _queue_idx_in_node.resize(_core_size);
+    // Queue i is served by a worker bound to the node of cpu (i % max_cores), so queues
+    // are spread over nodes in the same proportion as cpus.
+    for (int i = 0; i < _core_size; ++i) {
+        int node = CpuInfo::get_numa_node_of_core(i % CpuInfo::get_max_num_cores());
+        _queue_numa_node[i] = node;
+        _queue_idx_in_node[i] = int(_numa_node_queues[node].size());
+        _numa_node_queues[node].push_back(i);
+    }
+    _numa_aware = true;
+    LOG(INFO) << "MultiCoreTaskQueue enable numa aware scheduling, queues: " << _core_size
+              << ", numa nodes: " << num_nodes;
+}
 
 void MultiCoreTaskQueue::close() {
     if (_closed) {
@@ -168,6 +218,7 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
         }
     }
     if (task) {
+        _runnable_task_num--;
         task->pop_out_runnable_queue();
     }
     return task;
@@ -175,6 +226,9 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
 
 PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
     DCHECK(core_id < _core_size);
+    if (_numa_aware) {
+        return _numa_steal_take(core_id);
+    }
     int next_id = core_id;
     for (int i = 1; i < _core_size; ++i) {
         ++next_id;
@@ -190,10 +244,61 @@ PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
     return nullptr;
 }
 
+PipelineTaskSPtr MultiCoreTaskQueue::_numa_steal_take(int core_id) {
+    int local_node = _queue_numa_node[core_id];
+    // steal from the queues of local node first
+    const auto& local_queues = _numa_node_queues[local_node];
+    auto local_size = int(local_queues.size());
+    int idx = _queue_idx_in_node[core_id];
+    for (int i = 1; i < local_size; ++i) {
+        auto task = _prio_task_queues[local_queues[(idx + i) % local_size]].try_take(true);
+        if (task) {
+            return task;
+        }
+    }
+    // then from remote nodes, the nearer node id the earlier
+    auto num_nodes = int(_numa_node_queues.size());
+    for (int i = 1; i < num_nodes; ++i) {
+        for (int queue_id : _numa_node_queues[(local_node + i) % num_nodes]) {
+            auto task = _prio_task_queues[queue_id].try_take(true);
+            if (task) {
+                return task;
+            }
+        }
+    }
+    return nullptr;
+}
+
+int MultiCoreTaskQueue::_affine_core(int last_core_id) {
+    // The core which ran the task last time is likely to still hold its working set in cache,
+    // go back there unless its queue is overloaded. Otherwise compare with another queue (of the
+    // same numa node if possible) and choose the shorter one, the rest is left to stealing.
+    int threshold = config::pipeline_task_affinity_queue_threshold;
+    if (threshold <= 0 || _prio_task_queues[last_core_id].size() <= size_t(threshold) ||
+        _core_size <= 1) {
+        return last_core_id;
+    }
+    int candidate;
+    if (_numa_aware) {
+        const auto& local_queues = _numa_node_queues[_queue_numa_node[last_core_id]];
+        if (local_queues.size() <= 1) {
+            return last_core_id;
+        }
+        candidate = local_queues[_next_core.fetch_add(1) % local_queues.size()];
+    } else {
+        candidate = int(_next_core.fetch_add(1) % _core_size);
+    }
+    return _prio_task_queues[candidate].size() < _prio_task_queues[last_core_id].size()
+                   ? candidate
+                   : last_core_id;
+}
+
 Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task) {
     int core_id = task->get_core_id();
     if (core_id < 0) {
         core_id = _next_core.fetch_add(1) % _core_size;
+    } else {
+        core_id = _affine_core(core_id);
     }
     return push_back(task, core_id);
 }
@@ -201,7 +306,29 @@ Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task) {
 Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task, int core_id) {
     DCHECK(core_id < _core_size);
     task->put_in_runnable_queue();
-    return _prio_task_queues[core_id].push(task);
+    RETURN_IF_ERROR(_prio_task_queues[core_id].push(task));
+    _runnable_task_num++;
+    return Status::OK();
+}
+
+Status MultiCoreTaskQueue::push_back(const std::vector<PipelineTaskSPtr>& tasks) {
+    if (tasks.size() == 1) {
+        return push_back(tasks.front());
+    }
+    std::vector<std::vector<PipelineTaskSPtr>> core_tasks(_core_size);
+    for (const auto& task : tasks) {
+        int core_id = task->get_core_id();
+        core_id = core_id < 0 ? int(_next_core.fetch_add(1) % _core_size) : _affine_core(core_id);
+        task->put_in_runnable_queue();
+        core_tasks[core_id].push_back(task);
+    }
+    for (int core_id = 0; core_id < _core_size; ++core_id) {
+        if (!core_tasks[core_id].empty()) {
+            RETURN_IF_ERROR(_prio_task_queues[core_id].push(core_tasks[core_id]));
+            _runnable_task_num += int64_t(core_tasks[core_id].size());
+        }
+    }
+    return Status::OK();
 }
 
 void MultiCoreTaskQueue::update_statistics(PipelineTask* task, int64_t time_spent) {
@@ -27,6 +27,7 @@
 #include <ostream>
 #include <queue>
 #include <set>
+#include <vector>
 
 #include "common/status.h"
 #include "pipeline_task.h"
@@ -78,10 +79,15 @@ public:
 
     Status push(PipelineTaskSPtr task);
 
+    // push a batch of tasks under one lock acquisition
+    Status push(const std::vector<PipelineTaskSPtr>& tasks);
+
     void inc_sub_queue_runtime(int level, uint64_t runtime) {
         _sub_queues[level].inc_runtime(runtime);
     }
 
+    size_t size() const { return _total_task_size; }
+
 private:
     PipelineTaskSPtr _try_take_unprotected(bool is_steal);
     static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
@@ -100,9 +106,12 @@ private:
     uint64_t _queue_level_min_vruntime = 0;
 
     int _compute_level(uint64_t real_runtime);
+    void _push_unprotected(PipelineTaskSPtr task, int level);
 };
 
-// Need consider NUMA architecture
+// When `enable_pipeline_numa_aware_scheduling` is on, the per-core queues are grouped by
+// the NUMA node of the cpu they are mapped to. Stealing first scans queues of the same
+// node and only crosses nodes when all local queues are empty.
 class MultiCoreTaskQueue {
 public:
     explicit MultiCoreTaskQueue(int core_size);
@@ -122,19 +131,49 @@ public:
 
     Status push_back(PipelineTaskSPtr task, int core_id);
 
+    // Push a batch of woken up tasks, the tasks going to the same core are pushed together.
+    Status push_back(const std::vector<PipelineTaskSPtr>& tasks);
+
     void update_statistics(PipelineTask* task, int64_t time_spent);
 
     int cores() const { return _core_size; }
 
+    bool numa_aware() const { return _numa_aware; }
+
+    // number of runnable tasks waiting in all queues
+    int64_t runnable_task_num() const { return _runnable_task_num; }
+
+    // Cpus of the NUMA node which the queue `core_id` belongs to. Only valid when
+    // numa_aware() is true, used to bind the worker thread of this queue.
+    const std::vector<int>& numa_node_cpus(int core_id) const {
+        return _numa_node_cpus[_queue_numa_node[core_id]];
+    }
+
 private:
+    void _init_numa_topology();
+
     PipelineTaskSPtr _steal_take(int core_id);
+    PipelineTaskSPtr _numa_steal_take(int core_id);
+    // Choose the queue for a task which has run on `last_core_id` before.
+    int _affine_core(int last_core_id);
 
     std::vector<PriorityTaskQueue> _prio_task_queues;
     std::atomic<uint32_t> _next_core = 0;
     std::atomic<bool> _closed;
+    std::atomic<int64_t> _runnable_task_num = 0;
 
     int _core_size;
     static constexpr auto WAIT_CORE_TASK_TIMEOUT_MS = 100;
+
+    bool _numa_aware = false;
+    // queue id -> numa node
+    std::vector<int> _queue_numa_node;
+    // queue id -> index of the queue in `_numa_node_queues[_queue_numa_node[id]]`
+    std::vector<int> _queue_idx_in_node;
+    // numa node -> queue ids
+    std::vector<std::vector<int>> _numa_node_queues;
+    // numa node -> cpu ids
+    std::vector<std::vector<int>> _numa_node_cpus;
 };
 #include "common/compile_check_end.h"
 } // namespace doris::pipeline
@@ -21,6 +21,7 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
 #include <glog/logging.h>
+#include <pthread.h>
 #include <sched.h>
 
 // IWYU pragma: no_include <bits/chrono.h>
@@ -35,6 +36,7 @@
 #include <thread>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "pipeline/pipeline_task.h"
@@ -42,6 +44,8 @@
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/thread_context.h"
+#include "runtime/workload_group/workload_group_metrics.h"
+#include "util/doris_metrics.h"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/time.h"
@@ -50,6 +54,32 @@
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
+void TaskSchedulerFairShare::register_scheduler(TaskScheduler* scheduler) {
+    std::unique_lock<std::shared_mutex> wlock(_lock);
+    _schedulers.insert(scheduler);
+}
+
+void TaskSchedulerFairShare::unregister_scheduler(TaskScheduler* scheduler) {
+    std::unique_lock<std::shared_mutex> wlock(_lock);
+    _schedulers.erase(scheduler);
+}
+
+bool TaskSchedulerFairShare::min_busy_vruntime(const TaskScheduler* self, uint64_t* min_vruntime) {
+    std::shared_lock<std::shared_mutex> rlock(_lock);
+    bool found = false;
+    for (auto* scheduler : _schedulers) {
+        if (scheduler == self || !scheduler->is_busy()) {
+            continue;
+        }
+        uint64_t vruntime = scheduler->vruntime();
+        if (!found || vruntime < *min_vruntime) {
+            *min_vruntime = vruntime;
+            found = true;
+        }
+    }
+    return found;
+}
+
 TaskScheduler::~TaskScheduler() {
     stop();
     LOG(INFO) << "Task scheduler " << _name << " shutdown";
@@ -64,6 +94,7 @@ Status TaskScheduler::start() {
                             .set_cgroup_cpu_ctl(_cgroup_cpu_ctl)
                             .build(&_fix_thread_pool));
     LOG_INFO("TaskScheduler set cores").tag("size", cores);
+    TaskSchedulerFairShare::instance()->register_scheduler(this);
     for (int32_t i = 0; i < cores; ++i) {
         RETURN_IF_ERROR(_fix_thread_pool->submit_func([this, i] { _do_work(i); }));
     }
@@ -95,8 +126,48 @@ void close_task(PipelineTask* task, Status exec_status, PipelineFragmentContext*
     }
 }
 
+void TaskScheduler::_bind_numa_node(int index) {
+    const auto& cpus = _task_queue.numa_node_cpus(index);
+    if (cpus.empty()) {
+        return;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    if (int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set); ret != 0) {
+        LOG(WARNING) << "TaskScheduler " << _name << " failed to bind worker " << index
+                     << " to numa node, errno: " << ret;
+    }
+}
+
+void TaskScheduler::_wait_for_fair_share() {
+    uint64_t max_lag_ns = uint64_t(config::pipeline_fair_schedule_max_lag_ms) * 1000 * 1000;
+    // bound the waiting time so that a group is never starved by a wrong vruntime
+    for (int i = 0; i < config::pipeline_fair_schedule_max_lag_ms && !_need_to_stop;
+         i += FAIR_SHARE_WAIT_MS) {
+        uint64_t min_vruntime = 0;
+        if (!TaskSchedulerFairShare::instance()->min_busy_vruntime(this, &min_vruntime)) {
+            return;
+        }
+        uint64_t vruntime = _vruntime;
+        if (vruntime <= min_vruntime + max_lag_ns) {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(FAIR_SHARE_WAIT_MS));
+    }
+}
+
 void TaskScheduler::_do_work(int index) {
+    if (_task_queue.numa_aware()) {
+        _bind_numa_node(index);
+    }
     while (!_need_to_stop) {
+        bool fair_schedule = config::enable_pipeline_workload_group_fair_schedule;
+        if (fair_schedule) {
+            _wait_for_fair_share();
+        }
         auto task = _task_queue.take(index);
         if (!task) {
             continue;
@@ -106,7 +177,9 @@ void TaskScheduler::_do_work(int index) {
         // but the block thread still hold the task, so put it back to the queue, until the hold
         // thread set task->set_running(false)
         if (task->is_running()) {
-            static_cast<void>(_task_queue.push_back(task, index));
+            // Keep the task close to the core which is running it
+            int core_id = task->get_core_id();
+            static_cast<void>(_task_queue.push_back(task, core_id >= 0 ? core_id : index));
             continue;
         }
         if (task->is_finalized()) {
@@ -117,6 +190,42 @@ void TaskScheduler::_do_work(int index) {
             // Fragment already finished
             continue;
         }
+        bool adaptive_parallelism = config::enable_adaptive_pipeline_parallelism;
+        if (adaptive_parallelism &&
+            !fragment_context->try_acquire_execution_slot(_task_queue.runnable_task_num(),
+                                                          _task_queue.cores())) {
+            // Park the task, the executors are left to the other fragments
+            static_cast<void>(_task_queue.push_back(task, index));
+            continue;
+        }
+        Defer execution_slot_defer {[&]() {
+            if (adaptive_parallelism) {
+                fragment_context->release_execution_slot();
+            }
+        }};
+        DorisMetrics::instance()->pipeline_task_queue_wait_latency_us->add(
+                task->last_wait_worker_ns() / 1000);
+        if (auto wg = fragment_context->get_query_ctx()->workload_group()) {
+            wg->get_metrics()->update_pipeline_schedule_latency(task->last_wait_worker_ns());
+        }
+        if (fair_schedule && _running_workers++ == 0) {
+            // An idle scheduler should not use up the credit accumulated while idle at once
+            uint64_t min_vruntime = 0;
+            uint64_t max_lag_ns =
+                    uint64_t(config::pipeline_fair_schedule_max_lag_ms) * 1000 * 1000;
+            if (TaskSchedulerFairShare::instance()->min_busy_vruntime(this, &min_vruntime) &&
+                min_vruntime > max_lag_ns && _vruntime < min_vruntime - max_lag_ns) {
+                _vruntime = min_vruntime - max_lag_ns;
+            }
+        }
+        Defer fair_share_defer {[&]() {
+            if (fair_schedule) {
+                _running_workers--;
+            }
+        }};
+        MonotonicStopWatch exec_watcher;
+        exec_watcher.start();
+        uint64_t trace_start_time = task->trace_sampled() ? MonotonicMicros() : 0;
         task->set_running(true).set_task_queue(&_task_queue).set_core_id(index);
         bool done = false;
         auto status = Status::OK();
@@ -159,12 +268,20 @@ void TaskScheduler::_do_work(int index) {
                              start_time, end_time});
                 } else { status = task->execute(&done); },
                 status);
+        if (fair_schedule) {
+            _charge_runtime(exec_watcher.elapsed_time());
+        }
+        if (task->trace_sampled()) [[unlikely]] {
+            task->record_trace_run(static_cast<uint32_t>(index), trace_start_time,
+                                   MonotonicMicros());
+        }
         fragment_context->trigger_report_if_necessary();
     }
 }
 
 void TaskScheduler::stop() {
     if (!_shutdown) {
+        TaskSchedulerFairShare::instance()->unregister_scheduler(this);
         _task_queue.close();
         if (_fix_thread_pool) {
             _need_to_stop = true;
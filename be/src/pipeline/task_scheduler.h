@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -24,6 +25,8 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -42,6 +45,31 @@ class ThreadPool;
 
 namespace doris::pipeline {
 
+class TaskScheduler;
+
+// Every workload group owns its own TaskScheduler, so a CFS-like fairness between groups is
+// achieved by charging the task runtime to the scheduler weighted by the group's cpu share,
+// and letting the executors of a scheduler wait when its vruntime is ahead of the slowest
+// busy scheduler by more than `pipeline_fair_schedule_max_lag_ms`.
+class TaskSchedulerFairShare {
+public:
+    static TaskSchedulerFairShare* instance() {
+        static TaskSchedulerFairShare fair_share;
+        return &fair_share;
+    }
+
+    void register_scheduler(TaskScheduler* scheduler);
+
+    void unregister_scheduler(TaskScheduler* scheduler);
+
+    // The min vruntime of busy schedulers except `self`, return false if there is none.
+    bool min_busy_vruntime(const TaskScheduler* self, uint64_t* min_vruntime);
+
+private:
+    std::shared_mutex _lock;
+    std::unordered_set<TaskScheduler*> _schedulers;
+};
+
 class TaskScheduler {
 public:
     TaskScheduler(int core_num, std::string name, std::shared_ptr<CgroupCpuCtl> cgroup_cpu_ctl)
@@ -57,7 +85,28 @@ public:
 
     std::vector<int> thread_debug_info() { return _fix_thread_pool->debug_info(); }
 
+    void set_cpu_share(uint64_t cpu_share) { _cpu_share = std::max<uint64_t>(cpu_share, 1); }
+
+    uint64_t vruntime() const { return _vruntime; }
+
+    bool is_busy() const { return _running_workers > 0; }
+
 private:
+    static constexpr uint64_t DEFAULT_CPU_SHARE = 1024;
+    static constexpr uint32_t FAIR_SHARE_WAIT_MS = 1;
+
+    void _wait_for_fair_share();
+
+    void _charge_runtime(uint64_t runtime_ns) {
+        _vruntime += runtime_ns * DEFAULT_CPU_SHARE / _cpu_share;
+    }
+
+    std::atomic<uint64_t> _cpu_share = DEFAULT_CPU_SHARE;
+    // weighted virtual runtime in ns, vruntime = runtime * DEFAULT_CPU_SHARE / cpu_share
+    std::atomic<uint64_t> _vruntime = 0;
+    // number of executors which are running a task
+    std::atomic<int> _running_workers = 0;
+
     std::unique_ptr<ThreadPool> _fix_thread_pool;
 
     MultiCoreTaskQueue _task_queue;
@@ -67,5 +116,6 @@ private:
     std::weak_ptr<CgroupCpuCtl> _cgroup_cpu_ctl;
 
     void _do_work(int index);
+    void _bind_numa_node(int index);
 };
 } // namespace doris::pipeline
\ No newline at end of file
@@ -0,0 +1,49 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/descriptor_tbl_cache.h"
+
+#include "util/thrift_util.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+Status DescriptorTblCache::get_or_create(const TDescriptorTable& thrift_tbl,
+                                         std::shared_ptr<CachedDescriptorTbl>* result) {
+    // The whole serialized table is used as key, so that different tables never collide.
+    ThriftSerializer serializer(false, 4096);
+    std::string key;
+    RETURN_IF_ERROR(serializer.serialize(&thrift_tbl, &key));
+
+    auto* lru_handle = lookup(key);
+    if (lru_handle) {
+        Defer release([cache = this, lru_handle] { cache->release(lru_handle); });
+        *result = ((CacheValue*)LRUCachePolicy::value(lru_handle))->item;
+        return Status::OK();
+    }
+
+    auto cached = std::make_shared<CachedDescriptorTbl>();
+    RETURN_IF_ERROR(DescriptorTbl::create(&cached->obj_pool, thrift_tbl, &cached->desc_tbl));
+    auto* value = new CacheValue;
+    value->item = cached;
+    release(insert(key, value, 1, key.size(), CachePriority::NORMAL));
+    *result = std::move(cached);
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
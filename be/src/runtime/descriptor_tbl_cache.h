@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <gen_cpp/Descriptors_types.h>
+
+#include <memory>
+#include <string>
+
+#include "common/status.h"
+#include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/lru_cache_policy.h"
+#include "util/defer_op.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// A descriptor table built from thrift, it owns all the descriptors by its own object pool,
+// so it could be shared by the queries with the same plan shape.
+struct CachedDescriptorTbl {
+    ObjectPool obj_pool;
+    DescriptorTbl* desc_tbl = nullptr;
+};
+
+// Cache of the descriptor tables of fragments, keyed by the serialized TDescriptorTable.
+// Repeated short queries (dashboards, point lookups) usually send the same descriptor table,
+// rebuilding it for every query is a large share of their prepare time.
+class DescriptorTblCache : public LRUCachePolicy {
+public:
+    static DescriptorTblCache* instance() {
+        return ExecEnv::GetInstance()->get_descriptor_tbl_cache();
+    }
+
+    static DescriptorTblCache* create_global_instance(size_t capacity) {
+        DCHECK(ExecEnv::GetInstance()->get_descriptor_tbl_cache() == nullptr);
+        return new DescriptorTblCache(capacity);
+    }
+
+    // Get the descriptor table of `thrift_tbl` from cache, or build and insert it.
+    Status get_or_create(const TDescriptorTable& thrift_tbl,
+                         std::shared_ptr<CachedDescriptorTbl>* result);
+
+    class CacheValue : public LRUCacheValueBase {
+    public:
+        std::shared_ptr<CachedDescriptorTbl> item;
+    };
+
+private:
+    DescriptorTblCache(size_t capacity)
+            : LRUCachePolicy(CachePolicy::CacheType::DESCRIPTOR_TBL_CACHE, capacity,
+                             LRUCacheType::NUMBER, config::descriptor_tbl_cache_stale_sweep_time_sec) {
+    }
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
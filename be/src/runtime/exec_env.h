@@ -51,6 +51,7 @@ class ScannerScheduler;
 class SpillStreamManager;
 class DeltaWriterV2Pool;
 class DictionaryFactory;
+class HyperscanDatabaseCache;
 } // namespace vectorized
 namespace pipeline {
 class TaskScheduler;
@@ -110,6 +111,7 @@ class ClientCache;
 class HeartbeatFlags;
 class FrontendServiceClient;
 class FileMetaCache;
+class DeletionVectorCache;
 class GroupCommitMgr;
 class TabletSchemaCache;
 class TabletColumnObjectPool;
@@ -118,6 +120,7 @@ class SchemaCache;
 class StoragePageCache;
 class SegmentLoader;
 class LookupConnectionCache;
+class DescriptorTblCache;
 class RowCache;
 class DummyLRUCache;
 class CacheManager;
@@ -238,8 +241,25 @@ public:
     ThreadPool* lazy_release_obj_pool() { return _lazy_release_obj_pool.get(); }
     ThreadPool* non_block_close_thread_pool();
     ThreadPool* s3_file_system_thread_pool() { return _s3_file_system_thread_pool.get(); }
+    ThreadPool* inverted_index_compaction_thread_pool() {
+        return _inverted_index_compaction_thread_pool.get();
+    }
+    ThreadPool* memtable_sort_thread_pool() { return _memtable_sort_thread_pool.get(); }
+    ThreadPool* segment_column_encode_thread_pool() {
+        return _segment_column_encode_thread_pool.get();
+    }
+    ThreadPool* vertical_compaction_write_thread_pool() {
+        return _vertical_compaction_write_thread_pool.get();
+    }
+    ThreadPool* file_cache_write_behind_thread_pool() {
+        return _file_cache_write_behind_thread_pool.get();
+    }
+    ThreadPool* s3_file_read_thread_pool() { return _s3_file_read_thread_pool.get(); }
 
     void init_file_cache_factory(std::vector<doris::CachePath>& cache_paths);
+    // Init what the io needs in a standalone tool without the rest of the BE, e.g.
+    // fs_benchmark_tool: the memory trackers, the s3 upload pool and the file cache.
+    Status init_io_for_tool();
     io::FileCacheFactory* file_cache_factory() { return _file_cache_factory; }
     UserFunctionCache* user_function_cache() { return _user_function_cache; }
     FragmentMgr* fragment_mgr() { return _fragment_mgr; }
@@ -271,6 +291,10 @@ public:
     HeartbeatFlags* heartbeat_flags() { return _heartbeat_flags; }
     vectorized::ScannerScheduler* scanner_scheduler() { return _scanner_scheduler; }
     FileMetaCache* file_meta_cache() { return _file_meta_cache; }
+    DeletionVectorCache* deletion_vector_cache() { return _deletion_vector_cache; }
+    vectorized::HyperscanDatabaseCache* hyperscan_database_cache() {
+        return _hyperscan_database_cache;
+    }
     MemTableMemoryLimiter* memtable_memory_limiter() { return _memtable_memory_limiter.get(); }
     WalManager* wal_mgr() { return _wal_manager.get(); }
     DNSCache* dns_cache() { return _dns_cache; }
@@ -307,6 +331,10 @@ public:
         this->_tablet_column_object_pool = c;
     }
     void set_storage_page_cache(StoragePageCache* c) { this->_storage_page_cache = c; }
+    void set_file_cache_factory(io::FileCacheFactory* f) { this->_file_cache_factory = f; }
+    void set_file_cache_open_fd_cache(std::unique_ptr<io::FDCache>&& c) {
+        this->_file_cache_open_fd_cache = std::move(c);
+    }
     void set_segment_loader(SegmentLoader* sl) { this->_segment_loader = sl; }
     void set_routine_load_task_executor(RoutineLoadTaskExecutor* r) {
         this->_routine_load_task_executor = r;
@@ -339,6 +367,7 @@ public:
     StoragePageCache* get_storage_page_cache() { return _storage_page_cache; }
     SegmentLoader* segment_loader() { return _segment_loader; }
     LookupConnectionCache* get_lookup_connection_cache() { return _lookup_connection_cache; }
+    DescriptorTblCache* get_descriptor_tbl_cache() { return _descriptor_tbl_cache; }
     RowCache* get_row_cache() { return _row_cache; }
     CacheManager* get_cache_manager() { return _cache_manager; }
     IdManager* get_id_manager() { return _id_manager; }
@@ -442,6 +471,12 @@ private:
     std::unique_ptr<ThreadPool> _lazy_release_obj_pool;
     std::unique_ptr<ThreadPool> _non_block_close_thread_pool;
     std::unique_ptr<ThreadPool> _s3_file_system_thread_pool;
+    std::unique_ptr<ThreadPool> _inverted_index_compaction_thread_pool;
+    std::unique_ptr<ThreadPool> _memtable_sort_thread_pool;
+    std::unique_ptr<ThreadPool> _segment_column_encode_thread_pool;
+    std::unique_ptr<ThreadPool> _vertical_compaction_write_thread_pool;
+    std::unique_ptr<ThreadPool> _file_cache_write_behind_thread_pool;
+    std::unique_ptr<ThreadPool> _s3_file_read_thread_pool;
 
     FragmentMgr* _fragment_mgr = nullptr;
     WorkloadGroupMgr* _workload_group_manager = nullptr;
@@ -467,6 +502,10 @@ private:
 
     // To save meta info of external file, such as parquet footer.
     FileMetaCache* _file_meta_cache = nullptr;
+    // The decoded deletes of external data files, nullptr if it's disabled.
+    DeletionVectorCache* _deletion_vector_cache = nullptr;
+    // The compiled patterns of LIKE and REGEXP, nullptr if it's disabled.
+    vectorized::HyperscanDatabaseCache* _hyperscan_database_cache = nullptr;
     std::unique_ptr<MemTableMemoryLimiter> _memtable_memory_limiter;
     std::unique_ptr<LoadStreamMapPool> _load_stream_map_pool;
     std::unique_ptr<vectorized::DeltaWriterV2Pool> _delta_writer_v2_pool;
@@ -490,6 +529,7 @@ private:
     StoragePageCache* _storage_page_cache = nullptr;
     SegmentLoader* _segment_loader = nullptr;
     LookupConnectionCache* _lookup_connection_cache = nullptr;
+    DescriptorTblCache* _descriptor_tbl_cache = nullptr;
     RowCache* _row_cache = nullptr;
     CacheManager* _cache_manager = nullptr;
     IdManager* _id_manager = nullptr;
@@ -66,6 +66,7 @@
 #include "runtime/broker_mgr.h"
 #include "runtime/cache/result_cache.h"
 #include "runtime/client_cache.h"
+#include "runtime/descriptor_tbl_cache.h"
 #include "runtime/exec_env.h"
 #include "runtime/external_scan_context_mgr.h"
 #include "runtime/fragment_mgr.h"
@@ -99,6 +100,7 @@
 #include "util/bit_util.h"
 #include "util/brpc_client_cache.h"
 #include "util/cpu_info.h"
+#include "util/deletion_vector_cache.h"
 #include "util/disk_info.h"
 #include "util/dns_cache.h"
 #include "util/doris_metrics.h"
@@ -113,6 +115,7 @@
 #include "vec/exec/format/parquet/arrow_memory_pool.h"
 #include "vec/exec/scan/scanner_scheduler.h"
 #include "vec/functions/dictionary_factory.h"
+#include "vec/functions/hyperscan_database_cache.h"
 #include "vec/runtime/vdata_stream_mgr.h"
 #include "vec/sink/delta_writer_v2_pool.h"
 #include "vec/sink/load_stream_map_pool.h"
@@ -256,6 +259,30 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_min_threads(config::min_s3_file_system_thread_num)
                               .set_max_threads(config::max_s3_file_system_thread_num)
                               .build(&_s3_file_system_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("InvertedIndexCompactionThreadPool")
+                              .set_min_threads(config::inverted_index_compaction_thread_num)
+                              .set_max_threads(config::inverted_index_compaction_thread_num)
+                              .build(&_inverted_index_compaction_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("MemTableSortThreadPool")
+                              .set_min_threads(config::memtable_sort_thread_num)
+                              .set_max_threads(config::memtable_sort_thread_num)
+                              .build(&_memtable_sort_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("SegmentColumnEncodeThreadPool")
+                              .set_min_threads(config::segment_column_encode_thread_num)
+                              .set_max_threads(config::segment_column_encode_thread_num)
+                              .build(&_segment_column_encode_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("VerticalCompactionWriteThreadPool")
+                              .set_min_threads(config::vertical_compaction_write_thread_num)
+                              .set_max_threads(config::vertical_compaction_write_thread_num)
+                              .build(&_vertical_compaction_write_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("FileCacheWriteBehindThreadPool")
+                              .set_min_threads(config::file_cache_write_behind_thread_num)
+                              .set_max_threads(config::file_cache_write_behind_thread_num)
+                              .build(&_file_cache_write_behind_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("S3FileReadThreadPool")
+                              .set_min_threads(config::s3_file_read_thread_num)
+                              .set_max_threads(config::s3_file_read_thread_num)
+                              .build(&_s3_file_read_thread_pool));
     RETURN_IF_ERROR(_init_mem_env());
 
     // NOTE: runtime query statistics mgr could be visited by query and daemon thread
@@ -443,6 +470,23 @@ void ExecEnv::init_file_cache_factory(std::vector<doris::CachePath>& cache_paths
     }
 }
 
+Status ExecEnv::init_io_for_tool() {
+    init_mem_tracker();
+    thread_context()->thread_mem_tracker_mgr->init();
+    auto [s3_file_upload_min_threads, s3_file_upload_max_threads] =
+            get_num_threads(config::num_s3_file_upload_thread_pool_min_thread,
+                            config::num_s3_file_upload_thread_pool_max_thread);
+    RETURN_IF_ERROR(ThreadPoolBuilder("S3FileUploadThreadPool")
+                            .set_min_threads(cast_set<int>(s3_file_upload_min_threads))
+                            .set_max_threads(cast_set<int>(s3_file_upload_max_threads))
+                            .build(&_s3_file_upload_thread_pool));
+    _file_cache_open_fd_cache = std::make_unique<io::FDCache>();
+    _file_cache_factory = new io::FileCacheFactory();
+    std::vector<doris::CachePath> cache_paths;
+    init_file_cache_factory(cache_paths);
+    return Status::OK();
+}
+
 Status ExecEnv::_init_mem_env() {
     bool is_percent = false;
     std::stringstream ss;
@@ -491,7 +535,8 @@ Status ExecEnv::_init_mem_env() {
         pk_storage_page_cache_limit = storage_cache_limit / 2;
     }
     _storage_page_cache = StoragePageCache::create_global_cache(
-            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards);
+            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards,
+            config::compressed_data_page_cache_percentage);
     LOG(INFO) << "Storage page cache memory limit: "
               << PrettyPrinter::print(storage_cache_limit, TUnit::BYTES)
               << ", origin config value: " << config::storage_page_cache_limit;
@@ -544,11 +589,25 @@ Status ExecEnv::_init_mem_env() {
               << config::file_cache_max_file_reader_cache_size;
     config::file_cache_max_file_reader_cache_size = block_file_cache_fd_cache_size;
 
-    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num);
+    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num,
+                                         config::max_external_file_meta_range_cache_bytes);
+    if (config::max_external_deletion_vector_cache_bytes > 0) {
+        _deletion_vector_cache =
+                new DeletionVectorCache(config::max_external_deletion_vector_cache_bytes);
+    }
+    if (config::max_hyperscan_database_cache_bytes > 0) {
+        _hyperscan_database_cache = new vectorized::HyperscanDatabaseCache(
+                config::max_hyperscan_database_cache_bytes);
+    }
 
     _lookup_connection_cache =
             LookupConnectionCache::create_global_instance(config::lookup_connection_cache_capacity);
 
+    if (config::enable_descriptor_tbl_cache) {
+        _descriptor_tbl_cache =
+                DescriptorTblCache::create_global_instance(config::descriptor_tbl_cache_capacity);
+    }
+
     // use memory limit
     int64_t inverted_index_cache_limit =
             ParseUtil::parse_mem_spec(config::inverted_index_searcher_cache_limit,
@@ -741,6 +800,12 @@ void ExecEnv::destroy() {
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
     SAFE_SHUTDOWN(_non_block_close_thread_pool);
     SAFE_SHUTDOWN(_s3_file_system_thread_pool);
+    SAFE_SHUTDOWN(_inverted_index_compaction_thread_pool);
+    SAFE_SHUTDOWN(_memtable_sort_thread_pool);
+    SAFE_SHUTDOWN(_segment_column_encode_thread_pool);
+    SAFE_SHUTDOWN(_vertical_compaction_write_thread_pool);
+    SAFE_SHUTDOWN(_file_cache_write_behind_thread_pool);
+    SAFE_SHUTDOWN(_s3_file_read_thread_pool);
     SAFE_SHUTDOWN(_send_batch_thread_pool);
     SAFE_SHUTDOWN(_send_table_stats_thread_pool);
 
@@ -749,6 +814,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_inverted_index_query_cache);
     SAFE_DELETE(_inverted_index_searcher_cache);
     SAFE_DELETE(_lookup_connection_cache);
+    SAFE_DELETE(_descriptor_tbl_cache);
     SAFE_DELETE(_schema_cache);
     SAFE_DELETE(_segment_loader);
     SAFE_DELETE(_row_cache);
@@ -769,6 +835,8 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_load_path_mgr);
     SAFE_DELETE(_result_mgr);
     SAFE_DELETE(_file_meta_cache);
+    SAFE_DELETE(_deletion_vector_cache);
+    SAFE_DELETE(_hyperscan_database_cache);
     SAFE_DELETE(_group_commit_mgr);
     SAFE_DELETE(_routine_load_task_executor);
     // _stream_load_executor
@@ -792,6 +860,12 @@ void ExecEnv::destroy() {
     _lazy_release_obj_pool.reset(nullptr);
     _non_block_close_thread_pool.reset(nullptr);
     _s3_file_system_thread_pool.reset(nullptr);
+    _inverted_index_compaction_thread_pool.reset(nullptr);
+    _memtable_sort_thread_pool.reset(nullptr);
+    _segment_column_encode_thread_pool.reset(nullptr);
+    _vertical_compaction_write_thread_pool.reset(nullptr);
+    _file_cache_write_behind_thread_pool.reset(nullptr);
+    _s3_file_read_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
     _s3_file_upload_thread_pool.reset(nullptr);
@@ -20,6 +20,7 @@
 #include <gen_cpp/Types_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <chrono>
 
 #include "client_cache.h"
@@ -242,6 +243,39 @@ void LoadBlockQueue::_cancel_without_lock(const Status& st) {
                << ", inner load_id=" << load_instance_id;
 }
 
+int64_t GroupCommitIntervalController::interval_ms(int64_t max_interval_ms,
+                                                  int64_t data_bytes_threshold,
+                                                  size_t inflight_loads) {
+    std::lock_guard l(_lock);
+    if (_bytes_per_ms < 0 || max_interval_ms <= 0) {
+        return max_interval_ms;
+    }
+    double interval = static_cast<double>(max_interval_ms);
+    if (data_bytes_threshold > 0) {
+        // the part of a full batch collected in one max interval
+        double fill = _bytes_per_ms * interval / static_cast<double>(data_bytes_threshold);
+        interval *= std::min(1.0, fill);
+    }
+    interval = std::max(interval, _commit_ms * static_cast<double>(inflight_loads));
+    int64_t min_interval_ms = std::min<int64_t>(config::group_commit_min_interval_ms,
+                                                max_interval_ms);
+    return std::clamp(static_cast<int64_t>(interval), min_interval_ms, max_interval_ms);
+}
+
+void GroupCommitIntervalController::update(int64_t data_bytes, int64_t window_ms,
+                                           int64_t commit_ms) {
+    double bytes_per_ms =
+            static_cast<double>(data_bytes) / static_cast<double>(std::max<int64_t>(window_ms, 1));
+    std::lock_guard l(_lock);
+    if (_bytes_per_ms < 0) {
+        _bytes_per_ms = bytes_per_ms;
+        _commit_ms = static_cast<double>(commit_ms);
+        return;
+    }
+    _bytes_per_ms = ALPHA * bytes_per_ms + (1 - ALPHA) * _bytes_per_ms;
+    _commit_ms = ALPHA * static_cast<double>(commit_ms) + (1 - ALPHA) * _commit_ms;
+}
+
 Status GroupCommitTable::get_first_block_load_queue(
         int64_t table_id, int64_t base_schema_version, int64_t index_size, const UniqueId& load_id,
         std::shared_ptr<LoadBlockQueue>& load_block_queue, int be_exe_version,
@@ -385,9 +419,19 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
                    << ", label=" << label << ", txn_id=" << txn_id
                    << ", instance_id=" << print_id(instance_id);
         {
+            int64_t interval_ms = result.group_commit_interval_ms;
+            if (config::enable_adaptive_group_commit_interval) {
+                size_t inflight_loads = 0;
+                {
+                    std::unique_lock l(_lock);
+                    inflight_loads = _load_block_queues.size();
+                }
+                interval_ms = _interval_controller.interval_ms(
+                        interval_ms, result.group_commit_data_bytes, inflight_loads);
+            }
             auto load_block_queue = std::make_shared<LoadBlockQueue>(
                     instance_id, label, txn_id, schema_version, index_size, _all_block_queues_bytes,
-                    result.wait_internal_group_commit_finish, result.group_commit_interval_ms,
+                    result.wait_internal_group_commit_finish, interval_ms,
                     result.group_commit_data_bytes);
             RETURN_IF_ERROR(load_block_queue->create_wal(
                     _db_id, _table_id, txn_id, label, _exec_env->wal_mgr(),
@@ -432,6 +476,7 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
                                                    RuntimeState* state) {
     Status st;
     Status result_status;
+    auto finish_start_time = std::chrono::steady_clock::now();
     DBUG_EXECUTE_IF("LoadBlockQueue._finish_group_commit_load.err_status",
                     { status = Status::InternalError(""); });
     DBUG_EXECUTE_IF("LoadBlockQueue._finish_group_commit_load.load_error",
@@ -506,6 +551,9 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
                     Status ::InternalError(msg));
         });
     }
+    auto commit_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             std::chrono::steady_clock::now() - finish_start_time)
+                             .count();
     std::shared_ptr<LoadBlockQueue> load_block_queue;
     {
         std::lock_guard<std::mutex> l(_lock);
@@ -520,6 +568,13 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
             // notify sync mode loads
             {
                 std::unique_lock l2(load_block_queue->mutex);
+                if (status.ok() && st.ok() && result_status.ok()) {
+                    auto window_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                             finish_start_time - load_block_queue->start_time())
+                                             .count();
+                    _interval_controller.update(load_block_queue->data_bytes(), window_ms,
+                                                commit_ms);
+                }
                 load_block_queue->process_finish = true;
                 for (auto dep : load_block_queue->dependencies) {
                     dep->set_always_ready();
@@ -20,6 +20,7 @@
 #include <gen_cpp/PaloInternalService_types.h>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <future>
@@ -90,6 +91,8 @@ public:
     void append_dependency(std::shared_ptr<pipeline::Dependency> finish_dep);
     void append_read_dependency(std::shared_ptr<pipeline::Dependency> read_dep);
     int64_t get_group_commit_interval_ms() { return _group_commit_interval_ms; };
+    int64_t data_bytes() const { return _data_bytes; }
+    std::chrono::steady_clock::time_point start_time() const { return _start_time; }
 
     std::string debug_string() const {
         fmt::memory_buffer debug_string_buffer;
@@ -149,6 +152,31 @@ private:
     std::condition_variable _get_cond;
 };
 
+// Tunes the commit interval of the group commit loads of a table, the interval of the table is
+// the upper bound. When the data comes slowly, waiting longer only collects a few more rows, so a
+// load is committed soon. As the rate grows the interval grows with it, until the rows of one
+// interval reach the data bytes threshold and commits are made by data size instead. The interval
+// is also kept above the recent commit latency times the loads still committing, so that commits
+// don't pile up.
+class GroupCommitIntervalController {
+public:
+    // The interval of a new load, inflight_loads are the loads of the table not finished yet.
+    int64_t interval_ms(int64_t max_interval_ms, int64_t data_bytes_threshold,
+                        size_t inflight_loads);
+
+    // A load collected data_bytes in window_ms and took commit_ms to commit.
+    void update(int64_t data_bytes, int64_t window_ms, int64_t commit_ms);
+
+private:
+    // weight of the latest load in the moving averages
+    static constexpr double ALPHA = 0.5;
+
+    std::mutex _lock;
+    // < 0 means there is no load yet
+    double _bytes_per_ms = -1;
+    double _commit_ms = 0;
+};
+
 class GroupCommitTable {
 public:
     GroupCommitTable(ExecEnv* exec_env, doris::ThreadPool* thread_pool, int64_t db_id,
@@ -197,6 +225,7 @@ private:
                                   std::shared_ptr<pipeline::Dependency>, int64_t, int64_t>>
             _create_plan_deps;
     std::string _create_plan_failed_reason;
+    GroupCommitIntervalController _interval_controller;
 };
 
 class GroupCommitMgr {
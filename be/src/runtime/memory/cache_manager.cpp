@@ -17,7 +17,10 @@
 
 #include "runtime/memory/cache_manager.h"
 
+#include <algorithm>
+
 #include "runtime/memory/cache_policy.h"
+#include "runtime/memory/lru_cache_policy.h"
 #include "util/runtime_profile.h"
 
 namespace doris {
@@ -82,5 +85,112 @@ int64_t CacheManager::for_each_cache_refresh_capacity(double adjust_weighted,
     return freed_size;
 }
 
+bool CacheManager::arbitrate_capacity(std::vector<CacheUtility>* caches, double max_weighted) {
+    // the receiver must be this much better than the donor, so the capacity doesn't swing
+    constexpr double MIN_UTILITY_RATIO = 1.2;
+    // the capacity moved each round, in the sum of the initial capacities
+    constexpr double STEP_RATIO = 0.05;
+    if (caches->size() < 2 || max_weighted <= 1) {
+        return false;
+    }
+    double min_weighted = 1 / max_weighted;
+    double total_capacity = 0;
+    for (const auto& cache : *caches) {
+        total_capacity += static_cast<double>(cache.initial_capacity);
+    }
+    auto capacity = [](const CacheUtility& cache) {
+        return static_cast<double>(cache.initial_capacity) * cache.arbitrated_weighted;
+    };
+    // hits per MB
+    auto utility = [&capacity](const CacheUtility& cache) {
+        return static_cast<double>(cache.hits) / std::max(capacity(cache) / 1048576, 1.0);
+    };
+
+    CacheUtility* receiver = nullptr;
+    for (auto& cache : *caches) {
+        if (cache.full && cache.lookups > cache.hits && cache.arbitrated_weighted < max_weighted &&
+            (receiver == nullptr || utility(cache) > utility(*receiver))) {
+            receiver = &cache;
+        }
+    }
+    if (receiver == nullptr) {
+        return false;
+    }
+    CacheUtility* donor = nullptr;
+    for (auto& cache : *caches) {
+        if (&cache != receiver && cache.arbitrated_weighted > min_weighted &&
+            (donor == nullptr || utility(cache) < utility(*donor))) {
+            donor = &cache;
+        }
+    }
+    if (donor == nullptr || utility(*receiver) <= utility(*donor) * MIN_UTILITY_RATIO) {
+        return false;
+    }
+
+    double moved = std::min({total_capacity * STEP_RATIO,
+                             capacity(*donor) - static_cast<double>(donor->initial_capacity) *
+                                                        min_weighted,
+                             static_cast<double>(receiver->initial_capacity) * max_weighted -
+                                     capacity(*receiver)});
+    // less than a MB is not worth pruning the caches
+    if (moved < 1048576) {
+        return false;
+    }
+    donor->arbitrated_weighted -= moved / static_cast<double>(donor->initial_capacity);
+    receiver->arbitrated_weighted += moved / static_cast<double>(receiver->initial_capacity);
+    return true;
+}
+
+int64_t CacheManager::for_each_cache_arbitrate_capacity(RuntimeProfile* profile) {
+    int64_t freed_size = 0;
+    std::lock_guard<std::mutex> l(_caches_lock);
+    std::vector<CacheUtility> caches;
+    for (const auto& [type, cache_policy] : _caches) {
+        auto* lru_cache_policy = dynamic_cast<LRUCachePolicy*>(cache_policy);
+        // the capacity of a NUMBER cache is not in bytes, and a small cache is not worth it
+        if (!cache_policy->enable_prune() || lru_cache_policy == nullptr ||
+            !lru_cache_policy->is_size_capacity() ||
+            cache_policy->initial_capacity() < CACHE_MIN_PRUNE_SIZE) {
+            continue;
+        }
+        uint64_t lookups = lru_cache_policy->get_lookup_count();
+        uint64_t hits = lru_cache_policy->get_hit_count();
+        auto& [last_lookups, last_hits] = _last_cache_hits[type];
+        CacheUtility cache;
+        cache.type = type;
+        cache.initial_capacity = cache_policy->initial_capacity();
+        cache.arbitrated_weighted = lru_cache_policy->arbitrated_weighted();
+        // the counters restart from zero if the cache is created again
+        cache.lookups = lookups >= last_lookups ? lookups - last_lookups : lookups;
+        cache.hits = hits >= last_hits ? hits - last_hits : hits;
+        cache.full = static_cast<double>(lru_cache_policy->get_usage()) >=
+                     static_cast<double>(lru_cache_policy->get_capacity()) * 0.9;
+        last_lookups = lookups;
+        last_hits = hits;
+        caches.push_back(cache);
+    }
+
+    std::vector<double> old_weighted;
+    for (const auto& cache : caches) {
+        old_weighted.push_back(cache.arbitrated_weighted);
+    }
+    if (!arbitrate_capacity(&caches, config::cache_capacity_arbitration_max_weighted)) {
+        return 0;
+    }
+    for (size_t i = 0; i < caches.size(); ++i) {
+        if (caches[i].arbitrated_weighted == old_weighted[i]) {
+            continue;
+        }
+        auto* cache_policy = _caches[caches[i].type];
+        static_cast<LRUCachePolicy*>(cache_policy)
+                ->set_arbitrated_weighted(caches[i].arbitrated_weighted);
+        freed_size += cache_policy->profile()->get_counter("FreedMemory")->value();
+        if (cache_policy->profile()->get_counter("FreedMemory")->value() != 0 && profile) {
+            profile->add_child(cache_policy->profile(), true, nullptr);
+        }
+    }
+    return freed_size;
+}
+
 #include "common/compile_check_end.h"
 } // namespace doris
@@ -19,6 +19,8 @@
 
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "runtime/exec_env.h"
 #include "runtime/memory/cache_policy.h"
@@ -86,9 +88,31 @@ public:
     int64_t for_each_cache_refresh_capacity(double adjust_weighted,
                                             RuntimeProfile* profile = nullptr);
 
+    // The hits of a cache in the last round of capacity arbitration.
+    struct CacheUtility {
+        CachePolicy::CacheType type = CachePolicy::CacheType::NONE;
+        size_t initial_capacity = 0;
+        double arbitrated_weighted = 1;
+        uint64_t lookups = 0;
+        uint64_t hits = 0;
+        // the usage is close to the capacity, more capacity may turn the misses into hits
+        bool full = false;
+    };
+
+    // Move a step of capacity from the cache with the least hits per MB to the full one with the
+    // most, so the sum of the capacities is kept. The arbitrated weighted of a cache stays in
+    // [1 / max_weighted, max_weighted]. Return false if nothing is moved.
+    static bool arbitrate_capacity(std::vector<CacheUtility>* caches, double max_weighted);
+
+    // Sample the hits of the caches whose capacity is in bytes and move capacity between them,
+    // the capacity shrunk by memory pressure `for_each_cache_refresh_capacity` is still applied.
+    int64_t for_each_cache_arbitrate_capacity(RuntimeProfile* profile = nullptr);
+
 private:
     std::mutex _caches_lock;
     std::unordered_map<CachePolicy::CacheType, CachePolicy*> _caches;
+    // cache type -> <lookups, hits> at the last arbitration
+    std::unordered_map<CachePolicy::CacheType, std::pair<uint64_t, uint64_t>> _last_cache_hits;
     int64_t _last_prune_stale_timestamp = 0;
     int64_t _last_prune_all_timestamp = 0;
 };
@@ -56,6 +56,11 @@ public:
         QUERY_CACHE = 20,
         TABLET_COLUMN_OBJECT_POOL = 21,
         SCHEMA_CLOUD_DICTIONARY_CACHE = 22,
+        DESCRIPTOR_TBL_CACHE = 23,
+        COMPRESSED_DATA_PAGE_CACHE = 24,
+        FILE_META_RANGE_CACHE = 25,
+        DELETION_VECTOR_CACHE = 26,
+        HYPERSCAN_DATABASE_CACHE = 27,
     };
 
     static std::string type_string(CacheType type) {
@@ -104,6 +109,16 @@ public:
             return "TabletColumnObjectPool";
         case CacheType::SCHEMA_CLOUD_DICTIONARY_CACHE:
             return "SchemaCloudDictionaryCache";
+        case CacheType::DESCRIPTOR_TBL_CACHE:
+            return "DescriptorTblCache";
+        case CacheType::COMPRESSED_DATA_PAGE_CACHE:
+            return "CompressedDataPageCache";
+        case CacheType::FILE_META_RANGE_CACHE:
+            return "FileMetaRangeCache";
+        case CacheType::DELETION_VECTOR_CACHE:
+            return "DeletionVectorCache";
+        case CacheType::HYPERSCAN_DATABASE_CACHE:
+            return "HyperscanDatabaseCache";
         default:
             throw Exception(Status::FatalError("not match type of cache policy :{}",
                                                static_cast<int>(type)));
@@ -134,6 +149,11 @@ public:
             {"QueryCache", CacheType::QUERY_CACHE},
             {"TabletColumnObjectPool", CacheType::TABLET_COLUMN_OBJECT_POOL},
             {"SchemaCloudDictionaryCache", CacheType::SCHEMA_CLOUD_DICTIONARY_CACHE},
+            {"DescriptorTblCache", CacheType::DESCRIPTOR_TBL_CACHE},
+            {"CompressedDataPageCache", CacheType::COMPRESSED_DATA_PAGE_CACHE},
+            {"FileMetaRangeCache", CacheType::FILE_META_RANGE_CACHE},
+            {"DeletionVectorCache", CacheType::DELETION_VECTOR_CACHE},
+            {"HyperscanDatabaseCache", CacheType::HYPERSCAN_DATABASE_CACHE},
     };
 
     static CacheType string_to_type(std::string type) {
@@ -117,6 +117,14 @@ public:
         return rt;
     }
 
+    // Whether the process memory reaches config::spill_ahead_process_memory_percent of the soft
+    // limit, the reserved memory is counted, so it's checked after reserving.
+    static bool is_exceed_spill_ahead_mem_limit() {
+        return config::spill_ahead_process_memory_percent > 0 &&
+               process_memory_usage() >= MemInfo::soft_mem_limit() / 100 *
+                                                 config::spill_ahead_process_memory_percent;
+    }
+
     static bool is_exceed_hard_mem_limit(int64_t bytes = 0) {
         if (bytes > 0 && sub_thread_reserve_memory(bytes) <= 0) {
             return false;
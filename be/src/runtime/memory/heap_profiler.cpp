@@ -23,6 +23,9 @@
 #include "agent/utils.h"
 #include "common/config.h"
 #include "io/fs/local_file_system.h"
+#include "runtime/workload_group/workload_group.h"
+#include "runtime/workload_management/resource_context.h"
+#include "util/uid_util.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -155,5 +158,59 @@ bool HeapProfiler::heap_profiler_reset(size_t lg_sample) {
     return true;
 }
 
+bool HeapProfiler::start_continuous_heap_profile() {
+    if (!check_enable_heap_profiler()) {
+        LOG(WARNING) << "continuous heap profile is not started, the `JEMALLOC_CONF` in "
+                        "`be/conf/be.conf` must contain `prof:true`.";
+        return false;
+    }
+    if (!heap_profiler_reset(config::continuous_heap_profile_lg_sample)) {
+        return false;
+    }
+    heap_profiler_start();
+    LOG(INFO) << "continuous heap profile started, lg_sample: "
+              << config::continuous_heap_profile_lg_sample;
+    return true;
+}
+
+void HeapProfiler::dump_continuous_heap_profile() {
+    std::string profile_file_name = dump_heap_profile();
+    if (profile_file_name.empty()) {
+        return;
+    }
+    std::lock_guard guard(_continuous_profiles_mutex);
+    _continuous_profiles.push_back(std::move(profile_file_name));
+    while (_continuous_profiles.size() >
+           static_cast<size_t>(std::max(config::continuous_heap_profile_ring_size, 1))) {
+        auto st = io::global_local_filesystem()->delete_file(_continuous_profiles.front());
+        if (!st.ok()) {
+            LOG(WARNING) << "delete heap profile " << _continuous_profiles.front()
+                         << " failed: " << st;
+        }
+        _continuous_profiles.pop_front();
+    }
+}
+
+std::vector<std::string> HeapProfiler::continuous_heap_profiles() {
+    std::lock_guard guard(_continuous_profiles_mutex);
+    return {_continuous_profiles.begin(), _continuous_profiles.end()};
+}
+
+void HeapProfiler::set_thread_task_name(const ResourceContext* resource_ctx) {
+#ifdef USE_JEMALLOC
+    std::string name;
+    if (resource_ctx != nullptr) {
+        auto wg = resource_ctx->workload_group();
+        name = fmt::format("query_id={},workload_group={}",
+                           print_id(resource_ctx->task_controller()->task_id()),
+                           wg ? wg->name() : "");
+    }
+    const char* name_ptr = name.c_str();
+    if (jemallctl("thread.prof.name", nullptr, nullptr, &name_ptr, sizeof(const char*)) != 0) {
+        LOG_EVERY_N(WARNING, 1000) << "jemallctl thread.prof.name failed";
+    }
+#endif
+}
+
 #include "common/compile_check_end.h"
 } // namespace doris
@@ -17,11 +17,17 @@
 
 #pragma once
 
+#include <deque>
+#include <string>
+#include <vector>
+
 #include "runtime/exec_env.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
 
+class ResourceContext;
+
 class HeapProfiler {
 public:
     static HeapProfiler* create_global_instance() { return new HeapProfiler(); }
@@ -36,11 +42,22 @@ public:
     std::string dump_heap_profile();
     std::string dump_heap_profile_to_dot();
 
+    // Continuous heap profiling, see config::continuous_heap_profile_interval_s.
+    bool start_continuous_heap_profile();
+    void dump_continuous_heap_profile();
+    // The files of the recent continuous profiles, the oldest first.
+    std::vector<std::string> continuous_heap_profiles();
+    // Names the current thread by the task in the heap profiles, nullptr clears the name.
+    static void set_thread_task_name(const ResourceContext* resource_ctx);
+
 private:
     void set_prof_active(bool prof);
     bool get_prof_dump(const std::string& profile_file_name);
 
     std::mutex _mutex;
+
+    std::mutex _continuous_profiles_mutex;
+    std::deque<std::string> _continuous_profiles;
 };
 
 #include "common/compile_check_end.h"
@@ -20,6 +20,8 @@
 #include <atomic>
 #include <condition_variable>
 
+#include "common/config.h"
+
 namespace doris {
 #include "common/compile_check_begin.h"
 
@@ -36,6 +38,10 @@ std::atomic<int64_t> JemallocControl::je_metadata_mem_ = 0;
 std::atomic<int64_t> JemallocControl::je_dirty_pages_mem_ = std::numeric_limits<int64_t>::min();
 std::atomic<int64_t> JemallocControl::je_virtual_memory_used_ = 0;
 
+std::mutex JemallocControl::je_query_arenas_lock_;
+std::vector<int> JemallocControl::je_free_query_arenas_;
+int JemallocControl::je_query_arenas_created_ = 0;
+
 void JemallocControl::refresh_allocator_mem() {
 #if defined(ADDRESS_SANITIZER) || defined(LEAK_SANITIZER) || defined(THREAD_SANITIZER)
 #elif defined(USE_JEMALLOC)
@@ -138,6 +144,44 @@ void JemallocControl::je_thread_tcache_flush() {
     }
 }
 
+int JemallocControl::je_acquire_query_arena() {
+    std::lock_guard<std::mutex> l(je_query_arenas_lock_);
+    if (!je_free_query_arenas_.empty()) {
+        int arena_index = je_free_query_arenas_.back();
+        je_free_query_arenas_.pop_back();
+        return arena_index;
+    }
+    if (je_query_arenas_created_ >= config::je_query_arena_num) {
+        return -1;
+    }
+    unsigned arena_index = 0;
+    size_t arena_index_size = sizeof(arena_index);
+    if (jemallctl("arenas.create", &arena_index, &arena_index_size, nullptr, 0) != 0) {
+        LOG(WARNING) << "Failed, jemallctl arenas.create";
+        return -1;
+    }
+    ++je_query_arenas_created_;
+    return static_cast<int>(arena_index);
+}
+
+void JemallocControl::je_release_query_arena(int arena_index) {
+    action_jemallctl(fmt::format("arena.{}.purge", arena_index));
+    std::lock_guard<std::mutex> l(je_query_arenas_lock_);
+    je_free_query_arenas_.push_back(arena_index);
+}
+
+int JemallocControl::je_swap_thread_arena(int arena_index) {
+    auto new_arena = static_cast<unsigned>(arena_index);
+    unsigned old_arena = 0;
+    size_t old_arena_size = sizeof(old_arena);
+    if (jemallctl("thread.arena", &old_arena, &old_arena_size, &new_arena, sizeof(new_arena)) !=
+        0) {
+        LOG(WARNING) << fmt::format("Failed, jemallctl thread.arena set to {}", arena_index);
+        return -1;
+    }
+    return static_cast<int>(old_arena);
+}
+
 #else
 void JemallocControl::action_jemallctl(const std::string& name) {}
 int64_t JemallocControl::get_je_all_arena_metrics(const std::string& name) {
@@ -151,6 +195,13 @@ void JemallocControl::je_purge_all_arena_dirty_pages() {}
 void JemallocControl::je_reset_all_arena_dirty_decay_ms(ssize_t dirty_decay_ms) {}
 void JemallocControl::je_decay_all_arena_dirty_pages() {}
 void JemallocControl::je_thread_tcache_flush() {}
+int JemallocControl::je_acquire_query_arena() {
+    return -1;
+}
+void JemallocControl::je_release_query_arena(int arena_index) {}
+int JemallocControl::je_swap_thread_arena(int arena_index) {
+    return -1;
+}
 #endif
 
 #include "common/compile_check_end.h"
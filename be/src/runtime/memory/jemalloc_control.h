@@ -18,7 +18,9 @@
 #pragma once
 
 #include <condition_variable>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "common/logging.h"
 
@@ -91,6 +93,17 @@ public:
     // only free the thread cache of the current thread, which will be fast.
     static void je_thread_tcache_flush();
 
+    // Returns a dedicated arena for a query, which is pooled or created if there are less than
+    // config::je_query_arena_num arenas, or -1 if all of them are in use.
+    static int je_acquire_query_arena();
+    // Purges all the unused pages of the arena at once when its query ends, and pools it for the
+    // later queries. The arena isn't reset or destroyed, because some memory allocated by the
+    // query may outlive it, e.g. the cache.
+    static void je_release_query_arena(int arena_index);
+    // Binds the current thread to the arena, and returns the arena the thread used before, or -1
+    // if it fails.
+    static int je_swap_thread_arena(int arena_index);
+
     // Tcmalloc property `generic.total_physical_bytes` records the total length of the virtual memory
     // obtained by the process malloc, not the physical memory actually used by the process in the OS.
     static void refresh_allocator_mem();
@@ -130,6 +143,10 @@ private:
     static std::atomic<int64_t> je_metadata_mem_;
     static std::atomic<int64_t> je_dirty_pages_mem_;
     static std::atomic<int64_t> je_virtual_memory_used_;
+
+    static std::mutex je_query_arenas_lock_;
+    static std::vector<int> je_free_query_arenas_;
+    static int je_query_arenas_created_;
 };
 
 #include "common/compile_check_end.h"
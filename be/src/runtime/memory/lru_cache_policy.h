@@ -37,13 +37,14 @@ public:
     LRUCachePolicy(CacheType type, size_t capacity, LRUCacheType lru_cache_type,
                    uint32_t stale_sweep_time_s, uint32_t num_shards = DEFAULT_LRU_CACHE_NUM_SHARDS,
                    uint32_t element_count_capacity = DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY,
-                   bool enable_prune = true, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K)
+                   bool enable_prune = true, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K,
+                   bool is_tiny_lfu = DEFAULT_LRU_CACHE_IS_TINY_LFU)
             : CachePolicy(type, capacity, stale_sweep_time_s, enable_prune),
               _lru_cache_type(lru_cache_type) {
         if (check_capacity(capacity, num_shards)) {
             _cache = std::shared_ptr<ShardedLRUCache>(
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
-                                        element_count_capacity, is_lru_k));
+                                        element_count_capacity, is_lru_k, is_tiny_lfu));
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
@@ -56,14 +57,15 @@ public:
                    uint32_t element_count_capacity,
                    CacheValueTimeExtractor cache_value_time_extractor,
                    bool cache_value_check_timestamp, bool enable_prune = true,
-                   bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K)
+                   bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K,
+                   bool is_tiny_lfu = DEFAULT_LRU_CACHE_IS_TINY_LFU)
             : CachePolicy(type, capacity, stale_sweep_time_s, enable_prune),
               _lru_cache_type(lru_cache_type) {
         if (check_capacity(capacity, num_shards)) {
             _cache = std::shared_ptr<ShardedLRUCache>(
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
                                         cache_value_time_extractor, cache_value_check_timestamp,
-                                        element_count_capacity, is_lru_k));
+                                        element_count_capacity, is_lru_k, is_tiny_lfu));
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
@@ -243,8 +245,33 @@ public:
 
     int64_t adjust_capacity_weighted(double adjust_weighted) override {
         std::lock_guard<std::mutex> l(_lock);
-        auto capacity =
-                static_cast<size_t>(static_cast<double>(_initial_capacity) * adjust_weighted);
+        _adjust_weighted = adjust_weighted;
+        return _refresh_capacity();
+    }
+
+    // Set by CacheManager to move capacity from the caches with less hits per MB to the others,
+    // the capacity is initial capacity * adjust_weighted * arbitrated_weighted.
+    int64_t set_arbitrated_weighted(double arbitrated_weighted) {
+        std::lock_guard<std::mutex> l(_lock);
+        _arbitrated_weighted = arbitrated_weighted;
+        return _refresh_capacity();
+    }
+
+    double arbitrated_weighted() {
+        std::lock_guard<std::mutex> l(_lock);
+        return _arbitrated_weighted;
+    }
+
+    bool is_size_capacity() const { return _lru_cache_type == LRUCacheType::SIZE; }
+
+    uint64_t get_lookup_count() { return _cache->get_lookup_count(); }
+
+    uint64_t get_hit_count() { return _cache->get_hit_count(); }
+
+protected:
+    int64_t _refresh_capacity() {
+        auto capacity = static_cast<size_t>(static_cast<double>(_initial_capacity) *
+                                            _adjust_weighted * _arbitrated_weighted);
         COUNTER_SET(_freed_entrys_counter, (int64_t)0);
         COUNTER_SET(_freed_memory_counter, (int64_t)0);
         COUNTER_SET(_cost_timer, (int64_t)0);
@@ -264,16 +291,15 @@ public:
         COUNTER_UPDATE(_adjust_capacity_weighted_number_counter, 1);
         LOG(INFO) << fmt::format(
                 "[MemoryGC] {} update capacity, old <capacity {}, consumption {}, usage {}>, "
-                "adjust_weighted {}, new <capacity {}, consumption {}, usage {}>, prune {} "
-                "entries, {} bytes, cost {}, {} times prune",
-                type_string(_type), old_capacity, old_mem_consumption, old_usage, adjust_weighted,
-                get_capacity(), mem_consumption(), get_usage(), _freed_entrys_counter->value(),
-                _freed_memory_counter->value(), _cost_timer->value(),
-                _adjust_capacity_weighted_number_counter->value());
+                "adjust_weighted {}, arbitrated_weighted {}, new <capacity {}, consumption {}, "
+                "usage {}>, prune {} entries, {} bytes, cost {}, {} times prune",
+                type_string(_type), old_capacity, old_mem_consumption, old_usage,
+                _adjust_weighted, _arbitrated_weighted, get_capacity(), mem_consumption(),
+                get_usage(), _freed_entrys_counter->value(), _freed_memory_counter->value(),
+                _cost_timer->value(), _adjust_capacity_weighted_number_counter->value());
         return _freed_entrys_counter->value();
     }
 
-protected:
     void _init_mem_tracker(const std::string& type_name) {
         if (std::find(CachePolicy::MetadataCache.begin(), CachePolicy::MetadataCache.end(),
                       _type) == CachePolicy::MetadataCache.end()) {
@@ -294,6 +320,8 @@ protected:
     std::shared_ptr<Cache> _cache;
     std::mutex _lock;
     LRUCacheType _lru_cache_type;
+    double _adjust_weighted = 1;
+    double _arbitrated_weighted = 1;
 
     std::shared_ptr<MemTrackerLimiter> _mem_tracker;
     std::shared_ptr<MemTracker> _value_mem_tracker;
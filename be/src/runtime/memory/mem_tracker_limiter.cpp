@@ -29,6 +29,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
 #include "runtime/memory/global_memory_arbitrator.h"
+#include "runtime/memory/jemalloc_control.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_group/workload_group.h"
 #include "service/backend_options.h"
@@ -121,6 +122,9 @@ MemTrackerLimiter::~MemTrackerLimiter() {
                    << ", peak consumption: " << peak_consumption() << print_address_sanitizers();
     }
     DCHECK_EQ(reserved_consumption(), 0);
+    if (_jemalloc_arena >= 0) {
+        JemallocControl::je_release_query_arena(_jemalloc_arena);
+    }
     memory_memtrackerlimiter_cnt << -1;
 }
 
@@ -130,6 +130,10 @@ public:
     void set_enable_check_limit(bool enable_check_limit) {
         _enable_check_limit = enable_check_limit;
     }
+    // The dedicated jemalloc arena of the query, which the attached threads allocate from, -1 means
+    // the shared arenas. It's released when the tracker is destructed.
+    int jemalloc_arena() const { return _jemalloc_arena; }
+    void set_jemalloc_arena(int jemalloc_arena) { _jemalloc_arena = jemalloc_arena; }
     Status check_limit(int64_t bytes = 0);
     // Log the memory usage when memory limit is exceeded.
     std::string tracker_limit_exceeded_str();
@@ -269,6 +273,8 @@ private:
     // Avoid frequent printing.
     bool _enable_print_log_usage = false;
 
+    int _jemalloc_arena = -1;
+
     std::shared_ptr<MemTrackerLimiter> _write_tracker;
 
     struct AddressSanitizer {
@@ -20,6 +20,7 @@
 #include <gen_cpp/types.pb.h>
 
 #include "runtime/exec_env.h"
+#include "runtime/memory/jemalloc_control.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -39,6 +40,11 @@ void ThreadMemTrackerMgr::attach_limiter_tracker(
         _reserved_mem = 0;
         _untracked_mem = 0;
     }
+    if (mem_tracker->jemalloc_arena() >= 0) {
+        _last_attach_snapshots_stack.back().jemalloc_arena =
+                JemallocControl::je_swap_thread_arena(mem_tracker->jemalloc_arena());
+    }
+    flush_untracked_consumer_mem();
     _consumer_tracker_stack.clear();
     _limiter_tracker_sptr = mem_tracker;
     _limiter_tracker = _limiter_tracker_sptr.get();
@@ -56,10 +62,15 @@ void ThreadMemTrackerMgr::detach_limiter_tracker() {
     flush_untracked_mem();
     shrink_reserved();
     DCHECK(!_last_attach_snapshots_stack.empty());
+    // rebind the arena before the tracker may be destructed and pool its arena
+    if (_last_attach_snapshots_stack.back().jemalloc_arena >= 0) {
+        JemallocControl::je_swap_thread_arena(_last_attach_snapshots_stack.back().jemalloc_arena);
+    }
     _limiter_tracker_sptr = _last_attach_snapshots_stack.back().limiter_tracker;
     _limiter_tracker = _limiter_tracker_sptr.get();
     _wg_wptr = _last_attach_snapshots_stack.back().wg_wptr;
     _reserved_mem = _last_attach_snapshots_stack.back().reserved_mem;
+    flush_untracked_consumer_mem();
     _consumer_tracker_stack = _last_attach_snapshots_stack.back().consumer_tracker_stack;
     _last_attach_snapshots_stack.pop_back();
 }
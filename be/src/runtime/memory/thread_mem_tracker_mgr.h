@@ -81,6 +81,7 @@ public:
     // Returns whether the memory exceeds limit, and will consume mem trcker no matter whether the limit is exceeded.
     void consume(int64_t size);
     void flush_untracked_mem();
+    void flush_untracked_consumer_mem();
 
     enum class TryReserveChecker {
         NONE = 0,
@@ -149,6 +150,8 @@ private:
         std::weak_ptr<WorkloadGroup> wg_wptr;
         int64_t reserved_mem = 0;
         std::vector<MemTracker*> consumer_tracker_stack;
+        // the jemalloc arena to rebind the thread to when detaching, -1 means not changed
+        int jemalloc_arena = -1;
     };
 
     // is false: ExecEnv::ready() = false when thread local is initialized
@@ -156,6 +159,8 @@ private:
     // Cache untracked mem.
     int64_t _untracked_mem = 0;
     int64_t _old_untracked_mem = 0;
+    // Cache untracked mem of the consumer trackers, see enable_consumer_mem_tracker_batch_consume.
+    int64_t _untracked_consumer_mem = 0;
 
     int64_t _reserved_mem = 0;
 
@@ -198,21 +203,38 @@ inline bool ThreadMemTrackerMgr::push_consumer_tracker(MemTracker* tracker) {
     if (std::count(_consumer_tracker_stack.begin(), _consumer_tracker_stack.end(), tracker)) {
         return false;
     }
+    flush_untracked_consumer_mem();
     _consumer_tracker_stack.push_back(tracker);
     return true;
 }
 
 inline void ThreadMemTrackerMgr::pop_consumer_tracker() {
     DCHECK(!_consumer_tracker_stack.empty());
+    flush_untracked_consumer_mem();
     _consumer_tracker_stack.pop_back();
 }
 
+inline void ThreadMemTrackerMgr::flush_untracked_consumer_mem() {
+    if (_untracked_consumer_mem == 0) {
+        return;
+    }
+    for (auto* tracker : _consumer_tracker_stack) {
+        tracker->consume(_untracked_consumer_mem);
+    }
+    _untracked_consumer_mem = 0;
+}
+
 inline void ThreadMemTrackerMgr::consume(int64_t size) {
     memory_orphan_check();
     // `consumer_tracker` not support reserve memory and not require use `_untracked_mem` to batch consume,
     // because `consumer_tracker` will not be bound by many threads, so there is no performance problem.
-    for (auto* tracker : _consumer_tracker_stack) {
-        tracker->consume(size);
+    // But updating every consumer tracker on every allocation still costs, so they can be batched.
+    if (!_consumer_tracker_stack.empty()) {
+        _untracked_consumer_mem += size;
+        if (!config::enable_consumer_mem_tracker_batch_consume ||
+            std::abs(_untracked_consumer_mem) >= config::mem_tracker_consume_min_size_bytes) {
+            flush_untracked_consumer_mem();
+        }
     }
 
     if (_reserved_mem != 0) {
@@ -19,6 +19,7 @@
 
 #include <stddef.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -37,6 +38,10 @@ public:
     virtual Status finish() { return Status::OK(); }
     // called when read HTTP failed
     virtual void cancel(const std::string& reason) {}
+    // Returns true if the next append of a chunk does not block. Otherwise `on_writable` is
+    // called once by the consumer when there is room for a chunk or the sink is cancelled, so
+    // the producer can wait for it without blocking a thread.
+    virtual bool writable(std::function<void()> on_writable) { return true; }
 
     bool finished() const { return _finished; }
     bool cancelled() const { return _cancelled; }
@@ -38,6 +38,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
 #include "runtime/memory/heap_profiler.h"
+#include "runtime/memory/jemalloc_control.h"
 #include "runtime/runtime_query_statistics_mgr.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
@@ -172,6 +173,9 @@ void QueryContext::_init_query_mem_tracker() {
     // If the workload group or process runs out of memory, it will be forced to cancel.
     query_mem_tracker->set_enable_check_limit(!(_query_options.__isset.enable_reserve_memory &&
                                                 _query_options.enable_reserve_memory));
+    if (config::je_query_arena_num > 0 && bytes_limit >= config::je_query_arena_min_mem_limit) {
+        query_mem_tracker->set_jemalloc_arena(JemallocControl::je_acquire_query_arena());
+    }
     _resource_ctx->memory_context()->set_mem_tracker(query_mem_tracker);
 }
 
@@ -250,7 +254,8 @@ QueryContext::~QueryContext() {
 #endif
     DorisMetrics::instance()->query_ctx_cnt->increment(-1);
     // the only one msg shows query's end. any other msg should append to it if need.
-    LOG_INFO("Query {} deconstructed, mem_tracker: {}", print_id(this->_query_id), mem_tracker_msg);
+    LOG_INFO("Query {} deconstructed, mem_tracker: {}, read tiers: {}", print_id(this->_query_id),
+             mem_tracker_msg, _resource_ctx->io_context()->read_tiers_debug_string());
 }
 
 void QueryContext::set_ready_to_execute(Status reason) {
@@ -396,6 +401,11 @@ Status QueryContext::set_workload_group(WorkloadGroupPtr& wg) {
 
     workload_group()->get_query_scheduler(&_task_scheduler, &_scan_task_scheduler,
                                           &_remote_scan_task_scheduler);
+#ifndef BE_TEST
+    _pipeline_trace_sampled =
+            ExecEnv::GetInstance()->pipeline_tracer_context()->sampler()->should_sample(
+                    _query_id, workload_group()->id());
+#endif
     return Status::OK();
 }
 
@@ -78,6 +78,8 @@ const std::string toString(QuerySource query_source);
 // Some components like DescriptorTbl may be very large
 // that will slow down each execution of fragments when DeSer them every time.
 class DescriptorTbl;
+struct CachedDescriptorTbl;
+struct QueryCacheLookup;
 class QueryContext : public std::enable_shared_from_this<QueryContext> {
     ENABLE_FACTORY_CREATOR(QueryContext);
 
@@ -150,6 +152,9 @@ public:
 
     Status set_workload_group(WorkloadGroupPtr& wg);
 
+    // whether the events of the pipeline tasks of this query are recorded by the trace sampler
+    bool pipeline_trace_sampled() const { return _pipeline_trace_sampled; }
+
     int execution_timeout() const {
         return _query_options.__isset.execution_timeout ? _query_options.execution_timeout
                                                         : _query_options.query_timeout;
@@ -227,6 +232,8 @@ public:
     }
 
     DescriptorTbl* desc_tbl = nullptr;
+    // Holds `desc_tbl` when it comes from DescriptorTblCache
+    std::shared_ptr<CachedDescriptorTbl> cached_desc_tbl;
     bool set_rsc_info = false;
     std::string user;
     std::string group;
@@ -243,6 +250,10 @@ public:
     // only for file scan node
     std::map<int, TFileScanRangeParams> file_scan_range_params_map;
 
+    // query cache key -> the lookup shared by the olap scan and the cache source of the tablet
+    std::mutex query_cache_lookups_lock;
+    std::unordered_map<std::string, std::shared_ptr<QueryCacheLookup>> query_cache_lookups;
+
     void add_using_brpc_stub(const TNetworkAddress& network_address,
                              std::shared_ptr<PBackendService_Stub> brpc_stub) {
         if (network_address.port == 0) {
@@ -286,6 +297,7 @@ private:
     MonotonicStopWatch _query_watcher;
     bool _is_nereids = false;
 
+    bool _pipeline_trace_sampled = false;
     std::shared_ptr<ResourceContext> _resource_ctx;
 
     // A token used to submit olap scanner to the "_limited_scan_thread_pool",
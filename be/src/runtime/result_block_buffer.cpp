@@ -131,8 +131,14 @@ void ResultBlockBuffer<ResultCtxType>::_update_dependency() {
         return;
     }
 
+    // The blocks of wide rows are also limited by bytes, they are what the clients of arrow flight
+    // extract large results with.
+    const int64_t max_bytes = std::is_same_v<InBlockType, vectorized::Block>
+                                      ? config::arrow_flight_result_sink_buffer_size_bytes
+                                      : 0;
     for (auto it : _result_sink_dependencies) {
-        if (_instance_rows[it.first] > _batch_size) {
+        if (_instance_rows[it.first] > _batch_size ||
+            (max_bytes > 0 && _instance_bytes[it.first] > static_cast<size_t>(max_bytes))) {
             it.second->block();
         } else {
             it.second->set_ready();
@@ -140,6 +146,19 @@ void ResultBlockBuffer<ResultCtxType>::_update_dependency() {
     }
 }
 
+template <typename ResultCtxType>
+void ResultBlockBuffer<ResultCtxType>::_pop_front_batch() {
+    _result_batch_queue.pop_front();
+    for (auto it : _instance_rows_in_queue.front()) {
+        _instance_rows[it.first] -= it.second;
+    }
+    _instance_rows_in_queue.pop_front();
+    for (auto it : _instance_bytes_in_queue.front()) {
+        _instance_bytes[it.first] -= it.second;
+    }
+    _instance_bytes_in_queue.pop_front();
+}
+
 template <typename ResultCtxType>
 Status ResultBlockBuffer<ResultCtxType>::get_batch(std::shared_ptr<ResultCtxType> ctx) {
     std::lock_guard<std::mutex> l(_lock);
@@ -151,11 +170,7 @@ Status ResultBlockBuffer<ResultCtxType>::get_batch(std::shared_ptr<ResultCtxType
     }
     if (!_result_batch_queue.empty()) {
         auto result = _result_batch_queue.front();
-        _result_batch_queue.pop_front();
-        for (auto it : _instance_rows_in_queue.front()) {
-            _instance_rows[it.first] -= it.second;
-        }
-        _instance_rows_in_queue.pop_front();
+        _pop_front_batch();
         RETURN_IF_ERROR(ctx->on_data(result, _packet_num, this));
         _packet_num++;
         return Status::OK();
@@ -224,6 +239,7 @@ Status ResultBlockBuffer<ResultCtxType>::add_batch(RuntimeState* state,
                 _last_batch_bytes += batch_size;
             } else {
                 _instance_rows_in_queue.emplace_back();
+                _instance_bytes_in_queue.emplace_back();
                 _result_batch_queue.push_back(std::move(result));
                 _last_batch_bytes = batch_size;
                 _arrow_data_arrival
@@ -231,6 +247,7 @@ Status ResultBlockBuffer<ResultCtxType>::add_batch(RuntimeState* state,
             }
         } else {
             _instance_rows_in_queue.emplace_back();
+            _instance_bytes_in_queue.emplace_back();
             _result_batch_queue.push_back(std::move(result));
             _last_batch_bytes = batch_size;
             _arrow_data_arrival
@@ -238,6 +255,8 @@ Status ResultBlockBuffer<ResultCtxType>::add_batch(RuntimeState* state,
         }
         _instance_rows[state->fragment_instance_id()] += num_rows;
         _instance_rows_in_queue.back()[state->fragment_instance_id()] += num_rows;
+        _instance_bytes[state->fragment_instance_id()] += batch_size;
+        _instance_bytes_in_queue.back()[state->fragment_instance_id()] += batch_size;
     } else {
         auto ctx = _waiting_rpc.front();
         _waiting_rpc.pop_front();
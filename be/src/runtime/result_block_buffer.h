@@ -90,6 +90,8 @@ protected:
     ResultBlockBuffer(RuntimeState* state)
             : ResultBlockBuffer<ResultCtxType>(TUniqueId(), state, 0) {}
     void _update_dependency();
+    // Release the rows and bytes of the front batch from the instances it was merged from.
+    void _pop_front_batch();
 
     using ResultQueue = std::list<std::shared_ptr<InBlockType>>;
 
@@ -117,6 +119,8 @@ protected:
     std::unordered_map<TUniqueId, std::shared_ptr<pipeline::Dependency>> _result_sink_dependencies;
     std::unordered_map<TUniqueId, size_t> _instance_rows;
     std::list<std::unordered_map<TUniqueId, size_t>> _instance_rows_in_queue;
+    std::unordered_map<TUniqueId, size_t> _instance_bytes;
+    std::list<std::unordered_map<TUniqueId, size_t>> _instance_bytes_in_queue;
     std::shared_ptr<MemTrackerLimiter> _mem_tracker;
     int _packet_num = 0;
     const int _batch_size;
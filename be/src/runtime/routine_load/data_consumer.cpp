@@ -203,6 +203,32 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
     MonotonicStopWatch consumer_watch;
     MonotonicStopWatch watch;
     watch.start();
+
+    // the messages are handed over to the group in batches, so the queue is locked once for
+    // a batch instead of once for every message
+    const size_t max_batch_size = std::max(config::routine_load_consume_batch_size, 1);
+    std::vector<RdKafka::Message*> batch;
+    batch.reserve(max_batch_size);
+    int64_t batch_rows = 0;
+    Defer delete_batch {[&batch]() {
+        for (auto* msg : batch) {
+            delete msg;
+        }
+    }};
+    // returns false if the queue is shutdown
+    auto put_batch = [&]() {
+        if (batch.empty()) {
+            return true;
+        }
+        if (!queue->controlled_blocking_put_batch(&batch,
+                                                  config::blocking_queue_cv_wait_timeout_ms)) {
+            return false;
+        }
+        put_rows += batch_rows;
+        batch_rows = 0;
+        return true;
+    };
+
     while (true) {
         {
             std::unique_lock<std::mutex> l(_lock);
@@ -216,9 +242,11 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
         }
 
         bool done = false;
-        // consume 1 message at a time
+        // wait for the first message of a batch, the rest of the batch is taken from the
+        // messages the consumer already fetched
+        int timeout_ms = batch.empty() ? 1000 : 0;
         consumer_watch.start();
-        std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(1000 /* timeout, ms */));
+        std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(timeout_ms));
         consumer_watch.stop();
         DorisMetrics::instance()->routine_load_get_msg_count->increment(1);
         DorisMetrics::instance()->routine_load_get_msg_latency->increment(
@@ -233,7 +261,8 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             st = Status::InternalError<false>(ss.str());
             break;
         });
-        switch (msg->err()) {
+        RdKafka::ErrorCode err = msg->err();
+        switch (err) {
         case RdKafka::ERR_NO_ERROR:
             if (_consuming_partition_ids.count(msg->partition()) <= 0) {
                 _consuming_partition_ids.insert(msg->partition());
@@ -243,21 +272,19 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
                 // ignore msg with length 0.
                 // put empty msg into queue will cause the load process shutting down.
                 break;
-            } else if (!queue->controlled_blocking_put(msg.get(),
-                                                       config::blocking_queue_cv_wait_timeout_ms)) {
-                // queue is shutdown
-                done = true;
-            } else {
-                ++put_rows;
-                msg.release(); // release the ownership, msg will be deleted after being processed
             }
+            // release the ownership, msg will be deleted after being processed
+            batch.push_back(msg.release());
+            ++batch_rows;
             ++received_rows;
             DorisMetrics::instance()->routine_load_consume_rows->increment(1);
             break;
         case RdKafka::ERR__TIMED_OUT:
             // leave the status as OK, because this may happened
             // if there is no data in kafka.
-            LOG(INFO) << "kafka consume timeout: " << _id;
+            if (timeout_ms > 0) {
+                LOG(INFO) << "kafka consume timeout: " << _id;
+            }
             break;
         case RdKafka::ERR__TRANSPORT:
             LOG(INFO) << "kafka consume Disconnected: " << _id
@@ -271,15 +298,10 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             VLOG_NOTICE << "consumer meet partition eof: " << _id
                         << " partition offset: " << msg->offset();
             _consuming_partition_ids.erase(msg->partition());
-            if (!queue->controlled_blocking_put(msg.get(),
-                                                config::blocking_queue_cv_wait_timeout_ms)) {
-                done = true;
-            } else if (_consuming_partition_ids.size() <= 0) {
+            batch.push_back(msg.release());
+            if (_consuming_partition_ids.size() <= 0) {
                 LOG(INFO) << "all partitions meet eof: " << _id;
-                msg.release();
                 done = true;
-            } else {
-                msg.release();
             }
             break;
         }
@@ -299,11 +321,20 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             break;
         }
 
+        // hand over the batch once it is full or no message is fetched right now
+        if ((done || err != RdKafka::ERR_NO_ERROR || batch.size() >= max_batch_size) &&
+            !put_batch()) {
+            // queue is shutdown
+            done = true;
+        }
+
         left_time = max_running_time_ms - watch.elapsed_time() / 1000 / 1000;
         if (done) {
             break;
         }
     }
+    // the messages consumed before the consumer is cancelled or runs out of time
+    static_cast<void>(put_batch());
 
     LOG(INFO) << "kafka consumer done: " << _id << ", grp: " << _grp_id
               << ". cancelled: " << _cancelled << ", left time(ms): " << left_time
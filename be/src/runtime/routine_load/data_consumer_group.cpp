@@ -23,6 +23,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/logging.h"
 #include "librdkafka/rdkafkacpp.h"
@@ -120,6 +121,11 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
         append_data = &io::KafkaConsumerPipe::append_with_line_delimiter;
     }
 
+    // the messages taken from the queue at a time
+    static constexpr size_t MAX_GET_BATCH_SIZE = 256;
+    std::vector<RdKafka::Message*> msgs;
+    msgs.reserve(MAX_GET_BATCH_SIZE);
+
     MonotonicStopWatch watch;
     watch.start();
     bool eos = false;
@@ -155,20 +161,27 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
             return Status::OK();
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.controlled_blocking_get(&msg, config::blocking_queue_cv_wait_timeout_ms);
+        bool res = _queue.controlled_blocking_get_batch(&msgs, MAX_GET_BATCH_SIZE,
+                                                        config::blocking_queue_cv_wait_timeout_ms);
         if (res) {
             // conf has to be deleted finally
-            Defer delete_msg {[msg]() { delete msg; }};
-            VLOG_NOTICE << "get kafka message"
-                        << ", partition: " << msg->partition() << ", offset: " << msg->offset()
-                        << ", len: " << msg->len();
-
-            if (msg->err() == RdKafka::ERR__PARTITION_EOF) {
-                if (msg->offset() > 0) {
-                    cmt_offset[msg->partition()] = msg->offset() - 1;
+            Defer delete_msgs {[&msgs]() {
+                for (auto* msg : msgs) {
+                    delete msg;
+                }
+                msgs.clear();
+            }};
+            for (auto* msg : msgs) {
+                VLOG_NOTICE << "get kafka message"
+                            << ", partition: " << msg->partition() << ", offset: " << msg->offset()
+                            << ", len: " << msg->len();
+
+                if (msg->err() == RdKafka::ERR__PARTITION_EOF) {
+                    if (msg->offset() > 0) {
+                        cmt_offset[msg->partition()] = msg->offset() - 1;
+                    }
+                    continue;
                 }
-            } else {
                 Status st = (kafka_pipe.get()->*append_data)(
                         static_cast<const char*>(msg->payload()), static_cast<size_t>(msg->len()));
                 if (st.ok()) {
@@ -187,6 +200,11 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
                             result_st = st;
                         }
                     }
+                    break;
+                }
+                if (left_rows <= 0 || left_bytes <= 0) {
+                    // the rest of the batch is left to the next task
+                    break;
                 }
             }
         } else {
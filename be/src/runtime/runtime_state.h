@@ -662,6 +662,10 @@ public:
 
     int profile_level() const { return _profile_level; }
 
+    // Profile level 0 turns the scoped timers of the pipeline tasks and their operators into
+    // no-ops, e.g. for short queries whose profile is never read.
+    bool profile_timers_disabled() const { return _profile_level == 0; }
+
     std::shared_ptr<IdFileMap>& get_id_file_map() { return _id_file_map; }
 
     void set_id_file_map();
@@ -28,6 +28,7 @@
 #include "common/logging.h"
 #include "common/macros.h"
 #include "runtime/exec_env.h"
+#include "runtime/memory/heap_profiler.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/memory/thread_mem_tracker_mgr.h"
 #include "runtime/workload_management/resource_context.h"
@@ -138,6 +139,11 @@
         }                                                                                    \
     }
 
+// Attribute the read of the current scope to `tier` of the task attached to the thread,
+// `bytes_read` points to the number of bytes read, which is known only after the read.
+#define SCOPED_RECORD_READ_TIER(tier, bytes_read) \
+    auto VARNAME_LINENUM(record_read_tier) = doris::ScopedReadTierRecorder(tier, bytes_read)
+
 namespace doris {
 
 class ThreadContext;
@@ -181,9 +187,15 @@ public:
         thread_mem_tracker_mgr->attach_limiter_tracker(rc->memory_context()->mem_tracker(),
                                                        rc->workload_group());
         thread_mem_tracker_mgr->enable_wait_gc();
+        if (config::continuous_heap_profile_interval_s > 0) {
+            HeapProfiler::set_thread_task_name(rc.get());
+        }
     }
 
     void detach_task() {
+        if (config::continuous_heap_profile_interval_s > 0) {
+            HeapProfiler::set_thread_task_name(nullptr);
+        }
         resource_ctx_.reset();
         thread_mem_tracker_mgr->detach_limiter_tracker();
         thread_mem_tracker_mgr->disable_wait_gc();
@@ -392,6 +404,49 @@ private:
     std::shared_ptr<MemTracker> _mem_tracker;
 };
 
+// Records the read of the scope to the IOContext of the task attached to the thread. The local
+// files of the file cache are read inside the scope of the file cache tier, so these reads are
+// attributed to the file cache instead of the local disk.
+class ScopedReadTierRecorder {
+public:
+    ScopedReadTierRecorder(IOContext::ReadTier tier, const size_t* bytes_read)
+            : _tier(tier), _bytes_read(bytes_read) {
+        if (tier == IOContext::ReadTier::LOCAL_DISK && _in_file_cache_read) {
+            return;
+        }
+        auto* t_ctx = doris::thread_context();
+        if (!t_ctx->is_attach_task()) {
+            return;
+        }
+        _resource_ctx = t_ctx->resource_ctx();
+        if (tier == IOContext::ReadTier::FILE_CACHE) {
+            _outer_in_file_cache_read = _in_file_cache_read;
+            _in_file_cache_read = true;
+        }
+        _watch.start();
+    }
+
+    ~ScopedReadTierRecorder() {
+        if (_resource_ctx == nullptr) {
+            return;
+        }
+        if (_tier == IOContext::ReadTier::FILE_CACHE) {
+            _in_file_cache_read = _outer_in_file_cache_read;
+        }
+        _resource_ctx->io_context()->update_read(_tier, 1, static_cast<int64_t>(*_bytes_read),
+                                                 _watch.elapsed_time());
+    }
+
+private:
+    static inline thread_local bool _in_file_cache_read = false;
+
+    const IOContext::ReadTier _tier;
+    const size_t* _bytes_read;
+    std::shared_ptr<ResourceContext> _resource_ctx;
+    bool _outer_in_file_cache_read = false;
+    MonotonicStopWatch _watch;
+};
+
 class ScopeSkipMemoryCheck {
 public:
     explicit ScopeSkipMemoryCheck() {
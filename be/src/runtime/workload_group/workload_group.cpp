@@ -584,6 +584,10 @@ Status WorkloadGroup::upsert_thread_pool_no_lock(WorkloadGroupInfo* wg_info,
     }
 
     // 2 update thread pool
+    if (_task_sched) {
+        _task_sched->set_cpu_share(wg_info->cpu_share);
+    }
+
     if (scan_thread_num > 0 && _scan_task_sched) {
         _scan_task_sched->reset_thread_num(scan_thread_num, scan_thread_num);
     }
@@ -32,6 +32,10 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_remote_scan_bytes, doris::Me
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_total_local_scan_bytes,
                                      doris::MetricUnit::BYTES);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_local_scan_bytes, doris::MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_pipeline_schedule_latency_us,
+                                     doris::MetricUnit::MICROSECONDS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_pipeline_schedule_count,
+                                     doris::MetricUnit::NOUNIT);
 
 #include "common/compile_check_begin.h"
 
@@ -48,6 +52,8 @@ WorkloadGroupMetrics::WorkloadGroupMetrics(WorkloadGroup* wg) {
     INT_GAUGE_METRIC_REGISTER(_entity, workload_group_mem_used_bytes);
     INT_COUNTER_METRIC_REGISTER(_entity, workload_group_remote_scan_bytes);
     INT_COUNTER_METRIC_REGISTER(_entity, workload_group_total_local_scan_bytes);
+    INT_COUNTER_METRIC_REGISTER(_entity, workload_group_pipeline_schedule_latency_us);
+    INT_COUNTER_METRIC_REGISTER(_entity, workload_group_pipeline_schedule_count);
 
     std::vector<DataDirInfo>& data_dir_list = io::BeConfDataDirReader::be_config_data_dir_list;
     for (const auto& data_dir : data_dir_list) {
@@ -84,6 +90,11 @@ void WorkloadGroupMetrics::update_remote_scan_io_bytes(uint64_t delta_io_bytes)
     workload_group_remote_scan_bytes->increment(delta_io_bytes);
 }
 
+void WorkloadGroupMetrics::update_pipeline_schedule_latency(uint64_t latency_ns) {
+    workload_group_pipeline_schedule_latency_us->increment((int64_t)(latency_ns / 1000));
+    workload_group_pipeline_schedule_count->increment(1);
+}
+
 void WorkloadGroupMetrics::refresh_metrics() {
     int interval_second = config::workload_group_metrics_interval_ms / 1000;
 
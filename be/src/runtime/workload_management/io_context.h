@@ -17,8 +17,14 @@
 
 #pragma once
 
+#include <fmt/format.h>
+
+#include <array>
+#include <string>
+
 #include "common/factory_creator.h"
 #include "runtime/workload_management/io_throttle.h"
+#include "util/pretty_printer.h"
 #include "util/runtime_profile.h"
 
 namespace doris {
@@ -30,6 +36,28 @@ class IOContext : public std::enable_shared_from_this<IOContext> {
     ENABLE_FACTORY_CREATOR(IOContext);
 
 public:
+    // The tier the data read by a task comes from.
+    enum class ReadTier : uint8_t { PAGE_CACHE, FILE_CACHE, LOCAL_DISK, REMOTE_STORAGE };
+    static constexpr size_t NUM_READ_TIERS = 4;
+    // Upper bounds of the buckets of the read latency histogram, the last bucket is unbounded.
+    static constexpr std::array<int64_t, 5> READ_LATENCY_BUCKET_BOUNDS_NS = {
+            100'000, 1'000'000, 10'000'000, 100'000'000, 1'000'000'000};
+    static constexpr size_t NUM_READ_LATENCY_BUCKETS = READ_LATENCY_BUCKET_BOUNDS_NS.size() + 1;
+
+    static const char* read_tier_name(ReadTier tier) {
+        switch (tier) {
+        case ReadTier::PAGE_CACHE:
+            return "PageCache";
+        case ReadTier::FILE_CACHE:
+            return "FileCache";
+        case ReadTier::LOCAL_DISK:
+            return "LocalDisk";
+        case ReadTier::REMOTE_STORAGE:
+            return "RemoteStorage";
+        }
+        return "Unknown";
+    }
+
     /*
     * 1. operate them thread-safe.
     * 2. all tasks are unified.
@@ -49,6 +77,15 @@ public:
         RuntimeProfile::Counter* spill_write_bytes_to_local_storage_counter_;
         RuntimeProfile::Counter* spill_read_bytes_from_local_storage_counter_;
 
+        // updated by the reads of all threads of a task, so they are sharded
+        struct ReadTierCounters {
+            RuntimeProfile::Counter* read_ios_counter_;
+            RuntimeProfile::Counter* read_bytes_counter_;
+            RuntimeProfile::Counter* read_time_counter_;
+            std::array<RuntimeProfile::Counter*, NUM_READ_LATENCY_BUCKETS> read_latency_counters_;
+        };
+        std::array<ReadTierCounters, NUM_READ_TIERS> read_tier_counters_;
+
         RuntimeProfile* profile() { return profile_.get(); }
         void init_profile() {
             profile_ = std::make_unique<RuntimeProfile>("MemoryContext");
@@ -66,10 +103,31 @@ public:
                     ADD_COUNTER(profile_, "SpillWriteBytesToLocalStorage", TUnit::BYTES);
             spill_read_bytes_from_local_storage_counter_ =
                     ADD_COUNTER(profile_, "SpillReadBytesFromLocalStorage", TUnit::BYTES);
+            for (size_t i = 0; i < NUM_READ_TIERS; ++i) {
+                std::string tier = read_tier_name(static_cast<ReadTier>(i));
+                auto& counters = read_tier_counters_[i];
+                counters.read_ios_counter_ =
+                        ADD_SHARDED_COUNTER(profile_, tier + "ReadIOs", TUnit::UNIT);
+                counters.read_bytes_counter_ =
+                        ADD_SHARDED_COUNTER(profile_, tier + "ReadBytes", TUnit::BYTES);
+                counters.read_time_counter_ = ADD_SHARDED_TIMER(profile_, tier + "ReadTime");
+                for (size_t bucket = 0; bucket < NUM_READ_LATENCY_BUCKETS; ++bucket) {
+                    counters.read_latency_counters_[bucket] = profile_->add_sharded_counter(
+                            tier + read_latency_bucket_name(bucket), TUnit::UNIT,
+                            tier + "ReadIOs");
+                }
+            }
         }
         std::string debug_string() { return profile_->pretty_print(); }
 
     private:
+        static std::string read_latency_bucket_name(size_t bucket) {
+            static constexpr std::array<const char*, NUM_READ_LATENCY_BUCKETS> NAMES = {
+                    "ReadsUnder100us", "ReadsUnder1ms", "ReadsUnder10ms",
+                    "ReadsUnder100ms", "ReadsUnder1s",  "ReadsOver1s"};
+            return NAMES[bucket];
+        }
+
         std::unique_ptr<RuntimeProfile> profile_;
     };
 
@@ -122,6 +180,51 @@ public:
         stats_.spill_read_bytes_from_local_storage_counter_->update(delta);
     }
 
+    int64_t read_ios(ReadTier tier) const {
+        return stats_.read_tier_counters_[static_cast<size_t>(tier)].read_ios_counter_->value();
+    }
+    int64_t read_bytes(ReadTier tier) const {
+        return stats_.read_tier_counters_[static_cast<size_t>(tier)].read_bytes_counter_->value();
+    }
+    int64_t read_time_ns(ReadTier tier) const {
+        return stats_.read_tier_counters_[static_cast<size_t>(tier)].read_time_counter_->value();
+    }
+    int64_t read_latency_bucket(ReadTier tier, size_t bucket) const {
+        return stats_.read_tier_counters_[static_cast<size_t>(tier)]
+                .read_latency_counters_[bucket]
+                ->value();
+    }
+
+    // e.g. "PageCache: 10 reads, 40.00 KB, 0ns; FileCache: ..."
+    std::string read_tiers_debug_string() const {
+        std::string str;
+        for (size_t i = 0; i < NUM_READ_TIERS; ++i) {
+            auto tier = static_cast<ReadTier>(i);
+            str += fmt::format("{}{}: {} reads, {}, {}", i == 0 ? "" : "; ", read_tier_name(tier),
+                               read_ios(tier), PrettyPrinter::print_bytes(read_bytes(tier)),
+                               PrettyPrinter::print(read_time_ns(tier), TUnit::TIME_NS));
+        }
+        return str;
+    }
+
+    // Records `ios` reads of `bytes` in total from `tier`. The latency of a single read goes to
+    // the histogram, a negative latency means the reads are not timed, e.g. page cache hits.
+    void update_read(ReadTier tier, int64_t ios, int64_t bytes, int64_t latency_ns) const {
+        const auto& counters = stats_.read_tier_counters_[static_cast<size_t>(tier)];
+        counters.read_ios_counter_->update(ios);
+        counters.read_bytes_counter_->update(bytes);
+        if (latency_ns < 0) {
+            return;
+        }
+        counters.read_time_counter_->update(latency_ns);
+        size_t bucket = 0;
+        while (bucket < READ_LATENCY_BUCKET_BOUNDS_NS.size() &&
+               latency_ns >= READ_LATENCY_BUCKET_BOUNDS_NS[bucket]) {
+            ++bucket;
+        }
+        counters.read_latency_counters_[bucket]->update(ios);
+    }
+
     IOThrottle* io_throttle() {
         // TODO: get io throttle from workload group
         return nullptr;
@@ -149,6 +149,12 @@ private:
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 1);
     std::shared_ptr<RuntimeProfile::Counter> _always_true_counter =
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 1);
+    // the time spent executing the filter exprs, and the number of sampling periods they were
+    // ignored in for removing too few rows for their cost
+    std::shared_ptr<RuntimeProfile::Counter> _exec_timer =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::TIME_NS, 0, 2);
+    std::shared_ptr<RuntimeProfile::Counter> _ignored_periods_counter =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 2);
 
     int32_t _rf_wait_time_ms;
     const int64_t _registration_time;
@@ -0,0 +1,565 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <absl/strings/str_split.h>
+#include <fmt/format.h>
+#include <gen_cpp/olap_file.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "common/status.h"
+#include "io/cache/block_file_cache_factory.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "io/fs/s3_file_system.h"
+#include "olap/delete_handler.h"
+#include "olap/iterators.h"
+#include "olap/olap_common.h"
+#include "olap/page_cache.h"
+#include "olap/predicate_creator.h"
+#include "olap/rowset/segment_v2/column_reader.h"
+#include "olap/rowset/segment_v2/segment.h"
+#include "olap/rowset/segment_v2/segment_writer.h"
+#include "olap/schema.h"
+#include "olap/storage_engine.h"
+#include "olap/tablet_column_object_pool.h"
+#include "olap/tablet_meta.h"
+#include "olap/tablet_schema.h"
+#include "olap/tablet_schema_cache.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/cache_manager.h"
+#include "runtime/thread_context.h"
+#include "util/coding.h"
+#include "util/cpu_info.h"
+#include "util/crc32c.h"
+#include "util/mem_info.h"
+#include "util/s3_util.h"
+#include "util/stopwatch.hpp"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_factory.hpp"
+
+using doris::Status;
+using doris::TabletSchemaSPtr;
+using doris::segment_v2::SegmentFooterPB;
+
+DEFINE_string(operation, "scan", "valid operation: generate, scan");
+DEFINE_string(conf_file, "",
+              "be.conf to load, e.g. the file cache used by --fs=s3 is configured by it");
+DEFINE_string(fs, "local",
+              "storage backend of the segment, local or s3, s3 files are read by "
+              "CachedRemoteFileReader when the file cache is enabled");
+DEFINE_string(s3_endpoint, "", "s3 endpoint");
+DEFINE_string(s3_region, "", "s3 region");
+DEFINE_string(s3_bucket, "", "s3 bucket");
+DEFINE_string(s3_prefix, "", "s3 prefix");
+DEFINE_string(s3_ak, "", "s3 access key");
+DEFINE_string(s3_sk, "", "s3 secret key");
+DEFINE_string(file, "", "segment file path");
+DEFINE_string(pb_meta_path, "",
+              "pb tablet meta whose schema the segment is written with, --columns is used if "
+              "empty");
+DEFINE_string(columns, "k1:BIGINT:key,v1:INT,v2:DOUBLE,v3:VARCHAR",
+              "comma separated name:type[:key] columns, type is one of INT, BIGINT, DOUBLE, "
+              "VARCHAR");
+DEFINE_string(compression, "LZ4F", "compression of the generated segment");
+DEFINE_string(encodings, "",
+              "comma separated non-default encodings used by the generated segment: alp, delta, "
+              "fsst");
+DEFINE_int64(num_rows, 1000000, "rows of the generated segment");
+DEFINE_int64(cardinality, 100000, "distinct values of each generated value column");
+DEFINE_int32(string_length, 32, "length of the generated strings");
+DEFINE_double(null_ratio, 0, "ratio of the nulls in the generated value columns");
+DEFINE_string(predicates, "",
+              "semicolon separated predicates of the scan in the syntax of delete conditions, "
+              "e.g. 'k1>>100;v3=abc'");
+DEFINE_string(projection, "", "comma separated columns to scan, all columns if empty");
+DEFINE_string(page_cache, "warm",
+              "page cache state of the scans: off, cold (the page cache and file cache are "
+              "cleared before each scan) or warm (one scan before the measured ones)");
+DEFINE_int64(page_cache_size, 1L << 30, "capacity of the page cache");
+DEFINE_int32(iterations, 3, "number of measured scans");
+DEFINE_int32(batch_size, 4064, "rows of each block read by the scans");
+
+namespace doris {
+
+std::string get_usage(const std::string& progname) {
+    std::stringstream ss;
+    ss << progname << " benchmarks the segment read path of the Doris BE.\n";
+    ss << "Usage:\n";
+    ss << "./segment_bench_tool --operation=generate --file=/path/to/segment "
+          "--columns=k1:BIGINT:key,v1:VARCHAR --num_rows=1000000 --encodings=delta\n";
+    ss << "./segment_bench_tool --operation=scan --file=/path/to/segment "
+          "--columns=k1:BIGINT:key,v1:VARCHAR --predicates='k1>>100' --page_cache=cold\n";
+    ss << "./segment_bench_tool --operation=scan --fs=s3 --s3_endpoint=... --s3_bucket=... "
+          "--file=path/under/prefix --pb_meta_path=/path/to/tablet_meta --conf_file=be.conf\n";
+    ss << "A cold scan doesn't drop the OS page cache of local files.\n";
+    return ss.str();
+}
+
+Result<TabletSchemaSPtr> create_tablet_schema() {
+    auto tablet_schema = std::make_shared<TabletSchema>();
+    if (!FLAGS_pb_meta_path.empty()) {
+        TabletMeta tablet_meta;
+        RETURN_IF_ERROR_RESULT(tablet_meta.create_from_file(FLAGS_pb_meta_path));
+        return tablet_meta.tablet_schema();
+    }
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(KeysType::DUP_KEYS);
+    schema_pb.set_num_rows_per_row_block(1024);
+    segment_v2::CompressionTypePB compression;
+    if (!segment_v2::CompressionTypePB_Parse(FLAGS_compression, &compression)) {
+        return ResultError(Status::InvalidArgument("invalid compression {}", FLAGS_compression));
+    }
+    schema_pb.set_compression_type(compression);
+    int num_keys = 0;
+    std::vector<std::string> columns = absl::StrSplit(FLAGS_columns, ",", absl::SkipEmpty());
+    for (const auto& column : columns) {
+        std::vector<std::string> parts = absl::StrSplit(column, ":");
+        if (parts.size() < 2 || parts.size() > 3 || (parts.size() == 3 && parts[2] != "key")) {
+            return ResultError(Status::InvalidArgument("invalid column {}", column));
+        }
+        auto* column_pb = schema_pb.add_column();
+        column_pb->set_unique_id(schema_pb.column_size() - 1);
+        column_pb->set_name(parts[0]);
+        column_pb->set_type(parts[1]);
+        column_pb->set_aggregation("NONE");
+        column_pb->set_is_key(parts.size() == 3);
+        column_pb->set_is_nullable(!column_pb->is_key() && FLAGS_null_ratio > 0);
+        if (parts[1] == "INT") {
+            column_pb->set_length(4);
+            column_pb->set_index_length(4);
+        } else if (parts[1] == "BIGINT" || parts[1] == "DOUBLE") {
+            column_pb->set_length(8);
+            column_pb->set_index_length(8);
+        } else if (parts[1] == "VARCHAR") {
+            column_pb->set_length(65533);
+            column_pb->set_index_length(20);
+        } else {
+            return ResultError(Status::InvalidArgument("unsupported type of column {}", column));
+        }
+        num_keys += column_pb->is_key();
+    }
+    if (num_keys == 0) {
+        return ResultError(Status::InvalidArgument("no key column in {}", FLAGS_columns));
+    }
+    schema_pb.set_num_short_key_columns(num_keys);
+    tablet_schema->init_from_pb(schema_pb);
+    return tablet_schema;
+}
+
+Result<io::FileSystemSPtr> create_file_system() {
+    if (FLAGS_fs == "local") {
+        return io::global_local_filesystem();
+    }
+    if (FLAGS_fs != "s3") {
+        return ResultError(Status::InvalidArgument("invalid fs {}", FLAGS_fs));
+    }
+    S3Conf s3_conf;
+    s3_conf.bucket = FLAGS_s3_bucket;
+    s3_conf.prefix = FLAGS_s3_prefix;
+    s3_conf.client_conf.endpoint = FLAGS_s3_endpoint;
+    s3_conf.client_conf.region = FLAGS_s3_region;
+    s3_conf.client_conf.ak = FLAGS_s3_ak;
+    s3_conf.client_conf.sk = FLAGS_s3_sk;
+    s3_conf.client_conf.bucket = FLAGS_s3_bucket;
+    auto fs = DORIS_TRY(io::S3FileSystem::create(std::move(s3_conf), "segment_bench_tool"));
+    return std::static_pointer_cast<io::FileSystem>(fs);
+}
+
+// value of the generated row, key columns are increasing so the rows are sorted by the keys
+void append_value(const TabletColumn& column, vectorized::IColumn& dst, int64_t value,
+                  std::string* buffer) {
+    switch (column.type()) {
+    case FieldType::OLAP_FIELD_TYPE_INT: {
+        auto v = static_cast<int32_t>(value);
+        dst.insert_data(reinterpret_cast<const char*>(&v), sizeof(v));
+        break;
+    }
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+        dst.insert_data(reinterpret_cast<const char*>(&value), sizeof(value));
+        break;
+    case FieldType::OLAP_FIELD_TYPE_DOUBLE: {
+        auto v = static_cast<double>(value) / 100;
+        dst.insert_data(reinterpret_cast<const char*>(&v), sizeof(v));
+        break;
+    }
+    default: {
+        // zero padded so the strings sort as the values do
+        buffer->assign(fmt::format("{:020d}", value));
+        buffer->resize(std::max<size_t>(FLAGS_string_length, 1), 'x');
+        dst.insert_data(buffer->data(), buffer->size());
+        break;
+    }
+    }
+}
+
+Status generate() {
+    auto tablet_schema = DORIS_TRY(create_tablet_schema());
+    if (!FLAGS_encodings.empty()) {
+        std::vector<std::string> encodings = absl::StrSplit(FLAGS_encodings, ",");
+        for (const auto& encoding : encodings) {
+            RETURN_IF_ERROR(
+                    config::set_config(fmt::format("enable_{}_encoding", encoding), "true"));
+        }
+    }
+    auto fs = io::global_local_filesystem();
+    io::FileWriterPtr file_writer;
+    RETURN_IF_ERROR(fs->create_file(FLAGS_file, &file_writer));
+    segment_v2::SegmentWriterOptions opts;
+    segment_v2::SegmentWriter writer(file_writer.get(), 0, tablet_schema, nullptr, nullptr, opts,
+                                     nullptr);
+    RETURN_IF_ERROR(writer.init());
+
+    std::mt19937_64 rng(0);
+    std::uniform_int_distribution<int64_t> values(0, FLAGS_cardinality - 1);
+    std::bernoulli_distribution is_null(FLAGS_null_ratio);
+    std::string buffer;
+    for (int64_t row = 0; row < FLAGS_num_rows;) {
+        auto block = tablet_schema->create_block();
+        auto columns = block.mutate_columns();
+        int64_t rows = std::min<int64_t>(FLAGS_batch_size, FLAGS_num_rows - row);
+        for (int64_t i = 0; i < rows; ++i) {
+            for (size_t cid = 0; cid < tablet_schema->num_columns(); ++cid) {
+                const auto& column = tablet_schema->column(cid);
+                if (column.is_nullable() && is_null(rng)) {
+                    columns[cid]->insert_default();
+                    continue;
+                }
+                append_value(column, *columns[cid], column.is_key() ? row + i : values(rng),
+                             &buffer);
+            }
+        }
+        block.set_columns(std::move(columns));
+        RETURN_IF_ERROR(writer.append_block(&block, 0, rows));
+        row += rows;
+    }
+    uint64_t segment_size = 0;
+    uint64_t index_size = 0;
+    RETURN_IF_ERROR(writer.finalize(&segment_size, &index_size));
+    RETURN_IF_ERROR(file_writer->close());
+    std::cout << "generated " << FLAGS_file << ", rows: " << FLAGS_num_rows
+              << ", segment size: " << segment_size << ", index size: " << index_size
+              << std::endl;
+    return Status::OK();
+}
+
+// Footer := SegmentFooterPB, FooterPBSize(4), FooterPBChecksum(4), MagicNumber(4)
+Status read_segment_footer(io::FileReader* file_reader, SegmentFooterPB* footer) {
+    uint64_t file_size = file_reader->size();
+    if (file_size < 12) {
+        return Status::Corruption("Bad segment file {}: file size {} < 12",
+                                  file_reader->path().native(), file_size);
+    }
+    size_t bytes_read = 0;
+    uint8_t fixed_buf[12];
+    RETURN_IF_ERROR(file_reader->read_at(file_size - 12, Slice(fixed_buf, 12), &bytes_read));
+    uint32_t footer_length = decode_fixed32_le(fixed_buf);
+    if (file_size < 12 + footer_length) {
+        return Status::Corruption("Bad segment file {}: file size {} < {}",
+                                  file_reader->path().native(), file_size, 12 + footer_length);
+    }
+    std::string footer_buf;
+    footer_buf.resize(footer_length);
+    RETURN_IF_ERROR(
+            file_reader->read_at(file_size - 12 - footer_length, Slice(footer_buf), &bytes_read));
+    if (crc32c::Value(footer_buf.data(), footer_buf.size()) != decode_fixed32_le(fixed_buf + 4) ||
+        !footer->ParseFromString(footer_buf)) {
+        return Status::Corruption("Bad segment file {}: invalid footer",
+                                  file_reader->path().native());
+    }
+    return Status::OK();
+}
+
+void reset_caches() {
+    // segments hold no page handles after they are closed, so the page cache can be replaced
+    delete ExecEnv::GetInstance()->get_storage_page_cache();
+    ExecEnv::GetInstance()->set_storage_page_cache(
+            StoragePageCache::create_global_cache(FLAGS_page_cache_size, 10, 0));
+    if (FLAGS_fs == "s3" && config::enable_file_cache) {
+        io::FileCacheFactory::instance()->clear_file_caches(true);
+    }
+}
+
+struct ScanContext {
+    io::FileSystemSPtr fs;
+    TabletSchemaSPtr tablet_schema;
+    std::vector<uint32_t> return_columns;
+    std::vector<TCondition> conditions;
+    io::FileReaderOptions reader_options;
+    bool use_page_cache = false;
+};
+
+Status open_segment(const ScanContext& ctx, std::shared_ptr<segment_v2::Segment>* segment) {
+    return segment_v2::Segment::open(ctx.fs, FLAGS_file, 0, 0, RowsetId(), ctx.tablet_schema,
+                                     ctx.reader_options, segment);
+}
+
+void print_stats(const std::string& name, int64_t elapsed_ns, int64_t rows, int64_t segment_rows,
+                 const OlapReaderStatistics& stats) {
+    const auto& cache_stats = stats.file_cache_stats;
+    auto ratio = [&](int64_t filtered) {
+        return segment_rows == 0 ? 0.0 : static_cast<double>(filtered) / segment_rows;
+    };
+    double seconds = static_cast<double>(elapsed_ns) / 1e9;
+    std::cout << fmt::format(
+                         "{}: elapsed {:.3f}s, rows {}, rows/s {:.0f}, uncompressed MB/s {:.1f}, "
+                         "raw rows read {}\n"
+                         "  pruned by short key {:.4f}, zone map {:.4f}, bloom filter {:.4f}, "
+                         "inverted index {:.4f}, predicates {:.4f}\n"
+                         "  pages {} (cached {}), compressed bytes {}, uncompressed bytes {}, "
+                         "io {}ms, decompress {}ms\n"
+                         "  file cache local io {} ({} bytes), remote io {} ({} bytes)",
+                         name, seconds, rows, rows / seconds,
+                         static_cast<double>(stats.uncompressed_bytes_read) / seconds / 1e6,
+                         stats.raw_rows_read, ratio(stats.rows_key_range_filtered),
+                         ratio(stats.rows_stats_filtered), ratio(stats.rows_bf_filtered),
+                         ratio(stats.rows_inverted_index_filtered),
+                         ratio(stats.rows_vec_cond_filtered +
+                               stats.rows_short_circuit_cond_filtered),
+                         stats.total_pages_num, stats.cached_pages_num,
+                         stats.compressed_bytes_read, stats.uncompressed_bytes_read,
+                         stats.io_ns / 1000000, stats.decompress_ns / 1000000,
+                         cache_stats.num_local_io_total, cache_stats.bytes_read_from_local,
+                         cache_stats.num_remote_io_total, cache_stats.bytes_read_from_remote)
+              << std::endl;
+}
+
+// scan the projection with the predicates through SegmentIterator
+Status scan_segment(const ScanContext& ctx, const std::string& name) {
+    std::shared_ptr<segment_v2::Segment> segment;
+    RETURN_IF_ERROR(open_segment(ctx, &segment));
+    OlapReaderStatistics stats;
+    vectorized::Arena arena;
+    std::vector<std::unique_ptr<ColumnPredicate>> predicates;
+    StorageReadOptions read_options;
+    read_options.stats = &stats;
+    read_options.tablet_schema = ctx.tablet_schema;
+    read_options.use_page_cache = ctx.use_page_cache;
+    read_options.block_row_max = FLAGS_batch_size;
+    read_options.io_ctx.reader_type = ReaderType::READER_QUERY;
+    read_options.io_ctx.file_cache_stats = &stats.file_cache_stats;
+    for (const auto& condition : ctx.conditions) {
+        int32_t index = ctx.tablet_schema->field_index(condition.column_name);
+        predicates.emplace_back(parse_to_predicate(ctx.tablet_schema->column(index), index,
+                                                   condition, &arena));
+        auto* predicate = predicates.back().get();
+        read_options.column_predicates.push_back(predicate);
+        if (!read_options.col_id_to_predicates.contains(index)) {
+            read_options.col_id_to_predicates.insert(
+                    {index, AndBlockColumnPredicate::create_shared()});
+        }
+        read_options.col_id_to_predicates[index]->add_column_predicate(
+                SingleColumnBlockPredicate::create_unique(predicate));
+    }
+    auto schema = std::make_shared<Schema>(ctx.tablet_schema->columns(), ctx.return_columns);
+
+    MonotonicStopWatch watch;
+    watch.start();
+    std::unique_ptr<RowwiseIterator> iter;
+    RETURN_IF_ERROR(segment->new_iterator(schema, read_options, &iter));
+    int64_t rows = 0;
+    auto block = ctx.tablet_schema->create_block(ctx.return_columns);
+    while (true) {
+        block.clear_column_data();
+        auto st = iter->next_batch(&block);
+        if (st.is<ErrorCode::END_OF_FILE>()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        rows += block.rows();
+    }
+    print_stats(name, watch.elapsed_time(), rows, segment->num_rows(), stats);
+    return Status::OK();
+}
+
+// read each projected column without predicates to measure the decoding of its encoding
+Status decode_columns(const ScanContext& ctx) {
+    std::shared_ptr<segment_v2::Segment> segment;
+    RETURN_IF_ERROR(open_segment(ctx, &segment));
+    SegmentFooterPB footer;
+    RETURN_IF_ERROR(read_segment_footer(segment->file_reader().get(), &footer));
+    for (uint32_t cid : ctx.return_columns) {
+        const auto& column = ctx.tablet_schema->column(cid);
+        auto meta = std::find_if(
+                footer.columns().begin(), footer.columns().end(),
+                [&](const auto& meta) { return meta.unique_id() == column.unique_id(); });
+        if (meta == footer.columns().end()) {
+            continue;
+        }
+        OlapReaderStatistics stats;
+        StorageReadOptions read_options;
+        read_options.stats = &stats;
+        read_options.tablet_schema = ctx.tablet_schema;
+        read_options.io_ctx.reader_type = ReaderType::READER_QUERY;
+        read_options.io_ctx.file_cache_stats = &stats.file_cache_stats;
+        std::unique_ptr<segment_v2::ColumnIterator> iter;
+        RETURN_IF_ERROR(segment->new_column_iterator(column, &iter, &read_options));
+        segment_v2::ColumnIteratorOptions iter_opts;
+        iter_opts.use_page_cache = ctx.use_page_cache;
+        iter_opts.file_reader = segment->file_reader().get();
+        iter_opts.stats = &stats;
+        iter_opts.io_ctx = read_options.io_ctx;
+        RETURN_IF_ERROR(iter->init(iter_opts));
+        RETURN_IF_ERROR(iter->seek_to_ordinal(0));
+
+        auto type = vectorized::DataTypeFactory::instance().create_data_type(column);
+        MonotonicStopWatch watch;
+        watch.start();
+        int64_t rows = 0;
+        while (rows < segment->num_rows()) {
+            auto dst = type->create_column();
+            size_t n = std::min<int64_t>(FLAGS_batch_size, segment->num_rows() - rows);
+            bool has_null = false;
+            RETURN_IF_ERROR(iter->next_batch(&n, dst, &has_null));
+            if (n == 0) {
+                break;
+            }
+            rows += n;
+        }
+        print_stats(fmt::format("decode {} ({}, {}, {})", column.name(),
+                                segment_v2::EncodingTypePB_Name(meta->encoding()),
+                                segment_v2::CompressionTypePB_Name(meta->compression()),
+                                column.is_nullable() ? "nullable" : "not null"),
+                    watch.elapsed_time(), rows, segment->num_rows(), stats);
+    }
+    return Status::OK();
+}
+
+Status scan() {
+    ScanContext ctx;
+    ctx.fs = DORIS_TRY(create_file_system());
+    ctx.tablet_schema = DORIS_TRY(create_tablet_schema());
+    if (FLAGS_fs == "s3" && config::enable_file_cache) {
+        ctx.reader_options.cache_type = io::FileCachePolicy::FILE_BLOCK_CACHE;
+        ctx.reader_options.is_doris_table = true;
+    }
+    ctx.use_page_cache = FLAGS_page_cache != "off";
+    if (FLAGS_page_cache != "off" && FLAGS_page_cache != "cold" && FLAGS_page_cache != "warm") {
+        return Status::InvalidArgument("invalid page_cache {}", FLAGS_page_cache);
+    }
+    std::vector<std::string> projection =
+            absl::StrSplit(FLAGS_projection, ",", absl::SkipEmpty());
+    for (const auto& name : projection) {
+        int32_t index = ctx.tablet_schema->field_index(name);
+        if (index < 0) {
+            return Status::InvalidArgument("unknown column {}", name);
+        }
+        ctx.return_columns.push_back(index);
+    }
+    if (ctx.return_columns.empty()) {
+        for (uint32_t i = 0; i < ctx.tablet_schema->num_columns(); ++i) {
+            ctx.return_columns.push_back(i);
+        }
+    }
+    std::vector<std::string> predicates =
+            absl::StrSplit(FLAGS_predicates, ";", absl::SkipEmpty());
+    for (const auto& predicate : predicates) {
+        TCondition condition;
+        RETURN_IF_ERROR(DeleteHandler::parse_condition(predicate, &condition));
+        int32_t index = ctx.tablet_schema->field_index(condition.column_name);
+        if (index < 0) {
+            return Status::InvalidArgument("unknown column in predicate {}", predicate);
+        }
+        // the predicate columns must be read as well
+        if (std::find(ctx.return_columns.begin(), ctx.return_columns.end(), index) ==
+            ctx.return_columns.end()) {
+            ctx.return_columns.push_back(index);
+        }
+        ctx.conditions.push_back(std::move(condition));
+    }
+    std::sort(ctx.return_columns.begin(), ctx.return_columns.end());
+
+    if (FLAGS_page_cache == "warm") {
+        RETURN_IF_ERROR(scan_segment(ctx, "warm up"));
+    }
+    for (int i = 0; i < FLAGS_iterations; ++i) {
+        if (FLAGS_page_cache == "cold") {
+            reset_caches();
+        }
+        RETURN_IF_ERROR(scan_segment(ctx, fmt::format("scan {}", i)));
+    }
+    if (FLAGS_page_cache == "cold") {
+        reset_caches();
+    }
+    return decode_columns(ctx);
+}
+
+void init_exec_env() {
+    auto* exec_env = ExecEnv::GetInstance();
+    exec_env->init_mem_tracker();
+    exec_env->set_cache_manager(CacheManager::create_global_instance());
+    exec_env->set_storage_page_cache(
+            StoragePageCache::create_global_cache(FLAGS_page_cache_size, 10, 0));
+    exec_env->set_tablet_schema_cache(
+            TabletSchemaCache::create_global_schema_cache(config::tablet_schema_cache_capacity));
+    exec_env->set_tablet_column_object_pool(TabletColumnObjectPool::create_global_column_cache(
+            config::tablet_schema_cache_capacity));
+    exec_env->set_storage_engine(std::make_unique<StorageEngine>(EngineOptions {}));
+    if (FLAGS_fs == "s3") {
+        exec_env->set_file_cache_factory(new io::FileCacheFactory());
+        std::vector<CachePath> cache_paths;
+        exec_env->init_file_cache_factory(cache_paths);
+        exec_env->set_file_cache_open_fd_cache(std::make_unique<io::FDCache>());
+    }
+}
+
+} // namespace doris
+
+int main(int argc, char** argv) {
+    SCOPED_INIT_THREAD_CONTEXT();
+    std::string usage = doris::get_usage(argv[0]);
+    gflags::SetUsageMessage(usage);
+    google::ParseCommandLineFlags(&argc, &argv, true);
+
+    if (!doris::config::init(FLAGS_conf_file.empty() ? nullptr : FLAGS_conf_file.c_str(), true)) {
+        std::cout << "load config failed: " << FLAGS_conf_file << std::endl;
+        return -1;
+    }
+    if (FLAGS_file.empty()) {
+        std::cout << "no file flag\n" << usage << std::endl;
+        return -1;
+    }
+    doris::CpuInfo::init();
+    doris::MemInfo::init();
+    doris::init_exec_env();
+
+    Status st;
+    if (FLAGS_operation == "generate") {
+        st = doris::generate();
+    } else if (FLAGS_operation == "scan") {
+        st = doris::scan();
+    } else {
+        std::cout << "invalid operation: " << FLAGS_operation << "\n" << usage << std::endl;
+        return -1;
+    }
+    if (!st.ok()) {
+        std::cout << FLAGS_operation << " failed: " << st.to_string() << std::endl;
+        return -1;
+    }
+    gflags::ShutDownCommandLineFlags();
+    return 0;
+}
@@ -153,6 +153,9 @@ Status HttpService::start() {
     auto* adjust_tracing_dump = _pool.add(new AdjustTracingDump(_env));
     _ev_http_server->register_handler(HttpMethod::POST, "api/pipeline/tracing",
                                       adjust_tracing_dump);
+    auto* export_pipeline_trace = _pool.add(new ExportPipelineTrace(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "api/pipeline/tracing",
+                                      export_pipeline_trace);
 
     // Register BE version action
     VersionAction* version_action =
@@ -226,6 +229,11 @@ Status HttpService::start() {
     _ev_http_server->register_handler(HttpMethod::GET, "/jeheap/dump_only",
                                       dump_jeheap_profile_action);
 
+    GetJeHeapContinuousProfileActions* get_jeheap_continuous_profile_action =
+            _pool.add(new GetJeHeapContinuousProfileActions(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "/jeheap/profiles",
+                                      get_jeheap_continuous_profile_action);
+
     // register dictionary status action
     DictionaryStatusAction* dict_status_action = _pool.add(new DictionaryStatusAction(_env));
     _ev_http_server->register_handler(HttpMethod::GET, "/api/dictionary_status",
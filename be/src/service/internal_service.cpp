@@ -1611,7 +1611,9 @@ void PInternalService::transmit_block(google::protobuf::RpcController* controlle
         // under high concurrency, thread pool will have a lot of lock contention.
         // May offer failed to the thread pool, so that we should avoid using thread
         // pool here.
-        _transmit_block(controller, request, response, done, Status::OK(), 0);
+        Status st = attachment_extract_block_column_values(
+                request, static_cast<brpc::Controller*>(controller));
+        _transmit_block(controller, request, response, done, st, 0);
     } else {
         bool ret = _light_work_pool.try_offer([this, controller, request, response, done,
                                                receive_time]() {
@@ -1621,7 +1623,9 @@ void PInternalService::transmit_block(google::protobuf::RpcController* controlle
             // JNIContext will hold some TLS object. It could not work correctly under bthread
             // Context. So that put the logic into pthread.
             // But this is rarely happens, so this config is disabled by default.
-            _transmit_block(controller, request, response, done, Status::OK(),
+            Status st = attachment_extract_block_column_values(
+                    request, static_cast<brpc::Controller*>(controller));
+            _transmit_block(controller, request, response, done, st,
                             GetCurrentTimeNanos() - receive_time);
         });
         if (!ret) {
@@ -173,9 +173,28 @@ public:
     }
 
     void addMany(size_t n_args, const uint64_t* vals) {
-        for (size_t lcv = 0; lcv < n_args; lcv++) {
-            roarings[highBytes(vals[lcv])].add(lowBytes(vals[lcv]));
-            roarings[highBytes(vals[lcv])].setCopyOnWrite(copyOnWrite);
+        // add every run of values with the same high bytes at once, so the values of a sorted
+        // input look up their 32-bit bitmap only once
+        std::vector<uint32_t> low_bytes;
+        size_t lcv = 0;
+        while (lcv < n_args) {
+            uint32_t high_bytes = highBytes(vals[lcv]);
+            size_t run_end = lcv + 1;
+            while (run_end < n_args && highBytes(vals[run_end]) == high_bytes) {
+                ++run_end;
+            }
+            auto& roaring = roarings[high_bytes];
+            if (run_end - lcv == 1) {
+                roaring.add(lowBytes(vals[lcv]));
+            } else {
+                low_bytes.resize(run_end - lcv);
+                for (size_t i = lcv; i < run_end; ++i) {
+                    low_bytes[i - lcv] = lowBytes(vals[i]);
+                }
+                roaring.addMany(low_bytes.size(), low_bytes.data());
+            }
+            roaring.setCopyOnWrite(copyOnWrite);
+            lcv = run_end;
         }
     }
 
@@ -664,10 +683,23 @@ public:
      * pointer).
      */
     static Roaring64Map fastunion(size_t n, const Roaring64Map** inputs) {
-        Roaring64Map ans;
-        // not particularly fast
+        // union all 32-bit bitmaps of a key at once, roaring unions their containers lazily and
+        // computes the cardinality of every container only once
+        phmap::btree_map<uint32_t, std::vector<const roaring::Roaring*>> roarings_by_key;
         for (size_t lcv = 0; lcv < n; ++lcv) {
-            ans |= *(inputs[lcv]);
+            for (const auto& map_entry : inputs[lcv]->roarings) {
+                roarings_by_key[map_entry.first].push_back(&map_entry.second);
+            }
+        }
+        Roaring64Map ans;
+        for (auto& [key, roarings] : roarings_by_key) {
+            auto& roaring = ans.roarings[key];
+            if (roarings.size() == 1) {
+                roaring = *roarings[0];
+            } else {
+                roaring = roaring::Roaring::fastunion(roarings.size(), roarings.data());
+            }
+            roaring.setCopyOnWrite(ans.copyOnWrite);
         }
         return ans;
     }
@@ -1251,6 +1283,7 @@ public:
         std::vector<const detail::Roaring64Map*> bitmaps;
         std::vector<uint64_t> single_values;
         std::vector<const SetContainer<uint64_t>*> sets;
+        const BitmapValue* bitmap_value = nullptr;
         for (const auto* value : values) {
             switch (value->_type) {
             case EMPTY:
@@ -1260,6 +1293,7 @@ public:
                 break;
             case BITMAP:
                 bitmaps.push_back(value->_bitmap.get());
+                bitmap_value = value;
                 break;
             case SET:
                 sets.push_back(&value->_set);
@@ -1267,61 +1301,46 @@ public:
             }
         }
 
-        if (!bitmaps.empty()) {
-            _prepare_bitmap_for_write();
-            switch (_type) {
-            case EMPTY:
-                *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
-                break;
-            case SINGLE:
-                *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
-                _bitmap->add(_sv);
-                break;
-            case BITMAP:
-                for (const auto* bitmap : bitmaps) {
-                    *_bitmap |= *bitmap;
-                }
-                break;
-            case SET: {
-                *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
+        if (_type == EMPTY && bitmaps.size() == 1) {
+            // share the only bitmap, it is copied only if other values are added to it
+            *this = *bitmap_value;
+        } else if (!bitmaps.empty()) {
+            // union the bitmap of this value with the others at once. The result is a new bitmap,
+            // so a shared bitmap of this value does not need to be copied before.
+            if (_type == BITMAP) {
+                bitmaps.push_back(_bitmap.get());
+            }
+            auto result = std::make_shared<detail::Roaring64Map>(
+                    detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+            if (_type == SINGLE) {
+                result->add(_sv);
+            } else if (_type == SET) {
                 for (auto v : _set) {
-                    _bitmap->add(v);
+                    result->add(v);
                 }
                 _set.clear();
-                break;
-            }
             }
+            _bitmap = std::move(result);
+            _is_shared = false;
             _type = BITMAP;
         }
 
         if (!sets.empty()) {
-            for (auto& set : sets) {
-                for (auto v : *set) {
-                    _set.insert(v);
+            if (_type == BITMAP) {
+                // added to the bitmap together with the single values
+                for (const auto* set : sets) {
+                    single_values.insert(single_values.end(), set->begin(), set->end());
                 }
-            }
-            switch (_type) {
-            case EMPTY:
-                _type = SET;
-                break;
-            case SINGLE: {
-                _set.insert(_sv);
-                _type = SET;
-                break;
-            }
-            case BITMAP:
-                _prepare_bitmap_for_write();
-                for (auto v : _set) {
-                    _bitmap->add(v);
+            } else {
+                for (const auto* set : sets) {
+                    for (auto v : *set) {
+                        _set.insert(v);
+                    }
                 }
-                _type = BITMAP;
-                _set.clear();
-                break;
-            case SET: {
-                break;
-            }
-            }
-            if (_type == SET) {
+                if (_type == SINGLE) {
+                    _set.insert(_sv);
+                }
+                _type = SET;
                 _convert_to_bitmap_if_need();
             }
         }
@@ -1356,6 +1375,10 @@ public:
                 }
                 break;
             case BITMAP: {
+                // sorted values are added by the runs of their high bytes
+                std::sort(single_values.begin(), single_values.end());
+                single_values.erase(std::unique(single_values.begin(), single_values.end()),
+                                    single_values.end());
                 _prepare_bitmap_for_write();
                 _bitmap->addMany(single_values.size(), single_values.data());
                 break;
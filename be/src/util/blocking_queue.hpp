@@ -24,8 +24,10 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <algorithm>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include "common/logging.h"
 #include "util/stopwatch.hpp"
@@ -81,6 +83,72 @@ public:
         }
     }
 
+    // Gets up to `max_elements` elements from the queue at once, waiting for the first one like
+    // controlled_blocking_get(). Returns false if the queue is shut down and empty.
+    bool controlled_blocking_get_batch(std::vector<T>* out, size_t max_elements,
+                                       int64_t cv_wait_timeout_ms) {
+        MonotonicStopWatch timer;
+        timer.start();
+        std::unique_lock<std::mutex> unique_lock(_lock);
+        while (!(_shutdown || !_list.empty())) {
+            ++_get_waiting;
+            if (_get_cv.wait_for(unique_lock, std::chrono::milliseconds(cv_wait_timeout_ms)) ==
+                std::cv_status::timeout) {
+                _get_waiting--;
+            }
+        }
+        _total_get_wait_time += timer.elapsed_time();
+
+        if (_list.empty()) {
+            assert(_shutdown);
+            return false;
+        }
+        size_t num = std::min(max_elements, _list.size());
+        for (size_t i = 0; i < num; ++i) {
+            out->push_back(_list.front());
+            _list.pop_front();
+        }
+        if (_put_waiting > 0) {
+            // there may be room for more than one waiting batch put
+            _put_waiting = 0;
+            unique_lock.unlock();
+            _put_cv.notify_all();
+        }
+        return true;
+    }
+
+    // Puts all elements of `vals` into the queue, waiting until there is space for them. The
+    // elements put are removed from `vals`. If the queue is shut down, returns false and leaves
+    // the elements which are not put in `vals`.
+    bool controlled_blocking_put_batch(std::vector<T>* vals, int64_t cv_wait_timeout_ms) {
+        MonotonicStopWatch timer;
+        timer.start();
+        size_t num_put = 0;
+        std::unique_lock<std::mutex> unique_lock(_lock);
+        while (num_put < vals->size()) {
+            while (!(_shutdown || _list.size() < _max_elements)) {
+                ++_put_waiting;
+                if (_put_cv.wait_for(unique_lock, std::chrono::milliseconds(cv_wait_timeout_ms)) ==
+                    std::cv_status::timeout) {
+                    _put_waiting--;
+                }
+            }
+            if (_shutdown) {
+                break;
+            }
+            while (num_put < vals->size() && _list.size() < _max_elements) {
+                _list.push_back((*vals)[num_put++]);
+            }
+            if (_get_waiting > 0) {
+                --_get_waiting;
+                _get_cv.notify_one();
+            }
+        }
+        _total_put_wait_time += timer.elapsed_time();
+        vals->erase(vals->begin(), vals->begin() + num_put);
+        return vals->empty();
+    }
+
     // Puts an element into the queue, waiting indefinitely until there is space.
     // If the queue is shut down, returns false.
     bool blocking_put(const T& val) { return controlled_blocking_put(val, MAX_CV_WAIT_TIMEOUT_MS); }
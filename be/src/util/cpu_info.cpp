@@ -107,6 +107,7 @@ static struct {
 } flag_mappings[] = {
         {"ssse3", CpuInfo::SSSE3},   {"sse4_1", CpuInfo::SSE4_1}, {"sse4_2", CpuInfo::SSE4_2},
         {"popcnt", CpuInfo::POPCNT}, {"avx", CpuInfo::AVX},       {"avx2", CpuInfo::AVX2},
+        {"avx512f", CpuInfo::AVX512F},
 };
 
 // Helper function to parse for hardware flags.
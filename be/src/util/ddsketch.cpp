@@ -0,0 +1,357 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/ddsketch.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "common/logging.h"
+#include "util/coding.h"
+
+namespace doris {
+
+namespace {
+
+constexpr uint8_t DDSKETCH_VERSION = 1;
+// the magnitudes below it are counted as zero, the index of it still fits in int32
+constexpr double MIN_INDEXABLE_VALUE = std::numeric_limits<double>::min();
+
+uint8_t* encode_double(uint8_t* dst, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    encode_fixed64_le(dst, bits);
+    return dst + sizeof(bits);
+}
+
+double decode_double(const uint8_t* ptr) {
+    uint64_t bits = decode_fixed64_le(ptr);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+void DDSketch::Store::add(int32_t index, uint64_t count) {
+    if (_counts.empty()) {
+        _counts.assign(1, 0);
+        _offset = index;
+    } else if (index < _offset) {
+        int64_t lowest = int64_t(max_index()) - MAX_NUM_BUCKETS + 1;
+        index = static_cast<int32_t>(std::max<int64_t>(index, lowest));
+        if (index < _offset) {
+            // extend by the current size at least, so descending values are not quadratic
+            int64_t new_offset = std::max<int64_t>(
+                    lowest, std::min<int64_t>(index, int64_t(_offset) - int64_t(_counts.size())));
+            _counts.insert(_counts.begin(), _offset - new_offset, 0);
+            _offset = static_cast<int32_t>(new_offset);
+        }
+    } else if (index > max_index()) {
+        if (int64_t(index) - _offset + 1 > MAX_NUM_BUCKETS) {
+            _collapse(index - MAX_NUM_BUCKETS + 1);
+        }
+        _counts.resize(index - _offset + 1, 0);
+    }
+    _counts[index - _offset] += count;
+    _total += count;
+}
+
+void DDSketch::Store::_collapse(int32_t new_offset) {
+    if (new_offset <= _offset) {
+        return;
+    }
+    size_t num = std::min<size_t>(int64_t(new_offset) - _offset, _counts.size());
+    uint64_t folded = std::accumulate(_counts.begin(), _counts.begin() + num, uint64_t(0));
+    _counts.erase(_counts.begin(), _counts.begin() + num);
+    if (_counts.empty()) {
+        _counts.assign(1, 0);
+    }
+    _counts[0] += folded;
+    _offset = new_offset;
+}
+
+void DDSketch::Store::merge(const Store& other) {
+    if (other.empty()) {
+        return;
+    }
+    size_t begin = 0;
+    size_t end = 0;
+    other._trimmed_range(&begin, &end);
+    // add the highest index first, so the lower ones extend the front at most once
+    for (size_t i = end; i > begin; --i) {
+        if (other._counts[i - 1] != 0) {
+            add(other._offset + static_cast<int32_t>(i - 1), other._counts[i - 1]);
+        }
+    }
+}
+
+void DDSketch::Store::clear() {
+    _counts.clear();
+    _offset = 0;
+    _total = 0;
+}
+
+void DDSketch::Store::_trimmed_range(size_t* begin, size_t* end) const {
+    *begin = 0;
+    *end = _counts.size();
+    while (*begin < *end && _counts[*begin] == 0) {
+        ++*begin;
+    }
+    while (*end > *begin && _counts[*end - 1] == 0) {
+        --*end;
+    }
+}
+
+size_t DDSketch::Store::serialized_size() const {
+    size_t begin = 0;
+    size_t end = 0;
+    _trimmed_range(&begin, &end);
+    size_t size = varint_length(end - begin);
+    if (begin == end) {
+        return size;
+    }
+    size += sizeof(uint32_t);
+    for (size_t i = begin; i < end; ++i) {
+        size += varint_length(_counts[i]);
+    }
+    return size;
+}
+
+// num buckets(varint32) + offset(fixed32) + counts(varint64)
+uint8_t* DDSketch::Store::serialize(uint8_t* dst) const {
+    size_t begin = 0;
+    size_t end = 0;
+    _trimmed_range(&begin, &end);
+    dst = encode_varint32(dst, static_cast<uint32_t>(end - begin));
+    if (begin == end) {
+        return dst;
+    }
+    encode_fixed32_le(dst, static_cast<uint32_t>(_offset + static_cast<int32_t>(begin)));
+    dst += sizeof(uint32_t);
+    for (size_t i = begin; i < end; ++i) {
+        dst = encode_varint64(dst, _counts[i]);
+    }
+    return dst;
+}
+
+const uint8_t* DDSketch::Store::deserialize(const uint8_t* ptr, const uint8_t* end) {
+    clear();
+    uint32_t num = 0;
+    ptr = decode_varint32_ptr(ptr, end, &num);
+    if (ptr == nullptr || num > MAX_NUM_BUCKETS) {
+        return nullptr;
+    }
+    if (num == 0) {
+        return ptr;
+    }
+    if (end - ptr < static_cast<int64_t>(sizeof(uint32_t))) {
+        return nullptr;
+    }
+    _offset = static_cast<int32_t>(decode_fixed32_le(ptr));
+    ptr += sizeof(uint32_t);
+    _counts.resize(num);
+    for (uint32_t i = 0; i < num; ++i) {
+        ptr = decode_varint64_ptr(ptr, end, &_counts[i]);
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        _total += _counts[i];
+    }
+    return ptr;
+}
+
+DDSketch::DDSketch(double relative_accuracy) {
+    DCHECK(is_valid_relative_accuracy(relative_accuracy)) << relative_accuracy;
+    _set_relative_accuracy(relative_accuracy);
+    clear();
+}
+
+void DDSketch::_set_relative_accuracy(double relative_accuracy) {
+    _relative_accuracy = relative_accuracy;
+    _gamma = (1 + relative_accuracy) / (1 - relative_accuracy);
+    _multiplier = 1 / std::log(_gamma);
+}
+
+int32_t DDSketch::_index(double magnitude) const {
+    return static_cast<int32_t>(std::ceil(std::log(magnitude) * _multiplier));
+}
+
+// the value of the bucket whose relative error to all values of the bucket is within accuracy
+double DDSketch::_value(int32_t index) const {
+    return std::exp(index / _multiplier) * 2 / (1 + _gamma);
+}
+
+void DDSketch::_add(double value, uint64_t count) {
+    if (!std::isfinite(value)) {
+        return;
+    }
+    double magnitude = std::abs(value);
+    if (magnitude < MIN_INDEXABLE_VALUE) {
+        _zero_count += count;
+    } else if (value > 0) {
+        _positive.add(_index(magnitude), count);
+    } else {
+        _negative.add(_index(magnitude), count);
+    }
+    _count += count;
+    _min = std::min(_min, value);
+    _max = std::max(_max, value);
+}
+
+void DDSketch::add_batch(const double* values, size_t num) {
+    for (size_t i = 0; i < num; ++i) {
+        _add(values[i], 1);
+    }
+}
+
+void DDSketch::merge(const DDSketch& other) {
+    if (other._count == 0) {
+        return;
+    }
+    if (_count == 0) {
+        *this = other;
+        return;
+    }
+    if (other._relative_accuracy == _relative_accuracy) {
+        _positive.merge(other._positive);
+        _negative.merge(other._negative);
+        _zero_count += other._zero_count;
+        _count += other._count;
+    } else {
+        // the buckets don't match, add the values of the other buckets with their counts
+        for (int32_t i = other._positive.min_index();
+             !other._positive.empty() && i <= other._positive.max_index(); ++i) {
+            if (uint64_t count = other._positive.count(i)) {
+                _add(other._value(i), count);
+            }
+        }
+        for (int32_t i = other._negative.min_index();
+             !other._negative.empty() && i <= other._negative.max_index(); ++i) {
+            if (uint64_t count = other._negative.count(i)) {
+                _add(-other._value(i), count);
+            }
+        }
+        _zero_count += other._zero_count;
+        _count += other._zero_count;
+    }
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+}
+
+double DDSketch::quantile(double percentile) const {
+    if (_count == 0) {
+        return std::nan("");
+    }
+    // the rank of the value, counted from 0
+    double rank = percentile * static_cast<double>(_count - 1);
+    uint64_t seen = 0;
+    auto found = [&](uint64_t count) {
+        seen += count;
+        return static_cast<double>(seen) > rank;
+    };
+
+    double value = _max;
+    bool done = false;
+    // the negative values in ascending order are of descending indexes
+    for (int32_t i = _negative.max_index(); !done && !_negative.empty() &&
+                                            i >= _negative.min_index();
+         --i) {
+        if (found(_negative.count(i))) {
+            value = -_value(i);
+            done = true;
+        }
+    }
+    if (!done && found(_zero_count)) {
+        value = 0;
+        done = true;
+    }
+    for (int32_t i = _positive.min_index(); !done && !_positive.empty() &&
+                                            i <= _positive.max_index();
+         ++i) {
+        if (found(_positive.count(i))) {
+            value = _value(i);
+            done = true;
+        }
+    }
+    return std::clamp(value, _min, _max);
+}
+
+void DDSketch::clear() {
+    _positive.clear();
+    _negative.clear();
+    _zero_count = 0;
+    _count = 0;
+    _min = std::numeric_limits<double>::infinity();
+    _max = -std::numeric_limits<double>::infinity();
+}
+
+size_t DDSketch::serialized_size() const {
+    // version + relative accuracy + min + max
+    size_t size = 1 + sizeof(double) * 3;
+    size += varint_length(_zero_count);
+    size += _negative.serialized_size();
+    size += _positive.serialized_size();
+    return size;
+}
+
+size_t DDSketch::serialize(uint8_t* dst) const {
+    uint8_t* ptr = dst;
+    *ptr++ = DDSKETCH_VERSION;
+    ptr = encode_double(ptr, _relative_accuracy);
+    ptr = encode_double(ptr, _min);
+    ptr = encode_double(ptr, _max);
+    ptr = encode_varint64(ptr, _zero_count);
+    ptr = _negative.serialize(ptr);
+    ptr = _positive.serialize(ptr);
+    return ptr - dst;
+}
+
+bool DDSketch::deserialize(const Slice& slice) {
+    clear();
+    const auto* ptr = reinterpret_cast<const uint8_t*>(slice.data);
+    const uint8_t* end = ptr + slice.size;
+    if (slice.size < 1 + sizeof(double) * 3 || *ptr++ != DDSKETCH_VERSION) {
+        return false;
+    }
+    double relative_accuracy = decode_double(ptr);
+    if (!is_valid_relative_accuracy(relative_accuracy)) {
+        return false;
+    }
+    _set_relative_accuracy(relative_accuracy);
+    _min = decode_double(ptr + sizeof(double));
+    _max = decode_double(ptr + sizeof(double) * 2);
+    ptr += sizeof(double) * 3;
+    ptr = decode_varint64_ptr(ptr, end, &_zero_count);
+    if (ptr == nullptr || (ptr = _negative.deserialize(ptr, end)) == nullptr ||
+        (ptr = _positive.deserialize(ptr, end)) == nullptr || ptr != end) {
+        clear();
+        return false;
+    }
+    _count = _zero_count + _negative.total() + _positive.total();
+    if (_count > 0 && !(_min <= _max)) {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+} // namespace doris
@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "util/slice.h"
+
+namespace doris {
+
+// DDSketch (https://arxiv.org/abs/1908.10693) is a quantile sketch with relative error: a value
+// returned for a quantile is within `relative_accuracy * |x|` of the real value x, so the tail
+// quantiles of latencies are as accurate as the median. A value falls into the bucket
+// ceil(log_gamma(|x|)) with gamma = (1 + accuracy) / (1 - accuracy), positive and negative
+// values have their own buckets. Merging adds the counts of the same buckets, which is exact for
+// sketches of the same accuracy and does not depend on the order of the merges.
+//
+// The buckets of each sign are bounded by MAX_NUM_BUCKETS, the buckets of the smallest
+// magnitudes are collapsed when it's exceeded, which keeps the accuracy of high quantiles.
+class DDSketch {
+public:
+    static constexpr double DEFAULT_RELATIVE_ACCURACY = 0.01;
+    static constexpr double MIN_RELATIVE_ACCURACY = 0.001;
+    static constexpr double MAX_RELATIVE_ACCURACY = 0.5;
+    // covers the magnitudes of 1e14 times range with the minimum accuracy
+    static constexpr int32_t MAX_NUM_BUCKETS = 16384;
+
+    explicit DDSketch(double relative_accuracy = DEFAULT_RELATIVE_ACCURACY);
+
+    static bool is_valid_relative_accuracy(double relative_accuracy) {
+        return relative_accuracy >= MIN_RELATIVE_ACCURACY &&
+               relative_accuracy <= MAX_RELATIVE_ACCURACY;
+    }
+
+    // NaN and infinite values are ignored
+    void add(double value) { _add(value, 1); }
+    void add_batch(const double* values, size_t num);
+    void merge(const DDSketch& other);
+
+    // `percentile` is in [0, 1], return NaN when the sketch is empty
+    double quantile(double percentile) const;
+
+    uint64_t count() const { return _count; }
+    double relative_accuracy() const { return _relative_accuracy; }
+    void clear();
+
+    size_t serialized_size() const;
+    size_t serialize(uint8_t* dst) const;
+    bool deserialize(const Slice& slice);
+
+private:
+    // The counts of consecutive bucket indexes.
+    class Store {
+    public:
+        void add(int32_t index, uint64_t count);
+        void merge(const Store& other);
+        void clear();
+
+        uint64_t total() const { return _total; }
+        bool empty() const { return _total == 0; }
+        int32_t min_index() const { return _offset; }
+        int32_t max_index() const { return _offset + static_cast<int32_t>(_counts.size()) - 1; }
+        uint64_t count(int32_t index) const { return _counts[index - _offset]; }
+
+        size_t serialized_size() const;
+        uint8_t* serialize(uint8_t* dst) const;
+        const uint8_t* deserialize(const uint8_t* ptr, const uint8_t* end);
+
+    private:
+        // fold the counts of the indexes below `new_offset` into `new_offset`
+        void _collapse(int32_t new_offset);
+        // the range of the non-zero counts
+        void _trimmed_range(size_t* begin, size_t* end) const;
+
+        std::vector<uint64_t> _counts;
+        int32_t _offset = 0;
+        uint64_t _total = 0;
+    };
+
+    void _add(double value, uint64_t count);
+    int32_t _index(double magnitude) const;
+    double _value(int32_t index) const;
+    void _set_relative_accuracy(double relative_accuracy);
+
+    double _relative_accuracy;
+    double _gamma;
+    double _multiplier; // 1 / ln(gamma)
+    Store _positive;
+    Store _negative;
+    uint64_t _zero_count = 0;
+    uint64_t _count = 0;
+    double _min;
+    double _max;
+};
+
+} // namespace doris
@@ -42,6 +42,8 @@ public:
 
     uint32_t minimum() const { return _roaring_bitmap.minimum(); }
 
+    const roaring::Roaring& roaring() const { return _roaring_bitmap; }
+
     static Result<DeletionVector> deserialize(const char* buf, size_t length) {
         uint32_t actual_length;
         std::memcpy(reinterpret_cast<char*>(&actual_length), buf, 4);
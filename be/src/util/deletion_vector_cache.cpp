@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/deletion_vector_cache.h"
+
+#include <fmt/format.h>
+
+namespace doris {
+
+std::string DeletionVectorCache::iceberg_key(const std::string& delete_file_path,
+                                             const std::string& data_file_path) {
+    return fmt::format("iceberg:{}:{}", delete_file_path, data_file_path);
+}
+
+std::string DeletionVectorCache::paimon_key(const std::string& deletion_file_path,
+                                            int64_t offset, int64_t length) {
+    return fmt::format("paimon:{}:{}:{}", deletion_file_path, offset, length);
+}
+
+Status DeletionVectorCache::get(DeletionVectorCache* cache, const std::string& key,
+                                const std::function<Status(Bitmap*)>& create_func,
+                                Handle* handle) {
+    if (cache != nullptr) {
+        auto* lru_handle = cache->lookup(key);
+        if (lru_handle != nullptr) {
+            handle->_cache_handle = ObjLRUCache::CacheHandle(cache, lru_handle);
+            handle->_bitmap =
+                    static_cast<const Bitmap*>(handle->_cache_handle.data<Bitmap>());
+            return Status::OK();
+        }
+    }
+    auto bitmap = std::make_unique<Bitmap>();
+    RETURN_IF_ERROR(create_func(bitmap.get()));
+    bitmap->runOptimize();
+    bitmap->shrinkToFit();
+    if (cache == nullptr) {
+        handle->_bitmap = bitmap.get();
+        handle->_owned_bitmap = std::move(bitmap);
+        return Status::OK();
+    }
+    size_t charge = sizeof(Bitmap) + bitmap->getSizeInBytes(1);
+    auto* value = new ObjLRUCache::ObjValue<Bitmap>(bitmap.release());
+    auto* lru_handle = cache->insert(key, value, charge, charge, CachePriority::NORMAL);
+    handle->_cache_handle = ObjLRUCache::CacheHandle(cache, lru_handle);
+    handle->_bitmap = static_cast<const Bitmap*>(handle->_cache_handle.data<Bitmap>());
+    return Status::OK();
+}
+
+void DeletionVectorCache::to_positions(const std::vector<const Bitmap*>& bitmaps,
+                                       std::vector<int64_t>* positions) {
+    positions->clear();
+    if (bitmaps.empty()) {
+        return;
+    }
+    Bitmap merged;
+    const Bitmap* bitmap = bitmaps[0];
+    if (bitmaps.size() > 1) {
+        // the positions of each delete file are unioned by the containers of the bitmaps
+        // instead of merging the sorted positions
+        for (const auto* other : bitmaps) {
+            merged |= *other;
+        }
+        bitmap = &merged;
+    }
+    positions->reserve(bitmap->cardinality());
+    bitmap->iterate(
+            [](uint64_t value, void* ptr) -> bool {
+                static_cast<std::vector<int64_t>*>(ptr)->push_back(static_cast<int64_t>(value));
+                return true;
+            },
+            positions);
+}
+
+} // namespace doris
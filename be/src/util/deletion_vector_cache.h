@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "common/status.h"
+#include "util/bitmap_value.h"
+#include "util/obj_lru_cache.h"
+
+namespace doris {
+
+// The positions deleted from the data files of external tables, decoded from the position
+// delete files of iceberg and the deletion vectors of paimon. The parallel splits of a data
+// file and the following queries share the decoded bitmaps instead of reading the deletes again.
+// It's charged by the bytes of the bitmaps.
+class DeletionVectorCache : public LRUCachePolicy {
+public:
+    using Bitmap = detail::Roaring64Map;
+
+    // The bitmap held by a cache handle, or by itself if the cache is disabled.
+    class Handle {
+    public:
+        const Bitmap& bitmap() const { return *_bitmap; }
+
+    private:
+        friend class DeletionVectorCache;
+
+        ObjLRUCache::CacheHandle _cache_handle;
+        std::unique_ptr<Bitmap> _owned_bitmap;
+        const Bitmap* _bitmap = nullptr;
+    };
+
+    DeletionVectorCache(size_t capacity)
+            : LRUCachePolicy(CachePolicy::CacheType::DELETION_VECTOR_CACHE, capacity,
+                             LRUCacheType::SIZE,
+                             config::common_obj_lru_cache_stale_sweep_time_sec) {}
+
+    // The positions of data_file_path deleted by the iceberg position delete file.
+    static std::string iceberg_key(const std::string& delete_file_path,
+                                   const std::string& data_file_path);
+
+    // The paimon deletion vector at [offset, offset + length) of the deletion file.
+    static std::string paimon_key(const std::string& deletion_file_path, int64_t offset,
+                                  int64_t length);
+
+    // Set *handle to the bitmap of key, which is decoded by create_func on a miss. cache may be
+    // nullptr if it's disabled.
+    static Status get(DeletionVectorCache* cache, const std::string& key,
+                      const std::function<Status(Bitmap*)>& create_func, Handle* handle);
+
+    // Set *positions to the union of the bitmaps in ascending order, which is the way the
+    // readers of the data files apply the deletes.
+    static void to_positions(const std::vector<const Bitmap*>& bitmaps,
+                             std::vector<int64_t>* positions);
+};
+
+} // namespace doris
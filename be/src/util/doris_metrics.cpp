@@ -178,6 +178,19 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(compaction_waitting_permits, MetricUnit::NOUN
 
 DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(tablet_version_num_distribution, MetricUnit::NOUNIT);
 
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(transmit_block_latency_us, MetricUnit::MICROSECONDS);
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_5ARG(local_file_read_latency_us, MetricUnit::MICROSECONDS, "",
+                                       file_read_latency_us, Labels({{"type", "local"}}));
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_5ARG(s3_file_read_latency_us, MetricUnit::MICROSECONDS, "",
+                                       file_read_latency_us, Labels({{"type", "s3"}}));
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_5ARG(hdfs_file_read_latency_us, MetricUnit::MICROSECONDS, "",
+                                       file_read_latency_us, Labels({{"type", "hdfs"}}));
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(memtable_flush_latency_us, MetricUnit::MICROSECONDS);
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(compaction_task_latency_us, MetricUnit::MICROSECONDS);
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(pipeline_task_queue_wait_latency_us,
+                                       MetricUnit::MICROSECONDS);
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(meta_service_rpc_latency_us, MetricUnit::MICROSECONDS);
+
 DEFINE_GAUGE_CORE_METRIC_PROTOTYPE_2ARG(query_scan_bytes_per_second, MetricUnit::BYTES);
 
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(readable_blocks_total, MetricUnit::BLOCKS);
@@ -342,6 +355,15 @@ DorisMetrics::DorisMetrics() : _metric_registry(_s_registry_name) {
 
     HISTOGRAM_METRIC_REGISTER(_server_metric_entity, tablet_version_num_distribution);
 
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, transmit_block_latency_us);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, local_file_read_latency_us);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, s3_file_read_latency_us);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, hdfs_file_read_latency_us);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, memtable_flush_latency_us);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, compaction_task_latency_us);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, pipeline_task_queue_wait_latency_us);
+    HISTOGRAM_METRIC_REGISTER(_server_metric_entity, meta_service_rpc_latency_us);
+
     INT_GAUGE_METRIC_REGISTER(_server_metric_entity, query_scan_bytes_per_second);
 
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, load_rows);
@@ -159,6 +159,16 @@ public:
 
     HistogramMetric* tablet_version_num_distribution = nullptr;
 
+    // latency histograms, in microseconds
+    HistogramMetric* transmit_block_latency_us = nullptr;
+    HistogramMetric* local_file_read_latency_us = nullptr;
+    HistogramMetric* s3_file_read_latency_us = nullptr;
+    HistogramMetric* hdfs_file_read_latency_us = nullptr;
+    HistogramMetric* memtable_flush_latency_us = nullptr;
+    HistogramMetric* compaction_task_latency_us = nullptr;
+    HistogramMetric* pipeline_task_queue_wait_latency_us = nullptr;
+    HistogramMetric* meta_service_rpc_latency_us = nullptr;
+
     // The following metrics will be calculated
     // by metric calculator
     IntGauge* query_scan_bytes_per_second = nullptr;
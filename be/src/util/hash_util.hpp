@@ -24,6 +24,8 @@
 #include <xxh3.h>
 #include <zlib.h>
 
+#include <array>
+#include <cstring>
 #include <functional>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
@@ -35,6 +37,30 @@
 
 namespace doris {
 
+namespace detail {
+// The tables to compute the crc32 of zlib 4 bytes at a time on a little endian machine,
+// ZLIB_CRC_TABLES[0] is the table of zlib itself.
+constexpr std::array<std::array<uint32_t, 256>, 4> make_zlib_crc_tables() {
+    std::array<std::array<uint32_t, 256>, 4> tables {};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+        }
+        tables[0][i] = crc;
+    }
+    for (size_t t = 1; t < tables.size(); ++t) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xff];
+        }
+    }
+    return tables;
+}
+
+inline constexpr std::array<std::array<uint32_t, 256>, 4> ZLIB_CRC_TABLES =
+        make_zlib_crc_tables();
+} // namespace detail
+
 // Utility class to compute hash values.
 class HashUtil {
 public:
@@ -42,10 +68,32 @@ public:
         return crc32(hash, (const unsigned char*)data, bytes);
     }
 
+    // Same as zlib_crc_hash, for a value of a fixed size. It is inlined into the loops over the
+    // rows of a column, so the table lookups of the independent rows are pipelined instead of
+    // going through a library call per row.
+    template <size_t bytes>
+    static uint32_t zlib_crc_hash_fixed(const void* data, uint32_t hash) {
+        const auto& tables = detail::ZLIB_CRC_TABLES;
+        const auto* p = reinterpret_cast<const uint8_t*>(data);
+        uint32_t crc = ~hash;
+        size_t i = 0;
+        for (; i + 4 <= bytes; i += 4) {
+            uint32_t word;
+            memcpy(&word, p + i, sizeof(word));
+            crc ^= word;
+            crc = tables[3][crc & 0xff] ^ tables[2][(crc >> 8) & 0xff] ^
+                  tables[1][(crc >> 16) & 0xff] ^ tables[0][crc >> 24];
+        }
+        for (; i < bytes; ++i) {
+            crc = tables[0][(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
     static uint32_t zlib_crc_hash_null(uint32_t hash) {
         // null is treat as 0 when hash
         static const int INT_VALUE = 0;
-        return crc32(hash, (const unsigned char*)(&INT_VALUE), 4);
+        return zlib_crc_hash_fixed<sizeof(INT_VALUE)>(&INT_VALUE, hash);
     }
 
 #if defined(__SSE4_2__) || defined(__aarch64__)
@@ -70,6 +70,10 @@ namespace {
 const HistogramBucketMapper bucket_mapper;
 }
 
+uint64_t HistogramStat::bucket_limit(size_t b) {
+    return bucket_mapper.bucket_limit(b);
+}
+
 HistogramStat::HistogramStat() : _num_buckets(bucket_mapper.bucket_count()) {
     DCHECK(_num_buckets == sizeof(_buckets) / sizeof(*_buckets));
     clear();
@@ -84,6 +84,8 @@ struct HistogramStat {
     uint64_t sum() const { return _sum.load(std::memory_order_relaxed); }
     uint64_t sum_squares() const { return _sum_squares.load(std::memory_order_relaxed); }
     uint64_t bucket_at(size_t b) const { return _buckets[b].load(std::memory_order_relaxed); }
+    // the inclusive upper bound of the values in bucket `b`
+    static uint64_t bucket_limit(size_t b);
 
     double median() const;
     double percentile(double p) const;
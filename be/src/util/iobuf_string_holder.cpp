@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/iobuf_string_holder.h"
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace doris {
+
+namespace {
+constexpr size_t NUM_SHARDS = 32;
+
+struct Shard {
+    std::mutex lock;
+    std::unordered_map<const void*, std::unique_ptr<std::string>> strings;
+};
+
+std::array<Shard, NUM_SHARDS>& shards() {
+    // Never destroyed, brpc may release IOBufs during static destruction.
+    static auto* s_shards = new std::array<Shard, NUM_SHARDS>();
+    return *s_shards;
+}
+
+Shard& shard_of(const void* data) {
+    // The low bits of a heap pointer are always zero, so mix the bits before picking the shard.
+    auto h = reinterpret_cast<uintptr_t>(data) * 0x9E3779B97F4A7C15ULL;
+    return shards()[(h >> 32) % NUM_SHARDS];
+}
+} // namespace
+
+void IOBufStringHolder::append(std::unique_ptr<std::string> data, butil::IOBuf* buf) {
+    if (data == nullptr || data->empty()) {
+        return;
+    }
+    void* ptr = data->data();
+    size_t size = data->size();
+    {
+        auto& shard = shard_of(ptr);
+        std::lock_guard l(shard.lock);
+        shard.strings.emplace(ptr, std::move(data));
+    }
+    buf->append_user_data(ptr, size, _release);
+}
+
+void IOBufStringHolder::_release(void* data) {
+    std::unique_ptr<std::string> released;
+    {
+        auto& shard = shard_of(data);
+        std::lock_guard l(shard.lock);
+        auto it = shard.strings.find(data);
+        if (it == shard.strings.end()) {
+            return;
+        }
+        released = std::move(it->second);
+        shard.strings.erase(it);
+    }
+    // `released` is freed outside of the lock.
+}
+
+size_t IOBufStringHolder::held_count() {
+    size_t count = 0;
+    for (auto& shard : shards()) {
+        std::lock_guard l(shard.lock);
+        count += shard.strings.size();
+    }
+    return count;
+}
+
+} // namespace doris
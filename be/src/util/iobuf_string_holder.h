@@ -0,0 +1,44 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <butil/iobuf.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace doris {
+
+// Appends a std::string to a butil::IOBuf without copying its content.
+//
+// IOBuf only accepts user data with a plain function as deleter, which gets the data pointer.
+// So the appended strings are owned by a sharded registry keyed by their data pointer, and are
+// destroyed when brpc releases the data.
+class IOBufStringHolder {
+public:
+    static void append(std::unique_ptr<std::string> data, butil::IOBuf* buf);
+
+    // The number of strings still referenced by some IOBuf.
+    static size_t held_count();
+
+private:
+    static void _release(void* data);
+};
+
+} // namespace doris
@@ -112,4 +112,9 @@ void encode_key(std::string* buf, const RowType& row, size_t num_keys) {
 bool key_is_not_in_segment(Slice key, const KeyBoundsPB& segment_key_bounds,
                            bool is_segments_key_bounds_truncated);
 
+// true if no key in [min_key, max_key] can be in the segment, in the same way as above
+bool key_range_is_not_in_segment(Slice min_key, Slice max_key,
+                                 const KeyBoundsPB& segment_key_bounds,
+                                 bool is_segments_key_bounds_truncated);
+
 } // namespace doris
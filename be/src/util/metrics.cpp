@@ -22,6 +22,7 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <algorithm>
 #include <initializer_list>
 
 #include "common/config.h"
@@ -122,94 +123,178 @@ std::string Metric::to_prometheus(const std::string& display_name, const Labels&
 
 std::map<std::string, double> HistogramMetric::_s_output_percentiles = {
         {"0.50", 50.0}, {"0.75", 75.0}, {"0.90", 90.0}, {"0.95", 95.0}, {"0.99", 99.0}};
+size_t HistogramMetric::_shard_index() {
+    static std::atomic<size_t> next_index = 0;
+    // the threads take the shards in turn, so a few threads never share a shard
+    static thread_local size_t index =
+            next_index.fetch_add(1, std::memory_order_relaxed) % NUM_SHARDS;
+    return index;
+}
+
+void HistogramMetric::_merge_shards(HistogramStat* stats) const {
+    for (const auto& shard : _shards) {
+        stats->merge(shard.stats);
+    }
+}
+
 void HistogramMetric::clear() {
     std::lock_guard<std::mutex> l(_lock);
-    _stats.clear();
+    for (auto& shard : _shards) {
+        shard.stats.clear();
+    }
 }
 
 bool HistogramMetric::is_empty() const {
-    return _stats.is_empty();
+    return num() == 0;
 }
 
 void HistogramMetric::add(const uint64_t& value) {
-    _stats.add(value);
+    _shards[_shard_index()].stats.add(value);
 }
 
 void HistogramMetric::merge(const HistogramMetric& other) {
+    HistogramStat stats;
+    other._merge_shards(&stats);
     std::lock_guard<std::mutex> l(_lock);
-    _stats.merge(other._stats);
+    _shards[0].stats.merge(stats);
 }
 
 void HistogramMetric::set_histogram(const HistogramStat& stats) {
     std::lock_guard<std::mutex> l(_lock);
-    _stats.clear();
-    _stats.merge(stats);
+    for (auto& shard : _shards) {
+        shard.stats.clear();
+    }
+    _shards[0].stats.merge(stats);
+}
+
+uint64_t HistogramMetric::min() const {
+    uint64_t min = _shards[0].stats.min();
+    for (const auto& shard : _shards) {
+        min = std::min(min, shard.stats.min());
+    }
+    return min;
+}
+
+uint64_t HistogramMetric::max() const {
+    uint64_t max = 0;
+    for (const auto& shard : _shards) {
+        max = std::max(max, shard.stats.max());
+    }
+    return max;
+}
+
+uint64_t HistogramMetric::num() const {
+    uint64_t num = 0;
+    for (const auto& shard : _shards) {
+        num += shard.stats.num();
+    }
+    return num;
+}
+
+uint64_t HistogramMetric::sum() const {
+    uint64_t sum = 0;
+    for (const auto& shard : _shards) {
+        sum += shard.stats.sum();
+    }
+    return sum;
 }
 
 double HistogramMetric::median() const {
-    return _stats.median();
+    return percentile(50.0);
 }
 
 double HistogramMetric::percentile(double p) const {
-    return _stats.percentile(p);
+    HistogramStat stats;
+    _merge_shards(&stats);
+    return stats.percentile(p);
 }
 
 double HistogramMetric::average() const {
-    return _stats.average();
+    HistogramStat stats;
+    _merge_shards(&stats);
+    return stats.average();
 }
 
 double HistogramMetric::standard_deviation() const {
-    return _stats.standard_deviation();
+    HistogramStat stats;
+    _merge_shards(&stats);
+    return stats.standard_deviation();
 }
 
 std::string HistogramMetric::to_string() const {
-    return _stats.to_string();
+    HistogramStat stats;
+    _merge_shards(&stats);
+    return stats.to_string();
 }
 
 std::string HistogramMetric::to_prometheus(const std::string& display_name,
                                            const Labels& entity_labels,
                                            const Labels& metric_labels) const {
+    HistogramStat stats;
+    _merge_shards(&stats);
     // TODO: Use std::string concate for better performance.
     std::stringstream ss;
+    // the cumulative buckets of the prometheus histogram
+    uint64_t cumulative_count = 0;
+    for (size_t b = 0; b < stats._num_buckets; ++b) {
+        cumulative_count += stats.bucket_at(b);
+        uint64_t limit = HistogramStat::bucket_limit(b);
+        if (limit > PROMETHEUS_MAX_BUCKET_LIMIT) {
+            break;
+        }
+        if (b % PROMETHEUS_BUCKET_STEP != 0) {
+            continue;
+        }
+        auto bucket_label = Labels({{"le", std::to_string(limit)}});
+        ss << display_name << "_bucket"
+           << labels_to_string({&entity_labels, &metric_labels, &bucket_label}) << " "
+           << cumulative_count << "\n";
+    }
+    auto inf_bucket_label = Labels({{"le", "+Inf"}});
+    ss << display_name << "_bucket"
+       << labels_to_string({&entity_labels, &metric_labels, &inf_bucket_label}) << " "
+       << stats.num() << "\n";
     for (const auto& percentile : _s_output_percentiles) {
         auto quantile_lable = Labels({{"quantile", percentile.first}});
         ss << display_name << labels_to_string({&entity_labels, &metric_labels, &quantile_lable})
-           << " " << _stats.percentile(percentile.second) << "\n";
+           << " " << stats.percentile(percentile.second) << "\n";
     }
     ss << display_name << "_sum" << labels_to_string({&entity_labels, &metric_labels}) << " "
-       << _stats.sum() << "\n";
+       << stats.sum() << "\n";
     ss << display_name << "_count" << labels_to_string({&entity_labels, &metric_labels}) << " "
-       << _stats.num() << "\n";
+       << stats.num() << "\n";
     ss << display_name << "_max" << labels_to_string({&entity_labels, &metric_labels}) << " "
-       << _stats.max() << "\n";
+       << stats.max() << "\n";
     ss << display_name << "_min" << labels_to_string({&entity_labels, &metric_labels}) << " "
-       << _stats.min() << "\n";
+       << stats.min() << "\n";
     ss << display_name << "_average" << labels_to_string({&entity_labels, &metric_labels}) << " "
-       << _stats.average() << "\n";
+       << stats.average() << "\n";
     ss << display_name << "_median" << labels_to_string({&entity_labels, &metric_labels}) << " "
-       << _stats.median() << "\n";
+       << stats.median() << "\n";
     ss << display_name << "_standard_deviation"
-       << labels_to_string({&entity_labels, &metric_labels}) << " " << _stats.standard_deviation()
+       << labels_to_string({&entity_labels, &metric_labels}) << " " << stats.standard_deviation()
        << "\n";
 
     return ss.str();
 }
 
 rj::Value HistogramMetric::to_json_value(rj::Document::AllocatorType& allocator) const {
+    HistogramStat stats;
+    _merge_shards(&stats);
     rj::Value json_value(rj::kObjectType);
-    json_value.AddMember("total_count", rj::Value(_stats.num()), allocator);
-    json_value.AddMember("min", rj::Value(_stats.min()), allocator);
-    json_value.AddMember("average", rj::Value(_stats.average()), allocator);
-    json_value.AddMember("median", rj::Value(_stats.median()), allocator);
+    json_value.AddMember("total_count", rj::Value(stats.num()), allocator);
+    json_value.AddMember("min", rj::Value(stats.min()), allocator);
+    json_value.AddMember("average", rj::Value(stats.average()), allocator);
+    json_value.AddMember("median", rj::Value(stats.median()), allocator);
     for (const auto& percentile : _s_output_percentiles) {
         json_value.AddMember(
                 rj::Value(std::string("percentile_").append(percentile.first.substr(2)).c_str(),
                           allocator),
-                rj::Value(_stats.percentile(percentile.second)), allocator);
+                rj::Value(stats.percentile(percentile.second)), allocator);
     }
-    json_value.AddMember("standard_deviation", rj::Value(_stats.standard_deviation()), allocator);
-    json_value.AddMember("max", rj::Value(_stats.max()), allocator);
-    json_value.AddMember("total_sum", rj::Value(_stats.sum()), allocator);
+    json_value.AddMember("standard_deviation", rj::Value(stats.standard_deviation()), allocator);
+    json_value.AddMember("max", rj::Value(stats.max()), allocator);
+    json_value.AddMember("total_sum", rj::Value(stats.sum()), allocator);
 
     return json_value;
 }
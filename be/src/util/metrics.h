@@ -20,6 +20,7 @@
 #include <rapidjson/document.h>
 #include <rapidjson/rapidjson.h>
 
+#include <array>
 #include <atomic>
 #include <functional>
 #include <map>
@@ -30,7 +31,10 @@
 #include <utility>
 #include <vector>
 
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/macros.h"
 #include "util/histogram.h"
+#include "util/stopwatch.hpp"
 
 namespace doris {
 
@@ -97,6 +101,8 @@ protected:
     std::atomic<T> _value;
 };
 
+// The values are added to per thread shards, so the histograms of hot paths, e.g. the latency of
+// every read or rpc, are cheap to update from many threads.
 class HistogramMetric : public Metric {
 public:
     HistogramMetric() = default;
@@ -111,10 +117,10 @@ public:
     void merge(const HistogramMetric& other);
     void set_histogram(const HistogramStat& stats);
 
-    uint64_t min() const { return _stats.min(); }
-    uint64_t max() const { return _stats.max(); }
-    uint64_t num() const { return _stats.num(); }
-    uint64_t sum() const { return _stats.sum(); }
+    uint64_t min() const;
+    uint64_t max() const;
+    uint64_t num() const;
+    uint64_t sum() const;
     double median() const;
     double percentile(double p) const;
     double average() const;
@@ -125,11 +131,42 @@ public:
     rj::Value to_json_value(rj::Document::AllocatorType& allocator) const override;
 
 protected:
+    static constexpr size_t NUM_SHARDS = 16;
+    // The bounds of the buckets grow by 1.5x, only every third bound up to 10^12 (1000s in
+    // nanoseconds) is exported as a prometheus bucket, so the exported buckets are always the same.
+    static constexpr size_t PROMETHEUS_BUCKET_STEP = 3;
+    static constexpr uint64_t PROMETHEUS_MAX_BUCKET_LIMIT = 1'000'000'000'000;
+
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        HistogramStat stats;
+    };
+
+    static size_t _shard_index();
+    // merge all shards into `stats`
+    void _merge_shards(HistogramStat* stats) const;
+
     static std::map<std::string, double> _s_output_percentiles;
     mutable std::mutex _lock;
-    HistogramStat _stats;
+    std::array<Shard, NUM_SHARDS> _shards;
+};
+
+// Adds the microseconds elapsed in the scope to a histogram metric.
+class ScopedHistogramLatencyUs {
+public:
+    explicit ScopedHistogramLatencyUs(HistogramMetric* histogram) : _histogram(histogram) {
+        _watch.start();
+    }
+
+    ~ScopedHistogramLatencyUs() { _histogram->add(_watch.elapsed_time() / 1000); }
+
+private:
+    HistogramMetric* _histogram;
+    MonotonicStopWatch _watch;
 };
 
+#define SCOPED_HISTOGRAM_LATENCY_US(histogram) \
+    doris::ScopedHistogramLatencyUs VARNAME_LINENUM(histogram_latency)(histogram)
+
 template <typename T>
 class AtomicCounter : public AtomicMetric<T> {
 public:
@@ -205,6 +242,9 @@ public:
 #define DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(name, unit) \
     DEFINE_METRIC_PROTOTYPE(name, MetricType::HISTOGRAM, unit, "", "", Labels(), false)
 
+#define DEFINE_HISTOGRAM_METRIC_PROTOTYPE_5ARG(name, unit, desc, group, labels) \
+    DEFINE_METRIC_PROTOTYPE(name, MetricType::HISTOGRAM, unit, desc, #group, labels, false)
+
 #define INT_COUNTER_METRIC_REGISTER(entity, metric) \
     metric = (IntCounter*)(entity->register_metric<IntCounter>(&METRIC_##metric))
 
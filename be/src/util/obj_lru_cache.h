@@ -89,13 +89,17 @@ public:
 
     bool lookup(const ObjKey& key, CacheHandle* handle);
 
+    // value_tracking_bytes is the memory held by the value, sizeof(T) if it's 0.
     template <typename T>
-    void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle) {
+    void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle,
+                size_t value_tracking_bytes = 0) {
         if (_enabled) {
             const std::string& encoded_key = key.key;
             auto* obj_value = new ObjValue<T>(value);
-            auto* handle = LRUCachePolicy::insert(encoded_key, obj_value, 1, sizeof(T),
-                                                  CachePriority::NORMAL);
+            auto* handle = LRUCachePolicy::insert(
+                    encoded_key, obj_value, 1,
+                    value_tracking_bytes > 0 ? value_tracking_bytes : sizeof(T),
+                    CachePriority::NORMAL);
             *cache_handle = CacheHandle {this, handle};
         } else {
             cache_handle = nullptr;
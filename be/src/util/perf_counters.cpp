@@ -30,6 +30,7 @@
 #include <fstream> // IWYU pragma: keep
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <unordered_map>
 #include <utility>
 
@@ -599,4 +600,131 @@ void PerfCounters::get_proc_status(ProcStatus* out) {
     out->vm_hwm = parse_bytes("status/VmHWM");
 }
 
+static bool init_thread_event_attr(perf_event_attr* attr, ThreadPerfCounters::Event event) {
+    memset(attr, 0, sizeof(perf_event_attr));
+    auto cache_read_miss = [](uint64_t cache) {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    };
+
+    switch (event) {
+    case ThreadPerfCounters::CPU_CYCLES:
+        attr->type = PERF_TYPE_HARDWARE;
+        attr->config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+
+    case ThreadPerfCounters::INSTRUCTIONS:
+        attr->type = PERF_TYPE_HARDWARE;
+        attr->config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+
+    case ThreadPerfCounters::LLC_MISSES:
+        attr->type = PERF_TYPE_HW_CACHE;
+        attr->config = cache_read_miss(PERF_COUNT_HW_CACHE_LL);
+        break;
+
+    case ThreadPerfCounters::BRANCH_MISSES:
+        attr->type = PERF_TYPE_HARDWARE;
+        attr->config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+
+    case ThreadPerfCounters::DTLB_MISSES:
+        attr->type = PERF_TYPE_HW_CACHE;
+        attr->config = cache_read_miss(PERF_COUNT_HW_CACHE_DTLB);
+        break;
+
+    default:
+        return false;
+    }
+    // user space only, which is allowed by the default kernel.perf_event_paranoid
+    attr->exclude_kernel = 1;
+    attr->exclude_hv = 1;
+    attr->read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                        PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return true;
+}
+
+const char* ThreadPerfCounters::event_name(Event event) {
+    switch (event) {
+    case CPU_CYCLES:
+        return "Cycles";
+    case INSTRUCTIONS:
+        return "Instructions";
+    case LLC_MISSES:
+        return "LLCMisses";
+    case BRANCH_MISSES:
+        return "BranchMisses";
+    case DTLB_MISSES:
+        return "DTLBMisses";
+    default:
+        return "Unknown";
+    }
+}
+
+ThreadPerfCounters::ThreadPerfCounters() {
+    _positions.fill(-1);
+    for (int event = 0; event < NUM_EVENTS; ++event) {
+        perf_event_attr attr;
+        if (!init_thread_event_attr(&attr, static_cast<Event>(event))) {
+            continue;
+        }
+        // pid 0 and cpu -1 count the calling thread on any cpu
+        int fd = sys_perf_event_open(&attr, 0, -1, _group_fd, 0);
+        if (fd < 0) {
+            // the cycles lead the group, the other events are optional
+            if (event == CPU_CYCLES) {
+                return;
+            }
+            continue;
+        }
+        if (_group_fd == -1) {
+            _group_fd = fd;
+        }
+        _positions[event] = static_cast<int>(_fds.size());
+        _fds.push_back(fd);
+    }
+}
+
+ThreadPerfCounters::~ThreadPerfCounters() {
+    for (int fd : _fds) {
+        close(fd);
+    }
+}
+
+ThreadPerfCounters* ThreadPerfCounters::current() {
+    static thread_local std::unique_ptr<ThreadPerfCounters> counters;
+    static thread_local bool opened = false;
+    if (!opened) {
+        opened = true;
+        counters.reset(new ThreadPerfCounters());
+        if (counters->_group_fd == -1) {
+            counters.reset();
+        }
+    }
+    return counters.get();
+}
+
+bool ThreadPerfCounters::read(Values* values) const {
+    // PERF_FORMAT_GROUP: nr, time_enabled, time_running, value of every event of the group
+    uint64_t buffer[3 + NUM_EVENTS];
+    auto size = static_cast<ssize_t>((3 + _fds.size()) * sizeof(uint64_t));
+    if (::read(_group_fd, buffer, size) != size) {
+        return false;
+    }
+    uint64_t time_enabled = buffer[1];
+    uint64_t time_running = buffer[2];
+    for (int event = 0; event < NUM_EVENTS; ++event) {
+        if (_positions[event] == -1) {
+            (*values)[event] = 0;
+            continue;
+        }
+        auto value = static_cast<double>(buffer[3 + _positions[event]]);
+        if (time_running > 0 && time_running < time_enabled) {
+            value = value * static_cast<double>(time_enabled) / static_cast<double>(time_running);
+        }
+        (*values)[event] = static_cast<int64_t>(value);
+    }
+    return true;
+}
+
 } // namespace doris
@@ -23,6 +23,7 @@
 #include <gen_cpp/Metrics_types.h>
 #include <stdint.h>
 
+#include <array>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -173,4 +174,52 @@ private:
     static int64_t _vm_peak;
 };
 
+// Hardware events counted for the calling thread only. Every thread opens its own group of perf
+// events on the first use, and the events keep counting until the thread exits, so the work of
+// a code section is the difference of the values read before and after it on the same thread.
+//
+// A typical usage pattern would be:
+//  auto* counters = ThreadPerfCounters::current();
+//  ThreadPerfCounters::Values start, end;
+//  if (counters != nullptr && counters->read(&start)) {
+//      <do your work>
+//      counters->read(&end);
+//  }
+class ThreadPerfCounters {
+public:
+    enum Event {
+        CPU_CYCLES,
+        INSTRUCTIONS,
+        LLC_MISSES,
+        BRANCH_MISSES,
+        DTLB_MISSES,
+        NUM_EVENTS,
+    };
+
+    using Values = std::array<int64_t, NUM_EVENTS>;
+
+    static const char* event_name(Event event);
+
+    // Returns the counters of the calling thread, nullptr if the perf events can't be opened,
+    // e.g. there is no PMU in a VM or kernel.perf_event_paranoid forbids them.
+    static ThreadPerfCounters* current();
+
+    ~ThreadPerfCounters();
+
+    // Read the values counted since the events are opened. The values are scaled when the kernel
+    // multiplexes the events, and the events unavailable on this cpu are always 0.
+    bool read(Values* values) const;
+
+private:
+    ThreadPerfCounters();
+
+    ThreadPerfCounters(const ThreadPerfCounters&) = delete;
+    ThreadPerfCounters& operator=(const ThreadPerfCounters&) = delete;
+
+    int _group_fd = -1;
+    std::vector<int> _fds;
+    // position of every event in the values read from the group, -1 if the event isn't opened
+    std::array<int, NUM_EVENTS> _positions;
+};
+
 } // namespace doris
@@ -26,6 +26,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "util/brpc_client_cache.h"
+#include "util/iobuf_string_holder.h"
 
 namespace doris {
 
@@ -58,6 +59,44 @@ inline bool enable_http_send_block(const PTransmitDataParams& request) {
     return true;
 }
 
+inline bool enable_attachment_send_block(const PTransmitDataParams& request) {
+    if (!config::enable_transmit_block_by_attachment) {
+        return false;
+    }
+    return request.has_block() && request.block().column_metas_size() > 0 &&
+           request.block().column_values().size() >=
+                   static_cast<size_t>(config::transmit_block_attachment_min_bytes);
+}
+
+// Move the column values of the block into the request attachment without copying, so brpc does
+// not copy them again when serializing the request. Receivers restore them with
+// `attachment_extract_block_column_values`.
+template <typename Closure>
+void embed_block_column_values_in_attachment(Closure* closure) {
+    std::unique_ptr<std::string> column_values(
+            closure->request_->mutable_block()->release_column_values());
+    IOBufStringHolder::append(std::move(column_values), &closure->cntl_->request_attachment());
+}
+
+// A block with columns always has column values, if they are empty the sender has put them in
+// the attachment by `embed_block_column_values_in_attachment`.
+inline Status attachment_extract_block_column_values(const PTransmitDataParams* request,
+                                                     brpc::Controller* cntl) {
+    const butil::IOBuf& io_buf = cntl->request_attachment();
+    if (io_buf.empty() || !request->has_block() || request->block().column_metas_size() == 0 ||
+        !request->block().column_values().empty()) {
+        return Status::OK();
+    }
+    auto* req = const_cast<PTransmitDataParams*>(request);
+    try {
+        io_buf.copy_to(req->mutable_block()->mutable_column_values());
+    } catch (...) {
+        return Status::MemoryAllocFailed("attachment extract block failed to memcpy {} bytes",
+                                         io_buf.size());
+    }
+    return Status::OK();
+}
+
 template <typename Closure>
 void transmit_blockv2(PBackendService_Stub& stub, std::unique_ptr<Closure> closure) {
     closure->cntl_->http_request().Clear();
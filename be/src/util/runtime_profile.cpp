@@ -312,6 +312,7 @@ RuntimeProfile* RuntimeProfile::create_child(const std::string& name, bool inden
 void RuntimeProfile::add_child_unlock(RuntimeProfile* child, bool indent, RuntimeProfile* loc) {
     DCHECK(child != nullptr);
     _child_map[child->_name] = child;
+    child->_timers_disabled |= _timers_disabled;
 
     if (loc == nullptr) {
         _children.push_back(std::make_pair(child, indent));
@@ -405,6 +406,7 @@ RuntimeProfile::Counter* RuntimeProfile::add_counter(const std::string& name, TU
            _counter_map.find(parent_counter_name) != _counter_map.end());
 
     Counter* counter = _pool->add(new Counter(type, 0, level));
+    counter->_timer_disabled = _timers_disabled && type == TUnit::TIME_NS;
     _counter_map[name] = counter;
     std::set<std::string>* child_counters =
             find_or_insert(&_child_counter_map, parent_counter_name, std::set<std::string>());
@@ -412,6 +414,34 @@ RuntimeProfile::Counter* RuntimeProfile::add_counter(const std::string& name, TU
     return counter;
 }
 
+RuntimeProfile::ShardedCounter* RuntimeProfile::add_sharded_counter(
+        const std::string& name, TUnit::type type, const std::string& parent_counter_name,
+        int64_t level) {
+    std::lock_guard<std::mutex> l(_counter_map_lock);
+    if (_counter_map.find(name) != _counter_map.end()) {
+        DCHECK(dynamic_cast<ShardedCounter*>(_counter_map[name]));
+        return static_cast<ShardedCounter*>(_counter_map[name]);
+    }
+
+    DCHECK(parent_counter_name == ROOT_COUNTER ||
+           _counter_map.find(parent_counter_name) != _counter_map.end());
+    ShardedCounter* counter = _pool->add(new ShardedCounter(type, level));
+    counter->_timer_disabled = _timers_disabled && type == TUnit::TIME_NS;
+    _counter_map[name] = counter;
+    std::set<std::string>* child_counters =
+            find_or_insert(&_child_counter_map, parent_counter_name, std::set<std::string>());
+    child_counters->insert(name);
+    return counter;
+}
+
+size_t RuntimeProfile::ShardedCounter::_shard_index() {
+    static std::atomic<size_t> next_index = 0;
+    // the threads take the shards in turn, so a few threads never share a shard
+    static thread_local size_t index =
+            next_index.fetch_add(1, std::memory_order_relaxed) % NUM_SHARDS;
+    return index;
+}
+
 RuntimeProfile::NonZeroCounter* RuntimeProfile::add_nonzero_counter(
         const std::string& name, TUnit::type type, const std::string& parent_counter_name,
         int64_t level) {
@@ -26,6 +26,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <functional>
@@ -69,6 +70,8 @@ class RuntimeProfileCounterTreeNode;
 #define ADD_CHILD_TIMER(profile, name, parent) (profile)->add_counter(name, TUnit::TIME_NS, parent)
 #define ADD_CHILD_TIMER_WITH_LEVEL(profile, name, parent, level) \
     (profile)->add_counter(name, TUnit::TIME_NS, parent, level)
+#define ADD_SHARDED_COUNTER(profile, name, type) (profile)->add_sharded_counter(name, type)
+#define ADD_SHARDED_TIMER(profile, name) (profile)->add_sharded_counter(name, TUnit::TIME_NS)
 #define SCOPED_TIMER(c) ScopedTimer<MonotonicStopWatch> MACRO_CONCAT(SCOPED_TIMER, __COUNTER__)(c)
 #define SCOPED_TIMER_ATOMIC(c) \
     ScopedTimer<MonotonicStopWatch, std::atomic_bool> MACRO_CONCAT(SCOPED_TIMER, __COUNTER__)(c)
@@ -151,6 +154,9 @@ public:
 
         bool operator==(const Counter& other) const;
 
+        // A disabled timer is not measured by `ScopedTimer`, see `set_timers_disabled`.
+        bool timer_disabled() const { return _timer_disabled; }
+
     private:
         friend class RuntimeProfile;
         friend class RuntimeProfileCounterTreeNode;
@@ -158,6 +164,56 @@ public:
         std::atomic<int64_t> _value;
         TUnit::type _type;
         int64_t _level;
+        bool _timer_disabled = false;
+    };
+
+    // A counter updated concurrently by many threads, e.g. by all scanners of a scan operator.
+    // Every thread adds to its own shard on a separate cache line instead of bouncing the cache
+    // line of one atomic between the cores, and the shards are summed when the value is read.
+    class ShardedCounter : public Counter {
+    public:
+        ShardedCounter(TUnit::type type, int64_t level) : Counter(type, 0, level) {}
+
+        Counter* clone() const override { return new Counter(type(), value(), level()); }
+
+        void update(int64_t delta) override {
+            _shards[_shard_index()].value.fetch_add(delta, std::memory_order_relaxed);
+        }
+
+        // Not atomic with the concurrent updates.
+        void set(int64_t value) override {
+            for (auto& shard : _shards) {
+                shard.value.store(0, std::memory_order_relaxed);
+            }
+            _shards[0].value.store(value, std::memory_order_relaxed);
+        }
+
+        void set(double value) override { DCHECK(false) << "sharded counter of double"; }
+
+        int64_t value() const override {
+            int64_t sum = 0;
+            for (const auto& shard : _shards) {
+                sum += shard.value.load(std::memory_order_relaxed);
+            }
+            return sum;
+        }
+
+        void pretty_print(std::ostream* s, const std::string& prefix,
+                          const std::string& name) const override {
+            *s << prefix << "   - " << name << ": " << PrettyPrinter::print(value(), type())
+               << std::endl;
+        }
+
+    private:
+        static constexpr size_t NUM_SHARDS = 16;
+
+        struct alignas(CACHE_LINE_SIZE) Shard {
+            std::atomic<int64_t> value {0};
+        };
+
+        static size_t _shard_index();
+
+        std::array<Shard, NUM_SHARDS> _shards;
     };
 
     /// A counter that keeps track of the highest value seen (reporting that
@@ -422,6 +478,12 @@ public:
             const std::string& parent_counter_name = RuntimeProfile::ROOT_COUNTER,
             int64_t level = 2);
 
+    // Same as add_counter(), but the counter is a ShardedCounter.
+    ShardedCounter* add_sharded_counter(
+            const std::string& name, TUnit::type type,
+            const std::string& parent_counter_name = RuntimeProfile::ROOT_COUNTER,
+            int64_t level = 2);
+
     // Add a description entry under target counter.
     void add_description(const std::string& name, const std::string& description,
                          std::string parent_counter_name);
@@ -525,6 +587,10 @@ public:
 
     void clear_children();
 
+    // The timers added to this profile and to the children added after this call are not
+    // measured, which saves the clock reads of the timers when nobody reads the profile.
+    void set_timers_disabled() { _timers_disabled = true; }
+
 private:
     // RuntimeProfileCounterTreeNode needs to access the counter map and child counter map
     friend class RuntimeProfileCounterTreeNode;
@@ -552,6 +618,8 @@ private:
     /// All counters in this profile must be of unit AveragedCounter.
     bool _is_averaged_profile;
 
+    bool _timers_disabled = false;
+
     // Map from counter names to counters.  The profile owns the memory for the
     // counters.
     using CounterMap = std::map<std::string, Counter*>;
@@ -645,6 +713,10 @@ public:
         if (counter == nullptr) {
             return;
         }
+        if (counter->timer_disabled()) {
+            _counter = nullptr;
+            return;
+        }
         DCHECK_EQ(counter->type(), TUnit::TIME_NS);
         _sw.start();
     }
@@ -98,6 +98,31 @@ inline auto bytes_mask_to_bits_mask(const uint8_t* data) {
 #endif
 }
 
+// The bits mask of the bytes_mask_length() bytes of data equal to c, in the layout of
+// bytes_mask_to_bits_mask().
+inline auto bytes_equal_to_bits_mask(const char* data, char c) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    return get_nibble_mask(
+            vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data)), vdupq_n_u8(c)));
+#elif defined(__AVX2__)
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), _mm256_set1_epi8(c))));
+#elif defined(__SSE2__)
+    auto c16 = _mm_set1_epi8(c);
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+                   _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), c16))) |
+           (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), c16)))
+            << 16);
+#else
+    uint32_t mask = 0;
+    for (std::size_t i = 0; i < 32; ++i) {
+        mask |= static_cast<uint32_t>(data[i] == c) << i;
+    }
+    return mask;
+#endif
+}
+
 inline constexpr auto bits_mask_all() {
 #if defined(__ARM_NEON) && defined(__aarch64__)
     return 0xffff'ffff'ffff'ffffULL;
@@ -238,4 +263,71 @@ inline size_t find_zero(const std::vector<uint8_t>& vec, size_t start) {
     return find_byte<uint8_t>(vec, start, 0);
 }
 
+// The number of bytes of a bitmap of size bits.
+inline constexpr size_t bitmap_bytes(size_t size) {
+    return (size + 7) / 8;
+}
+
+// Packs a byte mask of 0 and 1, like a null map, into a bitmap: data[i] is the bit i % 8 of
+// bits[i / 8]. The 8 bytes of a word are packed by a multiplication.
+inline void bytes_to_bitmap(const uint8_t* __restrict data, size_t size, uint8_t* __restrict bits) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        bits[i / 8] = static_cast<uint8_t>((word * 0x0102040810204080ULL) >> 56);
+    }
+    if (i < size) {
+        uint8_t last = 0;
+        for (size_t j = i; j < size; ++j) {
+            last |= static_cast<uint8_t>(data[j] << (j - i));
+        }
+        bits[i / 8] = last;
+    }
+}
+
+// Expands a bitmap back to a byte mask of 0 and 1, the inverse of bytes_to_bitmap.
+inline void bitmap_to_bytes(const uint8_t* __restrict bits, size_t size, uint8_t* __restrict data) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        // broadcast the byte of bits and keep the bit j in the byte j, then turn the bytes
+        // which are not 0 into 1
+        uint64_t word = (bits[i / 8] * 0x0101010101010101ULL) & 0x8040201008040201ULL;
+        word = ((word + 0x7f7f7f7f7f7f7f7fULL) >> 7) & 0x0101010101010101ULL;
+        memcpy(data + i, &word, sizeof(word));
+    }
+    for (; i < size; ++i) {
+        data[i] = static_cast<uint8_t>((bits[i / 8] >> (i % 8)) & 1);
+    }
+}
+
+// The number of bits set in the bitmap of size bits, the bits after size must be 0.
+inline size_t count_bitmap(const uint8_t* bits, size_t size) {
+    const size_t bytes = bitmap_bytes(size);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        uint64_t word;
+        memcpy(&word, bits + i, sizeof(word));
+        count += __builtin_popcountll(word);
+    }
+    for (; i < bytes; ++i) {
+        count += __builtin_popcount(bits[i]);
+    }
+    return count;
+}
+
+// dst |= src and dst &= src of two bitmaps of size bits, the compiler vectorizes the loops.
+inline void bitmap_or(uint8_t* __restrict dst, const uint8_t* __restrict src, size_t size) {
+    for (size_t i = 0, bytes = bitmap_bytes(size); i < bytes; ++i) {
+        dst[i] |= src[i];
+    }
+}
+
+inline void bitmap_and(uint8_t* __restrict dst, const uint8_t* __restrict src, size_t size) {
+    for (size_t i = 0, bytes = bitmap_bytes(size); i < bytes; ++i) {
+        dst[i] &= src[i];
+    }
+}
+
 } // namespace doris::simd
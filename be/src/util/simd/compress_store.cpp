@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/simd/compress_store.h"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+namespace doris::simd {
+
+size_t compress_store_32_avx512(const void* src, uint32_t mask, void* dst) {
+    const auto* values = reinterpret_cast<const int32_t*>(src);
+    auto* result = reinterpret_cast<int32_t*>(dst);
+    // load all the values before any store, which may overwrite them
+    const __m512i low = _mm512_loadu_si512(values);
+    const __m512i high = _mm512_loadu_si512(values + 16);
+    const auto low_mask = static_cast<__mmask16>(mask);
+    const auto high_mask = static_cast<__mmask16>(mask >> 16);
+    // compress in the registers then store the selected lanes only, it's much faster than
+    // compress into the memory on some CPUs
+    const int low_count = __builtin_popcount(low_mask);
+    const int high_count = __builtin_popcount(high_mask);
+    _mm512_mask_storeu_epi32(result, static_cast<__mmask16>((1U << low_count) - 1),
+                             _mm512_maskz_compress_epi32(low_mask, low));
+    _mm512_mask_storeu_epi32(result + low_count, static_cast<__mmask16>((1U << high_count) - 1),
+                             _mm512_maskz_compress_epi32(high_mask, high));
+    return static_cast<size_t>(low_count + high_count);
+}
+
+size_t compress_store_64_avx512(const void* src, uint32_t mask, void* dst) {
+    const auto* values = reinterpret_cast<const int64_t*>(src);
+    auto* result = reinterpret_cast<int64_t*>(dst);
+    __m512i vectors[4];
+    for (int i = 0; i < 4; ++i) {
+        vectors[i] = _mm512_loadu_si512(values + i * 8);
+    }
+    for (int i = 0; i < 4; ++i) {
+        const auto lane_mask = static_cast<__mmask8>(mask >> (i * 8));
+        const int count = __builtin_popcount(lane_mask);
+        _mm512_mask_storeu_epi64(result, static_cast<__mmask8>((1U << count) - 1),
+                                 _mm512_maskz_compress_epi64(lane_mask, vectors[i]));
+        result += count;
+    }
+    return static_cast<size_t>(result - reinterpret_cast<int64_t*>(dst));
+}
+
+} // namespace doris::simd
+
+#endif
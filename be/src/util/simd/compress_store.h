@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "util/cpu_info.h"
+
+namespace doris::simd {
+
+#ifdef __AVX2__
+// Stores the 4 (8) bytes values of the 32 at src whose bits are set in mask to dst contiguously
+// with VPCOMPRESSD (VPCOMPRESSQ), dst may overlap with src if it is not after src. The CPU must
+// support AVX512F. Returns the number of the stored values.
+size_t compress_store_32_avx512(const void* src, uint32_t mask, void* dst)
+        __attribute__((target("avx512f")));
+size_t compress_store_64_avx512(const void* src, uint32_t mask, void* dst)
+        __attribute__((target("avx512f")));
+#endif
+
+// Stores the values of src[0, bits_mask_length()) selected by the bits of mask, a mask of
+// bytes_mask_to_bits_mask(), to dst contiguously and branch-free. Returns the end of the stored
+// values, or nullptr if the values or the CPU are not supported, then the caller copies them.
+template <typename T, typename Mask>
+ALWAYS_INLINE inline T* compress_store(const T* src, Mask mask, T* dst) {
+#ifdef __AVX2__
+    if constexpr (sizeof(T) == 4 || sizeof(T) == 8) {
+        if (CpuInfo::is_supported(CpuInfo::AVX512F)) {
+            if constexpr (sizeof(T) == 4) {
+                return dst + compress_store_32_avx512(src, static_cast<uint32_t>(mask), dst);
+            } else {
+                return dst + compress_store_64_avx512(src, static_cast<uint32_t>(mask), dst);
+            }
+        }
+    }
+#endif
+    return nullptr;
+}
+
+} // namespace doris::simd
@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// Fast paths of the casts from strings, for the most common shapes of the strings.
+//
+// They work on 8 bytes at once as 64-bit integers (SWAR): validating 8 digits is a couple of
+// additions and masks, and converting them is three multiplications instead of a loop with a
+// branch for each byte. A string they don't accept is left to the general parser, so the result
+// of a cast is the same. The bytes are read in little endian, like every platform the BE runs on.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "vec/data_types/number_traits.h"
+
+namespace doris::simd {
+
+namespace detail {
+
+// Whether the 8 bytes are all ascii digits.
+inline bool is_eight_digits(uint64_t chunk) {
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+           0x3333333333333333ULL;
+}
+
+// The value of 8 ascii digits, the first digit is the lowest byte.
+inline uint32_t parse_eight_digits(uint64_t chunk) {
+    chunk -= 0x3030303030303030ULL;
+    // the pairs of digits
+    chunk = (chunk * 10) + (chunk >> 8);
+    // 4 pairs to 2 groups of 4 digits, then to the value
+    chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+             (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+            32;
+    return static_cast<uint32_t>(chunk);
+}
+
+// Whether the bytes at separator_mask are separators and the others are digits.
+inline bool matches(uint64_t chunk, uint64_t separator_mask, uint64_t separators) {
+    return (chunk & separator_mask) == separators &&
+           is_eight_digits((chunk & ~separator_mask) | (0x3030303030303030ULL & separator_mask));
+}
+
+inline bool is_digit(char c) {
+    return static_cast<uint8_t>(c - '0') <= 9;
+}
+
+inline uint32_t digit(char c) {
+    return static_cast<uint32_t>(c - '0');
+}
+
+inline uint32_t two_digits(const char* s) {
+    return digit(s[0]) * 10 + digit(s[1]);
+}
+
+inline uint64_t load(const char* s) {
+    uint64_t chunk;
+    memcpy(&chunk, s, sizeof(chunk));
+    return chunk;
+}
+
+} // namespace detail
+
+// Parse an integer made of an optional sign and decimal digits only, with fewer digits than the
+// longest value of T, so it can't overflow. Leading or trailing spaces and fractions such as
+// "3.0" are left to StringParser::string_to_int.
+template <typename T>
+bool parse_int(const char* s, size_t len, T* value) {
+    static_assert(std::is_integral_v<T> || std::is_same_v<T, __int128>);
+    using UnsignedT = std::make_unsigned_t<T>;
+    size_t i = 0;
+    bool negative = false;
+    if (len > 0 && (s[0] == '-' || s[0] == '+')) {
+        negative = s[0] == '-';
+        i = 1;
+    }
+    if (len == i || len - i >= static_cast<size_t>(vectorized::NumberTraits::max_ascii_len<T>())) {
+        return false;
+    }
+
+    UnsignedT result = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t chunk = detail::load(s + i);
+        if (!detail::is_eight_digits(chunk)) {
+            return false;
+        }
+        result = static_cast<UnsignedT>(result * 100000000 + detail::parse_eight_digits(chunk));
+    }
+    for (; i < len; ++i) {
+        if (!detail::is_digit(s[i])) {
+            return false;
+        }
+        result = static_cast<UnsignedT>(result * 10 + detail::digit(s[i]));
+    }
+    *value = static_cast<T>(negative ? static_cast<UnsignedT>(0 - result) : result);
+    return true;
+}
+
+struct DateTimeParts {
+    uint16_t year = 0;
+    uint8_t month = 0;
+    uint8_t day = 0;
+    uint8_t hour = 0;
+    uint8_t minute = 0;
+    uint8_t second = 0;
+    uint32_t microsecond = 0;
+};
+
+// Parse "yyyy-MM-dd" and "yyyy-MM-dd HH:mm:ss[.ffffff]", with a 'T' or a space before the time,
+// and at most max_fraction_digits digits of the fraction, so it needn't be rounded. The ranges
+// of the parts are checked by the caller.
+inline bool parse_datetime(const char* s, size_t len, size_t max_fraction_digits,
+                           DateTimeParts* parts) {
+    if (len != 10 && (len < 19 || len == 20 || len > 26)) {
+        return false;
+    }
+    // "yyyy-MM-"
+    if (!detail::matches(detail::load(s), 0xFF0000FF00000000ULL, 0x2D00002D00000000ULL)) {
+        return false;
+    }
+    parts->year = static_cast<uint16_t>(detail::two_digits(s) * 100 + detail::two_digits(s + 2));
+    parts->month = static_cast<uint8_t>(detail::two_digits(s + 5));
+    if (len == 10) {
+        if (!detail::is_digit(s[8]) || !detail::is_digit(s[9])) {
+            return false;
+        }
+        parts->day = static_cast<uint8_t>(detail::two_digits(s + 8));
+        parts->hour = parts->minute = parts->second = 0;
+        parts->microsecond = 0;
+        return true;
+    }
+
+    // "dd HH:mm" or "ddTHH:mm", then ":ss"
+    constexpr uint64_t TIME_SEPARATOR_MASK = 0x0000FF0000FF0000ULL;
+    uint64_t time = detail::load(s + 8);
+    if ((!detail::matches(time, TIME_SEPARATOR_MASK, 0x00003A0000200000ULL) &&
+         !detail::matches(time, TIME_SEPARATOR_MASK, 0x00003A0000540000ULL)) ||
+        s[16] != ':' || !detail::is_digit(s[17]) || !detail::is_digit(s[18])) {
+        return false;
+    }
+    parts->day = static_cast<uint8_t>(detail::two_digits(s + 8));
+    parts->hour = static_cast<uint8_t>(detail::two_digits(s + 11));
+    parts->minute = static_cast<uint8_t>(detail::two_digits(s + 14));
+    parts->second = static_cast<uint8_t>(detail::two_digits(s + 17));
+    parts->microsecond = 0;
+    if (len == 19) {
+        return true;
+    }
+
+    size_t fraction_digits = len - 20;
+    if (s[19] != '.' || fraction_digits > max_fraction_digits) {
+        return false;
+    }
+    uint32_t fraction = 0;
+    for (size_t i = 20; i < len; ++i) {
+        if (!detail::is_digit(s[i])) {
+            return false;
+        }
+        fraction = fraction * 10 + detail::digit(s[i]);
+    }
+    for (size_t i = fraction_digits; i < 6; ++i) {
+        fraction *= 10;
+    }
+    parts->microsecond = fraction;
+    return true;
+}
+
+} // namespace doris::simd
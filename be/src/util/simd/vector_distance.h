@@ -0,0 +1,221 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Distance kernels over contiguous double vectors, used by the array distance functions.
+//
+// They are written with the SIMD instructions the BE is compiled for: AVX2 when USE_AVX2 is
+// on, NEON on aarch64, and plain loops otherwise. Two accumulators are kept so the additions
+// don't wait on each other. The order of the additions differs from a plain loop, so the
+// results may differ from it in the last bits.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace doris::simd {
+
+namespace detail {
+
+#if defined(__AVX2__)
+using DoubleBatch = __m256d;
+constexpr size_t DOUBLE_BATCH_SIZE = 4;
+inline DoubleBatch batch_zero() {
+    return _mm256_setzero_pd();
+}
+inline DoubleBatch batch_load(const double* data) {
+    return _mm256_loadu_pd(data);
+}
+inline DoubleBatch batch_add(DoubleBatch x, DoubleBatch y) {
+    return _mm256_add_pd(x, y);
+}
+inline DoubleBatch batch_sub(DoubleBatch x, DoubleBatch y) {
+    return _mm256_sub_pd(x, y);
+}
+inline DoubleBatch batch_mul(DoubleBatch x, DoubleBatch y) {
+    return _mm256_mul_pd(x, y);
+}
+inline DoubleBatch batch_abs(DoubleBatch x) {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+}
+inline double batch_sum(DoubleBatch x) {
+    __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+using DoubleBatch = float64x2_t;
+constexpr size_t DOUBLE_BATCH_SIZE = 2;
+inline DoubleBatch batch_zero() {
+    return vdupq_n_f64(0);
+}
+inline DoubleBatch batch_load(const double* data) {
+    return vld1q_f64(data);
+}
+inline DoubleBatch batch_add(DoubleBatch x, DoubleBatch y) {
+    return vaddq_f64(x, y);
+}
+inline DoubleBatch batch_sub(DoubleBatch x, DoubleBatch y) {
+    return vsubq_f64(x, y);
+}
+inline DoubleBatch batch_mul(DoubleBatch x, DoubleBatch y) {
+    return vmulq_f64(x, y);
+}
+inline DoubleBatch batch_abs(DoubleBatch x) {
+    return vabsq_f64(x);
+}
+inline double batch_sum(DoubleBatch x) {
+    return vaddvq_f64(x);
+}
+#else
+using DoubleBatch = double;
+constexpr size_t DOUBLE_BATCH_SIZE = 1;
+inline DoubleBatch batch_zero() {
+    return 0;
+}
+inline DoubleBatch batch_load(const double* data) {
+    return *data;
+}
+inline DoubleBatch batch_add(DoubleBatch x, DoubleBatch y) {
+    return x + y;
+}
+inline DoubleBatch batch_sub(DoubleBatch x, DoubleBatch y) {
+    return x - y;
+}
+inline DoubleBatch batch_mul(DoubleBatch x, DoubleBatch y) {
+    return x * y;
+}
+inline DoubleBatch batch_abs(DoubleBatch x) {
+    return std::fabs(x);
+}
+inline double batch_sum(DoubleBatch x) {
+    return x;
+}
+#endif
+
+} // namespace detail
+
+// sum(|x[i] - y[i]|)
+inline double l1_distance(const double* __restrict x, const double* __restrict y, size_t n) {
+    using namespace detail;
+    DoubleBatch sum0 = batch_zero();
+    DoubleBatch sum1 = batch_zero();
+    size_t i = 0;
+    for (; i + 2 * DOUBLE_BATCH_SIZE <= n; i += 2 * DOUBLE_BATCH_SIZE) {
+        sum0 = batch_add(sum0, batch_abs(batch_sub(batch_load(x + i), batch_load(y + i))));
+        sum1 = batch_add(sum1, batch_abs(batch_sub(batch_load(x + i + DOUBLE_BATCH_SIZE),
+                                                   batch_load(y + i + DOUBLE_BATCH_SIZE))));
+    }
+    double sum = batch_sum(batch_add(sum0, sum1));
+    for (; i < n; ++i) {
+        sum += std::fabs(x[i] - y[i]);
+    }
+    return sum;
+}
+
+// sum((x[i] - y[i])^2)
+inline double l2_squared_distance(const double* __restrict x, const double* __restrict y,
+                                  size_t n) {
+    using namespace detail;
+    DoubleBatch sum0 = batch_zero();
+    DoubleBatch sum1 = batch_zero();
+    size_t i = 0;
+    for (; i + 2 * DOUBLE_BATCH_SIZE <= n; i += 2 * DOUBLE_BATCH_SIZE) {
+        DoubleBatch diff0 = batch_sub(batch_load(x + i), batch_load(y + i));
+        DoubleBatch diff1 = batch_sub(batch_load(x + i + DOUBLE_BATCH_SIZE),
+                                      batch_load(y + i + DOUBLE_BATCH_SIZE));
+        sum0 = batch_add(sum0, batch_mul(diff0, diff0));
+        sum1 = batch_add(sum1, batch_mul(diff1, diff1));
+    }
+    double sum = batch_sum(batch_add(sum0, sum1));
+    for (; i < n; ++i) {
+        sum += (x[i] - y[i]) * (x[i] - y[i]);
+    }
+    return sum;
+}
+
+// sum(x[i] * y[i])
+inline double inner_product(const double* __restrict x, const double* __restrict y, size_t n) {
+    using namespace detail;
+    DoubleBatch sum0 = batch_zero();
+    DoubleBatch sum1 = batch_zero();
+    size_t i = 0;
+    for (; i + 2 * DOUBLE_BATCH_SIZE <= n; i += 2 * DOUBLE_BATCH_SIZE) {
+        sum0 = batch_add(sum0, batch_mul(batch_load(x + i), batch_load(y + i)));
+        sum1 = batch_add(sum1, batch_mul(batch_load(x + i + DOUBLE_BATCH_SIZE),
+                                         batch_load(y + i + DOUBLE_BATCH_SIZE)));
+    }
+    double sum = batch_sum(batch_add(sum0, sum1));
+    for (; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+// The inner product of x and y, and the squared norm of x, in one pass.
+inline void inner_product_and_squared_norm(const double* __restrict x, const double* __restrict y,
+                                           size_t n, double* dot_prod, double* squared_x) {
+    using namespace detail;
+    DoubleBatch dot_sum = batch_zero();
+    DoubleBatch x_sum = batch_zero();
+    size_t i = 0;
+    for (; i + DOUBLE_BATCH_SIZE <= n; i += DOUBLE_BATCH_SIZE) {
+        DoubleBatch x_batch = batch_load(x + i);
+        dot_sum = batch_add(dot_sum, batch_mul(x_batch, batch_load(y + i)));
+        x_sum = batch_add(x_sum, batch_mul(x_batch, x_batch));
+    }
+    *dot_prod = batch_sum(dot_sum);
+    *squared_x = batch_sum(x_sum);
+    for (; i < n; ++i) {
+        *dot_prod += x[i] * y[i];
+        *squared_x += x[i] * x[i];
+    }
+}
+
+// The inner product of x and y, and the squared norms of both, in one pass.
+inline void inner_product_and_squared_norms(const double* __restrict x,
+                                            const double* __restrict y, size_t n,
+                                            double* dot_prod, double* squared_x,
+                                            double* squared_y) {
+    using namespace detail;
+    DoubleBatch dot_sum = batch_zero();
+    DoubleBatch x_sum = batch_zero();
+    DoubleBatch y_sum = batch_zero();
+    size_t i = 0;
+    for (; i + DOUBLE_BATCH_SIZE <= n; i += DOUBLE_BATCH_SIZE) {
+        DoubleBatch x_batch = batch_load(x + i);
+        DoubleBatch y_batch = batch_load(y + i);
+        dot_sum = batch_add(dot_sum, batch_mul(x_batch, y_batch));
+        x_sum = batch_add(x_sum, batch_mul(x_batch, x_batch));
+        y_sum = batch_add(y_sum, batch_mul(y_batch, y_batch));
+    }
+    *dot_prod = batch_sum(dot_sum);
+    *squared_x = batch_sum(x_sum);
+    *squared_y = batch_sum(y_sum);
+    for (; i < n; ++i) {
+        *dot_prod += x[i] * y[i];
+        *squared_x += x[i] * x[i];
+        *squared_y += y[i] * y[i];
+    }
+}
+
+} // namespace doris::simd
@@ -30,6 +30,7 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
+#include <chrono>
 #include <cstdlib>
 #include <filesystem>
 #include <memory>
@@ -154,6 +155,33 @@ bool TimezoneUtils::find_cctz_time_zone(const std::string& timezone, cctz::time_
     return false;
 }
 
+bool TimezoneUtils::get_fixed_offset(const cctz::time_zone& tz, int64_t begin, int64_t end,
+                                     int64_t* offset) {
+    static const auto epoch = std::chrono::time_point_cast<cctz::seconds>(
+            std::chrono::system_clock::from_time_t(0));
+    const auto begin_point = epoch + cctz::seconds(begin);
+    cctz::time_zone::civil_transition transition;
+    // the instant of the next transition is the one where the civil time it jumps to begins
+    if (tz.next_transition(begin_point, &transition) &&
+        tz.lookup(transition.to).trans <= epoch + cctz::seconds(end)) {
+        return false;
+    }
+    *offset = tz.lookup(begin_point).offset;
+    return true;
+}
+
+bool TimezoneUtils::get_fixed_offset(const cctz::time_zone& tz, const cctz::civil_second& begin,
+                                     const cctz::civil_second& end, int64_t* offset) {
+    const auto begin_lookup = tz.lookup(begin);
+    const auto end_lookup = tz.lookup(end);
+    if (begin_lookup.kind != cctz::time_zone::civil_lookup::UNIQUE ||
+        end_lookup.kind != cctz::time_zone::civil_lookup::UNIQUE) {
+        return false;
+    }
+    return get_fixed_offset(tz, begin_lookup.pre.time_since_epoch().count(),
+                            end_lookup.pre.time_since_epoch().count(), offset);
+}
+
 bool TimezoneUtils::parse_tz_offset_string(const std::string& timezone, cctz::time_zone& ctz) {
     // like +08:00, which not in timezone_names_map_
     re2::StringPiece value;
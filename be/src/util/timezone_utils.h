@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <cctz/civil_time.h>
+
+#include <cstdint>
 #include <string>
 
 namespace cctz {
@@ -36,6 +39,16 @@ public:
 
     static bool find_cctz_time_zone(const std::string& timezone, cctz::time_zone& ctz);
 
+    // Set *offset to the seconds tz is ahead of UTC, and return true if it doesn't change for the
+    // instants in [begin, end], which are seconds since the epoch. A batch of values within one
+    // DST period is then converted by adding the offset instead of looking up the zone for each.
+    static bool get_fixed_offset(const cctz::time_zone& tz, int64_t begin, int64_t end,
+                                 int64_t* offset);
+
+    // The same for the civil times in [begin, end] of tz, none of them is skipped or repeated.
+    static bool get_fixed_offset(const cctz::time_zone& tz, const cctz::civil_second& begin,
+                                 const cctz::civil_second& end, int64_t* offset);
+
     static const std::string default_time_zone;
 
 private:
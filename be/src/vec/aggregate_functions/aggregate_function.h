@@ -213,6 +213,17 @@ public:
                                         AggregateDataPtr place, const IColumn** columns,
                                         Arena*) const = 0;
 
+    // only used at window function, a sliding frame of a function which supports remove moves by
+    // adding the new rows and removing the rows which left the frame, instead of adding them all.
+    virtual bool supports_remove() const { return false; }
+
+    // Takes the rows [frame_start, frame_end) which were added before out of the state again.
+    virtual void remove_range_single_place(int64_t frame_start, int64_t frame_end,
+                                           AggregateDataPtr place, const IColumn** columns,
+                                           Arena*) const {
+        throw Exception(ErrorCode::NOT_IMPLEMENTED_ERROR, "{} not support remove", get_name());
+    }
+
     virtual void streaming_agg_serialize(const IColumn** columns, BufferWritable& buf,
                                          const size_t num_rows, Arena*) const = 0;
 
@@ -156,6 +156,22 @@ public:
         ++this->data(place).count;
     }
 
+    bool supports_remove() const override { return !is_float_or_double(T); }
+
+    void remove_range_single_place(int64_t frame_start, int64_t frame_end, AggregateDataPtr place,
+                                   const IColumn** columns, Arena*) const override {
+        const auto& column =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(*columns[0]);
+        for (int64_t i = frame_start; i < frame_end; ++i) {
+            if constexpr (is_decimal(T)) {
+                this->data(place).sum -= (DataType)column.get_data()[i].value;
+            } else {
+                this->data(place).sum -= (DataType)column.get_data()[i];
+            }
+        }
+        this->data(place).count -= static_cast<UInt64>(frame_end - frame_start);
+    }
+
     void reset(AggregateDataPtr place) const override {
         this->data(place).sum = {};
         this->data(place).count = 0;
@@ -191,6 +191,16 @@ public:
         const size_t num_rows = column.size();
         auto* data = col.get_data().data();
 
+        if constexpr (std::is_same_v<Data, AggregateFunctionBitmapData<
+                                                   AggregateFunctionBitmapUnionOp>>) {
+            // merge all serialized unions at once
+            std::vector<const BitmapValue*> values(num_rows);
+            for (size_t i = 0; i != num_rows; ++i) {
+                values[i] = &data[i];
+            }
+            this->data(place).add_batch(values);
+            return;
+        }
         for (size_t i = 0; i != num_rows; ++i) {
             this->data(place).merge(data[i]);
         }
@@ -287,6 +297,16 @@ public:
         }
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena* arena) const override {
+        _add_range(place, columns, 0, batch_size, arena);
+    }
+
+    void add_batch_range(size_t batch_begin, size_t batch_end, AggregateDataPtr place,
+                         const IColumn** columns, Arena* arena, bool has_null) override {
+        _add_range(place, columns, batch_begin, batch_end + 1, arena);
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena*) const override {
         this->data(place).merge(
@@ -309,6 +329,33 @@ public:
     }
 
     void reset(AggregateDataPtr __restrict place) const override { this->data(place).reset(); }
+
+private:
+    // adds the rows [begin, end) to one place
+    void _add_range(AggregateDataPtr __restrict place, const IColumn** columns, size_t begin,
+                    size_t end, Arena* arena) const {
+        const auto& column =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(*columns[0]);
+        if constexpr (std::is_same_v<Op, AggregateFunctionBitmapUnionOp>) {
+            // union all bitmaps at once instead of upgrading the result row by row
+            std::vector<const BitmapValue*> values(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                values[i - begin] = &column.get_data()[i];
+            }
+            this->data(place).add_batch(values);
+        } else {
+            auto& data = this->data(place);
+            for (size_t i = begin; i < end; ++i) {
+                if constexpr (std::is_same_v<Op, AggregateFunctionBitmapIntersectOp>) {
+                    // an empty intersection stays empty
+                    if (!data.is_first && data.value.empty()) {
+                        break;
+                    }
+                }
+                data.add(column.get_data()[i]);
+            }
+        }
+    }
 };
 
 template <bool arg_is_nullable, typename ColVecType>
@@ -27,6 +27,7 @@
 #include <memory>
 #include <vector>
 
+#include "util/simd/bits.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_fixed_length_object.h"
@@ -64,6 +65,13 @@ public:
         ++data(place).count;
     }
 
+    bool supports_remove() const override { return true; }
+
+    void remove_range_single_place(int64_t frame_start, int64_t frame_end, AggregateDataPtr place,
+                                   const IColumn**, Arena*) const override {
+        data(place).count -= static_cast<UInt64>(frame_end - frame_start);
+    }
+
     void reset(AggregateDataPtr place) const override {
         AggregateFunctionCount::data(place).count = 0;
     }
@@ -196,6 +204,27 @@ public:
                          .is_null_at(row_num);
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena*) const override {
+        const auto& null_map =
+                assert_cast<const ColumnNullable&, TypeCheckOnRelease::DISABLE>(*columns[0])
+                        .get_null_map_data();
+        data(place).count += simd::count_zero_num(reinterpret_cast<const int8_t*>(null_map.data()),
+                                                  batch_size);
+    }
+
+    bool supports_remove() const override { return true; }
+
+    void remove_range_single_place(int64_t frame_start, int64_t frame_end, AggregateDataPtr place,
+                                   const IColumn** columns, Arena*) const override {
+        const auto& null_map =
+                assert_cast<const ColumnNullable&, TypeCheckOnRelease::DISABLE>(*columns[0])
+                        .get_null_map_data();
+        data(place).count -= simd::count_zero_num(
+                reinterpret_cast<const int8_t*>(null_map.data() + frame_start),
+                static_cast<size_t>(frame_end - frame_start));
+    }
+
     void reset(AggregateDataPtr place) const override { data(place).count = 0; }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
@@ -78,6 +78,12 @@ struct AggregateFunctionHLLData {
         const auto& sources = assert_cast<const ColumnHLL&, TypeCheckOnRelease::DISABLE>(*column);
         dst_hll.merge(sources.get_element(row_num));
     }
+
+    // add the rows [begin, end)
+    void add_range(const IColumn* column, size_t begin, size_t end) {
+        const auto& sources = assert_cast<const ColumnHLL&, TypeCheckOnRelease::DISABLE>(*column);
+        dst_hll.merge_batch(sources.get_data().data() + begin, end - begin);
+    }
 };
 
 template <typename Data>
@@ -125,6 +131,16 @@ public:
         this->data(place).add(columns[0], row_num);
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena*) const override {
+        this->data(place).add_range(columns[0], 0, batch_size);
+    }
+
+    void add_batch_range(size_t batch_begin, size_t batch_end, AggregateDataPtr place,
+                         const IColumn** columns, Arena*, bool has_null) override {
+        this->data(place).add_range(columns[0], batch_begin, batch_end + 1);
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena*) const override {
         this->data(place).merge(this->data(rhs));
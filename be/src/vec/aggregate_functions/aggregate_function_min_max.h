@@ -92,6 +92,27 @@ public:
                                 value);
     }
 
+    // Folds the rows in [begin, end) whose null_map is 0, a null row folds the identity of min or
+    // max instead of branching, so the loop is vectorized.
+    template <bool less>
+    void change_if_range_with_null_map(const IColumn& column, size_t begin, size_t end,
+                                       const UInt8* __restrict null_map) {
+        using Item = typename PrimitiveTypeTraits<T>::ColumnItemType;
+        using ColumnType = typename PrimitiveTypeTraits<T>::ColumnType;
+        const auto* __restrict data =
+                assert_cast<const ColumnType&, TypeCheckOnRelease::DISABLE>(column)
+                        .get_data()
+                        .data();
+        const Item identity = less ? type_limit<Item>::max() : type_limit<Item>::min();
+        Item result = has_value ? value : identity;
+        for (size_t i = begin; i < end; ++i) {
+            result = less ? std::min(null_map[i] ? identity : data[i], result)
+                          : std::max(null_map[i] ? identity : data[i], result);
+        }
+        has_value = true;
+        value = result;
+    }
+
     void insert_result_into(IColumn& to) const {
         if (has()) {
             assert_cast<typename PrimitiveTypeTraits<T>::ColumnType&>(to).get_data().push_back(
@@ -222,6 +243,27 @@ public:
                                 value);
     }
 
+    // Folds the rows in [begin, end) whose null_map is 0, a null row folds the identity of min or
+    // max instead of branching, so the loop is vectorized.
+    template <bool less>
+    void change_if_range_with_null_map(const IColumn& column, size_t begin, size_t end,
+                                       const UInt8* __restrict null_map) {
+        using Item = typename PrimitiveTypeTraits<T>::ColumnItemType;
+        using ColumnType = typename PrimitiveTypeTraits<T>::ColumnType;
+        const auto* __restrict data =
+                assert_cast<const ColumnType&, TypeCheckOnRelease::DISABLE>(column)
+                        .get_data()
+                        .data();
+        const Item identity = less ? type_limit<Item>::max() : type_limit<Item>::min();
+        Item result = has_value ? value : identity;
+        for (size_t i = begin; i < end; ++i) {
+            result = less ? std::min(null_map[i] ? identity : data[i], result)
+                          : std::max(null_map[i] ? identity : data[i], result);
+        }
+        has_value = true;
+        value = result;
+    }
+
     void insert_result_into(IColumn& to) const {
         if (has()) {
             assert_cast<typename PrimitiveTypeTraits<T>::ColumnType&>(to).insert_data(
@@ -503,6 +545,13 @@ struct AggregateFunctionMaxData : public Data {
 
     void change_if_better(const Self& to, Arena*) { this->change_if_greater(to, nullptr); }
 
+    void change_if_better_range_with_null_map(const IColumn& column, size_t begin, size_t end,
+                                              const UInt8* __restrict null_map)
+        requires(Data::IsFixedLength)
+    {
+        this->template change_if_range_with_null_map<false>(column, begin, end, null_map);
+    }
+
     void reset() {
         if constexpr (Data::IsFixedLength) {
             this->set_to_min_max(false);
@@ -530,6 +579,13 @@ struct AggregateFunctionMinData : Data {
     }
     void change_if_better(const Self& to, Arena*) { this->change_if_less(to, nullptr); }
 
+    void change_if_better_range_with_null_map(const IColumn& column, size_t begin, size_t end,
+                                              const UInt8* __restrict null_map)
+        requires(Data::IsFixedLength)
+    {
+        this->template change_if_range_with_null_map<true>(column, begin, end, null_map);
+    }
+
     void reset() {
         if constexpr (Data::IsFixedLength) {
             this->set_to_min_max(true);
@@ -690,6 +746,17 @@ public:
         }
     }
 
+    // The rows in [begin, end) whose null_map is 0 are added, at least one of them is not null.
+    // Used by AggregateFunctionNullUnaryInline.
+    void add_range_single_place_with_null_map(size_t begin, size_t end,
+                                              AggregateDataPtr __restrict place,
+                                              const IColumn& column,
+                                              const UInt8* __restrict null_map) const
+        requires(!Data::IS_ANY && Data::IsFixedLength)
+    {
+        this->data(place).change_if_better_range_with_null_map(column, begin, end, null_map);
+    }
+
     void reset(AggregateDataPtr place) const override { this->data(place).reset(); }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
@@ -29,11 +29,27 @@
 #include "vec/columns/column_nullable.h"
 #include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type_nullable.h"
+#include "util/simd/bits.h"
 #include "vec/io/io_helper.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+/// The nested functions with batch kernels that take the null map of the argument and skip the
+/// null rows without a branch per row, e.g. sum, min and max of numbers, decimals and dates.
+template <typename Function>
+concept HasNullMapRangeKernel =
+        requires(const Function& f, AggregateDataPtr place, const IColumn& column,
+                 const UInt8* null_map) {
+            f.add_range_single_place_with_null_map(size_t(0), size_t(0), place, column, null_map);
+        };
+
+template <typename Function>
+concept HasNullMapBatchKernel = requires(const Function& f, AggregateDataPtr* places,
+                                         const IColumn& column, const UInt8* null_map) {
+    f.add_batch_with_null_map(size_t(0), places, size_t(0), column, null_map);
+};
+
 template <typename NestFunction, bool result_is_nullable, typename Derived>
 class AggregateFunctionNullBaseInline : public IAggregateFunctionHelper<Derived> {
 protected:
@@ -227,11 +243,23 @@ public:
         const IColumn* nested_column = &column->get_nested_column();
         if (column->has_null()) {
             const auto* __restrict null_map_data = column->get_null_map_data().data();
-            for (int i = 0; i < batch_size; ++i) {
-                if (!null_map_data[i]) {
-                    AggregateDataPtr __restrict place = places[i] + place_offset;
-                    this->set_flag(place);
-                    this->nested_function->add(this->nested_place(place), &nested_column, i, arena);
+            if constexpr (HasNullMapBatchKernel<NestFuction>) {
+                if constexpr (result_is_nullable) {
+                    for (size_t i = 0; i < batch_size; ++i) {
+                        places[i][place_offset] |= !null_map_data[i];
+                    }
+                }
+                this->nested_function->add_batch_with_null_map(batch_size, places,
+                                                               place_offset + this->prefix_size,
+                                                               *nested_column, null_map_data);
+            } else {
+                for (int i = 0; i < batch_size; ++i) {
+                    if (!null_map_data[i]) {
+                        AggregateDataPtr __restrict place = places[i] + place_offset;
+                        this->set_flag(place);
+                        this->nested_function->add(this->nested_place(place), &nested_column, i,
+                                                   arena);
+                    }
                 }
             }
         } else {
@@ -254,8 +282,12 @@ public:
         bool has_null = column->has_null();
 
         if (has_null) {
-            for (size_t i = 0; i < batch_size; ++i) {
-                this->add(place, columns, i, arena);
+            if constexpr (HasNullMapRangeKernel<NestFuction>) {
+                _add_range_with_null_map(0, batch_size, place, *column);
+            } else {
+                for (size_t i = 0; i < batch_size; ++i) {
+                    this->add(place, columns, i, arena);
+                }
             }
         } else {
             this->set_flag(place);
@@ -265,13 +297,42 @@ public:
         }
     }
 
+    bool supports_remove() const override { return this->nested_function->supports_remove(); }
+
+    // The flag is kept, so the caller resets the place once the frame has no not null row.
+    void remove_range_single_place(int64_t frame_start, int64_t frame_end, AggregateDataPtr place,
+                                   const IColumn** columns, Arena* arena) const override {
+        const auto* column =
+                assert_cast<const ColumnNullable*, TypeCheckOnRelease::DISABLE>(columns[0]);
+        const IColumn* nested_column = &column->get_nested_column();
+        const auto& null_map = column->get_null_map_data();
+        // Removes each run of not null rows at once.
+        for (int64_t i = frame_start; i < frame_end;) {
+            if (null_map[i]) {
+                ++i;
+                continue;
+            }
+            int64_t run_end = i + 1;
+            while (run_end < frame_end && !null_map[run_end]) {
+                ++run_end;
+            }
+            this->nested_function->remove_range_single_place(
+                    i, run_end, this->nested_place(place), &nested_column, arena);
+            i = run_end;
+        }
+    }
+
     void add_batch_range(size_t batch_begin, size_t batch_end, AggregateDataPtr place,
                          const IColumn** columns, Arena* arena, bool has_null) override {
         const auto* column = assert_cast<const ColumnNullable*>(columns[0]);
 
         if (has_null) {
-            for (size_t i = batch_begin; i <= batch_end; ++i) {
-                this->add(place, columns, i, arena);
+            if constexpr (HasNullMapRangeKernel<NestFuction>) {
+                _add_range_with_null_map(batch_begin, batch_end + 1, place, *column);
+            } else {
+                for (size_t i = batch_begin; i <= batch_end; ++i) {
+                    this->add(place, columns, i, arena);
+                }
             }
         } else {
             this->set_flag(place);
@@ -281,6 +342,20 @@ public:
                                                    false);
         }
     }
+
+private:
+    // Adds the not null rows in [begin, end) by the kernel of the nested function.
+    void _add_range_with_null_map(size_t begin, size_t end, AggregateDataPtr place,
+                                  const ColumnNullable& column) const {
+        const auto* null_map = column.get_null_map_data().data();
+        if (simd::count_zero_num(reinterpret_cast<const int8_t*>(null_map + begin), end - begin) ==
+            0) {
+            return;
+        }
+        this->set_flag(place);
+        this->nested_function->add_range_single_place_with_null_map(
+                begin, end, this->nested_place(place), column.get_nested_column(), null_map);
+    }
 };
 
 template <typename NestFuction, bool result_is_nullable>
@@ -31,6 +31,7 @@
 
 #include "agent/be_exec_version_manager.h"
 #include "util/counts.h"
+#include "util/ddsketch.h"
 #include "util/tdigest.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
@@ -316,6 +317,165 @@ public:
     }
 };
 
+struct PercentileDDSketchState {
+    static constexpr double INIT_QUANTILE = -1.0;
+
+    void init(double quantile, double relative_accuracy = DDSketch::DEFAULT_RELATIVE_ACCURACY) {
+        if (!init_flag) {
+            // use the default accuracy if the one specified is out of range
+            if (!DDSketch::is_valid_relative_accuracy(relative_accuracy)) {
+                relative_accuracy = DDSketch::DEFAULT_RELATIVE_ACCURACY;
+            }
+            check_quantile(quantile);
+            sketch = DDSketch(relative_accuracy);
+            target_quantile = quantile;
+            init_flag = true;
+        }
+    }
+
+    void write(BufferWritable& buf) const {
+        write_binary(init_flag, buf);
+        if (!init_flag) {
+            return;
+        }
+
+        write_binary(target_quantile, buf);
+        std::string result(sketch.serialized_size(), '0');
+        sketch.serialize((uint8_t*)result.data());
+        write_binary(result, buf);
+    }
+
+    void read(BufferReadable& buf) {
+        read_binary(init_flag, buf);
+        if (!init_flag) {
+            return;
+        }
+
+        read_binary(target_quantile, buf);
+        std::string str;
+        read_binary(str, buf);
+        if (!sketch.deserialize(Slice(str))) {
+            throw Exception(ErrorCode::CORRUPTION, "invalid ddsketch state of size {}",
+                            str.size());
+        }
+    }
+
+    double get() const { return init_flag ? sketch.quantile(target_quantile) : std::nan(""); }
+
+    void merge(const PercentileDDSketchState& rhs) {
+        if (!rhs.init_flag) {
+            return;
+        }
+        if (init_flag) {
+            sketch.merge(rhs.sketch);
+        } else {
+            sketch = rhs.sketch;
+            init_flag = true;
+        }
+        if (target_quantile == INIT_QUANTILE) {
+            target_quantile = rhs.target_quantile;
+        }
+    }
+
+    void reset() {
+        target_quantile = INIT_QUANTILE;
+        init_flag = false;
+        sketch.clear();
+    }
+
+    bool init_flag = false;
+    DDSketch sketch;
+    double target_quantile = INIT_QUANTILE;
+};
+
+// percentile_ddsketch(value, quantile[, relative_accuracy]), the result is within
+// `relative_accuracy` of the real quantile relatively, which is 0.01 by default.
+template <bool has_accuracy>
+class AggregateFunctionPercentileDDSketch
+        : public IAggregateFunctionDataHelper<PercentileDDSketchState,
+                                              AggregateFunctionPercentileDDSketch<has_accuracy>> {
+public:
+    using Base = IAggregateFunctionDataHelper<PercentileDDSketchState,
+                                              AggregateFunctionPercentileDDSketch<has_accuracy>>;
+
+    AggregateFunctionPercentileDDSketch(const DataTypes& argument_types_)
+            : Base(argument_types_) {}
+
+    String get_name() const override { return "percentile_ddsketch"; }
+
+    DataTypePtr get_return_type() const override { return std::make_shared<DataTypeFloat64>(); }
+
+    void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
+             Arena*) const override {
+        init(place, columns);
+        const auto& sources =
+                assert_cast<const ColumnFloat64&, TypeCheckOnRelease::DISABLE>(*columns[0]);
+        this->data(place).sketch.add(sources.get_element(row_num));
+    }
+
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena*) const override {
+        add_range(place, columns, 0, batch_size);
+    }
+
+    void add_batch_range(size_t batch_begin, size_t batch_end, AggregateDataPtr place,
+                         const IColumn** columns, Arena*, bool has_null) override {
+        add_range(place, columns, batch_begin, batch_end + 1);
+    }
+
+    void reset(AggregateDataPtr __restrict place) const override { this->data(place).reset(); }
+
+    void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
+               Arena*) const override {
+        this->data(place).merge(this->data(rhs));
+    }
+
+    void serialize(ConstAggregateDataPtr __restrict place, BufferWritable& buf) const override {
+        this->data(place).write(buf);
+    }
+
+    void deserialize(AggregateDataPtr __restrict place, BufferReadable& buf,
+                     Arena*) const override {
+        this->data(place).read(buf);
+    }
+
+    void insert_result_into(ConstAggregateDataPtr __restrict place, IColumn& to) const override {
+        auto& col = assert_cast<ColumnFloat64&>(to);
+        double result = this->data(place).get();
+
+        if (std::isnan(result)) {
+            col.insert_default();
+        } else {
+            col.get_data().push_back(result);
+        }
+    }
+
+private:
+    void init(AggregateDataPtr __restrict place, const IColumn** columns) const {
+        const auto& quantile =
+                assert_cast<const ColumnFloat64&, TypeCheckOnRelease::DISABLE>(*columns[1]);
+        if constexpr (has_accuracy) {
+            const auto& accuracy =
+                    assert_cast<const ColumnFloat64&, TypeCheckOnRelease::DISABLE>(*columns[2]);
+            this->data(place).init(quantile.get_element(0), accuracy.get_element(0));
+        } else {
+            this->data(place).init(quantile.get_element(0));
+        }
+    }
+
+    // the values of [begin, end) are added to the sketch at once
+    void add_range(AggregateDataPtr __restrict place, const IColumn** columns, size_t begin,
+                   size_t end) const {
+        if (begin >= end) {
+            return;
+        }
+        init(place, columns);
+        const auto& sources =
+                assert_cast<const ColumnFloat64&, TypeCheckOnRelease::DISABLE>(*columns[0]);
+        this->data(place).sketch.add_batch(sources.get_data().data() + begin, end - begin);
+    }
+};
+
 template <PrimitiveType T>
 struct PercentileState {
     mutable std::vector<Counts<typename PrimitiveTypeTraits<T>::ColumnItemType>> vec_counts;
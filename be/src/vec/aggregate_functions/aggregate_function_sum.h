@@ -100,6 +100,54 @@ public:
                 typename PrimitiveTypeTraits<TResult>::ColumnItemType(column.get_data()[row_num]));
     }
 
+    // The rows in [begin, end) whose null_map is 0 are added. A null row adds a zero instead of
+    // branching, so the loop is vectorized. Used by AggregateFunctionNullUnaryInline.
+    void add_range_single_place_with_null_map(size_t begin, size_t end,
+                                              AggregateDataPtr __restrict place,
+                                              const IColumn& column,
+                                              const UInt8* __restrict null_map) const {
+#ifdef __clang__
+#pragma clang fp reassociate(on)
+#endif
+        using ResultItem = typename PrimitiveTypeTraits<TResult>::ColumnItemType;
+        const auto* __restrict data =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(column)
+                        .get_data()
+                        .data();
+        ResultItem sum {};
+        for (size_t i = begin; i < end; ++i) {
+            sum += null_map[i] ? ResultItem {} : ResultItem(data[i]);
+        }
+        this->data(place).add(sum);
+    }
+
+    void add_batch_with_null_map(size_t batch_size, AggregateDataPtr* __restrict places,
+                                 size_t place_offset, const IColumn& column,
+                                 const UInt8* __restrict null_map) const {
+        using ResultItem = typename PrimitiveTypeTraits<TResult>::ColumnItemType;
+        const auto* __restrict data =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(column)
+                        .get_data()
+                        .data();
+        for (size_t i = 0; i < batch_size; ++i) {
+            this->data(places[i] + place_offset)
+                    .add(null_map[i] ? ResultItem {} : ResultItem(data[i]));
+        }
+    }
+
+    // Removing rows from a floating point sum would not give the result of adding the others.
+    bool supports_remove() const override { return !is_float_or_double(TResult); }
+
+    void remove_range_single_place(int64_t frame_start, int64_t frame_end, AggregateDataPtr place,
+                                   const IColumn** columns, Arena*) const override {
+        using ResultItem = typename PrimitiveTypeTraits<TResult>::ColumnItemType;
+        const auto& data =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(*columns[0]).get_data();
+        for (int64_t i = frame_start; i < frame_end; ++i) {
+            this->data(place).sum -= ResultItem(data[i]);
+        }
+    }
+
     void reset(AggregateDataPtr place) const override { this->data(place).sum = {}; }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
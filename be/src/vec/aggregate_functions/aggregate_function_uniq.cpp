@@ -22,6 +22,7 @@
 
 #include <string>
 
+#include "agent/be_exec_version_manager.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/aggregate_functions/helpers.h"
 #include "vec/common/hash_table/hash.h" // IWYU pragma: keep
@@ -79,10 +80,42 @@ AggregateFunctionPtr create_aggregate_function_uniq(const std::string& name,
     return nullptr;
 }
 
+AggregateFunctionPtr create_aggregate_function_uniq_exact(const std::string& name,
+                                                          const DataTypes& argument_types,
+                                                          const bool result_is_nullable,
+                                                          const AggregateFunctionAttr& attr) {
+    if (argument_types.size() == 1) {
+        switch (argument_types[0]->get_primitive_type()) {
+        case TYPE_TINYINT:
+            return creator_without_type::create<AggregateFunctionUniqBitmap<TYPE_TINYINT>>(
+                    argument_types, result_is_nullable);
+        case TYPE_SMALLINT:
+            return creator_without_type::create<AggregateFunctionUniqBitmap<TYPE_SMALLINT>>(
+                    argument_types, result_is_nullable);
+        case TYPE_INT:
+            return creator_without_type::create<AggregateFunctionUniqBitmap<TYPE_INT>>(
+                    argument_types, result_is_nullable);
+        case TYPE_BIGINT:
+            return creator_without_type::create<AggregateFunctionUniqBitmap<TYPE_BIGINT>>(
+                    argument_types, result_is_nullable);
+        default:
+            break;
+        }
+    }
+    return create_aggregate_function_uniq<AggregateFunctionUniqExactData>(
+            name, argument_types, result_is_nullable, attr);
+}
+
 void register_aggregate_function_uniq(AggregateFunctionSimpleFactory& factory) {
-    AggregateFunctionCreator creator =
+    factory.register_function_both("multi_distinct_count", create_aggregate_function_uniq_exact);
+
+    // Before ADAPTIVE_UNIQ_EXACT, the integers were kept in a hash set with another state format.
+    AggregateFunctionCreator old_creator =
             create_aggregate_function_uniq<AggregateFunctionUniqExactData>;
-    factory.register_function_both("multi_distinct_count", creator);
+    factory.register_alternative_function("multi_distinct_count", old_creator, false,
+                                          ADAPTIVE_UNIQ_EXACT - 1);
+    factory.register_alternative_function("multi_distinct_count", old_creator, true,
+                                          ADAPTIVE_UNIQ_EXACT - 1);
 }
 
 } // namespace doris::vectorized
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "util/bitmap_value.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_vector.h"
@@ -38,6 +39,7 @@
 #include "vec/common/string_ref.h"
 #include "vec/common/uint128.h"
 #include "vec/core/types.h"
+#include "vec/data_types/data_type_bitmap.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/io/io_helper.h"
 #include "vec/io/var_int.h"
@@ -228,6 +230,195 @@ public:
     }
 };
 
+/// uniqExact of integers. The distinct values are kept in a small sorted array, which turns into a
+/// roaring bitmap once it holds more than SMALL_SIZE values. So a group with few values stays
+/// cheap, and dense groups take far less memory than a hash set and merge by a bitmap OR.
+/// Signed values are stored by their bit pattern in the unsigned type of the same width.
+template <PrimitiveType T>
+struct AggregateFunctionUniqBitmapData {
+    using Key = typename PrimitiveTypeTraits<T>::CppNativeType;
+    static_assert(std::is_integral_v<Key>);
+
+    static constexpr size_t SMALL_SIZE = 64;
+
+    std::vector<UInt64> small;
+    BitmapValue bitmap;
+    bool is_bitmap = false;
+
+    static String get_name() { return "multi_distinct"; }
+
+    static UInt64 ALWAYS_INLINE to_value(Key key) {
+        return static_cast<UInt64>(static_cast<std::make_unsigned_t<Key>>(key));
+    }
+
+    void ALWAYS_INLINE add(UInt64 value) {
+        if (is_bitmap) {
+            bitmap.add(value);
+            return;
+        }
+        auto it = std::lower_bound(small.begin(), small.end(), value);
+        if (it != small.end() && *it == value) {
+            return;
+        }
+        small.insert(it, value);
+        if (small.size() > SMALL_SIZE) {
+            convert_to_bitmap();
+        }
+    }
+
+    void add_many(const Key* keys, size_t count) {
+        size_t i = 0;
+        for (; i < count && !is_bitmap; ++i) {
+            add(to_value(keys[i]));
+        }
+        if (i < count) {
+            std::vector<UInt64> values(count - i);
+            for (size_t j = 0; j < values.size(); ++j) {
+                values[j] = to_value(keys[i + j]);
+            }
+            bitmap.add_many(values.data(), values.size());
+        }
+    }
+
+    void merge(const AggregateFunctionUniqBitmapData& rhs) {
+        if (rhs.is_bitmap) {
+            if (is_bitmap) {
+                bitmap |= rhs.bitmap;
+                return;
+            }
+            BitmapValue merged = rhs.bitmap;
+            if (!small.empty()) {
+                merged.add_many(small.data(), small.size());
+            }
+            bitmap = std::move(merged);
+            std::vector<UInt64>().swap(small);
+            is_bitmap = true;
+        } else if (is_bitmap) {
+            if (!rhs.small.empty()) {
+                bitmap.add_many(rhs.small.data(), rhs.small.size());
+            }
+        } else if (!rhs.small.empty()) {
+            std::vector<UInt64> merged;
+            merged.reserve(small.size() + rhs.small.size());
+            std::set_union(small.begin(), small.end(), rhs.small.begin(), rhs.small.end(),
+                           std::back_inserter(merged));
+            small.swap(merged);
+            if (small.size() > SMALL_SIZE) {
+                convert_to_bitmap();
+            }
+        }
+    }
+
+    // The small array is written as deltas of the sorted values, the bitmap in its own format.
+    void write(BufferWritable& buf) const {
+        write_binary(is_bitmap, buf);
+        if (is_bitmap) {
+            DataTypeBitMap::serialize_as_stream(bitmap, buf);
+            return;
+        }
+        write_var_uint(small.size(), buf);
+        UInt64 prev = 0;
+        for (auto value : small) {
+            write_var_uint(value - prev, buf);
+            prev = value;
+        }
+    }
+
+    void read(BufferReadable& buf) {
+        reset();
+        read_binary(is_bitmap, buf);
+        if (is_bitmap) {
+            DataTypeBitMap::deserialize_as_stream(bitmap, buf);
+            return;
+        }
+        UInt64 size = 0;
+        read_var_uint(size, buf);
+        small.resize(size);
+        UInt64 prev = 0;
+        for (auto& value : small) {
+            UInt64 delta = 0;
+            read_var_uint(delta, buf);
+            value = prev + delta;
+            prev = value;
+        }
+    }
+
+    UInt64 size() const { return is_bitmap ? bitmap.cardinality() : small.size(); }
+
+    void reset() {
+        std::vector<UInt64>().swap(small);
+        bitmap.reset();
+        is_bitmap = false;
+    }
+
+private:
+    void convert_to_bitmap() {
+        // The values are sorted, which is the fast path of the roaring bulk insertion.
+        bitmap.add_many(small.data(), small.size());
+        std::vector<UInt64>().swap(small);
+        is_bitmap = true;
+    }
+};
+
+/// multi_distinct_count of TINYINT, SMALLINT, INT and BIGINT on AggregateFunctionUniqBitmapData.
+template <PrimitiveType T>
+class AggregateFunctionUniqBitmap final
+        : public IAggregateFunctionDataHelper<AggregateFunctionUniqBitmapData<T>,
+                                              AggregateFunctionUniqBitmap<T>> {
+public:
+    using Data = AggregateFunctionUniqBitmapData<T>;
+    using ColumnType = typename PrimitiveTypeTraits<T>::ColumnType;
+
+    AggregateFunctionUniqBitmap(const DataTypes& argument_types_)
+            : IAggregateFunctionDataHelper<Data, AggregateFunctionUniqBitmap<T>>(argument_types_) {
+    }
+
+    String get_name() const override { return Data::get_name(); }
+
+    DataTypePtr get_return_type() const override { return std::make_shared<DataTypeInt64>(); }
+
+    void reset(AggregateDataPtr __restrict place) const override { this->data(place).reset(); }
+
+    void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
+             Arena*) const override {
+        const auto& column =
+                assert_cast<const ColumnType&, TypeCheckOnRelease::DISABLE>(*columns[0]);
+        this->data(place).add(Data::to_value(column.get_data()[row_num]));
+    }
+
+    void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
+                   const IColumn** columns, Arena*, bool /*agg_many*/) const override {
+        const auto* keys = assert_cast<const ColumnType&>(*columns[0]).get_data().data();
+        for (size_t i = 0; i != batch_size; ++i) {
+            this->data(places[i] + place_offset).add(Data::to_value(keys[i]));
+        }
+    }
+
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena*) const override {
+        const auto* keys = assert_cast<const ColumnType&>(*columns[0]).get_data().data();
+        this->data(place).add_many(keys, batch_size);
+    }
+
+    void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
+               Arena*) const override {
+        this->data(place).merge(this->data(rhs));
+    }
+
+    void serialize(ConstAggregateDataPtr __restrict place, BufferWritable& buf) const override {
+        this->data(place).write(buf);
+    }
+
+    void deserialize(AggregateDataPtr __restrict place, BufferReadable& buf,
+                     Arena*) const override {
+        this->data(place).read(buf);
+    }
+
+    void insert_result_into(ConstAggregateDataPtr __restrict place, IColumn& to) const override {
+        assert_cast<ColumnInt64&>(to).get_data().push_back(this->data(place).size());
+    }
+};
+
 } // namespace doris::vectorized
 
 #include "common/compile_check_end.h"
@@ -28,6 +28,7 @@
 #include "runtime/decimalv2_value.h"
 #include "util/hash_util.hpp"
 #include "util/simd/bits.h"
+#include "util/simd/compress_store.h"
 #include "vec/columns/columns_common.h"
 #include "vec/common/arena.h"
 #include "vec/common/assert_cast.h"
@@ -142,7 +143,7 @@ void ColumnDecimal<T>::update_crc_with_value(size_t start, size_t end, uint32_t&
     if (null_data == nullptr) {
         for (size_t i = start; i < end; i++) {
             if constexpr (T != TYPE_DECIMALV2) {
-                hash = HashUtil::zlib_crc_hash(&data[i], sizeof(value_type), hash);
+                hash = HashUtil::zlib_crc_hash_fixed<sizeof(value_type)>(&data[i], hash);
             } else {
                 decimalv2_do_crc(i, hash);
             }
@@ -151,7 +152,7 @@ void ColumnDecimal<T>::update_crc_with_value(size_t start, size_t end, uint32_t&
         for (size_t i = start; i < end; i++) {
             if (null_data[i] == 0) {
                 if constexpr (T != TYPE_DECIMALV2) {
-                    hash = HashUtil::zlib_crc_hash(&data[i], sizeof(value_type), hash);
+                    hash = HashUtil::zlib_crc_hash_fixed<sizeof(value_type)>(&data[i], hash);
                 } else {
                     decimalv2_do_crc(i, hash);
                 }
@@ -170,12 +171,13 @@ void ColumnDecimal<T>::update_crcs_with_value(uint32_t* __restrict hashes, Primi
     if constexpr (T != TYPE_DECIMALV2) {
         if (null_data == nullptr) {
             for (size_t i = 0; i < s; i++) {
-                hashes[i] = HashUtil::zlib_crc_hash(&data[i], sizeof(value_type), hashes[i]);
+                hashes[i] = HashUtil::zlib_crc_hash_fixed<sizeof(value_type)>(&data[i], hashes[i]);
             }
         } else {
+            // the null rows are hashed by ColumnNullable, keep them by a select
             for (size_t i = 0; i < s; i++) {
-                if (null_data[i] == 0)
-                    hashes[i] = HashUtil::zlib_crc_hash(&data[i], sizeof(value_type), hashes[i]);
+                auto hash = HashUtil::zlib_crc_hash_fixed<sizeof(value_type)>(&data[i], hashes[i]);
+                hashes[i] = null_data[i] ? hashes[i] : hash;
             }
         }
     } else {
@@ -363,8 +365,13 @@ ColumnPtr ColumnDecimal<T>::filter(const IColumn::Filter& filt, ssize_t result_s
         } else if (simd::bits_mask_all() == mask) {
             res_data.insert(data_pos, data_pos + SIMD_BYTES);
         } else {
-            simd::iterate_through_bits_mask(
-                    [&](const size_t bit_pos) { res_data.push_back(data_pos[bit_pos]); }, mask);
+            res_data.reserve(res_data.size() + SIMD_BYTES);
+            if (auto* res_end = simd::compress_store(data_pos, mask, res_data.end())) {
+                res_data.resize_assume_reserved(res_end - res_data.begin());
+            } else {
+                simd::iterate_through_bits_mask(
+                        [&](const size_t bit_pos) { res_data.push_back(data_pos[bit_pos]); }, mask);
+            }
         }
 
         filt_pos += SIMD_BYTES;
@@ -406,6 +413,9 @@ size_t ColumnDecimal<T>::filter(const IColumn::Filter& filter) {
         } else if (simd::bits_mask_all() == mask) {
             memmove(result_data, data_pos, sizeof(value_type) * SIMD_BYTES);
             result_data += SIMD_BYTES;
+        } else if (auto* res_end = simd::compress_store(data_pos, mask, result_data)) {
+            // the values are loaded before stored, so it's fine that result_data overlaps them
+            result_data = res_end;
         } else {
             simd::iterate_through_bits_mask(
                     [&](const size_t idx) {
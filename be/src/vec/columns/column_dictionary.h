@@ -20,6 +20,7 @@
 #include <parallel_hashmap/phmap.h>
 
 #include <algorithm>
+#include <atomic>
 
 #include "vec/columns/column.h"
 #include "vec/columns/column_string.h"
@@ -209,6 +210,7 @@ public:
      * Just insert dictionary data items, the items will append into _dict.
      */
     void insert_many_dict_data(const StringRef* dict_array, uint32_t dict_num) {
+        _dict_id = _next_dict_id();
         _dict.reserve(_dict.size() + dict_num);
         for (uint32_t i = 0; i < dict_num; ++i) {
             auto value = StringRef(dict_array[i].data, dict_array[i].size);
@@ -220,6 +222,7 @@ public:
                                const StringRef* dict_array, size_t data_num,
                                uint32_t dict_num) override {
         if (_dict.empty()) {
+            _dict_id = _next_dict_id();
             _dict.reserve(dict_num);
             for (uint32_t i = 0; i < dict_num; ++i) {
                 auto value = StringRef(dict_array[i].data, dict_array[i].size);
@@ -243,6 +246,7 @@ public:
         if (!is_dict_sorted()) {
             _dict.sort();
             _dict_sorted = true;
+            _dict_id = _next_dict_id();
         }
 
         if (!is_dict_code_converted()) {
@@ -321,6 +325,10 @@ public:
 
     size_t dict_size() const { return _dict.size(); }
 
+    // Identifies the dictionary the codes refer to, it changes when the dictionary is filled
+    // or sorted. 0 means no dictionary.
+    uint64_t dict_id() const { return _dict_id; }
+
     std::string dict_debug_string() const { return _dict.debug_string(); }
 
     class Dictionary {
@@ -511,8 +519,14 @@ public:
     };
 
 private:
+    static uint64_t _next_dict_id() {
+        static std::atomic<uint64_t> s_dict_id {0};
+        return ++s_dict_id;
+    }
+
     size_t _reserve_size;
     bool _dict_sorted = false;
+    uint64_t _dict_id = 0;
     bool _dict_code_converted = false;
     Dictionary _dict;
     Container _codes;
@@ -29,6 +29,7 @@
 
 #include "util/hash_util.hpp"
 #include "util/simd/bits.h"
+#include "util/simd/compress_store.h"
 #include "vec/columns/columns_common.h"
 #include "vec/common/arena.h"
 #include "vec/common/assert_cast.h"
@@ -207,18 +208,17 @@ void ColumnVector<T>::update_crcs_with_value(uint32_t* __restrict hashes, Primit
             }
         }
     } else {
+        constexpr auto bytes = sizeof(typename PrimitiveTypeTraits<T>::ColumnItemType);
         if (null_data == nullptr) {
             for (size_t i = 0; i < s; i++) {
-                hashes[i] = HashUtil::zlib_crc_hash(
-                        &data[i], sizeof(typename PrimitiveTypeTraits<T>::ColumnItemType),
-                        hashes[i]);
+                hashes[i] = HashUtil::zlib_crc_hash_fixed<bytes>(&data[i], hashes[i]);
             }
         } else {
+            // the null rows are hashed by ColumnNullable, they are kept by a select rather than
+            // a branch, so the hashes of all the rows are computed in the same pipeline
             for (size_t i = 0; i < s; i++) {
-                if (null_data[i] == 0)
-                    hashes[i] = HashUtil::zlib_crc_hash(
-                            &data[i], sizeof(typename PrimitiveTypeTraits<T>::ColumnItemType),
-                            hashes[i]);
+                auto hash = HashUtil::zlib_crc_hash_fixed<bytes>(&data[i], hashes[i]);
+                hashes[i] = null_data[i] ? hashes[i] : hash;
             }
         }
     }
@@ -359,9 +359,16 @@ ColumnPtr ColumnVector<T>::filter(const IColumn::Filter& filt, ssize_t result_si
         } else if (simd::bits_mask_all() == mask) {
             res_data.insert(data_pos, data_pos + SIMD_BYTES);
         } else {
-            simd::iterate_through_bits_mask(
-                    [&](const size_t idx) { res_data.push_back_without_reserve(data_pos[idx]); },
-                    mask);
+            // res_data is reserved for all the values, as push_back_without_reserve() needs
+            if (auto* res_end = simd::compress_store(data_pos, mask, res_data.end())) {
+                res_data.resize_assume_reserved(res_end - res_data.begin());
+            } else {
+                simd::iterate_through_bits_mask(
+                        [&](const size_t idx) {
+                            res_data.push_back_without_reserve(data_pos[idx]);
+                        },
+                        mask);
+            }
         }
 
         filt_pos += SIMD_BYTES;
@@ -405,6 +412,9 @@ size_t ColumnVector<T>::filter(const IColumn::Filter& filter) {
         } else if (simd::bits_mask_all() == mask) {
             memmove(result_data, data_pos, sizeof(value_type) * SIMD_BYTES);
             result_data += SIMD_BYTES;
+        } else if (auto* res_end = simd::compress_store(data_pos, mask, result_data)) {
+            // the values are loaded before stored, so it's fine that result_data overlaps them
+            result_data = res_end;
         } else {
             simd::iterate_through_bits_mask(
                     [&](const size_t idx) {
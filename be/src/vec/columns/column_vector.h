@@ -279,7 +279,7 @@ public:
             hash = HashUtil::zlib_crc_hash(buf, len, hash);
 
         } else {
-            hash = HashUtil::zlib_crc_hash(&data[idx], sizeof(value_type), hash);
+            hash = HashUtil::zlib_crc_hash_fixed<sizeof(value_type)>(&data[idx], hash);
         }
     }
 
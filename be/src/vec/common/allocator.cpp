@@ -17,6 +17,7 @@
 
 #include "vec/common/allocator.h"
 
+#include <bvar/bvar.h>
 #include <glog/logging.h>
 
 #include <atomic>
@@ -45,6 +46,61 @@ namespace doris {
 std::unordered_map<void*, size_t> RecordSizeMemoryAllocator::_allocated_sizes;
 std::mutex RecordSizeMemoryAllocator::_mutex;
 
+static bvar::Adder<int64_t> memory_huge_page_allocated_bytes("memory_huge_page_allocated_bytes");
+
+static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+static bool use_huge_page(size_t size) {
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+    return doris::config::mmap_huge_page_threshold >= 0 &&
+           size >= static_cast<size_t>(doris::config::mmap_huge_page_threshold);
+#else
+    return false;
+#endif
+}
+
+// Touch the pages after madvise, MAP_POPULATE would fault them in as the normal pages.
+static void prefault(void* buf, size_t size) {
+#if defined(MADV_POPULATE_WRITE)
+    if (0 == madvise(buf, size, MADV_POPULATE_WRITE)) {
+        return;
+    }
+#endif
+    auto* pages = reinterpret_cast<volatile char*>(buf);
+    for (size_t offset = 0; offset < size; offset += MMAP_MIN_ALIGNMENT) {
+        pages[offset] = 0;
+    }
+}
+
+// Maps the memory aligned to the huge page size by over-mapping and trimming both ends, so the
+// kernel can back all of it by the huge pages.
+static void* mmap_huge_page(size_t size, bool populate) {
+    const size_t map_size = size + HUGE_PAGE_SIZE;
+    void* raw = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == raw) {
+        return raw;
+    }
+    auto* begin = reinterpret_cast<char*>(raw);
+    auto* buf = reinterpret_cast<char*>(
+            (reinterpret_cast<uintptr_t>(begin) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1));
+    auto* end = buf + (size + MMAP_MIN_ALIGNMENT - 1) / MMAP_MIN_ALIGNMENT * MMAP_MIN_ALIGNMENT;
+    if (buf > begin) {
+        munmap(begin, buf - begin);
+    }
+    if (begin + map_size > end) {
+        munmap(end, begin + map_size - end);
+    }
+#if defined(MADV_HUGEPAGE)
+    // the memory still works with the normal pages if THP is disabled
+    madvise(buf, size, MADV_HUGEPAGE);
+#endif
+    if (populate) {
+        prefault(buf, size);
+    }
+    memory_huge_page_allocated_bytes << static_cast<int64_t>(size);
+    return buf;
+}
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator>
 bool Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::sys_memory_exceed(
         size_t size, std::string* err_msg) const {
@@ -303,7 +359,11 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::alloc(
                     size);
         }
 
-        buf = mmap(nullptr, size, PROT_READ | PROT_WRITE, mmap_flags, -1, 0);
+        if (use_huge_page(size)) {
+            buf = mmap_huge_page(size, mmap_populate);
+        } else {
+            buf = mmap(nullptr, size, PROT_READ | PROT_WRITE, mmap_flags, -1, 0);
+        }
         if (MAP_FAILED == buf) {
             release_memory(size);
             throw_bad_alloc(fmt::format("Allocator: Cannot mmap {}.", size));
@@ -361,6 +421,9 @@ void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::free(vo
         if (0 != munmap(buf, size)) {
             throw_bad_alloc(fmt::format("Allocator: Cannot munmap {}.", size));
         }
+        if (use_huge_page(size)) {
+            memory_huge_page_allocated_bytes << -static_cast<int64_t>(size);
+        }
     } else {
         remove_address_sanitizers(buf, size);
         MemoryAllocator::free(buf);
@@ -420,6 +483,17 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::reallo
 
         /// No need for zero-fill, because mmap guarantees it.
 
+        // the moved pages keep the advice, advise the whole range for the new pages
+        if (use_huge_page(new_size)) {
+#if defined(MADV_HUGEPAGE)
+            madvise(buf, new_size, MADV_HUGEPAGE);
+#endif
+            memory_huge_page_allocated_bytes << static_cast<int64_t>(new_size);
+        }
+        if (use_huge_page(old_size)) {
+            memory_huge_page_allocated_bytes << -static_cast<int64_t>(old_size);
+        }
+
         if constexpr (mmap_populate) {
             // MAP_POPULATE seems have no effect for mremap as for mmap,
             // Clear enlarged memory range explicitly to pre-fault the pages
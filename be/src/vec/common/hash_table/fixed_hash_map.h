@@ -0,0 +1,287 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <boost/noncopyable.hpp>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "common/compiler_util.h"
+#include "vec/common/allocator.h"
+
+template <typename Key, typename Mapped>
+struct FixedHashMapCell {
+    Mapped mapped;
+};
+
+template <typename Key, typename Mapped>
+ALWAYS_INLINE inline auto lookup_result_get_mapped(FixedHashMapCell<Key, Mapped>* it) {
+    return &(it->mapped);
+}
+
+/// A map for 8 and 16 bit keys, where every possible key owns a cell of an array indexed by the
+/// key itself. There is no hashing, probing or rehashing, the hash of a key is the key.
+///
+/// The array (2KB for UInt8 keys and 512KB for UInt16 keys of pointers) is allocated on the first
+/// insertion, and a bitmap tracks the used cells, so iteration happens in key order.
+/// It has the interface of PHHashMap, so it can replace it in the hash methods.
+template <typename Key, typename Mapped>
+class FixedHashMap : private boost::noncopyable,
+                     private Allocator<true, false, false, DefaultMemoryAllocator> {
+    static_assert(std::is_unsigned_v<Key> && sizeof(Key) <= sizeof(uint16_t));
+
+public:
+    using Self = FixedHashMap;
+    using cell_type = FixedHashMapCell<Key, Mapped>;
+
+    using key_type = Key;
+    using mapped_type = Mapped;
+    using Value = Mapped;
+    using value_type = std::pair<const Key, Mapped>;
+
+    using LookupResult = cell_type*;
+    using ConstLookupResult = const cell_type*;
+
+    static constexpr size_t NUM_CELLS = size_t(1) << (sizeof(Key) * 8);
+    static constexpr size_t NUM_WORDS = NUM_CELLS / 64;
+    static constexpr size_t BUFFER_SIZE = NUM_CELLS * sizeof(cell_type) + NUM_WORDS * 8;
+
+    FixedHashMap() = default;
+
+    FixedHashMap(size_t /*reserve_for_num_elements*/) {}
+
+    FixedHashMap(FixedHashMap&& other) { *this = std::move(other); }
+
+    FixedHashMap& operator=(FixedHashMap&& rhs) {
+        clear_and_shrink();
+        std::swap(_cells, rhs._cells);
+        std::swap(_bitmap, rhs._bitmap);
+        std::swap(_size, rhs._size);
+        return *this;
+    }
+
+    ~FixedHashMap() { clear_and_shrink(); }
+
+    template <typename Derived, bool is_const>
+    class iterator_base {
+        using Container = std::conditional_t<is_const, const Self, Self>;
+
+        Container* container = nullptr;
+        size_t idx = NUM_CELLS;
+        friend class FixedHashMap;
+
+    public:
+        iterator_base() {}
+        iterator_base(Container* container_, size_t idx_) : container(container_), idx(idx_) {}
+
+        bool operator==(const iterator_base& rhs) const { return idx == rhs.idx; }
+        bool operator!=(const iterator_base& rhs) const { return idx != rhs.idx; }
+
+        Derived& operator++() {
+            idx = container->_next_used(idx + 1);
+            return static_cast<Derived&>(*this);
+        }
+
+        auto& operator*() const { return *this; }
+        auto* operator->() const { return this; }
+
+        auto& operator*() { return *this; }
+        auto* operator->() { return this; }
+
+        Key get_first() const { return static_cast<Key>(idx); }
+
+        const auto& get_second() const { return container->_cells[idx].mapped; }
+
+        auto& get_second() { return container->_cells[idx].mapped; }
+
+        auto get_ptr() const { return this; }
+        size_t get_hash() const { return idx; }
+    };
+
+    class iterator : public iterator_base<iterator, false> {
+    public:
+        using iterator_base<iterator, false>::iterator_base;
+    };
+
+    class const_iterator : public iterator_base<const_iterator, true> {
+    public:
+        using iterator_base<const_iterator, true>::iterator_base;
+    };
+
+    const_iterator begin() const { return const_iterator(this, _next_used(0)); }
+    const_iterator cbegin() const { return begin(); }
+    iterator begin() { return iterator(this, _next_used(0)); }
+
+    const_iterator end() const { return const_iterator(this, NUM_CELLS); }
+    const_iterator cend() const { return end(); }
+    iterator end() { return iterator(this, NUM_CELLS); }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key, LookupResult& it, bool& inserted) {
+        _alloc_if_needed();
+        const size_t idx = static_cast<Key>(key);
+        it = &_cells[idx];
+        inserted = !_is_used(idx);
+        if (inserted) {
+            it->mapped = Mapped();
+            _set_used(idx);
+        }
+    }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key, LookupResult& it, bool& inserted,
+                               size_t /*hash_value*/) {
+        emplace(key, it, inserted);
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key, LookupResult& it, Func&& f) {
+        _alloc_if_needed();
+        const size_t idx = static_cast<Key>(key);
+        it = &_cells[idx];
+        if (!_is_used(idx)) {
+            f([&](const auto& /*key*/, auto&& mapped) { it->mapped = mapped; }, key);
+            // Mark the cell after the creator, a creator that throws leaves the map unchanged.
+            _set_used(idx);
+        }
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key, LookupResult& it, size_t /*hash_value*/,
+                                    Func&& f) {
+        _alloc_if_needed();
+        const size_t idx = static_cast<Key>(key);
+        it = &_cells[idx];
+        if (!_is_used(idx)) {
+            f([&](const auto& /*key*/, auto&& mapped) { it->mapped = mapped; }, key, key);
+            _set_used(idx);
+        }
+    }
+
+    void ALWAYS_INLINE insert(const Key& key, const Mapped& value) {
+        LookupResult it;
+        bool inserted;
+        emplace(key, it, inserted);
+        if (inserted) {
+            it->mapped = value;
+        }
+    }
+
+    void insert(const iterator& other_iter) {
+        insert(other_iter->get_first(), other_iter->get_second());
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key) {
+        const size_t idx = static_cast<Key>(key);
+        return _cells != nullptr && _is_used(idx) ? &_cells[idx] : nullptr;
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key, size_t /*hash_value*/) {
+        return find(key);
+    }
+
+    size_t hash(const Key& x) const { return x; }
+
+    template <bool read>
+    void ALWAYS_INLINE prefetch(const Key& key, size_t /*hash_value*/) {
+        if (_cells != nullptr) {
+            __builtin_prefetch(&_cells[key], !read);
+        }
+    }
+
+    /// Call func(Mapped &) for each hash map element.
+    template <typename Func>
+    void for_each_mapped(Func&& func) {
+        for (auto& v : *this) func(v.get_second());
+    }
+
+    size_t get_buffer_size_in_bytes() const { return _cells != nullptr ? BUFFER_SIZE : 0; }
+
+    // Only the first insertion allocates memory.
+    bool add_elem_size_overflow(size_t /*row*/) const { return _cells == nullptr; }
+
+    size_t estimate_memory(size_t /*num_elem*/) const {
+        return _cells == nullptr ? BUFFER_SIZE : 0;
+    }
+
+    size_t size() const { return _size; }
+    template <typename MappedType>
+    char* get_null_key_data() {
+        return nullptr;
+    }
+    bool has_null_key_data() const { return false; }
+
+    bool empty() const { return _size == 0; }
+
+    void clear() {
+        if (_cells != nullptr) {
+            memset(_bitmap, 0, NUM_WORDS * sizeof(uint64_t));
+        }
+        _size = 0;
+    }
+
+    void clear_and_shrink() {
+        if (_cells != nullptr) {
+            Allocator::free(_cells, BUFFER_SIZE);
+            _cells = nullptr;
+            _bitmap = nullptr;
+        }
+        _size = 0;
+    }
+
+    void reserve(size_t /*num_elem*/) {}
+
+private:
+    void ALWAYS_INLINE _alloc_if_needed() {
+        if (UNLIKELY(_cells == nullptr)) {
+            // The allocator clears the memory, so the bitmap starts empty.
+            _cells = static_cast<cell_type*>(Allocator::alloc(BUFFER_SIZE));
+            _bitmap = reinterpret_cast<uint64_t*>(_cells + NUM_CELLS);
+        }
+    }
+
+    bool ALWAYS_INLINE _is_used(size_t idx) const { return (_bitmap[idx / 64] >> (idx % 64)) & 1; }
+
+    void ALWAYS_INLINE _set_used(size_t idx) {
+        _bitmap[idx / 64] |= uint64_t(1) << (idx % 64);
+        ++_size;
+    }
+
+    // The first used cell at or after idx, NUM_CELLS if there is none.
+    size_t _next_used(size_t idx) const {
+        if (_cells == nullptr) {
+            return NUM_CELLS;
+        }
+        while (idx < NUM_CELLS) {
+            uint64_t word = _bitmap[idx / 64] >> (idx % 64);
+            if (word != 0) {
+                return idx + __builtin_ctzll(word);
+            }
+            idx = (idx / 64 + 1) * 64;
+        }
+        return NUM_CELLS;
+    }
+
+    cell_type* _cells = nullptr;
+    uint64_t* _bitmap = nullptr;
+    size_t _size = 0;
+};
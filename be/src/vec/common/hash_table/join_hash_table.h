@@ -28,6 +28,30 @@
 #include "vec/common/hash_table/hash.h"
 
 namespace doris {
+// Whether each build row has been matched, one bit per row to keep the per row overhead of the
+// hash table small for outer/semi/anti joins on the build side.
+class JoinVisitedFlags {
+public:
+    void resize(size_t size) {
+        _size = size;
+        _words.resize((size + 63) / 64);
+    }
+
+    size_t size() const { return _size; }
+
+    size_t byte_size() const { return _words.capacity() * sizeof(uint64_t); }
+
+    bool test(size_t i) const { return (_words[i >> 6] >> (i & 63)) & 1; }
+
+    void set(size_t i) { _words[i >> 6] |= uint64_t(1) << (i & 63); }
+
+    void set_if(size_t i, bool value) { _words[i >> 6] |= uint64_t(value) << (i & 63); }
+
+private:
+    DorisVector<uint64_t> _words;
+    size_t _size = 0;
+};
+
 template <typename Key, typename Hash = DefaultHash<Key>>
 class JoinHashTable {
 public:
@@ -44,7 +68,7 @@ public:
 
     size_t get_byte_size() const {
         auto cal_vector_mem = [](const auto& vec) { return vec.capacity() * sizeof(vec[0]); };
-        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next);
+        return visited.byte_size() + cal_vector_mem(first) + cal_vector_mem(next);
     }
 
     template <int JoinOpType>
@@ -70,10 +94,16 @@ public:
 
     size_t size() const { return next.size(); }
 
-    DorisVector<uint8_t>& get_visited() { return visited; }
+    JoinVisitedFlags& get_visited() { return visited; }
 
     bool empty_build_side() const { return _empty_build_side; }
 
+    // Prefetch the chain heads and the build rows of the following probe rows. Only pays off
+    // when the table does not fit in the cache, see `hash_join_probe_prefetch_min_table_bytes`.
+    void set_prefetch_build_rows(bool prefetch) { _prefetch_build_rows = prefetch; }
+
+    bool prefetch_build_rows() const { return _prefetch_build_rows; }
+
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums, size_t num_elem,
                bool keep_null_key) {
         build_keys = keys;
@@ -82,6 +112,26 @@ public:
             next[i] = first[bucket_num];
             first[bucket_num] = i;
         }
+        finish_build(keys, keep_null_key);
+    }
+
+    // Inserts the rows whose bucket is in [begin_bucket, end_bucket). The chains of disjoint
+    // bucket ranges do not share any `first` or `next` entry, so the ranges can be built
+    // concurrently, and the chains are the same as the ones of `build`.
+    // `finish_build` must be called once all the ranges are built.
+    void build_bucket_range(const uint32_t* __restrict bucket_nums, size_t num_elem,
+                            uint32_t begin_bucket, uint32_t end_bucket) {
+        for (size_t i = 1; i < num_elem; i++) {
+            uint32_t bucket_num = bucket_nums[i];
+            if (bucket_num >= begin_bucket && bucket_num < end_bucket) {
+                next[i] = first[bucket_num];
+                first[bucket_num] = i;
+            }
+        }
+    }
+
+    void finish_build(const Key* keys, bool keep_null_key) {
+        build_keys = keys;
         if (!keep_null_key) {
             first[bucket_size] = 0; // index = bucket_size means null
         }
@@ -186,7 +236,7 @@ public:
         build_idxs.resize(batch_size);
 
         while (count < batch_size && iter_idx < elem_num) {
-            const auto matched = visited[iter_idx];
+            const auto matched = visited.test(iter_idx);
             build_idxs.get_element(count) = iter_idx;
             if constexpr (JoinOpType == TJoinOp::RIGHT_SEMI_JOIN) {
                 if constexpr (is_mark_join) {
@@ -210,12 +260,52 @@ public:
     bool keep_null_key() { return _keep_null_key; }
 
     void pre_build_idxs(DorisVector<uint32_t>& buckets) const {
+        if (_prefetch_build_rows) {
+            // Group prefetching: issue the loads of a whole group of chain heads before resolving
+            // any of them, so that their cache misses overlap.
+            const size_t num_buckets = buckets.size();
+            for (size_t begin = 0; begin < num_buckets; begin += HASH_MAP_PREFETCH_DIST) {
+                const size_t end = std::min(begin + HASH_MAP_PREFETCH_DIST, num_buckets);
+                for (size_t i = begin; i < end; i++) {
+                    __builtin_prefetch(&first[buckets[i]]);
+                }
+                for (size_t i = begin; i < end; i++) {
+                    buckets[i] = first[buckets[i]];
+                }
+            }
+            return;
+        }
         for (unsigned int& bucket : buckets) {
             bucket = first[bucket];
         }
     }
 
 private:
+    // A two stage software pipeline over the probe rows. `build_idx_map` already holds the chain
+    // heads (see `pre_build_idxs`):
+    // 1. HASH_MAP_PREFETCH_DIST rows ahead, prefetch the head build row and its chain link.
+    // 2. Half way there, the link is in cache, so prefetch the second build row of the chain.
+    ALWAYS_INLINE void _prefetch_build_row(const uint32_t* __restrict build_idx_map, int probe_idx,
+                                           int probe_rows) const {
+        if (!_prefetch_build_rows) {
+            return;
+        }
+        constexpr int head_dist = static_cast<int>(HASH_MAP_PREFETCH_DIST);
+        constexpr int link_dist = head_dist / 2;
+        if (probe_idx + head_dist < probe_rows) {
+            auto build_idx = build_idx_map[probe_idx + head_dist];
+            __builtin_prefetch(&build_keys[build_idx]);
+            __builtin_prefetch(&next[build_idx]);
+        }
+        if (probe_idx + link_dist < probe_rows) {
+            auto build_idx = next[build_idx_map[probe_idx + link_dist]];
+            if (build_idx) {
+                __builtin_prefetch(&build_keys[build_idx]);
+                __builtin_prefetch(&next[build_idx]);
+            }
+        }
+    }
+
     template <int JoinOpType>
     auto _process_null_aware_left_half_join_for_empty_build_side(int probe_idx, int probe_rows,
                                                                  uint32_t* __restrict probe_idxs,
@@ -242,11 +332,12 @@ private:
                                      const uint32_t* __restrict build_idx_map, int probe_idx,
                                      int probe_rows) {
         while (probe_idx < probe_rows) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
-                if (!visited[build_idx] && keys[probe_idx] == build_keys[build_idx]) {
-                    visited[build_idx] = 1;
+                if (!visited.test(build_idx) && keys[probe_idx] == build_keys[build_idx]) {
+                    visited.set(build_idx);
                 }
                 build_idx = next[build_idx];
             }
@@ -271,6 +362,7 @@ private:
                 }
             }
 
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
@@ -327,6 +419,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -352,9 +445,7 @@ private:
                     matched_cnt++;
                     if constexpr (JoinOpType == TJoinOp::RIGHT_OUTER_JOIN ||
                                   JoinOpType == TJoinOp::FULL_OUTER_JOIN) {
-                        if (!visited[build_idx]) {
-                            visited[build_idx] = 1;
-                        }
+                        visited.set(build_idx);
                     }
                 }
                 build_idx = next[build_idx];
@@ -381,6 +472,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -460,7 +552,7 @@ private:
     }
 
     const Key* __restrict build_keys;
-    DorisVector<uint8_t> visited;
+    JoinVisitedFlags visited;
 
     uint32_t bucket_size = 1;
     int max_batch_size = 4064;
@@ -474,6 +566,7 @@ private:
     bool _has_null_key = false;
     bool _keep_null_key = false;
     bool _empty_build_side = true;
+    bool _prefetch_build_rows = false;
 };
 
 template <typename Key, typename Hash = DefaultHash<Key>>
@@ -26,10 +26,15 @@
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "common/object_pool.h"
+#include "pdqsort.h"
 #include "runtime/exec_env.h"
+#include "runtime/fragment_mgr.h"
 #include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
 #include "util/runtime_profile.h"
+#include "util/threadpool.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
@@ -57,12 +62,44 @@ namespace doris::vectorized {
 // to the spill file.
 //
 
+namespace {
+// The number of splitters sampled for every partition of a parallel merge.
+constexpr size_t PARALLEL_MERGE_SAMPLES_PER_PARTITION = 16;
+
+// Runs func(0) .. func(num_tasks - 1) on the fragment manager thread pool, a task the pool rejects
+// runs in the current thread, and waits for all of them.
+void run_in_parallel(RuntimeState* state, size_t num_tasks,
+                     const std::function<void(size_t)>& func) {
+    auto* fragment_mgr = ExecEnv::GetInstance()->fragment_mgr();
+    auto* thread_pool = fragment_mgr == nullptr ? nullptr : fragment_mgr->get_thread_pool();
+    CountDownLatch latch(static_cast<int>(num_tasks - 1));
+    for (size_t i = 1; i < num_tasks; ++i) {
+        auto st = Status::OK();
+        if (thread_pool != nullptr) {
+            st = thread_pool->submit_func([&, i]() {
+                SCOPED_ATTACH_TASK(state);
+                func(i);
+                latch.count_down();
+            });
+        }
+        if (thread_pool == nullptr || !st.ok()) {
+            func(i);
+            latch.count_down();
+        }
+    }
+    func(0);
+    latch.wait();
+}
+} // namespace
+
 void MergeSorterState::reset() {
     std::vector<std::shared_ptr<MergeSortCursorImpl>> empty_cursors(0);
     std::vector<std::shared_ptr<Block>> empty_blocks(0);
     _sorted_blocks.swap(empty_blocks);
     unsorted_block() = Block::create_unique(unsorted_block()->clone_empty());
     _in_mem_sorted_bocks_size = 0;
+    _merged_blocks.clear();
+    _parallel_merged = false;
 }
 
 void MergeSorterState::add_sorted_block(std::shared_ptr<Block> block) {
@@ -87,8 +124,135 @@ Status MergeSorterState::build_merge_tree(const SortDescription& sort_descriptio
     return Status::OK();
 }
 
+Status MergeSorterState::parallel_merge(RuntimeState* state,
+                                        const SortDescription& sort_description,
+                                        size_t num_partitions, int batch_size) {
+    std::vector<MergeSortCursor> runs;
+    size_t total_rows = 0;
+    for (const auto& block : _sorted_blocks) {
+        runs.emplace_back(MergeSortCursorImpl::create_shared(block, sort_description));
+        total_rows += block->rows();
+    }
+
+    // The splitters are quantiles of rows sampled evenly from all runs. A partition holds the
+    // rows of every run from the first row not less than the previous splitter to the first row
+    // not less than its splitter, so the rows equal to a splitter are in one partition.
+    std::vector<std::pair<size_t, size_t>> samples;
+    const size_t sample_step =
+            std::max<size_t>(total_rows / (num_partitions * PARALLEL_MERGE_SAMPLES_PER_PARTITION),
+                             1);
+    for (size_t run = 0; run < runs.size(); ++run) {
+        for (size_t row = sample_step / 2; row < runs[run]->get_size(); row += sample_step) {
+            samples.emplace_back(run, row);
+        }
+    }
+    auto row_less = [&](size_t lhs_run, size_t lhs_row, size_t rhs_run, size_t rhs_row) {
+        return runs[rhs_run].greater_at(runs[lhs_run], rhs_row, lhs_row) > 0;
+    };
+    pdqsort(samples.begin(), samples.end(), [&](const auto& lhs, const auto& rhs) {
+        return row_less(lhs.first, lhs.second, rhs.first, rhs.second);
+    });
+
+    // bounds[k][run] is the first row of the run in partition k
+    std::vector<std::vector<size_t>> bounds(num_partitions + 1,
+                                            std::vector<size_t>(runs.size(), 0));
+    for (size_t run = 0; run < runs.size(); ++run) {
+        bounds[num_partitions][run] = runs[run]->get_size();
+    }
+    for (size_t k = 1; k < num_partitions; ++k) {
+        const auto [splitter_run, splitter_row] = samples[samples.size() * k / num_partitions];
+        for (size_t run = 0; run < runs.size(); ++run) {
+            size_t low = bounds[k - 1][run];
+            size_t high = bounds[num_partitions][run];
+            while (low < high) {
+                size_t mid = low + (high - low) / 2;
+                if (row_less(run, mid, splitter_run, splitter_row)) {
+                    low = mid + 1;
+                } else {
+                    high = mid;
+                }
+            }
+            bounds[k][run] = low;
+        }
+    }
+
+    // The cursors convert the const columns of the blocks, so they are created before the merge.
+    std::vector<std::vector<MergeSortCursor>> partition_cursors(num_partitions);
+    for (size_t k = 0; k < num_partitions; ++k) {
+        for (size_t run = 0; run < runs.size(); ++run) {
+            if (bounds[k][run] == bounds[k + 1][run]) {
+                continue;
+            }
+            auto impl = MergeSortCursorImpl::create_shared(_sorted_blocks[run], sort_description);
+            impl->pos = static_cast<int>(bounds[k][run]);
+            impl->rows = static_cast<int>(bounds[k + 1][run]);
+            partition_cursors[k].emplace_back(std::move(impl));
+        }
+    }
+
+    std::vector<std::vector<Block>> outputs(num_partitions);
+    std::vector<Status> statuses(num_partitions);
+    run_in_parallel(state, num_partitions, [&](size_t k) {
+        statuses[k] = _merge_partition(partition_cursors[k], batch_size, outputs[k]);
+    });
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    for (auto& output : outputs) {
+        for (auto& block : output) {
+            _merged_blocks.emplace_back(std::move(block));
+        }
+    }
+    _sorted_blocks.clear();
+    _parallel_merged = true;
+    return Status::OK();
+}
+
+Status MergeSorterState::_merge_partition(std::vector<MergeSortCursor>& cursors, int batch_size,
+                                          std::vector<Block>& output) const {
+    RETURN_IF_CATCH_EXCEPTION({
+        MergeSorterQueue queue(cursors);
+        const size_t num_columns = _unsorted_block->columns();
+        while (queue.is_valid()) {
+            Block block;
+            MutableBlock m_block =
+                    VectorizedUtils::build_mutable_mem_reuse_block(&block, *_unsorted_block);
+            MutableColumns& merged_columns = m_block.mutable_columns();
+            size_t merged_rows = 0;
+            while (queue.is_valid() && merged_rows < batch_size) {
+                // no structured binding, the commas would split the macro argument
+                auto* current = queue.current().first;
+                size_t current_rows = std::min(queue.current().second, batch_size - merged_rows);
+                for (size_t i = 0; i < num_columns; ++i) {
+                    merged_columns[i]->insert_range_from(*current->impl->columns[i],
+                                                         current->impl->pos, current_rows);
+                }
+                merged_rows += current_rows;
+                if (!current->impl->is_last(current_rows)) {
+                    queue.next(current_rows);
+                } else {
+                    queue.remove_top();
+                }
+            }
+            block.set_columns(std::move(merged_columns));
+            output.emplace_back(std::move(block));
+        }
+    });
+    return Status::OK();
+}
+
 Status MergeSorterState::merge_sort_read(doris::vectorized::Block* block, int batch_size,
                                          bool* eos) {
+    if (_parallel_merged) {
+        if (_merged_blocks.empty()) {
+            block->clear_column_data();
+            *eos = true;
+        } else {
+            block->swap(_merged_blocks.front());
+            _merged_blocks.pop_front();
+        }
+        return Status::OK();
+    }
     DCHECK(_sorted_blocks.empty());
     DCHECK(unsorted_block()->empty());
     RETURN_IF_ERROR(_merge_sort_read_impl(batch_size, block, eos));
@@ -154,6 +318,21 @@ Status Sorter::merge_sort_read_for_spill(RuntimeState* state, doris::vectorized:
 
 Status Sorter::partial_sort(Block& src_block, Block& dest_block, bool reversed) {
     size_t num_cols = src_block.columns();
+    Block* result_block = nullptr;
+    RETURN_IF_ERROR(_prepare_sort_block(src_block, dest_block, reversed, &result_block));
+
+    {
+        SCOPED_TIMER(_partial_sort_timer);
+        uint64_t limit = reversed ? 0 : (_offset + _limit);
+        sort_block(*result_block, dest_block, _sort_description, limit);
+    }
+
+    src_block.clear_column_data(num_cols);
+    return Status::OK();
+}
+
+Status Sorter::_prepare_sort_block(Block& src_block, Block& dest_block, bool reversed,
+                                   Block** result_block) {
     if (_materialize_sort_exprs) {
         auto output_tuple_expr_ctxs = _vsort_exec_exprs.sort_tuple_slot_expr_ctxs();
         std::vector<int> valid_column_ids(output_tuple_expr_ctxs.size());
@@ -181,10 +360,11 @@ Status Sorter::partial_sort(Block& src_block, Block& dest_block, bool reversed)
     }
 
     _sort_description.resize(_vsort_exec_exprs.ordering_expr_ctxs().size());
-    Block* result_block = _materialize_sort_exprs ? &dest_block : &src_block;
+    *result_block = _materialize_sort_exprs ? &dest_block : &src_block;
     for (int i = 0; i < _sort_description.size(); i++) {
         const auto& ordering_expr = _vsort_exec_exprs.ordering_expr_ctxs()[i];
-        RETURN_IF_ERROR(ordering_expr->execute(result_block, &_sort_description[i].column_number));
+        RETURN_IF_ERROR(
+                ordering_expr->execute(*result_block, &_sort_description[i].column_number));
 
         _sort_description[i].direction = _is_asc_order[i] ? 1 : -1;
         _sort_description[i].nulls_direction =
@@ -193,14 +373,6 @@ Status Sorter::partial_sort(Block& src_block, Block& dest_block, bool reversed)
             _sort_description[i].direction *= -1;
         }
     }
-
-    {
-        SCOPED_TIMER(_partial_sort_timer);
-        uint64_t limit = reversed ? 0 : (_offset + _limit);
-        sort_block(*result_block, dest_block, _sort_description, limit);
-    }
-
-    src_block.clear_column_data(num_cols);
     return Status::OK();
 }
 
@@ -209,7 +381,8 @@ FullSorter::FullSorter(VSortExecExprs& vsort_exec_exprs, int64_t limit, int64_t
                        std::vector<bool>& nulls_first, const RowDescriptor& row_desc,
                        RuntimeState* state, RuntimeProfile* profile)
         : Sorter(vsort_exec_exprs, limit, offset, pool, is_asc_order, nulls_first),
-          _state(MergeSorterState::create_unique(row_desc, offset)) {}
+          _state(MergeSorterState::create_unique(row_desc, offset)),
+          _runtime_state(state) {}
 
 // check whether the unsorted block can hold more data from input block and no need to alloc new memory
 bool FullSorter::has_enough_capacity(Block* input_block, Block* unsorted_block) const {
@@ -287,8 +460,20 @@ Status FullSorter::append_block(Block* block) {
 }
 
 Status FullSorter::prepare_for_read() {
-    if (_state->unsorted_block()->rows() > 0) {
-        RETURN_IF_ERROR(_do_sort());
+    const size_t unsorted_rows = _state->unsorted_block()->rows();
+    if (unsorted_rows > 0) {
+        const size_t num_partitions = _num_parallel_partitions(unsorted_rows);
+        if (num_partitions > 1) {
+            RETURN_IF_ERROR(_do_parallel_sort(num_partitions));
+        } else {
+            RETURN_IF_ERROR(_do_sort());
+        }
+    }
+    const size_t num_partitions = _num_parallel_partitions(_state->num_rows());
+    if (num_partitions > 1 && _state->get_sorted_block().size() > 1) {
+        COUNTER_SET(_parallel_sort_partitions, static_cast<int64_t>(num_partitions));
+        return _state->parallel_merge(_runtime_state, _sort_description, num_partitions,
+                                      _runtime_state->batch_size());
     }
     return _state->build_merge_tree(_sort_description);
 }
@@ -335,6 +520,55 @@ Status FullSorter::_do_sort() {
     return Status::OK();
 }
 
+size_t FullSorter::_num_parallel_partitions(size_t rows) const {
+    // the top-n pruning of _do_sort and the spilling stay serial
+    if (_runtime_state == nullptr || _limit != -1 || _offset != 0 || _enable_spill ||
+        config::full_sort_parallel_min_rows <= 0 ||
+        rows < static_cast<size_t>(config::full_sort_parallel_min_rows)) {
+        return 1;
+    }
+    return static_cast<size_t>(std::max(config::full_sort_parallel_max_threads, 1));
+}
+
+Status FullSorter::_do_parallel_sort(size_t num_partitions) {
+    Block* src_block = _state->unsorted_block().get();
+    const size_t num_cols = src_block->columns();
+    Block materialized_block = src_block->clone_without_columns();
+    Block* result_block = nullptr;
+    RETURN_IF_ERROR(_prepare_sort_block(*src_block, materialized_block, false, &result_block));
+
+    SCOPED_TIMER(_partial_sort_timer);
+    COUNTER_UPDATE(_partial_sort_counter, static_cast<int64_t>(num_partitions));
+    const size_t rows = result_block->rows();
+    std::vector<Block> sorted_blocks(num_partitions);
+    std::vector<Status> statuses(num_partitions);
+    run_in_parallel(_runtime_state, num_partitions, [&](size_t k) {
+        statuses[k] = [&]() -> Status {
+            RETURN_IF_CATCH_EXCEPTION({
+                const size_t begin = rows * k / num_partitions;
+                const size_t end = rows * (k + 1) / num_partitions;
+                Block chunk = result_block->clone_without_columns();
+                for (size_t i = 0; i < result_block->columns(); ++i) {
+                    chunk.get_by_position(i).column =
+                            result_block->get_by_position(i).column->cut(begin, end - begin);
+                }
+                sorted_blocks[k] = chunk.clone_without_columns();
+                sort_block(chunk, sorted_blocks[k], _sort_description, 0);
+            });
+            return Status::OK();
+        }();
+    });
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+
+    src_block->clear_column_data(num_cols);
+    for (auto& block : sorted_blocks) {
+        _state->add_sorted_block(Block::create_shared(std::move(block)));
+    }
+    return Status::OK();
+}
+
 size_t FullSorter::data_size() const {
     return _state->data_size();
 }
@@ -68,6 +68,11 @@ public:
 
     Status merge_sort_read(doris::vectorized::Block* block, int batch_size, bool* eos);
 
+    // Instead of build_merge_tree, splits the sorted blocks into `num_partitions` key ranges,
+    // merges the ranges concurrently and keeps the output blocks for merge_sort_read.
+    Status parallel_merge(RuntimeState* state, const SortDescription& sort_description,
+                          size_t num_partitions, int batch_size);
+
     size_t data_size() const {
         size_t size = _unsorted_block->bytes();
         return size + _in_mem_sorted_bocks_size;
@@ -86,6 +91,9 @@ public:
 private:
     Status _merge_sort_read_impl(int batch_size, doris::vectorized::Block* block, bool* eos);
 
+    Status _merge_partition(std::vector<MergeSortCursor>& cursors, int batch_size,
+                            std::vector<Block>& output) const;
+
     std::unique_ptr<Block> _unsorted_block;
     MergeSorterQueue _queue;
     std::vector<std::shared_ptr<Block>> _sorted_blocks;
@@ -96,6 +104,10 @@ private:
 
     Block _merge_sorted_block;
     std::unique_ptr<VSortedRunMerger> _merger;
+
+    // the merged output blocks of parallel_merge
+    std::deque<Block> _merged_blocks;
+    bool _parallel_merged = false;
 };
 
 class Sorter {
@@ -153,6 +165,11 @@ public:
 protected:
     Status partial_sort(Block& src_block, Block& dest_block, bool reversed = false);
 
+    // Materializes the sort exprs and executes the ordering exprs, `result_block` is the block
+    // to sort into `dest_block` then.
+    Status _prepare_sort_block(Block& src_block, Block& dest_block, bool reversed,
+                               Block** result_block);
+
     bool _enable_spill = false;
     SortDescription _sort_description;
     VSortExecExprs& _vsort_exec_exprs;
@@ -180,6 +197,12 @@ public:
 
     ~FullSorter() override = default;
 
+    void init_profile(RuntimeProfile* runtime_profile) override {
+        Sorter::init_profile(runtime_profile);
+        _parallel_sort_partitions =
+                ADD_COUNTER(runtime_profile, "ParallelSortPartitions", TUnit::UNIT);
+    }
+
     Status append_block(Block* block) override;
 
     Status prepare_for_read() override;
@@ -203,7 +226,15 @@ private:
 
     Status _do_sort();
 
+    // The number of threads to sort or merge `rows` rows with, 1 if it is done serially.
+    size_t _num_parallel_partitions(size_t rows) const;
+
+    // Sorts the unsorted block as `num_partitions` sorted blocks concurrently.
+    Status _do_parallel_sort(size_t num_partitions);
+
     std::unique_ptr<MergeSorterState> _state;
+    RuntimeState* _runtime_state = nullptr;
+    RuntimeProfile::Counter* _parallel_sort_partitions = nullptr;
 
     static constexpr size_t INITIAL_BUFFERED_BLOCK_BYTES = 64 * 1024 * 1024;
 
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "vec/common/string_ref.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+// A 16 bytes view of a string in the layout of the "German strings" of Umbra: the size, the
+// first 4 bytes of the string, then the next 8 bytes of a string of at most 12 bytes, or else
+// a pointer to the whole string. Most comparisons are decided by the size and the prefix
+// without loading the string, and the short strings are never loaded from elsewhere.
+//
+// The view doesn't own the string, which must outlive it.
+class StringView {
+public:
+    static constexpr uint32_t PREFIX_SIZE = 4;
+    static constexpr uint32_t INLINE_SIZE = 12;
+
+    StringView() : _size(0), _value {} {}
+
+    StringView(const char* data, uint32_t size) : _size(size), _value {} {
+        if (is_inline()) {
+            memcpy(_value.inlined, data, size);
+        } else {
+            memcpy(_value.ref.prefix, data, PREFIX_SIZE);
+            _value.ref.data = data;
+        }
+    }
+
+    explicit StringView(const StringRef& ref)
+            : StringView(ref.data, static_cast<uint32_t>(ref.size)) {}
+
+    uint32_t size() const { return _size; }
+
+    bool is_inline() const { return _size <= INLINE_SIZE; }
+
+    const char* data() const { return is_inline() ? _value.inlined : _value.ref.data; }
+
+    StringRef to_string_ref() const { return {data(), _size}; }
+
+    bool operator==(const StringView& other) const {
+        // compares the size and the prefix at once
+        if (_size_and_prefix() != other._size_and_prefix()) {
+            return false;
+        }
+        if (is_inline()) {
+            return memcmp(_value.inlined + PREFIX_SIZE, other._value.inlined + PREFIX_SIZE,
+                          INLINE_SIZE - PREFIX_SIZE) == 0;
+        }
+        return memcmp(_value.ref.data + PREFIX_SIZE, other._value.ref.data + PREFIX_SIZE,
+                      _size - PREFIX_SIZE) == 0;
+    }
+
+    // Orders the same as memcmp, then a shorter string before its extensions.
+    int compare(const StringView& other) const {
+        if (uint32_t prefix = _big_endian_prefix(), other_prefix = other._big_endian_prefix();
+            prefix != other_prefix) {
+            return prefix < other_prefix ? -1 : 1;
+        }
+        const uint32_t min_size = std::min(_size, other._size);
+        if (min_size > PREFIX_SIZE) {
+            if (int res = memcmp(data() + PREFIX_SIZE, other.data() + PREFIX_SIZE,
+                                 min_size - PREFIX_SIZE);
+                res != 0) {
+                return res < 0 ? -1 : 1;
+            }
+        }
+        return _size == other._size ? 0 : (_size < other._size ? -1 : 1);
+    }
+
+private:
+    uint64_t _size_and_prefix() const {
+        uint64_t value;
+        memcpy(&value, this, sizeof(value));
+        return value;
+    }
+
+    // the bytes after the end of a short string are 0, so the prefixes of two strings compare
+    // as memcmp does, and equal prefixes leave the order to the rest of the strings
+    uint32_t _big_endian_prefix() const {
+        uint32_t value;
+        memcpy(&value, _value.inlined, sizeof(value));
+        return __builtin_bswap32(value);
+    }
+
+    uint32_t _size;
+    // the prefix is the first bytes of both members
+    union {
+        char inlined[INLINE_SIZE];
+        struct __attribute__((packed)) {
+            char prefix[PREFIX_SIZE];
+            const char* data;
+        } ref;
+    } _value;
+};
+
+static_assert(sizeof(StringView) == 16);
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -632,6 +632,7 @@ void Block::set_columns(MutableColumns&& columns) {
     for (size_t i = 0; i < num_columns; ++i) {
         data[i].column = std::move(columns[i]);
     }
+    _dict_codes.clear();
 }
 
 Block Block::clone_with_columns(MutableColumns&& columns) const {
@@ -692,10 +693,13 @@ void Block::clear() {
     data.clear();
     index_by_name.clear();
     row_same_bit.clear();
+    _dict_codes.clear();
 }
 
 void Block::clear_column_data(int64_t column_size) noexcept {
     SCOPED_SKIP_MEMORY_CHECK();
+    // Release the references to the columns before they are reused.
+    _dict_codes.clear();
     // data.size() greater than column_size, means here have some
     // function exec result in block, need erase it here
     if (column_size != -1 and data.size() > column_size) {
@@ -745,6 +749,7 @@ void Block::swap(Block& other) noexcept {
     data.swap(other.data);
     index_by_name.swap(other.index_by_name);
     row_same_bit.swap(other.row_same_bit);
+    _dict_codes.swap(other._dict_codes);
 }
 
 void Block::swap(Block&& other) noexcept {
@@ -752,6 +757,7 @@ void Block::swap(Block&& other) noexcept {
     data = std::move(other.data);
     index_by_name = std::move(other.index_by_name);
     row_same_bit = std::move(other.row_same_bit);
+    _dict_codes = std::move(other._dict_codes);
 }
 
 void Block::shuffle_columns(const std::vector<int>& result_column_ids) {
@@ -760,7 +766,10 @@ void Block::shuffle_columns(const std::vector<int>& result_column_ids) {
     for (const int result_column_id : result_column_ids) {
         tmp_data.push_back(data[result_column_id]);
     }
-    swap(Block {tmp_data});
+    Block shuffled {tmp_data};
+    // The codes follow their columns.
+    shuffled._dict_codes = std::move(_dict_codes);
+    swap(shuffled);
 }
 
 void Block::update_hash(SipHash& hash) const {
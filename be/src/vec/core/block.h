@@ -68,6 +68,15 @@ namespace vectorized {
   */
 class MutableBlock;
 
+/// The dictionary codes of a string column read from dictionary encoded segment pages.
+/// Codes are only comparable between columns with the same dict_id, a null row has code -1.
+struct ColumnDictCodes {
+    uint64_t dict_id = 0;
+    size_t dict_size = 0;
+    PaddedPODArray<Int32> codes;
+};
+using ColumnDictCodesPtr = std::shared_ptr<const ColumnDictCodes>;
+
 class Block {
     ENABLE_FACTORY_CREATOR(Block);
 
@@ -77,6 +86,8 @@ private:
     Container data;
     IndexByName index_by_name;
     std::vector<bool> row_same_bit;
+    // The dictionary codes of some columns, see set_dict_codes().
+    std::vector<std::pair<ColumnPtr, ColumnDictCodesPtr>> _dict_codes;
 
     int64_t _decompress_time_ns = 0;
     int64_t _decompressed_bytes = 0;
@@ -378,6 +389,26 @@ public:
 
     void clear_same_bit() { row_same_bit.clear(); }
 
+    // Attaches the dictionary codes of the rows of the column at `position`. The codes are
+    // valid as long as the block holds that column with the same number of rows, so an
+    // operator that changes the column drops them.
+    void set_dict_codes(size_t position, ColumnDictCodesPtr codes) {
+        DCHECK_EQ(codes->codes.size(), data[position].column->size());
+        _dict_codes.emplace_back(data[position].column, std::move(codes));
+    }
+
+    // The dictionary codes of `column` if it's a column of this block with codes, else nullptr.
+    ColumnDictCodesPtr get_dict_codes(const IColumn* column) const {
+        for (const auto& [dict_column, codes] : _dict_codes) {
+            if (dict_column.get() == column && column->size() == codes->codes.size()) {
+                return codes;
+            }
+        }
+        return nullptr;
+    }
+
+    void clear_dict_codes() { _dict_codes.clear(); }
+
     // remove tmp columns in block
     // in inverted index apply logic, in order to optimize query performance,
     // we built some temporary columns into block
@@ -20,10 +20,347 @@
 
 #include "vec/core/sort_block.h"
 
+#include <array>
+#include <numeric>
+#include <type_traits>
+
+#include "common/config.h"
+#include "vec/columns/column_decimal.h"
+#include "vec/columns/column_vector.h"
 #include "vec/core/column_with_type_and_name.h"
 
 namespace doris::vectorized {
 
+namespace {
+/// A block with at least RADIX_SORT_MIN_ROWS rows, whose sort columns are fixed width integers of
+/// at most 128 bits in total, is sorted by a LSD radix sort. Every row gets one unsigned key,
+/// where the columns are concatenated in order as order preserving unsigned integers, and the
+/// null flags, the nulls direction and the direction are folded into the bits of each column.
+constexpr size_t RADIX_SORT_MIN_ROWS = 1024;
+
+template <PrimitiveType T>
+using RadixValue = std::conditional_t<is_decimal(T), typename PrimitiveTypeTraits<T>::CppNativeType,
+                                      typename PrimitiveTypeTraits<T>::ColumnItemType>;
+
+template <PrimitiveType... Types>
+struct RadixSortTypes {
+    // The bits of a value of the column, 0 if the column could not be sorted by radix.
+    static size_t value_bits(const IColumn& column) {
+        size_t bits = 0;
+        ((bits = bits != 0 ? bits
+                           : (check_and_get_column<typename PrimitiveTypeTraits<Types>::ColumnType>(
+                                      column) != nullptr
+                                      ? sizeof(RadixValue<Types>) * 8
+                                      : 0)),
+         ...);
+        return bits;
+    }
+
+    template <typename Key>
+    static void append(std::vector<Key>& keys, const IColumn& column, const UInt8* null_map,
+                       const SortColumnDescription& desc) {
+        (_try_append<Key, Types>(keys, column, null_map, desc) || ...);
+    }
+
+    // Writes the big endian bytes of the values, which compare by memcmp in the order of the
+    // values, at the start of every key. The null rows get zero bytes.
+    static void encode(UInt8* keys, size_t key_size, size_t rows, const IColumn& column,
+                       const UInt8* null_map, bool flip) {
+        (_try_encode<Types>(keys, key_size, rows, column, null_map, flip) || ...);
+    }
+
+private:
+    template <PrimitiveType T>
+    static bool _try_encode(UInt8* keys, size_t key_size, size_t rows, const IColumn& column,
+                            const UInt8* null_map, bool flip) {
+        const auto* typed_column =
+                check_and_get_column<typename PrimitiveTypeTraits<T>::ColumnType>(column);
+        if (typed_column == nullptr) {
+            return false;
+        }
+        using Value = RadixValue<T>;
+        using UnsignedValue = std::make_unsigned_t<Value>;
+        constexpr UnsignedValue sign_bit =
+                std::is_signed_v<Value> ? UnsignedValue(UnsignedValue(1) << (sizeof(Value) * 8 - 1))
+                                        : 0;
+        const UnsignedValue flip_mask = flip ? UnsignedValue(~UnsignedValue(0)) : 0;
+
+        const auto* data = reinterpret_cast<const Value*>(typed_column->get_data().data());
+        for (size_t i = 0; i < rows; ++i) {
+            if (null_map != nullptr && null_map[i]) {
+                continue;
+            }
+            auto value = UnsignedValue(UnsignedValue(data[i]) ^ sign_bit ^ flip_mask);
+            UInt8* pos = keys + i * key_size;
+            for (size_t byte = 0; byte < sizeof(Value); ++byte) {
+                pos[byte] = static_cast<UInt8>(value >> ((sizeof(Value) - 1 - byte) * 8));
+            }
+        }
+        return true;
+    }
+
+    template <typename Key, PrimitiveType T>
+    static bool _try_append(std::vector<Key>& keys, const IColumn& column, const UInt8* null_map,
+                            const SortColumnDescription& desc) {
+        const auto* typed_column =
+                check_and_get_column<typename PrimitiveTypeTraits<T>::ColumnType>(column);
+        if (typed_column == nullptr) {
+            return false;
+        }
+        using Value = RadixValue<T>;
+        using UnsignedValue = std::make_unsigned_t<Value>;
+        constexpr size_t key_bits = sizeof(Key) * 8;
+        constexpr size_t value_bits = sizeof(Value) * 8;
+        // Flipping the sign bit orders the signed values as unsigned ones.
+        constexpr UnsignedValue sign_bit =
+                std::is_signed_v<Value> ? UnsignedValue(UnsignedValue(1) << (value_bits - 1)) : 0;
+        // try_radix_sort picks a key type which holds all the columns
+        if constexpr (value_bits > key_bits) {
+            return false;
+        }
+
+        const size_t part_bits = value_bits + (null_map != nullptr);
+        const Key part_mask = part_bits == key_bits ? ~Key(0) : (Key(1) << part_bits) - 1;
+        const Key flip = desc.direction < 0 ? part_mask : Key(0);
+        // The null rows take the value 0 and the not null rows get the flag bit above the value
+        // when the nulls are less, or the other way around.
+        const bool nulls_greater = desc.nulls_direction > 0;
+        Key flag = 0;
+        if constexpr (value_bits < key_bits) {
+            flag = null_map != nullptr ? Key(1) << value_bits : Key(0);
+        }
+        const Key null_part = (nulls_greater ? flag : Key(0)) ^ flip;
+        const Key not_null_flag = nulls_greater ? Key(0) : flag;
+
+        const auto* data = reinterpret_cast<const Value*>(typed_column->get_data().data());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            Key part = null_map != nullptr && null_map[i]
+                               ? null_part
+                               : (Key(UnsignedValue(data[i]) ^ sign_bit) | not_null_flag) ^ flip;
+            keys[i] = part_bits == key_bits ? part : (keys[i] << part_bits) | part;
+        }
+        return true;
+    }
+};
+
+using RadixSortColumnTypes =
+        RadixSortTypes<TYPE_BOOLEAN, TYPE_TINYINT, TYPE_SMALLINT, TYPE_INT, TYPE_BIGINT,
+                       TYPE_DATEV2, TYPE_DATETIMEV2, TYPE_IPV4, TYPE_DECIMAL32, TYPE_DECIMAL64>;
+
+// Returns the nested column and sets the null map, which is nullptr without null rows.
+const IColumn& radix_sort_data_column(const IColumn& column, const UInt8** null_map) {
+    *null_map = nullptr;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+        if (nullable->has_null()) {
+            *null_map = nullable->get_null_map_data().data();
+        }
+        return nullable->get_nested_column();
+    }
+    return column;
+}
+
+template <typename Key>
+void radix_sort(const ColumnsWithSortDescriptions& columns, size_t rows, size_t key_bits,
+                IColumn::Permutation& perm) {
+    std::vector<Key> keys(rows);
+    for (const auto& [column, desc] : columns) {
+        const UInt8* null_map = nullptr;
+        const auto& data_column = radix_sort_data_column(*column, &null_map);
+        RadixSortColumnTypes::append(keys, data_column, null_map, desc);
+    }
+
+    const size_t passes = (key_bits + 7) / 8;
+    std::vector<std::array<size_t, 256>> histograms(passes);
+    for (auto& histogram : histograms) {
+        histogram.fill(0);
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t pass = 0; pass < passes; ++pass) {
+            ++histograms[pass][static_cast<UInt8>(keys[i] >> (pass * 8))];
+        }
+    }
+
+    perm.resize(rows);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::vector<Key> sorted_keys(rows);
+    IColumn::Permutation sorted_perm(rows);
+    for (size_t pass = 0; pass < passes; ++pass) {
+        auto& histogram = histograms[pass];
+        // all keys have the same byte, the pass would not move anything
+        if (std::find(histogram.begin(), histogram.end(), rows) != histogram.end()) {
+            continue;
+        }
+        size_t offset = 0;
+        for (auto& count : histogram) {
+            size_t bucket_size = count;
+            count = offset;
+            offset += bucket_size;
+        }
+        for (size_t i = 0; i < rows; ++i) {
+            size_t pos = histogram[static_cast<UInt8>(keys[i] >> (pass * 8))]++;
+            sorted_keys[pos] = keys[i];
+            sorted_perm[pos] = perm[i];
+        }
+        keys.swap(sorted_keys);
+        perm.swap(sorted_perm);
+    }
+}
+
+// Sorts the rows by a radix sort if the columns allow it, returns false otherwise.
+bool try_radix_sort(const ColumnsWithSortDescriptions& columns, size_t rows, UInt64 limit,
+                    IColumn::Permutation& perm) {
+    // a small limit is cheaper by a partial sort
+    if (rows < RADIX_SORT_MIN_ROWS || (limit != 0 && limit < rows / 8)) {
+        return false;
+    }
+    size_t key_bits = 0;
+    for (const auto& [column, desc] : columns) {
+        const UInt8* null_map = nullptr;
+        size_t value_bits =
+                RadixSortColumnTypes::value_bits(radix_sort_data_column(*column, &null_map));
+        if (value_bits == 0) {
+            return false;
+        }
+        key_bits += value_bits + (null_map != nullptr);
+    }
+    if (key_bits <= 32) {
+        radix_sort<UInt32>(columns, rows, key_bits, perm);
+    } else if (key_bits <= 64) {
+        radix_sort<UInt64>(columns, rows, key_bits, perm);
+    } else if (key_bits <= 128) {
+        radix_sort<unsigned __int128>(columns, rows, key_bits, perm);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/// A block sorted by several columns is sorted by normalized keys, when the first sort column is
+/// a fixed width integer or a string. Every row gets a key of at most NORMALIZED_KEY_SIZE bytes,
+/// where the leading sort columns are encoded in order, each as a null flag byte if the column has
+/// nulls and the big endian order preserving bytes of the value, with all bits flipped for DESC.
+/// A string column takes a zero padded prefix of the rest of the key and ends it, so the rows with
+/// equal keys compare the columns from the string column on one by one.
+constexpr size_t NORMALIZED_KEY_SIZE = 32;
+constexpr size_t NORMALIZED_KEY_MIN_ROWS = 64;
+
+struct NormalizedKeyPart {
+    const IColumn* column = nullptr;
+    const ColumnString* string_column = nullptr;
+    const UInt8* null_map = nullptr;
+    size_t offset = 0;
+    size_t value_size = 0;
+    bool flip = false;
+    bool nulls_greater = false;
+};
+
+void encode_normalized_key_part(const NormalizedKeyPart& part, UInt8* keys, size_t key_size,
+                                size_t rows) {
+    UInt8* part_keys = keys + part.offset;
+    if (part.null_map != nullptr) {
+        // the flag byte orders the null rows before or after the others
+        const UInt8 flip = part.flip ? 0xFF : 0;
+        const UInt8 null_flag = (part.nulls_greater ? 1 : 0) ^ flip;
+        const UInt8 not_null_flag = (part.nulls_greater ? 0 : 1) ^ flip;
+        for (size_t i = 0; i < rows; ++i) {
+            part_keys[i * key_size] = part.null_map[i] ? null_flag : not_null_flag;
+        }
+        ++part_keys;
+    }
+    if (part.string_column == nullptr) {
+        RadixSortColumnTypes::encode(part_keys, key_size, rows, *part.column, part.null_map,
+                                     part.flip);
+        return;
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        if (part.null_map != nullptr && part.null_map[i]) {
+            continue;
+        }
+        StringRef value = part.string_column->get_data_at(i);
+        UInt8* pos = part_keys + i * key_size;
+        size_t size = std::min(value.size, part.value_size);
+        memcpy(pos, value.data, size);
+        if (part.flip) {
+            // the zero padding is flipped too, so a shorter string is still greater in DESC
+            for (size_t byte = 0; byte < part.value_size; ++byte) {
+                pos[byte] ^= 0xFF;
+            }
+        }
+    }
+}
+
+// Sorts the rows by normalized keys if the columns allow it, returns false otherwise.
+bool try_normalized_key_sort(const ColumnsWithSortDescriptions& columns, size_t rows,
+                             UInt64 limit, IColumn::Permutation& perm) {
+    if (!config::enable_sort_normalized_key || columns.size() < 2 ||
+        rows < NORMALIZED_KEY_MIN_ROWS) {
+        return false;
+    }
+    std::vector<NormalizedKeyPart> parts;
+    size_t key_size = 0;
+    // the columns from this one on are compared one by one for the rows with equal keys
+    size_t first_compared_column = columns.size();
+    for (size_t i = 0; i < columns.size(); ++i) {
+        const auto& [column, desc] = columns[i];
+        NormalizedKeyPart part;
+        part.column = &radix_sort_data_column(*column, &part.null_map);
+        part.string_column = check_and_get_column<ColumnString>(*part.column);
+        part.value_size = part.string_column != nullptr
+                                  ? 1
+                                  : RadixSortColumnTypes::value_bits(*part.column) / 8;
+        const size_t part_size = (part.null_map != nullptr) + part.value_size;
+        if (part.value_size == 0 || key_size + part_size > NORMALIZED_KEY_SIZE) {
+            first_compared_column = i;
+            break;
+        }
+        part.offset = key_size;
+        part.flip = desc.direction < 0;
+        part.nulls_greater = desc.nulls_direction > 0;
+        if (part.string_column != nullptr) {
+            part.value_size = NORMALIZED_KEY_SIZE - key_size - (part.null_map != nullptr);
+            key_size = NORMALIZED_KEY_SIZE;
+            first_compared_column = i;
+            parts.push_back(part);
+            break;
+        }
+        key_size += part_size;
+        parts.push_back(part);
+    }
+    if (parts.empty()) {
+        return false;
+    }
+
+    std::vector<UInt8> keys(rows * key_size);
+    for (const auto& part : parts) {
+        encode_normalized_key_part(part, keys.data(), key_size, rows);
+    }
+
+    perm.resize(rows);
+    std::iota(perm.begin(), perm.end(), 0);
+    const UInt8* key_data = keys.data();
+    auto less = [&](size_t a, size_t b) {
+        int res = memcmp(key_data + a * key_size, key_data + b * key_size, key_size);
+        if (res != 0) {
+            return res < 0;
+        }
+        for (size_t i = first_compared_column; i < columns.size(); ++i) {
+            const auto& [column, desc] = columns[i];
+            res = column->compare_at(a, b, *column, desc.nulls_direction) * desc.direction;
+            if (res != 0) {
+                return res < 0;
+            }
+        }
+        return false;
+    };
+    if (limit != 0 && limit < rows) {
+        std::partial_sort(perm.begin(), perm.begin() + limit, perm.end(), less);
+    } else {
+        pdqsort(perm.begin(), perm.end(), less);
+    }
+    return true;
+}
+} // namespace
+
 ColumnsWithSortDescriptions get_columns_with_sort_description(const Block& block,
                                                               const SortDescription& description) {
     size_t size = description.size();
@@ -48,6 +385,19 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
         return;
     }
 
+    IColumn::Permutation fast_perm;
+    ColumnsWithSortDescriptions sort_columns =
+            get_columns_with_sort_description(src_block, description);
+    if (try_radix_sort(sort_columns, src_block.rows(), limit, fast_perm) ||
+        try_normalized_key_sort(sort_columns, src_block.rows(), limit, fast_perm)) {
+        size_t columns = src_block.columns();
+        for (size_t i = 0; i < columns; ++i) {
+            dest_block.replace_by_position(
+                    i, src_block.get_by_position(i).column->permute(fast_perm, limit));
+        }
+        return;
+    }
+
     /// If only one column to sort by
     if (description.size() == 1) {
         bool reverse = description[0].direction == -1;
@@ -36,6 +36,7 @@
 #include "vec/columns/column_string.h"
 #include "vec/common/memcmp_small.h"
 #include "vec/common/string_ref.h"
+#include "vec/common/string_view.h"
 #include "vec/core/block.h"
 #include "vec/core/sort_description.h"
 #include "vec/core/types.h"
@@ -134,7 +135,8 @@ struct ColumnPartialSortingLess {
 
 template <PrimitiveType T>
 struct PermutationWithInlineValue {
-    using ValueType = std::conditional_t<is_string_type(T), StringRef,
+    // the strings are compared by their views, mostly without loading them
+    using ValueType = std::conditional_t<is_string_type(T), StringView,
                                          typename PrimitiveTypeTraits<T>::ColumnItemType>;
     ValueType inline_value;
     uint32_t row_id;
@@ -347,7 +349,7 @@ private:
                 permutation_for_column[i].inline_value = column.get_data()[row_id];
             } else if constexpr (std::is_same_v<ColumnType, ColumnString> ||
                                  std::is_same_v<ColumnType, ColumnString64>) {
-                permutation_for_column[i].inline_value = column.get_data_at(row_id);
+                permutation_for_column[i].inline_value = StringView(column.get_data_at(row_id));
             } else {
                 static_assert(always_false_v<ColumnType>);
             }
@@ -426,13 +428,12 @@ private:
         _create_permutation(column, permutation_for_column.data(), perms);
         auto comparator = [&](const PermutationWithInlineValue<InlineType>& a,
                               const PermutationWithInlineValue<InlineType>& b) {
-            if constexpr (!std::is_same_v<ColumnType, ColumnString>) {
+            if constexpr (!std::is_same_v<ColumnType, ColumnString> &&
+                          !std::is_same_v<ColumnType, ColumnString64>) {
                 return a.inline_value > b.inline_value ? 1
                                                        : (a.inline_value < b.inline_value ? -1 : 0);
             } else {
-                return memcmp_small_allow_overflow15(
-                        reinterpret_cast<const UInt8*>(a.inline_value.data), a.inline_value.size,
-                        reinterpret_cast<const UInt8*>(b.inline_value.data), b.inline_value.size);
+                return a.inline_value.compare(b.inline_value);
             }
         };
 
@@ -31,6 +31,7 @@
 
 #include "agent/be_exec_version_manager.h"
 #include "common/cast_set.h"
+#include "util/simd/bits.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
@@ -98,6 +99,7 @@ Status DataTypeNullable::from_string(ReadBuffer& rb, IColumn* column) const {
 
 // binary: const flag | row num | read saved num| <null array> | <values array>
 //  <null array>: is_null1 | is_null2 | ...
+//      or since BITMAP_NULL_MAP_SERDE: has null | <null bitmap of the rows if has null>
 //  <values array>: value1 | value2 | ...>
 int64_t DataTypeNullable::get_uncompressed_serialized_bytes(const IColumn& column,
                                                             int be_exec_version) const {
@@ -112,7 +114,9 @@ int64_t DataTypeNullable::get_uncompressed_serialized_bytes(const IColumn& colum
         }
 
         const auto mem_size = real_need_copy_num * sizeof(bool);
-        if (mem_size <= SERIALIZED_MEM_SIZE_LIMIT) {
+        if (be_exec_version >= BITMAP_NULL_MAP_SERDE) {
+            size += sizeof(bool) + simd::bitmap_bytes(real_need_copy_num);
+        } else if (mem_size <= SERIALIZED_MEM_SIZE_LIMIT) {
             size += mem_size;
         } else {
             // Throw exception if mem_size is large than UINT32_MAX
@@ -152,7 +156,18 @@ char* DataTypeNullable::serialize(const IColumn& column, char* buf, int be_exec_
         const auto mem_size = real_need_copy_num * sizeof(bool);
         const auto& col = assert_cast<const ColumnNullable&>(*data_column);
         // null flags
-        if (mem_size <= SERIALIZED_MEM_SIZE_LIMIT) {
+        if (be_exec_version >= BITMAP_NULL_MAP_SERDE) {
+            // has null flag | <null bitmap>, a column without nulls writes no null map
+            const auto* null_map = col.get_null_map_data().data();
+            const bool has_null = simd::contain_byte(null_map, real_need_copy_num, 1);
+            *reinterpret_cast<bool*>(buf) = has_null;
+            buf += sizeof(bool);
+            if (has_null) {
+                simd::bytes_to_bitmap(null_map, real_need_copy_num,
+                                      reinterpret_cast<uint8_t*>(buf));
+                buf += simd::bitmap_bytes(real_need_copy_num);
+            }
+        } else if (mem_size <= SERIALIZED_MEM_SIZE_LIMIT) {
             memcpy(buf, col.get_null_map_data().data(), mem_size);
             buf += mem_size;
         } else {
@@ -200,11 +215,23 @@ const char* DataTypeNullable::deserialize(const char* buf, MutableColumnPtr* col
         auto* col = assert_cast<ColumnNullable*>(origin_column);
         // null flags
         auto mem_size = real_have_saved_num * sizeof(bool);
-        col->get_null_map_data().resize(real_have_saved_num);
-        if (mem_size <= SERIALIZED_MEM_SIZE_LIMIT) {
+        if (be_exec_version >= BITMAP_NULL_MAP_SERDE) {
+            const bool has_null = *reinterpret_cast<const bool*>(buf);
+            buf += sizeof(bool);
+            if (has_null) {
+                col->get_null_map_data().resize(real_have_saved_num);
+                simd::bitmap_to_bytes(reinterpret_cast<const uint8_t*>(buf), real_have_saved_num,
+                                      col->get_null_map_data().data());
+                buf += simd::bitmap_bytes(real_have_saved_num);
+            } else {
+                col->get_null_map_data().resize_fill(real_have_saved_num, 0);
+            }
+        } else if (mem_size <= SERIALIZED_MEM_SIZE_LIMIT) {
+            col->get_null_map_data().resize(real_have_saved_num);
             memcpy(col->get_null_map_data().data(), buf, mem_size);
             buf += mem_size;
         } else {
+            col->get_null_map_data().resize(real_have_saved_num);
             size_t encode_size = *reinterpret_cast<const size_t*>(buf);
             buf += sizeof(size_t);
             // Throw exception if mem_size is large than UINT32_MAX
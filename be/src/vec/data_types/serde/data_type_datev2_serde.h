@@ -66,6 +66,10 @@ public:
     Status write_column_to_mysql(const IColumn& column, MysqlRowBuffer<false>& row_buffer,
                                  int64_t row_idx, bool col_const,
                                  const FormatOptions& options) const override;
+    Status write_column_to_mysql_cells(const IColumn& column, MysqlRowBuffer<false>& row_buffer,
+                                       int64_t start, int64_t end, bool col_const,
+                                       const FormatOptions& options,
+                                       std::vector<int64_t>& cell_ends) const override;
 
     Status write_column_to_orc(const std::string& timezone, const IColumn& column,
                                const NullMap* null_map, orc::ColumnVectorBatch* orc_col_batch,
@@ -282,6 +282,17 @@ Status DataTypeDecimalSerDe<T>::write_column_to_mysql(const IColumn& column,
     return _write_column_to_mysql(column, row_buffer, row_idx, col_const, options);
 }
 
+template <PrimitiveType T>
+Status DataTypeDecimalSerDe<T>::write_column_to_mysql_cells(
+        const IColumn& column, MysqlRowBuffer<false>& row_buffer, int64_t start, int64_t end,
+        bool col_const, const FormatOptions& options, std::vector<int64_t>& cell_ends) const {
+    for (int64_t row_idx = start; row_idx < end; ++row_idx) {
+        RETURN_IF_ERROR(_write_column_to_mysql(column, row_buffer, row_idx, col_const, options));
+        cell_ends.push_back(row_buffer.length());
+    }
+    return Status::OK();
+}
+
 template <PrimitiveType T>
 Status DataTypeDecimalSerDe<T>::write_column_to_orc(const std::string& timezone,
                                                     const IColumn& column, const NullMap* null_map,
@@ -345,6 +345,42 @@ Status DataTypeNullableSerDe::write_column_to_mysql(const IColumn& column,
     return _write_column_to_mysql(column, row_buffer, row_idx, col_const, options);
 }
 
+Status DataTypeNullableSerDe::write_column_to_mysql_cells(
+        const IColumn& column, MysqlRowBuffer<false>& row_buffer, int64_t start, int64_t end,
+        bool col_const, const FormatOptions& options, std::vector<int64_t>& cell_ends) const {
+    const auto& col = assert_cast<const ColumnNullable&>(column);
+    const auto& nested_col = col.get_nested_column();
+    if (!col.has_null()) {
+        return nested_serde->write_column_to_mysql_cells(nested_col, row_buffer, start, end,
+                                                         col_const, options, cell_ends);
+    }
+    const auto& null_map = col.get_null_map_data();
+    int64_t row_idx = start;
+    while (row_idx < end) {
+        if (null_map[index_check_const(row_idx, col_const)]) {
+            if (UNLIKELY(0 != row_buffer.push_null())) {
+                return Status::InternalError("pack mysql buffer failed.");
+            }
+            cell_ends.push_back(row_buffer.length());
+            ++row_idx;
+            continue;
+        }
+        // the nested serde writes the run of not null rows at once
+        int64_t run_end = row_idx + 1;
+        if (col_const) {
+            run_end = end;
+        } else {
+            while (run_end < end && !null_map[run_end]) {
+                ++run_end;
+            }
+        }
+        RETURN_IF_ERROR(nested_serde->write_column_to_mysql_cells(
+                nested_col, row_buffer, row_idx, run_end, col_const, options, cell_ends));
+        row_idx = run_end;
+    }
+    return Status::OK();
+}
+
 Status DataTypeNullableSerDe::write_column_to_orc(const std::string& timezone,
                                                   const IColumn& column, const NullMap* null_map,
                                                   orc::ColumnVectorBatch* orc_col_batch,
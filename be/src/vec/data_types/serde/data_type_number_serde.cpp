@@ -341,6 +341,25 @@ Status DataTypeNumberSerDe<T>::write_column_to_mysql(const IColumn& column,
     return _write_column_to_mysql(column, row_buffer, row_idx, col_const, options);
 }
 
+template <PrimitiveType T>
+Status DataTypeNumberSerDe<T>::write_column_to_mysql_cells(
+        const IColumn& column, MysqlRowBuffer<false>& row_buffer, int64_t start, int64_t end,
+        bool col_const, const FormatOptions& options, std::vector<int64_t>& cell_ends) const {
+    if constexpr (T == TYPE_DATE || T == TYPE_DATETIME || T == TYPE_DATEV2 ||
+                  T == TYPE_DATETIMEV2 || T == TYPE_TIMEV2 || T == TYPE_IPV4 || T == TYPE_IPV6) {
+        // the serdes of these types derive from this one and write the cells in their own way
+        return DataTypeSerDe::write_column_to_mysql_cells(column, row_buffer, start, end,
+                                                          col_const, options, cell_ends);
+    } else {
+        for (int64_t row_idx = start; row_idx < end; ++row_idx) {
+            RETURN_IF_ERROR(
+                    _write_column_to_mysql(column, row_buffer, row_idx, col_const, options));
+            cell_ends.push_back(row_buffer.length());
+        }
+        return Status::OK();
+    }
+}
+
 #define WRITE_INTEGRAL_COLUMN_TO_ORC(ORC_TYPE)                    \
     ORC_TYPE* cur_batch = dynamic_cast<ORC_TYPE*>(orc_col_batch); \
     for (size_t row_id = start; row_id < end; row_id++) {         \
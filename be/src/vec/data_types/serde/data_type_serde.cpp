@@ -136,6 +136,18 @@ Status DataTypeSerDe::read_one_cell_from_json(IColumn& column,
     return Status::NotSupported("Not support read {} from rapidjson", column.get_name());
 }
 
+Status DataTypeSerDe::write_column_to_mysql_cells(const IColumn& column,
+                                                  MysqlRowBuffer<false>& row_buffer, int64_t start,
+                                                  int64_t end, bool col_const,
+                                                  const FormatOptions& options,
+                                                  std::vector<int64_t>& cell_ends) const {
+    for (int64_t row_idx = start; row_idx < end; ++row_idx) {
+        RETURN_IF_ERROR(write_column_to_mysql(column, row_buffer, row_idx, col_const, options));
+        cell_ends.push_back(row_buffer.length());
+    }
+    return Status::OK();
+}
+
 const std::string DataTypeSerDe::NULL_IN_COMPLEX_TYPE = "null";
 const std::string DataTypeSerDe::NULL_IN_CSV_FOR_ORDINARY_TYPE = "\\N";
 
@@ -352,6 +352,15 @@ public:
     virtual Status write_column_to_mysql(const IColumn& column, MysqlRowBuffer<true>& row_buffer,
                                          int64_t row_idx, bool col_const,
                                          const FormatOptions& options) const = 0;
+
+    // Write the rows [start, end) of the column to the text protocol buffer one cell after
+    // another and append the end offset of every cell in the buffer to cell_ends, to serialize
+    // a block column by column.
+    virtual Status write_column_to_mysql_cells(const IColumn& column,
+                                               MysqlRowBuffer<false>& row_buffer, int64_t start,
+                                               int64_t end, bool col_const,
+                                               const FormatOptions& options,
+                                               std::vector<int64_t>& cell_ends) const;
     // Thrift serializer and deserializer
 
     // JSON serializer and deserializer
@@ -41,6 +41,7 @@
 #include "io/fs/s3_file_reader.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
+#include "util/simd/bits.h"
 #include "util/string_util.h"
 #include "util/utf8_check.h"
 #include "vec/core/block.h"
@@ -85,7 +86,20 @@ void PlainCsvTextFieldSplitter::_split_field_single_char(const Slice& line,
     const char* data = line.data;
     const size_t size = line.size;
     size_t value_start = 0;
-    for (size_t i = 0; i < size; ++i) {
+    size_t i = 0;
+    // find the separators of a whole stride at once, only their positions are visited
+    constexpr size_t stride = simd::bits_mask_length();
+    for (; i + stride <= size; i += stride) {
+        simd::iterate_through_bits_mask(
+                [&](auto offset) {
+                    size_t pos = i + static_cast<size_t>(offset);
+                    process_value_func(data, value_start, pos - value_start, _trimming_char,
+                                       splitted_values);
+                    value_start = pos + _value_sep_len;
+                },
+                simd::bytes_equal_to_bits_mask(data + i, _value_sep[0]));
+    }
+    for (; i < size; ++i) {
         if (data[i] == _value_sep[0]) {
             process_value_func(data, value_start, i - value_start, _trimming_char, splitted_values);
             value_start = i + _value_sep_len;
@@ -239,7 +253,8 @@ Status CsvReader::init_reader(bool is_load) {
         } else if (_params.file_attributes.__isset.skip_lines) {
             _skip_lines = _params.file_attributes.skip_lines;
         }
-    } else if (_start_offset != 0) {
+    } else if (_file_compress_type != TFileCompressType::ZSTD) {
+        // the zstd file is split at the frame boundaries, see _init_zstd_split()
         if ((_file_compress_type != TFileCompressType::PLAIN) ||
             (_file_compress_type == TFileCompressType::UNKNOWN &&
              _file_format_type != TFileFormatType::FORMAT_CSV_PLAIN)) {
@@ -261,8 +276,23 @@ Status CsvReader::init_reader(bool is_load) {
 
     RETURN_IF_ERROR(_init_options());
     RETURN_IF_ERROR(_create_file_reader(false));
+    size_t decompressed_skip_bytes = 0;
+    size_t decompressed_length = 0;
+    bool zstd_split = _file_compress_type == TFileCompressType::ZSTD &&
+                      _params.file_type != TFileType::FILE_STREAM && _range.size >= 0 &&
+                      (_range.start_offset != 0 ||
+                       static_cast<size_t>(_range.start_offset + _range.size) <
+                               _file_reader->size());
+    if (zstd_split) {
+        RETURN_IF_ERROR(_init_zstd_split(&decompressed_skip_bytes, &decompressed_length));
+    }
     RETURN_IF_ERROR(_create_decompressor());
     RETURN_IF_ERROR(_create_line_reader());
+    if (zstd_split) {
+        // only the csv text formats are compressed, which are read by NewPlainTextLineReader
+        static_cast<NewPlainTextLineReader*>(_line_reader.get())
+                ->set_decompressed_range(decompressed_skip_bytes, decompressed_length);
+    }
 
     _is_load = is_load;
     if (!_is_load) {
@@ -519,6 +549,44 @@ Status CsvReader::_init_options() {
     return Status::OK();
 }
 
+Status CsvReader::_init_zstd_split(size_t* skip_bytes, size_t* length) {
+    // A zstd file is split only in the seekable format, whose frames are decompressed on their
+    // own. A split reads the lines beginning in the frames starting in its range.
+    size_t file_size = _file_reader->size();
+    uint8_t footer[ZstdSeekTable::FOOTER_SIZE];
+    size_t bytes_read = 0;
+    size_t table_size = 0;
+    if (file_size >= ZstdSeekTable::FOOTER_SIZE) {
+        RETURN_IF_ERROR(_file_reader->read_at(file_size - ZstdSeekTable::FOOTER_SIZE,
+                                              Slice(footer, ZstdSeekTable::FOOTER_SIZE),
+                                              &bytes_read, _io_ctx));
+    }
+    if (bytes_read == ZstdSeekTable::FOOTER_SIZE) {
+        RETURN_IF_ERROR(ZstdSeekTable::parse_footer(footer, file_size, &table_size));
+    }
+    if (table_size == 0) {
+        return Status::InternalError<false>(
+                "For now we do not support split zstd file without seek table: {}", _range.path);
+    }
+    std::vector<uint8_t> table(table_size);
+    RETURN_IF_ERROR(_file_reader->read_at(file_size - table_size, Slice(table.data(), table_size),
+                                          &bytes_read, _io_ctx));
+    if (bytes_read != table_size) {
+        return Status::InternalError("Failed to read the zstd seek table of {}", _range.path);
+    }
+    ZstdSeekTable seek_table;
+    RETURN_IF_ERROR(seek_table.parse(table.data(), table_size));
+
+    auto range = seek_table.split_range(_range.start_offset, _range.size);
+    _start_offset = range.read_offset;
+    *skip_bytes = range.skip_bytes;
+    *length = range.length;
+    if (range.skip_first_line) {
+        _skip_lines = 1;
+    }
+    return Status::OK();
+}
+
 Status CsvReader::_create_decompressor() {
     if (_file_compress_type != TFileCompressType::UNKNOWN) {
         RETURN_IF_ERROR(Decompressor::create_decompressor(_file_compress_type, &_decompressor));
@@ -221,6 +221,8 @@ protected:
     std::unique_ptr<Decompressor> _decompressor;
 
 private:
+    // Set the range of the line reader when the zstd file is split.
+    Status _init_zstd_split(size_t* skip_bytes, size_t* length);
     Status _create_decompressor();
     Status _create_file_reader(bool need_schema);
     Status _fill_dest_columns(const Slice& line, Block* block,
@@ -248,7 +248,8 @@ void NewPlainTextLineReader::close() {
 inline bool NewPlainTextLineReader::update_eof() {
     if (done()) {
         _eof = true;
-    } else if (_decompressor == nullptr && (_total_read_bytes >= _min_length)) {
+    } else if ((_decompressor == nullptr || _limit_decompressed) &&
+               (_total_read_bytes >= _min_length)) {
         _eof = true;
     }
     return _eof;
@@ -340,9 +341,17 @@ Status NewPlainTextLineReader::read_line(const uint8_t** ptr, size_t* size, bool
     size_t offset = 0;
     bool stream_end = true;
     while (!done()) {
+        const uint8_t* pos = nullptr;
+        if (_skip_bytes > 0) {
+            size_t skip_bytes = std::min(_skip_bytes, output_buf_read_remaining());
+            _output_buf_pos += skip_bytes;
+            _skip_bytes -= skip_bytes;
+        }
         // find line delimiter in current decompressed data
         uint8_t* cur_ptr = _output_buf + _output_buf_pos;
-        const uint8_t* pos = _line_reader_ctx->read_line(cur_ptr, output_buf_read_remaining());
+        if (_skip_bytes == 0) {
+            pos = _line_reader_ctx->read_line(cur_ptr, output_buf_read_remaining());
+        }
 
         if (pos == nullptr) {
             // didn't find line delimiter, read more data from decompressor
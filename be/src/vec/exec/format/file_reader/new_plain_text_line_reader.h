@@ -280,6 +280,15 @@ public:
 
     inline TextLineReaderCtxPtr text_line_reader_ctx() { return _line_reader_ctx; }
 
+    // Read the lines of length bytes of the decompressed data, after skipping skip_bytes bytes.
+    // Used to read a split of a compressed file made of independent frames, which starts at the
+    // beginning of a frame.
+    void set_decompressed_range(size_t skip_bytes, size_t length) {
+        _skip_bytes = skip_bytes;
+        _min_length = length;
+        _limit_decompressed = true;
+    }
+
     void close() override;
 
 protected:
@@ -306,9 +315,12 @@ private:
     Decompressor* _decompressor = nullptr;
     // the min length that should be read.
     // -1 means endless(for stream load)
-    // and only valid if the content is uncompressed
+    // and only valid if the content is uncompressed or _limit_decompressed is set
     size_t _min_length;
     size_t _total_read_bytes;
+    bool _limit_decompressed = false;
+    // the decompressed bytes to skip before the first line
+    size_t _skip_bytes = 0;
 
     TextLineReaderCtxPtr _line_reader_ctx;
 
@@ -488,6 +488,15 @@ Status NewJsonReader::_parse_jsonpath_and_json_root() {
         } else {
             return Status::InvalidJsonPath("Invalid json path: {}", _jsonpaths);
         }
+        for (size_t i = 0; i < _parsed_jsonpaths.size(); i++) {
+            const auto& path = _parsed_jsonpaths[i];
+            if (path.size() != 2 || !path[1].is_valid || path[1].idx != -1 ||
+                path[1].key == "*" || JsonFunctions::is_root_path(path) ||
+                !_jsonpath_key_to_column.emplace(path[1].key, i).second) {
+                _jsonpath_key_to_column.clear();
+                break;
+            }
+        }
     }
 
     // parse jsonroot
@@ -2092,52 +2101,101 @@ Status NewJsonReader::_get_json_value(size_t* size, bool* eof, simdjson::error_c
     return Status::OK();
 }
 
-Status NewJsonReader::_simdjson_write_columns_by_jsonpath(
+Status NewJsonReader::_simdjson_write_columns_by_top_level_keys(
         simdjson::ondemand::object* value, const std::vector<SlotDescriptor*>& slot_descs,
-        Block& block, bool* valid) {
-    // write by jsonpath
-    bool has_valid_value = false;
+        Block& block, bool* has_valid_value, bool* valid) {
+    _seen_columns.assign(block.columns(), false);
+    for (auto field : *value) {
+        std::string_view key = field.unescaped_key();
+        auto it = _jsonpath_key_to_column.find(key);
+        if (it == _jsonpath_key_to_column.end()) {
+            continue;
+        }
+        size_t i = it->second;
+        // the first one of a duplicated key is taken, as find_field_unordered does
+        if (i >= slot_descs.size() || _seen_columns[i] || !slot_descs[i]->is_materialized()) {
+            continue;
+        }
+        _seen_columns[i] = true;
+        simdjson::ondemand::value json_value = field.value();
+        auto* column_ptr = block.get_by_position(i).column->assume_mutable().get();
+        RETURN_IF_ERROR(_simdjson_write_data_to_column(json_value, slot_descs[i]->type(),
+                                                       column_ptr, slot_descs[i]->col_name(),
+                                                       _serdes[i], valid));
+        if (!(*valid)) {
+            return Status::OK();
+        }
+        *has_valid_value = true;
+    }
     for (size_t i = 0; i < slot_descs.size(); i++) {
-        auto* slot_desc = slot_descs[i];
-        if (!slot_desc->is_materialized()) {
+        if (_seen_columns[i] || !slot_descs[i]->is_materialized()) {
             continue;
         }
+        // not match in jsondata, filling with default value
         auto* column_ptr = block.get_by_position(i).column->assume_mutable().get();
-        simdjson::ondemand::value json_value;
-        Status st;
-        if (i < _parsed_jsonpaths.size()) {
-            st = JsonFunctions::extract_from_object(*value, _parsed_jsonpaths[i], &json_value);
-            if (!st.ok() && !st.is<NOT_FOUND>()) {
-                return st;
-            }
+        RETURN_IF_ERROR(_fill_missing_column(slot_descs[i], _serdes[i], column_ptr, valid));
+        if (!(*valid)) {
+            return Status::OK();
         }
-        if (i < _parsed_jsonpaths.size() && JsonFunctions::is_root_path(_parsed_jsonpaths[i])) {
-            // Indicate that the jsonpath is "$.", read the full root json object, insert the original doc directly
-            ColumnNullable* nullable_column = nullptr;
-            IColumn* target_column_ptr = nullptr;
-            if (slot_desc->is_nullable()) {
-                nullable_column = assert_cast<ColumnNullable*>(column_ptr);
-                target_column_ptr = &nullable_column->get_nested_column();
-                nullable_column->get_null_map_data().push_back(0);
+    }
+    *valid = true;
+    return Status::OK();
+}
+
+Status NewJsonReader::_simdjson_write_columns_by_jsonpath(
+        simdjson::ondemand::object* value, const std::vector<SlotDescriptor*>& slot_descs,
+        Block& block, bool* valid) {
+    // write by jsonpath
+    bool has_valid_value = false;
+    if (!_jsonpath_key_to_column.empty()) {
+        RETURN_IF_ERROR(_simdjson_write_columns_by_top_level_keys(value, slot_descs, block,
+                                                                  &has_valid_value, valid));
+        if (!(*valid)) {
+            return Status::OK();
+        }
+    } else {
+        for (size_t i = 0; i < slot_descs.size(); i++) {
+            auto* slot_desc = slot_descs[i];
+            if (!slot_desc->is_materialized()) {
+                continue;
             }
-            auto* column_string = assert_cast<ColumnString*>(target_column_ptr);
-            column_string->insert_data(_simdjson_ondemand_padding_buffer.data(),
-                                       _original_doc_size);
-            has_valid_value = true;
-        } else if (i >= _parsed_jsonpaths.size() || st.is<NOT_FOUND>()) {
-            // not match in jsondata, filling with default value
-            RETURN_IF_ERROR(_fill_missing_column(slot_desc, _serdes[i], column_ptr, valid));
-            if (!(*valid)) {
-                return Status::OK();
+            auto* column_ptr = block.get_by_position(i).column->assume_mutable().get();
+            simdjson::ondemand::value json_value;
+            Status st;
+            if (i < _parsed_jsonpaths.size()) {
+                st = JsonFunctions::extract_from_object(*value, _parsed_jsonpaths[i], &json_value);
+                if (!st.ok() && !st.is<NOT_FOUND>()) {
+                    return st;
+                }
             }
-        } else {
-            RETURN_IF_ERROR(_simdjson_write_data_to_column(json_value, slot_desc->type(),
-                                                           column_ptr, slot_desc->col_name(),
-                                                           _serdes[i], valid));
-            if (!(*valid)) {
-                return Status::OK();
+            if (i < _parsed_jsonpaths.size() && JsonFunctions::is_root_path(_parsed_jsonpaths[i])) {
+                // Indicate that the jsonpath is "$.", read the full root json object, insert the original doc directly
+                ColumnNullable* nullable_column = nullptr;
+                IColumn* target_column_ptr = nullptr;
+                if (slot_desc->is_nullable()) {
+                    nullable_column = assert_cast<ColumnNullable*>(column_ptr);
+                    target_column_ptr = &nullable_column->get_nested_column();
+                    nullable_column->get_null_map_data().push_back(0);
+                }
+                auto* column_string = assert_cast<ColumnString*>(target_column_ptr);
+                column_string->insert_data(_simdjson_ondemand_padding_buffer.data(),
+                                           _original_doc_size);
+                has_valid_value = true;
+            } else if (i >= _parsed_jsonpaths.size() || st.is<NOT_FOUND>()) {
+                // not match in jsondata, filling with default value
+                RETURN_IF_ERROR(_fill_missing_column(slot_desc, _serdes[i], column_ptr, valid));
+                if (!(*valid)) {
+                    return Status::OK();
+                }
+            } else {
+                RETURN_IF_ERROR(_simdjson_write_data_to_column(json_value, slot_desc->type(),
+                                                               column_ptr, slot_desc->col_name(),
+                                                               _serdes[i], valid));
+                if (!(*valid)) {
+                    return Status::OK();
+                }
+                has_valid_value = true;
             }
-            has_valid_value = true;
         }
     }
     if (!has_valid_value) {
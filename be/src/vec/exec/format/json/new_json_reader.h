@@ -180,6 +180,12 @@ private:
                                           const std::string& column_name, DataTypeSerDeSPtr serde,
                                           bool* valid);
 
+    // _simdjson_write_columns_by_jsonpath() when _jsonpath_key_to_column is set, the fields of
+    // the object are written to the columns of their keys in one pass over it.
+    Status _simdjson_write_columns_by_top_level_keys(simdjson::ondemand::object* value,
+                                                     const std::vector<SlotDescriptor*>& slot_descs,
+                                                     Block& block, bool* has_valid_value,
+                                                     bool* valid);
     Status _simdjson_write_columns_by_jsonpath(simdjson::ondemand::object* value,
                                                const std::vector<SlotDescriptor*>& slot_descs,
                                                Block& block, bool* valid);
@@ -239,6 +245,9 @@ private:
     bool _fuzzy_parse;
 
     std::vector<std::vector<JsonPath>> _parsed_jsonpaths;
+    // When every jsonpath is a distinct top level key like "$.k", key -> index of its column.
+    // Finding each path in the object apart would scan the object once per column.
+    phmap::flat_hash_map<std::string, size_t> _jsonpath_key_to_column;
     std::vector<JsonPath> _parsed_json_root;
     bool _parsed_from_json_root = false; // to avoid parsing json root multiple times
 
@@ -190,6 +190,10 @@ OrcReader::OrcReader(RuntimeProfile* profile, RuntimeState* state,
     VecDateTimeValue t;
     t.from_unixtime(0, ctz);
     _offset_days = t.day() == 31 ? -1 : 0; // If 1969-12-31, then returns -1.
+    if (state != nullptr && state->query_options().__isset.max_pushdown_conditions_per_column) {
+        _max_pushdown_conditions_per_column =
+                state->query_options().max_pushdown_conditions_per_column;
+    }
     _init_profile();
     _init_system_properties();
     _init_file_description();
@@ -665,6 +669,20 @@ std::tuple<bool, orc::Literal> convert_to_orc_literal(const orc::Type* type,
 
 std::tuple<bool, orc::Literal, orc::PredicateDataType> OrcReader::_make_orc_literal(
         const VSlotRef* slot_ref, const VLiteral* literal) {
+    if (literal == nullptr) {
+        // only get the predicate_type
+        return _make_orc_literal(slot_ref, static_cast<const StringRef*>(nullptr));
+    }
+    // this only happens when the literals of in_predicate contains null value, like in (1, null)
+    if (literal->get_column_ptr()->is_null_at(0)) {
+        return std::make_tuple(false, orc::Literal(false), orc::PredicateDataType::LONG);
+    }
+    auto literal_data = literal->get_column_ptr()->get_data_at(0);
+    return _make_orc_literal(slot_ref, &literal_data);
+}
+
+std::tuple<bool, orc::Literal, orc::PredicateDataType> OrcReader::_make_orc_literal(
+        const VSlotRef* slot_ref, const StringRef* value) {
     DCHECK(_col_name_to_file_col_name.contains(slot_ref->expr_name()));
     auto file_col_name = _col_name_to_file_col_name[slot_ref->expr_name()];
     if (!_type_map.contains(file_col_name)) {
@@ -678,15 +696,11 @@ std::tuple<bool, orc::Literal, orc::PredicateDataType> OrcReader::_make_orc_lite
         return std::make_tuple(false, orc::Literal(false), orc::PredicateDataType::LONG);
     }
     const auto predicate_type = TYPEKIND_TO_PREDICATE_TYPE[orc_type->getKind()];
-    if (literal == nullptr) {
+    if (value == nullptr) {
         // only get the predicate_type
         return std::make_tuple(true, orc::Literal(true), predicate_type);
     }
-    // this only happens when the literals of in_predicate contains null value, like in (1, null)
-    if (literal->get_column_ptr()->is_null_at(0)) {
-        return std::make_tuple(false, orc::Literal(false), predicate_type);
-    }
-    auto literal_data = literal->get_column_ptr()->get_data_at(0);
+    auto literal_data = *value;
     auto* slot = _tuple_descriptor->slots()[slot_ref->column_id()];
     auto slot_type = slot->type();
     auto primitive_type = slot_type->get_primitive_type();
@@ -767,6 +781,37 @@ bool OrcReader::_check_literal_can_push_down(const VExprSPtr& expr, size_t child
     return valid;
 }
 
+// check if the values of an in runtime filter can be pushed down and make orc literals
+bool OrcReader::_check_in_set_can_push_down(const VExprSPtr& expr) {
+    auto impl = expr->get_impl();
+    auto hybrid_set = impl ? impl->get_set_func() : nullptr;
+    if (hybrid_set == nullptr || hybrid_set->size() == 0 ||
+        hybrid_set->size() > _max_pushdown_conditions_per_column) {
+        return false;
+    }
+    // the slot has been checked in _check_slot_can_push_down before calling this function
+    const auto* slot_ref = static_cast<const VSlotRef*>(expr->children()[0].get());
+    const bool is_string = is_string_type(
+            _tuple_descriptor->slots()[slot_ref->column_id()]->type()->get_primitive_type());
+    std::vector<orc::Literal> literals;
+    literals.reserve(hybrid_set->size());
+    auto* iter = hybrid_set->begin();
+    while (iter->has_next()) {
+        // the set of a string column holds StringRef, the others hold the values themselves
+        StringRef value = is_string ? *reinterpret_cast<const StringRef*>(iter->get_value())
+                                    : StringRef(reinterpret_cast<const char*>(iter->get_value()),
+                                                0);
+        auto [valid, orc_literal, _] = _make_orc_literal(slot_ref, &value);
+        if (!valid) {
+            return false;
+        }
+        literals.emplace_back(std::move(orc_literal));
+        iter->next();
+    }
+    _in_set_to_orc_literals[expr.get()] = std::move(literals);
+    return true;
+}
+
 // check if there are rest children of expr can be pushed down to orc reader
 bool OrcReader::_check_rest_children_can_push_down(const VExprSPtr& expr) {
     if (expr->children().size() < 2) {
@@ -814,7 +859,8 @@ bool OrcReader::_check_expr_can_push_down(const VExprSPtr& expr) {
         // can't push down if expr is null aware predicate
         return expr->node_type() != TExprNodeType::NULL_AWARE_BINARY_PRED &&
                expr->node_type() != TExprNodeType::NULL_AWARE_IN_PRED &&
-               _check_slot_can_push_down(expr) && _check_rest_children_can_push_down(expr);
+               _check_slot_can_push_down(expr) &&
+               (_check_rest_children_can_push_down(expr) || _check_in_set_can_push_down(expr));
 
     case TExprOpcode::INVALID_OPCODE:
         if (expr->node_type() == TExprNodeType::FUNCTION_CALL) {
@@ -876,12 +922,17 @@ void OrcReader::_build_equals(const VExprSPtr& expr,
 
 void OrcReader::_build_filter_in(const VExprSPtr& expr,
                                  std::unique_ptr<orc::SearchArgumentBuilder>& builder) {
-    DCHECK(expr->children().size() >= 2);
+    DCHECK(expr->children().size() >= 2 || _in_set_to_orc_literals.contains(expr.get()));
     DCHECK(expr->children()[0]->is_slot_ref());
     const auto* slot_ref = static_cast<const VSlotRef*>(expr->children()[0].get());
     std::vector<orc::Literal> literals;
     DCHECK(_vslot_ref_to_orc_predicate_data_type.contains(slot_ref));
     orc::PredicateDataType predicate_type = _vslot_ref_to_orc_predicate_data_type[slot_ref];
+    // An in runtime filter keeps its values in a hybrid set instead of literal children.
+    if (auto iter = _in_set_to_orc_literals.find(expr.get());
+        iter != _in_set_to_orc_literals.end()) {
+        literals = iter->second;
+    }
     for (size_t i = 1; i < expr->children().size(); ++i) {
         DCHECK(expr->children()[i]->is_literal());
         const auto* literal = static_cast<const VLiteral*>(expr->children()[i].get());
@@ -1009,6 +1060,7 @@ bool OrcReader::_init_search_argument(const VExprContextSPtrs& conjuncts) {
     for (const auto& expr_ctx : conjuncts) {
         _vslot_ref_to_orc_predicate_data_type.clear();
         _vliteral_to_orc_literal.clear();
+        _in_set_to_orc_literals.clear();
         if (_build_search_argument(expr_ctx->root(), builder)) {
             at_least_one_can_push_down = true;
         }
@@ -2388,12 +2440,17 @@ bool OrcReader::_can_filter_by_dict(int slot_id) {
     //  the implementation of NULL values because the dictionary itself does not contain
     //  NULL value encoding. As a result, many NULL-related functions or expressions
     //  cannot work properly, such as is null, is not null, coalesce, etc.
-    //  Here we check if the predicate expr is IN or BINARY_PRED.
+    //  Here we check if the predicate expr is IN or BINARY_PRED, or a bloom runtime filter
+    //  which need not let the NULL values pass.
     //  Implementation of NULL value dictionary filtering will be carried out later.
     return std::ranges::all_of(_slot_id_to_filter_conjuncts->at(slot_id), [&](const auto& ctx) {
-        return (ctx->root()->node_type() == TExprNodeType::IN_PRED ||
-                ctx->root()->node_type() == TExprNodeType::BINARY_PRED) &&
-               ctx->root()->children()[0]->node_type() == TExprNodeType::SLOT_REF;
+        const auto& root = ctx->root();
+        const bool is_bloom_filter =
+                root->node_type() == TExprNodeType::BLOOM_PRED && root->is_rf_wrapper() &&
+                !assert_cast<const VRuntimeFilterWrapper*>(root.get())->null_aware();
+        return (root->node_type() == TExprNodeType::IN_PRED ||
+                root->node_type() == TExprNodeType::BINARY_PRED || is_bloom_filter) &&
+               root->children()[0]->node_type() == TExprNodeType::SLOT_REF;
     });
 }
 
@@ -308,9 +308,12 @@ private:
     // functions for building search argument until _init_search_argument
     std::tuple<bool, orc::Literal, orc::PredicateDataType> _make_orc_literal(
             const VSlotRef* slot_ref, const VLiteral* literal);
+    std::tuple<bool, orc::Literal, orc::PredicateDataType> _make_orc_literal(
+            const VSlotRef* slot_ref, const StringRef* value);
     bool _check_slot_can_push_down(const VExprSPtr& expr);
     bool _check_literal_can_push_down(const VExprSPtr& expr, size_t child_id);
     bool _check_rest_children_can_push_down(const VExprSPtr& expr);
+    bool _check_in_set_can_push_down(const VExprSPtr& expr);
     bool _check_expr_can_push_down(const VExprSPtr& expr);
     void _build_less_than(const VExprSPtr& expr,
                           std::unique_ptr<orc::SearchArgumentBuilder>& builder);
@@ -701,6 +704,9 @@ private:
     std::unordered_map<const VSlotRef*, orc::PredicateDataType>
             _vslot_ref_to_orc_predicate_data_type;
     std::unordered_map<const VLiteral*, orc::Literal> _vliteral_to_orc_literal;
+    // the literals of the in runtime filters, which have no literal children
+    std::unordered_map<const VExpr*, std::vector<orc::Literal>> _in_set_to_orc_literals;
+    int _max_pushdown_conditions_per_column = 1024;
 
     // If you set "orc_tiny_stripe_threshold_bytes" = 0, the use tiny stripes merge io optimization will not be used.
     int64_t _orc_tiny_stripe_threshold_bytes = 8L * 1024L * 1024L;
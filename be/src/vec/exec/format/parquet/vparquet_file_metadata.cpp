@@ -19,6 +19,7 @@
 
 #include <gen_cpp/parquet_types.h>
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -29,9 +30,36 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+// The deserialized footer of a wide table takes several times of its serialized bytes, the
+// statistics and the column paths of each column chunk are counted.
+static size_t estimate_mem_size(const tparquet::FileMetaData& metadata) {
+    size_t size = sizeof(tparquet::FileMetaData);
+    for (const auto& element : metadata.schema) {
+        size += sizeof(element) + element.name.capacity();
+    }
+    for (const auto& row_group : metadata.row_groups) {
+        size += sizeof(row_group);
+        for (const auto& chunk : row_group.columns) {
+            size += sizeof(chunk) + chunk.file_path.capacity();
+            const auto& meta = chunk.meta_data;
+            size += meta.encodings.capacity() * sizeof(tparquet::Encoding::type);
+            for (const auto& path : meta.path_in_schema) {
+                size += sizeof(path) + path.capacity();
+            }
+            const auto& statistics = meta.statistics;
+            size += statistics.min.capacity() + statistics.max.capacity() +
+                    statistics.min_value.capacity() + statistics.max_value.capacity();
+        }
+    }
+    for (const auto& kv : metadata.key_value_metadata) {
+        size += sizeof(kv) + kv.key.capacity() + kv.value.capacity();
+    }
+    return size;
+}
+
 FileMetaData::FileMetaData(tparquet::FileMetaData& metadata, size_t mem_size)
-        : _metadata(metadata), _mem_size(mem_size) {
-    ExecEnv::GetInstance()->parquet_meta_tracker()->consume(mem_size);
+        : _metadata(metadata), _mem_size(std::max(mem_size, estimate_mem_size(_metadata))) {
+    ExecEnv::GetInstance()->parquet_meta_tracker()->consume(_mem_size);
 }
 
 FileMetaData::~FileMetaData() {
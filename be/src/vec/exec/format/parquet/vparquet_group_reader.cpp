@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
 #include <ostream>
+#include <set>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -57,6 +58,7 @@
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vliteral.h"
+#include "vec/exprs/vruntimefilter_wrapper.h"
 #include "vec/exprs/vslot_ref.h"
 #include "vparquet_column_reader.h"
 
@@ -135,9 +137,13 @@ Status RowGroupReader::init(
         _column_readers[read_col] = std::move(reader);
     }
 
-    bool disable_dict_filter = false;
+    // The conjuncts of several slots are executed on the strings, the slots they reference can't
+    // be replaced by the dict codes, but the other slots still can.
+    std::set<int> not_dict_filter_slot_ids;
     if (not_single_slot_filter_conjuncts != nullptr && !not_single_slot_filter_conjuncts->empty()) {
-        disable_dict_filter = true;
+        for (const auto& ctx : *not_single_slot_filter_conjuncts) {
+            _collect_slot_ids(ctx->root(), &not_dict_filter_slot_ids);
+        }
         _filter_conjuncts.insert(_filter_conjuncts.end(), not_single_slot_filter_conjuncts->begin(),
                                  not_single_slot_filter_conjuncts->end());
     }
@@ -151,7 +157,7 @@ Status RowGroupReader::init(
             const std::string& predicate_col_name = predicate_col_names[i];
             int slot_id = predicate_col_slot_ids[i];
             auto field = const_cast<FieldSchema*>(schema.get_column(predicate_col_name));
-            if (!disable_dict_filter && !_lazy_read_ctx.has_complex_type &&
+            if (!not_dict_filter_slot_ids.contains(slot_id) && !_lazy_read_ctx.has_complex_type &&
                 _can_filter_by_dict(
                         slot_id, _row_group_meta.columns[field->physical_column_index].meta_data)) {
                 _dict_filter_cols.emplace_back(std::make_pair(predicate_col_name, slot_id));
@@ -184,6 +190,15 @@ Status RowGroupReader::init(
     return Status::OK();
 }
 
+void RowGroupReader::_collect_slot_ids(const VExprSPtr& expr, std::set<int>* slot_ids) {
+    if (expr->is_slot_ref()) {
+        slot_ids->insert(assert_cast<const VSlotRef*>(expr.get())->slot_id());
+    }
+    for (const auto& child : expr->children()) {
+        _collect_slot_ids(child, slot_ids);
+    }
+}
+
 bool RowGroupReader::_can_filter_by_dict(int slot_id,
                                          const tparquet::ColumnMetaData& column_metadata) {
     SlotDescriptor* slot = nullptr;
@@ -214,12 +229,17 @@ bool RowGroupReader::_can_filter_by_dict(int slot_id,
     //  the implementation of NULL values because the dictionary itself does not contain
     //  NULL value encoding. As a result, many NULL-related functions or expressions
     //  cannot work properly, such as is null, is not null, coalesce, etc.
-    //  Here we check if the predicate expr is IN or BINARY_PRED.
+    //  Here we check if the predicate expr is IN or BINARY_PRED, or a bloom runtime filter
+    //  which need not let the NULL values pass.
     //  Implementation of NULL value dictionary filtering will be carried out later.
     return std::ranges::all_of(_slot_id_to_filter_conjuncts->at(slot_id), [&](const auto& ctx) {
-        return (ctx->root()->node_type() == TExprNodeType::IN_PRED ||
-                ctx->root()->node_type() == TExprNodeType::BINARY_PRED) &&
-               ctx->root()->children()[0]->node_type() == TExprNodeType::SLOT_REF;
+        const auto& root = ctx->root();
+        const bool is_bloom_filter =
+                root->node_type() == TExprNodeType::BLOOM_PRED && root->is_rf_wrapper() &&
+                !assert_cast<const VRuntimeFilterWrapper*>(root.get())->null_aware();
+        return (root->node_type() == TExprNodeType::IN_PRED ||
+                root->node_type() == TExprNodeType::BINARY_PRED || is_bloom_filter) &&
+               root->children()[0]->node_type() == TExprNodeType::SLOT_REF;
     });
 }
 
@@ -197,6 +197,11 @@ Status ParquetReader::close() {
 
 void ParquetReader::_close_internal() {
     if (!_closed) {
+        // wait for the prefetching which uses _io_ctx
+        _prefetched_row_groups.clear();
+        if (_current_prefetch_reader != nullptr) {
+            static_cast<void>(_current_prefetch_reader->close());
+        }
         _closed = true;
     }
 }
@@ -641,19 +646,14 @@ Status ParquetReader::_next_row_group_reader() {
     RowGroupReader::PositionDeleteContext position_delete_ctx =
             _get_position_delete_ctx(row_group, row_group_index);
     io::FileReaderSPtr group_file_reader;
-    if (typeid_cast<io::InMemoryFileReader*>(_file_reader.get())) {
-        // InMemoryFileReader has the ability to merge small IO
-        group_file_reader = _file_reader;
+    _current_prefetch_reader.reset();
+    if (auto it = _prefetched_row_groups.find(row_group_index.row_group_id);
+        it != _prefetched_row_groups.end()) {
+        _current_prefetch_reader = std::move(it->second);
+        _prefetched_row_groups.erase(it);
+        group_file_reader = _current_prefetch_reader;
     } else {
-        size_t avg_io_size = 0;
-        const std::vector<io::PrefetchRange> io_ranges =
-                _generate_random_access_ranges(row_group_index, &avg_io_size);
-        // The underlying page reader will prefetch data in column.
-        // Using both MergeRangeFileReader and BufferedStreamReader simultaneously would waste a lot of memory.
-        group_file_reader = avg_io_size < io::MergeRangeFileReader::SMALL_IO
-                                    ? std::make_shared<io::MergeRangeFileReader>(
-                                              _profile, _file_reader, io_ranges)
-                                    : _file_reader;
+        group_file_reader = _create_group_file_reader(row_group_index);
     }
     _current_group_reader.reset(new RowGroupReader(
             group_file_reader, _read_columns, row_group_index.row_group_id, row_group, _ctz,
@@ -661,12 +661,80 @@ Status ParquetReader::_next_row_group_reader() {
     _row_group_eof = false;
     _current_group_reader->set_current_row_group_idx(row_group_index);
     _current_group_reader->set_row_id_column_iterator(_row_id_column_iterator_pair);
+    _prefetch_row_groups();
     return _current_group_reader->init(_file_metadata->schema(), candidate_row_ranges, _col_offsets,
                                        _tuple_descriptor, _row_descriptor, _colname_to_slot_id,
                                        _not_single_slot_filter_conjuncts,
                                        _slot_id_to_filter_conjuncts);
 }
 
+io::FileReaderSPtr ParquetReader::_create_group_file_reader(
+        const RowGroupReader::RowGroupIndex& group) {
+    if (typeid_cast<io::InMemoryFileReader*>(_file_reader.get())) {
+        // InMemoryFileReader has the ability to merge small IO
+        return _file_reader;
+    }
+    size_t avg_io_size = 0;
+    const std::vector<io::PrefetchRange> io_ranges =
+            _generate_random_access_ranges(group, _read_columns, &avg_io_size);
+    // The underlying page reader will prefetch data in column.
+    // Using both MergeRangeFileReader and BufferedStreamReader simultaneously would waste a lot of memory.
+    return avg_io_size < io::MergeRangeFileReader::SMALL_IO
+                   ? std::make_shared<io::MergeRangeFileReader>(_profile, _file_reader, io_ranges)
+                   : _file_reader;
+}
+
+void ParquetReader::_prefetch_row_groups() {
+    if (config::parquet_prefetch_row_group_num <= 0 || _read_columns.empty() ||
+        typeid_cast<io::InMemoryFileReader*>(_file_reader.get())) {
+        return;
+    }
+    // The lazy columns are read only if the predicates leave some rows. The columns keep the
+    // order of _read_columns, so their ranges are sorted.
+    std::vector<std::string> prefetch_columns;
+    const auto& predicate_columns = _lazy_read_ctx.predicate_columns.first;
+    for (const auto& read_col : _read_columns) {
+        if (!_lazy_read_ctx.can_lazy_read ||
+            std::find(predicate_columns.begin(), predicate_columns.end(), read_col) !=
+                    predicate_columns.end()) {
+            prefetch_columns.push_back(read_col);
+        }
+    }
+    if (prefetch_columns.empty()) {
+        return;
+    }
+    size_t prefetch_bytes =
+            _current_prefetch_reader != nullptr ? _current_prefetch_reader->prefetch_bytes() : 0;
+    for (const auto& prefetched : _prefetched_row_groups) {
+        prefetch_bytes += prefetched.second->prefetch_bytes();
+    }
+    int num = 0;
+    for (auto group = _read_row_groups.begin();
+         group != _read_row_groups.end() && num < config::parquet_prefetch_row_group_num;
+         ++group, ++num) {
+        if (_prefetched_row_groups.contains(group->row_group_id)) {
+            continue;
+        }
+        size_t avg_io_size = 0;
+        std::vector<io::PrefetchRange> ranges =
+                _generate_random_access_ranges(*group, prefetch_columns, &avg_io_size);
+        size_t group_bytes = 0;
+        for (const auto& range : ranges) {
+            group_bytes += range.end_offset - range.start_offset;
+        }
+        if (prefetch_bytes + group_bytes >
+            static_cast<size_t>(config::parquet_prefetch_row_group_max_bytes)) {
+            // prefetched in order, the later row groups wait for the memory
+            break;
+        }
+        auto reader = std::make_shared<io::RangePrefetchFileReader>(
+                _profile, _file_reader, _create_group_file_reader(*group), std::move(ranges));
+        reader->prefetch(_io_ctx);
+        prefetch_bytes += group_bytes;
+        _prefetched_row_groups.emplace(group->row_group_id, std::move(reader));
+    }
+}
+
 Status ParquetReader::_init_row_groups(const bool& is_filter_groups) {
     SCOPED_RAW_TIMER(&_statistics.row_group_filter_time);
     if (is_filter_groups && (_total_groups == 0 || _t_metadata->num_rows == 0 || _range_size < 0)) {
@@ -730,7 +798,8 @@ Status ParquetReader::_init_row_groups(const bool& is_filter_groups) {
 }
 
 std::vector<io::PrefetchRange> ParquetReader::_generate_random_access_ranges(
-        const RowGroupReader::RowGroupIndex& group, size_t* avg_io_size) {
+        const RowGroupReader::RowGroupIndex& group, const std::vector<std::string>& columns,
+        size_t* avg_io_size) {
     std::vector<io::PrefetchRange> result;
     int64_t last_chunk_end = -1;
     size_t total_io_size = 0;
@@ -760,9 +829,11 @@ std::vector<io::PrefetchRange> ParquetReader::_generate_random_access_ranges(
                 }
             };
     const tparquet::RowGroup& row_group = _t_metadata->row_groups[group.row_group_id];
-    for (const auto& read_col : _read_columns) {
+    for (const auto& read_col : columns) {
         const FieldSchema* field = _file_metadata->schema().get_column(read_col);
-        scalar_range(field, row_group);
+        if (field != nullptr) {
+            scalar_range(field, row_group);
+        }
     }
     if (!result.empty()) {
         *avg_io_size = total_io_size / result.size();
@@ -819,25 +890,38 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         read_whole_row_group();
         return Status::OK();
     }
-    std::vector<uint8_t> col_index_buff(page_index._column_index_size);
-    size_t bytes_read = 0;
-    Slice result(col_index_buff.data(), page_index._column_index_size);
-    {
+    // the page indexes of the hot files are kept in the range cache of the file meta cache
+    auto read_index = [&](int64_t start, int64_t size, std::vector<uint8_t>* buff,
+                          ObjLRUCache::CacheHandle* handle, const uint8_t** data) -> Status {
         SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(_file_reader->read_at(page_index._column_index_start, result, &bytes_read,
-                                              _io_ctx));
-    }
-    _column_statistics.read_bytes += bytes_read;
+        size_t bytes_read = 0;
+        if (_meta_cache != nullptr && _meta_cache->range_cache_enabled()) {
+            Slice cached;
+            RETURN_IF_ERROR(_meta_cache->read_meta_range(_file_reader, _io_ctx,
+                                                         _file_description.mtime, start, size,
+                                                         handle, &cached, &bytes_read));
+            *data = reinterpret_cast<const uint8_t*>(cached.data);
+        } else {
+            buff->resize(size);
+            RETURN_IF_ERROR(_file_reader->read_at(start, Slice(buff->data(), size), &bytes_read,
+                                                  _io_ctx));
+            *data = buff->data();
+        }
+        _column_statistics.read_bytes += bytes_read;
+        return Status::OK();
+    };
+    std::vector<uint8_t> col_index_buff;
+    ObjLRUCache::CacheHandle col_index_handle;
+    const uint8_t* col_index_data = nullptr;
+    RETURN_IF_ERROR(read_index(page_index._column_index_start, page_index._column_index_size,
+                               &col_index_buff, &col_index_handle, &col_index_data));
     auto& schema_desc = _file_metadata->schema();
     std::vector<RowRange> skipped_row_ranges;
-    std::vector<uint8_t> off_index_buff(page_index._offset_index_size);
-    Slice res(off_index_buff.data(), page_index._offset_index_size);
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(
-                _file_reader->read_at(page_index._offset_index_start, res, &bytes_read, _io_ctx));
-    }
-    _column_statistics.read_bytes += bytes_read;
+    std::vector<uint8_t> off_index_buff;
+    ObjLRUCache::CacheHandle off_index_handle;
+    const uint8_t* off_index_data = nullptr;
+    RETURN_IF_ERROR(read_index(page_index._offset_index_start, page_index._offset_index_size,
+                               &off_index_buff, &off_index_handle, &off_index_data));
     // read twice: parse column index & parse offset index
     _column_statistics.meta_read_calls += 2;
     SCOPED_RAW_TIMER(&_statistics.parse_page_index_time);
@@ -856,7 +940,7 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
             continue;
         }
         tparquet::ColumnIndex column_index;
-        RETURN_IF_ERROR(page_index.parse_column_index(chunk, col_index_buff.data(), &column_index));
+        RETURN_IF_ERROR(page_index.parse_column_index(chunk, col_index_data, &column_index));
         const int64_t num_of_pages = column_index.null_pages.size();
         if (num_of_pages <= 0) {
             continue;
@@ -870,7 +954,7 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
             continue;
         }
         tparquet::OffsetIndex offset_index;
-        RETURN_IF_ERROR(page_index.parse_offset_index(chunk, off_index_buff.data(), &offset_index));
+        RETURN_IF_ERROR(page_index.parse_offset_index(chunk, off_index_data, &offset_index));
         for (int page_id : skipped_page_range) {
             RowRange skipped_row_range;
             RETURN_IF_ERROR(page_index.create_skipped_row_range(offset_index, row_group.num_rows,
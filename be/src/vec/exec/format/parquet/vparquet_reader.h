@@ -227,7 +227,11 @@ private:
     int64_t _get_column_start_offset(const tparquet::ColumnMetaData& column_init_column_readers);
     std::string _meta_cache_key(const std::string& path) { return "meta_" + path; }
     std::vector<io::PrefetchRange> _generate_random_access_ranges(
-            const RowGroupReader::RowGroupIndex& group, size_t* avg_io_size);
+            const RowGroupReader::RowGroupIndex& group, const std::vector<std::string>& columns,
+            size_t* avg_io_size);
+    io::FileReaderSPtr _create_group_file_reader(const RowGroupReader::RowGroupIndex& group);
+    // Prefetch the column chunks of the next row groups, which are read by the predicates.
+    void _prefetch_row_groups();
     void _collect_profile();
 
     static SortOrder _determine_sort_order(const tparquet::SchemaElement& parquet_schema);
@@ -275,6 +279,9 @@ private:
     RowGroupReader::LazyReadContext _lazy_read_ctx;
 
     std::list<RowGroupReader::RowGroupIndex> _read_row_groups;
+    // the readers of the next row groups whose column chunks are being prefetched
+    std::unordered_map<int, std::shared_ptr<io::RangePrefetchFileReader>> _prefetched_row_groups;
+    std::shared_ptr<io::RangePrefetchFileReader> _current_prefetch_reader;
     // parquet file reader object
     size_t _batch_size;
     int64_t _range_start_offset;
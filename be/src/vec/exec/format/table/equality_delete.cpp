@@ -17,34 +17,78 @@
 
 #include "vec/exec/format/table/equality_delete.h"
 
+#include <algorithm>
+
 #include "exprs/create_predicate_function.h"
+#include "util/bit_util.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
-std::unique_ptr<EqualityDeleteBase> EqualityDeleteBase::get_delete_impl(Block* delete_block) {
-    if (delete_block->columns() == 1) {
-        return std::make_unique<SimpleEqualityDelete>(delete_block);
+std::unique_ptr<EqualityDeleteBase> EqualityDeleteBase::get_delete_impl(Block&& delete_block) {
+    if (delete_block.columns() == 1) {
+        return std::make_unique<SimpleEqualityDelete>(std::move(delete_block));
     } else {
-        return std::make_unique<MultiEqualityDelete>(delete_block);
+        return std::make_unique<MultiEqualityDelete>(std::move(delete_block));
     }
 }
 
+void EqualityDeleteBase::_hash_rows(const std::vector<const IColumn*>& columns, size_t rows,
+                                    std::vector<uint64_t>* hashes) {
+    hashes->assign(rows, 0);
+    for (const auto* column : columns) {
+        column->update_hashes_with_value(hashes->data(), nullptr);
+    }
+}
+
+Status EqualityDeleteBase::_build_bloom_filter(const std::vector<uint64_t>& delete_hashes) {
+    if (delete_hashes.size() < BLOOM_FILTER_MIN_DELETE_ROWS) {
+        return Status::OK();
+    }
+    // about 2 bytes for each delete row
+    int log_space_bytes = std::min(BitUtil::log2(delete_hashes.size() * 2), 28);
+    _bloom_filter = std::make_unique<BlockBloomFilter>();
+    RETURN_IF_ERROR(_bloom_filter->init(log_space_bytes, 0));
+    for (uint64_t hash : delete_hashes) {
+        _bloom_filter->insert(_bloom_hash(hash));
+    }
+    return Status::OK();
+}
+
+size_t EqualityDeleteBase::_probe_bloom_filter(const std::vector<uint64_t>& hashes,
+                                               std::vector<uint8_t>* candidates) const {
+    size_t rows = hashes.size();
+    candidates->resize(rows);
+    std::vector<uint32_t> bloom_hashes(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        bloom_hashes[i] = _bloom_hash(hashes[i]);
+    }
+    _bloom_filter->find_batch(bloom_hashes.data(), rows, candidates->data());
+    size_t num_candidates = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        num_candidates += (*candidates)[i];
+    }
+    return num_candidates;
+}
+
 Status SimpleEqualityDelete::_build_set() {
-    COUNTER_UPDATE(num_delete_rows, _delete_block->rows());
-    if (_delete_block->columns() != 1) {
+    if (_delete_block.columns() != 1) {
         return Status::InternalError("Simple equality delete can be only applied with one column");
     }
-    auto& column_and_type = _delete_block->get_by_position(0);
+    auto& column_and_type = _delete_block.get_by_position(0);
     _delete_column_name = column_and_type.name;
     _delete_column_type = remove_nullable(column_and_type.type)->get_primitive_type();
-    _hybrid_set.reset(create_set(_delete_column_type, _delete_block->rows(), false));
+    _hybrid_set.reset(create_set(_delete_column_type, _delete_block.rows(), false));
     _hybrid_set->insert_fixed_len(column_and_type.column, 0);
+    if (_delete_block.rows() >= BLOOM_FILTER_MIN_DELETE_ROWS) {
+        std::vector<uint64_t> delete_hashes;
+        _hash_rows({column_and_type.column.get()}, _delete_block.rows(), &delete_hashes);
+        RETURN_IF_ERROR(_build_bloom_filter(delete_hashes));
+    }
     return Status::OK();
 }
 
-Status SimpleEqualityDelete::filter_data_block(Block* data_block) {
-    SCOPED_TIMER(equality_delete_time);
+Status SimpleEqualityDelete::filter_data_block(Block* data_block) const {
     auto* column_and_type = data_block->try_get_by_name(_delete_column_name);
     if (column_and_type == nullptr) {
         return Status::InternalError("Can't find the delete column '{}' in data file",
@@ -56,109 +100,156 @@ Status SimpleEqualityDelete::filter_data_block(Block* data_block) {
                 _delete_column_name, column_and_type->type->get_name(), (int)_delete_column_type);
     }
     size_t rows = data_block->rows();
-    // _filter: 1 => in _hybrid_set; 0 => not in _hybrid_set
-    if (_filter == nullptr) {
-        _filter = std::make_unique<IColumn::Filter>(rows, 0);
-    } else {
-        // reset the array capacity and fill all elements using the 0
-        _filter->assign(rows, UInt8(0));
+    const IColumn* column = column_and_type->column.get();
+    const NullMap* null_map = nullptr;
+    if (column->is_nullable()) {
+        const auto* nullable_column = assert_cast<const ColumnNullable*>(column);
+        null_map = &nullable_column->get_null_map_data();
+        column = &nullable_column->get_nested_column();
     }
 
-    if (column_and_type->column->is_nullable()) {
-        const NullMap& null_map =
-                reinterpret_cast<const ColumnNullable*>(column_and_type->column.get())
-                        ->get_null_map_data();
-        _hybrid_set->find_batch_nullable(
-                remove_nullable(column_and_type->column)->assume_mutable_ref(), rows, null_map,
-                *_filter);
+    // filter: 1 => in _hybrid_set; 0 => not in _hybrid_set
+    IColumn::Filter filter;
+    if (_bloom_filter != nullptr) {
+        std::vector<uint64_t> hashes;
+        _hash_rows({column_and_type->column.get()}, rows, &hashes);
+        std::vector<uint8_t> candidates;
+        size_t num_candidates = _probe_bloom_filter(hashes, &candidates);
+        if (num_candidates == 0) {
+            return Status::OK();
+        }
+        // only few rows pass the bloom filter, probe the hash set by these rows
+        if (num_candidates * 8 < rows) {
+            filter.assign(rows, UInt8(1));
+            size_t num_deleted = 0;
+            for (size_t i = 0; i < rows; ++i) {
+                if (!candidates[i]) {
+                    continue;
+                }
+                bool deleted;
+                if (null_map != nullptr && (*null_map)[i]) {
+                    deleted = _hybrid_set->contain_null();
+                } else {
+                    auto value = column->get_data_at(i);
+                    deleted = _hybrid_set->find(value.data, value.size);
+                }
+                filter[i] = !deleted;
+                num_deleted += deleted;
+            }
+            if (num_deleted > 0) {
+                Block::filter_block_internal(data_block, filter, data_block->columns());
+            }
+            return Status::OK();
+        }
+    }
+
+    filter.assign(rows, UInt8(0));
+    if (null_map != nullptr) {
+        _hybrid_set->find_batch_nullable(*column, rows, *null_map, filter);
         if (_hybrid_set->contain_null()) {
-            auto* filter_data = _filter->data();
+            auto* filter_data = filter.data();
             for (size_t i = 0; i < rows; ++i) {
-                filter_data[i] = filter_data[i] || null_map[i];
+                filter_data[i] = filter_data[i] || (*null_map)[i];
             }
         }
     } else {
-        _hybrid_set->find_batch(column_and_type->column->assume_mutable_ref(), rows, *_filter);
+        _hybrid_set->find_batch(*column, rows, filter);
     }
-    // should reverse _filter
-    auto* filter_data = _filter->data();
+    // should reverse filter
+    auto* filter_data = filter.data();
     for (size_t i = 0; i < rows; ++i) {
         filter_data[i] = !filter_data[i];
     }
 
-    Block::filter_block_internal(data_block, *_filter, data_block->columns());
+    Block::filter_block_internal(data_block, filter, data_block->columns());
     return Status::OK();
 }
 
 Status MultiEqualityDelete::_build_set() {
-    COUNTER_UPDATE(num_delete_rows, _delete_block->rows());
-    size_t rows = _delete_block->rows();
-    _delete_hashes.clear();
-    _delete_hashes.resize(rows, 0);
-    for (ColumnPtr column : _delete_block->get_columns()) {
-        column->update_hashes_with_value(_delete_hashes.data(), nullptr);
+    size_t rows = _delete_block.rows();
+    if (rows >= NO_ROW) {
+        return Status::InternalError("Too many rows in equality delete files: {}", rows);
+    }
+    std::vector<const IColumn*> columns;
+    for (const auto& column_and_type : _delete_block) {
+        columns.push_back(column_and_type.column.get());
     }
+    std::vector<uint64_t> delete_hashes;
+    _hash_rows(columns, rows, &delete_hashes);
+    _delete_hash_map.reserve(rows);
+    _next_rows.assign(rows, NO_ROW);
     for (size_t i = 0; i < rows; ++i) {
-        _delete_hash_map.insert({_delete_hashes[i], i});
+        auto [it, inserted] = _delete_hash_map.try_emplace(delete_hashes[i], uint32_t(i));
+        if (!inserted) {
+            _next_rows[i] = it->second;
+            it->second = uint32_t(i);
+        }
     }
-    _data_column_index.resize(_delete_block->columns());
-    return Status::OK();
+    return _build_bloom_filter(delete_hashes);
 }
 
-Status MultiEqualityDelete::filter_data_block(Block* data_block) {
-    SCOPED_TIMER(equality_delete_time);
-    size_t column_index = 0;
-    for (std::string column_name : _delete_block->get_names()) {
+Status MultiEqualityDelete::filter_data_block(Block* data_block) const {
+    // the delete column indexes in data block
+    std::vector<size_t> data_column_index;
+    std::vector<const IColumn*> data_columns;
+    for (const auto& delete_column : _delete_block) {
+        const auto& column_name = delete_column.name;
         auto* column_and_type = data_block->try_get_by_name(column_name);
         if (column_and_type == nullptr) {
             return Status::InternalError("Can't find the delete column '{}' in data file",
                                          column_name);
         }
-        if (!_delete_block->get_by_name(column_name).type->equals(*column_and_type->type)) {
+        if (!delete_column.type->equals(*column_and_type->type)) {
             return Status::InternalError(
                     "Not support type change in column '{}', src type: {}, target type: {}",
-                    column_name, _delete_block->get_by_name(column_name).type->get_name(),
+                    column_name, delete_column.type->get_name(),
                     column_and_type->type->get_name());
         }
-        _data_column_index[column_index++] = data_block->get_position_by_name(column_name);
+        data_column_index.push_back(data_block->get_position_by_name(column_name));
+        data_columns.push_back(column_and_type->column.get());
     }
     size_t rows = data_block->rows();
-    _data_hashes.clear();
-    _data_hashes.resize(rows, 0);
-    for (size_t index : _data_column_index) {
-        data_block->get_by_position(index).column->update_hashes_with_value(_data_hashes.data(),
-                                                                            nullptr);
-    }
+    std::vector<uint64_t> data_hashes;
+    _hash_rows(data_columns, rows, &data_hashes);
 
-    if (_filter == nullptr) {
-        _filter = std::make_unique<IColumn::Filter>(rows, 1);
-    } else {
-        //reset the array capacity and fill all elements using the 0
-        _filter->assign(rows, UInt8(1));
+    std::vector<uint8_t> candidates;
+    if (_bloom_filter != nullptr && _probe_bloom_filter(data_hashes, &candidates) == 0) {
+        return Status::OK();
     }
-    auto* filter_data = _filter->data();
+
+    IColumn::Filter filter(rows, 1);
+    auto* filter_data = filter.data();
+    size_t num_deleted = 0;
     for (size_t i = 0; i < rows; ++i) {
-        for (auto beg = _delete_hash_map.lower_bound(_data_hashes[i]),
-                  end = _delete_hash_map.upper_bound(_data_hashes[i]);
-             beg != end; ++beg) {
-            if (_equal(data_block, i, beg->second)) {
+        if (!candidates.empty() && !candidates[i]) {
+            continue;
+        }
+        auto it = _delete_hash_map.find(data_hashes[i]);
+        if (it == _delete_hash_map.end()) {
+            continue;
+        }
+        for (uint32_t row = it->second; row != NO_ROW; row = _next_rows[row]) {
+            if (_equal(data_block, data_column_index, i, row)) {
                 filter_data[i] = 0;
+                ++num_deleted;
                 break;
             }
         }
     }
 
-    Block::filter_block_internal(data_block, *_filter, data_block->columns());
+    if (num_deleted > 0) {
+        Block::filter_block_internal(data_block, filter, data_block->columns());
+    }
     return Status::OK();
 }
 
-bool MultiEqualityDelete::_equal(Block* data_block, size_t data_row_index,
-                                 size_t delete_row_index) {
-    for (size_t i = 0; i < _delete_block->columns(); ++i) {
-        ColumnPtr data_col = data_block->get_by_position(_data_column_index[i]).column;
-        ColumnPtr delete_col = _delete_block->get_by_position(i).column;
-        if (data_col->compare_at(data_row_index, delete_row_index, delete_col->assume_mutable_ref(),
-                                 -1) != 0) {
+bool MultiEqualityDelete::_equal(const Block* data_block,
+                                 const std::vector<size_t>& data_column_index,
+                                 size_t data_row_index, size_t delete_row_index) const {
+    for (size_t i = 0; i < _delete_block.columns(); ++i) {
+        const auto& data_col = data_block->get_by_position(data_column_index[i]).column;
+        const auto& delete_col = _delete_block.get_by_position(i).column;
+        if (data_col->compare_at(data_row_index, delete_row_index, *delete_col, -1) != 0) {
             return false;
         }
     }
@@ -15,8 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#pragma once
+
+#include <parallel_hashmap/phmap.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "exprs/block_bloom_filter.hpp"
 #include "exprs/hybrid_set.h"
-#include "util/runtime_profile.h"
 #include "vec/core/block.h"
 
 namespace doris::vectorized {
@@ -29,36 +37,51 @@ namespace doris::vectorized {
  * If there are more delete columns in delete file, use `MultiEqualityDelete`,
  * which generates a hash column from all delete columns, and only compare the values
  * when the hash values are the same.
+ *
+ * A large delete set misses the CPU cache on each probe, so the hashes of its rows are also put in
+ * a blocked bloom filter, which is probed first by the hashes of a whole data block.
+ *
+ * The built sets are immutable, and shared by the scanners of the data files with the same
+ * delete files.
  */
 class EqualityDeleteBase {
 protected:
-    RuntimeProfile::Counter* num_delete_rows;
-    RuntimeProfile::Counter* build_set_time;
-    RuntimeProfile::Counter* equality_delete_time;
-
-    Block* _delete_block;
+    Block _delete_block;
+    std::unique_ptr<BlockBloomFilter> _bloom_filter;
 
     virtual Status _build_set() = 0;
 
+    // The hashes of the rows of the columns, a value has the same hash in a nullable column.
+    static void _hash_rows(const std::vector<const IColumn*>& columns, size_t rows,
+                           std::vector<uint64_t>* hashes);
+
+    static uint32_t _bloom_hash(uint64_t hash) {
+        return static_cast<uint32_t>(hash ^ (hash >> 32));
+    }
+
+    Status _build_bloom_filter(const std::vector<uint64_t>& delete_hashes);
+
+    // Set candidates[i] to 1 if the row may be deleted, return the number of the candidates.
+    size_t _probe_bloom_filter(const std::vector<uint64_t>& hashes,
+                               std::vector<uint8_t>* candidates) const;
+
 public:
-    EqualityDeleteBase(Block* delete_block) : _delete_block(delete_block) {}
+    // The bloom filter is built only for larger sets, a small set fits the cache.
+    static constexpr size_t BLOOM_FILTER_MIN_DELETE_ROWS = 4096;
+
+    EqualityDeleteBase(Block&& delete_block) : _delete_block(std::move(delete_block)) {}
     virtual ~EqualityDeleteBase() = default;
 
-    Status init(RuntimeProfile* profile) {
-        static const char* delete_profile = "EqualityDelete";
-        ADD_TIMER_WITH_LEVEL(profile, delete_profile, 1);
-        num_delete_rows = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "NumRowsInDeleteFile", TUnit::UNIT,
-                                                       delete_profile, 1);
-        build_set_time = ADD_CHILD_TIMER_WITH_LEVEL(profile, "BuildHashSetTime", delete_profile, 1);
-        equality_delete_time =
-                ADD_CHILD_TIMER_WITH_LEVEL(profile, "EqualityDeleteFilterTime", delete_profile, 1);
-        SCOPED_TIMER(build_set_time);
-        return _build_set();
-    }
+    Status init() { return _build_set(); }
 
-    virtual Status filter_data_block(Block* data_block) = 0;
+    size_t num_delete_rows() const { return _delete_block.rows(); }
 
-    static std::unique_ptr<EqualityDeleteBase> get_delete_impl(Block* delete_block);
+    const Block& delete_block() const { return _delete_block; }
+
+    // Thread safe, remove the deleted rows from data_block.
+    virtual Status filter_data_block(Block* data_block) const = 0;
+
+    static std::unique_ptr<EqualityDeleteBase> get_delete_impl(Block&& delete_block);
 };
 
 class SimpleEqualityDelete : public EqualityDeleteBase {
@@ -66,14 +89,13 @@ protected:
     std::shared_ptr<HybridSetBase> _hybrid_set;
     std::string _delete_column_name;
     PrimitiveType _delete_column_type;
-    std::unique_ptr<IColumn::Filter> _filter;
 
     Status _build_set() override;
 
 public:
-    SimpleEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
+    SimpleEqualityDelete(Block&& delete_block) : EqualityDeleteBase(std::move(delete_block)) {}
 
-    Status filter_data_block(Block* data_block) override;
+    Status filter_data_block(Block* data_block) const override;
 };
 
 /**
@@ -81,26 +103,22 @@ public:
  */
 class MultiEqualityDelete : public EqualityDeleteBase {
 protected:
-    // hash column for delete block
-    std::vector<uint64_t> _delete_hashes;
-    // hash column for data block
-    std::vector<uint64_t> _data_hashes;
-    // hash code => row index
+    // hash code => the first delete row of the hash, the others are chained by _next_rows
     // if hash values are equal, then compare the real values
-    // the row index records the row number of the delete row in delete block
-    std::multimap<uint64_t, size_t> _delete_hash_map;
-    // the delete column indexes in data block
-    std::vector<size_t> _data_column_index;
-    std::unique_ptr<IColumn::Filter> _filter;
+    phmap::flat_hash_map<uint64_t, uint32_t> _delete_hash_map;
+    std::vector<uint32_t> _next_rows;
+
+    static constexpr uint32_t NO_ROW = std::numeric_limits<uint32_t>::max();
 
     Status _build_set() override;
 
-    bool _equal(Block* data_block, size_t data_row_index, size_t delete_row_index);
+    bool _equal(const Block* data_block, const std::vector<size_t>& data_column_index,
+                size_t data_row_index, size_t delete_row_index) const;
 
 public:
-    MultiEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
+    MultiEqualityDelete(Block&& delete_block) : EqualityDeleteBase(std::move(delete_block)) {}
 
-    Status filter_data_block(Block* data_block) override;
+    Status filter_data_block(Block* data_block) const override;
 };
 
 #include "common/compile_check_end.h"
@@ -34,6 +34,7 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/status.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
@@ -99,6 +100,7 @@ Status IcebergTableReader::get_next_block_inner(Block* block, size_t* read_rows,
     RETURN_IF_ERROR(TableSchemaChangeHelper::get_next_block_after(block));
 
     if (_equality_delete_impl != nullptr) {
+        SCOPED_TIMER(_iceberg_profile.equality_delete_filter_time);
         RETURN_IF_ERROR(_equality_delete_impl->filter_data_block(block));
         *read_rows = block->rows();
     }
@@ -141,11 +143,63 @@ Status IcebergTableReader::init_row_filters() {
     return Status::OK();
 }
 
+std::string IcebergTableReader::_equality_delete_cache_key(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    std::string key = "equality_delete";
+    for (const auto& delete_file : delete_files) {
+        key.append("_").append(delete_file.path);
+    }
+    return key;
+}
+
 Status IcebergTableReader::_equality_delete_base(
         const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    static const char* delete_profile = "EqualityDelete";
+    ADD_TIMER_WITH_LEVEL(_profile, delete_profile, 1);
+    _iceberg_profile.num_equality_delete_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
+            _profile, "NumRowsInDeleteFile", TUnit::UNIT, delete_profile, 1);
+    _iceberg_profile.equality_delete_build_time =
+            ADD_CHILD_TIMER_WITH_LEVEL(_profile, "BuildHashSetTime", delete_profile, 1);
+    _iceberg_profile.equality_delete_filter_time =
+            ADD_CHILD_TIMER_WITH_LEVEL(_profile, "EqualityDeleteFilterTime", delete_profile, 1);
+
+    Status create_status = Status::OK();
+    auto* delete_set = _kv_cache->get<EqualityDeleteSet>(
+            _equality_delete_cache_key(delete_files), [&]() -> EqualityDeleteSet* {
+                auto equality_delete_set = std::make_unique<EqualityDeleteSet>();
+                create_status =
+                        _build_equality_delete_set(delete_files, equality_delete_set.get());
+                if (!create_status.ok()) {
+                    return nullptr;
+                }
+                return equality_delete_set.release();
+            });
+    RETURN_IF_ERROR(create_status);
+    COUNTER_UPDATE(_iceberg_profile.num_equality_delete_rows,
+                   delete_set->impl->num_delete_rows());
+
+    for (int i = 0; i < delete_set->col_names.size(); ++i) {
+        const std::string& delete_col = delete_set->col_names[i];
+        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
+            _all_required_col_names.end()) {
+            _expand_col_names.emplace_back(delete_col);
+            DataTypePtr data_type = make_nullable(delete_set->col_types[i]);
+            MutableColumnPtr data_column = data_type->create_column();
+            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
+        }
+    }
+    for (const std::string& delete_col : _expand_col_names) {
+        _all_required_col_names.emplace_back(delete_col);
+    }
+    _equality_delete_impl = delete_set->impl.get();
+    return Status::OK();
+}
+
+Status IcebergTableReader::_build_equality_delete_set(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files, EqualityDeleteSet* delete_set) {
+    SCOPED_TIMER(_iceberg_profile.equality_delete_build_time);
     bool init_schema = false;
-    std::vector<std::string> equality_delete_col_names;
-    std::vector<DataTypePtr> equality_delete_col_types;
+    Block delete_block;
     std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
             partition_columns;
     std::unordered_map<std::string, VExprContextSPtr> missing_columns;
@@ -162,20 +216,19 @@ Status IcebergTableReader::_equality_delete_base(
         std::unique_ptr<GenericReader> delete_reader = _create_equality_reader(delete_desc);
         if (!init_schema) {
             RETURN_IF_ERROR(delete_reader->init_schema_reader());
-            RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
-                                                             &equality_delete_col_types));
-            _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
-                                            equality_delete_col_types);
+            RETURN_IF_ERROR(delete_reader->get_parsed_schema(&delete_set->col_names,
+                                                             &delete_set->col_types));
+            _generate_equality_delete_block(&delete_block, delete_set->col_names,
+                                            delete_set->col_types);
             init_schema = true;
         }
         if (auto* parquet_reader = typeid_cast<ParquetReader*>(delete_reader.get())) {
-            RETURN_IF_ERROR(parquet_reader->init_reader(equality_delete_col_names,
+            RETURN_IF_ERROR(parquet_reader->init_reader(delete_set->col_names,
                                                         not_in_file_col_names, nullptr, {}, nullptr,
                                                         nullptr, nullptr, nullptr, nullptr, false));
         } else if (auto* orc_reader = typeid_cast<OrcReader*>(delete_reader.get())) {
-            RETURN_IF_ERROR(orc_reader->init_reader(&equality_delete_col_names,
-                                                    not_in_file_col_names, nullptr, {}, false, {},
-                                                    {}, nullptr, nullptr));
+            RETURN_IF_ERROR(orc_reader->init_reader(&delete_set->col_names, not_in_file_col_names,
+                                                    nullptr, {}, false, {}, {}, nullptr, nullptr));
         } else {
             return Status::InternalError("Unsupported format of delete file");
         }
@@ -185,31 +238,17 @@ Status IcebergTableReader::_equality_delete_base(
         bool eof = false;
         while (!eof) {
             Block block;
-            _generate_equality_delete_block(&block, equality_delete_col_names,
-                                            equality_delete_col_types);
+            _generate_equality_delete_block(&block, delete_set->col_names, delete_set->col_types);
             size_t read_rows = 0;
             RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
             if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
+                MutableBlock mutable_block(&delete_block);
                 RETURN_IF_ERROR(mutable_block.merge(block));
             }
         }
     }
-    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
-        const std::string& delete_col = equality_delete_col_names[i];
-        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
-            _all_required_col_names.end()) {
-            _expand_col_names.emplace_back(delete_col);
-            DataTypePtr data_type = make_nullable(equality_delete_col_types[i]);
-            MutableColumnPtr data_column = data_type->create_column();
-            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
-        }
-    }
-    for (const std::string& delete_col : _expand_col_names) {
-        _all_required_col_names.emplace_back(delete_col);
-    }
-    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_block);
-    return _equality_delete_impl->init(_profile);
+    delete_set->impl = EqualityDeleteBase::get_delete_impl(std::move(delete_block));
+    return delete_set->impl->init();
 }
 
 void IcebergTableReader::_generate_equality_delete_block(
@@ -243,55 +282,70 @@ Status IcebergTableReader::_shrink_block_if_need(Block* block) {
 
 Status IcebergTableReader::_position_delete_base(
         const std::string data_file_path, const std::vector<TIcebergDeleteFileDesc>& delete_files) {
-    std::vector<DeleteRows*> delete_rows_array;
-    int64_t num_delete_rows = 0;
-    for (const auto& delete_file : delete_files) {
-        SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
-        Status create_status = Status::OK();
-        auto* delete_file_cache = _kv_cache->get<DeleteFile>(
-                _delet_file_cache_key(delete_file.path), [&]() -> DeleteFile* {
-                    auto* position_delete = new DeleteFile;
-                    TFileRangeDesc delete_file_range;
-                    // must use __set() method to make sure __isset is true
-                    delete_file_range.__set_fs_name(_range.fs_name);
-                    delete_file_range.path = delete_file.path;
-                    delete_file_range.start_offset = 0;
-                    delete_file_range.size = -1;
-                    delete_file_range.file_size = -1;
-                    //read position delete file base on delete_file_range , generate DeleteFile , add DeleteFile to kv_cache
-                    create_status = _read_position_delete_file(&delete_file_range, position_delete);
-
-                    if (!create_status) {
-                        return nullptr;
-                    }
-
-                    return position_delete;
-                });
-        if (create_status.is<ErrorCode::END_OF_FILE>()) {
-            continue;
-        } else if (!create_status.ok()) {
-            return create_status;
+    auto* deletion_vector_cache = ExecEnv::GetInstance()->deletion_vector_cache();
+    std::vector<DeletionVectorCache::Handle> handles(delete_files.size());
+    std::vector<const DeletionVectorCache::Bitmap*> delete_bitmaps;
+    for (size_t i = 0; i < delete_files.size(); ++i) {
+        const auto& delete_file = delete_files[i];
+        RETURN_IF_ERROR(DeletionVectorCache::get(
+                deletion_vector_cache,
+                DeletionVectorCache::iceberg_key(delete_file.path, data_file_path),
+                [&](DeletionVectorCache::Bitmap* bitmap) {
+                    return _read_position_deletes(data_file_path, delete_file, bitmap);
+                },
+                &handles[i]));
+        if (!handles[i].bitmap().isEmpty()) {
+            delete_bitmaps.emplace_back(&handles[i].bitmap());
         }
-
-        DeleteFile& delete_file_map = *((DeleteFile*)delete_file_cache);
-        auto get_value = [&](const auto& v) {
-            DeleteRows* row_ids = v.second.get();
-            if (!row_ids->empty()) {
-                delete_rows_array.emplace_back(row_ids);
-                num_delete_rows += row_ids->size();
-            }
-        };
-        delete_file_map.if_contains(data_file_path, get_value);
     }
-    if (num_delete_rows > 0) {
+    if (!delete_bitmaps.empty()) {
         SCOPED_TIMER(_iceberg_profile.delete_rows_sort_time);
-        _sort_delete_rows(delete_rows_array, num_delete_rows);
+        DeletionVectorCache::to_positions(delete_bitmaps, &_iceberg_delete_rows);
         this->set_delete_rows();
-        COUNTER_UPDATE(_iceberg_profile.num_delete_rows, num_delete_rows);
+        COUNTER_UPDATE(_iceberg_profile.num_delete_rows, _iceberg_delete_rows.size());
     }
     return Status::OK();
 }
 
+Status IcebergTableReader::_read_position_deletes(const std::string& data_file_path,
+                                                  const TIcebergDeleteFileDesc& delete_file,
+                                                  DeletionVectorCache::Bitmap* bitmap) {
+    SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
+    Status create_status = Status::OK();
+    // the other data files in the delete file are read from the cache of the scan node
+    auto* delete_file_cache = _kv_cache->get<DeleteFile>(
+            _delet_file_cache_key(delete_file.path), [&]() -> DeleteFile* {
+                auto* position_delete = new DeleteFile;
+                TFileRangeDesc delete_file_range;
+                // must use __set() method to make sure __isset is true
+                delete_file_range.__set_fs_name(_range.fs_name);
+                delete_file_range.path = delete_file.path;
+                delete_file_range.start_offset = 0;
+                delete_file_range.size = -1;
+                delete_file_range.file_size = -1;
+                //read position delete file base on delete_file_range , generate DeleteFile , add DeleteFile to kv_cache
+                create_status = _read_position_delete_file(&delete_file_range, position_delete);
+
+                if (!create_status) {
+                    return nullptr;
+                }
+
+                return position_delete;
+            });
+    if (create_status.is<ErrorCode::END_OF_FILE>()) {
+        return Status::OK();
+    } else if (!create_status.ok()) {
+        return create_status;
+    }
+
+    DeleteFile& delete_file_map = *((DeleteFile*)delete_file_cache);
+    delete_file_map.if_contains(data_file_path, [&](const auto& v) {
+        const DeleteRows* row_ids = v.second.get();
+        bitmap->addMany(row_ids->size(), reinterpret_cast<const uint64_t*>(row_ids->data()));
+    });
+    return Status::OK();
+}
+
 IcebergTableReader::PositionDeleteRange IcebergTableReader::_get_range(
         const ColumnDictI32& file_path_column) {
     IcebergTableReader::PositionDeleteRange range;
@@ -333,54 +387,6 @@ IcebergTableReader::PositionDeleteRange IcebergTableReader::_get_range(
     return range;
 }
 
-void IcebergTableReader::_sort_delete_rows(std::vector<std::vector<int64_t>*>& delete_rows_array,
-                                           int64_t num_delete_rows) {
-    if (delete_rows_array.empty()) {
-        return;
-    }
-    if (delete_rows_array.size() == 1) {
-        _iceberg_delete_rows.resize(num_delete_rows);
-        memcpy(_iceberg_delete_rows.data(), delete_rows_array.front()->data(),
-               sizeof(int64_t) * num_delete_rows);
-        return;
-    }
-    if (delete_rows_array.size() == 2) {
-        _iceberg_delete_rows.resize(num_delete_rows);
-        std::merge(delete_rows_array.front()->begin(), delete_rows_array.front()->end(),
-                   delete_rows_array.back()->begin(), delete_rows_array.back()->end(),
-                   _iceberg_delete_rows.begin());
-        return;
-    }
-
-    using vec_pair = std::pair<std::vector<int64_t>::iterator, std::vector<int64_t>::iterator>;
-    _iceberg_delete_rows.resize(num_delete_rows);
-    auto row_id_iter = _iceberg_delete_rows.begin();
-    auto iter_end = _iceberg_delete_rows.end();
-    std::vector<vec_pair> rows_array;
-    for (auto* rows : delete_rows_array) {
-        if (!rows->empty()) {
-            rows_array.emplace_back(rows->begin(), rows->end());
-        }
-    }
-    size_t array_size = rows_array.size();
-    while (row_id_iter != iter_end) {
-        int64_t min_index = 0;
-        int64_t min = *rows_array[0].first;
-        for (size_t i = 0; i < array_size; ++i) {
-            if (*rows_array[i].first < min) {
-                min_index = i;
-                min = *rows_array[i].first;
-            }
-        }
-        *row_id_iter++ = min;
-        rows_array[min_index].first++;
-        if (UNLIKELY(rows_array[min_index].first == rows_array[min_index].second)) {
-            rows_array.erase(rows_array.begin() + min_index);
-            array_size--;
-        }
-    }
-}
-
 void IcebergTableReader::_gen_position_delete_file_range(Block& block, DeleteFile* position_delete,
                                                          size_t read_rows,
                                                          bool file_path_column_dictionary_coded) {
@@ -31,6 +31,7 @@
 #include "runtime/primitive_type.h"
 #include "runtime/types.h"
 #include "table_format_reader.h"
+#include "util/deletion_vector_cache.h"
 #include "vec/columns/column_dictionary.h"
 #include "vec/exec/format/orc/vorc_reader.h"
 #include "vec/exec/format/parquet/vparquet_reader.h"
@@ -91,20 +92,21 @@ protected:
         RuntimeProfile::Counter* num_delete_rows;
         RuntimeProfile::Counter* delete_files_read_time;
         RuntimeProfile::Counter* delete_rows_sort_time;
+        RuntimeProfile::Counter* num_equality_delete_rows = nullptr;
+        RuntimeProfile::Counter* equality_delete_build_time = nullptr;
+        RuntimeProfile::Counter* equality_delete_filter_time = nullptr;
+    };
+    // The equality delete set built from the delete files, shared by the readers in kv cache
+    struct EqualityDeleteSet {
+        std::vector<std::string> col_names;
+        std::vector<DataTypePtr> col_types;
+        std::unique_ptr<EqualityDeleteBase> impl;
     };
     using DeleteRows = std::vector<int64_t>;
     using DeleteFile = phmap::parallel_flat_hash_map<
             std::string, std::unique_ptr<DeleteRows>, std::hash<std::string>, std::equal_to<>,
             std::allocator<std::pair<const std::string, std::unique_ptr<DeleteRows>>>, 8,
             std::mutex>;
-    /**
-     * https://iceberg.apache.org/spec/#position-delete-files
-     * The rows in the delete file must be sorted by file_path then position to optimize filtering rows while scanning.
-     * Sorting by file_path allows filter pushdown by file in columnar storage formats.
-     * Sorting by position allows filtering rows while scanning, to avoid keeping deletes in memory.
-     */
-    void _sort_delete_rows(std::vector<std::vector<int64_t>*>& delete_rows_array,
-                           int64_t num_delete_rows);
 
     PositionDeleteRange _get_range(const ColumnDictI32& file_path_column);
 
@@ -112,9 +114,20 @@ protected:
 
     static std::string _delet_file_cache_key(const std::string& path) { return "delete_" + path; }
 
+    // FE assigns the delete files by the sequence numbers of the data files, so the data files
+    // with the same delete files have the same equality delete set.
+    static std::string _equality_delete_cache_key(
+            const std::vector<TIcebergDeleteFileDesc>& delete_files);
+
     Status _position_delete_base(const std::string data_file_path,
                                  const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    // Add the positions of data_file_path deleted by delete_file to bitmap.
+    Status _read_position_deletes(const std::string& data_file_path,
+                                  const TIcebergDeleteFileDesc& delete_file,
+                                  DeletionVectorCache::Bitmap* bitmap);
     Status _equality_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    Status _build_equality_delete_set(const std::vector<TIcebergDeleteFileDesc>& delete_files,
+                                      EqualityDeleteSet* delete_set);
     virtual std::unique_ptr<GenericReader> _create_equality_reader(
             const TFileRangeDesc& delete_desc) = 0;
     void _generate_equality_delete_block(Block* block,
@@ -148,9 +161,8 @@ protected:
     void _gen_position_delete_file_range(Block& block, DeleteFile* const position_delete,
                                          size_t read_rows, bool file_path_column_dictionary_coded);
 
-    // equality delete
-    Block _equality_delete_block;
-    std::unique_ptr<EqualityDeleteBase> _equality_delete_impl;
+    // equality delete, owned by the EqualityDeleteSet in kv cache
+    const EqualityDeleteBase* _equality_delete_impl = nullptr;
 };
 
 class IcebergParquetReader final : public IcebergTableReader {
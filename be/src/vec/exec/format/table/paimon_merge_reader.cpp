@@ -0,0 +1,173 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/table/paimon_merge_reader.h"
+
+#include "common/exception.h"
+#include "vec/core/sort_description.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+PaimonMergeReader::PaimonMergeReader(std::vector<std::unique_ptr<GenericReader>> runs,
+                                     std::vector<std::string> key_columns,
+                                     std::vector<std::string> sequence_columns,
+                                     size_t batch_size, RuntimeProfile* profile)
+        : _runs(std::move(runs)),
+          _key_columns(std::move(key_columns)),
+          _sequence_columns(std::move(sequence_columns)),
+          _batch_size(batch_size),
+          _profile(profile) {
+    static const char* merge_profile = "PaimonMergeProfile";
+    ADD_TIMER(_profile, merge_profile);
+    _merged_rows = ADD_CHILD_COUNTER(_profile, "MergedRows", TUnit::UNIT, merge_profile);
+    _deduplicated_rows =
+            ADD_CHILD_COUNTER(_profile, "DeduplicatedRows", TUnit::UNIT, merge_profile);
+}
+
+Status PaimonMergeReader::_init(const Block& block) {
+    _header = block.clone_empty();
+    auto position_of = [&](const std::string& name, int* position) {
+        if (!_header.has(name)) {
+            return Status::InternalError("Can't find the column '{}' to merge paimon runs", name);
+        }
+        *position = static_cast<int>(_header.get_position_by_name(name));
+        return Status::OK();
+    };
+    SortDescription sort_description;
+    for (const auto& name : _key_columns) {
+        int position;
+        RETURN_IF_ERROR(position_of(name, &position));
+        _key_positions.push_back(position);
+        sort_description.emplace_back(position, 1, 1);
+    }
+    for (const auto& name : _sequence_columns) {
+        int position;
+        RETURN_IF_ERROR(position_of(name, &position));
+        sort_description.emplace_back(position, 1, 1);
+    }
+    int sequence_number_position;
+    RETURN_IF_ERROR(position_of(SEQUENCE_NUMBER, &sequence_number_position));
+    sort_description.emplace_back(sequence_number_position, 1, 1);
+    RETURN_IF_ERROR(position_of(VALUE_KIND, &_value_kind_position));
+
+    _merger = std::make_unique<VSortedRunMerger>(sort_description, _batch_size, -1, 0, _profile);
+    std::vector<BlockSupplier> suppliers;
+    for (size_t i = 0; i < _runs.size(); ++i) {
+        suppliers.emplace_back(
+                [this, i](Block* run_block, bool* eos) { return _read_run(i, run_block, eos); });
+    }
+    RETURN_IF_ERROR(_merger->prepare(suppliers));
+    _pending = _header.clone_empty();
+    _inited = true;
+    return Status::OK();
+}
+
+Status PaimonMergeReader::_read_run(size_t run, Block* block, bool* eos) {
+    *eos = false;
+    while (!*eos) {
+        *block = _header.clone_empty();
+        size_t read_rows = 0;
+        RETURN_IF_ERROR(_runs[run]->get_next_block(block, &read_rows, eos));
+        if (block->rows() > 0) {
+            COUNTER_UPDATE(_merged_rows, block->rows());
+            return Status::OK();
+        }
+    }
+    block->clear();
+    return Status::OK();
+}
+
+Status PaimonMergeReader::get_next_block(Block* block, size_t* read_rows, bool* eof) {
+    if (!_inited) {
+        RETURN_IF_ERROR(_init(*block));
+    }
+    *eof = false;
+    while (block->rows() == 0 && !*eof) {
+        Block merged;
+        if (!_merge_eos) {
+            RETURN_IF_CATCH_EXCEPTION(RETURN_IF_ERROR(_merger->get_next(&merged, &_merge_eos)));
+        }
+        RETURN_IF_ERROR(_deduplicate(&merged, block));
+        *eof = _merge_eos && _pending.rows() == 0;
+    }
+    *read_rows = block->rows();
+    return Status::OK();
+}
+
+Status PaimonMergeReader::_deduplicate(Block* merged, Block* block) {
+    if (_pending.rows() == 0) {
+        _pending.swap(*merged);
+    } else if (merged->rows() > 0) {
+        MutableBlock pending(&_pending);
+        RETURN_IF_ERROR(pending.merge(*merged));
+    }
+    size_t rows = _pending.rows();
+    if (rows == 0) {
+        return Status::OK();
+    }
+    auto value_kinds = remove_nullable(_pending.get_by_position(_value_kind_position).column);
+    IColumn::Filter filter(rows, 0);
+    size_t kept_rows = 0;
+    for (size_t i = 0; i + 1 < rows; ++i) {
+        bool same_key = true;
+        for (int position : _key_positions) {
+            const auto& column = _pending.get_by_position(position).column;
+            if (column->compare_at(i, i + 1, *column, 1) != 0) {
+                same_key = false;
+                break;
+            }
+        }
+        if (!same_key) {
+            int64_t value_kind = value_kinds->get_int(i);
+            filter[i] = value_kind != UPDATE_BEFORE && value_kind != DELETE;
+            kept_rows += filter[i];
+        }
+    }
+
+    // the following rows of the last key may be in the next merged block
+    Block last_row = _header.clone_empty();
+    if (_merge_eos) {
+        int64_t value_kind = value_kinds->get_int(rows - 1);
+        filter[rows - 1] = value_kind != UPDATE_BEFORE && value_kind != DELETE;
+        kept_rows += filter[rows - 1];
+    } else {
+        for (size_t i = 0; i < _pending.columns(); ++i) {
+            auto& column = last_row.get_by_position(i).column;
+            column = _pending.get_by_position(i).column->cut(rows - 1, 1);
+        }
+    }
+    COUNTER_UPDATE(_deduplicated_rows, (_merge_eos ? rows : rows - 1) - kept_rows);
+
+    if (kept_rows > 0) {
+        // block is empty here
+        Block::filter_block_internal(&_pending, filter);
+        block->swap(_pending);
+    }
+    _pending.swap(last_row);
+    return Status::OK();
+}
+
+Status PaimonMergeReader::close() {
+    for (auto& run : _runs) {
+        RETURN_IF_ERROR(run->close());
+    }
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "util/runtime_profile.h"
+#include "vec/core/block.h"
+#include "vec/exec/format/generic_reader.h"
+#include "vec/runtime/vsorted_run_merger.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+/**
+ * Merge-on-read of the sorted runs in a bucket of a paimon primary-key table.
+ *
+ * Each run is read by a native format reader, such as `ParquetReader` or `OrcReader`, into blocks
+ * with the columns of the output block, which include the primary keys, the sequence fields,
+ * `_SEQUENCE_NUMBER` and `_VALUE_KIND`. The runs are merged by `VSortedRunMerger` on the primary
+ * keys, the sequence fields and `_SEQUENCE_NUMBER`, and only the last row of each primary key is
+ * returned, unless it's a retraction. This is the deduplicate merge engine of paimon.
+ */
+class PaimonMergeReader : public GenericReader {
+public:
+    ENABLE_FACTORY_CREATOR(PaimonMergeReader);
+
+    static constexpr const char* SEQUENCE_NUMBER = "_SEQUENCE_NUMBER";
+    static constexpr const char* VALUE_KIND = "_VALUE_KIND";
+    // the row kinds of paimon which retract the previous rows of the key
+    static constexpr int64_t UPDATE_BEFORE = 1;
+    static constexpr int64_t DELETE = 3;
+
+    // The runs are ordered from the oldest to the newest, a newer run wins if the sequences of
+    // a key are the same.
+    PaimonMergeReader(std::vector<std::unique_ptr<GenericReader>> runs,
+                      std::vector<std::string> key_columns,
+                      std::vector<std::string> sequence_columns, size_t batch_size,
+                      RuntimeProfile* profile);
+
+    ~PaimonMergeReader() override = default;
+
+    Status get_next_block(Block* block, size_t* read_rows, bool* eof) override;
+
+    Status close() override;
+
+private:
+    Status _init(const Block& block);
+
+    Status _read_run(size_t run, Block* block, bool* eos);
+
+    // Append the last rows of the keys in _pending and merged to block, the last row is kept in
+    // _pending if more rows may follow.
+    Status _deduplicate(Block* merged, Block* block);
+
+    std::vector<std::unique_ptr<GenericReader>> _runs;
+    std::vector<std::string> _key_columns;
+    std::vector<std::string> _sequence_columns;
+    size_t _batch_size;
+    RuntimeProfile* _profile;
+
+    bool _inited = false;
+    bool _merge_eos = false;
+    Block _header;
+    std::vector<int> _key_positions;
+    int _value_kind_position = -1;
+    std::unique_ptr<VSortedRunMerger> _merger;
+    Block _pending;
+
+    RuntimeProfile::Counter* _merged_rows = nullptr;
+    RuntimeProfile::Counter* _deduplicated_rows = nullptr;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
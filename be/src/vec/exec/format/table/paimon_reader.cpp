@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "common/status.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "util/deletion_vector.h"
 
@@ -67,6 +68,23 @@ Status PaimonReader::init_row_filters() {
     }
 
     const auto& deletion_file = table_desc.deletion_file;
+    DeletionVectorCache::Handle handle;
+    RETURN_IF_ERROR(DeletionVectorCache::get(
+            ExecEnv::GetInstance()->deletion_vector_cache(),
+            DeletionVectorCache::paimon_key(deletion_file.path, deletion_file.offset,
+                                            deletion_file.length),
+            [&](DeletionVectorCache::Bitmap* bitmap) { return _read_deletion_vector(bitmap); },
+            &handle));
+    if (!handle.bitmap().isEmpty()) {
+        DeletionVectorCache::to_positions({&handle.bitmap()}, &_delete_rows);
+        COUNTER_UPDATE(_paimon_profile.num_delete_rows, _delete_rows.size());
+        set_delete_rows();
+    }
+    return Status::OK();
+}
+
+Status PaimonReader::_read_deletion_vector(DeletionVectorCache::Bitmap* bitmap) {
+    const auto& deletion_file = _range.table_format_params.paimon_params.deletion_file;
     io::FileSystemProperties properties = {
             .system_type = _params.file_type,
             .properties = _params.properties,
@@ -89,7 +107,6 @@ Status PaimonReader::init_row_filters() {
             .fs_name = _range.fs_name,
     };
 
-    // TODO: cache the file in local
     auto delete_file_reader = DORIS_TRY(FileFactory::create_file_reader(
             properties, file_description, io::FileReaderOptions::DEFAULT));
     // the reason of adding 4: https://github.com/apache/paimon/issues/3313
@@ -110,15 +127,7 @@ Status PaimonReader::init_row_filters() {
                 deletion_file.path, deletion_file.offset, deletion_file.length + 4, bytes_read);
     }
     auto deletion_vector = DORIS_TRY(DeletionVector::deserialize(result.data, result.size));
-    if (!deletion_vector.is_empty()) {
-        for (auto i = deletion_vector.minimum(); i <= deletion_vector.maximum(); i++) {
-            if (deletion_vector.is_delete(i)) {
-                _delete_rows.push_back(i);
-            }
-        }
-        COUNTER_UPDATE(_paimon_profile.num_delete_rows, _delete_rows.size());
-        set_delete_rows();
-    }
+    *bitmap = DeletionVectorCache::Bitmap(deletion_vector.roaring());
     return Status::OK();
 }
 
@@ -20,6 +20,7 @@
 #include <memory>
 #include <vector>
 
+#include "util/deletion_vector_cache.h"
 #include "vec/exec/format/orc/vorc_reader.h"
 #include "vec/exec/format/parquet/vparquet_reader.h"
 #include "vec/exec/format/table/table_format_reader.h"
@@ -50,6 +51,9 @@ protected:
     PaimonProfile _paimon_profile;
 
     virtual void set_delete_rows() = 0;
+
+private:
+    Status _read_deletion_vector(DeletionVectorCache::Bitmap* bitmap);
 };
 
 class PaimonOrcReader final : public PaimonReader {
@@ -17,11 +17,16 @@
 
 #include "jni_connector.h"
 
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
+#include <arrow/record_batch.h>
 #include <glog/logging.h>
 
 #include <sstream>
 #include <variant>
 
+#include "common/config.h"
+#include "common/exception.h"
 #include "jni.h"
 #include "runtime/decimalv2_value.h"
 #include "runtime/runtime_state.h"
@@ -117,6 +122,9 @@ Status JniConnector::get_next_block(Block* block, size_t* read_rows, bool* eof)
     // return the address of meta information
     JNIEnv* env = nullptr;
     RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
+    if (_jni_scanner_get_next_batch_arrow != nullptr) {
+        return _get_next_arrow_block(env, block, read_rows, eof);
+    }
     long meta_address = 0;
     {
         SCOPED_RAW_TIMER(&_java_scan_watcher);
@@ -145,6 +153,74 @@ Status JniConnector::get_next_block(Block* block, size_t* read_rows, bool* eof)
     return Status::OK();
 }
 
+Status JniConnector::_get_next_arrow_block(JNIEnv* env, Block* block, size_t* read_rows,
+                                           bool* eof) {
+    // Call org.apache.doris.common.jni.JniScanner#getNextBatchArrow, which exports the next batch
+    // into the structs, and returns the number of rows
+    ArrowArray array {};
+    ArrowSchema schema {};
+    long num_rows = 0;
+    {
+        SCOPED_RAW_TIMER(&_java_scan_watcher);
+        num_rows = env->CallLongMethod(_jni_scanner_obj, _jni_scanner_get_next_batch_arrow,
+                                       reinterpret_cast<jlong>(&array),
+                                       reinterpret_cast<jlong>(&schema));
+    }
+    if (env->ExceptionCheck() || num_rows == 0) {
+        // the structs are not imported, release the exported batch if there is one
+        if (array.release != nullptr) {
+            array.release(&array);
+        }
+        if (schema.release != nullptr) {
+            schema.release(&schema);
+        }
+    }
+    RETURN_ERROR_IF_EXC(env);
+    if (num_rows == 0) {
+        *read_rows = 0;
+        *eof = true;
+        return Status::OK();
+    }
+    SCOPED_RAW_TIMER(&_fill_block_watcher);
+    size_t batch_rows = 0;
+    RETURN_IF_ERROR(
+            fill_block_from_arrow(block, &array, &schema, _state->timezone_obj(), &batch_rows));
+    *read_rows = batch_rows;
+    *eof = false;
+    _has_read += batch_rows;
+    return Status::OK();
+}
+
+Status JniConnector::fill_block_from_arrow(Block* block, ArrowArray* array, ArrowSchema* schema,
+                                           const cctz::time_zone& ctz, size_t* num_rows) {
+    // The imported batch holds the java buffers until it's destroyed, and the fixed-width buffers
+    // are copied into the columns in bulk, only the strings and nested types are converted.
+    auto batch_result = arrow::ImportRecordBatch(array, schema);
+    if (!batch_result.ok()) {
+        return Status::InternalError("Failed to import the arrow batch of jni scanner: {}",
+                                     batch_result.status().message());
+    }
+    std::shared_ptr<arrow::RecordBatch> batch = std::move(batch_result).ValueUnsafe();
+    auto rows = batch->num_rows();
+    for (int c = 0; c < batch->num_columns(); ++c) {
+        const std::string& column_name = batch->schema()->field(c)->name();
+        auto* column_with_name = block->try_get_by_name(column_name);
+        if (column_with_name == nullptr) {
+            return Status::InternalError("Can't find the column '{}' of the arrow batch",
+                                         column_name);
+        }
+        try {
+            RETURN_IF_ERROR(column_with_name->type->get_serde()->read_column_from_arrow(
+                    column_with_name->column->assume_mutable_ref(), batch->column(c).get(), 0,
+                    rows, ctz));
+        } catch (Exception& e) {
+            return Status::InternalError("Failed to convert from arrow to block: {}", e.what());
+        }
+    }
+    *num_rows = rows;
+    return Status::OK();
+}
+
 Status JniConnector::get_table_schema(std::string& table_schema_str) {
     JNIEnv* env = nullptr;
     RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
@@ -258,6 +334,15 @@ Status JniConnector::_init_jni_scanner(JNIEnv* env, int batch_size) {
     _jni_scanner_release_table = env->GetMethodID(_jni_scanner_cls, "releaseTable", "()V");
     _jni_scanner_get_statistics =
             env->GetMethodID(_jni_scanner_cls, "getStatistics", "()Ljava/util/Map;");
+    if (config::enable_jni_arrow_c_data_interface) {
+        // optional, the scanners reading arrow vectors export the batches without copying them
+        // into the address table
+        _jni_scanner_get_next_batch_arrow =
+                env->GetMethodID(_jni_scanner_cls, "getNextBatchArrow", "(JJ)J");
+        if (_jni_scanner_get_next_batch_arrow == nullptr) {
+            env->ExceptionClear();
+        }
+    }
     RETURN_IF_ERROR(JniUtil::LocalToGlobalRef(env, jni_scanner_obj, &_jni_scanner_obj));
     env->DeleteLocalRef(jni_scanner_obj);
     RETURN_ERROR_IF_EXC(env);
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cctz/time_zone.h>
 #include <jni.h>
 #include <string.h>
 
@@ -40,6 +41,9 @@
 #include "vec/common/string_ref.h"
 #include "vec/data_types/data_type.h"
 
+struct ArrowArray;
+struct ArrowSchema;
+
 namespace doris {
 class RuntimeState;
 
@@ -272,6 +276,14 @@ public:
 
     static Status fill_block(Block* block, const ColumnNumbers& arguments, long table_address);
 
+    /**
+     * Append the rows of a batch exported through the arrow c data interface to the columns of
+     * block with the same names, *num_rows is set to the rows of the batch. The batch is released
+     * even if it fails.
+     */
+    static Status fill_block_from_arrow(Block* block, ArrowArray* array, ArrowSchema* schema,
+                                        const cctz::time_zone& ctz, size_t* num_rows);
+
 protected:
     void _collect_profile_before_close() override;
 
@@ -312,6 +324,9 @@ private:
     jmethodID _jni_scanner_release_column;
     jmethodID _jni_scanner_release_table;
     jmethodID _jni_scanner_get_statistics;
+    // org.apache.doris.common.jni.JniScanner#getNextBatchArrow, nullptr if the scanner doesn't
+    // export the batches through the arrow c data interface
+    jmethodID _jni_scanner_get_next_batch_arrow = nullptr;
 
     TableMetaAddress _table_meta;
 
@@ -327,6 +342,8 @@ private:
 
     Status _fill_block(Block* block, size_t num_rows);
 
+    Status _get_next_arrow_block(JNIEnv* env, Block* block, size_t* read_rows, bool* eof);
+
     static Status _fill_column(TableMetaAddress& address, ColumnPtr& doris_column,
                                DataTypePtr& data_type, size_t num_rows);
 
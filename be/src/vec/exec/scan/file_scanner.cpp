@@ -38,6 +38,7 @@
 #include "common/logging.h"
 #include "common/status.h"
 #include "exec/rowid_fetcher.h"
+#include "exprs/hybrid_set.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
@@ -48,6 +49,7 @@
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/string_ref.h"
+#include "vec/common/typeid_cast.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/columns_with_type_and_name.h"
 #include "vec/data_types/data_type.h"
@@ -76,6 +78,8 @@
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vexpr_fwd.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vruntimefilter_wrapper.h"
 #include "vec/exprs/vslot_ref.h"
 #include "vec/functions/function.h"
 #include "vec/functions/function_string.h"
@@ -94,6 +98,58 @@ class ShardedKVCache;
 namespace doris::vectorized {
 using namespace ErrorCode;
 
+namespace {
+// Narrows 'range' by the min/max or in runtime filter 'impl' on the column of 'slot_ref'.
+template <PrimitiveType T>
+void narrow_range_by_runtime_filter(const VExpr* impl, const VSlotRef* slot_ref,
+                                    ColumnValueRange<T>& range, int max_in_values) {
+    // the values of these types need the conversions of ScanLocalState::_change_value_range
+    if constexpr (T != TYPE_DATE && T != TYPE_DATETIME && T != TYPE_HLL) {
+        using CppType = typename ColumnValueRange<T>::CppType;
+        constexpr bool is_string = T == TYPE_CHAR || T == TYPE_VARCHAR || T == TYPE_STRING;
+        if (remove_nullable(slot_ref->data_type())->get_primitive_type() != T) {
+            return;
+        }
+        // the strings are given as StringRef, the other values as themselves
+        auto to_value = [](const void* data) {
+            if constexpr (is_string) {
+                return *reinterpret_cast<const StringRef*>(data);
+            } else {
+                CppType value;
+                memcpy(&value, data, sizeof(CppType));
+                return value;
+            }
+        };
+        if (impl->node_type() == TExprNodeType::IN_PRED) {
+            auto hybrid_set = impl->get_set_func();
+            if (hybrid_set == nullptr || hybrid_set->size() > max_in_values) {
+                return;
+            }
+            auto in_range = ColumnValueRange<T>::create_empty_column_value_range(
+                    range.is_nullable_col(), range.precision(), range.scale());
+            auto* iter = hybrid_set->begin();
+            while (iter->has_next()) {
+                static_cast<void>(in_range.add_fixed_value(to_value(iter->get_value())));
+                iter->next();
+            }
+            range.intersection(in_range);
+        } else if (impl->node_type() == TExprNodeType::BINARY_PRED &&
+                   impl->get_num_children() == 2 && impl->children()[1]->is_literal() &&
+                   (impl->op() == TExprOpcode::GE || impl->op() == TExprOpcode::LE)) {
+            const auto& column = static_cast<const VLiteral*>(impl->children()[1].get())
+                                         ->get_column_ptr();
+            if (column->is_null_at(0)) {
+                return;
+            }
+            auto data = column->get_data_at(0);
+            static_cast<void>(range.add_range(
+                    impl->op() == TExprOpcode::GE ? FILTER_LARGER_OR_EQUAL : FILTER_LESS_OR_EQUAL,
+                    to_value(is_string ? static_cast<const void*>(&data) : data.data)));
+        }
+    }
+}
+} // namespace
+
 FileScanner::FileScanner(
         RuntimeState* state, pipeline::FileScanLocalState* local_state, int64_t limit,
         std::shared_ptr<vectorized::SplitSourceConnector> split_source, RuntimeProfile* profile,
@@ -106,6 +162,7 @@ FileScanner::FileScanner(
           _cur_reader_eof(false),
           _colname_to_value_range(colname_to_value_range),
           _kv_cache(kv_cache),
+          _scan_colname_to_value_range(colname_to_value_range),
           _strict_mode(false),
           _col_name_to_slot_id(colname_to_slot_id) {
     if (state->get_query_ctx() != nullptr &&
@@ -333,6 +390,7 @@ Status FileScanner::_process_late_arrival_conjuncts() {
             RETURN_IF_ERROR(_conjuncts[i]->clone(_state, _push_down_conjuncts[i]));
         }
         RETURN_IF_ERROR(_process_conjuncts_for_dict_filter());
+        _narrow_value_range_by_runtime_filters();
         _discard_conjuncts();
     }
     if (_applied_rf_num == _total_rf_num) {
@@ -341,6 +399,38 @@ Status FileScanner::_process_late_arrival_conjuncts() {
     return Status::OK();
 }
 
+void FileScanner::_narrow_value_range_by_runtime_filters() {
+    if (_scan_colname_to_value_range == nullptr) {
+        return;
+    }
+    const auto& query_options = _state->query_options();
+    const int max_in_values = query_options.__isset.max_pushdown_conditions_per_column
+                                      ? query_options.max_pushdown_conditions_per_column
+                                      : 1024;
+    _runtime_filter_value_range = *_scan_colname_to_value_range;
+    for (const auto& conjunct : _push_down_conjuncts) {
+        auto* wrapper = typeid_cast<VRuntimeFilterWrapper*>(conjunct->root().get());
+        if (wrapper == nullptr || wrapper->null_aware()) {
+            continue;
+        }
+        auto impl = wrapper->get_impl();
+        if (impl->get_num_children() == 0 || !impl->children()[0]->is_slot_ref()) {
+            continue;
+        }
+        const auto* slot_ref = static_cast<const VSlotRef*>(impl->children()[0].get());
+        auto iter = _runtime_filter_value_range.find(slot_ref->expr_name());
+        if (iter == _runtime_filter_value_range.end()) {
+            continue;
+        }
+        std::visit(
+                [&](auto& range) {
+                    narrow_range_by_runtime_filter(impl.get(), slot_ref, range, max_in_values);
+                },
+                iter->second);
+    }
+    _colname_to_value_range = &_runtime_filter_value_range;
+}
+
 void FileScanner::_get_slot_ids(VExpr* expr, std::vector<int>* slot_ids) {
     for (auto& child_expr : expr->children()) {
         if (child_expr->is_slot_ref()) {
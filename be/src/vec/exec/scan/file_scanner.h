@@ -167,6 +167,12 @@ protected:
     std::unique_ptr<RowDescriptor> _default_val_row_desc;
     // owned by scan node
     ShardedKVCache* _kv_cache = nullptr;
+    // The value ranges of the scan operator. The runtime filters arriving after the scanner
+    // starts narrow a copy of them, which becomes _colname_to_value_range, so that the
+    // readers prune row groups and pages by them too.
+    const std::unordered_map<std::string, ColumnValueRangeType>* _scan_colname_to_value_range =
+            nullptr;
+    std::unordered_map<std::string, ColumnValueRangeType> _runtime_filter_value_range;
 
     bool _scanner_eof = false;
     int _rows = 0;
@@ -244,6 +250,7 @@ private:
     Status _process_runtime_filters_partition_prune(bool& is_partition_pruned);
     Status _process_conjuncts_for_dict_filter();
     Status _process_late_arrival_conjuncts();
+    void _narrow_value_range_by_runtime_filters();
     void _get_slot_ids(VExpr* expr, std::vector<int>* slot_ids);
     Status _generate_truncate_columns(bool need_to_get_parsed_schema);
     Status _set_fill_or_truncate_columns(bool need_to_get_parsed_schema);
@@ -711,10 +711,14 @@ void OlapScanner::_collect_profile_before_close() {
     tablet->query_scan_bytes->increment(local_state->_read_compressed_counter->value());
     tablet->query_scan_rows->increment(local_state->_scan_rows->value());
     tablet->query_scan_count->increment(1);
-    _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_local_storage(
-            stats.file_cache_stats.bytes_read_from_local);
-    _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_remote_storage(
+    auto* io_context = _state->get_query_ctx()->resource_ctx()->io_context();
+    io_context->update_scan_bytes_from_local_storage(stats.file_cache_stats.bytes_read_from_local);
+    io_context->update_scan_bytes_from_remote_storage(
             stats.file_cache_stats.bytes_read_from_remote);
+    // the page cache hits are too frequent to be recorded one by one by the page reader
+    io_context->update_read(IOContext::ReadTier::PAGE_CACHE,
+                            stats.cached_pages_num + stats.compressed_cached_pages_num,
+                            stats.cached_pages_bytes, -1);
 }
 
 } // namespace doris::vectorized
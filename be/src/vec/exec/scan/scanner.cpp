@@ -68,6 +68,8 @@ Status Scanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts)
             }
         }
     }
+    _shared_expr_results = SharedExprResults::create(_local_state->_parent->_num_shared_exprs,
+                                                     _projections, _intermediate_projections);
 
     return Status::OK();
 }
@@ -179,6 +181,9 @@ Status Scanner::_do_projections(vectorized::Block* origin_block, vectorized::Blo
 
     std::vector<int> result_column_ids;
     for (auto& projections : _intermediate_projections) {
+        if (_shared_expr_results) {
+            _shared_expr_results->reset();
+        }
         result_column_ids.resize(projections.size());
         for (int i = 0; i < projections.size(); i++) {
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
@@ -193,12 +198,20 @@ Status Scanner::_do_projections(vectorized::Block* origin_block, vectorized::Blo
     auto& mutable_columns = mutable_block.mutable_columns();
 
     DCHECK_EQ(mutable_columns.size(), _projections.size());
+    if (_shared_expr_results) {
+        _shared_expr_results->reset();
+    }
 
+    // The dictionary codes of the projected slots, they are attached to the output columns.
+    std::vector<std::pair<size_t, ColumnDictCodesPtr>> dict_codes;
     for (int i = 0; i < mutable_columns.size(); ++i) {
         auto result_column_id = -1;
         RETURN_IF_ERROR(_projections[i]->execute(&input_block, &result_column_id));
         auto column_ptr = input_block.get_by_position(result_column_id)
                                   .column->convert_to_full_column_if_const();
+        if (auto codes = input_block.get_dict_codes(column_ptr.get())) {
+            dict_codes.emplace_back(i, std::move(codes));
+        }
         //TODO: this is a quick fix, we need a new function like "change_to_nullable" to do it
         if (mutable_columns[i]->is_nullable() xor column_ptr->is_nullable()) {
             DCHECK(mutable_columns[i]->is_nullable() && !column_ptr->is_nullable());
@@ -210,6 +223,9 @@ Status Scanner::_do_projections(vectorized::Block* origin_block, vectorized::Blo
     }
     DCHECK(mutable_block.rows() == rows);
     output_block->set_columns(std::move(mutable_columns));
+    for (auto& [position, codes] : dict_codes) {
+        output_block->set_dict_codes(position, std::move(codes));
+    }
 
     return Status::OK();
 }
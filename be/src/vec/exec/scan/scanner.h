@@ -28,6 +28,7 @@
 #include "runtime/runtime_state.h"
 #include "util/stopwatch.hpp"
 #include "vec/core/block.h"
+#include "vec/exprs/vshared_expr.h"
 
 namespace doris {
 class RuntimeProfile;
@@ -204,6 +205,7 @@ protected:
     VExprContextSPtrs _projections;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    std::unique_ptr<SharedExprResults> _shared_expr_results;
     vectorized::Block _origin_block;
 
     VExprContextSPtrs _common_expr_ctxs_push_down;
@@ -196,6 +196,8 @@ Status ScannerContext::init() {
 
     // Avoid corner case.
     _min_scan_concurrency = std::min(_min_scan_concurrency, _max_scan_concurrency);
+    _target_scan_concurrency = _max_scan_concurrency;
+    _last_adjust_concurrency_ms = MonotonicMillis();
 
     COUNTER_SET(_local_state->_max_scan_concurrency, (int64_t)_max_scan_concurrency);
     COUNTER_SET(_local_state->_min_scan_concurrency, (int64_t)_min_scan_concurrency);
@@ -270,6 +272,8 @@ void ScannerContext::push_back_scan_task(std::shared_ptr<ScanTask> scan_task) {
     }
     _tasks_queue.push_back(scan_task);
     _num_scheduled_scanners--;
+    _scan_tasks_cpu_ns += scan_task->cpu_time_ns;
+    _scan_tasks_wall_ns += scan_task->wall_time_ns;
 
     _dependency->set_ready();
 }
@@ -326,6 +330,7 @@ Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::Blo
             if (!_tasks_queue.empty()) {
                 _tasks_queue.pop_front();
             }
+            _adjust_scan_concurrency();
 
             if (scan_task->is_eos()) {
                 // 1. if eos, record a finished scanner.
@@ -347,6 +352,7 @@ Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::Blo
     *eos = done();
 
     if (_tasks_queue.empty()) {
+        _consumer_starved = !*eos;
         _dependency->block();
     }
 
@@ -444,10 +450,10 @@ std::string ScannerContext::debug_string() {
             "id: {}, total scanners: {}, pending tasks: {},"
             " _should_stop: {}, _is_finished: {}, free blocks: {},"
             " limit: {}, _num_running_scanners: {}, _max_thread_num: {},"
-            " _max_bytes_in_queue: {}, query_id: {}",
+            " _target_scan_concurrency: {}, _max_bytes_in_queue: {}, query_id: {}",
             ctx_id, _all_scanners.size(), _tasks_queue.size(), _should_stop, _is_finished,
             _free_blocks.size_approx(), limit, _num_scheduled_scanners, _max_scan_concurrency,
-            _max_bytes_in_queue, print_id(_query_id));
+            _target_scan_concurrency, _max_bytes_in_queue, print_id(_query_id));
 }
 
 void ScannerContext::_set_scanner_done() {
@@ -490,6 +496,46 @@ int32_t ScannerContext::_get_margin(std::unique_lock<std::mutex>& transfer_lock,
     return margin;
 }
 
+// AIMD on the number of running scanners:
+// 1. If the consumer has waited for blocks, the scanners are the bottleneck, add one scanner, or
+//    two if the scanners spent most of their time waiting for IO, e.g. on remote storage.
+// 2. Otherwise if the queued blocks use up the memory of the scan queue, the consumer is the
+//    bottleneck and more scanners only take more memory, halve the scanners.
+void ScannerContext::_adjust_scan_concurrency() {
+    if (_target_scan_concurrency == 0) {
+        return;
+    }
+    if (!config::enable_adaptive_scan_concurrency) {
+        _target_scan_concurrency = _max_scan_concurrency;
+        return;
+    }
+    const int64_t now_ms = MonotonicMillis();
+    if (now_ms - _last_adjust_concurrency_ms < config::adaptive_scan_concurrency_interval_ms) {
+        return;
+    }
+
+    int32_t target = _target_scan_concurrency;
+    if (_consumer_starved) {
+        const bool io_bound = _scan_tasks_cpu_ns * 2 < _scan_tasks_wall_ns;
+        target = std::min(_max_scan_concurrency, target + (io_bound ? 2 : 1));
+    } else if (_block_memory_usage >= _max_bytes_in_queue) {
+        target = std::max(_min_scan_concurrency, target / 2);
+    }
+    if (target != _target_scan_concurrency) {
+        VLOG_DEBUG << fmt::format(
+                "ScannerContext {} adjust scan concurrency {} -> {}, consumer starved: {}, "
+                "block memory usage: {}, scan cpu time: {}ns, scan wall time: {}ns",
+                ctx_id, _target_scan_concurrency, target, _consumer_starved,
+                _block_memory_usage.load(), _scan_tasks_cpu_ns, _scan_tasks_wall_ns);
+        _target_scan_concurrency = target;
+    }
+
+    _last_adjust_concurrency_ms = now_ms;
+    _consumer_starved = false;
+    _scan_tasks_cpu_ns = 0;
+    _scan_tasks_wall_ns = 0;
+}
+
 // This function must be called with:
 // 1. _transfer_lock held.
 // 2. SimplifiedScanScheduler::_lock held.
@@ -592,10 +638,10 @@ Status ScannerContext::_schedule_scan_task(std::shared_ptr<ScanTask> current_sca
 
 std::shared_ptr<ScanTask> ScannerContext::_pull_next_scan_task(
         std::shared_ptr<ScanTask> current_scan_task, int32_t current_concurrency) {
-    if (current_concurrency >= _max_scan_concurrency) {
+    if (current_concurrency >= _scan_concurrency_limit()) {
         VLOG_DEBUG << fmt::format(
-                "ScannerContext {} current concurrency {} >= _max_scan_concurrency {}, skip pull",
-                ctx_id, current_concurrency, _max_scan_concurrency);
+                "ScannerContext {} current concurrency {} >= scan concurrency limit {}, skip pull",
+                ctx_id, current_concurrency, _scan_concurrency_limit());
         return nullptr;
     }
 
@@ -20,6 +20,7 @@
 #include <bthread/types.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <list>
@@ -80,6 +81,9 @@ private:
 public:
     std::weak_ptr<ScannerDelegate> scanner;
     std::list<std::pair<vectorized::BlockUPtr, size_t>> cached_blocks;
+    // cpu and wall time of the last run of this task in the scan scheduler
+    int64_t cpu_time_ns = 0;
+    int64_t wall_time_ns = 0;
 
     void set_status(Status _status) {
         if (_status.is<ErrorCode::END_OF_FILE>()) {
@@ -258,7 +262,25 @@ protected:
     int32_t _get_margin(std::unique_lock<std::mutex>& transfer_lock,
                         std::unique_lock<std::shared_mutex>& scheduler_lock);
 
-    // TODO: Add implementation of runtime_info_feed_back
+    // Adjust `_target_scan_concurrency` from the feedback since last adjustment.
+    // Must be called with _transfer_lock held.
+    void _adjust_scan_concurrency();
+
+    int32_t _scan_concurrency_limit() const {
+        return _target_scan_concurrency > 0
+                       ? std::min(_target_scan_concurrency, _max_scan_concurrency)
+                       : _max_scan_concurrency;
+    }
+
+    // The limit of running scanners adjusted at runtime, in
+    // [_min_scan_concurrency, _max_scan_concurrency]. 0 means not adjusted.
+    int32_t _target_scan_concurrency = 0;
+    int64_t _last_adjust_concurrency_ms = 0;
+    // Whether the consumer has found no block to get since last adjustment
+    bool _consumer_starved = false;
+    // Cpu and wall time of the scan tasks finished since last adjustment
+    int64_t _scan_tasks_cpu_ns = 0;
+    int64_t _scan_tasks_wall_ns = 0;
     // adaptive scan concurrency related end
 };
 } // namespace vectorized
@@ -40,6 +40,7 @@
 #include "util/async_io.h" // IWYU pragma: keep
 #include "util/cpu_info.h"
 #include "util/defer_op.h"
+#include "util/stopwatch.hpp"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "vec/core/block.h"
@@ -209,6 +210,8 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
 #endif
     MonotonicStopWatch max_run_time_watch;
     max_run_time_watch.start();
+    ThreadCpuStopWatch cpu_watch;
+    cpu_watch.start();
     scanner->update_wait_worker_timer();
     scanner->start_scan_cpu_timer();
     Status status = Status::OK();
@@ -369,6 +372,8 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
         scanner->mark_to_need_to_close();
     }
     scan_task->set_eos(eos);
+    scan_task->cpu_time_ns = cpu_watch.elapsed_time();
+    scan_task->wall_time_ns = max_run_time_watch.elapsed_time();
 
     VLOG_DEBUG << fmt::format(
             "Scanner context {} has finished task, cached_block {} current scheduled task is "
@@ -27,6 +27,7 @@
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
+#include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
@@ -218,86 +219,109 @@ public:
             return Status::OK();
         }
 
-        MutableColumnPtr result_col = nullptr;
+        ColumnPtr result_col;
         DataTypePtr res_type;
         std::string res_name;
 
-        //process first row
-        args_info.array_start = (*args_info.offsets_ptr)[args_info.current_row_idx - 1];
-        args_info.cur_size =
-                (*args_info.offsets_ptr)[args_info.current_row_idx] - args_info.array_start;
-
-        // lambda block to exectute the lambda, and reuse the memory
-        Block lambda_block;
-        auto column_size = names.size();
-        MutableColumns columns(column_size);
-        do {
-            bool mem_reuse = lambda_block.mem_reuse();
-            for (int i = 0; i < column_size; i++) {
-                if (mem_reuse) {
-                    columns[i] = lambda_block.get_by_position(i).column->assume_mutable();
-                } else {
-                    if (_contains_column_id(output_slot_ref_indexs, i) || i >= gap) {
-                        // TODO: maybe could create const column, so not insert_many_from when extand data
-                        // but now here handle batch_size of array nested data every time, so maybe have different rows
-                        columns[i] = data_types[i]->create_column();
+        std::vector<ColumnPtr> captures;
+        if (_broadcast_captures(block, gap, output_slot_ref_indexs, nested_array_column_rows,
+                                &captures)) {
+            // the lambda is executed on the nested columns directly, the captured columns are
+            // broadcast as const columns, so nothing is copied
+            Block lambda_block;
+            for (int i = 0; i < gap; ++i) {
+                lambda_block.insert({captures[i], data_types[i], names[i]});
+            }
+            for (int i = 0; i < arguments.size(); ++i) {
+                lambda_block.insert({lambda_datas[i], data_types[gap + i], names[gap + i]});
+            }
+            RETURN_IF_ERROR(children[0]->execute(context, &lambda_block, result_column_id));
+            const auto& res = lambda_block.get_by_position(*result_column_id);
+            result_col = res.column->convert_to_full_column_if_const();
+            res_type = res.type;
+            res_name = res.name;
+        } else {
+            MutableColumnPtr batch_result_col = nullptr;
+            //process first row
+            args_info.array_start = (*args_info.offsets_ptr)[args_info.current_row_idx - 1];
+            args_info.cur_size =
+                    (*args_info.offsets_ptr)[args_info.current_row_idx] - args_info.array_start;
+
+            // lambda block to exectute the lambda, and reuse the memory
+            Block lambda_block;
+            auto column_size = names.size();
+            MutableColumns columns(column_size);
+            do {
+                bool mem_reuse = lambda_block.mem_reuse();
+                for (int i = 0; i < column_size; i++) {
+                    if (mem_reuse) {
+                        columns[i] = lambda_block.get_by_position(i).column->assume_mutable();
                     } else {
-                        columns[i] = data_types[i]
-                                             ->create_column_const_with_default_value(0)
-                                             ->assume_mutable();
+                        if (_contains_column_id(output_slot_ref_indexs, i) || i >= gap) {
+                            // TODO: maybe could create const column, so not insert_many_from when extand data
+                            // but now here handle batch_size of array nested data every time, so maybe have different rows
+                            columns[i] = data_types[i]->create_column();
+                        } else {
+                            columns[i] = data_types[i]
+                                                 ->create_column_const_with_default_value(0)
+                                                 ->assume_mutable();
+                        }
                     }
                 }
-            }
-            // batch_size of array nested data every time inorder to avoid memory overflow
-            while (columns[gap]->size() < batch_size) {
-                long max_step = batch_size - columns[gap]->size();
-                long current_step = std::min(
-                        max_step, (long)(args_info.cur_size - args_info.current_offset_in_array));
-                size_t pos = args_info.array_start + args_info.current_offset_in_array;
-                for (int i = 0; i < arguments.size() && current_step > 0; ++i) {
-                    columns[gap + i]->insert_range_from(*lambda_datas[i], pos, current_step);
-                }
-                args_info.current_offset_in_array += current_step;
-                args_info.current_repeat_times += current_step;
-                if (args_info.current_offset_in_array >= args_info.cur_size) {
-                    args_info.current_row_eos = true;
-                }
-                _extend_data(columns, block, args_info.current_repeat_times, gap,
-                             args_info.current_row_idx, output_slot_ref_indexs);
-                args_info.current_repeat_times = 0;
-                if (args_info.current_row_eos) {
-                    //current row is end of array, move to next row
-                    args_info.current_row_idx++;
-                    args_info.current_offset_in_array = 0;
-                    if (args_info.current_row_idx >= block->rows()) {
-                        break;
+                // batch_size of array nested data every time inorder to avoid memory overflow
+                while (columns[gap]->size() < batch_size) {
+                    long max_step = batch_size - columns[gap]->size();
+                    long current_step =
+                            std::min(max_step, (long)(args_info.cur_size -
+                                                      args_info.current_offset_in_array));
+                    size_t pos = args_info.array_start + args_info.current_offset_in_array;
+                    for (int i = 0; i < arguments.size() && current_step > 0; ++i) {
+                        columns[gap + i]->insert_range_from(*lambda_datas[i], pos, current_step);
+                    }
+                    args_info.current_offset_in_array += current_step;
+                    args_info.current_repeat_times += current_step;
+                    if (args_info.current_offset_in_array >= args_info.cur_size) {
+                        args_info.current_row_eos = true;
+                    }
+                    _extend_data(columns, block, args_info.current_repeat_times, gap,
+                                 args_info.current_row_idx, output_slot_ref_indexs);
+                    args_info.current_repeat_times = 0;
+                    if (args_info.current_row_eos) {
+                        //current row is end of array, move to next row
+                        args_info.current_row_idx++;
+                        args_info.current_offset_in_array = 0;
+                        if (args_info.current_row_idx >= block->rows()) {
+                            break;
+                        }
+                        args_info.current_row_eos = false;
+                        args_info.array_start =
+                                (*args_info.offsets_ptr)[args_info.current_row_idx - 1];
+                        args_info.cur_size = (*args_info.offsets_ptr)[args_info.current_row_idx] -
+                                             args_info.array_start;
                     }
-                    args_info.current_row_eos = false;
-                    args_info.array_start = (*args_info.offsets_ptr)[args_info.current_row_idx - 1];
-                    args_info.cur_size = (*args_info.offsets_ptr)[args_info.current_row_idx] -
-                                         args_info.array_start;
                 }
-            }
 
-            if (!mem_reuse) {
-                for (int i = 0; i < column_size; ++i) {
-                    lambda_block.insert(vectorized::ColumnWithTypeAndName(std::move(columns[i]),
-                                                                          data_types[i], names[i]));
+                if (!mem_reuse) {
+                    for (int i = 0; i < column_size; ++i) {
+                        lambda_block.insert(vectorized::ColumnWithTypeAndName(
+                                std::move(columns[i]), data_types[i], names[i]));
+                    }
                 }
-            }
-            //3. child[0]->execute(new_block)
-            RETURN_IF_ERROR(children[0]->execute(context, &lambda_block, result_column_id));
-
-            auto res_col = lambda_block.get_by_position(*result_column_id)
-                                   .column->convert_to_full_column_if_const();
-            res_type = lambda_block.get_by_position(*result_column_id).type;
-            res_name = lambda_block.get_by_position(*result_column_id).name;
-            if (!result_col) {
-                result_col = res_col->clone_empty();
-            }
-            result_col->insert_range_from(*res_col, 0, res_col->size());
-            lambda_block.clear_column_data(column_size);
-        } while (args_info.current_row_idx < block->rows());
+                //3. child[0]->execute(new_block)
+                RETURN_IF_ERROR(children[0]->execute(context, &lambda_block, result_column_id));
+
+                auto res_col = lambda_block.get_by_position(*result_column_id)
+                                       .column->convert_to_full_column_if_const();
+                res_type = lambda_block.get_by_position(*result_column_id).type;
+                res_name = lambda_block.get_by_position(*result_column_id).name;
+                if (!batch_result_col) {
+                    batch_result_col = res_col->clone_empty();
+                }
+                batch_result_col->insert_range_from(*res_col, 0, res_col->size());
+                lambda_block.clear_column_data(column_size);
+            } while (args_info.current_row_idx < block->rows());
+            result_col = std::move(batch_result_col);
+        }
 
         //4. get the result column after execution, reassemble it into a new array column, and return.
         if (result_type->is_nullable()) {
@@ -345,6 +369,28 @@ private:
         return it != output_slot_ref_indexs.end();
     }
 
+    // Broadcast the columns the lambda captures from the block to the rows of the nested data,
+    // it's only possible when each of them has a single value, i.e. is const or the block has
+    // a single row. The positions not read by the lambda are padded with const columns.
+    bool _broadcast_captures(Block* block, int gap, const std::vector<int>& output_slot_ref_indexs,
+                             size_t nested_rows, std::vector<ColumnPtr>* captures) {
+        captures->resize(gap);
+        for (int i = 0; i < gap; ++i) {
+            if (!_contains_column_id(output_slot_ref_indexs, i)) {
+                (*captures)[i] = ColumnUInt8::create(1, 0);
+            } else if (const auto& column = block->get_by_position(i).column;
+                       is_column_const(*column)) {
+                (*captures)[i] = assert_cast<const ColumnConst&>(*column).get_data_column_ptr();
+            } else if (block->rows() == 1) {
+                (*captures)[i] = column;
+            } else {
+                return false;
+            }
+            (*captures)[i] = ColumnConst::create((*captures)[i], nested_rows);
+        }
+        return true;
+    }
+
     void _set_column_ref_column_id(VExprSPtr expr, int gap) {
         for (const auto& child : expr->children()) {
             if (child->is_column_ref()) {
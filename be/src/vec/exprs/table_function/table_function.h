@@ -21,6 +21,7 @@
 
 #include <cstddef>
 
+#include "common/cast_set.h"
 #include "common/status.h"
 #include "vec/core/block.h"
 #include "vec/exprs/vexpr_context.h"
@@ -58,6 +59,35 @@ public:
     virtual void get_same_many_values(MutableColumnPtr& column, int length = 0) = 0;
     virtual int get_value(MutableColumnPtr& column, int max_step) = 0;
 
+    // Batch interface, used when this is the only table function of the operator.
+    // Processes the rows of [row_idx, row_idx + num_rows) in order and appends the results of
+    // each of them to `column`, until the next row does not fit in `max_step` results. The end
+    // offset of the results of each processed row, counted from the first appended result, is
+    // appended to `offsets`, so the other columns can be replicated at once.
+    // Return the number of processed rows. The default one goes through the row interface.
+    virtual size_t get_batch_values(size_t row_idx, size_t num_rows, MutableColumnPtr& column,
+                                    size_t max_step, IColumn::Offsets& offsets) {
+        size_t num_results = 0;
+        size_t row = row_idx;
+        for (; row < row_idx + num_rows; ++row) {
+            process_row(row);
+            // an empty result of an outer function is one null row
+            size_t row_results = current_empty() ? (is_outer() ? 1 : 0) : _cur_size;
+            if (num_results + row_results > max_step) {
+                break;
+            }
+            for (size_t i = 0; i < row_results;) {
+                i += get_value(column, cast_set<int>(row_results - i));
+            }
+            num_results += row_results;
+            offsets.push_back(num_results);
+        }
+        return row - row_idx;
+    }
+
+    // whether no result of the current row is returned yet
+    bool at_row_start() const { return !_eos && _cur_offset == 0; }
+
     virtual Status close() { return Status::OK(); }
 
     virtual void forward(int step = 1) {
@@ -150,5 +150,71 @@ int VExplodeTableFunction::get_value(MutableColumnPtr& column, int max_step) {
     return max_step;
 }
 
+size_t VExplodeTableFunction::get_batch_values(size_t row_idx, size_t num_rows,
+                                               MutableColumnPtr& column, size_t max_step,
+                                               IColumn::Offsets& offsets) {
+    IColumn* nested_column = column.get();
+    ColumnUInt8* nullmap_column = nullptr;
+    if (_is_nullable) {
+        auto* nullable_column = assert_cast<ColumnNullable*>(column.get());
+        nested_column = nullable_column->get_nested_column_ptr().get();
+        nullmap_column =
+                assert_cast<ColumnUInt8*>(nullable_column->get_null_map_column_ptr().get());
+    }
+    // the elements of consecutive rows are mostly consecutive, insert them at once
+    size_t range_begin = 0;
+    size_t range_size = 0;
+    auto insert_range = [&]() {
+        if (range_size == 0) {
+            return;
+        }
+        nested_column->insert_range_from(*_detail.nested_col, range_begin, range_size);
+        if (nullmap_column != nullptr) {
+            size_t old_size = nullmap_column->size();
+            if (_detail.nested_nullmap_data) {
+                nullmap_column->resize(old_size + range_size);
+                memcpy(nullmap_column->get_data().data() + old_size,
+                       _detail.nested_nullmap_data + range_begin, range_size * sizeof(UInt8));
+            } else {
+                nullmap_column->insert_many_defaults(range_size);
+            }
+        }
+        range_size = 0;
+    };
+
+    size_t num_results = 0;
+    size_t row = row_idx;
+    for (; row < row_idx + num_rows; ++row) {
+        size_t begin = 0;
+        size_t size = 0;
+        if (!_detail.array_nullmap_data || !_detail.array_nullmap_data[row]) {
+            begin = (*_detail.offsets_ptr)[row - 1];
+            size = (*_detail.offsets_ptr)[row] - begin;
+        }
+        size_t row_results = size == 0 ? (_is_outer ? 1 : 0) : size;
+        if (num_results + row_results > max_step) {
+            break;
+        }
+        if (size == 0) {
+            if (_is_outer) {
+                insert_range();
+                column->insert_default();
+            }
+        } else {
+            if (range_size > 0 && range_begin + range_size != begin) {
+                insert_range();
+            }
+            if (range_size == 0) {
+                range_begin = begin;
+            }
+            range_size += size;
+        }
+        num_results += row_results;
+        offsets.push_back(num_results);
+    }
+    insert_range();
+    return row - row_idx;
+}
+
 #include "common/compile_check_end.h"
 } // namespace doris::vectorized
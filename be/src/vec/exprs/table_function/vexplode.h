@@ -45,6 +45,8 @@ public:
     void process_close() override;
     void get_same_many_values(MutableColumnPtr& column, int length) override;
     int get_value(MutableColumnPtr& column, int max_step) override;
+    size_t get_batch_values(size_t row_idx, size_t num_rows, MutableColumnPtr& column,
+                            size_t max_step, IColumn::Offsets& offsets) override;
 
 private:
     Status _process_init_variant(Block* block, int value_column_idx);
@@ -84,37 +84,37 @@ Status VExplodeSplitTableFunction::process_init(Block* block, RuntimeState* stat
     return Status::OK();
 }
 
+void VExplodeSplitTableFunction::_split_row(size_t row_idx,
+                                            std::vector<StringRef>* output) const {
+    // TODO: use the function to be better string_view/StringRef split
+    std::string_view strv = _real_text_column->get_data_at(row_idx);
+    std::string_view delims = _delimiter;
+    const auto* first = strv.begin();
+    const auto* last = strv.end();
+
+    do {
+        const auto* second = std::search(first, last, std::cbegin(delims), std::cend(delims));
+        if (first != second) {
+            auto view = strv.substr(std::distance(strv.begin(), first),
+                                    std::distance(first, second));
+            output->emplace_back(view.data(), view.length());
+        } else {
+            output->emplace_back("", 0);
+        }
+        first = std::next(second, delims.size());
+
+        if (second == last) {
+            break;
+        }
+    } while (first != last);
+}
+
 void VExplodeSplitTableFunction::process_row(size_t row_idx) {
     TableFunction::process_row(row_idx);
 
     if (!(_test_null_map && _test_null_map[row_idx]) && _delimiter.data != nullptr) {
-        // TODO: use the function to be better string_view/StringRef split
-        auto split = [](std::string_view strv, std::string_view delims = " ") {
-            std::vector<StringRef> output;
-            const auto* first = strv.begin();
-            const auto* last = strv.end();
-
-            do {
-                const auto* second =
-                        std::search(first, last, std::cbegin(delims), std::cend(delims));
-                if (first != second) {
-                    auto view = strv.substr(std::distance(strv.begin(), first),
-                                            std::distance(first, second));
-                    output.emplace_back(view.data(), view.length());
-                } else {
-                    output.emplace_back("", 0);
-                }
-                first = std::next(second, delims.size());
-
-                if (second == last) {
-                    break;
-                }
-            } while (first != last);
-
-            return output;
-        };
-        _backup = split(_real_text_column->get_data_at(row_idx), _delimiter);
-
+        _backup.clear();
+        _split_row(row_idx, &_backup);
         _cur_size = _backup.size();
     }
 }
@@ -159,5 +159,51 @@ int VExplodeSplitTableFunction::get_value(doris::vectorized::MutableColumnPtr& c
     return max_step;
 }
 
+size_t VExplodeSplitTableFunction::get_batch_values(size_t row_idx, size_t num_rows,
+                                                    MutableColumnPtr& column, size_t max_step,
+                                                    IColumn::Offsets& offsets) {
+    ColumnString* target = nullptr;
+    ColumnUInt8* nullmap_column = nullptr;
+    if (_is_nullable) {
+        auto* nullable_column = assert_cast<ColumnNullable*>(column.get());
+        target = assert_cast<ColumnString*>(nullable_column->get_nested_column_ptr().get());
+        nullmap_column =
+                assert_cast<ColumnUInt8*>(nullable_column->get_null_map_column_ptr().get());
+    } else {
+        target = assert_cast<ColumnString*>(column.get());
+    }
+    auto insert_parts = [&]() {
+        target->insert_many_strings(_batch_backup.data(), _batch_backup.size());
+        if (nullmap_column != nullptr) {
+            nullmap_column->insert_many_defaults(_batch_backup.size());
+        }
+        _batch_backup.clear();
+    };
+
+    _batch_backup.clear();
+    size_t num_results = 0;
+    size_t row = row_idx;
+    for (; row < row_idx + num_rows; ++row) {
+        size_t old_size = _batch_backup.size();
+        if (!(_test_null_map && _test_null_map[row]) && _delimiter.data != nullptr) {
+            _split_row(row, &_batch_backup);
+        }
+        size_t size = _batch_backup.size() - old_size;
+        size_t row_results = size == 0 ? (_is_outer ? 1 : 0) : size;
+        if (num_results + row_results > max_step) {
+            _batch_backup.resize(old_size);
+            break;
+        }
+        if (size == 0 && _is_outer) {
+            insert_parts();
+            column->insert_default();
+        }
+        num_results += row_results;
+        offsets.push_back(num_results);
+    }
+    insert_parts();
+    return row - row_idx;
+}
+
 #include "common/compile_check_end.h"
 } // namespace doris::vectorized
@@ -47,9 +47,16 @@ public:
     void process_close() override;
     void get_same_many_values(MutableColumnPtr& column, int length) override;
     int get_value(MutableColumnPtr& column, int max_step) override;
+    size_t get_batch_values(size_t row_idx, size_t num_rows, MutableColumnPtr& column,
+                            size_t max_step, IColumn::Offsets& offsets) override;
 
 private:
+    // append the split parts of the row to `output`
+    void _split_row(size_t row_idx, std::vector<StringRef>* output) const;
+
     std::vector<StringRef> _backup;
+    // the parts of the rows of a batch
+    std::vector<StringRef> _batch_backup;
 
     ColumnPtr _text_column;
     const uint8_t* _test_null_map = nullptr;
@@ -20,16 +20,22 @@
 #include <gen_cpp/Exprs_types.h>
 #include <gen_cpp/Types_types.h>
 
+#include <algorithm>
 #include <ostream>
+#include <vector>
 
 #include "common/status.h"
 #include "runtime/runtime_state.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/core/block.h"
 #include "vec/core/column_numbers.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/columns_with_type_and_name.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/functions/simple_function_factory.h"
 
@@ -71,6 +77,18 @@ Status VCaseExpr::prepare(RuntimeState* state, const RowDescriptor& desc, VExprC
                                     _fn.name.function_name);
     }
 
+    // the branches are only worth to be split when one of them does more than reading a slot
+    _can_execute_on_selected_rows =
+            !_has_case_expr && can_execute_on_selected_rows() &&
+            std::any_of(_children.begin() + 1, _children.end(), [](const VExprSPtr& child) {
+                return !child->is_slot_ref() && !child->is_constant();
+            });
+    for (size_t i = 0; i + 1 < _children.size(); i += 2) {
+        if (remove_nullable(_children[i]->data_type())->get_primitive_type() != TYPE_BOOLEAN) {
+            _can_execute_on_selected_rows = false;
+        }
+    }
+
     VExpr::register_function_context(state, context);
     _prepare_finished = true;
     return Status::OK();
@@ -101,6 +119,9 @@ Status VCaseExpr::execute(VExprContext* context, Block* block, int* result_colum
         return get_result_from_const(block, _expr_name, result_column_id);
     }
     DCHECK(_open_finished || _getting_const_col);
+    if (_can_execute_on_selected_rows && block->rows() > 0 && !has_index_result_columns(context)) {
+        return _execute_on_selected_rows(context, block, result_column_id);
+    }
     ColumnNumbers arguments(_children.size());
     for (int i = 0; i < _children.size(); i++) {
         int column_id = -1;
@@ -119,6 +140,81 @@ Status VCaseExpr::execute(VExprContext* context, Block* block, int* result_colum
     return Status::OK();
 }
 
+Status VCaseExpr::_execute_on_selected_rows(VExprContext* context, Block* block,
+                                            int* result_column_id) {
+    const size_t rows = block->rows();
+    const size_t num_branches = _children.size() / 2;
+    // the branch of each row, the branches are numbered from 1 and 0 is ELSE
+    std::vector<uint32_t> branches(rows, 0);
+    IColumn::Filter undecided(rows, 1);
+    size_t num_undecided = rows;
+    for (size_t branch = 1; branch <= num_branches && num_undecided > 0; ++branch) {
+        ColumnPtr when_column;
+        RETURN_IF_ERROR(execute_on_selected_rows(context, _children[2 * branch - 2], block,
+                                                 undecided, num_undecided, &when_column));
+        const NullMap* null_map = nullptr;
+        const IColumn* when_data = when_column.get();
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(*when_column)) {
+            null_map = &nullable->get_null_map_data();
+            when_data = &nullable->get_nested_column();
+        }
+        const auto& matched = assert_cast<const ColumnUInt8&>(*when_data).get_data();
+        size_t pos = 0;
+        for (size_t row = 0; row < rows; ++row) {
+            if (!undecided[row]) {
+                continue;
+            }
+            if (matched[pos] && !(null_map && (*null_map)[pos])) {
+                branches[row] = cast_set<uint32_t>(branch);
+                undecided[row] = 0;
+                --num_undecided;
+            }
+            ++pos;
+        }
+    }
+
+    // the results of the branches are appended one after another, then gathered by the rows
+    auto results = _data_type->create_column();
+    std::vector<uint32_t> offsets(num_branches + 1, 0);
+    if (!_has_else_expr) {
+        // the rows without a branch take the null at 0
+        results->insert_default();
+    }
+    IColumn::Filter selected(rows);
+    for (size_t branch = 0; branch <= num_branches; ++branch) {
+        if (branch == 0 && !_has_else_expr) {
+            continue;
+        }
+        size_t num_selected = 0;
+        for (size_t row = 0; row < rows; ++row) {
+            selected[row] = branches[row] == branch;
+            num_selected += selected[row];
+        }
+        if (num_selected == 0) {
+            continue;
+        }
+        const auto& child = branch == 0 ? _children.back() : _children[2 * branch - 1];
+        ColumnPtr then_column;
+        RETURN_IF_ERROR(execute_on_selected_rows(context, child, block, selected, num_selected,
+                                                 &then_column));
+        if (_data_type->is_nullable()) {
+            then_column = make_nullable(then_column);
+        }
+        offsets[branch] = cast_set<uint32_t>(results->size());
+        results->insert_range_from(*then_column, 0, num_selected);
+    }
+    std::vector<uint32_t> indices(rows);
+    for (size_t row = 0; row < rows; ++row) {
+        indices[row] = branches[row] == 0 && !_has_else_expr ? 0 : offsets[branches[row]]++;
+    }
+
+    auto result = _data_type->create_column();
+    result->insert_indices_from(*results, indices.data(), indices.data() + rows);
+    *result_column_id = block->columns();
+    block->insert({std::move(result), _data_type, _expr_name});
+    return Status::OK();
+}
+
 const std::string& VCaseExpr::expr_name() const {
     return _expr_name;
 }
@@ -52,8 +52,13 @@ public:
     std::string debug_string() const override;
 
 private:
+    // Execute each WHEN only on the rows the WHENs before it don't match, and each THEN only on
+    // the rows of its branch, instead of all the children on the whole block.
+    Status _execute_on_selected_rows(VExprContext* context, Block* block, int* result_column_id);
+
     bool _has_case_expr;
     bool _has_else_expr;
+    bool _can_execute_on_selected_rows = false;
 
     FunctionBasePtr _function;
     std::string _function_name = "case";
@@ -24,7 +24,10 @@
 #include "common/status.h"
 #include "util/simd/bits.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/exprs/vectorized_fn_call.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vexpr_fwd.h"
@@ -55,6 +58,16 @@ public:
 
     const std::string& expr_name() const override { return _expr_name; }
 
+    Status prepare(RuntimeState* state, const RowDescriptor& desc, VExprContext* context) override {
+        RETURN_IF_ERROR(VectorizedFnCall::prepare(state, desc, context));
+        // filtering the slots of the rhs only pays off when it does more than reading a slot
+        _can_execute_rhs_on_selected_rows = _children.size() == 2 &&
+                                            !_children[1]->is_slot_ref() &&
+                                            !_children[1]->is_constant() &&
+                                            _children[1]->can_execute_on_selected_rows();
+        return Status::OK();
+    }
+
     Status evaluate_inverted_index(VExprContext* context, uint32_t segment_num_rows) override {
         segment_v2::InvertedIndexResultBitmap res;
         bool all_pass = true;
@@ -191,7 +204,12 @@ public:
 
         auto get_rhs_colum = [&]() {
             if (rhs_id == -1) {
-                RETURN_IF_ERROR(_children[1]->execute(context, block, &rhs_id));
+                if (_can_execute_rhs_on_selected_rows && !has_index_result_columns(context)) {
+                    RETURN_IF_ERROR(_execute_rhs_on_undecided_rows(context, block, lhs_data_column,
+                                                                   lhs_null_map, size, &rhs_id));
+                } else {
+                    RETURN_IF_ERROR(_children[1]->execute(context, block, &rhs_id));
+                }
                 rhs_column =
                         block->get_by_position(rhs_id).column->convert_to_full_column_if_const();
                 rhs_is_nullable = rhs_column->is_nullable();
@@ -382,6 +400,57 @@ private:
         return (l_null & r_null) | (r_null & (r_null ^ a)) | (l_null & (l_null ^ b));
     }
 
+    // Execute the rhs only on the rows the lhs doesn't decide, that is the rows which aren't
+    // false for AND, or aren't true for OR. The other rows of the rhs are 0 and not null, the
+    // result of them is the lhs whatever the rhs is.
+    Status _execute_rhs_on_undecided_rows(VExprContext* context, Block* block,
+                                          const uint8_t* __restrict lhs_data,
+                                          const uint8_t* __restrict lhs_null_map, size_t size,
+                                          int* rhs_id) {
+        IColumn::Filter undecided(size);
+        const uint8_t decided_value = _op == TExprOpcode::COMPOUND_OR;
+        for (size_t i = 0; i < size; ++i) {
+            undecided[i] = (lhs_data[i] != 0) != decided_value ||
+                           (lhs_null_map != nullptr && lhs_null_map[i]);
+        }
+        size_t num_undecided = size - simd::count_zero_num((int8_t*)undecided.data(), size);
+        if (num_undecided == size) {
+            return _children[1]->execute(context, block, rhs_id);
+        }
+
+        ColumnPtr selected;
+        RETURN_IF_ERROR(execute_on_selected_rows(context, _children[1], block, undecided,
+                                                 num_undecided, &selected));
+        const auto* selected_nullable = check_and_get_column<ColumnNullable>(*selected);
+        const auto& selected_data =
+                assert_cast<const ColumnUInt8&>(selected_nullable
+                                                        ? selected_nullable->get_nested_column()
+                                                        : *selected)
+                        .get_data();
+        auto data_column = ColumnUInt8::create(size, 0);
+        auto null_map_column = ColumnUInt8::create(size, 0);
+        auto& data = data_column->get_data();
+        auto& null_map = null_map_column->get_data();
+        for (size_t i = 0, pos = 0; i < size; ++i) {
+            if (undecided[i]) {
+                data[i] = selected_data[pos];
+                null_map[i] = selected_nullable && selected_nullable->is_null_at(pos);
+                ++pos;
+            }
+        }
+
+        *rhs_id = block->columns();
+        if (selected_nullable) {
+            block->insert({ColumnNullable::create(std::move(data_column),
+                                                  std::move(null_map_column)),
+                           make_nullable(_children[1]->data_type()), _children[1]->expr_name()});
+        } else {
+            block->insert({std::move(data_column), remove_nullable(_children[1]->data_type()),
+                           _children[1]->expr_name()});
+        }
+        return Status::OK();
+    }
+
     bool _has_const_child() const {
         return std::ranges::any_of(_children,
                                    [](const VExprSPtr& arg) -> bool { return arg->is_constant(); });
@@ -408,6 +477,7 @@ private:
     }
 
     TExprOpcode::type _op;
+    bool _can_execute_rhs_on_selected_rows = false;
 };
 
 #include "common/compile_check_end.h"
@@ -272,6 +272,12 @@ bool VectorizedFnCall::can_push_down_to_index() const {
     return _function->can_push_down_to_index();
 }
 
+bool VectorizedFnCall::can_execute_on_selected_rows() const {
+    // running_difference reads the previous row
+    return _fn.name.function_name != "running_difference" &&
+           VExpr::can_execute_on_selected_rows();
+}
+
 bool VectorizedFnCall::equals(const VExpr& other) {
     const auto* other_ptr = dynamic_cast<const VectorizedFnCall*>(&other);
     if (!other_ptr) {
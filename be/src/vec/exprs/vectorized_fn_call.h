@@ -71,6 +71,7 @@ public:
     static std::string debug_string(const std::vector<VectorizedFnCall*>& exprs);
 
     bool can_push_down_to_index() const override;
+    bool can_execute_on_selected_rows() const override;
     bool equals(const VExpr& other) override;
 
     size_t estimate_memory(const size_t rows) override;
@@ -27,6 +27,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <cstdint>
 #include <memory>
+#include <set>
 #include <stack>
 #include <utility>
 
@@ -531,6 +532,81 @@ bool VExpr::is_constant() const {
                        [](const VExprSPtr& expr) { return expr->is_constant(); });
 }
 
+bool VExpr::can_execute_on_selected_rows() const {
+    switch (_node_type) {
+    case TExprNodeType::BOOL_LITERAL:
+    case TExprNodeType::INT_LITERAL:
+    case TExprNodeType::LARGE_INT_LITERAL:
+    case TExprNodeType::IPV4_LITERAL:
+    case TExprNodeType::IPV6_LITERAL:
+    case TExprNodeType::FLOAT_LITERAL:
+    case TExprNodeType::DECIMAL_LITERAL:
+    case TExprNodeType::DATE_LITERAL:
+    case TExprNodeType::TIMEV2_LITERAL:
+    case TExprNodeType::STRING_LITERAL:
+    case TExprNodeType::JSON_LITERAL:
+    case TExprNodeType::NULL_LITERAL:
+    case TExprNodeType::SLOT_REF:
+    case TExprNodeType::COMPOUND_PRED:
+    case TExprNodeType::ARITHMETIC_EXPR:
+    case TExprNodeType::BINARY_PRED:
+    case TExprNodeType::NULL_AWARE_BINARY_PRED:
+    case TExprNodeType::FUNCTION_CALL:
+    case TExprNodeType::COMPUTE_FUNCTION_CALL:
+    case TExprNodeType::CAST_EXPR:
+    case TExprNodeType::IN_PRED:
+    case TExprNodeType::CASE_EXPR:
+        break;
+    default:
+        // lambdas read the columns by their positions, MATCH reads the index of the segment
+        return false;
+    }
+    return !is_rf_wrapper() &&
+           std::ranges::all_of(_children, [](const VExprSPtr& child) {
+               return child->can_execute_on_selected_rows();
+           });
+}
+
+Status VExpr::execute_on_selected_rows(VExprContext* context, const VExprSPtr& expr,
+                                       Block* block, const IColumn::Filter& filter,
+                                       size_t selected_rows, ColumnPtr* result) {
+    DCHECK(expr->can_execute_on_selected_rows());
+    DCHECK_EQ(filter.size(), block->rows());
+    std::set<int> column_ids;
+    expr->collect_slot_column_ids(column_ids);
+    int result_column_id = -1;
+    // without any slot, a new block wouldn't know its rows, so the expr runs on all of them
+    if (selected_rows == block->rows() || column_ids.empty()) {
+        RETURN_IF_ERROR(expr->execute(context, block, &result_column_id));
+        *result = block->get_by_position(result_column_id)
+                          .column->convert_to_full_column_if_const();
+        if (selected_rows != block->rows()) {
+            *result = (*result)->filter(filter, selected_rows);
+        }
+        return Status::OK();
+    }
+
+    // the columns the expr doesn't read are left null, they keep their positions for the slots
+    Block selected_block;
+    for (size_t i = 0; i < block->columns(); ++i) {
+        const auto& column = block->get_by_position(i);
+        selected_block.insert({column_ids.contains(cast_set<int>(i))
+                                       ? column.column->filter(filter, selected_rows)
+                                       : nullptr,
+                               column.type, column.name});
+    }
+    RETURN_IF_ERROR(expr->execute(context, &selected_block, &result_column_id));
+    *result = selected_block.get_by_position(result_column_id)
+                      .column->convert_to_full_column_if_const();
+    DCHECK_EQ((*result)->size(), selected_rows);
+    return Status::OK();
+}
+
+bool VExpr::has_index_result_columns(VExprContext* context) {
+    return context->get_inverted_index_context() &&
+           !context->get_inverted_index_context()->get_inverted_index_result_column().empty();
+}
+
 Status VExpr::get_const_col(VExprContext* context,
                             std::shared_ptr<ColumnPtrWrapper>* column_wrapper) {
     if (!is_constant()) {
@@ -268,6 +268,10 @@ public:
         }
     }
 
+    // Whether each row of the result only depends on the same row of the slots, so the expr can
+    // be executed on a part of the rows of a block. See execute_on_selected_rows().
+    virtual bool can_execute_on_selected_rows() const;
+
 protected:
     /// Simple debug string that provides no expr subclass-specific information
     std::string debug_string(const std::string& expr_name) const {
@@ -294,6 +298,17 @@ protected:
 
     Status check_constant(const Block& block, ColumnNumbers arguments) const;
 
+    // Execute expr only on the selected_rows rows of block whose filter is 1, for the branches of
+    // CASE and the right side of AND/OR. The slots the expr reads are filtered into a new block,
+    // so *result only has the selected rows. expr must be can_execute_on_selected_rows().
+    static Status execute_on_selected_rows(VExprContext* context, const VExprSPtr& expr,
+                                           Block* block, const IColumn::Filter& filter,
+                                           size_t selected_rows, ColumnPtr* result);
+
+    // The results of the index are full columns of the block, the exprs using them can't be
+    // executed on a part of the rows.
+    static bool has_index_result_columns(VExprContext* context);
+
     /// Helper function that calls ctx->register(), sets fn_context_index_, and returns the
     /// registered FunctionContext
     void register_function_context(RuntimeState* state, VExprContext* context);
@@ -40,6 +40,8 @@ class RuntimeState;
 
 namespace doris::vectorized {
 
+class SharedExprResults;
+
 class InvertedIndexContext {
 public:
     InvertedIndexContext(
@@ -169,6 +171,12 @@ public:
         return _inverted_index_context;
     }
 
+    // The columns reused by the VSharedExprs in the tree, shared by the projections of an
+    // operator instance. The VSharedExprs compute their exprs each time without it.
+    void set_shared_expr_results(SharedExprResults* results) { _shared_expr_results = results; }
+
+    SharedExprResults* shared_expr_results() const { return _shared_expr_results; }
+
     /// Creates a FunctionContext, and returns the index that's passed to fn_context() to
     /// retrieve the created context. Exprs that need a FunctionContext should call this in
     /// Prepare() and save the returned index. 'varargs_buffer_size', if specified, is the
@@ -314,6 +322,7 @@ private:
     bool _force_materialize_slot = false;
 
     std::shared_ptr<InvertedIndexContext> _inverted_index_context;
+    SharedExprResults* _shared_expr_results = nullptr;
     size_t _memory_usage = 0;
 };
 } // namespace doris::vectorized
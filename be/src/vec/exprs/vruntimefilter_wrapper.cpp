@@ -22,6 +22,7 @@
 #include <cstddef>
 
 #include "util/runtime_profile.h"
+#include "util/time.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/core/block.h"
@@ -104,7 +105,11 @@ Status VRuntimeFilterWrapper::execute(VExprContext* context, Block* block, int*
             _impl->set_getting_const_col(true);
         }
         ColumnNumbers args;
+        const int64_t start_ns = MonotonicNanos();
         RETURN_IF_ERROR(_impl->execute_runtime_fitler(context, block, result_column_id, args));
+        const int64_t exec_ns = MonotonicNanos() - start_ns;
+        _judge_exec_ns += static_cast<uint64_t>(exec_ns);
+        COUNTER_UPDATE(_exec_time, exec_ns);
         if (_getting_const_col) {
             _impl->set_getting_const_col(false);
         }
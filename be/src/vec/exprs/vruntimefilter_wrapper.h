@@ -66,10 +66,14 @@ public:
 
     void attach_profile_counter(std::shared_ptr<RuntimeProfile::Counter> rf_input_rows,
                                 std::shared_ptr<RuntimeProfile::Counter> rf_filter_rows,
-                                std::shared_ptr<RuntimeProfile::Counter> always_true_filter_rows) {
+                                std::shared_ptr<RuntimeProfile::Counter> always_true_filter_rows,
+                                std::shared_ptr<RuntimeProfile::Counter> exec_time,
+                                std::shared_ptr<RuntimeProfile::Counter> ignored_periods) {
         DCHECK(rf_input_rows != nullptr);
         DCHECK(rf_filter_rows != nullptr);
         DCHECK(always_true_filter_rows != nullptr);
+        DCHECK(exec_time != nullptr);
+        DCHECK(ignored_periods != nullptr);
 
         if (rf_input_rows != nullptr) {
             _rf_input_rows = rf_input_rows;
@@ -80,6 +84,12 @@ public:
         if (always_true_filter_rows != nullptr) {
             _always_true_filter_rows = always_true_filter_rows;
         }
+        if (exec_time != nullptr) {
+            _exec_time = exec_time;
+        }
+        if (ignored_periods != nullptr) {
+            _ignored_periods = ignored_periods;
+        }
     }
 
     void update_counters(int64_t filter_rows, int64_t input_rows) {
@@ -98,17 +108,33 @@ public:
 
     int filter_id() const { return _filter_id; }
 
+    bool null_aware() const { return _null_aware; }
+
     void do_judge_selectivity(uint64_t filter_rows, uint64_t input_rows) override {
         update_counters(filter_rows, input_rows);
 
         if (!_always_true) {
             _judge_filter_rows += filter_rows;
             _judge_input_rows += input_rows;
+            bool always_true = false;
             judge_selectivity(_ignore_thredhold, _judge_filter_rows, _judge_input_rows,
-                              _always_true);
+                              always_true);
+            always_true |= judge_cost(config::runtime_filter_filtered_row_benefit_ns,
+                                      _judge_filter_rows, _judge_exec_ns);
+            if (always_true && !_always_true.exchange(true)) {
+                COUNTER_UPDATE(_ignored_periods, 1);
+            }
         }
     }
 
+    // The filter is not worth it when executing it costs more than the rows it removed would cost
+    // downstream.
+    static bool judge_cost(int64_t filtered_row_benefit_ns, uint64_t filter_rows,
+                           uint64_t exec_ns) {
+        return filtered_row_benefit_ns > 0 &&
+               filter_rows * static_cast<uint64_t>(filtered_row_benefit_ns) < exec_ns;
+    }
+
     std::shared_ptr<RuntimeProfile::Counter> predicate_filtered_rows_counter() const {
         return _rf_filter_rows;
     }
@@ -122,6 +148,7 @@ private:
         _judge_counter = config::runtime_filter_sampling_frequency;
         _judge_input_rows = 0;
         _judge_filter_rows = 0;
+        _judge_exec_ns = 0;
     }
 
     VExprSPtr _impl;
@@ -136,6 +163,9 @@ private:
     std::atomic_int _judge_counter = 0;
     std::atomic_uint64_t _judge_input_rows = 0;
     std::atomic_uint64_t _judge_filter_rows = 0;
+    // the time spent executing the filter in this period, which is weighed against the rows it
+    // removed
+    std::atomic_uint64_t _judge_exec_ns = 0;
     std::atomic_int _always_true = false;
 
     std::shared_ptr<RuntimeProfile::Counter> _rf_input_rows =
@@ -144,6 +174,11 @@ private:
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
     std::shared_ptr<RuntimeProfile::Counter> _always_true_filter_rows =
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
+    std::shared_ptr<RuntimeProfile::Counter> _exec_time =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::TIME_NS, 0);
+    // the number of sampling periods the filter was ignored in
+    std::shared_ptr<RuntimeProfile::Counter> _ignored_periods =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
 
     std::string _expr_name;
     double _ignore_thredhold;
@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vshared_expr.h"
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <map>
+#include <unordered_set>
+
+#include "vec/exprs/vectorized_fn_call.h"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+// the functions which may return different values for the same arguments
+const std::unordered_set<std::string> NON_DETERMINISTIC_FUNCTIONS = {
+        "random", "rand", "random_bytes", "uuid", "uuid_numeric", "sleep"};
+
+// Where an expr is in the trees, the root of context or a child of parent.
+struct Occurrence {
+    VExprContext* context = nullptr;
+    VExpr* parent = nullptr;
+    size_t index = 0;
+};
+
+// Set *fingerprint to a string which is equal for the exprs computing the same column, and
+// collect the occurrences of the function calls and casts. Return false if the expr can't be
+// shared, such as a non-deterministic function or a lambda.
+bool collect_subexprs(const VExprSPtr& expr, Occurrence at,
+                      std::map<std::string, std::vector<Occurrence>>* occurrences,
+                      std::string* fingerprint) {
+    bool can_share = true;
+    std::vector<std::string> child_fingerprints(expr->children().size());
+    for (size_t i = 0; i < expr->children().size(); ++i) {
+        // the children are collected even if this one can't be shared
+        if (!collect_subexprs(expr->children()[i], {nullptr, expr.get(), i}, occurrences,
+                              &child_fingerprints[i])) {
+            can_share = false;
+        }
+    }
+
+    std::string name;
+    bool is_function = false;
+    if (const auto* slot_ref = dynamic_cast<const VSlotRef*>(expr.get())) {
+        name = fmt::format("slot#{}", slot_ref->slot_id());
+    } else if (const auto* literal = dynamic_cast<const VLiteral*>(expr.get())) {
+        name = fmt::format("literal#{}", literal->value());
+    } else if (dynamic_cast<const VectorizedFnCall*>(expr.get()) != nullptr &&
+               expr->fn().binary_type == TFunctionBinaryType::BUILTIN &&
+               !NON_DETERMINISTIC_FUNCTIONS.contains(expr->fn().name.function_name)) {
+        name = expr->fn().name.function_name;
+        is_function = true;
+    } else if (expr->node_type() == TExprNodeType::CAST_EXPR) {
+        name = "cast";
+        is_function = true;
+    } else {
+        can_share = false;
+    }
+    if (!can_share) {
+        return false;
+    }
+
+    *fingerprint = fmt::format("{}:{}({})", name, expr->data_type()->get_name(),
+                               fmt::join(child_fingerprints, ","));
+    // the constant exprs are already computed once in open
+    if (is_function && !expr->is_constant()) {
+        (*occurrences)[*fingerprint].push_back(at);
+    }
+    return true;
+}
+
+} // namespace
+
+std::unique_ptr<SharedExprResults> SharedExprResults::create(
+        size_t num_slots, const VExprContextSPtrs& projections,
+        const std::vector<VExprContextSPtrs>& intermediate_projections) {
+    if (num_slots == 0) {
+        return nullptr;
+    }
+    auto results = std::make_unique<SharedExprResults>(num_slots);
+    for (const auto& context : projections) {
+        context->set_shared_expr_results(results.get());
+    }
+    for (const auto& contexts : intermediate_projections) {
+        for (const auto& context : contexts) {
+            context->set_shared_expr_results(results.get());
+        }
+    }
+    return results;
+}
+
+VSharedExpr::VSharedExpr(const VExprSPtr& expr, size_t slot)
+        : VExpr(expr->data_type(), false), _slot(slot) {
+    _node_type = expr->node_type();
+    _opcode = expr->op();
+    add_child(expr);
+}
+
+Status VSharedExpr::execute(VExprContext* context, Block* block, int* result_column_id) {
+    auto* results = context->shared_expr_results();
+    if (results == nullptr) {
+        return _children[0]->execute(context, block, result_column_id);
+    }
+    int& column_id = results->column_id(_slot);
+    if (column_id < 0) {
+        int child_column_id = -1;
+        RETURN_IF_ERROR(_children[0]->execute(context, block, &child_column_id));
+        column_id = child_column_id;
+    }
+    *result_column_id = column_id;
+    return Status::OK();
+}
+
+std::string VSharedExpr::debug_string() const {
+    return fmt::format("SharedExpr(slot={}, {})", _slot, _children[0]->debug_string());
+}
+
+void VSharedExpr::share_common_subexprs(const VExprContextSPtrs& contexts, size_t* num_slots) {
+    std::map<std::string, std::vector<Occurrence>> occurrences;
+    for (const auto& context : contexts) {
+        std::string fingerprint;
+        collect_subexprs(context->root(), {context.get(), nullptr, 0}, &occurrences,
+                         &fingerprint);
+    }
+
+    for (const auto& [_, exprs] : occurrences) {
+        if (exprs.size() < 2) {
+            continue;
+        }
+        size_t slot = (*num_slots)++;
+        for (const auto& at : exprs) {
+            if (at.parent == nullptr) {
+                at.context->set_root(VSharedExpr::create_shared(at.context->root(), slot));
+            } else {
+                auto children = at.parent->children();
+                children[at.index] = VSharedExpr::create_shared(children[at.index], slot);
+                at.parent->set_children(std::move(children));
+            }
+        }
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_fwd.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+// The columns of the shared exprs computed on the current block, one for each slot. It belongs
+// to the projections of an operator instance, and is reset before each block.
+class SharedExprResults {
+public:
+    explicit SharedExprResults(size_t num_slots) : _column_ids(num_slots, -1) {}
+
+    // Create the results for the cloned projections of an operator instance and set them to the
+    // contexts, or return nullptr if no expr is shared.
+    static std::unique_ptr<SharedExprResults> create(
+            size_t num_slots, const VExprContextSPtrs& projections,
+            const std::vector<VExprContextSPtrs>& intermediate_projections);
+
+    void reset() { std::fill(_column_ids.begin(), _column_ids.end(), -1); }
+
+    int& column_id(size_t slot) { return _column_ids[slot]; }
+
+private:
+    std::vector<int> _column_ids;
+};
+
+// An occurrence of a subexpression which appears more than once in the projections of an
+// operator, such as json_extract(payload, '$.a') in
+//   json_extract(payload, '$.a'), cast(json_extract(payload, '$.a') as int)
+// Every occurrence is wrapped with the same slot, the first one executed on a block computes the
+// column and the others reuse it.
+class VSharedExpr final : public VExpr {
+    ENABLE_FACTORY_CREATOR(VSharedExpr);
+
+public:
+    VSharedExpr(const VExprSPtr& expr, size_t slot);
+
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override;
+
+    const std::string& expr_name() const override { return _children[0]->expr_name(); }
+
+    std::string debug_string() const override;
+
+    // the column is only computed once, even if the expr is constant
+    bool is_constant() const override { return false; }
+
+    // the slot keeps a column of the whole block
+    bool can_execute_on_selected_rows() const override { return false; }
+
+    size_t slot() const { return _slot; }
+
+    // Wrap the deterministic subexpressions which appear more than once in the projections of a
+    // level with VSharedExprs, the levels are executed on different blocks and don't share. It
+    // must be called after prepare and before open. *num_slots is increased by the number of
+    // the shared subexpressions.
+    static void share_common_subexprs(const VExprContextSPtrs& contexts, size_t* num_slots);
+
+private:
+    size_t _slot;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -17,8 +17,11 @@
 
 #pragma once
 
+#include "util/simd/bits.h"
+#include "util/simd/vector_distance.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
+#include "vec/columns/column_const.h"
 #include "vec/common/assert_cast.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type.h"
@@ -31,51 +34,67 @@
 
 namespace doris::vectorized {
 
+// Each distance is computed over two contiguous vectors of the same size. When one argument
+// is a constant, it is taken as the query, and prepare() computes what only depends on it once
+// for all the rows.
 class L1Distance {
 public:
     static constexpr auto name = "l1_distance";
-    struct State {
-        double sum = 0;
-    };
-    static void accumulate(State& state, double x, double y) { state.sum += fabs(x - y); }
-    static double finalize(const State& state) { return state.sum; }
+    struct Query {};
+    static Query prepare(const double* y, size_t n) { return {}; }
+    static double distance(const double* x, const double* y, size_t n) {
+        return simd::l1_distance(x, y, n);
+    }
+    static double distance(const double* x, const double* y, size_t n, const Query&) {
+        return distance(x, y, n);
+    }
 };
 
 class L2Distance {
 public:
     static constexpr auto name = "l2_distance";
-    struct State {
-        double sum = 0;
-    };
-    static void accumulate(State& state, double x, double y) { state.sum += (x - y) * (x - y); }
-    static double finalize(const State& state) { return sqrt(state.sum); }
+    struct Query {};
+    static Query prepare(const double* y, size_t n) { return {}; }
+    static double distance(const double* x, const double* y, size_t n) {
+        return sqrt(simd::l2_squared_distance(x, y, n));
+    }
+    static double distance(const double* x, const double* y, size_t n, const Query&) {
+        return distance(x, y, n);
+    }
 };
 
 class InnerProduct {
 public:
     static constexpr auto name = "inner_product";
-    struct State {
-        double sum = 0;
-    };
-    static void accumulate(State& state, double x, double y) { state.sum += x * y; }
-    static double finalize(const State& state) { return state.sum; }
+    struct Query {};
+    static Query prepare(const double* y, size_t n) { return {}; }
+    static double distance(const double* x, const double* y, size_t n) {
+        return simd::inner_product(x, y, n);
+    }
+    static double distance(const double* x, const double* y, size_t n, const Query&) {
+        return distance(x, y, n);
+    }
 };
 
 class CosineDistance {
 public:
     static constexpr auto name = "cosine_distance";
-    struct State {
+    struct Query {
+        double squared_y = 0;
+    };
+    static Query prepare(const double* y, size_t n) { return {simd::inner_product(y, y, n)}; }
+    static double distance(const double* x, const double* y, size_t n) {
         double dot_prod = 0;
         double squared_x = 0;
         double squared_y = 0;
-    };
-    static void accumulate(State& state, double x, double y) {
-        state.dot_prod += x * y;
-        state.squared_x += x * x;
-        state.squared_y += y * y;
+        simd::inner_product_and_squared_norms(x, y, n, &dot_prod, &squared_x, &squared_y);
+        return 1 - dot_prod / sqrt(squared_x * squared_y);
     }
-    static double finalize(const State& state) {
-        return 1 - state.dot_prod / sqrt(state.squared_x * state.squared_y);
+    static double distance(const double* x, const double* y, size_t n, const Query& query) {
+        double dot_prod = 0;
+        double squared_x = 0;
+        simd::inner_product_and_squared_norm(x, y, n, &dot_prod, &squared_x);
+        return 1 - dot_prod / sqrt(squared_x * query.squared_y);
     }
 };
 
@@ -95,17 +114,24 @@ public:
 
     Status execute_impl(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
                         uint32_t result, size_t input_rows_count) const override {
-        const auto& arg1 = block.get_by_position(arguments[0]);
-        const auto& arg2 = block.get_by_position(arguments[1]);
-        if (!_check_input_type(arg1.type) || !_check_input_type(arg2.type)) {
+        const auto* arg1 = &block.get_by_position(arguments[0]);
+        const auto* arg2 = &block.get_by_position(arguments[1]);
+        if (!_check_input_type(arg1->type) || !_check_input_type(arg2->type)) {
             return Status::RuntimeError(fmt::format("unsupported types for function {}({}, {})",
-                                                    get_name(), arg1.type->get_name(),
-                                                    arg2.type->get_name()));
+                                                    get_name(), arg1->type->get_name(),
+                                                    arg2->type->get_name()));
         }
 
-        auto col1 = arg1.column->convert_to_full_column_if_const();
-        auto col2 = arg2.column->convert_to_full_column_if_const();
-        if (col1->size() != col2->size()) {
+        // the distances are symmetric, so a constant argument is taken as the second one
+        if (is_column_const(*arg1->column) && !is_column_const(*arg2->column)) {
+            std::swap(arg1, arg2);
+        }
+        const bool const_query = is_column_const(*arg2->column);
+        auto col1 = arg1->column->convert_to_full_column_if_const();
+        auto col2 = const_query
+                            ? assert_cast<const ColumnConst&>(*arg2->column).get_data_column_ptr()
+                            : arg2->column;
+        if (!const_query && col1->size() != col2->size()) {
             return Status::RuntimeError(
                     fmt::format("function {} have different input array sizes: {} and {}",
                                 get_name(), col1->size(), col2->size()));
@@ -115,8 +141,8 @@ public:
         ColumnArrayExecutionData arr2;
         if (!extract_column_array_info(*col1, arr1) || !extract_column_array_info(*col2, arr2)) {
             return Status::RuntimeError(fmt::format("unsupported types for function {}({}, {})",
-                                                    get_name(), arg1.type->get_name(),
-                                                    arg2.type->get_name()));
+                                                    get_name(), arg1->type->get_name(),
+                                                    arg2->type->get_name()));
         }
 
         // prepare return data
@@ -127,41 +153,54 @@ public:
 
         const auto& offsets1 = *arr1.offsets_ptr;
         const auto& offsets2 = *arr2.offsets_ptr;
-        const auto& nested_col1 = assert_cast<const ColumnFloat64*>(arr1.nested_col.get());
-        const auto& nested_col2 = assert_cast<const ColumnFloat64*>(arr2.nested_col.get());
-        for (ssize_t row = 0; row < offsets1.size(); ++row) {
-            if (arr1.array_nullmap_data && arr1.array_nullmap_data[row]) {
-                dst_null_data[row] = true;
-                continue;
-            }
-            if (arr2.array_nullmap_data && arr2.array_nullmap_data[row]) {
-                dst_null_data[row] = true;
-                continue;
-            }
-
-            dst_null_data[row] = false;
-            if (offsets1[row] != offsets2[row]) [[unlikely]] {
-                return Status::InvalidArgument(
-                        "function {} have different input element sizes of array: {} and {}",
-                        get_name(), offsets1[row] - offsets1[row - 1],
-                        offsets2[row] - offsets2[row - 1]);
-            }
-
-            typename DistanceImpl::State st;
-            for (ssize_t pos = offsets1[row - 1]; pos < offsets1[row]; ++pos) {
-                if (arr1.nested_nullmap_data && arr1.nested_nullmap_data[pos]) {
+        const double* data1 =
+                assert_cast<const ColumnFloat64*>(arr1.nested_col.get())->get_data().data();
+        const double* data2 =
+                assert_cast<const ColumnFloat64*>(arr2.nested_col.get())->get_data().data();
+        if (const_query && (_is_null_array(arr2, 0) || _has_null_element(arr2, 0))) {
+            memset(dst_null_data.data(), 1, input_rows_count);
+        } else if (const_query) {
+            const double* query = data2 + offsets2[-1];
+            const size_t dim = offsets2[0] - offsets2[-1];
+            const auto prepared = DistanceImpl::prepare(query, dim);
+            for (size_t row = 0; row < input_rows_count; ++row) {
+                if (_is_null_array(arr1, row)) {
                     dst_null_data[row] = true;
-                    break;
+                    continue;
                 }
-                if (arr2.nested_nullmap_data && arr2.nested_nullmap_data[pos]) {
+                if (offsets1[row] - offsets1[row - 1] != dim) [[unlikely]] {
+                    return Status::InvalidArgument(
+                            "function {} have different input element sizes of array: {} and {}",
+                            get_name(), offsets1[row] - offsets1[row - 1], dim);
+                }
+                if (_has_null_element(arr1, row)) {
                     dst_null_data[row] = true;
-                    break;
+                    continue;
                 }
-                DistanceImpl::accumulate(st, nested_col1->get_element(pos),
-                                         nested_col2->get_element(pos));
+                dst_data[row] = DistanceImpl::distance(data1 + offsets1[row - 1], query, dim,
+                                                       prepared);
+                dst_null_data[row] = std::isnan(dst_data[row]);
             }
-            if (!dst_null_data[row]) {
-                dst_data[row] = DistanceImpl::finalize(st);
+        } else {
+            for (size_t row = 0; row < input_rows_count; ++row) {
+                if (_is_null_array(arr1, row) || _is_null_array(arr2, row)) {
+                    dst_null_data[row] = true;
+                    continue;
+                }
+                if (offsets1[row] - offsets1[row - 1] != offsets2[row] - offsets2[row - 1])
+                        [[unlikely]] {
+                    return Status::InvalidArgument(
+                            "function {} have different input element sizes of array: {} and {}",
+                            get_name(), offsets1[row] - offsets1[row - 1],
+                            offsets2[row] - offsets2[row - 1]);
+                }
+                if (_has_null_element(arr1, row) || _has_null_element(arr2, row)) {
+                    dst_null_data[row] = true;
+                    continue;
+                }
+                dst_data[row] = DistanceImpl::distance(data1 + offsets1[row - 1],
+                                                       data2 + offsets2[row - 1],
+                                                       offsets1[row] - offsets1[row - 1]);
                 dst_null_data[row] = std::isnan(dst_data[row]);
             }
         }
@@ -172,6 +211,17 @@ public:
     }
 
 private:
+    static bool _is_null_array(const ColumnArrayExecutionData& arr, size_t row) {
+        return arr.array_nullmap_data && arr.array_nullmap_data[row];
+    }
+
+    static bool _has_null_element(const ColumnArrayExecutionData& arr, size_t row) {
+        const auto& offsets = *arr.offsets_ptr;
+        return arr.nested_nullmap_data &&
+               simd::contain_byte(arr.nested_nullmap_data + offsets[row - 1],
+                                  offsets[row] - offsets[row - 1], 1);
+    }
+
     bool _check_input_type(const DataTypePtr& type) const {
         auto array_type = remove_nullable(type);
         if (array_type->get_primitive_type() != TYPE_ARRAY) {
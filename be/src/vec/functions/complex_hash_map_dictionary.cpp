@@ -17,6 +17,7 @@
 
 #include "vec/functions/complex_hash_map_dictionary.h" // for ComplexHashMapDictionary
 
+#include <algorithm>
 #include <type_traits>
 #include <vector>
 
@@ -25,11 +26,25 @@
 
 namespace doris::vectorized {
 
+// The unsigned number a single key is hashed as by the hash map method, void if the keys are not
+// a single number of at most 8 bytes.
+template <typename HashMethodType>
+struct DirectIndexKey {
+    using Type = void;
+};
+
+template <typename KeyType>
+    requires(sizeof(KeyType) <= sizeof(UInt64))
+struct DirectIndexKey<MethodOneNumber<KeyType, DictHashMap<KeyType>>> {
+    using Type = KeyType;
+};
+
 ComplexHashMapDictionary::~ComplexHashMapDictionary() {
     if (_mem_tracker) {
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_mem_tracker);
         _hash_map_method.method_variant.emplace<std::monostate>();
         ColumnPtrs {}.swap(_key_columns);
+        PaddedPODArray<IColumn::ColumnIndex> {}.swap(_direct_index);
     }
 }
 
@@ -44,6 +59,7 @@ size_t ComplexHashMapDictionary::allocated_bytes() const {
     for (const auto& column : _key_columns) {
         bytes += column->allocated_bytes();
     }
+    bytes += _direct_index.allocated_bytes();
     return bytes + IDictionary::allocated_bytes();
 }
 void ComplexHashMapDictionary::load_data(const ColumnPtrs& key_columns, const DataTypes& key_types,
@@ -54,6 +70,11 @@ void ComplexHashMapDictionary::load_data(const ColumnPtrs& key_columns, const Da
     // save key columns
     _key_columns = key_columns;
 
+    if (key_columns.size() == 1 && build_direct_index(*key_columns[0])) {
+        load_values(values_column);
+        return;
+    }
+
     std::visit(vectorized::Overload {
                        [&](std::monostate& arg) {
                            throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
@@ -95,6 +116,88 @@ void ComplexHashMapDictionary::load_data(const ColumnPtrs& key_columns, const Da
     load_values(values_column);
 }
 
+bool ComplexHashMapDictionary::build_direct_index(const IColumn& key_column) {
+    bool built = false;
+    std::visit(
+            [&](const auto& dict_method) {
+                using KeyType = typename DirectIndexKey<std::decay_t<decltype(dict_method)>>::Type;
+                if constexpr (!std::is_void_v<KeyType>) {
+                    built = build_direct_index<KeyType>(key_column);
+                }
+            },
+            _hash_map_method.method_variant);
+    return built;
+}
+
+template <typename KeyType>
+bool ComplexHashMapDictionary::build_direct_index(const IColumn& key_column) {
+    const size_t rows = key_column.size();
+    if (rows == 0) {
+        return false;
+    }
+    const auto* keys = reinterpret_cast<const KeyType*>(key_column.get_raw_data().data);
+    const auto [min_key, max_key] = std::minmax_element(keys, keys + rows);
+    const auto slots = static_cast<UInt64>(static_cast<KeyType>(*max_key - *min_key)) + 1;
+    if (slots > rows * DIRECT_INDEX_MAX_SLOTS_PER_KEY) {
+        return false;
+    }
+    _direct_index_min_key = *min_key;
+    _direct_index.resize_fill(slots, DIRECT_INDEX_NOT_FOUND);
+    for (size_t i = 0; i < rows; ++i) {
+        auto& index = _direct_index[static_cast<KeyType>(keys[i] - *min_key)];
+        if (index != DIRECT_INDEX_NOT_FOUND) {
+            throw doris::Exception(
+                    ErrorCode::INVALID_ARGUMENT,
+                    DICT_DATA_ERROR_TAG + "The key has duplicate data in HashMapDictionary");
+        }
+        index = i;
+    }
+    return true;
+}
+
+void ComplexHashMapDictionary::find_by_direct_index(const ColumnPtr& key_column,
+                                                    IColumn::Selector& value_index,
+                                                    NullMap& key_not_found) const {
+    const NullMap* key_null_map = nullptr;
+    if (key_column->is_nullable()) {
+        key_null_map = &assert_cast<const ColumnNullable&>(*key_column).get_null_map_data();
+    }
+    std::visit(
+            [&](const auto& dict_method) {
+                using KeyType = typename DirectIndexKey<std::decay_t<decltype(dict_method)>>::Type;
+                if constexpr (std::is_void_v<KeyType>) {
+                    throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited direct index");
+                } else {
+                    find_by_direct_index<KeyType>(*remove_nullable(key_column), key_null_map,
+                                                  value_index, key_not_found);
+                }
+            },
+            _hash_map_method.method_variant);
+}
+
+template <typename KeyType>
+void ComplexHashMapDictionary::find_by_direct_index(const IColumn& key_column,
+                                                    const NullMap* key_null_map,
+                                                    IColumn::Selector& value_index,
+                                                    NullMap& key_not_found) const {
+    if (key_column.size_of_value_if_fixed() != sizeof(KeyType)) {
+        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "key column not match");
+    }
+    const auto* keys = reinterpret_cast<const KeyType*>(key_column.get_raw_data().data);
+    const auto min_key = static_cast<KeyType>(_direct_index_min_key);
+    const size_t slots = _direct_index.size();
+    for (size_t i = 0; i < value_index.size(); ++i) {
+        // the keys less than min_key wrap around to be out of the slots as well
+        const auto slot = static_cast<UInt64>(static_cast<KeyType>(keys[i] - min_key));
+        const auto index = slot < slots ? _direct_index[slot] : DIRECT_INDEX_NOT_FOUND;
+        if (index == DIRECT_INDEX_NOT_FOUND || (key_null_map && (*key_null_map)[i])) {
+            key_not_found[i] = true;
+        } else {
+            value_index[i] = index;
+        }
+    }
+}
+
 void ComplexHashMapDictionary::init_find_hash_map(DictionaryHashMapMethod& find_hash_map_method,
                                                   const DataTypes& key_types) const {
     THROW_IF_ERROR(
@@ -134,6 +237,23 @@ ColumnPtrs ComplexHashMapDictionary::get_tuple_columns(
     // if key is not found, or key is null , wiil set true
     NullMap key_not_found = NullMap(rows, false);
 
+    auto get_value_columns = [&]() {
+        ColumnPtrs columns;
+        for (size_t i = 0; i < attribute_names.size(); ++i) {
+            columns.push_back(get_single_value_column(value_index, key_not_found,
+                                                      attribute_names[i], attribute_types[i]));
+        }
+        return columns;
+    };
+
+    if (!_direct_index.empty()) {
+        if (key_columns.size() != 1) {
+            throw doris::Exception(ErrorCode::INTERNAL_ERROR, "key column not match");
+        }
+        find_by_direct_index(key_columns[0], value_index, key_not_found);
+        return get_value_columns();
+    }
+
     DictionaryHashMapMethod find_hash_map;
     // In init_find_hash_map, hashtable will be shared, similar to shared_hashtable in join
     init_find_hash_map(find_hash_map, key_types);
@@ -188,12 +308,7 @@ ColumnPtrs ComplexHashMapDictionary::get_tuple_columns(
                        }},
                find_hash_map.method_variant, make_bool_variant(key_hash_nullable));
 
-    ColumnPtrs columns;
-    for (size_t i = 0; i < attribute_names.size(); ++i) {
-        columns.push_back(get_single_value_column(value_index, key_not_found, attribute_names[i],
-                                                  attribute_types[i]));
-    }
-    return columns;
+    return get_value_columns();
 }
 
 ColumnPtr ComplexHashMapDictionary::get_single_value_column(
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -78,8 +79,29 @@ private:
     void init_find_hash_map(DictionaryHashMapMethod& find_hash_map_method,
                             const DataTypes& key_types) const;
 
+    // Returns false if the keys are not a dense single number, which are looked up in the hash
+    // map instead.
+    bool build_direct_index(const IColumn& key_column);
+    template <typename KeyType>
+    bool build_direct_index(const IColumn& key_column);
+
+    void find_by_direct_index(const ColumnPtr& key_column, IColumn::Selector& value_index,
+                              NullMap& key_not_found) const;
+    template <typename KeyType>
+    void find_by_direct_index(const IColumn& key_column, const NullMap* key_null_map,
+                              IColumn::Selector& value_index, NullMap& key_not_found) const;
+
     DictionaryHashMapMethod _hash_map_method;
 
+    // A single number key is dense if the keys span at most DIRECT_INDEX_MAX_SLOTS_PER_KEY times
+    // as many values as there are keys. Then the value index of key k is at
+    // _direct_index[k - _direct_index_min_key], which is a perfect hash of the keys.
+    static constexpr size_t DIRECT_INDEX_MAX_SLOTS_PER_KEY = 2;
+    static constexpr IColumn::ColumnIndex DIRECT_INDEX_NOT_FOUND =
+            std::numeric_limits<IColumn::ColumnIndex>::max();
+    PaddedPODArray<IColumn::ColumnIndex> _direct_index;
+    UInt64 _direct_index_min_key = 0;
+
     // Used to save key columns, because some types of hashmaps do not hold key columns, such as MethodStringNoCache
     ColumnPtrs _key_columns;
 };
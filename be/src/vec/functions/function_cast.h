@@ -46,6 +46,7 @@
 #include "util/jsonb_stream.h"
 #include "util/jsonb_utils.h"
 #include "util/jsonb_writer.h"
+#include "util/simd/string_to_number.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
@@ -1290,6 +1291,12 @@ struct StringParsing {
             size_t next_offset = (*offsets)[i];
             size_t string_size = next_offset - current_offset;
 
+            if (_try_parse_fast(vec_to[i],
+                                reinterpret_cast<const char*>(&(*chars)[current_offset]),
+                                string_size, scale)) {
+                current_offset = next_offset;
+                continue;
+            }
             ReadBuffer read_buffer(&(*chars)[current_offset], string_size);
 
             bool parsed;
@@ -1314,6 +1321,42 @@ struct StringParsing {
                 ColumnNullable::create(std::move(col_to), std::move(col_null_map_to));
         return Status::OK();
     }
+
+private:
+    // The plain integers and the datetimes of the common formats, the other strings are parsed
+    // by the general parsers.
+    static bool _try_parse_fast(ToFieldType& x, const char* data, size_t size,
+                                UInt32 scale [[maybe_unused]]) {
+        if constexpr (std::is_same_v<ToDataType, DataTypeInt8> ||
+                      std::is_same_v<ToDataType, DataTypeInt16> ||
+                      std::is_same_v<ToDataType, DataTypeInt32> ||
+                      std::is_same_v<ToDataType, DataTypeInt64> ||
+                      std::is_same_v<ToDataType, DataTypeInt128>) {
+            return simd::parse_int(data, size, &x);
+        } else if constexpr (IsDataTypeDateTimeV2<ToDataType>) {
+            simd::DateTimeParts parts;
+            DateV2Value<DateTimeV2ValueType> value;
+            if (!simd::parse_datetime(data, size, scale, &parts) ||
+                !value.check_range_and_set_time(parts.year, parts.month, parts.day, parts.hour,
+                                                parts.minute, parts.second,
+                                                parts.microsecond)) {
+                return false;
+            }
+            x = binary_cast<DateV2Value<DateTimeV2ValueType>, UInt64>(value);
+            return true;
+        } else if constexpr (IsDateV2Type<ToDataType>) {
+            simd::DateTimeParts parts;
+            DateV2Value<DateV2ValueType> value;
+            if (size != 10 || !simd::parse_datetime(data, size, 0, &parts) ||
+                !value.check_range_and_set_time(parts.year, parts.month, parts.day, 0, 0, 0, 0)) {
+                return false;
+            }
+            x = binary_cast<DateV2Value<DateV2ValueType>, UInt32>(value);
+            return true;
+        } else {
+            return false;
+        }
+    }
 };
 
 template <typename Name>
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -231,51 +232,149 @@ private:
             }
             return;
         }
+
+        const auto& dates = date_column->get_data();
+        auto& result_data = result_column->get_data();
+        result_data.resize_fill(input_rows_count, 0);
+        [[maybe_unused]] int64_t delta = 0;
+        [[maybe_unused]] bool fixed_offset = false;
+        if constexpr (!is_v1) {
+            fixed_offset = _get_fixed_delta(from_tz, to_tz, dates, result_null_map,
+                                            input_rows_count, &delta);
+        }
         for (size_t i = 0; i < input_rows_count; i++) {
             if (result_null_map[i]) {
-                result_column->insert_default();
                 continue;
             }
-
-            DateValueType ts_value =
-                    binary_cast<NativeType, DateValueType>(date_column->get_element(i));
-            ReturnDateValueType ts_value2;
-
-            if constexpr (std::is_same_v<ArgDateType, DataTypeDateTimeV2>) {
-                std::pair<int64_t, int64_t> timestamp;
-                if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
-                    push_null(i);
+            if constexpr (!is_v1) {
+                if (fixed_offset && _shift(dates[i], delta, &result_data[i])) {
                     continue;
                 }
-                ts_value2.from_unixtime(timestamp, to_tz);
-            } else {
-                int64_t timestamp;
-                if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
-                    push_null(i);
-                    continue;
-                }
-                ts_value2.from_unixtime(timestamp, to_tz);
             }
+            if (!_convert_value(from_tz, to_tz, dates[i], &result_data[i])) {
+                result_null_map[i] = true;
+            }
+        }
+    }
 
-            if (!ts_value2.is_valid_date()) [[unlikely]] {
-                push_null(i);
-                continue;
+    // Convert a value with the zones, false if the result is null.
+    static bool _convert_value(const cctz::time_zone& from_tz, const cctz::time_zone& to_tz,
+                               NativeType value, ReturnNativeType* result) {
+        DateValueType ts_value = binary_cast<NativeType, DateValueType>(value);
+        ReturnDateValueType ts_value2;
+
+        if constexpr (std::is_same_v<ArgDateType, DataTypeDateTimeV2>) {
+            std::pair<int64_t, int64_t> timestamp;
+            if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
+                return false;
+            }
+            ts_value2.from_unixtime(timestamp, to_tz);
+        } else {
+            int64_t timestamp;
+            if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
+                return false;
             }
+            ts_value2.from_unixtime(timestamp, to_tz);
+        }
 
-            if constexpr (std::is_same_v<ArgDateType, DataTypeDateTimeV2>) {
-                result_column->insert(Field::create_field<TYPE_DATETIMEV2>(
-                        binary_cast<ReturnDateValueType, ReturnNativeType>(ts_value2)));
-            } else if constexpr (std::is_same_v<ArgDateType, DataTypeDateV2>) {
-                result_column->insert(Field::create_field<TYPE_DATEV2>(
-                        binary_cast<ReturnDateValueType, ReturnNativeType>(ts_value2)));
-            } else if constexpr (std::is_same_v<ArgDateType, DataTypeDateTime>) {
-                result_column->insert(Field::create_field<TYPE_DATETIME>(
-                        binary_cast<ReturnDateValueType, ReturnNativeType>(ts_value2)));
-            } else {
-                result_column->insert(Field::create_field<TYPE_DATE>(
-                        binary_cast<ReturnDateValueType, ReturnNativeType>(ts_value2)));
+        if (!ts_value2.is_valid_date()) [[unlikely]] {
+            return false;
+        }
+        *result = binary_cast<ReturnDateValueType, ReturnNativeType>(ts_value2);
+        return true;
+    }
+
+    static cctz::civil_second _civil_second(NativeType value) {
+        auto date = binary_cast<NativeType, DateValueType>(value);
+        return {date.year(), date.month(), date.day(), date.hour(), date.minute(), date.second()};
+    }
+
+    // Set *delta to the seconds to add to the values to convert them, if neither zone changes
+    // its offset between the smallest and the largest values of the batch.
+    static bool _get_fixed_delta(const cctz::time_zone& from_tz, const cctz::time_zone& to_tz,
+                                 const PaddedPODArray<NativeType>& dates,
+                                 const NullMap& null_map, size_t input_rows_count,
+                                 int64_t* delta) {
+        // the order of the values of v2 types is the order of the times
+        NativeType min_value = std::numeric_limits<NativeType>::max();
+        NativeType max_value = 0;
+        for (size_t i = 0; i < input_rows_count; i++) {
+            auto date = binary_cast<NativeType, DateValueType>(dates[i]);
+            // the nested values of the null rows are zero dates
+            if (!null_map[i] && date.month() != 0 && date.day() != 0) {
+                min_value = std::min(min_value, dates[i]);
+                max_value = std::max(max_value, dates[i]);
             }
         }
+        if (min_value > max_value) {
+            return false;
+        }
+
+        const cctz::civil_second epoch(1970, 1, 1, 0, 0, 0);
+        const auto begin = _civil_second(min_value);
+        const auto end = _civil_second(max_value);
+        int64_t from_offset = 0;
+        int64_t to_offset = 0;
+        if (!TimezoneUtils::get_fixed_offset(from_tz, begin, end, &from_offset) ||
+            !TimezoneUtils::get_fixed_offset(to_tz, (begin - epoch) - from_offset,
+                                             (end - epoch) - from_offset, &to_offset)) {
+            return false;
+        }
+        *delta = to_offset - from_offset;
+        return true;
+    }
+
+    // Days since 1970-01-01 of a date of the proleptic Gregorian calendar.
+    static int64_t _days_from_civil(int64_t year, uint32_t month, uint32_t day) {
+        year -= month <= 2;
+        const int64_t era = (year >= 0 ? year : year - 399) / 400;
+        const auto year_of_era = static_cast<uint32_t>(year - era * 400);
+        const uint32_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        const uint32_t day_of_era =
+                year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+        return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+    }
+
+    static void _civil_from_days(int64_t days, int64_t* year, uint32_t* month, uint32_t* day) {
+        days += 719468;
+        const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+        const auto day_of_era = static_cast<uint32_t>(days - era * 146097);
+        const uint32_t year_of_era =
+                (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+        const uint32_t day_of_year =
+                day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+        const uint32_t month_from_march = (5 * day_of_year + 2) / 153;
+        *day = day_of_year - (153 * month_from_march + 2) / 5 + 1;
+        *month = month_from_march < 10 ? month_from_march + 3 : month_from_march - 9;
+        *year = static_cast<int64_t>(year_of_era) + era * 400 + (*month <= 2);
+    }
+
+    // Add delta seconds to a value without looking up the zones, false if the value is a zero
+    // date or the result is out of the range of the type.
+    static bool _shift(NativeType value, int64_t delta, ReturnNativeType* result) {
+        auto date = binary_cast<NativeType, DateValueType>(value);
+        if (date.month() == 0 || date.day() == 0) [[unlikely]] {
+            return false;
+        }
+        int64_t seconds = _days_from_civil(date.year(), date.month(), date.day()) * 86400 +
+                          date.hour() * 3600 + date.minute() * 60 + date.second() + delta;
+        int64_t days = seconds >= 0 ? seconds / 86400 : (seconds - 86399) / 86400;
+        auto second_of_day = static_cast<uint32_t>(seconds - days * 86400);
+        int64_t year = 0;
+        uint32_t month = 0;
+        uint32_t day = 0;
+        _civil_from_days(days, &year, &month, &day);
+        if (year < 0 || year > MAX_YEAR) [[unlikely]] {
+            return false;
+        }
+        ReturnDateValueType shifted;
+        shifted.unchecked_set_time(static_cast<uint16_t>(year), static_cast<uint8_t>(month),
+                                   static_cast<uint8_t>(day),
+                                   static_cast<uint8_t>(second_of_day / 3600),
+                                   static_cast<uint8_t>(second_of_day / 60 % 60),
+                                   static_cast<uint16_t>(second_of_day % 60), date.microsecond());
+        *result = binary_cast<ReturnDateValueType, ReturnNativeType>(shifted);
+        return true;
     }
 
     static void execute_tz_const(FunctionContext* context, const ColumnType* date_column,
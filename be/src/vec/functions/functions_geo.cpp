@@ -1,3 +1,54 @@
+    static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
+                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
+        // decode the constant shape only once
+        auto lhs_value = left_column->get_data_at(0);
+        std::unique_ptr<GeoShape> lhs_shape(GeoShape::from_encoded(lhs_value.data, lhs_value.size));
+        if (!lhs_shape) {
+            std::fill(null_map.begin(), null_map.end(), 1);
+            return;
+        }
+        std::unique_ptr<GeoCellCovering> covering;
+        if constexpr (Func::PRUNE_POINTS_BY_COVERING) {
+            covering = GeoCellCovering::create(*lhs_shape);
+        }
+        for (int row = 0; row < size; ++row) {
+            auto rhs_value = right_column->get_data_at(row);
+            std::unique_ptr<GeoShape> rhs_shape(
+                    GeoShape::from_encoded(rhs_value.data, rhs_value.size));
+            if (!rhs_shape) {
+                null_map[row] = 1;
+                continue;
+            }
+            if (covering && rhs_shape->type() == GEO_SHAPE_POINT &&
+                !covering->may_contain(assert_cast<const GeoPoint&>(*rhs_shape))) {
+                // res is 0 already
+                continue;
+            }
+            res->get_data()[row] = Func::evaluate(lhs_shape.get(), rhs_shape.get());
+        }
+    }
+
+    static void vector_const(const ColumnPtr& left_column, const ColumnPtr& right_column,
+                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
+        // decode the constant shape only once
+        auto rhs_value = right_column->get_data_at(0);
+        std::unique_ptr<GeoShape> rhs_shape(GeoShape::from_encoded(rhs_value.data, rhs_value.size));
+        if (!rhs_shape) {
+            std::fill(null_map.begin(), null_map.end(), 1);
+            return;
+        }
+        for (int row = 0; row < size; ++row) {
+            auto lhs_value = left_column->get_data_at(row);
+            std::unique_ptr<GeoShape> lhs_shape(
+                    GeoShape::from_encoded(lhs_value.data, lhs_value.size));
+            if (!lhs_shape) {
+                null_map[row] = 1;
+                continue;
+            }
+            res->get_data()[row] = Func::evaluate(lhs_shape.get(), rhs_shape.get());
+        }
+    }
+
 // Licensed to the Apache Software Foundation (ASF) under one
 // or more contributor license agreements.  See the NOTICE file
 // distributed with this work for additional information
@@ -687,21 +738,26 @@ struct StRelationFunction {
 
 struct StContainsFunc {
     static constexpr auto NAME = "st_contains";
+    // a shape contains only the points in its covering
+    static constexpr bool PRUNE_POINTS_BY_COVERING = true;
     static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->contains(shape2); }
 };
 
 struct StIntersectsFunc {
     static constexpr auto NAME = "st_intersects";
+    static constexpr bool PRUNE_POINTS_BY_COVERING = false;
     static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->intersects(shape2); }
 };
 
 struct StDisjointFunc {
     static constexpr auto NAME = "st_disjoint";
+    static constexpr bool PRUNE_POINTS_BY_COVERING = false;
     static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->disjoint(shape2); }
 };
 
 struct StTouchesFunc {
     static constexpr auto NAME = "st_touches";
+    static constexpr bool PRUNE_POINTS_BY_COVERING = false;
     static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->touches(shape2); }
 };
 
@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/functions/hyperscan_database_cache.h"
+
+#include <fmt/format.h>
+
+#include "runtime/exec_env.h"
+
+namespace doris::vectorized {
+
+Status HyperscanDatabaseCache::Handle::clone_scratch(multiregexps::ScratchPtr* scratch) const {
+    hs_scratch_t* cloned = nullptr;
+    if (hs_clone_scratch(_database->scratch.get(), &cloned) != HS_SUCCESS) {
+        return Status::RuntimeError<false>("hs_clone_scratch clone scratch space error");
+    }
+    scratch->reset(cloned);
+    return Status::OK();
+}
+
+Status HyperscanDatabaseCache::get(const std::vector<std::string>& patterns, unsigned int flags,
+                                   HandlePtr* handle) {
+    return get(ExecEnv::GetInstance()->hyperscan_database_cache(), patterns, flags, handle);
+}
+
+Status HyperscanDatabaseCache::get(HyperscanDatabaseCache* cache,
+                                   const std::vector<std::string>& patterns, unsigned int flags,
+                                   HandlePtr* handle) {
+    auto result = std::make_shared<Handle>();
+    std::string key;
+    if (cache != nullptr) {
+        key = _key(patterns, flags);
+        auto* lru_handle = cache->lookup(key);
+        if (lru_handle != nullptr) {
+            result->_cache_handle = ObjLRUCache::CacheHandle(cache, lru_handle);
+            result->_database =
+                    static_cast<const Database*>(result->_cache_handle.data<Database>());
+            RETURN_IF_ERROR(result->_database->status);
+            *handle = std::move(result);
+            return Status::OK();
+        }
+    }
+
+    auto database = std::make_unique<Database>();
+    database->status = _compile(patterns, flags, database.get());
+    // only the patterns which don't compile are cached, not failing to allocate the scratch
+    if (cache == nullptr || (!database->status.ok() && database->database != nullptr)) {
+        RETURN_IF_ERROR(database->status);
+        result->_database = database.get();
+        result->_owned_database = std::move(database);
+        *handle = std::move(result);
+        return Status::OK();
+    }
+
+    size_t charge = sizeof(Database) + key.size();
+    if (database->status.ok()) {
+        size_t database_size = 0;
+        size_t scratch_size = 0;
+        hs_database_size(database->database.get(), &database_size);
+        hs_scratch_size(database->scratch.get(), &scratch_size);
+        charge += database_size + scratch_size;
+    }
+    Status status = database->status;
+    auto* value = new ObjLRUCache::ObjValue<Database>(database.release());
+    auto* lru_handle = cache->insert(key, value, charge, charge, CachePriority::NORMAL);
+    result->_cache_handle = ObjLRUCache::CacheHandle(cache, lru_handle);
+    result->_database = static_cast<const Database*>(result->_cache_handle.data<Database>());
+    RETURN_IF_ERROR(status);
+    *handle = std::move(result);
+    return Status::OK();
+}
+
+std::string HyperscanDatabaseCache::_key(const std::vector<std::string>& patterns,
+                                         unsigned int flags) {
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer), "{}", flags);
+    for (const auto& pattern : patterns) {
+        // the lengths keep the patterns apart, whatever bytes they have
+        fmt::format_to(std::back_inserter(buffer), ":{}:{}", pattern.size(), pattern);
+    }
+    return fmt::to_string(buffer);
+}
+
+Status HyperscanDatabaseCache::_compile(const std::vector<std::string>& patterns,
+                                        unsigned int flags, Database* database) {
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> expression_flags(patterns.size(), flags);
+    std::vector<unsigned int> ids;
+    expressions.reserve(patterns.size());
+    ids.reserve(patterns.size());
+    for (size_t i = 0; i < patterns.size(); ++i) {
+        expressions.push_back(patterns[i].c_str());
+        ids.push_back(static_cast<unsigned int>(i));
+    }
+
+    hs_database_t* db = nullptr;
+    hs_compile_error_t* compile_error = nullptr;
+    if (hs_compile_multi(expressions.data(), expression_flags.data(), ids.data(),
+                         static_cast<unsigned int>(expressions.size()), HS_MODE_BLOCK, nullptr,
+                         &db, &compile_error) != HS_SUCCESS) {
+        multiregexps::CompilerError error(compile_error);
+        // Do not call FunctionContext::set_error here, since we do not want to cancel the query.
+        return Status::RuntimeError<false>("hs_compile regex pattern error:{}", error->message);
+    }
+    database->database.reset(db);
+
+    hs_scratch_t* scratch = nullptr;
+    if (hs_alloc_scratch(db, &scratch) != HS_SUCCESS) {
+        return Status::RuntimeError<false>("hs_alloc_scratch allocate scratch space error");
+    }
+    database->scratch.reset(scratch);
+    return Status::OK();
+}
+
+} // namespace doris::vectorized
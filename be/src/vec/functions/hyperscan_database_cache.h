@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <hs/hs.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "common/status.h"
+#include "util/obj_lru_cache.h"
+#include "vec/functions/regexps.h"
+
+namespace doris::vectorized {
+
+// The hyperscan databases compiled from the patterns of LIKE and REGEXP. The fragment instances
+// and the following queries share the databases instead of compiling the same patterns again. A
+// pattern hyperscan can't compile is cached as well, so the callers fall back to re2 at once.
+// It's charged by the bytes of the databases and their scratch spaces.
+class HyperscanDatabaseCache : public LRUCachePolicy {
+public:
+    struct Database {
+        multiregexps::DataBasePtr database;
+        // the prototype of the scratch spaces, hs_scan needs one for each thread
+        multiregexps::ScratchPtr scratch;
+        Status status;
+    };
+
+    // The database held by a cache handle, or by itself if the cache is disabled.
+    class Handle {
+    public:
+        hs_database_t* database() const { return _database->database.get(); }
+
+        // Allocate a scratch space for the caller by cloning the one of the database, which is
+        // faster than allocating it.
+        Status clone_scratch(multiregexps::ScratchPtr* scratch) const;
+
+    private:
+        friend class HyperscanDatabaseCache;
+
+        ObjLRUCache::CacheHandle _cache_handle;
+        std::unique_ptr<Database> _owned_database;
+        const Database* _database = nullptr;
+    };
+
+    // shared by the cloned states of a function, each one has its own scratch space
+    using HandlePtr = std::shared_ptr<const Handle>;
+
+    HyperscanDatabaseCache(size_t capacity)
+            : LRUCachePolicy(CachePolicy::CacheType::HYPERSCAN_DATABASE_CACHE, capacity,
+                             LRUCacheType::SIZE,
+                             config::common_obj_lru_cache_stale_sweep_time_sec) {}
+
+    // Set *handle to the database which matches the patterns compiled with flags, the id of a
+    // match is the index of its pattern. The cache of ExecEnv is used if it's enabled.
+    static Status get(const std::vector<std::string>& patterns, unsigned int flags,
+                      HandlePtr* handle);
+
+    static Status get(HyperscanDatabaseCache* cache, const std::vector<std::string>& patterns,
+                      unsigned int flags, HandlePtr* handle);
+
+private:
+    static std::string _key(const std::vector<std::string>& patterns, unsigned int flags);
+
+    static Status _compile(const std::vector<std::string>& patterns, unsigned int flags,
+                           Database* database);
+};
+
+} // namespace doris::vectorized
@@ -186,16 +186,18 @@ struct VectorEndsWithSearchState : public VectorPatternSearchState {
 Status LikeSearchState::clone(LikeSearchState& cloned) {
     cloned.escape_char = escape_char;
     cloned.set_search_string(search_string);
+    cloned.pattern_str = pattern_str;
+    cloned.is_regexp = is_regexp;
 
     std::string re_pattern;
-    FunctionLike::convert_like_pattern(this, pattern_str, &re_pattern);
+    if (is_regexp) {
+        re_pattern = pattern_str;
+    } else {
+        FunctionLike::convert_like_pattern(this, pattern_str, &re_pattern);
+    }
     if (hs_database) { // use hyperscan
-        hs_database_t* database = nullptr;
-        hs_scratch_t* scratch = nullptr;
-        RETURN_IF_ERROR(FunctionLike::hs_prepare(nullptr, re_pattern.c_str(), &database, &scratch));
-
-        cloned.hs_database.reset(database);
-        cloned.hs_scratch.reset(scratch);
+        cloned.hs_database = hs_database;
+        RETURN_IF_ERROR(hs_database->clone_scratch(&cloned.hs_scratch));
     } else { // fallback to re2
         cloned.hs_database.reset();
         cloned.hs_scratch.reset();
@@ -383,7 +385,8 @@ Status FunctionLikeBase::vector_substring_fn(const ColumnString& vals,
 Status FunctionLikeBase::constant_regex_fn_scalar(LikeSearchState* state, const StringRef& val,
                                                   const StringRef& pattern, unsigned char* result) {
     if (state->hs_database) { // use hyperscan
-        auto ret = hs_scan(state->hs_database.get(), val.data, val.size, 0, state->hs_scratch.get(),
+        auto ret = hs_scan(state->hs_database->database(), val.data, val.size, 0,
+                           state->hs_scratch.get(),
                            doris::vectorized::LikeSearchState::hs_match_handler, (void*)result);
         if (ret != HS_SUCCESS && ret != HS_SCAN_TERMINATED) {
             return Status::RuntimeError(fmt::format("hyperscan error: {}", ret));
@@ -417,7 +420,7 @@ Status FunctionLikeBase::constant_regex_fn(LikeSearchState* state, const ColumnS
     if (state->hs_database) { // use hyperscan
         for (size_t i = 0; i < sz; i++) {
             const auto& str_ref = val.get_data_at(i);
-            auto ret = hs_scan(state->hs_database.get(), str_ref.data, str_ref.size, 0,
+            auto ret = hs_scan(state->hs_database->database(), str_ref.data, str_ref.size, 0,
                                state->hs_scratch.get(),
                                doris::vectorized::LikeSearchState::hs_match_handler,
                                (void*)(result.data() + i));
@@ -440,22 +443,20 @@ Status FunctionLikeBase::regexp_fn(LikeSearchState* state, const ColumnString& v
                                    const StringRef& pattern, ColumnUInt8::Container& result) {
     std::string re_pattern(pattern.data, pattern.size);
 
-    hs_database_t* database = nullptr;
-    hs_scratch_t* scratch = nullptr;
+    HyperscanDatabaseCache::HandlePtr database;
+    multiregexps::ScratchPtr scratch;
     if (hs_prepare(nullptr, re_pattern.c_str(), &database, &scratch).ok()) { // use hyperscan
         auto sz = val.size();
         for (size_t i = 0; i < sz; i++) {
             const auto& str_ref = val.get_data_at(i);
-            auto ret = hs_scan(database, str_ref.data, str_ref.size, 0, scratch,
+            auto ret = hs_scan(database->database(), str_ref.data, str_ref.size, 0,
+                               scratch.get(),
                                doris::vectorized::LikeSearchState::hs_match_handler,
                                (void*)(result.data() + i));
             if (ret != HS_SUCCESS && ret != HS_SCAN_TERMINATED) {
                 return Status::RuntimeError(fmt::format("hyperscan error: {}", ret));
             }
         }
-
-        hs_free_scratch(scratch);
-        hs_free_database(database);
     } else { // fallback to re2
         RE2::Options opts;
         opts.set_never_nl(false);
@@ -476,30 +477,16 @@ Status FunctionLikeBase::regexp_fn(LikeSearchState* state, const ColumnString& v
     return Status::OK();
 }
 
-// hyperscan compile expression to database and allocate scratch space
+// get the hyperscan database compiled from expression, which is shared by the queries, and
+// allocate scratch space
 Status FunctionLikeBase::hs_prepare(FunctionContext* context, const char* expression,
-                                    hs_database_t** database, hs_scratch_t** scratch) {
-    hs_compile_error_t* compile_err;
-    auto res = hs_compile(expression, HS_FLAG_DOTALL | HS_FLAG_ALLOWEMPTY | HS_FLAG_UTF8,
-                          HS_MODE_BLOCK, nullptr, database, &compile_err);
-
-    if (res != HS_SUCCESS) {
-        *database = nullptr;
-        std::string error_message = compile_err->message;
-        hs_free_compile_error(compile_err);
-        // Do not call FunctionContext::set_error here, since we do not want to cancel the query here.
-        return Status::RuntimeError<false>("hs_compile regex pattern error:" + error_message);
-    }
-    hs_free_compile_error(compile_err);
-
-    if (hs_alloc_scratch(*database, scratch) != HS_SUCCESS) {
-        hs_free_database(*database);
-        *database = nullptr;
-        *scratch = nullptr;
-        // Do not call FunctionContext::set_error here, since we do not want to cancel the query here.
-        return Status::RuntimeError<false>("hs_alloc_scratch allocate scratch space error");
-    }
-
+                                    HyperscanDatabaseCache::HandlePtr* database,
+                                    multiregexps::ScratchPtr* scratch) {
+    HyperscanDatabaseCache::HandlePtr handle;
+    RETURN_IF_ERROR(HyperscanDatabaseCache::get(
+            {expression}, HS_FLAG_DOTALL | HS_FLAG_ALLOWEMPTY | HS_FLAG_UTF8, &handle));
+    RETURN_IF_ERROR(handle->clone_scratch(scratch));
+    *database = std::move(handle);
     return Status::OK();
 }
 
@@ -878,12 +865,12 @@ Status FunctionLike::construct_like_const_state(FunctionContext* context, const
                        << ", size: " << re_pattern.size();
         }
 
-        hs_database_t* database = nullptr;
-        hs_scratch_t* scratch = nullptr;
+        HyperscanDatabaseCache::HandlePtr database;
+        multiregexps::ScratchPtr scratch;
         if (try_hyperscan && hs_prepare(context, re_pattern.c_str(), &database, &scratch).ok()) {
             // use hyperscan
-            state->search_state.hs_database.reset(database);
-            state->search_state.hs_scratch.reset(scratch);
+            state->search_state.hs_database = std::move(database);
+            state->search_state.hs_scratch = std::move(scratch);
         } else {
             // fallback to re2
             // reset hs_database to nullptr to indicate not use hyperscan
@@ -939,6 +926,8 @@ Status FunctionRegexpLike::open(FunctionContext* context,
         const auto& pattern = pattern_col->get_data_at(0);
 
         std::string pattern_str = pattern.to_string();
+        state->search_state.pattern_str = pattern_str;
+        state->search_state.is_regexp = true;
         std::string search_string;
         if (RE2::FullMatch(pattern_str, ALLPASS_RE)) {
             state->search_state.set_search_string("");
@@ -961,12 +950,12 @@ Status FunctionRegexpLike::open(FunctionContext* context,
             state->function = constant_substring_fn;
             state->scalar_function = constant_substring_fn_scalar;
         } else {
-            hs_database_t* database = nullptr;
-            hs_scratch_t* scratch = nullptr;
+            HyperscanDatabaseCache::HandlePtr database;
+            multiregexps::ScratchPtr scratch;
             if (hs_prepare(context, pattern_str.c_str(), &database, &scratch).ok()) {
                 // use hyperscan
-                state->search_state.hs_database.reset(database);
-                state->search_state.hs_scratch.reset(scratch);
+                state->search_state.hs_database = std::move(database);
+                state->search_state.hs_scratch = std::move(scratch);
             } else {
                 // fallback to re2
                 // reset hs_database to nullptr to indicate not use hyperscan
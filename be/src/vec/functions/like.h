@@ -41,6 +41,7 @@
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/functions/function.h"
+#include "vec/functions/hyperscan_database_cache.h"
 
 namespace doris {
 namespace vectorized {
@@ -61,6 +62,9 @@ struct LikeSearchState {
 
     std::string pattern_str;
 
+    /// Whether pattern_str is a regular expression of REGEXP rather than a LIKE pattern.
+    bool is_regexp = false;
+
     /// Used for LIKE predicates if the pattern is a constant argument, and is either a
     /// constant string or has a constant string at the beginning or end of the pattern.
     /// This will be set in order to check for that pattern in the corresponding part of
@@ -75,19 +79,10 @@ struct LikeSearchState {
     /// Used for RLIKE and REGEXP predicates if the pattern is a constant argument.
     std::unique_ptr<re2::RE2> regex;
 
-    template <typename Deleter, Deleter deleter>
-    struct HyperscanDeleter {
-        template <typename T>
-        void operator()(T* ptr) const {
-            deleter(ptr);
-        }
-    };
-
-    // hyperscan compiled pattern database and scratch space, reused for performance
-    std::unique_ptr<hs_database_t, HyperscanDeleter<decltype(&hs_free_database), &hs_free_database>>
-            hs_database;
-    std::unique_ptr<hs_scratch_t, HyperscanDeleter<decltype(&hs_free_scratch), &hs_free_scratch>>
-            hs_scratch;
+    // hyperscan compiled pattern database shared with the cloned states, and the scratch space
+    // of this state
+    HyperscanDatabaseCache::HandlePtr hs_database;
+    multiregexps::ScratchPtr hs_scratch;
 
     // hyperscan match callback
     static int hs_match_handler(unsigned int /* from */,       // NOLINT
@@ -238,9 +233,10 @@ protected:
     static Status regexp_fn_scalar(LikeSearchState* state, const StringRef& val,
                                    const StringRef& pattern, unsigned char* result);
 
-    // hyperscan compile expression to database and allocate scratch space
+    // get the hyperscan database compiled from expression and allocate scratch space
     static Status hs_prepare(FunctionContext* context, const char* expression,
-                             hs_database_t** database, hs_scratch_t** scratch);
+                             HyperscanDatabaseCache::HandlePtr* database,
+                             multiregexps::ScratchPtr* scratch);
 };
 
 class FunctionLike : public FunctionLikeBase {
@@ -32,29 +32,36 @@ Status Crc32HashPartitioner<ChannelIds>::do_partitioning(RuntimeState* state, Bl
     size_t rows = block->rows();
 
     if (rows > 0) {
-        auto column_to_keep = block->columns();
-
-        int result_size = cast_set<int>(_partition_expr_ctxs.size());
-        std::vector<int> result(result_size);
-
-        _hash_vals.resize(rows);
-        std::fill(_hash_vals.begin(), _hash_vals.end(), 0);
+        RETURN_IF_ERROR(_compute_hashes(block));
         auto* __restrict hashes = _hash_vals.data();
-        { RETURN_IF_ERROR(_get_partition_column_result(block, result)); }
-        for (int j = 0; j < result_size; ++j) {
-            const auto& [col, is_const] = unpack_if_const(block->get_by_position(result[j]).column);
-            if (is_const) {
-                continue;
-            }
-            _do_hash(col, hashes, j);
-        }
-
         for (size_t i = 0; i < rows; i++) {
             hashes[i] = ChannelIds()(hashes[i], _partition_count);
         }
+    }
+    return Status::OK();
+}
 
-        { Block::erase_useless_column(block, column_to_keep); }
+template <typename ChannelIds>
+Status Crc32HashPartitioner<ChannelIds>::_compute_hashes(Block* block) const {
+    size_t rows = block->rows();
+    auto column_to_keep = block->columns();
+
+    int result_size = cast_set<int>(_partition_expr_ctxs.size());
+    std::vector<int> result(result_size);
+
+    _hash_vals.resize(rows);
+    std::fill(_hash_vals.begin(), _hash_vals.end(), 0);
+    auto* __restrict hashes = _hash_vals.data();
+    { RETURN_IF_ERROR(_get_partition_column_result(block, result)); }
+    for (int j = 0; j < result_size; ++j) {
+        const auto& [col, is_const] = unpack_if_const(block->get_by_position(result[j]).column);
+        if (is_const) {
+            continue;
+        }
+        _do_hash(col, hashes, j);
     }
+
+    { Block::erase_useless_column(block, column_to_keep); }
     return Status::OK();
 }
 
@@ -83,4 +90,32 @@ Status Crc32HashPartitioner<ChannelIds>::clone(RuntimeState* state,
 template class Crc32HashPartitioner<ShuffleChannelIds>;
 template class Crc32HashPartitioner<SpillPartitionChannelIds>;
 
+Status SpillRepartitioner::do_partitioning(RuntimeState* state, Block* block, bool eos,
+                                           bool* already_sent) const {
+    size_t rows = block->rows();
+
+    if (rows > 0) {
+        RETURN_IF_ERROR(_compute_hashes(block));
+        auto* __restrict hashes = _hash_vals.data();
+        for (size_t i = 0; i < rows; i++) {
+            hashes[i] = channel_id(hashes[i], _level, _partition_count);
+        }
+    }
+    return Status::OK();
+}
+
+Status SpillRepartitioner::clone(RuntimeState* state,
+                                 std::unique_ptr<PartitionerBase>& partitioner) {
+    auto* new_partitioner = new SpillRepartitioner(cast_set<int>(_partition_count));
+
+    partitioner.reset(new_partitioner);
+    new_partitioner->_level = _level;
+    new_partitioner->_partition_expr_ctxs.resize(_partition_expr_ctxs.size());
+    for (size_t i = 0; i < _partition_expr_ctxs.size(); i++) {
+        RETURN_IF_ERROR(
+                _partition_expr_ctxs[i]->clone(state, new_partitioner->_partition_expr_ctxs[i]));
+    }
+    return Status::OK();
+}
+
 } // namespace doris::vectorized
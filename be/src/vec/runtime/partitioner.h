@@ -96,6 +96,9 @@ protected:
 
     void _do_hash(const ColumnPtr& column, uint32_t* __restrict result, int idx) const;
 
+    // Computes the crc hash of every row of the block into _hash_vals.
+    Status _compute_hashes(Block* block) const;
+
     VExprContextSPtrs _partition_expr_ctxs;
     mutable std::vector<uint32_t> _hash_vals;
 };
@@ -113,5 +116,34 @@ struct SpillPartitionChannelIds {
         return ((l >> 16) | (l << 16)) % r;
     }
 };
+
+// Splits the rows of one spilled partition into sub partitions again. All the rows of a
+// partition got the same channel id from SpillPartitionChannelIds, so the hash is mixed with a
+// seed of the repartition level before picking the channel.
+class SpillRepartitioner final : public Crc32HashPartitioner<SpillPartitionChannelIds> {
+public:
+    SpillRepartitioner(int partition_count) : Crc32HashPartitioner(partition_count) {}
+
+    void set_level(uint32_t level) { _level = level; }
+    uint32_t level() const { return _level; }
+
+    Status do_partitioning(RuntimeState* state, Block* block, bool eos,
+                           bool* already_sent) const override;
+
+    Status clone(RuntimeState* state, std::unique_ptr<PartitionerBase>& partitioner) override;
+
+    static uint32_t channel_id(uint32_t hash, uint32_t level, size_t partition_count) {
+        uint32_t h = hash ^ (level * 0x9E3779B9U);
+        h ^= h >> 16;
+        h *= 0x85EBCA6BU;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35U;
+        h ^= h >> 16;
+        return static_cast<uint32_t>(h % partition_count);
+    }
+
+private:
+    uint32_t _level = 1;
+};
 #include "common/compile_check_end.h"
 } // namespace doris::vectorized
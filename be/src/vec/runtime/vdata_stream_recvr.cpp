@@ -34,6 +34,7 @@
 #include "runtime/thread_context.h"
 #include "util/defer_op.h"
 #include "util/uid_util.h"
+#include "vec/columns/column_const.h"
 #include "vec/core/block.h"
 #include "vec/core/materialize_block.h"
 #include "vec/core/sort_cursor.h"
@@ -228,8 +229,11 @@ void VDataStreamRecvr::SenderQueue::add_block(Block* block, bool use_move) {
     } else {
         auto rows = block->rows();
         for (int i = 0; i < nblock->columns(); ++i) {
-            nblock->get_by_position(i).column =
-                    nblock->get_by_position(i).column->clone_resized(rows);
+            auto& column = nblock->get_by_position(i).column;
+            // A const column is materialized directly instead of being cloned and then
+            // materialized by `materialize_block_inplace` below, which copies the data twice.
+            column = is_column_const(*column) ? column->convert_to_full_column_if_const()
+                                              : column->clone_resized(rows);
         }
     }
     materialize_block_inplace(*nblock);
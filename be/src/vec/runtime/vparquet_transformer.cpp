@@ -20,6 +20,7 @@
 #include <arrow/io/type_fwd.h>
 #include <arrow/table.h>
 #include <arrow/util/key_value_metadata.h>
+#include <arrow/util/thread_pool.h>
 #include <glog/logging.h>
 #include <parquet/column_writer.h>
 #include <parquet/platform.h>
@@ -48,6 +49,29 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+namespace {
+
+// Shared by all parquet writers, so concurrent exports take a bounded number of cores. The sink
+// threads only wait for the encoding, they never run in the pool, so it can't deadlock.
+arrow::internal::Executor* parquet_encode_executor() {
+    static std::shared_ptr<arrow::internal::ThreadPool> pool =
+            []() -> std::shared_ptr<arrow::internal::ThreadPool> {
+        if (config::parquet_writer_encode_thread_num <= 0) {
+            return nullptr;
+        }
+        auto result = arrow::internal::ThreadPool::Make(config::parquet_writer_encode_thread_num);
+        if (!result.ok()) {
+            LOG(WARNING) << "failed to create the parquet encode thread pool: "
+                         << result.status().ToString();
+            return nullptr;
+        }
+        return *result;
+    }();
+    return pool.get();
+}
+
+} // namespace
+
 ParquetOutputStream::ParquetOutputStream(doris::io::FileWriter* file_writer)
         : _file_writer(file_writer), _cur_pos(0), _written_len(0) {
     set_mode(arrow::io::FileMode::WRITE);
@@ -232,6 +256,11 @@ Status VParquetTransformer::_parse_properties() {
             arrow_builder.enable_deprecated_int96_timestamps();
         }
         arrow_builder.store_schema();
+        if (auto* executor = parquet_encode_executor(); executor != nullptr) {
+            // the columns of a buffered row group are encoded in parallel
+            arrow_builder.set_use_threads(true);
+            arrow_builder.set_executor(executor);
+        }
         _arrow_properties = arrow_builder.build();
     } catch (const parquet::ParquetException& e) {
         return Status::InternalError("parquet writer parse properties error: {}", e.what());
@@ -76,31 +76,145 @@ Status VSortedRunMerger::prepare(const std::vector<BlockSupplier>& input_runs) {
         return Status::Cancelled(e.what());
     }
 
+    _merge_cursors.reserve(_cursors.size());
     for (auto& cursor : _cursors) {
-        if (!cursor->eof()) {
-            _priority_queue.push(MergeSortCursor(cursor));
-        }
+        _merge_cursors.emplace_back(cursor);
     }
+    _build_loser_tree();
 
     return Status::OK();
 }
 
+bool VSortedRunMerger::_row_less(int lhs, size_t lhs_pos, int rhs) const {
+    if (!_active[lhs]) {
+        return false;
+    }
+    if (!_active[rhs]) {
+        return true;
+    }
+    auto res = _merge_cursors[lhs].greater_at(_merge_cursors[rhs], lhs_pos,
+                                              _merge_cursors[rhs]->pos);
+    // Ties are broken by the index of cursors, so that the order is deterministic.
+    return res < 0 || (res == 0 && lhs < rhs);
+}
+
+bool VSortedRunMerger::_less(int lhs, int rhs) const {
+    return _row_less(lhs, _merge_cursors[lhs]->pos, rhs);
+}
+
+void VSortedRunMerger::_build_loser_tree() {
+    const size_t num_cursors = _cursors.size();
+    _active.resize(num_cursors);
+    _num_active = 0;
+    for (size_t i = 0; i < num_cursors; ++i) {
+        _active[i] = !_cursors[i]->eof();
+        _num_active += _active[i];
+    }
+    _loser_tree.assign(num_cursors, -1);
+    if (num_cursors == 0) {
+        return;
+    }
+    // winners[node] is the winner of the subtree of node, the leaves are [num_cursors, 2 * n).
+    std::vector<int> winners(2 * num_cursors);
+    for (size_t i = 0; i < num_cursors; ++i) {
+        winners[num_cursors + i] = static_cast<int>(i);
+    }
+    for (size_t node = num_cursors - 1; node >= 1; --node) {
+        int left = winners[2 * node];
+        int right = winners[2 * node + 1];
+        if (_less(right, left)) {
+            std::swap(left, right);
+        }
+        winners[node] = left;
+        _loser_tree[node] = right;
+    }
+    _loser_tree[0] = winners[1];
+}
+
+void VSortedRunMerger::_replay(int idx) {
+    int current = idx;
+    for (size_t node = (idx + _cursors.size()) / 2; node >= 1; node /= 2) {
+        if (_less(_loser_tree[node], current)) {
+            std::swap(_loser_tree[node], current);
+        }
+    }
+    _loser_tree[0] = current;
+}
+
+void VSortedRunMerger::_deactivate(int idx) {
+    DCHECK(_active[idx]);
+    _active[idx] = false;
+    --_num_active;
+}
+
+int VSortedRunMerger::_runner_up() const {
+    const int winner = _loser_tree[0];
+    int runner_up = -1;
+    for (size_t node = (winner + _cursors.size()) / 2; node >= 1; node /= 2) {
+        int loser = _loser_tree[node];
+        if (_active[loser] && (runner_up == -1 || _less(loser, runner_up))) {
+            runner_up = loser;
+        }
+    }
+    return runner_up;
+}
+
+size_t VSortedRunMerger::_run_length(int winner, int runner_up, size_t max_rows) const {
+    if (runner_up == -1 || max_rows <= 1) {
+        return max_rows;
+    }
+    // The rows of the winner are sorted, gallop to find the first row overtaken by the runner-up.
+    const size_t pos = _merge_cursors[winner]->pos;
+    size_t won = 1; // row `pos` is the winner
+    size_t step = 1;
+    while (won + step - 1 < max_rows && _row_less(winner, pos + won + step - 1, runner_up)) {
+        won += step;
+        step *= 2;
+    }
+    // The first overtaken row is in [won, won + step - 1], or all the rows win.
+    size_t hi = std::min(won + step - 1, max_rows);
+    while (won < hi) {
+        size_t mid = won + (hi - won) / 2;
+        if (_row_less(winner, pos + mid, runner_up)) {
+            won = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return won;
+}
+
+void VSortedRunMerger::_insert_ranges(MutableColumns& merged_columns) {
+    for (size_t i = 0; i < merged_columns.size(); ++i) {
+        for (const auto& range : _ranges) {
+            const auto& column = *range.block->get_by_position(i).column;
+            if (range.length == 1) {
+                merged_columns[i]->insert_from(column, range.start);
+            } else {
+                merged_columns[i]->insert_range_from(column, range.start, range.length);
+            }
+        }
+    }
+    _ranges.clear();
+}
+
 Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     ScopedTimer<MonotonicStopWatch> timer(_get_next_timer);
     // Only have one receive data queue of data, no need to do merge and
     // copy the data of block.
     // return the data in receive data directly
 
-    if (_pending_cursor != nullptr) {
-        MergeSortCursor cursor(_pending_cursor);
+    if (_pending_idx != -1) {
+        auto& cursor = _merge_cursors[_pending_idx];
         {
             ScopedTimer<MonotonicStopWatch> timer1(_get_next_block_timer);
             cursor->process_next();
         }
-        if (!cursor->eof()) {
-            _priority_queue.push(cursor);
+        if (cursor->eof()) {
+            _deactivate(_pending_idx);
         }
-        _pending_cursor = nullptr;
+        _replay(_pending_idx);
+        _pending_idx = -1;
     }
 
     Defer set_limit([&]() {
@@ -111,11 +225,12 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
         }
     });
 
-    if (_priority_queue.empty()) {
+    if (_num_active == 0) {
         *eos = true;
         return Status::OK();
-    } else if (_priority_queue.size() == 1) {
-        auto current = _priority_queue.top();
+    } else if (_num_active == 1) {
+        const int idx = _loser_tree[0];
+        auto& current = _merge_cursors[idx];
         DCHECK(!current->eof());
         DCHECK(current->block_ptr() != nullptr);
         while (_offset != 0) {
@@ -123,11 +238,11 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
             current->next(process_rows);
             _offset -= process_rows;
             if (current->is_last(0)) {
-                _priority_queue.pop();
                 if (current->eof()) {
+                    _deactivate(idx);
                     *eos = true;
                 } else {
-                    _pending_cursor = current.impl;
+                    _pending_idx = idx;
                 }
                 return Status::OK();
             }
@@ -143,16 +258,16 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
         current->block_ptr()->swap(*output_block);
         current->next(current->rows - current->pos);
         if (current->eof()) {
+            _deactivate(idx);
             *eos = true;
         } else {
-            _pending_cursor = current.impl;
+            _pending_idx = idx;
         }
-        _priority_queue.pop();
         return Status::OK();
     } else {
-        size_t num_columns = _priority_queue.top().impl->block->columns();
+        size_t num_columns = _cursors[_loser_tree[0]]->block->columns();
         MutableBlock m_block = VectorizedUtils::build_mutable_mem_reuse_block(
-                output_block, *_priority_queue.top().impl->block);
+                output_block, *_cursors[_loser_tree[0]]->block);
         MutableColumns& merged_columns = m_block.mutable_columns();
 
         if (num_columns != merged_columns.size()) {
@@ -162,43 +277,37 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
                     num_columns, merged_columns.size());
         }
 
-        _indexs.reserve(_batch_size);
-        _block_addrs.reserve(_batch_size);
-
-        auto do_insert = [&]() {
-            _column_addrs.resize(_indexs.size());
-            for (size_t i = 0; i < num_columns; ++i) {
-                for (size_t j = 0; j < _indexs.size(); j++) {
-                    _column_addrs[j] = _block_addrs[j]->get_by_position(i).column.get();
-                }
-                merged_columns[i]->insert_from_multi_column(_column_addrs, _indexs);
-            }
-            _indexs.clear();
-            _block_addrs.clear();
-            _column_addrs.clear();
-        };
-
-        /// Take rows from queue in right order and push to 'merged'.
+        /// Take rows from the tree in right order and push to 'merged'.
         size_t merged_rows = 0;
-        while (merged_rows != _batch_size && !_priority_queue.empty()) {
-            auto current = _priority_queue.top();
-            _priority_queue.pop();
+        while (merged_rows != _batch_size && _num_active > 0) {
+            const int winner = _loser_tree[0];
+            auto& current = _merge_cursors[winner];
 
-            if (_offset > 0) {
-                _offset--;
-            } else {
-                _indexs.emplace_back(current->pos);
-                _block_addrs.emplace_back(current->block_ptr());
-                ++merged_rows;
+            size_t max_rows = std::min(static_cast<size_t>(current->rows - current->pos),
+                                       _batch_size - merged_rows + _offset);
+            size_t run_rows = _run_length(winner, _runner_up(), max_rows);
+            size_t skipped_rows = std::min(_offset, run_rows);
+            _offset -= skipped_rows;
+            if (run_rows > skipped_rows) {
+                _ranges.push_back({current->block_ptr(), current->pos + skipped_rows,
+                                   run_rows - skipped_rows});
+                merged_rows += run_rows - skipped_rows;
             }
 
-            current->next();
-            if (_need_more_data(current)) {
-                do_insert();
-                return Status::OK();
+            current->next(run_rows);
+            if (current->is_last(0)) {
+                // If current stream is exhausted and not eof, we should break this loop and
+                // read more blocks.
+                if (!current->eof()) {
+                    _pending_idx = winner;
+                    _insert_ranges(merged_columns);
+                    return Status::OK();
+                }
+                _deactivate(winner);
             }
+            _replay(winner);
         }
-        do_insert();
+        _insert_ranges(merged_columns);
         output_block->set_columns(std::move(merged_columns));
 
         if (merged_rows == 0) {
@@ -210,16 +319,4 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     return Status::OK();
 }
 
-bool VSortedRunMerger::_need_more_data(MergeSortCursor& current) {
-    if (!current->is_last(0)) {
-        _priority_queue.push(current);
-        return false;
-    } else if (current->eof()) {
-        return false;
-    } else {
-        _pending_cursor = current.impl;
-        return true;
-    }
-}
-
 } // namespace doris::vectorized
\ No newline at end of file
@@ -35,8 +35,10 @@ namespace doris::vectorized {
 
 // VSortedRunMerger is used to merge multiple sorted runs of blocks. A run is a sorted
 // sequence of blocks, which are fetched from a BlockSupplier function object.
-// Merging is implemented using a binary min-heap that maintains the run with the next
-// rows in sorted order at the top of the heap.
+// Merging is implemented using a loser tree (tournament tree) whose root is the run with
+// the next row in sorted order. Replaying a match after the winner advances needs only
+// log(runs) comparisons. The winner keeps outputting rows until it is overtaken by the
+// runner-up, and the rows of such a run are copied as one range.
 //
 // Merged block of rows are retrieved from VSortedRunMerger via calls to get_next().
 class VSortedRunMerger {
@@ -74,11 +76,18 @@ protected:
     size_t _offset = 0;
 
     std::vector<std::shared_ptr<BlockSupplierSortCursorImpl>> _cursors;
-    std::priority_queue<MergeSortCursor> _priority_queue;
+    std::vector<MergeSortCursor> _merge_cursors;
+
+    // `_loser_tree[0]` is the index of the winner cursor, `_loser_tree[i]` (i > 0) is the index
+    // of the loser of the match at node i. The leaf of cursor i is node `i + _cursors.size()`.
+    std::vector<int> _loser_tree;
+    // Whether a cursor still has rows, an inactive cursor loses all the matches.
+    std::vector<uint8_t> _active;
+    size_t _num_active = 0;
 
     /// In pipeline engine, if a cursor needs to read one more block from supplier,
     /// we make it as a pending cursor until the supplier is readable.
-    std::shared_ptr<MergeSortCursorImpl> _pending_cursor = nullptr;
+    int _pending_idx = -1;
 
     // Times calls to get_next().
     RuntimeProfile::Counter* _get_next_timer = nullptr;
@@ -86,14 +95,28 @@ protected:
     // Times calls to get the next batch of rows from the input run.
     RuntimeProfile::Counter* _get_next_block_timer = nullptr;
 
-    std::vector<size_t> _indexs;
-    std::vector<Block*> _block_addrs;
-    std::vector<const IColumn*> _column_addrs;
+    struct RowRange {
+        Block* block;
+        size_t start;
+        size_t length;
+    };
+    std::vector<RowRange> _ranges;
 
 private:
     void init_timers(RuntimeProfile* profile);
-    // If current stream is exhausted and not eof, we should break this loop and read more blocks.
-    bool _need_more_data(MergeSortCursor& current);
+
+    // Whether the current row of cursor `lhs` goes before the current row of cursor `rhs`.
+    bool _less(int lhs, int rhs) const;
+    bool _row_less(int lhs, size_t lhs_pos, int rhs) const;
+    void _build_loser_tree();
+    // Replay the matches from the leaf of `idx` to the root after the cursor moved.
+    void _replay(int idx);
+    void _deactivate(int idx);
+    // The cursor that would win if the winner is removed, -1 if there is none.
+    int _runner_up() const;
+    // The number of rows, at most `max_rows`, the winner outputs before it is overtaken.
+    size_t _run_length(int winner, int runner_up, size_t max_rows) const;
+    void _insert_ranges(MutableColumns& merged_columns);
 };
 
 } // namespace doris::vectorized
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/adaptive_compression_selector.h"
+
+#include <algorithm>
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+// weight of a new sample in the moving average
+static constexpr double SAMPLE_WEIGHT = 0.3;
+
+AdaptiveCompressionSelector::AdaptiveCompressionSelector(
+        segment_v2::CompressionTypePB default_type, int64_t sample_interval)
+        : _default_type(default_type), _sample_interval(std::max<int64_t>(sample_interval, 1)) {
+    // The cost of sending data without compression is known.
+    _stats[0].samples = 1;
+}
+
+int AdaptiveCompressionSelector::_candidate_idx(segment_v2::CompressionTypePB type) {
+    for (size_t i = 0; i < CANDIDATES.size(); ++i) {
+        if (CANDIDATES[i] == type) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+double AdaptiveCompressionSelector::estimated_cost(segment_v2::CompressionTypePB type,
+                                                   double network_bytes_per_ns) const {
+    int idx = _candidate_idx(type);
+    if (idx < 0 || network_bytes_per_ns <= 0) {
+        return 0;
+    }
+    const auto& stats = _stats[idx];
+    return stats.ns_per_byte + stats.ratio / network_bytes_per_ns;
+}
+
+segment_v2::CompressionTypePB AdaptiveCompressionSelector::next(double network_bytes_per_ns) {
+    if (network_bytes_per_ns <= 0) {
+        return _default_type;
+    }
+    ++_num_blocks;
+    bool need_sample = _num_blocks % _sample_interval == 0;
+    for (size_t i = 1; i < CANDIDATES.size(); ++i) {
+        need_sample |= _stats[i].samples == 0;
+    }
+    if (need_sample) {
+        auto type = CANDIDATES[_next_sample_idx];
+        _next_sample_idx = _next_sample_idx + 1 < CANDIDATES.size() ? _next_sample_idx + 1 : 1;
+        return type;
+    }
+
+    auto best = CANDIDATES[0];
+    double best_cost = estimated_cost(best, network_bytes_per_ns);
+    for (size_t i = 1; i < CANDIDATES.size(); ++i) {
+        double cost = estimated_cost(CANDIDATES[i], network_bytes_per_ns);
+        if (cost < best_cost) {
+            best = CANDIDATES[i];
+            best_cost = cost;
+        }
+    }
+    return best;
+}
+
+void AdaptiveCompressionSelector::update(segment_v2::CompressionTypePB type,
+                                         size_t uncompressed_bytes, size_t compressed_bytes,
+                                         int64_t compress_ns) {
+    int idx = _candidate_idx(type);
+    if (idx <= 0 || uncompressed_bytes == 0) {
+        return;
+    }
+    auto& stats = _stats[idx];
+    double ratio = static_cast<double>(compressed_bytes) / static_cast<double>(uncompressed_bytes);
+    double ns_per_byte =
+            static_cast<double>(compress_ns) / static_cast<double>(uncompressed_bytes);
+    if (stats.samples == 0) {
+        stats.ratio = ratio;
+        stats.ns_per_byte = ns_per_byte;
+    } else {
+        stats.ratio = SAMPLE_WEIGHT * ratio + (1 - SAMPLE_WEIGHT) * stats.ratio;
+        stats.ns_per_byte = SAMPLE_WEIGHT * ns_per_byte + (1 - SAMPLE_WEIGHT) * stats.ns_per_byte;
+    }
+    ++stats.samples;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+// Chooses the compression codec of the blocks sent by an exchange sink.
+//
+// The compression ratio and the cpu cost of LZ4 and ZSTD are sampled on real blocks, and the
+// codec with the minimal estimated `compress time + transfer time` is used for the following
+// blocks, given the measured network throughput. The samples are refreshed periodically, so the
+// choice follows the data. Until the network throughput is known, the default codec is used.
+class AdaptiveCompressionSelector {
+public:
+    AdaptiveCompressionSelector(segment_v2::CompressionTypePB default_type,
+                                int64_t sample_interval);
+
+    // `network_bytes_per_ns` is the measured throughput of the link, <= 0 if unknown.
+    segment_v2::CompressionTypePB next(double network_bytes_per_ns);
+
+    // Report the result of compressing a block with `type`.
+    void update(segment_v2::CompressionTypePB type, size_t uncompressed_bytes,
+                size_t compressed_bytes, int64_t compress_ns);
+
+    // The estimated cost in ns per uncompressed byte to send data with `type`.
+    double estimated_cost(segment_v2::CompressionTypePB type, double network_bytes_per_ns) const;
+
+private:
+    struct CodecStats {
+        // compressed bytes / uncompressed bytes
+        double ratio = 1;
+        double ns_per_byte = 0;
+        int64_t samples = 0;
+    };
+    static constexpr std::array<segment_v2::CompressionTypePB, 3> CANDIDATES = {
+            segment_v2::NO_COMPRESSION, segment_v2::LZ4, segment_v2::ZSTD};
+    static int _candidate_idx(segment_v2::CompressionTypePB type);
+
+    const segment_v2::CompressionTypePB _default_type;
+    const int64_t _sample_interval;
+    std::array<CodecStats, CANDIDATES.size()> _stats;
+    int64_t _num_blocks = 0;
+    // The next candidate to sample, NO_COMPRESSION is never sampled because its cost is known.
+    size_t _next_sample_idx = 1;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
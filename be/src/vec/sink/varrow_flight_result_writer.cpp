@@ -108,12 +108,7 @@ Status ArrowFlightResultBlockBuffer::get_arrow_batch(std::shared_ptr<vectorized:
 
     if (!_result_batch_queue.empty()) {
         *result = std::move(_result_batch_queue.front());
-        _result_batch_queue.pop_front();
-
-        for (auto it : _instance_rows_in_queue.front()) {
-            _instance_rows[it.first] -= it.second;
-        }
-        _instance_rows_in_queue.pop_front();
+        _pop_front_batch();
         _packet_num++;
         return Status::OK();
     }
@@ -157,6 +152,22 @@ void VArrowFlightResultWriter::_init_profile() {
     _bytes_sent_counter = ADD_COUNTER(_parent_profile, "BytesSent", TUnit::BYTES);
 }
 
+void VArrowFlightResultWriter::_detach_output_columns(Block& input_block, Block& block) {
+    // The output exprs mostly return the slot columns of the input block as they are, replace them
+    // in the input block by empty ones, as the pipeline clears the input block in place after the
+    // sink.
+    for (size_t i = 0; i < block.columns(); ++i) {
+        auto& column = block.get_by_position(i).column;
+        column = column->convert_to_full_column_if_const();
+        for (size_t j = 0; j < input_block.columns(); ++j) {
+            auto& input_column = input_block.get_by_position(j).column;
+            if (input_column.get() == column.get()) {
+                input_column = input_column->clone_empty();
+            }
+        }
+    }
+}
+
 Status VArrowFlightResultWriter::write(RuntimeState* state, Block& input_block) {
     SCOPED_TIMER(_append_row_batch_timer);
     Status status = Status::OK();
@@ -170,13 +181,23 @@ Status VArrowFlightResultWriter::write(RuntimeState* state, Block& input_block)
     RETURN_IF_ERROR(VExprContext::get_output_block_after_execute_exprs(_output_vexpr_ctxs,
                                                                        input_block, &block));
 
+    _detach_output_columns(input_block, block);
+    auto* query_mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker();
     {
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_sinker->mem_tracker());
-        std::unique_ptr<vectorized::MutableBlock> mutable_block =
-                vectorized::MutableBlock::create_unique(block.clone_empty());
-        RETURN_IF_ERROR(mutable_block->merge_ignore_overflow(std::move(block)));
+        // The columns owned by nobody else are taken over by the buffer with their memory, the
+        // others are copied into it.
+        for (size_t i = 0; i < block.columns(); ++i) {
+            auto& column = block.get_by_position(i).column;
+            if (column->use_count() == 1) {
+                query_mem_tracker->transfer_to(column->allocated_bytes(),
+                                               _sinker->mem_tracker().get());
+            } else {
+                column = column->clone_resized(column->size());
+            }
+        }
         std::shared_ptr<vectorized::Block> output_block = vectorized::Block::create_shared();
-        output_block->swap(mutable_block->to_block());
+        output_block->swap(block);
 
         auto num_rows = output_block->rows();
         // arrow::RecordBatch without `nbytes()` in C++
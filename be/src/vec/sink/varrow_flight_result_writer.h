@@ -98,6 +98,9 @@ public:
 
 private:
     void _init_profile();
+    // Detach the columns of the output block from the input block, so that the buffer can own
+    // them without a deep copy.
+    void _detach_output_columns(Block& input_block, Block& block);
 
     std::shared_ptr<ArrowFlightResultBlockBuffer> _sinker = nullptr;
 
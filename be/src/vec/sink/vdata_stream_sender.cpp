@@ -330,13 +330,31 @@ Status BlockSerializer::_serialize_block(PBlock* dest, size_t num_receivers) {
     return Status::OK();
 }
 
+segment_v2::CompressionTypePB BlockSerializer::_next_compression_type() {
+    if (!config::enable_exchange_adaptive_compression || _parent->_sink_buffer == nullptr) {
+        return _parent->compression_type();
+    }
+    if (_compression_selector == nullptr) {
+        _compression_selector = std::make_unique<AdaptiveCompressionSelector>(
+                _parent->compression_type(),
+                config::exchange_adaptive_compression_sample_interval);
+    }
+    return _compression_selector->next(_parent->_sink_buffer->network_bytes_per_ns());
+}
+
 Status BlockSerializer::serialize_block(const Block* src, PBlock* dest, size_t num_receivers) {
     SCOPED_TIMER(_parent->_serialize_batch_timer);
     dest->Clear();
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
+    const auto compression_type = _next_compression_type();
+    const int64_t prev_compress_time = src->get_compress_time();
     RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest, &uncompressed_bytes,
-                                   &compressed_bytes, _parent->compression_type(),
+                                   &compressed_bytes, compression_type,
                                    _parent->transfer_large_data_by_brpc()));
+    if (_compression_selector) {
+        _compression_selector->update(compression_type, uncompressed_bytes, compressed_bytes,
+                                      src->get_compress_time() - prev_compress_time);
+    }
     COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
@@ -49,6 +49,7 @@
 #include "vec/exprs/vexpr_context.h"
 #include "vec/runtime/partitioner.h"
 #include "vec/runtime/vdata_stream_recvr.h"
+#include "vec/sink/adaptive_compression_selector.h"
 #include "vec/sink/vrow_distribution.h"
 #include "vec/sink/vtablet_finder.h"
 
@@ -97,9 +98,12 @@ public:
 
 private:
     Status _serialize_block(PBlock* dest, size_t num_receivers = 1);
+    segment_v2::CompressionTypePB _next_compression_type();
 
     pipeline::ExchangeSinkLocalState* _parent;
     std::unique_ptr<MutableBlock> _mutable_block;
+    // Only created if `enable_exchange_adaptive_compression` is true.
+    std::unique_ptr<AdaptiveCompressionSelector> _compression_selector;
 
     bool _is_local;
     const int _batch_size;
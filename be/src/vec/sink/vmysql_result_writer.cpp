@@ -233,18 +233,47 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
             }
         }
 
-        for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
-            for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
-                RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
-                        *(arguments[col_idx].column), row_buffer, row_idx,
-                        arguments[col_idx].is_const, _options));
+        if constexpr (!is_binary_format) {
+            // The rows of the text protocol are just the cells one after another, serialize the
+            // block column by column and interleave the cells into the rows afterwards.
+            std::vector<int64_t> cell_ends;
+            cell_ends.reserve(num_cols * num_rows);
+            for (const auto& argument : arguments) {
+                RETURN_IF_ERROR(argument.serde->write_column_to_mysql_cells(
+                        *argument.column, row_buffer, 0, num_rows, argument.is_const, _options,
+                        cell_ends));
             }
+            DCHECK_EQ(cell_ends.size(), num_cols * num_rows);
+            auto cell_begin = [&](size_t cell) { return cell == 0 ? 0 : cell_ends[cell - 1]; };
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                int64_t row_bytes = 0;
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    size_t cell = col_idx * num_rows + row_idx;
+                    row_bytes += cell_ends[cell] - cell_begin(cell);
+                }
+                auto& row = result->result_batch.rows[row_idx];
+                row.resize(row_bytes);
+                char* dst = row.data();
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    size_t cell = col_idx * num_rows + row_idx;
+                    int64_t begin = cell_begin(cell);
+                    memcpy(dst, row_buffer.buf() + begin, cell_ends[cell] - begin);
+                    dst += cell_ends[cell] - begin;
+                }
+                bytes_sent += row_bytes;
+            }
+        } else {
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
+                            *(arguments[col_idx].column), row_buffer, row_idx,
+                            arguments[col_idx].is_const, _options));
+                }
 
-            // copy MysqlRowBuffer to Thrift
-            result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
-            bytes_sent += row_buffer.length();
-            row_buffer.reset();
-            if constexpr (is_binary_format) {
+                // copy MysqlRowBuffer to Thrift
+                result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
+                bytes_sent += row_buffer.length();
+                row_buffer.reset();
                 row_buffer.start_binary_row(_output_vexpr_ctxs.size());
             }
         }
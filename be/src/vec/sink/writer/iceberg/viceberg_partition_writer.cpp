@@ -19,6 +19,7 @@
 
 #include "io/file_factory.h"
 #include "runtime/runtime_state.h"
+#include "util/time.h"
 #include "vec/columns/column_map.h"
 #include "vec/core/materialize_block.h"
 #include "vec/exec/format/table/iceberg/schema.h"
@@ -130,6 +131,13 @@ Status VIcebergPartitionWriter::close(const Status& status) {
 Status VIcebergPartitionWriter::write(vectorized::Block& block) {
     RETURN_IF_ERROR(_file_format_transformer->write(block));
     _row_count += block.rows();
+    int64_t written_len = _file_format_transformer->written_len();
+    if (written_len != _flushed_len) {
+        _flushed_len = written_len;
+        _buffered_bytes = 0;
+    }
+    _buffered_bytes += block.bytes();
+    _last_write_time = MonotonicNanos();
     return Status::OK();
 }
 
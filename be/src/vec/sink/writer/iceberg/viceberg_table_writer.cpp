@@ -27,6 +27,7 @@
 #include "vec/exprs/vexpr_context.h"
 #include "vec/sink/writer/iceberg/partition_transformers.h"
 #include "vec/sink/writer/iceberg/viceberg_partition_writer.h"
+#include "vec/sink/writer/partition_writer_eviction.h"
 #include "vec/sink/writer/vhive_utils.h"
 
 namespace doris {
@@ -59,6 +60,7 @@ Status VIcebergTableWriter::open(RuntimeState* state, RuntimeProfile* profile) {
     _open_timer = ADD_TIMER(_profile, "OpenTime");
     _close_timer = ADD_TIMER(_profile, "CloseTime");
     _write_file_counter = ADD_COUNTER(_profile, "WriteFileCount", TUnit::UNIT);
+    _evicted_writer_counter = ADD_COUNTER(_profile, "EvictedPartitionWriterCount", TUnit::UNIT);
 
     SCOPED_TIMER(_open_timer);
     try {
@@ -246,7 +248,12 @@ Status VIcebergTableWriter::write(RuntimeState* state, vectorized::Block& block)
         RETURN_IF_ERROR(_filter_block(output_block, &it->second, &filtered_block));
         RETURN_IF_ERROR(it->first->write(filtered_block));
     }
-    return Status::OK();
+    writer_positions.clear();
+    SCOPED_RAW_TIMER(&_close_ns);
+    return evict_partition_writers(
+            &_partitions_to_writers,
+            config::table_sink_partition_write_max_buffered_bytes_per_writer,
+            &_evicted_writer_count);
 }
 
 Status VIcebergTableWriter::_filter_block(doris::vectorized::Block& block,
@@ -301,6 +308,7 @@ Status VIcebergTableWriter::close(Status status) {
         COUNTER_SET(_partition_writers_count, partitions_to_writers_size);
         COUNTER_SET(_close_timer, _close_ns);
         COUNTER_SET(_write_file_counter, _write_file_count);
+        COUNTER_SET(_evicted_writer_counter, _evicted_writer_count);
     }
     return result_status;
 }
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+
+namespace doris::vectorized {
+
+// Close the least recently written partition writers once the bytes buffered by all of them
+// exceed max_buffered_bytes, until they fall to the half of it, so that writing to a lot of
+// partitions holds a bounded memory. A partition written again later goes to a new file.
+// The writers without buffered bytes are kept, closing them doesn't release any memory but
+// leaves a small file. *evicted_writers is increased by the number of closed writers.
+template <typename PartitionWriter>
+Status evict_partition_writers(
+        std::unordered_map<std::string, std::shared_ptr<PartitionWriter>>* partitions_to_writers,
+        int64_t max_buffered_bytes, int64_t* evicted_writers) {
+    if (max_buffered_bytes <= 0 || partitions_to_writers->size() <= 1) {
+        return Status::OK();
+    }
+    int64_t buffered_bytes = 0;
+    for (const auto& [_, writer] : *partitions_to_writers) {
+        buffered_bytes += writer->buffered_bytes();
+    }
+    if (buffered_bytes <= max_buffered_bytes) {
+        return Status::OK();
+    }
+
+    // (last write time, partition name) of the writers to evict, the least recently written first
+    std::vector<std::pair<int64_t, std::string>> candidates;
+    for (const auto& [partition_name, writer] : *partitions_to_writers) {
+        if (writer->buffered_bytes() > 0) {
+            candidates.emplace_back(writer->last_write_time(), partition_name);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    for (const auto& [_, partition_name] : candidates) {
+        if (buffered_bytes <= max_buffered_bytes / 2) {
+            break;
+        }
+        auto writer_iter = partitions_to_writers->find(partition_name);
+        buffered_bytes -= writer_iter->second->buffered_bytes();
+        Status st = writer_iter->second->close(Status::OK());
+        partitions_to_writers->erase(writer_iter);
+        RETURN_IF_ERROR(st);
+        ++*evicted_writers;
+    }
+    return Status::OK();
+}
+
+} // namespace doris::vectorized
@@ -22,6 +22,7 @@
 #include "io/file_factory.h"
 #include "io/fs/s3_file_writer.h"
 #include "runtime/runtime_state.h"
+#include "util/time.h"
 #include "vec/columns/column_map.h"
 #include "vec/core/materialize_block.h"
 #include "vec/runtime/vcsv_transformer.h"
@@ -144,6 +145,13 @@ Status VHivePartitionWriter::close(const Status& status) {
 Status VHivePartitionWriter::write(vectorized::Block& block) {
     RETURN_IF_ERROR(_file_format_transformer->write(block));
     _row_count += block.rows();
+    int64_t written_len = _file_format_transformer->written_len();
+    if (written_len != _flushed_len) {
+        _flushed_len = written_len;
+        _buffered_bytes = 0;
+    }
+    _buffered_bytes += block.bytes();
+    _last_write_time = MonotonicNanos();
     return Status::OK();
 }
 
@@ -73,6 +73,12 @@ public:
 
     inline size_t written_len() { return _file_format_transformer->written_len(); }
 
+    // The bytes written since the file grew last time, which are still buffered by the
+    // transformer, like the open row group of parquet or the stripe of orc.
+    inline int64_t buffered_bytes() const { return _buffered_bytes; }
+
+    inline int64_t last_write_time() const { return _last_write_time; }
+
 private:
     std::string _get_target_file_name();
 
@@ -89,6 +95,9 @@ private:
     TUpdateMode::type _update_mode;
 
     size_t _row_count = 0;
+    int64_t _flushed_len = 0;
+    int64_t _buffered_bytes = 0;
+    int64_t _last_write_time = 0;
 
     const VExprContextSPtrs& _write_output_expr_ctxs;
 
@@ -23,6 +23,7 @@
 #include "vec/core/materialize_block.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/sink/writer/partition_writer_eviction.h"
 #include "vec/sink/writer/vhive_partition_writer.h"
 #include "vec/sink/writer/vhive_utils.h"
 
@@ -57,6 +58,7 @@ Status VHiveTableWriter::open(RuntimeState* state, RuntimeProfile* profile) {
     _open_timer = ADD_TIMER(_profile, "OpenTime");
     _close_timer = ADD_TIMER(_profile, "CloseTime");
     _write_file_counter = ADD_COUNTER(_profile, "WriteFileCount", TUnit::UNIT);
+    _evicted_writer_counter = ADD_COUNTER(_profile, "EvictedPartitionWriterCount", TUnit::UNIT);
 
     SCOPED_TIMER(_open_timer);
     for (int i = 0; i < _t_sink.hive_table_sink.columns.size(); ++i) {
@@ -215,7 +217,12 @@ Status VHiveTableWriter::write(RuntimeState* state, vectorized::Block& block) {
         RETURN_IF_ERROR(_filter_block(output_block, &it->second, &filtered_block));
         RETURN_IF_ERROR(it->first->write(filtered_block));
     }
-    return Status::OK();
+    writer_positions.clear();
+    SCOPED_RAW_TIMER(&_close_ns);
+    return evict_partition_writers(
+            &_partitions_to_writers,
+            config::table_sink_partition_write_max_buffered_bytes_per_writer,
+            &_evicted_writer_count);
 }
 
 Status VHiveTableWriter::_filter_block(doris::vectorized::Block& block,
@@ -270,6 +277,7 @@ Status VHiveTableWriter::close(Status status) {
         COUNTER_SET(_partition_writers_count, partitions_to_writers_size);
         COUNTER_SET(_close_timer, _close_ns);
         COUNTER_SET(_write_file_counter, _write_file_count);
+        COUNTER_SET(_evicted_writer_counter, _evicted_writer_count);
     }
     return result_status;
 }
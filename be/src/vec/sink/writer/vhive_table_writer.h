@@ -84,6 +84,7 @@ private:
     int64_t _partition_writers_write_ns = 0;
     int64_t _close_ns = 0;
     int64_t _write_file_count = 0;
+    int64_t _evicted_writer_count = 0;
 
     RuntimeProfile::Counter* _written_rows_counter = nullptr;
     RuntimeProfile::Counter* _send_data_timer = nullptr;
@@ -93,6 +94,7 @@ private:
     RuntimeProfile::Counter* _open_timer = nullptr;
     RuntimeProfile::Counter* _close_timer = nullptr;
     RuntimeProfile::Counter* _write_file_counter = nullptr;
+    RuntimeProfile::Counter* _evicted_writer_counter = nullptr;
 };
 } // namespace vectorized
 } // namespace doris
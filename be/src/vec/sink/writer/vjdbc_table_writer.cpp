@@ -20,8 +20,12 @@
 #include <gen_cpp/DataSinks_types.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <sstream>
 
+#include "common/config.h"
+#include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "util/binary_cast.hpp"
 #include "vec/core/block.h"
 #include "vec/exprs/vexpr.h"
@@ -63,21 +67,121 @@ VJdbcTableWriter::VJdbcTableWriter(const TDataSink& t_sink,
         : AsyncResultWriter(output_expr_ctxs, dep, fin_dep),
           JdbcConnector(create_connect_param(t_sink)) {}
 
+Status VJdbcTableWriter::open(RuntimeState* state, RuntimeProfile* profile) {
+    RETURN_IF_ERROR(JdbcConnector::open(state, false));
+    RETURN_IF_ERROR(init_to_write(profile));
+
+    // the rows of a transaction must be written with the connection of the transaction
+    int num_connections = _conn_param.use_transaction
+                                  ? 1
+                                  : std::max(config::jdbc_sink_parallel_connections, 1);
+    if (num_connections == 1) {
+        return Status::OK();
+    }
+    for (int i = 1; i < num_connections; ++i) {
+        auto connector = std::make_unique<JdbcConnector>(_conn_param);
+        RETURN_IF_ERROR(connector->open(state, false));
+        RETURN_IF_ERROR(connector->init_to_write(profile));
+        _parallel_connectors.push_back(std::move(connector));
+    }
+    for (auto& connector : _parallel_connectors) {
+        _idle_connectors.push_back(connector.get());
+    }
+    return ThreadPoolBuilder("JdbcTableWriter")
+            .set_min_threads(0)
+            .set_max_threads(num_connections - 1)
+            .build(&_write_pool);
+}
+
 Status VJdbcTableWriter::write(RuntimeState* state, vectorized::Block& block) {
     Block output_block;
     RETURN_IF_ERROR(_projection_block(block, &output_block));
-    auto num_rows = output_block.rows();
-
-    uint32_t start_send_row = 0;
-    uint32_t num_row_sent = 0;
-    while (start_send_row < num_rows) {
-        RETURN_IF_ERROR(append(&output_block, _vec_output_expr_ctxs, start_send_row, &num_row_sent,
-                               _conn_param.table_type));
-        start_send_row += num_row_sent;
-        num_row_sent = 0;
+    if (output_block.rows() == 0) {
+        return Status::OK();
+    }
+    if (_pending_batch == nullptr) {
+        _pending_batch = std::make_unique<MutableBlock>(output_block.clone_empty());
+    }
+    RETURN_IF_ERROR(_pending_batch->merge(std::move(output_block)));
+    if (_pending_batch->rows() < static_cast<size_t>(config::jdbc_sink_batch_rows)) {
+        return Status::OK();
+    }
+    auto batch = std::make_shared<Block>(_pending_batch->to_block());
+    _pending_batch.reset();
+    return _write_batch(state, std::move(batch));
+}
+
+Status VJdbcTableWriter::_write_batch(RuntimeState* state, std::shared_ptr<Block> batch) {
+    auto write = [this](JdbcConnector* connector, Block* block) {
+        auto num_rows = block->rows();
+        uint32_t start_send_row = 0;
+        uint32_t num_row_sent = 0;
+        while (start_send_row < num_rows) {
+            RETURN_IF_ERROR(connector->append(block, _vec_output_expr_ctxs, start_send_row,
+                                              &num_row_sent, _conn_param.table_type));
+            start_send_row += num_row_sent;
+            num_row_sent = 0;
+        }
+        return Status::OK();
+    };
+    if (_write_pool == nullptr) {
+        return write(this, batch.get());
     }
 
-    return Status::OK();
+    JdbcConnector* connector = nullptr;
+    {
+        std::unique_lock l(_write_lock);
+        _write_cv.wait(l, [this]() { return !_idle_connectors.empty() || !_write_status.ok(); });
+        RETURN_IF_ERROR(_write_status);
+        connector = _idle_connectors.back();
+        _idle_connectors.pop_back();
+        ++_num_batches_in_flight;
+    }
+    auto st = _write_pool->submit_func([this, state, connector, batch, write]() {
+        SCOPED_ATTACH_TASK(state);
+        auto st = write(connector, batch.get());
+        std::lock_guard l(_write_lock);
+        if (_write_status.ok() && !st.ok()) {
+            _write_status = st;
+        }
+        _idle_connectors.push_back(connector);
+        --_num_batches_in_flight;
+        _write_cv.notify_all();
+    });
+    if (!st.ok()) {
+        std::lock_guard l(_write_lock);
+        _idle_connectors.push_back(connector);
+        --_num_batches_in_flight;
+    }
+    return st;
+}
+
+Status VJdbcTableWriter::_wait_batches_in_flight() {
+    std::unique_lock l(_write_lock);
+    _write_cv.wait(l, [this]() { return _num_batches_in_flight == 0; });
+    return _write_status;
+}
+
+Status VJdbcTableWriter::finish(RuntimeState* state) {
+    if (_pending_batch != nullptr) {
+        auto batch = std::make_shared<Block>(_pending_batch->to_block());
+        _pending_batch.reset();
+        RETURN_IF_ERROR(_write_batch(state, std::move(batch)));
+    }
+    RETURN_IF_ERROR(_wait_batches_in_flight());
+    return JdbcConnector::finish_trans();
+}
+
+Status VJdbcTableWriter::close(Status s) {
+    // the batches in flight use the connectors
+    static_cast<void>(_wait_batches_in_flight());
+    if (_write_pool != nullptr) {
+        _write_pool->shutdown();
+    }
+    for (auto& connector : _parallel_connectors) {
+        static_cast<void>(connector->close(s));
+    }
+    return JdbcConnector::close(s);
 }
 
 } // namespace vectorized
@@ -20,10 +20,14 @@
 #include <fmt/format.h>
 #include <stddef.h>
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "common/status.h"
+#include "util/threadpool.h"
 #include "vec/exec/vjdbc_connector.h"
 #include "vec/sink/writer/async_result_writer.h"
 
@@ -41,19 +45,37 @@ public:
                      std::shared_ptr<pipeline::Dependency> fin_dep);
 
     // connect to jdbc server
-    Status open(RuntimeState* state, RuntimeProfile* profile) override {
-        RETURN_IF_ERROR(JdbcConnector::open(state, false));
-        return init_to_write(profile);
-    }
+    Status open(RuntimeState* state, RuntimeProfile* profile) override;
 
     Status write(RuntimeState* state, vectorized::Block& block) override;
 
-    Status finish(RuntimeState* state) override { return JdbcConnector::finish_trans(); }
+    Status finish(RuntimeState* state) override;
 
-    Status close(Status s) override { return JdbcConnector::close(s); }
+    Status close(Status s) override;
 
 private:
+    // Writes the batch with this connector, or with an idle one of the parallel connectors, in
+    // which case it waits for an idle connector and returns before the batch is written.
+    Status _write_batch(RuntimeState* state, std::shared_ptr<Block> batch);
+
+    // waits for the batches in flight of the parallel connectors
+    Status _wait_batches_in_flight();
+
     JdbcConnectorParam _param;
+
+    // the rows of the small blocks which are written as one batch
+    std::unique_ptr<MutableBlock> _pending_batch;
+
+    // Connectors of the parallel connections besides this one. Each of them writes one batch at
+    // a time in _write_pool.
+    std::vector<std::unique_ptr<JdbcConnector>> _parallel_connectors;
+    std::unique_ptr<ThreadPool> _write_pool;
+    std::mutex _write_lock;
+    std::condition_variable _write_cv;
+    std::vector<JdbcConnector*> _idle_connectors;
+    size_t _num_batches_in_flight = 0;
+    // the first error of the batches written in _write_pool
+    Status _write_status;
 };
 } // namespace vectorized
 } // namespace doris
\ No newline at end of file
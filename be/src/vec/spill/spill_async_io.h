@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <utility>
+
+#include "common/status.h"
+#include "runtime/exec_env.h"
+#include "runtime/thread_context.h"
+#include "runtime/workload_management/resource_context.h"
+#include "util/threadpool.h"
+#include "vec/spill/spill_stream_manager.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+// A spill file read or write running on the spill io thread pool while its owner goes on
+// serializing or deserializing the next block.
+// The pool thread and wait() both try to claim the io, the first one runs it. So waiting never
+// depends on a free pool thread, the spill tasks are running on the same pool.
+class SpillAsyncIO {
+public:
+    // The io must not outlive the buffers `func` touches, so the owner calls wait() before
+    // releasing them.
+    static std::shared_ptr<SpillAsyncIO> submit(std::function<Status()> func,
+                                                std::shared_ptr<ResourceContext> resource_ctx) {
+        auto io = std::make_shared<SpillAsyncIO>(std::move(func));
+        auto* pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+        // when submitting fails, wait() runs it in the calling thread
+        static_cast<void>(pool->submit_func([io, resource_ctx = std::move(resource_ctx)]() {
+            if (io->_claimed.exchange(true)) {
+                return;
+            }
+            if (resource_ctx) {
+                SCOPED_ATTACH_TASK(resource_ctx);
+                io->_promise.set_value(io->_func());
+            } else {
+                SCOPED_INIT_THREAD_CONTEXT();
+                io->_promise.set_value(io->_func());
+            }
+        }));
+        return io;
+    }
+
+    explicit SpillAsyncIO(std::function<Status()> func)
+            : _func(std::move(func)), _future(_promise.get_future()) {}
+
+    Status wait() {
+        if (!_claimed.exchange(true)) {
+            return _func();
+        }
+        return _future.get();
+    }
+
+private:
+    std::function<Status()> _func;
+    std::atomic_bool _claimed = false;
+    std::promise<Status> _promise;
+    std::future<Status> _future;
+};
+using SpillAsyncIOSPtr = std::shared_ptr<SpillAsyncIO>;
+
+} // namespace doris::vectorized
+#include "common/compile_check_end.h"
@@ -22,6 +22,7 @@
 #include <algorithm>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "io/file_factory.h"
 #include "io/fs/file_reader.h"
@@ -29,6 +30,7 @@
 #include "runtime/exec_env.h"
 #include "util/slice.h"
 #include "vec/core/block.h"
+#include "vec/spill/spill_async_io.h"
 #include "vec/spill/spill_stream_manager.h"
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -46,7 +48,7 @@ Status SpillReader::open() {
 
     COUNTER_UPDATE(_read_file_count, 1);
 
-    RETURN_IF_ERROR(io::global_local_filesystem()->open_file(file_path_, &file_reader_));
+    RETURN_IF_ERROR(fs_->open_file(file_path_, &file_reader_));
 
     size_t file_size = file_reader_->size();
     DCHECK(file_size >= 16); // max_sub_block_size, block count
@@ -75,6 +77,10 @@ Status SpillReader::open() {
 
     size_t buff_size = std::max(block_count_ * sizeof(size_t), max_sub_block_size_);
     read_buff_.reserve(buff_size);
+    read_ahead_enabled_ = config::enable_spill_async_io;
+    if (read_ahead_enabled_) {
+        read_ahead_buff_.reserve(max_sub_block_size_);
+    }
 
     // read block start offsets
     size_t read_offset = file_size - (block_count_ + 2) * sizeof(size_t);
@@ -121,14 +127,18 @@ Status SpillReader::read(Block* block, bool* eos) {
         return Status::OK();
     }
 
-    Slice result(read_buff_.data(), bytes_to_read);
     size_t bytes_read = 0;
-    {
-        SCOPED_TIMER(_read_file_timer);
-        RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
-                                              &bytes_read));
+    if (read_ahead_ && read_ahead_block_index_ == read_block_index_) {
+        RETURN_IF_ERROR(_wait_read_ahead(&bytes_read));
+        read_buff_.swap(read_ahead_buff_);
+    } else {
+        // seek() moved away from the block read ahead
+        RETURN_IF_ERROR(_wait_read_ahead(&bytes_read));
+        RETURN_IF_ERROR(_read_block(read_block_index_, read_buff_.data(), &bytes_read));
     }
-    DCHECK(bytes_read == bytes_to_read);
+    Slice result(read_buff_.data(), bytes_read);
+    // read_ahead_buff_ is free again, overlap reading the next block with deserializing this one
+    _read_ahead(read_block_index_ + 1);
 
     if (bytes_read > 0) {
         COUNTER_UPDATE(_read_file_size, bytes_read);
@@ -155,10 +165,49 @@ Status SpillReader::read(Block* block, bool* eos) {
     return Status::OK();
 }
 
+Status SpillReader::_read_block(size_t block_index, char* buff, size_t* bytes_read) {
+    size_t bytes_to_read =
+            block_start_offsets_[block_index + 1] - block_start_offsets_[block_index];
+    Slice result(buff, bytes_to_read);
+    {
+        SCOPED_TIMER(_read_file_timer);
+        RETURN_IF_ERROR(
+                file_reader_->read_at(block_start_offsets_[block_index], result, bytes_read));
+    }
+    DCHECK(*bytes_read == bytes_to_read);
+    return Status::OK();
+}
+
+void SpillReader::_read_ahead(size_t block_index) {
+    if (!read_ahead_enabled_ || block_index >= block_count_ ||
+        block_start_offsets_[block_index + 1] == block_start_offsets_[block_index]) {
+        return;
+    }
+    read_ahead_block_index_ = block_index;
+    read_ahead_ = SpillAsyncIO::submit(
+            [this, block_index]() {
+                return _read_block(block_index, read_ahead_buff_.data(), &read_ahead_bytes_);
+            },
+            _resource_ctx);
+}
+
+Status SpillReader::_wait_read_ahead(size_t* bytes_read) {
+    if (!read_ahead_) {
+        return Status::OK();
+    }
+    auto status = read_ahead_->wait();
+    read_ahead_.reset();
+    *bytes_read = read_ahead_bytes_;
+    return status;
+}
+
 Status SpillReader::close() {
     if (!file_reader_) {
         return Status::OK();
     }
+    // the read ahead uses read_ahead_buff_ and file_reader_
+    size_t bytes_read = 0;
+    static_cast<void>(_wait_read_ahead(&bytes_read));
     (void)file_reader_->close();
     file_reader_.reset();
     return Status::OK();
@@ -25,6 +25,7 @@
 
 #include "common/status.h"
 #include "io/fs/file_reader_writer_fwd.h"
+#include "io/fs/file_system.h"
 #include "runtime/workload_management/resource_context.h"
 #include "util/runtime_profile.h"
 #include "vec/common/pod_array.h"
@@ -33,11 +34,13 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 class Block;
+class SpillAsyncIO;
 class SpillReader {
 public:
     SpillReader(std::shared_ptr<ResourceContext> resource_context, int64_t stream_id,
-                std::string file_path)
+                io::FileSystemSPtr fs, std::string file_path)
             : stream_id_(stream_id),
+              fs_(std::move(fs)),
               file_path_(std::move(file_path)),
               _resource_ctx(std::move(resource_context)) {}
 
@@ -68,7 +71,17 @@ public:
     }
 
 private:
+    Status _read_block(size_t block_index, char* buff, size_t* bytes_read);
+
+    // submits the read of the block after the one being read, if there is one
+    void _read_ahead(size_t block_index);
+
+    // waits for the read ahead and returns the number of bytes it read into read_ahead_buff_
+    Status _wait_read_ahead(size_t* bytes_read);
+
     int64_t stream_id_;
+    // the local file system, or the remote storage the local spill disks overflow to
+    io::FileSystemSPtr fs_;
     std::string file_path_;
     io::FileReaderSPtr file_reader_;
 
@@ -78,6 +91,14 @@ private:
     PaddedPODArray<char> read_buff_;
     std::vector<size_t> block_start_offsets_;
 
+    // the next block is read into read_ahead_buff_ on the spill io thread pool while the
+    // current one is deserialized, then the buffers are swapped
+    bool read_ahead_enabled_ = false;
+    std::shared_ptr<SpillAsyncIO> read_ahead_;
+    size_t read_ahead_block_index_ = 0;
+    size_t read_ahead_bytes_ = 0;
+    PaddedPODArray<char> read_ahead_buff_;
+
     PBlock pb_block_;
 
     RuntimeProfile::Counter* _read_file_timer = nullptr;
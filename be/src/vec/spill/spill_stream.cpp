@@ -65,6 +65,22 @@ void SpillStream::gc() {
     if (_current_file_size) {
         COUNTER_UPDATE(_current_file_size, -total_written_bytes_);
     }
+    if (data_dir_->is_remote()) {
+        // renaming on remote storage copies the files, delete them in the background instead
+        if (!_remote_files_deleted) {
+            _remote_files_deleted = true;
+            if (_current_file_count) {
+                COUNTER_UPDATE(_current_file_count, -1);
+            }
+            auto* pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+            static_cast<void>(pool->submit_func([fs = data_dir_->fs(), dir = spill_dir_]() {
+                static_cast<void>(fs->delete_directory(dir));
+            }));
+        }
+        data_dir_->update_spill_data_usage(-total_written_bytes_);
+        total_written_bytes_ = 0;
+        return;
+    }
     bool exists = false;
     auto status = io::global_local_filesystem()->exists(spill_dir_, &exists);
     if (status.ok() && exists) {
@@ -101,7 +117,7 @@ Status SpillStream::prepare() {
     _set_write_counters(profile_);
 
     reader_ = std::make_unique<SpillReader>(state_->get_query_ctx()->resource_ctx(), stream_id_,
-                                            writer_->get_file_path());
+                                            data_dir_->fs(), writer_->get_file_path());
 
     DBUG_EXECUTE_IF("fault_inject::spill_stream::prepare_spill", {
         return Status::Error<INTERNAL_ERROR>("fault_inject spill_stream prepare_spill failed");
@@ -115,7 +131,7 @@ Status SpillStream::prepare() {
 
 SpillReaderUPtr SpillStream::create_separate_reader() const {
     return std::make_unique<SpillReader>(state_->get_query_ctx()->resource_ctx(), stream_id_,
-                                         writer_->get_file_path());
+                                         data_dir_->fs(), writer_->get_file_path());
 }
 
 const TUniqueId& SpillStream::query_id() const {
@@ -92,6 +92,7 @@ private:
 
     std::atomic_bool _ready_for_reading = false;
     std::atomic_bool _is_reading = false;
+    bool _remote_files_deleted = false;
 
     SpillWriterUPtr writer_;
     SpillReaderUPtr reader_;
@@ -27,10 +27,14 @@
 #include <random>
 #include <string>
 
+#include "cloud/cloud_storage_engine.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "io/fs/file_system.h"
 #include "io/fs/local_file_system.h"
 #include "olap/olap_define.h"
+#include "runtime/cluster_info.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "util/doris_metrics.h"
 #include "util/parse_util.h"
@@ -117,6 +121,10 @@ void SpillStreamManager::_spill_gc_thread_callback() {
         for (auto& [path, dir] : _spill_store_map) {
             static_cast<void>(dir->update_capacity());
         }
+        std::lock_guard l(_remote_store_mutex);
+        if (_remote_store) {
+            static_cast<void>(_remote_store->update_capacity());
+        }
     }
 }
 
@@ -150,6 +158,29 @@ std::vector<SpillDataDir*> SpillStreamManager::_get_stores_for_spill(
     return stores;
 }
 
+SpillDataDir* SpillStreamManager::_get_remote_store_for_spill() {
+    if (!config::enable_spill_to_remote_storage || !config::is_cloud_mode()) {
+        return nullptr;
+    }
+    std::lock_guard l(_remote_store_mutex);
+    if (!_remote_store) {
+        auto fs = ExecEnv::GetInstance()->storage_engine().to_cloud().latest_fs();
+        if (!fs) {
+            return nullptr;
+        }
+        auto store = std::make_unique<SpillDataDir>(
+                fs, fmt::format("{}/{}", SPILL_REMOTE_DIR_PREFIX,
+                                ExecEnv::GetInstance()->cluster_info()->backend_id));
+        auto st = store->init();
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to init remote spill storage: " << st;
+            return nullptr;
+        }
+        _remote_store = std::move(store);
+    }
+    return _remote_store.get();
+}
+
 Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStreamSPtr& spill_stream,
                                                  const std::string& query_id,
                                                  const std::string& operator_name, int32_t node_id,
@@ -159,6 +190,13 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
     if (data_dirs.empty()) {
         data_dirs = _get_stores_for_spill(TStorageMedium::type::HDD);
     }
+    if (data_dirs.empty()) {
+        // the local disks are full, overflow to remote storage
+        auto* remote_dir = _get_remote_store_for_spill();
+        if (remote_dir && !remote_dir->reach_capacity_limit(0)) {
+            data_dirs.emplace_back(remote_dir);
+        }
+    }
     if (data_dirs.empty()) {
         return Status::Error<ErrorCode::NO_AVAILABLE_ROOT_PATH>(
                 "no available disk can be used for spill.");
@@ -172,7 +210,7 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
         // storage_root/spill/query_id/partitioned_hash_join-node_id-task_id-stream_id
         spill_dir = fmt::format("{}/{}/{}-{}-{}-{}", spill_root_dir, query_id, operator_name,
                                 node_id, state->task_id(), id);
-        auto st = io::global_local_filesystem()->create_directory(spill_dir);
+        auto st = dir->fs()->create_directory(spill_dir);
         if (!st.ok()) {
             continue;
         }
@@ -276,6 +314,16 @@ void SpillStreamManager::async_cleanup_query(TUniqueId query_id) {
                 }
             }
         }
+        SpillDataDir* remote_store = nullptr;
+        {
+            // _remote_store is never reset once created
+            std::lock_guard l(_remote_store_mutex);
+            remote_store = _remote_store.get();
+        }
+        if (remote_store) {
+            static_cast<void>(remote_store->fs()->delete_directory(
+                    remote_store->get_spill_data_path(print_id(query_id))));
+        }
     });
 }
 
@@ -289,6 +337,7 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_has_spill_gc_data, MetricUnit::BYT
 SpillDataDir::SpillDataDir(std::string path, int64_t capacity_bytes,
                            TStorageMedium::type storage_medium)
         : _path(std::move(path)),
+          _fs(io::global_local_filesystem()),
           _disk_capacity_bytes(capacity_bytes),
           _storage_medium(storage_medium) {
     spill_data_dir_metric_entity = DorisMetrics::instance()->metric_registry()->register_entity(
@@ -301,6 +350,11 @@ SpillDataDir::SpillDataDir(std::string path, int64_t capacity_bytes,
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_has_spill_gc_data);
 }
 
+SpillDataDir::SpillDataDir(io::FileSystemSPtr fs, std::string path)
+        : SpillDataDir(std::move(path), 0) {
+    _fs = std::move(fs);
+}
+
 bool is_directory_empty(const std::filesystem::path& dir) {
     try {
         return std::filesystem::is_directory(dir) &&
@@ -314,6 +368,14 @@ bool is_directory_empty(const std::filesystem::path& dir) {
 }
 
 Status SpillDataDir::init() {
+    if (is_remote()) {
+        // spill data left by the last run of this backend
+        RETURN_IF_ERROR(_fs->delete_directory(get_spill_data_path()));
+        RETURN_IF_ERROR(update_capacity());
+        LOG(INFO) << fmt::format("remote spill storage path: {}, limit: {}", _path,
+                                 PrettyPrinter::print_bytes(_spill_data_limit_bytes));
+        return Status::OK();
+    }
     bool exists = false;
     RETURN_IF_ERROR(io::global_local_filesystem()->exists(_path, &exists));
     if (!exists) {
@@ -348,6 +410,11 @@ std::string SpillDataDir::get_spill_data_gc_path(const std::string& sub_dir_name
 
 Status SpillDataDir::update_capacity() {
     std::lock_guard<std::mutex> l(_mutex);
+    if (is_remote()) {
+        _spill_data_limit_bytes = config::spill_remote_storage_limit_bytes;
+        spill_disk_limit->set_value(_spill_data_limit_bytes);
+        return Status::OK();
+    }
     RETURN_IF_ERROR(io::global_local_filesystem()->get_space_info(_path, &_disk_capacity_bytes,
                                                                   &_available_bytes));
     spill_disk_capacity->set_value(_disk_capacity_bytes);
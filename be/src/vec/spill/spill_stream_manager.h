@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "io/fs/file_system.h"
 #include "olap/options.h"
 #include "util/metrics.h"
 #include "util/threadpool.h"
@@ -47,10 +48,18 @@ public:
     SpillDataDir(std::string path, int64_t capacity_bytes,
                  TStorageMedium::type storage_medium = TStorageMedium::HDD);
 
+    // a spill dir on remote storage, used when the local spill dirs are full. It has no
+    // capacity of its own, the spill data size is limited by spill_remote_storage_limit.
+    SpillDataDir(io::FileSystemSPtr fs, std::string path);
+
     Status init();
 
     const std::string& path() const { return _path; }
 
+    const io::FileSystemSPtr& fs() const { return _fs; }
+
+    bool is_remote() const { return _fs->type() != io::FileSystemType::LOCAL; }
+
     std::string get_spill_data_path(const std::string& query_id = "") const;
 
     std::string get_spill_data_gc_path(const std::string& sub_dir_name = "") const;
@@ -92,6 +101,7 @@ private:
 
     friend class SpillStreamManager;
     std::string _path;
+    io::FileSystemSPtr _fs;
 
     // protect _disk_capacity_bytes, _available_bytes, _spill_data_limit_bytes, _spill_data_bytes
     std::mutex _mutex;
@@ -152,8 +162,13 @@ private:
     Status _init_spill_store_map();
     void _spill_gc_thread_callback();
     std::vector<SpillDataDir*> _get_stores_for_spill(TStorageMedium::type storage_medium);
+    // the remote spill dir, created on first use. nullptr if spilling to remote storage is
+    // disabled or there is no remote storage.
+    SpillDataDir* _get_remote_store_for_spill();
 
     std::unordered_map<std::string, std::unique_ptr<SpillDataDir>> _spill_store_map;
+    std::mutex _remote_store_mutex;
+    std::unique_ptr<SpillDataDir> _remote_store;
 
     CountDownLatch _stop_background_threads_latch;
     std::unique_ptr<ThreadPool> _spill_io_thread_pool;
@@ -18,21 +18,30 @@
 #include "vec/spill/spill_writer.h"
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/local_file_writer.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "vec/spill/spill_async_io.h"
 #include "vec/spill/spill_stream_manager.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
+SpillWriter::~SpillWriter() {
+    // the pending append uses pending_buff_ and file_writer_
+    static_cast<void>(_wait_pending_write());
+}
+
 Status SpillWriter::open() {
     if (file_writer_) {
         return Status::OK();
     }
-    return io::global_local_filesystem()->create_file(file_path_, &file_writer_);
+    // the spilled data is read once, it shouldn't evict the hot segments of queries
+    io::FileWriterOptions opts {.page_cache_mode = io::background_write_page_cache_mode()};
+    return data_dir_->fs()->create_file(file_path_, &file_writer_, &opts);
 }
 
 Status SpillWriter::close() {
@@ -40,6 +49,7 @@ Status SpillWriter::close() {
         return Status::OK();
     }
     closed_ = true;
+    RETURN_IF_ERROR(_wait_pending_write());
 
     meta_.append((const char*)&max_sub_block_size_, sizeof(max_sub_block_size_));
     meta_.append((const char*)&written_blocks_, sizeof(written_blocks_));
@@ -163,10 +173,22 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
                     ++written_blocks_;
                 }
             }};
-            {
+            status = _wait_pending_write();
+            RETURN_IF_ERROR(status);
+            if (!config::enable_spill_async_io) {
                 SCOPED_TIMER(_write_file_timer);
                 status = file_writer_->append(buff);
                 RETURN_IF_ERROR(status);
+            } else {
+                // write behind: the block is appended while the caller serializes the next one
+                pending_buff_ = std::move(buff);
+                COUNTER_UPDATE(_memory_used_counter, (int64_t)pending_buff_.size());
+                pending_write_ = SpillAsyncIO::submit(
+                        [this]() {
+                            SCOPED_TIMER(_write_file_timer);
+                            return file_writer_->append(pending_buff_);
+                        },
+                        _resource_ctx);
             }
         }
     }
@@ -174,4 +196,15 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
     return status;
 }
 
+Status SpillWriter::_wait_pending_write() {
+    if (!pending_write_) {
+        return Status::OK();
+    }
+    auto status = pending_write_->wait();
+    pending_write_.reset();
+    COUNTER_UPDATE(_memory_used_counter, -(int64_t)pending_buff_.size());
+    std::string().swap(pending_buff_);
+    return status;
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
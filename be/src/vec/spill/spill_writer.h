@@ -31,6 +31,7 @@ class RuntimeState;
 
 namespace vectorized {
 class SpillDataDir;
+class SpillAsyncIO;
 class SpillWriter {
 public:
     SpillWriter(std::shared_ptr<ResourceContext> resource_context, RuntimeProfile* profile,
@@ -46,6 +47,8 @@ public:
         _memory_used_counter = profile->get_counter("MemoryUsage");
     }
 
+    ~SpillWriter();
+
     Status open();
 
     Status close();
@@ -71,6 +74,9 @@ public:
 private:
     Status _write_internal(const Block& block, size_t& written_bytes);
 
+    // waits for the append of the previous block written behind
+    Status _wait_pending_write();
+
     // not owned, point to the data dir of this rowset
     // for checking disk capacity when write data to disk.
     SpillDataDir* data_dir_ = nullptr;
@@ -85,6 +91,11 @@ private:
     int64_t total_written_bytes_ = 0;
     std::string meta_;
 
+    // the serialized block being appended to the file on the spill io thread pool while the
+    // next one is serialized
+    std::shared_ptr<SpillAsyncIO> pending_write_;
+    std::string pending_buff_;
+
     RuntimeProfile::Counter* _write_file_timer = nullptr;
     RuntimeProfile::Counter* _serialize_timer = nullptr;
     RuntimeProfile::Counter* _write_block_counter = nullptr;
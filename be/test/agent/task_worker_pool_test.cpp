@@ -23,7 +23,9 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "olap/options.h"
 #include "olap/storage_engine.h"
@@ -54,6 +56,41 @@ TEST(TaskWorkerPoolTest, TaskWorkerPool) {
     EXPECT_EQ(count.load(), 2);
 }
 
+TEST(TaskWorkerPoolTest, TaskWorkerPoolHighPriorFirst) {
+    std::mutex mtx;
+    std::vector<TPriority::type> priorities;
+    std::atomic_bool first {true};
+    TaskWorkerPool workers("test", 1, [&](auto&& task) {
+        if (first.exchange(false)) {
+            std::this_thread::sleep_for(500ms);
+        }
+        std::lock_guard lock(mtx);
+        priorities.push_back(task.priority);
+    });
+
+    TAgentTaskRequest task;
+    task.__set_signature(-1);
+    task.__set_priority(TPriority::NORMAL);
+    auto _ = workers.submit_task(task); // Occupy the only worker
+    std::this_thread::sleep_for(100ms);
+
+    _ = workers.submit_task(task);
+    _ = workers.submit_task(task);
+    task.__set_priority(TPriority::HIGH);
+    // Submitted last but runs before the pending normal tasks
+    _ = workers.submit_task(task);
+
+    std::this_thread::sleep_for(1s);
+    workers.stop();
+
+    std::lock_guard lock(mtx);
+    ASSERT_EQ(priorities.size(), 4);
+    EXPECT_EQ(priorities[0], TPriority::NORMAL);
+    EXPECT_EQ(priorities[1], TPriority::HIGH);
+    EXPECT_EQ(priorities[2], TPriority::NORMAL);
+    EXPECT_EQ(priorities[3], TPriority::NORMAL);
+}
+
 TEST(TaskWorkerPoolTest, PriorTaskWorkerPool) {
     std::atomic_int normal_count {0};
     std::atomic_int high_prior_count {0};
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "cloud/cloud_meta_mgr.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/cloud_tablet.h"
+#include "cpp/sync_point.h"
+#include "olap/tablet_meta.h"
+
+namespace doris {
+
+class CloudMetaMgrTest : public testing::Test {
+public:
+    CloudMetaMgrTest() : _engine(CloudStorageEngine({})) {}
+
+    CloudTabletSPtr create_tablet(int64_t tablet_id, int64_t max_version) {
+        TabletMetaSharedPtr tablet_meta(new TabletMeta(
+                1, 2, tablet_id, 15674, 4, 5, TTabletSchema(), 6, {{7, 8}}, UniqueId(9, 10),
+                TTabletType::TABLET_TYPE_DISK, TCompressionType::LZ4F));
+        tablet_meta->set_tablet_state(TABLET_RUNNING);
+        auto tablet = std::make_shared<CloudTablet>(_engine, tablet_meta);
+        tablet->_max_version = max_version;
+        return tablet;
+    }
+
+protected:
+    CloudStorageEngine _engine;
+};
+
+TEST_F(CloudMetaMgrTest, SyncTabletsRowsetsSkipsUpToDateTablets) {
+    auto sp = SyncPoint::get_instance();
+    sp->enable_processing();
+    std::mutex lock;
+    std::vector<int64_t> synced_tablets;
+    SyncPoint::CallbackGuard guard;
+    sp->set_call_back(
+            "CloudMetaMgr::sync_tablet_rowsets",
+            [&](auto&& args) {
+                auto* tablet = try_any_cast<CloudTablet*>(args[0]);
+                {
+                    std::lock_guard l(lock);
+                    synced_tablets.push_back(tablet->tablet_id());
+                }
+                auto* ret = try_any_cast_ret<Status>(args);
+                ret->first = Status::OK();
+                ret->second = true;
+            },
+            &guard);
+
+    std::vector<CloudTabletSPtr> tablets;
+    std::vector<CloudTablet*> tablet_ptrs;
+    for (int64_t i = 0; i < 10; ++i) {
+        tablets.push_back(create_tablet(10000 + i, 5));
+        tablet_ptrs.push_back(tablets.back().get());
+    }
+    // the odd tablets are behind their query version
+    std::vector<int64_t> query_versions;
+    for (int64_t i = 0; i < 10; ++i) {
+        query_versions.push_back(i % 2 == 0 ? 5 : 6);
+    }
+    std::vector<SyncRowsetStats> sync_stats(tablets.size());
+    auto st = _engine.meta_mgr().sync_tablets_rowsets(tablet_ptrs, query_versions, {},
+                                                      &sync_stats, 3);
+    ASSERT_TRUE(st.ok()) << st;
+
+    std::sort(synced_tablets.begin(), synced_tablets.end());
+    EXPECT_EQ(synced_tablets, (std::vector<int64_t> {10001, 10003, 10005, 10007, 10009}));
+    sp->disable_processing();
+}
+
+} // namespace doris
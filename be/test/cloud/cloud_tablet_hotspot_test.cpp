@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "cloud/cloud_tablet_hotspot.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/cloud_tablet.h"
+#include "cloud/cloud_warm_up_manager.h"
+#include "olap/tablet_meta.h"
+
+namespace doris {
+
+class CloudTabletHotspotTest : public testing::Test {
+public:
+    CloudTabletHotspotTest() : _engine(CloudStorageEngine({})) {}
+
+    CloudTabletSPtr create_tablet(int64_t tablet_id) {
+        TabletMetaSharedPtr tablet_meta(new TabletMeta(
+                1, 2, tablet_id, 15674, 4, 5, TTabletSchema(), 6, {{7, 8}}, UniqueId(9, 10),
+                TTabletType::TABLET_TYPE_DISK, TCompressionType::LZ4F));
+        return std::make_shared<CloudTablet>(_engine, tablet_meta);
+    }
+
+protected:
+    CloudStorageEngine _engine;
+};
+
+TEST_F(CloudTabletHotspotTest, TopNHotTablets) {
+    TabletHotspot hotspot;
+    std::vector<CloudTabletSPtr> tablets;
+    for (int64_t tablet_id = 100; tablet_id < 105; ++tablet_id) {
+        tablets.push_back(create_tablet(tablet_id));
+    }
+    // tablet 100 is queried once, 101 twice and so on, 104 never
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j <= i; ++j) {
+            hotspot.count(*tablets[i]);
+        }
+    }
+
+    std::vector<HotTablet> hot_tablets;
+    hotspot.get_top_n_hot_tablets(2, &hot_tablets);
+    ASSERT_EQ(hot_tablets.size(), 2);
+    EXPECT_EQ(hot_tablets[0].tablet_id, 103);
+    EXPECT_EQ(hot_tablets[0].qpd, 4);
+    EXPECT_EQ(hot_tablets[1].tablet_id, 102);
+
+    hotspot.get_top_n_hot_tablets(10, &hot_tablets);
+    ASSERT_EQ(hot_tablets.size(), 4);
+    EXPECT_EQ(hot_tablets[3].tablet_id, 100);
+    EXPECT_EQ(hot_tablets[3].qpw, 1);
+}
+
+TEST_F(CloudTabletHotspotTest, ParseHotTablets) {
+    std::vector<int64_t> tablet_ids;
+    ASSERT_TRUE(CloudWarmUpManager::parse_hot_tablets("103 4\n102 3\n\n100 1\n", &tablet_ids));
+    EXPECT_EQ(tablet_ids, (std::vector<int64_t> {103, 102, 100}));
+
+    tablet_ids.clear();
+    ASSERT_TRUE(CloudWarmUpManager::parse_hot_tablets("", &tablet_ids));
+    EXPECT_TRUE(tablet_ids.empty());
+    EXPECT_FALSE(CloudWarmUpManager::parse_hot_tablets("103 4\nunknown metrics", &tablet_ids));
+    EXPECT_FALSE(CloudWarmUpManager::parse_hot_tablets("103x 4", &tablet_ids));
+}
+
+} // namespace doris
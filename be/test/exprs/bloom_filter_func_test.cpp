@@ -20,16 +20,21 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <numeric>
 #include <string>
+#include <vector>
 
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "exprs/block_bloom_filter.hpp"
 #include "exprs/create_predicate_function.h"
 #include "gtest/gtest.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/primitive_type.h"
 #include "testutil/column_helper.h"
+#include "util/cpu_info.h"
 #include "util/url_coding.h"
 #include "vec/columns/column_decimal.h"
 #include "vec/runtime/vdatetime_value.h"
@@ -674,4 +679,76 @@ TEST_F(BloomFilterFuncTest, FindFixedLenOlapEngine) {
     ASSERT_EQ(offsets2[1], 3);
 }
 
+TEST_F(BloomFilterFuncTest, FindBatch) {
+    BlockBloomFilter bloom_filter;
+    ASSERT_TRUE(bloom_filter.init(12, 0).ok());
+    std::vector<uint32_t> hashes(1000);
+    std::vector<uint8_t> results(hashes.size());
+    bloom_filter.find_batch(hashes.data(), hashes.size(), results.data());
+    ASSERT_EQ(std::count(results.begin(), results.end(), 1), 0);
+
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        hashes[i] = uint32_t(i * 2654435761U);
+        if (i % 3 == 0) {
+            bloom_filter.insert(hashes[i]);
+        }
+    }
+    auto check = [&]() {
+        // 1000 is not a multiple of 16, so the batch ends with a tail.
+        bloom_filter.find_batch(hashes.data(), hashes.size(), results.data());
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            ASSERT_EQ(results[i], bloom_filter.find(hashes[i])) << i;
+            if (i % 3 == 0) {
+                ASSERT_EQ(results[i], 1) << i;
+            }
+        }
+    };
+    check();
+    {
+        CpuInfo::TempDisable disable_avx512(CpuInfo::AVX512F);
+        check();
+    }
+
+    BloomFilterFunc<PrimitiveType::TYPE_INT> bloom_filter_func(true);
+    RuntimeFilterParams params {1,
+                                RuntimeFilterType::BLOOM_FILTER,
+                                PrimitiveType::TYPE_INT,
+                                false,
+                                0,
+                                0,
+                                0,
+                                256,
+                                0,
+                                0,
+                                false,
+                                false};
+    bloom_filter_func.init_params(&params);
+    ASSERT_TRUE(bloom_filter_func.init_with_fixed_length(1024).ok());
+    std::vector<int32_t> values(600);
+    std::iota(values.begin(), values.end(), 0);
+    bloom_filter_func.insert_fixed_len(
+            vectorized::ColumnHelper::create_column<vectorized::DataTypeInt32>(
+                    std::vector<int32_t>(values.begin(), values.begin() + 300)),
+            0);
+    auto nullmap_column = vectorized::ColumnUInt8::create(values.size(), 0);
+    for (size_t i = 0; i < values.size(); i += 7) {
+        nullmap_column->get_data()[i] = 1;
+    }
+    auto nullable_column = vectorized::ColumnNullable::create(
+            vectorized::ColumnHelper::create_column<vectorized::DataTypeInt32>(values),
+            std::move(nullmap_column));
+    for (bool contain_null : {false, true}) {
+        bloom_filter_func.set_contain_null(contain_null);
+        std::vector<uint8_t> column_results(values.size());
+        bloom_filter_func.find_fixed_len(nullable_column->get_ptr(), column_results.data());
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (i % 7 == 0) {
+                ASSERT_EQ(column_results[i], contain_null) << i;
+            } else if (i < 300) {
+                ASSERT_EQ(column_results[i], 1) << i;
+            }
+        }
+    }
+}
+
 } // namespace doris
\ No newline at end of file
@@ -1553,4 +1553,40 @@ TEST_F(GeoTypesTest, circle) {
     }
 }
 
+TEST_F(GeoTypesTest, cell_covering) {
+    const char* wkt =
+            "MULTIPOLYGON (((10 10, 50 10, 50 50, 10 50, 10 10)), ((60 60, 70 60, 70 70, 60 70, "
+            "60 60)))";
+    GeoParseStatus status;
+    std::unique_ptr<GeoShape> multi_polygon(GeoShape::from_wkt(wkt, strlen(wkt), &status));
+    ASSERT_EQ(GEO_PARSE_OK, status);
+    auto covering = GeoCellCovering::create(*multi_polygon);
+    ASSERT_NE(nullptr, covering);
+
+    GeoCircle circle;
+    ASSERT_EQ(GEO_PARSE_OK, circle.init(110.123, 64, 1000));
+    auto circle_covering = GeoCellCovering::create(circle);
+    ASSERT_NE(nullptr, circle_covering);
+
+    // every contained point is in the covering
+    for (double x = 0; x < 80; x += 0.5) {
+        for (double y = 0; y < 80; y += 0.5) {
+            GeoPoint point;
+            ASSERT_EQ(GEO_PARSE_OK, point.from_coord(x, y));
+            if (multi_polygon->contains(&point)) {
+                EXPECT_TRUE(covering->may_contain(point)) << x << " " << y;
+            }
+        }
+    }
+    GeoPoint point;
+    ASSERT_EQ(GEO_PARSE_OK, point.from_coord(-100, -60));
+    EXPECT_FALSE(covering->may_contain(point));
+    EXPECT_FALSE(circle_covering->may_contain(point));
+    ASSERT_EQ(GEO_PARSE_OK, point.from_coord(110.123, 64));
+    EXPECT_TRUE(circle_covering->may_contain(point));
+
+    // no covering of a point
+    EXPECT_EQ(nullptr, GeoCellCovering::create(point));
+}
+
 } // namespace doris
@@ -44,6 +44,7 @@
 #include <optional>
 #include <random>
 #include <ranges>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <thread>
@@ -63,6 +64,7 @@
 #include "olap/options.h"
 #include "runtime/exec_env.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 
 namespace doris::io {
@@ -3271,6 +3273,7 @@ TEST_F(BlockFileCacheTest, test_factory_1) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3309,6 +3312,7 @@ TEST_F(BlockFileCacheTest, test_factory_2) {
     config::clear_file_cache = false;
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3343,6 +3347,90 @@ TEST_F(BlockFileCacheTest, test_factory_3) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
+    FileCacheFactory::instance()->_capacity = 0;
+}
+
+TEST_F(BlockFileCacheTest, test_factory_shards) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    // a key prefix directory of the unsharded layout
+    fs::create_directories(fs::path(cache_base_path) / "abc");
+    int32_t shards_per_path = config::file_cache_shards_per_path;
+    config::file_cache_shards_per_path = 4;
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 40;
+    settings.query_queue_elements = 8;
+    settings.index_queue_size = 40;
+    settings.index_queue_elements = 8;
+    settings.disposable_queue_size = 40;
+    settings.disposable_queue_elements = 8;
+    settings.capacity = 120;
+    settings.max_file_block_size = 30;
+    settings.max_query_cache_size = 40;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    EXPECT_EQ(FileCacheFactory::instance()->get_cache_instance_size(), 4);
+    EXPECT_EQ(FileCacheFactory::instance()->get_capacity(), 120);
+    EXPECT_FALSE(fs::exists(fs::path(cache_base_path) / "abc"));
+    for (int shard = 0; shard < 4; ++shard) {
+        std::string shard_path = (fs::path(cache_base_path) / fmt::format("shard_{}", shard));
+        auto* cache = FileCacheFactory::instance()->get_by_path(shard_path);
+        ASSERT_NE(cache, nullptr);
+        EXPECT_EQ(cache->capacity(), 30);
+        int i = 0;
+        while (i++ < 1000) {
+            if (cache->get_async_open_success()) {
+                break;
+            };
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_LT(i, 1000);
+    }
+    EXPECT_EQ(FileCacheFactory::instance()->get_by_path(cache_base_path), nullptr);
+
+    // the keys are spread over the shards
+    std::set<io::BlockFileCache*> caches;
+    for (int key = 0; key < 100; ++key) {
+        caches.insert(FileCacheFactory::instance()->get_by_path(
+                io::BlockFileCache::hash(fmt::format("key{}", key))));
+    }
+    EXPECT_EQ(caches.size(), 4);
+
+    // the capacity of the path is split among its shards
+    FileCacheFactory::instance()->reset_capacity(cache_base_path, 400);
+    EXPECT_EQ(FileCacheFactory::instance()->get_capacity(), 400);
+    for (auto* cache : caches) {
+        EXPECT_EQ(cache->capacity(), 100);
+    }
+
+    FileCacheFactory::instance()->_caches.clear();
+    FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
+    FileCacheFactory::instance()->_capacity = 0;
+
+    // going back to a single cache removes the shards
+    config::file_cache_shards_per_path = 1;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    EXPECT_FALSE(fs::exists(fs::path(cache_base_path) / "shard_0"));
+    EXPECT_EQ(FileCacheFactory::instance()->get_by_path(cache_base_path)->capacity(), 120);
+    auto* cache = FileCacheFactory::instance()->get_by_path(cache_base_path);
+    int i = 0;
+    while (i++ < 1000) {
+        if (cache->get_async_open_success()) {
+            break;
+        };
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_LT(i, 1000);
+
+    config::file_cache_shards_per_path = shards_per_path;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    FileCacheFactory::instance()->_caches.clear();
+    FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3485,6 +3573,7 @@ TEST_F(BlockFileCacheTest, test_query_limit) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3871,6 +3960,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3933,6 +4023,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_tail) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -4013,6 +4104,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_error_handle) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -4073,6 +4165,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_init) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -4149,6 +4242,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_concurrent) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -4224,6 +4318,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_concurrent_2) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -4771,6 +4866,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_opt_lock) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
     config::enable_read_cache_file_directly = false;
 }
@@ -7361,6 +7457,7 @@ TEST_F(BlockFileCacheTest, reader_dryrun_when_download_file_cache) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
     config::enable_reader_dryrun_when_download_file_cache = org;
 }
@@ -7833,6 +7930,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_ttl_index) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -7910,6 +8008,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_normal_index) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -7987,6 +8086,197 @@ TEST_F(BlockFileCacheTest, test_reset_capacity) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
+    FileCacheFactory::instance()->_capacity = 0;
+}
+
+TEST_F(BlockFileCacheTest, test_segmented_fifo_queue) {
+    std::mutex mutex;
+    std::lock_guard cache_lock(mutex);
+    BlockFileCache::LRUQueue queue(40, 100, 0);
+    queue.enable_segmented_fifo(50);
+    auto a = io::BlockFileCache::hash("a");
+    auto b = io::BlockFileCache::hash("b");
+    auto c = io::BlockFileCache::hash("c");
+    auto d = io::BlockFileCache::hash("d");
+
+    // a hit moves a block out of probation
+    auto it_a = queue.add(a, 0, 10, cache_lock);
+    queue.move_to_end(it_a, cache_lock);
+    EXPECT_EQ(queue.probation_hits, 1);
+    EXPECT_EQ(queue.probation_size, 0);
+
+    // new blocks are evicted before the protected ones
+    auto it_b = queue.add(b, 0, 10, cache_lock);
+    EXPECT_EQ(queue.begin()->hash, b);
+    EXPECT_EQ(queue.probation_size, 10);
+    queue.add(c, 0, 10, cache_lock);
+    EXPECT_EQ(std::next(queue.begin())->hash, c);
+    EXPECT_EQ(std::prev(queue.end())->hash, a);
+    queue.move_to_end(it_a, cache_lock);
+    EXPECT_EQ(queue.protected_hits, 1);
+
+    // an evicted block comes back protected
+    queue.remove(it_b, cache_lock);
+    it_b = queue.add(b, 0, 10, cache_lock);
+    EXPECT_EQ(queue.ghost_hits, 1);
+    EXPECT_EQ(std::prev(queue.end())->hash, b);
+    EXPECT_EQ(queue.probation_size, 10);
+
+    // the oldest protected block is demoted when the queue is full and probation is below
+    // its share
+    queue.add(d, 0, 20, cache_lock);
+    EXPECT_EQ(queue.probation_size, 40);
+    std::vector<UInt128Wrapper> order;
+    for (const auto& entry : queue) {
+        order.push_back(entry.hash);
+    }
+    EXPECT_EQ(order, (std::vector<UInt128Wrapper> {c, a, d, b}));
+    EXPECT_EQ(queue.get_capacity(cache_lock), 50);
+
+    queue.remove_all(cache_lock);
+    EXPECT_EQ(queue.probation_size, 0);
+    EXPECT_TRUE(queue.ghost_keys.empty());
+}
+
+TEST_F(BlockFileCacheTest, test_meta_checkpoint) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    bool enable_meta_checkpoint = config::enable_file_cache_meta_checkpoint;
+    config::enable_file_cache_meta_checkpoint = true;
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 60;
+    settings.query_queue_elements = 6;
+    settings.capacity = 60;
+    settings.max_file_block_size = 30;
+    settings.max_query_cache_size = 60;
+    io::CacheContext context;
+    ReadStatistics rstats;
+    context.stats = &rstats;
+    context.cache_type = io::FileCacheType::NORMAL;
+    context.query_id.hi = 1;
+    context.query_id.lo = 1;
+    auto key = io::BlockFileCache::hash("key1");
+    auto wait_for_open = [](io::BlockFileCache& cache) {
+        for (int i = 0; i < 1000 && !cache.get_async_open_success(); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_TRUE(cache.get_async_open_success());
+    };
+    std::string checkpoint = fs::path(cache_base_path) / "meta_checkpoint";
+    {
+        io::BlockFileCache cache(cache_base_path, settings);
+        ASSERT_TRUE(cache.initialize());
+        wait_for_open(cache);
+        for (size_t offset : {0, 10, 20}) {
+            auto holder = cache.get_or_set(key, offset, 10, context);
+            complete(holder);
+        }
+        // a hit moves the first block to the end
+        auto holder = cache.get_or_set(key, 0, 10, context);
+        ASSERT_EQ(holder.file_blocks.size(), 1);
+    }
+    ASSERT_TRUE(fs::exists(checkpoint));
+
+    auto sp = SyncPoint::get_instance();
+    sp->enable_processing();
+    bool scanned = false;
+    SyncPoint::CallbackGuard guard;
+    sp->set_call_back("BlockFileCache::BeforeScan", [&](auto&&) { scanned = true; }, &guard);
+    {
+        io::BlockFileCache cache(cache_base_path, settings);
+        ASSERT_TRUE(cache.initialize());
+        wait_for_open(cache);
+        EXPECT_FALSE(scanned);
+        EXPECT_FALSE(fs::exists(checkpoint));
+        EXPECT_EQ(cache.get_file_blocks_num(io::FileCacheType::NORMAL), 3);
+        std::vector<size_t> offsets;
+        for (const auto& entry : cache.get_queue(io::FileCacheType::NORMAL)) {
+            offsets.push_back(entry.offset);
+        }
+        EXPECT_EQ(offsets, (std::vector<size_t> {10, 20, 0}));
+    }
+
+    // a corrupted checkpoint falls back to the scan
+    ASSERT_TRUE(fs::exists(checkpoint));
+    fs::resize_file(checkpoint, fs::file_size(checkpoint) - 1);
+    {
+        io::BlockFileCache cache(cache_base_path, settings);
+        ASSERT_TRUE(cache.initialize());
+        wait_for_open(cache);
+        EXPECT_TRUE(scanned);
+        EXPECT_EQ(cache.get_file_blocks_num(io::FileCacheType::NORMAL), 3);
+    }
+    sp->disable_processing();
+    config::enable_file_cache_meta_checkpoint = enable_meta_checkpoint;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
+TEST_F(BlockFileCacheTest, cached_remote_file_reader_write_behind) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 6291456;
+    settings.query_queue_elements = 6;
+    settings.index_queue_size = 1048576;
+    settings.index_queue_elements = 1;
+    settings.disposable_queue_size = 1048576;
+    settings.disposable_queue_elements = 1;
+    settings.capacity = 8388608;
+    settings.max_file_block_size = 1048576;
+    settings.max_query_cache_size = 0;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_TRUE(ThreadPoolBuilder("FileCacheWriteBehindThreadPool")
+                        .set_min_threads(1)
+                        .set_max_threads(1)
+                        .build(&pool)
+                        .ok());
+    ExecEnv::GetInstance()->_file_cache_write_behind_thread_pool = std::move(pool);
+    bool enable_write_behind = config::enable_file_cache_write_behind;
+    config::enable_file_cache_write_behind = true;
+    FileReaderSPtr local_reader;
+    ASSERT_TRUE(global_local_filesystem()->open_file(tmp_file, &local_reader));
+    io::FileReaderOptions opts;
+    opts.cache_type = io::cache_type_from_string("file_block_cache");
+    opts.is_doris_table = true;
+    CachedRemoteFileReader reader(local_reader, opts);
+    for (int round = 0; round < 2; ++round) {
+        std::string buffer;
+        buffer.resize(64_kb);
+        IOContext io_ctx;
+        FileCacheStatistics stats;
+        io_ctx.file_cache_stats = &stats;
+        size_t bytes_read {0};
+        ASSERT_TRUE(reader.read_at(32222, Slice(buffer.data(), buffer.size()), &bytes_read, &io_ctx)
+                            .ok());
+        EXPECT_EQ(bytes_read, 64_kb);
+        EXPECT_EQ(std::string(64_kb, '0'), buffer);
+        if (round == 0) {
+            EXPECT_EQ(stats.num_remote_io_total, 1);
+            ExecEnv::GetInstance()->file_cache_write_behind_thread_pool()->wait();
+        } else {
+            // written by the write-behind task
+            EXPECT_EQ(stats.num_remote_io_total, 0);
+            EXPECT_EQ(stats.num_local_io_total, 1);
+        }
+    }
+    EXPECT_TRUE(reader.close().ok());
+    ExecEnv::GetInstance()->_file_cache_write_behind_thread_pool->shutdown();
+    ExecEnv::GetInstance()->_file_cache_write_behind_thread_pool.reset();
+    config::enable_file_cache_write_behind = enable_write_behind;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    FileCacheFactory::instance()->_caches.clear();
+    FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_base_path_to_caches.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -508,4 +508,43 @@ TEST_F(BufferedReaderTest, test_range_cache_file_reader) {
     }
 }
 
+TEST_F(BufferedReaderTest, test_range_prefetch_file_reader) {
+    io::FileReaderSPtr offset_reader = std::make_shared<MockOffsetFileReader>(16 * 1024 * 1024);
+    auto fallback_reader = std::make_shared<TestingRangeCacheFileReader>(offset_reader);
+    std::vector<io::PrefetchRange> ranges = {io::PrefetchRange(100, 1024 * 1024),
+                                             io::PrefetchRange(2 * 1024 * 1024, 3 * 1024 * 1024)};
+    io::RangePrefetchFileReader prefetch_reader(nullptr, offset_reader, fallback_reader, ranges);
+    EXPECT_EQ(prefetch_reader.prefetch_bytes(), 1024 * 1024 - 100 + 1024 * 1024);
+    prefetch_reader.prefetch(nullptr);
+
+    auto check = [](const char* data, size_t offset, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_EQ((unsigned char)data[i], (offset + i) % UCHAR_MAX);
+        }
+    };
+    std::vector<char> buf(4096);
+    size_t bytes_read = 0;
+    // within the prefetched ranges
+    EXPECT_TRUE(prefetch_reader.read_at(100, Slice(buf.data(), 4096), &bytes_read, nullptr).ok());
+    EXPECT_EQ(bytes_read, 4096);
+    check(buf.data(), 100, 4096);
+    EXPECT_TRUE(prefetch_reader
+                        .read_at(3 * 1024 * 1024 - 4096, Slice(buf.data(), 4096), &bytes_read,
+                                 nullptr)
+                        .ok());
+    check(buf.data(), 3 * 1024 * 1024 - 4096, 4096);
+
+    // across the end of a range, or out of the ranges
+    EXPECT_TRUE(prefetch_reader
+                        .read_at(1024 * 1024 - 10, Slice(buf.data(), 20), &bytes_read, nullptr)
+                        .ok());
+    EXPECT_EQ(io::PrefetchRange(1024 * 1024 - 10, 1024 * 1024 + 10),
+              fallback_reader->last_read_range());
+    check(buf.data(), 1024 * 1024 - 10, 20);
+    EXPECT_TRUE(prefetch_reader.read_at(50, Slice(buf.data(), 10), &bytes_read, nullptr).ok());
+    EXPECT_EQ(io::PrefetchRange(50, 60), fallback_reader->last_read_range());
+    check(buf.data(), 50, 10);
+    EXPECT_TRUE(prefetch_reader.close().ok());
+}
+
 } // end namespace doris
@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "io/fs/disk_io_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris::io {
+
+class DiskIOSchedulerTest : public testing::Test {
+public:
+    void SetUp() override {
+        _enabled = config::enable_background_disk_io_throttle;
+        _max_rate = config::background_disk_io_max_bytes_per_second;
+        _min_rate = config::background_disk_io_min_bytes_per_second;
+        config::enable_background_disk_io_throttle = true;
+        config::background_disk_io_max_bytes_per_second = 10 * 1024 * 1024;
+        config::background_disk_io_min_bytes_per_second = 1024 * 1024;
+    }
+
+    void TearDown() override {
+        config::enable_background_disk_io_throttle = _enabled;
+        config::background_disk_io_max_bytes_per_second = _max_rate;
+        config::background_disk_io_min_bytes_per_second = _min_rate;
+    }
+
+    static void wait_adjust() { std::this_thread::sleep_for(std::chrono::milliseconds(150)); }
+
+private:
+    bool _enabled;
+    int64_t _max_rate;
+    int64_t _min_rate;
+};
+
+TEST_F(DiskIOSchedulerTest, Disabled) {
+    config::enable_background_disk_io_throttle = false;
+    auto* scheduler = DiskIOScheduler::instance();
+    EXPECT_EQ(scheduler->background_rate("/disabled"), -1);
+    int64_t start_us = MonotonicMicros();
+    scheduler->acquire_background_io("/disabled", 1024L * 1024 * 1024);
+    EXPECT_LT(MonotonicMicros() - start_us, 100 * 1000);
+}
+
+TEST_F(DiskIOSchedulerTest, IdleDiskBursts) {
+    auto* scheduler = DiskIOScheduler::instance();
+    EXPECT_EQ(scheduler->background_rate("/idle"), 10 * 1024 * 1024);
+    int64_t start_us = MonotonicMicros();
+    // a second of the max rate is taken without waiting
+    scheduler->acquire_background_io("/idle", 8 * 1024 * 1024);
+    EXPECT_LT(MonotonicMicros() - start_us, 100 * 1000);
+    // then the debt is paid back at the max rate
+    scheduler->acquire_background_io("/idle", 5 * 1024 * 1024);
+    EXPECT_GE(MonotonicMicros() - start_us, 200 * 1000);
+}
+
+TEST_F(DiskIOSchedulerTest, AdaptToForegroundLatency) {
+    auto* scheduler = DiskIOScheduler::instance();
+    const int64_t slow_us = config::background_disk_io_target_read_latency_us * 4;
+    EXPECT_EQ(scheduler->background_rate("/busy"), 10 * 1024 * 1024);
+    scheduler->record_foreground_io("/busy", slow_us);
+    wait_adjust();
+    scheduler->record_foreground_io("/busy", slow_us);
+    EXPECT_EQ(scheduler->background_rate("/busy"), 5 * 1024 * 1024);
+    for (int i = 0; i < 5; ++i) {
+        wait_adjust();
+        scheduler->record_foreground_io("/busy", slow_us);
+        scheduler->background_rate("/busy");
+    }
+    EXPECT_EQ(scheduler->background_rate("/busy"), 1024 * 1024);
+
+    // fast reads let the rate grow back
+    for (int i = 0; i < 20; ++i) {
+        scheduler->record_foreground_io("/busy", 10);
+    }
+    wait_adjust();
+    scheduler->record_foreground_io("/busy", 10);
+    EXPECT_EQ(scheduler->background_rate("/busy"), 2 * 1024 * 1024);
+}
+
+} // namespace doris::io
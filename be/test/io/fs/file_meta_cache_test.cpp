@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/file_meta_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "io/fs/file_reader.h"
+#include "io/fs/local_file_system.h"
+
+namespace doris {
+
+class FileMetaCacheTest : public testing::Test {
+public:
+    void SetUp() override {
+        _path = std::filesystem::temp_directory_path() / "file_meta_cache_test";
+        for (int i = 0; i < 10000; ++i) {
+            _data.push_back(static_cast<char>('a' + i % 26));
+        }
+        std::ofstream out(_path, std::ios::binary | std::ios::trunc);
+        out.write(_data.data(), _data.size());
+        out.close();
+        ASSERT_TRUE(io::global_local_filesystem()->open_file(_path, &_reader).ok());
+    }
+
+    void TearDown() override {
+        static_cast<void>(_reader->close());
+        std::filesystem::remove(_path);
+    }
+
+protected:
+    std::string _path;
+    std::string _data;
+    io::FileReaderSPtr _reader;
+};
+
+TEST_F(FileMetaCacheTest, ReadMetaRange) {
+    FileMetaCache meta_cache(16, 1024 * 1024);
+    ASSERT_TRUE(meta_cache.range_cache_enabled());
+
+    ObjLRUCache::CacheHandle handle;
+    Slice data;
+    size_t bytes_read = 0;
+    ASSERT_TRUE(meta_cache.read_meta_range(_reader, nullptr, 1, 100, 500, &handle, &data,
+                                           &bytes_read)
+                        .ok());
+    EXPECT_EQ(bytes_read, 500);
+    EXPECT_EQ(data.to_string(), _data.substr(100, 500));
+
+    // the second read is served by the cache
+    ObjLRUCache::CacheHandle cached_handle;
+    ASSERT_TRUE(meta_cache.read_meta_range(_reader, nullptr, 1, 100, 500, &cached_handle, &data,
+                                           &bytes_read)
+                        .ok());
+    EXPECT_EQ(bytes_read, 0);
+    EXPECT_EQ(data.to_string(), _data.substr(100, 500));
+
+    // another mtime is another version of the file
+    ObjLRUCache::CacheHandle new_handle;
+    ASSERT_TRUE(meta_cache.read_meta_range(_reader, nullptr, 2, 100, 500, &new_handle, &data,
+                                           &bytes_read)
+                        .ok());
+    EXPECT_EQ(bytes_read, 500);
+
+    // reading beyond the end of the file fails
+    ObjLRUCache::CacheHandle bad_handle;
+    EXPECT_FALSE(meta_cache.read_meta_range(_reader, nullptr, 1, _data.size() - 10, 100,
+                                            &bad_handle, &data, &bytes_read)
+                         .ok());
+}
+
+TEST_F(FileMetaCacheTest, Disabled) {
+    FileMetaCache meta_cache(16, 0);
+    EXPECT_FALSE(meta_cache.range_cache_enabled());
+    EXPECT_NE(FileMetaCache::get_key(_reader, 1), FileMetaCache::get_key(_reader, 2));
+}
+
+} // namespace doris
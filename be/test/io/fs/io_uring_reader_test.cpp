@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "io/fs/io_uring_reader.h"
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace doris::io {
+
+class IOUringReaderTest : public testing::Test {
+public:
+    void SetUp() override {
+        _path = std::filesystem::temp_directory_path() / "io_uring_reader_test";
+        for (int i = 0; i < 100000; ++i) {
+            _data.push_back(static_cast<char>('a' + i % 26));
+        }
+        int fd = ::open(_path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+        ASSERT_GE(fd, 0);
+        ASSERT_EQ(::write(fd, _data.data(), _data.size()), static_cast<ssize_t>(_data.size()));
+        ::close(fd);
+        _fd = ::open(_path.c_str(), O_RDONLY);
+        ASSERT_GE(_fd, 0);
+    }
+
+    void TearDown() override {
+        ::close(_fd);
+        std::filesystem::remove(_path);
+    }
+
+protected:
+    std::string _path;
+    std::string _data;
+    int _fd = -1;
+};
+
+TEST_F(IOUringReaderTest, ReadBatch) {
+    // more than a ring takes
+    constexpr size_t num = 200;
+    std::vector<std::string> buffers(num, std::string(300, '\0'));
+    std::vector<IOUringReadRequest> requests(num);
+    for (size_t i = 0; i < num; ++i) {
+        requests[i].fd = _fd;
+        requests[i].offset = i * 499;
+        requests[i].buffer = Slice(buffers[i].data(), buffers[i].size());
+    }
+    IOUringReader::read(&requests);
+    for (size_t i = 0; i < num; ++i) {
+        ASSERT_TRUE(requests[i].status.ok()) << requests[i].status;
+        ASSERT_EQ(requests[i].bytes_read, 300);
+        EXPECT_EQ(buffers[i], _data.substr(i * 499, 300));
+    }
+}
+
+TEST_F(IOUringReaderTest, ShortReadAndBadFd) {
+    std::string tail(100, '\0');
+    std::string other(10, '\0');
+    std::vector<IOUringReadRequest> requests(2);
+    requests[0].fd = _fd;
+    requests[0].offset = _data.size() - 40;
+    requests[0].buffer = Slice(tail.data(), tail.size());
+    requests[1].fd = -1;
+    requests[1].buffer = Slice(other.data(), other.size());
+    IOUringReader::read(&requests);
+    ASSERT_TRUE(requests[0].status.ok());
+    EXPECT_EQ(requests[0].bytes_read, 40);
+    EXPECT_EQ(tail.substr(0, 40), _data.substr(_data.size() - 40));
+    EXPECT_FALSE(requests[1].status.ok());
+}
+
+} // namespace doris::io
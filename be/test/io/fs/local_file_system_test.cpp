@@ -135,6 +135,45 @@ TEST_F(LocalFileSystemTest, WriteRead) {
     }
 }
 
+TEST_F(LocalFileSystemTest, WriteBesidePageCache) {
+    std::string data;
+    // more than a direct IO buffer, with a tail which isn't a full block
+    for (int i = 0; i < 3 * 1024 * 1024 + 123; ++i) {
+        data.push_back(static_cast<char>(i % 251));
+    }
+    for (auto mode : {io::PageCacheMode::CACHED, io::PageCacheMode::DROP_BEHIND,
+                      io::PageCacheMode::DIRECT}) {
+        auto fname = fmt::format("{}/page_cache_mode_{}", test_dir, static_cast<int>(mode));
+        io::FileWriterOptions opts {.page_cache_mode = mode};
+        io::FileWriterPtr file_writer;
+        auto st = io::global_local_filesystem()->create_file(fname, &file_writer, &opts);
+        ASSERT_TRUE(st.ok()) << st;
+        // appends of odd sizes
+        for (size_t offset = 0; offset < data.size(); offset += 100000) {
+            Slice slice(data.data() + offset, std::min<size_t>(100000, data.size() - offset));
+            st = file_writer->append(slice);
+            ASSERT_TRUE(st.ok()) << st;
+        }
+        st = file_writer->close();
+        ASSERT_TRUE(st.ok()) << st;
+        ASSERT_EQ(file_writer->bytes_appended(), data.size());
+
+        int64_t fsize;
+        st = io::global_local_filesystem()->file_size(fname, &fsize);
+        ASSERT_TRUE(st.ok()) << st;
+        ASSERT_EQ(data.size(), fsize);
+        io::FileReaderSPtr file_reader;
+        st = io::global_local_filesystem()->open_file(fname, &file_reader);
+        ASSERT_TRUE(st.ok()) << st;
+        std::string read(data.size(), '\0');
+        size_t bytes_read = 0;
+        st = file_reader->read_at(0, Slice(read.data(), read.size()), &bytes_read);
+        ASSERT_TRUE(st.ok()) << st;
+        ASSERT_EQ(data.size(), bytes_read);
+        EXPECT_EQ(read, data);
+    }
+}
+
 TEST_F(LocalFileSystemTest, Exist) {
     auto fname = fmt::format("{}/abc", test_dir);
     ASSERT_FALSE(check_exist(fname));
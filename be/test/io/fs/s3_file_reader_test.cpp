@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "io/fs/s3_file_reader.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+#include "io/fs/obj_storage_client.h"
+#include "io/fs/s3_file_system.h"
+#include "runtime/exec_env.h"
+#include "util/threadpool.h"
+
+namespace doris::io {
+
+// Serve the GETs from a string, the first `num_slow_gets` of them take `slow_get_ms`
+class RangeMockObjStorageClient : public ObjStorageClient {
+public:
+    ObjectStorageUploadResponse create_multipart_upload(
+            const ObjectStoragePathOptions& opts) override {
+        return {.resp = ObjectStorageResponse::OK()};
+    }
+    ObjectStorageResponse put_object(const ObjectStoragePathOptions& opts,
+                                     std::string_view stream) override {
+        return ObjectStorageResponse::OK();
+    }
+    ObjectStorageUploadResponse upload_part(const ObjectStoragePathOptions& opts,
+                                            std::string_view stream, int part_num) override {
+        return {.resp = ObjectStorageResponse::OK()};
+    }
+    ObjectStorageResponse complete_multipart_upload(
+            const ObjectStoragePathOptions& opts,
+            const std::vector<ObjectCompleteMultiPart>& completed_parts) override {
+        return ObjectStorageResponse::OK();
+    }
+    ObjectStorageHeadResponse head_object(const ObjectStoragePathOptions& opts) override {
+        return {.resp = ObjectStorageResponse::OK(), .file_size = (int64_t)data.size()};
+    }
+    ObjectStorageResponse get_object(const ObjectStoragePathOptions& opts, void* buffer,
+                                     size_t offset, size_t bytes_read,
+                                     size_t* size_return) override {
+        if (num_gets++ < num_slow_gets) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(slow_get_ms));
+        }
+        {
+            std::lock_guard lock(mtx);
+            ranges.emplace_back(offset, bytes_read);
+        }
+        memcpy(buffer, data.data() + offset, bytes_read);
+        *size_return = bytes_read;
+        return ObjectStorageResponse::OK();
+    }
+    ObjectStorageResponse list_objects(const ObjectStoragePathOptions& opts,
+                                       std::vector<FileInfo>* files) override {
+        return ObjectStorageResponse::OK();
+    }
+    ObjectStorageResponse delete_objects(const ObjectStoragePathOptions& opts,
+                                         std::vector<std::string> objs) override {
+        return ObjectStorageResponse::OK();
+    }
+    ObjectStorageResponse delete_object(const ObjectStoragePathOptions& opts) override {
+        return ObjectStorageResponse::OK();
+    }
+    ObjectStorageResponse delete_objects_recursively(
+            const ObjectStoragePathOptions& opts) override {
+        return ObjectStorageResponse::OK();
+    }
+    std::string generate_presigned_url(const ObjectStoragePathOptions& opts,
+                                       int64_t expiration_secs, const S3ClientConf& conf) override {
+        return "";
+    }
+
+    std::string data;
+    std::atomic<int> num_gets = 0;
+    int num_slow_gets = 0;
+    int slow_get_ms = 0;
+    std::mutex mtx;
+    std::vector<std::pair<size_t, size_t>> ranges;
+};
+
+class S3FileReaderTest : public testing::Test {
+public:
+    static void SetUpTestSuite() {
+        std::unique_ptr<ThreadPool> pool;
+        static_cast<void>(ThreadPoolBuilder("S3FileReadThreadPool")
+                                  .set_min_threads(4)
+                                  .set_max_threads(4)
+                                  .build(&pool));
+        ExecEnv::GetInstance()->_s3_file_read_thread_pool = std::move(pool);
+    }
+
+    static void TearDownTestSuite() { ExecEnv::GetInstance()->_s3_file_read_thread_pool.reset(); }
+
+    void SetUp() override {
+        _client = std::make_shared<RangeMockObjStorageClient>();
+        for (size_t i = 0; i < 10000; ++i) {
+            _client->data.push_back(static_cast<char>('a' + i % 26));
+        }
+        auto holder = std::make_shared<ObjClientHolder>(S3ClientConf {});
+        holder->_client = _client;
+        _reader = std::make_shared<S3FileReader>(holder, "bucket", "key", _client->data.size(),
+                                                 nullptr);
+    }
+
+    void TearDown() override {
+        config::s3_read_split_size = 0;
+        config::s3_hedged_read_percentile = 0;
+    }
+
+protected:
+    std::shared_ptr<RangeMockObjStorageClient> _client;
+    std::shared_ptr<S3FileReader> _reader;
+};
+
+TEST_F(S3FileReaderTest, SplitRead) {
+    config::s3_read_split_size = 1000;
+    std::string buffer(3500, '\0');
+    size_t bytes_read = 0;
+    ASSERT_TRUE(_reader->read_at(100, Slice(buffer.data(), buffer.size()), &bytes_read).ok());
+    EXPECT_EQ(bytes_read, 3500);
+    EXPECT_EQ(buffer, _client->data.substr(100, 3500));
+
+    std::sort(_client->ranges.begin(), _client->ranges.end());
+    std::vector<std::pair<size_t, size_t>> expected = {
+            {100, 1000}, {1100, 1000}, {2100, 1000}, {3100, 500}};
+    EXPECT_EQ(_client->ranges, expected);
+
+    // a read no larger than the split size is one GET
+    _client->ranges.clear();
+    ASSERT_TRUE(_reader->read_at(9000, Slice(buffer.data(), 1000), &bytes_read).ok());
+    EXPECT_EQ(_client->ranges.size(), 1);
+    // the read is cut at the end of the file
+    ASSERT_TRUE(_reader->read_at(8000, Slice(buffer.data(), 3500), &bytes_read).ok());
+    EXPECT_EQ(bytes_read, 2000);
+    EXPECT_EQ(buffer.substr(0, 2000), _client->data.substr(8000, 2000));
+}
+
+TEST_F(S3FileReaderTest, HedgedRead) {
+    config::s3_hedged_read_percentile = 0.9;
+    config::s3_hedged_read_min_delay_ms = 20;
+    _client->num_slow_gets = 1;
+    _client->slow_get_ms = 2000;
+
+    std::string buffer(1000, '\0');
+    size_t bytes_read = 0;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(_reader->read_at(500, Slice(buffer.data(), buffer.size()), &bytes_read).ok());
+    auto cost = std::chrono::steady_clock::now() - start;
+    // the duplicate GET is used without waiting for the slow one
+    EXPECT_LT(cost, std::chrono::milliseconds(1000));
+    EXPECT_EQ(bytes_read, 1000);
+    EXPECT_EQ(buffer, _client->data.substr(500, 1000));
+    EXPECT_EQ(_client->num_gets, 2);
+
+    // no duplicate for a fast GET
+    ASSERT_TRUE(_reader->read_at(0, Slice(buffer.data(), buffer.size()), &bytes_read).ok());
+    EXPECT_EQ(buffer, _client->data.substr(0, 1000));
+    EXPECT_EQ(_client->num_gets, 3);
+}
+
+} // namespace doris::io
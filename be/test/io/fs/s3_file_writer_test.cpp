@@ -1470,4 +1470,54 @@ TEST_F(S3FileWriterTest, write_buffer_boundary) {
     // clang-format on
 }
 
+TEST_F(S3FileWriterTest, grow_part_size) {
+    bool enable_file_cache = config::enable_file_cache;
+    int64_t buffer_size = config::s3_write_buffer_size;
+    int32_t grow_interval = config::s3_write_part_size_grow_interval;
+    int32_t max_concurrency = config::s3_upload_max_concurrency_per_host;
+    config::enable_file_cache = false;
+    config::s3_write_buffer_size = 5 * 1024L * 1024L;
+    config::s3_write_part_size_grow_interval = 2;
+    // the parts are uploaded one by one
+    config::s3_upload_max_concurrency_per_host = 1;
+    Defer defer {[&]() {
+        config::enable_file_cache = enable_file_cache;
+        config::s3_write_buffer_size = buffer_size;
+        config::s3_write_part_size_grow_interval = grow_interval;
+        config::s3_upload_max_concurrency_per_host = max_concurrency;
+    }};
+
+    auto sp = SyncPoint::get_instance();
+    sp->enable_processing();
+    sp->clear_all_call_backs();
+
+    // parts of 5MB, 5MB, 10MB, 10MB, 20MB and 1 byte
+    const size_t MB = 1024 * 1024;
+    std::string content = generate_test_string('g', 50 * MB + 1);
+    auto [mock_client, s3_file_writer] = create_s3_client("grow_part_size.dat");
+    ASSERT_EQ(s3_file_writer->_part_size(1), 5 * MB);
+    ASSERT_EQ(s3_file_writer->_part_size(3), 10 * MB);
+    ASSERT_EQ(s3_file_writer->_part_size(5), 20 * MB);
+    // append in small slices which cross the part boundaries
+    for (size_t pos = 0; pos < content.size(); pos += 3 * MB) {
+        Slice slice(content.data() + pos, std::min(3 * MB, content.size() - pos));
+        ASSERT_EQ(s3_file_writer->append(slice), Status::OK());
+    }
+    ASSERT_EQ(s3_file_writer->close(), Status::OK());
+    EXPECT_EQ(mock_client->create_multipart_count, 1);
+    EXPECT_EQ(mock_client->upload_part_count, 6);
+    EXPECT_EQ(s3_file_writer->completed_parts().size(), 6);
+    std::string expected_path = get_s3_path("grow_part_size.dat");
+    EXPECT_EQ(mock_client->parts[expected_path + "_005"].size(), 20 * MB);
+    EXPECT_EQ(mock_client->objects[expected_path], content);
+
+    // the max part size caps the growth
+    config::s3_write_max_part_size = 8 * MB;
+    Defer defer_max {[&]() { config::s3_write_max_part_size = 5368709120L; }};
+    auto [capped_client, capped_writer] = create_s3_client("grow_part_size_capped.dat");
+    EXPECT_EQ(capped_writer->_part_size(3), 8 * MB);
+    EXPECT_EQ(capped_writer->_part_size(10000), 8 * MB);
+    ASSERT_EQ(capped_writer->close(), Status::OK());
+}
+
 } // namespace doris
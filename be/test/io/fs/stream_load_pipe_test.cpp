@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "io/fs/stream_load_pipe.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+namespace doris::io {
+
+TEST(StreamLoadPipeTest, WritableCallback) {
+    // room for two chunks
+    StreamLoadPipe pipe(128 * 1024, 64 * 1024);
+    std::string chunk(64 * 1024, 'a');
+    int called = 0;
+    auto on_writable = [&called]() { ++called; };
+
+    EXPECT_TRUE(pipe.writable(on_writable));
+    // the first chunk is queued when the second one starts
+    ASSERT_TRUE(pipe.append(chunk.data(), chunk.size()).ok());
+    ASSERT_TRUE(pipe.append(chunk.data(), chunk.size()).ok());
+    EXPECT_TRUE(pipe.writable(on_writable));
+    ASSERT_TRUE(pipe.append(chunk.data(), chunk.size()).ok());
+    EXPECT_FALSE(pipe.writable(on_writable));
+    EXPECT_EQ(called, 0);
+
+    // reading a chunk makes room for the next one
+    std::string result(chunk.size(), '\0');
+    size_t bytes_read = 0;
+    ASSERT_TRUE(pipe.read_at(0, Slice(result.data(), result.size()), &bytes_read).ok());
+    EXPECT_EQ(bytes_read, chunk.size());
+    EXPECT_EQ(called, 1);
+    EXPECT_TRUE(pipe.writable(on_writable));
+
+    // a cancelled pipe does not block the writer
+    ASSERT_TRUE(pipe.append(chunk.data(), chunk.size()).ok());
+    EXPECT_FALSE(pipe.writable(on_writable));
+    pipe.cancel("test");
+    EXPECT_EQ(called, 2);
+    EXPECT_TRUE(pipe.writable(on_writable));
+}
+
+} // namespace doris::io
@@ -27,6 +27,7 @@
 #include "gtest/gtest_pred_impl.h"
 #include "olap/column_predicate.h"
 #include "olap/comparison_predicate.h"
+#include "olap/rowset/segment_v2/bloom_filter.h"
 #include "olap/tablet_schema.h"
 #include "runtime/define_primitive_type.h"
 #include "vec/columns/predicate_column.h"
@@ -284,4 +285,37 @@ TEST_F(BlockColumnPredicateTest, AND_OR_MUTI_COLUMN_VEC) {
     EXPECT_EQ(pred_col->get_data()[sel_idx[0]], 4);
 }
 
+TEST_F(BlockColumnPredicateTest, AND_BLOOM_FILTER) {
+    std::unique_ptr<segment_v2::BloomFilter> bf;
+    ASSERT_TRUE(segment_v2::BloomFilter::create(segment_v2::BLOCK_BLOOM_FILTER, &bf).ok());
+    ASSERT_TRUE(bf->init(1024, 0.05, segment_v2::HASH_MURMUR3_X64_64).ok());
+    int value = 5;
+    bf->add_bytes(reinterpret_cast<const char*>(&value), sizeof(value));
+
+    int col_idx = 0;
+    std::unique_ptr<ColumnPredicate> eq_pred(
+            new ComparisonPredicateBase<TYPE_INT, PredicateType::EQ>(col_idx, 7));
+    std::unique_ptr<ColumnPredicate> less_pred(
+            new ComparisonPredicateBase<TYPE_INT, PredicateType::LT>(col_idx, 10));
+
+    AndBlockColumnPredicate only_range;
+    only_range.add_column_predicate(SingleColumnBlockPredicate::create_unique(less_pred.get()));
+    EXPECT_FALSE(only_range.can_do_bloom_filter(false));
+
+    // the range conjunct can't use the bloom filter, the page is pruned by the equal one
+    AndBlockColumnPredicate mixed;
+    mixed.add_column_predicate(SingleColumnBlockPredicate::create_unique(less_pred.get()));
+    mixed.add_column_predicate(SingleColumnBlockPredicate::create_unique(eq_pred.get()));
+    EXPECT_TRUE(mixed.can_do_bloom_filter(false));
+    EXPECT_FALSE(mixed.can_do_bloom_filter(true));
+    EXPECT_FALSE(mixed.evaluate_and(bf.get()));
+
+    std::unique_ptr<ColumnPredicate> hit_pred(
+            new ComparisonPredicateBase<TYPE_INT, PredicateType::EQ>(col_idx, value));
+    AndBlockColumnPredicate hit;
+    hit.add_column_predicate(SingleColumnBlockPredicate::create_unique(less_pred.get()));
+    hit.add_column_predicate(SingleColumnBlockPredicate::create_unique(hit_pred.get()));
+    EXPECT_TRUE(hit.evaluate_and(bf.get()));
+}
+
 } // namespace doris
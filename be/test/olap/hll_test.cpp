@@ -20,6 +20,8 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <vector>
+
 #include "gtest/gtest_pred_impl.h"
 #include "util/hash_util.hpp"
 #include "util/slice.h"
@@ -194,6 +196,42 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, MergeBatch) {
+    // explicit, sparse and full values
+    std::vector<HyperLogLog> hlls(8);
+    for (size_t i = 0; i < hlls.size(); ++i) {
+        int num = i % 3 == 0 ? 50 : (i % 3 == 1 ? 1000 : 64 * 1024);
+        for (int j = 0; j < num; ++j) {
+            hlls[i].update(hash(i * 100000 + j));
+        }
+    }
+    {
+        HyperLogLog batch_hll;
+        batch_hll.merge_batch(hlls.data(), hlls.size());
+        HyperLogLog hll;
+        for (const auto& other : hlls) {
+            hll.merge(other);
+        }
+        EXPECT_EQ(hll.estimate_cardinality(), batch_hll.estimate_cardinality());
+    }
+    // only explicit values stay explicit
+    {
+        HyperLogLog batch_hll;
+        batch_hll.merge_batch(hlls.data(), 1);
+        batch_hll.merge_batch(&hlls[3], 1);
+        EXPECT_EQ(100, batch_hll.estimate_cardinality());
+    }
+    // explicit value merged with registers
+    {
+        HyperLogLog batch_hll = hlls[0];
+        batch_hll.merge_batch(&hlls[1], 2);
+        HyperLogLog hll = hlls[0];
+        hll.merge(hlls[1]);
+        hll.merge(hlls[2]);
+        EXPECT_EQ(hll.estimate_cardinality(), batch_hll.estimate_cardinality());
+    }
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
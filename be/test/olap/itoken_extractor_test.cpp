@@ -21,10 +21,13 @@
 #include <gtest/gtest-test-part.h>
 
 #include <algorithm>
+#include <cstring>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "gtest/gtest_pred_impl.h"
+#include "olap/rowset/segment_v2/ngram_bloom_filter.h"
 #include "util/utf8_check.h"
 
 namespace doris {
@@ -93,6 +96,75 @@ TEST_F(TestITokenExtractor, ngram_like_extractor) {
                         {from_u8string(u8"_手"), from_u8string(u8"手机")});
 }
 
+void runExtractRegexpLiterals(const std::string& pattern, std::vector<std::string> expect) {
+    std::vector<std::string> actual;
+    extract_regexp_literals(pattern.data(), pattern.size(), &actual);
+    ASSERT_EQ(expect, actual) << pattern;
+}
+
+TEST_F(TestITokenExtractor, regexp_literals) {
+    runExtractRegexpLiterals("error code 5\\d\\d", {"error code 5"});
+    runExtractRegexpLiterals("^GET /api/v[0-9]+/users$", {"GET /api/v", "/users"});
+    runExtractRegexpLiterals("colou?r", {"colo", "r"});
+    runExtractRegexpLiterals("ab+c*d", {"ab", "d"});
+    runExtractRegexpLiterals("a.b{2,3}\\.com", {"a", ".com"});
+    runExtractRegexpLiterals("time(out)?s", {"time", "s"});
+    runExtractRegexpLiterals("x(a(b)c|d)+y", {"x", "y"});
+    runExtractRegexpLiterals(from_u8string(u8"手机?号"),
+                             {from_u8string(u8"手"), from_u8string(u8"号")});
+    // nothing is required by every match, or the pattern is not understood
+    runExtractRegexpLiterals("foo|bar", {});
+    runExtractRegexpLiterals("(?i)error", {});
+    runExtractRegexpLiterals("\\x41bc", {});
+    runExtractRegexpLiterals("(abc", {});
+    runExtractRegexpLiterals(".*", {});
+}
+
+TEST_F(TestITokenExtractor, ngram_bloom_filter) {
+    NgramTokenExtractor ngram_extractor(3);
+    auto make_bf = []() {
+        std::unique_ptr<segment_v2::BloomFilter> bf;
+        EXPECT_TRUE(segment_v2::BloomFilter::create(segment_v2::NGRAM_BLOOM_FILTER, &bf, 256).ok());
+        return bf;
+    };
+
+    // the ASCII fast path adds the same ngrams as the generic one
+    std::string ascii = "GET /index.html 500 error code 503";
+    auto fast = make_bf();
+    ngram_extractor.string_to_bloom_filter(ascii.data(), ascii.size(), *fast);
+    auto generic = make_bf();
+    size_t pos = 0;
+    size_t token_start = 0;
+    size_t token_length = 0;
+    while (ngram_extractor.next_in_string(ascii.data(), ascii.size(), &pos, &token_start,
+                                          &token_length)) {
+        generic->add_bytes(ascii.data() + token_start, token_length);
+    }
+    EXPECT_EQ(0, memcmp(fast->data(), generic->data(), fast->size()));
+
+    auto like = make_bf();
+    std::string like_pattern = "%error code 5%";
+    ASSERT_TRUE(ngram_extractor.string_like_to_bloom_filter(like_pattern.data(),
+                                                             like_pattern.size(), *like));
+    EXPECT_TRUE(fast->contains(*like));
+
+    auto regexp = make_bf();
+    std::string regexp_pattern = "error code 5\\d\\d";
+    ASSERT_TRUE(ngram_extractor.string_regexp_to_bloom_filter(regexp_pattern.data(),
+                                                               regexp_pattern.size(), *regexp));
+    EXPECT_TRUE(fast->contains(*regexp));
+
+    auto miss = make_bf();
+    regexp_pattern = "warning [0-9]+";
+    ASSERT_TRUE(ngram_extractor.string_regexp_to_bloom_filter(regexp_pattern.data(),
+                                                               regexp_pattern.size(), *miss));
+    EXPECT_FALSE(fast->contains(*miss));
+
+    regexp_pattern = "a|b";
+    EXPECT_FALSE(ngram_extractor.string_regexp_to_bloom_filter(regexp_pattern.data(),
+                                                                regexp_pattern.size(), *make_bf()));
+}
+
 TEST_F(TestITokenExtractor, ngram_extractor_empty_input) {
     // Test empty string input, expect no output
     std::string statement = "";
@@ -26,6 +26,7 @@
 
 #include "gtest/gtest.h"
 #include "gtest/gtest_pred_impl.h"
+#include "runtime/memory/cache_manager.h"
 #include "runtime/memory/lru_cache_policy.h"
 #include "runtime/memory/lru_cache_value_base.h"
 #include "runtime/memory/mem_tracker_limiter.h"
@@ -399,6 +400,51 @@ TEST_F(CacheTest, UsageLRUK) {
     ASSERT_EQ(896, cache.get_usage());
 }
 
+TEST_F(CacheTest, TinyLFUAdmission) {
+    LRUCache cache(LRUCacheType::NUMBER, false, true);
+    cache.set_capacity(10);
+    auto lookup = [&](int k) {
+        std::string buf;
+        CacheKey key = EncodeKey(&buf, k);
+        auto* handle = cache.lookup(key, key.hash(key.data(), key.size(), 0));
+        cache.release(handle);
+        return handle != nullptr;
+    };
+    auto insert = [&](int k) {
+        std::string buf;
+        insert_number_LRUCache(cache, EncodeKey(&buf, k), k, 1, CachePriority::NORMAL);
+    };
+
+    // the hot entries are looked up several times
+    for (int k = 0; k < 10; ++k) {
+        EXPECT_FALSE(lookup(k));
+        insert(k);
+    }
+    for (int round = 0; round < 3; ++round) {
+        for (int k = 0; k < 10; ++k) {
+            EXPECT_TRUE(lookup(k));
+        }
+    }
+    EXPECT_EQ(10, cache.get_usage());
+
+    // a scan looks up every entry once, it does not flush the hot entries
+    for (int k = 100; k < 200; ++k) {
+        EXPECT_FALSE(lookup(k));
+        insert(k);
+    }
+    for (int k = 0; k < 10; ++k) {
+        EXPECT_TRUE(lookup(k));
+    }
+
+    // an entry looked up more often than the least recently used one is admitted
+    for (int i = 0; i < 12; ++i) {
+        EXPECT_FALSE(lookup(1000));
+    }
+    insert(1000);
+    EXPECT_TRUE(lookup(1000));
+    EXPECT_EQ(10, cache.get_usage());
+}
+
 TEST_F(CacheTest, Prune) {
     LRUCache cache(LRUCacheType::NUMBER);
     cache.set_capacity(5);
@@ -800,4 +846,62 @@ TEST_F(CacheTest, SetCapacity) {
     ASSERT_EQ(0, cache()->get_usage());
 }
 
+TEST_F(CacheTest, ArbitratedCapacity) {
+    init_number_cache();
+    cache()->adjust_capacity_weighted(0.5);
+    ASSERT_EQ(kCacheSize / 2, cache()->get_capacity());
+    // the capacity shrunk by memory pressure is still applied
+    cache()->set_arbitrated_weighted(2);
+    ASSERT_EQ(kCacheSize, cache()->get_capacity());
+    cache()->adjust_capacity_weighted(1);
+    ASSERT_EQ(kCacheSize * 2, cache()->get_capacity());
+    EXPECT_EQ(2, cache()->arbitrated_weighted());
+
+    Insert(1, 1001, 1);
+    EXPECT_EQ(1001, Lookup(1));
+    EXPECT_EQ(-1, Lookup(2));
+    EXPECT_EQ(2, cache()->get_lookup_count());
+    EXPECT_EQ(1, cache()->get_hit_count());
+}
+
+TEST_F(CacheTest, ArbitrateCapacity) {
+    constexpr size_t MB = 1024 * 1024;
+    std::vector<CacheManager::CacheUtility> caches(3);
+    caches[0].type = CachePolicy::CacheType::DATA_PAGE_CACHE;
+    caches[0].initial_capacity = 1000 * MB;
+    caches[0].lookups = 10000;
+    caches[0].hits = 1000;
+    caches[1].type = CachePolicy::CacheType::SEGMENT_CACHE;
+    caches[1].initial_capacity = 100 * MB;
+    caches[1].lookups = 10000;
+    caches[1].hits = 5000;
+    caches[1].full = true;
+    caches[2].type = CachePolicy::CacheType::QUERY_CACHE;
+    caches[2].initial_capacity = 100 * MB;
+
+    // the idle query cache gives its capacity first, 5% of the total each round
+    ASSERT_TRUE(CacheManager::arbitrate_capacity(&caches, 4));
+    EXPECT_DOUBLE_EQ(caches[2].arbitrated_weighted, 0.4);
+    EXPECT_DOUBLE_EQ(caches[1].arbitrated_weighted, 1.6);
+    EXPECT_DOUBLE_EQ(caches[0].arbitrated_weighted, 1);
+
+    ASSERT_TRUE(CacheManager::arbitrate_capacity(&caches, 4));
+    EXPECT_DOUBLE_EQ(caches[2].arbitrated_weighted, 0.25);
+    EXPECT_DOUBLE_EQ(caches[1].arbitrated_weighted, 1.75);
+
+    // then the page cache with less hits per MB, until the segment cache reaches the max
+    for (int i = 0; i < 10; ++i) {
+        CacheManager::arbitrate_capacity(&caches, 4);
+    }
+    EXPECT_NEAR(caches[1].arbitrated_weighted, 4, 1e-9);
+    EXPECT_NEAR(caches[0].arbitrated_weighted, 1 - 0.225, 1e-9);
+    EXPECT_FALSE(CacheManager::arbitrate_capacity(&caches, 4));
+
+    // no capacity is added to a cache which is not full
+    caches[1].full = false;
+    caches[1].arbitrated_weighted = 1;
+    EXPECT_FALSE(CacheManager::arbitrate_capacity(&caches, 4));
+    EXPECT_FALSE(CacheManager::arbitrate_capacity(&caches, 1));
+}
+
 } // namespace doris
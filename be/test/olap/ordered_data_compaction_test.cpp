@@ -621,5 +621,56 @@ TEST_F(OrderedDataCompactionTest, test_index_disk_size) {
               << std::endl;
     EXPECT_EQ(out_rowset->rowset_meta()->total_disk_size(), expected_total_size);
 }
+
+TEST_F(OrderedDataCompactionTest, test_overlapping_flag_with_sorted_segments) {
+    // the segments of a load are marked overlapping, but they are sorted, and the first key of
+    // every segment is the last key of the previous one
+    auto num_input_rowset = 3;
+    auto num_segments = 2;
+    auto rows_per_segment = 50;
+    std::vector<std::vector<std::vector<std::tuple<int64_t, int64_t>>>> input_data;
+    int64_t key = 0;
+    for (auto i = 0; i < num_input_rowset; i++) {
+        std::vector<std::vector<std::tuple<int64_t, int64_t>>> rowset_data;
+        for (auto j = 0; j < num_segments; j++) {
+            std::vector<std::tuple<int64_t, int64_t>> segment_data;
+            for (auto n = 0; n < rows_per_segment; n++) {
+                segment_data.emplace_back(key, n);
+                if (n + 1 < rows_per_segment) {
+                    ++key;
+                }
+            }
+            rowset_data.emplace_back(segment_data);
+        }
+        input_data.emplace_back(rowset_data);
+    }
+
+    TabletSchemaSPtr tablet_schema = create_schema();
+    TabletSharedPtr tablet = create_tablet(*tablet_schema, false, 10000, false);
+    EXPECT_TRUE(io::global_local_filesystem()->create_directory(tablet->tablet_path()).ok());
+    std::vector<RowsetSharedPtr> input_rowsets;
+    for (auto i = 0; i < num_input_rowset; i++) {
+        input_rowsets.push_back(create_rowset(tablet_schema, tablet, OVERLAPPING, input_data[i]));
+    }
+    CumulativeCompaction cu_compaction(*engine_ref, tablet);
+    cu_compaction._input_rowsets = input_rowsets;
+    EXPECT_EQ(cu_compaction.handle_ordered_data_compaction(), true);
+    auto& out_rowset = cu_compaction._output_rowset;
+    EXPECT_EQ(out_rowset->rowset_meta()->num_rows(),
+              num_input_rowset * num_segments * rows_per_segment);
+    EXPECT_EQ(out_rowset->num_segments(), num_input_rowset * num_segments);
+    EXPECT_EQ(out_rowset->rowset_meta()->segments_overlap(), NONOVERLAPPING);
+
+    // the segments of the first rowset overlap, the rows have to be merged
+    std::swap(input_data[0][0], input_data[0][1]);
+    std::vector<RowsetSharedPtr> overlapping_rowsets;
+    for (auto i = 0; i < num_input_rowset; i++) {
+        overlapping_rowsets.push_back(
+                create_rowset(tablet_schema, tablet, OVERLAPPING, input_data[i]));
+    }
+    CumulativeCompaction overlapping_compaction(*engine_ref, tablet);
+    overlapping_compaction._input_rowsets = std::move(overlapping_rowsets);
+    EXPECT_EQ(overlapping_compaction.handle_ordered_data_compaction(), false);
+}
 } // namespace vectorized
 } // namespace doris
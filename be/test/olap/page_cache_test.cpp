@@ -286,4 +286,43 @@ TEST_F(StoragePageCacheTest, mixed_pages) {
     }
 }
 
+// A quarter of the data page cache keeps compressed data pages
+TEST_F(StoragePageCacheTest, compressed_data_page) {
+    StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards, 25);
+    EXPECT_FALSE(StoragePageCache(kNumShards * 2048, 0, 0, kNumShards).has_compressed_page_cache());
+    ASSERT_TRUE(cache.has_compressed_page_cache());
+
+    StoragePageCache::CacheKey key("abc", 0, 0);
+    segment_v2::PageTypePB page_type = segment_v2::DATA_PAGE;
+    {
+        PageCacheHandle handle;
+        int32_t hits = 0;
+        EXPECT_FALSE(cache.lookup_compressed(key, &handle, &hits));
+        auto* data = new CompressedDataPage(256, cache.compressed_mem_tracker());
+        cache.insert_compressed(key, data, &handle);
+        EXPECT_EQ(handle.data().data, data->data());
+    }
+
+    for (int32_t i = 1; i <= 3; ++i) {
+        PageCacheHandle handle;
+        int32_t hits = 0;
+        EXPECT_TRUE(cache.lookup_compressed(key, &handle, &hits));
+        EXPECT_EQ(hits, i);
+    }
+
+    // the two tiers don't share entries
+    {
+        PageCacheHandle handle;
+        EXPECT_FALSE(cache.lookup(key, &handle, page_type));
+        auto* data = new DataPage(1024, true, page_type);
+        cache.insert(key, data, &handle, page_type, false);
+        EXPECT_TRUE(cache.lookup(key, &handle, page_type));
+        EXPECT_EQ(handle.data().data, data->data());
+
+        int32_t hits = 0;
+        EXPECT_TRUE(cache.lookup_compressed(key, &handle, &hits));
+        EXPECT_EQ(hits, 4);
+    }
+}
+
 } // namespace doris
@@ -32,6 +32,7 @@
 #include "gtest/gtest_pred_impl.h"
 #include "olap/olap_common.h"
 #include "olap/olap_meta.h"
+#include "olap/tablet_schema.h"
 
 using ::testing::_;
 using ::testing::Return;
@@ -114,6 +115,36 @@ TEST_F(RowsetMetaTest, TestInitWithInvalidData) {
     EXPECT_FALSE(rowset_meta.init("invalid pb meta data"));
 }
 
+TEST_F(RowsetMetaTest, TestShareTabletSchema) {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_schema_version(3);
+    auto* column = schema_pb.add_column();
+    column->set_unique_id(0);
+    column->set_name("k1");
+    column->set_type("INT");
+    column->set_is_key(true);
+    column->set_is_nullable(false);
+
+    RowsetMeta rowset_meta;
+    rowset_meta.set_tablet_schema(schema_pb);
+    ASSERT_NE(rowset_meta.tablet_schema(), nullptr);
+
+    auto shared_rowset_meta = std::make_unique<RowsetMeta>();
+    shared_rowset_meta->share_tablet_schema(rowset_meta);
+    EXPECT_EQ(shared_rowset_meta->tablet_schema(), rowset_meta.tablet_schema());
+    EXPECT_EQ(shared_rowset_meta->_handle, rowset_meta._handle);
+    EXPECT_EQ(shared_rowset_meta->tablet_schema()->schema_version(), 3);
+
+    // the shared schema outlives the rowset meta it's shared from
+    TabletSchemaSPtr schema = rowset_meta.tablet_schema();
+    RowsetMeta another_rowset_meta;
+    another_rowset_meta.share_tablet_schema(*shared_rowset_meta);
+    shared_rowset_meta.reset();
+    EXPECT_EQ(another_rowset_meta.tablet_schema(), schema);
+    EXPECT_EQ(another_rowset_meta.tablet_schema()->num_columns(), 1);
+}
+
 TEST_F(RowsetMetaTest, TestRowsetIdInit) {
     RowsetId id {};
     config::force_regenerate_rowsetid_on_start_error = true;
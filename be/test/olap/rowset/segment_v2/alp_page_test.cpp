@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/alp_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::segment_v2 {
+
+class AlpPageTest : public testing::Test {
+public:
+    template <FieldType Type>
+    OwnedSlice encode(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        PageBuilder* builder = nullptr;
+        EXPECT_TRUE(AlpPageBuilder<Type>::create(&builder, options).ok());
+        std::unique_ptr<PageBuilder> builder_ptr(builder);
+        size_t count = values.size();
+        EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(values.data()), &count).ok());
+        EXPECT_EQ(count, values.size());
+        OwnedSlice slice;
+        EXPECT_TRUE(builder->finish(&slice).ok());
+        if (!values.empty()) {
+            typename TypeTraits<Type>::CppType value;
+            EXPECT_TRUE(builder->get_first_value(&value).ok());
+            EXPECT_EQ(memcmp(&value, &values.front(), sizeof(value)), 0);
+            EXPECT_TRUE(builder->get_last_value(&value).ok());
+            EXPECT_EQ(memcmp(&value, &values.back(), sizeof(value)), 0);
+        }
+        return slice;
+    }
+
+    template <FieldType Type, typename ColumnType>
+    void check_round_trip(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        OwnedSlice slice = encode<Type>(values);
+        PageDecoderOptions options;
+        AlpPageDecoder<Type> decoder(slice.slice(), options);
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(decoder.count(), values.size());
+
+        vectorized::MutableColumnPtr column = ColumnType::create();
+        size_t n = values.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+        ASSERT_EQ(n, values.size());
+        const auto& data = assert_cast<const ColumnType&>(*column).get_data();
+        ASSERT_EQ(memcmp(data.data(), values.data(), values.size() * sizeof(CppType)), 0);
+        if (values.empty()) {
+            return;
+        }
+
+        std::vector<rowid_t> rowids;
+        for (rowid_t i = 0; i < values.size(); i += 7) {
+            rowids.push_back(i + 100);
+        }
+        column = ColumnType::create();
+        n = rowids.size();
+        ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), 100, &n, column).ok());
+        ASSERT_EQ(n, rowids.size());
+        const auto& read = assert_cast<const ColumnType&>(*column).get_data();
+        for (size_t i = 0; i < rowids.size(); ++i) {
+            ASSERT_EQ(memcmp(&read[i], &values[rowids[i] - 100], sizeof(CppType)), 0);
+        }
+
+        size_t pos = values.size() / 2;
+        ASSERT_TRUE(decoder.seek_to_position_in_page(pos).ok());
+        column = ColumnType::create();
+        n = 1;
+        ASSERT_TRUE(decoder.peek_next_batch(&n, column).ok());
+        EXPECT_EQ(decoder.current_index(), pos);
+        EXPECT_EQ(memcmp(&assert_cast<const ColumnType&>(*column).get_data()[0], &values[pos],
+                         sizeof(CppType)),
+                  0);
+    }
+};
+
+TEST_F(AlpPageTest, DecimalDoubles) {
+    std::mt19937_64 rng(42);
+    std::vector<double> values;
+    for (size_t i = 0; i < 5000; ++i) {
+        // sensor like readings with two decimals
+        values.push_back(static_cast<double>(static_cast<int64_t>(rng() % 100000) - 50000) / 100);
+    }
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>(values);
+    // 17 bits for a value instead of 64
+    EXPECT_LT(encode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(values).slice().size,
+              values.size() * sizeof(double) / 3);
+}
+
+TEST_F(AlpPageTest, Exceptions) {
+    std::vector<double> values;
+    for (size_t i = 0; i < 3000; ++i) {
+        values.push_back(static_cast<double>(i) * 0.5);
+    }
+    values[3] = std::numeric_limits<double>::quiet_NaN();
+    values[10] = std::numeric_limits<double>::infinity();
+    values[11] = -std::numeric_limits<double>::infinity();
+    values[12] = -0.0;
+    values[13] = 1e300;
+    values[1500] = std::numeric_limits<double>::denorm_min();
+    values[2999] = 3.141592653589793;
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>(values);
+}
+
+TEST_F(AlpPageTest, RandomDoubles) {
+    // the values don't fit ALP, the vectors are stored raw
+    std::mt19937_64 rng(7);
+    std::vector<double> values;
+    for (size_t i = 0; i < 2500; ++i) {
+        uint64_t bits = rng();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        values.push_back(value);
+    }
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>(values);
+    EXPECT_LE(encode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(values).slice().size,
+              ALP_PAGE_HEADER_SIZE + values.size() * sizeof(double) +
+                      3 * ALP_VECTOR_HEADER_SIZE);
+}
+
+TEST_F(AlpPageTest, Floats) {
+    std::vector<float> values;
+    for (size_t i = 0; i < 4100; ++i) {
+        values.push_back(static_cast<float>(static_cast<int32_t>(i % 901) - 450) / 10);
+    }
+    values[17] = std::numeric_limits<float>::quiet_NaN();
+    values[4099] = 1e30F;
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_FLOAT, vectorized::ColumnFloat32>(values);
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_FLOAT, vectorized::ColumnFloat32>({});
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_FLOAT, vectorized::ColumnFloat32>({1.5F});
+}
+
+TEST_F(AlpPageTest, Corruption) {
+    std::vector<double> values(100, 1.25);
+    OwnedSlice slice = encode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(values);
+    PageDecoderOptions options;
+    Slice truncated(slice.slice().data, slice.slice().size - 1);
+    AlpPageDecoder<FieldType::OLAP_FIELD_TYPE_DOUBLE> decoder(truncated, options);
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace doris::segment_v2
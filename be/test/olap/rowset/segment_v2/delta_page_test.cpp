@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/delta_page.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::segment_v2 {
+
+class DeltaPageTest : public testing::Test {
+public:
+    template <FieldType Type, int ORDER>
+    OwnedSlice encode(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        PageBuilder* builder = nullptr;
+        EXPECT_TRUE((DeltaPageBuilder<Type, ORDER>::create(&builder, options).ok()));
+        std::unique_ptr<PageBuilder> builder_ptr(builder);
+        size_t count = values.size();
+        EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(values.data()), &count).ok());
+        EXPECT_EQ(count, values.size());
+        OwnedSlice slice;
+        EXPECT_TRUE(builder->finish(&slice).ok());
+        if (!values.empty()) {
+            typename TypeTraits<Type>::CppType value;
+            EXPECT_TRUE(builder->get_first_value(&value).ok());
+            EXPECT_EQ(value, values.front());
+            EXPECT_TRUE(builder->get_last_value(&value).ok());
+            EXPECT_EQ(value, values.back());
+        }
+        return slice;
+    }
+
+    template <FieldType Type, int ORDER, typename ColumnType>
+    void check_round_trip(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        OwnedSlice slice = encode<Type, ORDER>(values);
+        PageDecoderOptions options;
+        DeltaPageDecoder<Type, ORDER> decoder(slice.slice(), options);
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(decoder.count(), values.size());
+
+        vectorized::MutableColumnPtr column = ColumnType::create();
+        size_t n = values.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+        ASSERT_EQ(n, values.size());
+        const auto& data = assert_cast<const ColumnType&>(*column).get_data();
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(data[i], values[i]) << i;
+        }
+        if (values.empty()) {
+            return;
+        }
+
+        std::vector<rowid_t> rowids;
+        for (rowid_t i = 0; i < values.size(); i += 11) {
+            rowids.push_back(i + 100);
+        }
+        column = ColumnType::create();
+        n = rowids.size();
+        ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), 100, &n, column).ok());
+        ASSERT_EQ(n, rowids.size());
+        const auto& read = assert_cast<const ColumnType&>(*column).get_data();
+        for (size_t i = 0; i < rowids.size(); ++i) {
+            ASSERT_EQ(read[i], values[rowids[i] - 100]);
+        }
+
+        // seek into the middle of a block and read across the following ones
+        size_t pos = values.size() / 3;
+        ASSERT_TRUE(decoder.seek_to_position_in_page(pos).ok());
+        column = ColumnType::create();
+        n = 1;
+        ASSERT_TRUE(decoder.peek_next_batch(&n, column).ok());
+        EXPECT_EQ(decoder.current_index(), pos);
+        n = values.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+        ASSERT_EQ(n, values.size() - pos);
+        const auto& tail = assert_cast<const ColumnType&>(*column).get_data();
+        EXPECT_EQ(tail[0], values[pos]);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(tail[i + 1], values[pos + i]);
+        }
+    }
+};
+
+TEST_F(DeltaPageTest, AutoIncrement) {
+    std::vector<int64_t> values;
+    for (int64_t i = 0; i < 10000; ++i) {
+        values.push_back(1000000000000 + i);
+    }
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_BIGINT, 1, vectorized::ColumnInt64>(values);
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_BIGINT, 2, vectorized::ColumnInt64>(values);
+    // only the block headers are left
+    EXPECT_LT((encode<FieldType::OLAP_FIELD_TYPE_BIGINT, 1>(values).slice().size),
+              values.size() * sizeof(int64_t) / 20);
+}
+
+TEST_F(DeltaPageTest, Timestamps) {
+    std::mt19937_64 rng(42);
+    std::vector<int64_t> values;
+    int64_t ts = 1700000000000;
+    for (size_t i = 0; i < 5000; ++i) {
+        // a sample each second, with a jitter of some milliseconds
+        ts += 1000 + static_cast<int64_t>(rng() % 16) - 8;
+        values.push_back(ts);
+    }
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_BIGINT, 2, vectorized::ColumnInt64>(values);
+    EXPECT_LT((encode<FieldType::OLAP_FIELD_TYPE_BIGINT, 2>(values).slice().size),
+              values.size() * sizeof(int64_t) / 8);
+}
+
+TEST_F(DeltaPageTest, Ints) {
+    std::mt19937 rng(7);
+    std::vector<int32_t> values;
+    for (size_t i = 0; i < 3000; ++i) {
+        values.push_back(static_cast<int32_t>(rng()));
+    }
+    values[1] = std::numeric_limits<int32_t>::min();
+    values[2] = std::numeric_limits<int32_t>::max();
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_INT, 1, vectorized::ColumnInt32>(values);
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_INT, 2, vectorized::ColumnInt32>(values);
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_INT, 2, vectorized::ColumnInt32>({});
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_INT, 2, vectorized::ColumnInt32>({5});
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_INT, 2, vectorized::ColumnInt32>({5, -5});
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_INT, 2, vectorized::ColumnInt32>({5, -5, 7});
+}
+
+TEST_F(DeltaPageTest, WrappingBigints) {
+    std::vector<int64_t> values = {std::numeric_limits<int64_t>::min(),
+                                   std::numeric_limits<int64_t>::max(), 0, -1,
+                                   std::numeric_limits<int64_t>::max()};
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_BIGINT, 1, vectorized::ColumnInt64>(values);
+    check_round_trip<FieldType::OLAP_FIELD_TYPE_BIGINT, 2, vectorized::ColumnInt64>(values);
+}
+
+TEST_F(DeltaPageTest, Corruption) {
+    std::vector<int32_t> values(1000, 3);
+    OwnedSlice slice = encode<FieldType::OLAP_FIELD_TYPE_INT, 1>(values);
+    PageDecoderOptions options;
+    Slice truncated(slice.slice().data, 20);
+    DeltaPageDecoder<FieldType::OLAP_FIELD_TYPE_INT, 1> decoder(truncated, options);
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace doris::segment_v2
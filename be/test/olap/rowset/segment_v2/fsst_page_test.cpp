@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/fsst_page.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/column_string.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::segment_v2 {
+
+class FsstPageTest : public testing::Test {
+public:
+    OwnedSlice encode(const std::vector<std::string>& values) {
+        std::vector<Slice> slices;
+        size_t raw_size = 0;
+        for (const auto& value : values) {
+            slices.emplace_back(value);
+            raw_size += value.size();
+        }
+        PageBuilderOptions options;
+        options.data_page_size = 1024 * 1024;
+        PageBuilder* builder = nullptr;
+        EXPECT_TRUE(FsstPageBuilder::create(&builder, options).ok());
+        std::unique_ptr<PageBuilder> builder_ptr(builder);
+        size_t count = slices.size();
+        EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(slices.data()), &count).ok());
+        EXPECT_EQ(count, values.size());
+        OwnedSlice slice;
+        EXPECT_TRUE(builder->finish(&slice).ok());
+        if (!values.empty()) {
+            Slice value;
+            EXPECT_TRUE(builder->get_first_value(&value).ok());
+            EXPECT_EQ(value.to_string(), values.front());
+            EXPECT_TRUE(builder->get_last_value(&value).ok());
+            EXPECT_EQ(value.to_string(), values.back());
+        }
+        // never larger than the plain strings and the offsets
+        EXPECT_LE(slice.slice().size, 1 + raw_size + (values.size() + 2) * sizeof(uint32_t));
+        return slice;
+    }
+
+    void check_round_trip(const std::vector<std::string>& values) {
+        OwnedSlice slice = encode(values);
+        PageDecoderOptions options;
+        FsstPageDecoder decoder(slice.slice(), options);
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(decoder.count(), values.size());
+
+        vectorized::MutableColumnPtr column = vectorized::ColumnString::create();
+        size_t n = values.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+        ASSERT_EQ(n, values.size());
+        const auto& strings = assert_cast<const vectorized::ColumnString&>(*column);
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(strings.get_data_at(i).to_string(), values[i]);
+        }
+        if (values.empty()) {
+            return;
+        }
+
+        std::vector<rowid_t> rowids;
+        for (rowid_t i = 0; i < values.size(); i += 3) {
+            rowids.push_back(i + 10);
+        }
+        column = vectorized::ColumnString::create();
+        n = rowids.size();
+        ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), 10, &n, column).ok());
+        ASSERT_EQ(n, rowids.size());
+        const auto& read = assert_cast<const vectorized::ColumnString&>(*column);
+        for (size_t i = 0; i < rowids.size(); ++i) {
+            ASSERT_EQ(read.get_data_at(i).to_string(), values[rowids[i] - 10]);
+        }
+
+        size_t pos = values.size() / 2;
+        ASSERT_TRUE(decoder.seek_to_position_in_page(pos).ok());
+        column = vectorized::ColumnString::create();
+        n = values.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+        ASSERT_EQ(n, values.size() - pos);
+        EXPECT_EQ(column->get_data_at(0).to_string(), values[pos]);
+        EXPECT_EQ(decoder.current_index(), values.size());
+    }
+};
+
+TEST_F(FsstPageTest, Urls) {
+    std::mt19937 rng(42);
+    const std::vector<std::string> hosts = {"www.example.com", "api.example.org",
+                                            "static.cdn.example.net"};
+    const std::vector<std::string> paths = {"/index.html", "/search?q=", "/user/profile/",
+                                            "/static/js/app."};
+    std::vector<std::string> values;
+    size_t raw_size = 0;
+    for (size_t i = 0; i < 3000; ++i) {
+        values.push_back("https://" + hosts[rng() % hosts.size()] + paths[rng() % paths.size()] +
+                         std::to_string(rng() % 100000));
+        raw_size += values.back().size();
+    }
+    check_round_trip(values);
+    // the symbols cover the repeated parts of the urls
+    EXPECT_LT(encode(values).slice().size, raw_size / 2);
+}
+
+TEST_F(FsstPageTest, RandomBytes) {
+    // FSST doesn't help, the strings are kept as they are
+    std::mt19937 rng(7);
+    std::vector<std::string> values;
+    for (size_t i = 0; i < 1000; ++i) {
+        std::string value(rng() % 40, '\0');
+        for (auto& c : value) {
+            c = static_cast<char>(rng());
+        }
+        values.push_back(std::move(value));
+    }
+    check_round_trip(values);
+}
+
+TEST_F(FsstPageTest, EmptyStrings) {
+    check_round_trip({});
+    check_round_trip({""});
+    check_round_trip({"", "a", "", "\xff\xff", ""});
+}
+
+TEST_F(FsstPageTest, Corruption) {
+    std::vector<std::string> values(100, "2024-01-01 00:00:00 INFO request done");
+    OwnedSlice slice = encode(values);
+    PageDecoderOptions options;
+    Slice truncated(slice.slice().data, slice.slice().size - 1);
+    FsstPageDecoder decoder(truncated, options);
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace doris::segment_v2
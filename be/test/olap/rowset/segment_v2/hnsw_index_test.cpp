@@ -0,0 +1,271 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/hnsw_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <roaring/roaring.hh>
+#include <vector>
+
+#include "vec/columns/column_array.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::segment_v2 {
+
+class HnswIndexTest : public testing::Test {
+public:
+    static constexpr uint32_t DIM = 16;
+
+    void SetUp() override {
+        std::mt19937 rng(42);
+        std::normal_distribution<float> dist;
+        _vectors.resize(NUM_ROWS * DIM);
+        for (float& x : _vectors) {
+            x = dist(rng);
+        }
+        _query.resize(DIM);
+        for (float& x : _query) {
+            x = dist(rng);
+        }
+    }
+
+    static float l2_distance(const float* x, const float* y) {
+        double sum = 0;
+        for (uint32_t i = 0; i < DIM; ++i) {
+            sum += double(x[i] - y[i]) * (x[i] - y[i]);
+        }
+        return float(std::sqrt(sum));
+    }
+
+    static float cosine_distance(const float* x, const float* y) {
+        double dot = 0;
+        double squared_x = 0;
+        double squared_y = 0;
+        for (uint32_t i = 0; i < DIM; ++i) {
+            dot += double(x[i]) * y[i];
+            squared_x += double(x[i]) * x[i];
+            squared_y += double(y[i]) * y[i];
+        }
+        return float(1 - dot / std::sqrt(squared_x * squared_y));
+    }
+
+    // the k nearest rows in filter computed by brute force
+    std::vector<rowid_t> nearest_rows(AnnMetric metric, size_t k,
+                                      const roaring::Roaring* filter = nullptr) {
+        std::vector<std::pair<float, rowid_t>> distances;
+        for (rowid_t row = 0; row < NUM_ROWS; ++row) {
+            if (filter == nullptr || filter->contains(row)) {
+                const float* values = &_vectors[row * DIM];
+                distances.emplace_back(metric == AnnMetric::L2
+                                               ? l2_distance(_query.data(), values)
+                                               : cosine_distance(_query.data(), values),
+                                       row);
+            }
+        }
+        std::sort(distances.begin(), distances.end());
+        std::vector<rowid_t> rows;
+        for (size_t i = 0; i < std::min(k, distances.size()); ++i) {
+            rows.push_back(distances[i].second);
+        }
+        return rows;
+    }
+
+    std::unique_ptr<HnswIndex> build(AnnMetric metric) {
+        auto index = std::make_unique<HnswIndex>(DIM, metric);
+        for (rowid_t row = 0; row < NUM_ROWS; ++row) {
+            index->add(row, &_vectors[row * DIM]);
+        }
+        return index;
+    }
+
+    static double recall(const std::vector<HnswIndex::Neighbor>& result,
+                         const std::vector<rowid_t>& expected) {
+        size_t hits = 0;
+        for (const auto& [_, row] : result) {
+            hits += std::count(expected.begin(), expected.end(), row);
+        }
+        return double(hits) / double(expected.size());
+    }
+
+protected:
+    static constexpr rowid_t NUM_ROWS = 5000;
+    std::vector<float> _vectors;
+    std::vector<float> _query;
+};
+
+TEST_F(HnswIndexTest, SearchL2) {
+    auto index = build(AnnMetric::L2);
+    ASSERT_EQ(index->size(), NUM_ROWS);
+    std::vector<HnswIndex::Neighbor> result;
+    index->search(_query.data(), 10, 64, nullptr, &result);
+    ASSERT_EQ(result.size(), 10);
+    EXPECT_GE(recall(result, nearest_rows(AnnMetric::L2, 10)), 0.9);
+    for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_NEAR(result[i].first,
+                    l2_distance(_query.data(), &_vectors[result[i].second * DIM]), 1e-4);
+        if (i > 0) {
+            EXPECT_LE(result[i - 1].first, result[i].first);
+        }
+    }
+}
+
+TEST_F(HnswIndexTest, SearchCosine) {
+    auto index = build(AnnMetric::COSINE);
+    std::vector<HnswIndex::Neighbor> result;
+    index->search(_query.data(), 10, 64, nullptr, &result);
+    ASSERT_EQ(result.size(), 10);
+    EXPECT_GE(recall(result, nearest_rows(AnnMetric::COSINE, 10)), 0.9);
+    EXPECT_NEAR(result[0].first, cosine_distance(_query.data(), &_vectors[result[0].second * DIM]),
+                1e-4);
+
+    // a zero vector has no cosine distance
+    std::vector<float> zero(DIM, 0);
+    index->add(NUM_ROWS, zero.data());
+    EXPECT_EQ(index->size(), NUM_ROWS);
+    index->search(zero.data(), 10, 64, nullptr, &result);
+    EXPECT_TRUE(result.empty());
+}
+
+TEST_F(HnswIndexTest, SearchWithFilter) {
+    auto index = build(AnnMetric::L2);
+    std::vector<HnswIndex::Neighbor> result;
+    // a selective filter is searched by brute force
+    roaring::Roaring small_filter;
+    small_filter.addRange(100, 200);
+    index->search(_query.data(), 10, 64, &small_filter, &result);
+    std::vector<rowid_t> rows;
+    for (const auto& [_, row] : result) {
+        rows.push_back(row);
+    }
+    EXPECT_EQ(rows, nearest_rows(AnnMetric::L2, 10, &small_filter));
+
+    roaring::Roaring even_rows;
+    for (rowid_t row = 0; row < NUM_ROWS; row += 2) {
+        even_rows.add(row);
+    }
+    index->search(_query.data(), 10, 64, &even_rows, &result);
+    ASSERT_EQ(result.size(), 10);
+    for (const auto& [_, row] : result) {
+        EXPECT_EQ(row % 2, 0);
+    }
+    EXPECT_GE(recall(result, nearest_rows(AnnMetric::L2, 10, &even_rows)), 0.9);
+}
+
+TEST_F(HnswIndexTest, RangeSearch) {
+    auto index = build(AnnMetric::L2);
+    auto expected = nearest_rows(AnnMetric::L2, 50);
+    float radius = l2_distance(_query.data(), &_vectors[expected.back() * DIM]);
+    roaring::Roaring result;
+    index->range_search(_query.data(), radius, 64, nullptr, &result);
+    size_t hits = 0;
+    for (rowid_t row : expected) {
+        hits += result.contains(row);
+    }
+    EXPECT_GE(hits, 45);
+    for (rowid_t row : result) {
+        EXPECT_LE(l2_distance(_query.data(), &_vectors[row * DIM]), radius + 1e-4);
+    }
+}
+
+TEST_F(HnswIndexTest, Serialize) {
+    auto index = build(AnnMetric::L2);
+    faststring buf;
+    index->serialize(&buf);
+    std::unique_ptr<HnswIndex> loaded;
+    ASSERT_TRUE(HnswIndex::deserialize(Slice(buf.data(), buf.size()), &loaded).ok());
+    EXPECT_EQ(loaded->size(), index->size());
+    EXPECT_EQ(loaded->dim(), DIM);
+    std::vector<HnswIndex::Neighbor> expected;
+    std::vector<HnswIndex::Neighbor> result;
+    index->search(_query.data(), 10, 64, nullptr, &expected);
+    loaded->search(_query.data(), 10, 64, nullptr, &result);
+    EXPECT_EQ(result, expected);
+
+    EXPECT_FALSE(HnswIndex::deserialize(Slice(buf.data(), buf.size() - 4), &loaded).ok());
+    buf.data()[0] = 0;
+    EXPECT_FALSE(HnswIndex::deserialize(Slice(buf.data(), buf.size()), &loaded).ok());
+
+    HnswIndex empty(DIM, AnnMetric::COSINE);
+    buf.clear();
+    empty.serialize(&buf);
+    ASSERT_TRUE(HnswIndex::deserialize(Slice(buf.data(), buf.size()), &loaded).ok());
+    EXPECT_EQ(loaded->size(), 0);
+    loaded->search(_query.data(), 10, 64, nullptr, &result);
+    EXPECT_TRUE(result.empty());
+}
+
+TEST_F(HnswIndexTest, ArrayColumn) {
+    auto floats = vectorized::ColumnFloat32::create();
+    auto offsets = vectorized::ColumnArray::ColumnOffsets::create();
+    auto null_map = vectorized::ColumnUInt8::create();
+    for (rowid_t row = 0; row < 4; ++row) {
+        // the row 1 is null, and the row 2 has another dim
+        size_t dim = row == 2 ? DIM - 1 : DIM;
+        for (size_t i = 0; i < dim; ++i) {
+            floats->insert_value(_vectors[row * DIM + i]);
+        }
+        offsets->insert_value(floats->size());
+        null_map->insert_value(row == 1);
+    }
+    auto array = vectorized::ColumnArray::create(
+            vectorized::ColumnNullable::create(std::move(floats),
+                                               vectorized::ColumnUInt8::create(
+                                                       offsets->get_data().back(), 0)),
+            std::move(offsets));
+    auto column = vectorized::ColumnNullable::create(std::move(array), std::move(null_map));
+
+    HnswIndex index(DIM, AnnMetric::L2);
+    ASSERT_TRUE(index.add_array_column(*column, 10).ok());
+    ASSERT_EQ(index.size(), 2);
+    std::vector<HnswIndex::Neighbor> result;
+    index.search(&_vectors[3 * DIM], 1, 16, nullptr, &result);
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].second, 13);
+    EXPECT_FLOAT_EQ(result[0].first, 0);
+
+    auto ints = vectorized::ColumnInt32::create();
+    EXPECT_FALSE(index.add_array_column(*ints, 0).ok());
+}
+
+TEST_F(HnswIndexTest, AddIndex) {
+    auto index = build(AnnMetric::L2);
+    HnswIndex merged(DIM, AnnMetric::L2);
+    // drop the odd rows, and move the others
+    ASSERT_TRUE(merged.add_index(*index, [](rowid_t row, rowid_t* new_row) {
+                          *new_row = row / 2 + 1000;
+                          return row % 2 == 0;
+                      }).ok());
+    EXPECT_EQ(merged.size(), NUM_ROWS / 2);
+    std::vector<HnswIndex::Neighbor> result;
+    merged.search(&_vectors[10 * DIM], 1, 64, nullptr, &result);
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].second, 1005);
+
+    HnswIndex other_dim(DIM + 1, AnnMetric::L2);
+    EXPECT_FALSE(other_dim.add_index(*index, [](rowid_t row, rowid_t* new_row) {
+                               *new_row = row;
+                               return true;
+                           }).ok());
+}
+
+} // namespace doris::segment_v2
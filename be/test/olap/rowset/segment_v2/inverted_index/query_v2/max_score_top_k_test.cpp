@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "olap/rowset/segment_v2/inverted_index/query_v2/max_score_top_k.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace doris::segment_v2::idx_query_v2 {
+
+using inverted_index::MockIterator;
+using Postings = std::map<int32_t, std::vector<int32_t>>;
+
+class MaxScoreTopKTest : public testing::Test {
+public:
+    static std::vector<std::shared_ptr<MockIterator>> make_iters(
+            const std::vector<Postings>& terms) {
+        std::vector<std::shared_ptr<MockIterator>> iters;
+        for (const auto& postings : terms) {
+            iters.push_back(std::make_shared<MockIterator>(postings));
+        }
+        return iters;
+    }
+
+    // score every doc of every term
+    static std::vector<ScoredDoc> brute_force(const std::vector<Postings>& terms,
+                                              int64_t doc_count, size_t k) {
+        std::map<int32_t, float> scores;
+        for (const auto& postings : terms) {
+            float idf = Bm25Similarity::idf(postings.size(), doc_count);
+            for (const auto& [doc, positions] : postings) {
+                scores[doc] += idf * Bm25Similarity::tf_norm(positions.size(), 1);
+            }
+        }
+        std::vector<ScoredDoc> result;
+        for (const auto& [doc, score] : scores) {
+            result.push_back({doc, score});
+        }
+        std::sort(result.begin(), result.end());
+        result.resize(std::min(result.size(), k));
+        return result;
+    }
+
+    static Postings random_postings(std::mt19937& rng, int32_t doc_count, int32_t one_in) {
+        Postings postings;
+        for (int32_t doc = 0; doc < doc_count; ++doc) {
+            if (rng() % one_in == 0) {
+                postings[doc] = std::vector<int32_t>(1 + rng() % 4, 0);
+            }
+        }
+        return postings;
+    }
+};
+
+TEST_F(MaxScoreTopKTest, MatchesBruteForce) {
+    std::mt19937 rng(42);
+    const int32_t doc_count = 20000;
+    // a frequent term and some rare ones, the frequent one becomes non-essential quickly
+    std::vector<Postings> terms = {random_postings(rng, doc_count, 2),
+                                   random_postings(rng, doc_count, 50),
+                                   random_postings(rng, doc_count, 300),
+                                   random_postings(rng, doc_count, 1000)};
+    for (size_t k : {1, 10, 100}) {
+        MaxScoreTopK<MockIterator> top_k(make_iters(terms), doc_count, k);
+        auto result = top_k.collect();
+        auto expected = brute_force(terms, doc_count, k);
+        ASSERT_EQ(result.size(), expected.size());
+        std::map<int32_t, float> all_scores;
+        for (const auto& scored : brute_force(terms, doc_count, doc_count)) {
+            all_scores[scored.doc] = scored.score;
+        }
+        // the sums may round differently, so the docs of a tie may differ
+        for (size_t i = 0; i < result.size(); ++i) {
+            EXPECT_FLOAT_EQ(result[i].score, expected[i].score) << k << " " << i;
+            EXPECT_FLOAT_EQ(result[i].score, all_scores[result[i].doc]);
+        }
+        // the docs of the frequent term alone are not all scored
+        EXPECT_LT(top_k.num_scored(), doc_count / 2);
+    }
+}
+
+TEST_F(MaxScoreTopKTest, FewerMatchesThanK) {
+    std::vector<Postings> terms = {{{1, {0}}, {5, {0, 1}}}, {{5, {2}}, {9, {3}}}};
+    MaxScoreTopK<MockIterator> top_k(make_iters(terms), 100, 10);
+    auto result = top_k.collect();
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0].doc, 5);
+    auto expected = brute_force(terms, 100, 10);
+    for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result[i].doc, expected[i].doc);
+    }
+}
+
+TEST_F(MaxScoreTopKTest, Empty) {
+    EXPECT_TRUE(MaxScoreTopK<MockIterator>(make_iters({}), 100, 10).collect().empty());
+    EXPECT_TRUE(MaxScoreTopK<MockIterator>(make_iters({{}}), 100, 10).collect().empty());
+    std::vector<Postings> terms = {{{1, {0}}}};
+    EXPECT_TRUE(MaxScoreTopK<MockIterator>(make_iters(terms), 100, 0).collect().empty());
+}
+
+TEST_F(MaxScoreTopKTest, LengthNormalization) {
+    // the same freq, the shorter doc wins
+    std::vector<Postings> terms = {{{1, {0}}, {2, {0}}}};
+    MaxScoreTopK<MockIterator> top_k(make_iters(terms), 100, 1,
+                                     [](int32_t doc) { return doc == 2 ? 0.5F : 2.0F; });
+    auto result = top_k.collect();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].doc, 2);
+}
+
+} // namespace doris::segment_v2::idx_query_v2
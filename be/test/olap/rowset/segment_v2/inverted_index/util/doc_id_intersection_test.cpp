@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "olap/rowset/segment_v2/inverted_index/util/doc_id_intersection.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace doris::segment_v2::inverted_index {
+
+class DocIdIntersectionTest : public testing::Test {
+public:
+    static std::vector<uint32_t> random_docs(std::mt19937& rng, size_t size, uint32_t max_doc) {
+        std::set<uint32_t> docs;
+        while (docs.size() < size) {
+            docs.insert(rng() % max_doc);
+        }
+        return {docs.begin(), docs.end()};
+    }
+
+    static void check(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+        std::vector<uint32_t> expected;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                              std::back_inserter(expected));
+
+        std::vector<uint32_t> out(std::min(a.size(), b.size()));
+        auto check_result = [&](size_t n) {
+            ASSERT_EQ(n, expected.size());
+            for (size_t i = 0; i < n; ++i) {
+                ASSERT_EQ(out[i], expected[i]) << i;
+            }
+        };
+        check_result(intersect_doc_ids(a.data(), a.size(), b.data(), b.size(), out.data()));
+        check_result(intersect_doc_ids(b.data(), b.size(), a.data(), a.size(), out.data()));
+        check_result(intersect_merge(a.data(), a.size(), b.data(), b.size(), out.data()));
+        check_result(intersect_merge_scalar(a.data(), a.size(), b.data(), b.size(), out.data()));
+        if (a.size() <= b.size()) {
+            check_result(intersect_galloping(a.data(), a.size(), b.data(), b.size(), out.data()));
+        }
+    }
+};
+
+TEST_F(DocIdIntersectionTest, Empty) {
+    check({}, {});
+    check({}, {1, 2, 3});
+    check({1, 2, 3}, {});
+    check({1, 3, 5}, {2, 4, 6});
+}
+
+TEST_F(DocIdIntersectionTest, SimilarSizes) {
+    std::mt19937 rng(42);
+    for (size_t size : {1, 7, 8, 9, 16, 100, 1000, 5000}) {
+        for (uint32_t max_doc : {size * 2, size * 10}) {
+            check(random_docs(rng, size, max_doc), random_docs(rng, size, max_doc));
+            check(random_docs(rng, size, max_doc), random_docs(rng, size + 3, max_doc));
+        }
+    }
+}
+
+TEST_F(DocIdIntersectionTest, SkewedSizes) {
+    std::mt19937 rng(7);
+    for (size_t size : {1, 5, 30, 100}) {
+        auto a = random_docs(rng, size, 1000000);
+        auto b = random_docs(rng, 20000, 100000);
+        // b holds all the docs of a below its range
+        for (uint32_t doc : a) {
+            if (doc < 100000) {
+                b.push_back(doc);
+            }
+        }
+        std::sort(b.begin(), b.end());
+        b.erase(std::unique(b.begin(), b.end()), b.end());
+        check(a, b);
+    }
+}
+
+TEST_F(DocIdIntersectionTest, Identical) {
+    std::vector<uint32_t> docs;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        docs.push_back(i * 3);
+    }
+    check(docs, docs);
+    // the tails of the blocks don't line up
+    check(docs, std::vector<uint32_t>(docs.begin() + 5, docs.end() - 3));
+}
+
+} // namespace doris::segment_v2::inverted_index
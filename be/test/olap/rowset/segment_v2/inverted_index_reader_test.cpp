@@ -2257,6 +2257,123 @@ public:
         }
     }
 
+    // Test the MATCH_ANY and MATCH_ALL answered from the cached bitmaps of their terms
+    void test_term_cache() {
+        std::string_view rowset_id = "test_term_cache";
+        int seg_id = 0;
+
+        std::vector<Slice> values = {Slice("error timeout"), Slice("error disk"),
+                                     Slice("warning disk"), Slice("info")};
+
+        TabletIndex idx_meta;
+        auto index_meta_pb = std::make_unique<TabletIndexPB>();
+        index_meta_pb->set_index_type(IndexType::INVERTED);
+        index_meta_pb->set_index_id(1);
+        index_meta_pb->set_index_name("test_term_cache");
+        index_meta_pb->clear_col_unique_id();
+        index_meta_pb->add_col_unique_id(1); // c2 column
+        index_meta_pb->mutable_properties()->insert({"parser", "english"});
+        idx_meta.init_from_pb(*index_meta_pb.get());
+
+        std::string index_path_prefix;
+        prepare_string_index(rowset_id, seg_id, values, &idx_meta, &index_path_prefix);
+
+        OlapReaderStatistics stats;
+        RuntimeState runtime_state;
+        TQueryOptions query_options;
+        query_options.enable_inverted_index_query_cache = true;
+        query_options.enable_inverted_index_searcher_cache = false;
+        runtime_state.set_query_options(query_options);
+
+        auto reader = std::make_shared<InvertedIndexFileReader>(
+                io::global_local_filesystem(), index_path_prefix, InvertedIndexStorageFormatPB::V2);
+        EXPECT_TRUE(reader->init().ok());
+        auto fulltext_reader = FullTextIndexReader::create_shared(&idx_meta, reader);
+
+        io::IOContext io_ctx;
+        std::string field_name = "1"; // c2 column unique_id
+        auto run = [&](const std::string& query, InvertedIndexQueryType query_type) {
+            std::shared_ptr<roaring::Roaring> bitmap = std::make_shared<roaring::Roaring>();
+            StringRef query_ref(query.c_str(), query.length());
+            auto status = fulltext_reader->query(&io_ctx, &stats, &runtime_state, field_name,
+                                                 &query_ref, query_type, bitmap);
+            EXPECT_TRUE(status.ok()) << status;
+            return bitmap;
+        };
+
+        // the query and both terms miss
+        auto bitmap = run("error disk", InvertedIndexQueryType::MATCH_ANY_QUERY);
+        EXPECT_EQ(*bitmap, roaring::Roaring({0, 1, 2}));
+        EXPECT_EQ(stats.inverted_index_query_cache_miss, 3);
+        EXPECT_EQ(stats.inverted_index_query_cache_hit, 0);
+
+        // another combination of the same terms, only the query misses
+        bitmap = run("disk error", InvertedIndexQueryType::MATCH_ALL_QUERY);
+        EXPECT_EQ(*bitmap, roaring::Roaring({1}));
+        EXPECT_EQ(stats.inverted_index_query_cache_miss, 4);
+        EXPECT_EQ(stats.inverted_index_query_cache_hit, 2);
+
+        // a single term shares the entry of the term
+        bitmap = run("disk", InvertedIndexQueryType::MATCH_ANY_QUERY);
+        EXPECT_EQ(*bitmap, roaring::Roaring({1, 2}));
+        EXPECT_EQ(stats.inverted_index_query_cache_hit, 3);
+
+        bitmap = run("timeout warning", InvertedIndexQueryType::MATCH_ALL_QUERY);
+        EXPECT_TRUE(bitmap->isEmpty());
+    }
+
+    void test_count_by_terms() {
+        std::string_view rowset_id = "test_count_by_terms";
+        int seg_id = 0;
+
+        std::vector<Slice> values = {Slice("web"), Slice("db"), Slice("web"), Slice("cache"),
+                                     Slice("web"), Slice("db")};
+
+        TabletIndex idx_meta;
+        auto index_meta_pb = std::make_unique<TabletIndexPB>();
+        index_meta_pb->set_index_type(IndexType::INVERTED);
+        index_meta_pb->set_index_id(1);
+        index_meta_pb->set_index_name("test_count_by_terms");
+        index_meta_pb->clear_col_unique_id();
+        index_meta_pb->add_col_unique_id(1); // c2 column
+        idx_meta.init_from_pb(*index_meta_pb.get());
+
+        std::string index_path_prefix;
+        prepare_string_index(rowset_id, seg_id, values, &idx_meta, &index_path_prefix);
+
+        OlapReaderStatistics stats;
+        RuntimeState runtime_state;
+        TQueryOptions query_options;
+        query_options.enable_inverted_index_searcher_cache = false;
+        runtime_state.set_query_options(query_options);
+
+        auto reader = std::make_shared<InvertedIndexFileReader>(
+                io::global_local_filesystem(), index_path_prefix, InvertedIndexStorageFormatPB::V2);
+        EXPECT_TRUE(reader->init().ok());
+        auto string_reader = StringTypeInvertedIndexReader::create_shared(&idx_meta, reader);
+
+        io::IOContext io_ctx;
+        std::vector<std::pair<std::string, uint64_t>> counts;
+        auto status = string_reader->count_by_terms(&io_ctx, &stats, &runtime_state, "1",
+                                                    roaring::Roaring({0, 1, 2, 3, 4, 5}), &counts);
+        EXPECT_TRUE(status.ok()) << status;
+        std::vector<std::pair<std::string, uint64_t>> expected = {
+                {"cache", 1}, {"db", 2}, {"web", 3}};
+        EXPECT_EQ(counts, expected);
+
+        // the rows left by the filter, a term without any is left out
+        status = string_reader->count_by_terms(&io_ctx, &stats, &runtime_state, "1",
+                                               roaring::Roaring({1, 2, 5}), &counts);
+        EXPECT_TRUE(status.ok()) << status;
+        expected = {{"db", 2}, {"web", 1}};
+        EXPECT_EQ(counts, expected);
+
+        status = string_reader->count_by_terms(&io_ctx, &stats, &runtime_state, "1",
+                                               roaring::Roaring(), &counts);
+        EXPECT_TRUE(status.ok()) << status;
+        EXPECT_TRUE(counts.empty());
+    }
+
     // Test iterator comprehensive functionality
     void test_iterator_comprehensive() {
         std::string_view rowset_id = "test_iterator_comprehensive";
@@ -3430,4 +3547,12 @@ TEST_F(InvertedIndexReaderTest, UnsupportedDataTypes) {
     test_unsupported_data_types();
 }
 
+TEST_F(InvertedIndexReaderTest, TermCache) {
+    test_term_cache();
+}
+
+TEST_F(InvertedIndexReaderTest, CountByTerms) {
+    test_count_by_terms();
+}
+
 } // namespace doris::segment_v2
@@ -637,6 +637,15 @@ TEST_F(InvertedIndexWriterTest, StringWrite) {
     test_string_write("test_rowset_1", 0);
 }
 
+// Test case for flushing the buffered postings as runs merged at finish
+TEST_F(InvertedIndexWriterTest, StringWriteFlushRuns) {
+    int64_t original_threshold = config::inverted_index_writer_flush_threshold_bytes;
+    // flush after each document
+    config::inverted_index_writer_flush_threshold_bytes = 1;
+    test_string_write("test_rowset_flush_runs", 0);
+    config::inverted_index_writer_flush_threshold_bytes = original_threshold;
+}
+
 // Test case for nulls writing
 TEST_F(InvertedIndexWriterTest, NullsWrite) {
     test_nulls_write("test_rowset_2", 0);
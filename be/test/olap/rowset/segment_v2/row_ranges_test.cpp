@@ -135,5 +135,65 @@ TEST_F(RowRangesTest, TestRangesToRoaring) {
     EXPECT_EQ(row_ranges_union.count(), row_bitmap.cardinality());
 }
 
+TEST_F(RowRangesTest, TestFragmentedRanges) {
+    // every other block of 10 rows, too many ranges to merge one by one
+    RowRanges left;
+    RowRanges right;
+    for (int64_t i = 0; i < 1000; ++i) {
+        left.add(RowRange(i * 20, i * 20 + 10));
+        right.add(RowRange(i * 20 + 5, i * 20 + 15));
+    }
+    EXPECT_FALSE(left.is_bitmap());
+
+    RowRanges intersection;
+    RowRanges::ranges_intersection(left, right, &intersection);
+    EXPECT_TRUE(intersection.is_bitmap());
+    EXPECT_EQ(5000, intersection.count());
+    EXPECT_EQ(5, intersection.from());
+    EXPECT_EQ(19990, intersection.to());
+    EXPECT_EQ(1000, intersection.range_size());
+    EXPECT_EQ(25, intersection.get_range_from(1));
+    EXPECT_EQ(30, intersection.get_range_to(1));
+    EXPECT_TRUE(intersection.contain(26, 27));
+
+    RowRanges unions;
+    RowRanges::ranges_union(left, right, &unions);
+    EXPECT_EQ(15000, unions.count());
+    EXPECT_EQ(1000, unions.range_size());
+    EXPECT_EQ(0, unions.get_range_from(0));
+    EXPECT_EQ(15, unions.get_range_to(0));
+
+    // in place, and with a range list on the other side
+    RowRanges::ranges_intersection(unions, RowRanges::create_single(0, 100), &unions);
+    EXPECT_EQ(75, unions.count());
+    EXPECT_EQ("[0-15) [20-35) [40-55) [60-75) [80-95) ", unions.to_string());
+    unions.add(RowRange(200, 210));
+    EXPECT_EQ(85, unions.count());
+    EXPECT_EQ(210, unions.to());
+
+    roaring::Roaring bitmap = RowRanges::ranges_to_roaring(intersection);
+    EXPECT_EQ(5000, bitmap.cardinality());
+    RowRanges from_bitmap = RowRanges::create_from_roaring(bitmap);
+    EXPECT_EQ(intersection.to_string(), from_bitmap.to_string());
+
+    // the same result as merging the ranges
+    RowRanges small_left;
+    RowRanges small_right;
+    for (int64_t i = 0; i < 10; ++i) {
+        small_left.add(RowRange(i * 20, i * 20 + 10));
+        small_right.add(RowRange(i * 20 + 5, i * 20 + 15));
+    }
+    RowRanges small_intersection;
+    RowRanges::ranges_intersection(small_left, small_right, &small_intersection);
+    EXPECT_FALSE(small_intersection.is_bitmap());
+    RowRanges clipped;
+    RowRanges::ranges_intersection(intersection, RowRanges::create_single(0, 200), &clipped);
+    EXPECT_EQ(small_intersection.to_string(), clipped.to_string());
+
+    clipped.clear();
+    EXPECT_TRUE(clipped.is_empty());
+    EXPECT_FALSE(clipped.is_bitmap());
+}
+
 } // namespace segment_v2
 } // namespace doris
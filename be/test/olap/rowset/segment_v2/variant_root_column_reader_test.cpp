@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "olap/rowset/segment_v2/hierarchical_data_reader.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::segment_v2 {
+
+// returns the ordinal of each row as its value and counts the reads
+class CountingColumnIterator : public ColumnIterator {
+public:
+    explicit CountingColumnIterator(size_t* num_reads) : _num_reads(num_reads) {}
+
+    Status seek_to_ordinal(ordinal_t ord) override {
+        _ordinal = ord;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst, bool* has_null) override {
+        ++*_num_reads;
+        auto& data = assert_cast<vectorized::ColumnInt64&>(*dst).get_data();
+        for (size_t i = 0; i < *n; ++i) {
+            data.push_back(_ordinal++);
+        }
+        return Status::OK();
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, const size_t count,
+                          vectorized::MutableColumnPtr& dst) override {
+        ++*_num_reads;
+        auto& data = assert_cast<vectorized::ColumnInt64&>(*dst).get_data();
+        for (size_t i = 0; i < count; ++i) {
+            data.push_back(rowids[i]);
+        }
+        return Status::OK();
+    }
+
+    ordinal_t get_current_ordinal() const override { return _ordinal; }
+
+private:
+    size_t* _num_reads;
+    ordinal_t _ordinal = 0;
+};
+
+TEST(VariantRootColumnReaderTest, ReuseBatch) {
+    size_t num_reads = 0;
+    auto type = std::make_shared<vectorized::DataTypeInt64>();
+    VariantRootColumnReader reader(std::make_unique<SubstreamIterator>(
+            type->create_column(), std::make_unique<CountingColumnIterator>(&num_reads), type));
+    ASSERT_TRUE(reader.init(ColumnIteratorOptions()).ok());
+
+    auto values = [](const vectorized::IColumn* column) {
+        const auto& data = assert_cast<const vectorized::ColumnInt64&>(*column).get_data();
+        return std::vector<int64_t>(data.begin(), data.end());
+    };
+    const vectorized::IColumn* column = nullptr;
+
+    // the readers of two paths read the same rows
+    size_t n = 3;
+    ASSERT_TRUE(reader.next_batch(10, &n, &column).ok());
+    EXPECT_EQ(values(column), std::vector<int64_t>({10, 11, 12}));
+    n = 3;
+    ASSERT_TRUE(reader.next_batch(10, &n, &column).ok());
+    EXPECT_EQ(n, 3);
+    EXPECT_EQ(values(column), std::vector<int64_t>({10, 11, 12}));
+    EXPECT_EQ(num_reads, 1);
+
+    // the next batch
+    n = 2;
+    ASSERT_TRUE(reader.next_batch(13, &n, &column).ok());
+    EXPECT_EQ(values(column), std::vector<int64_t>({13, 14}));
+    EXPECT_EQ(num_reads, 2);
+
+    // going back seeks
+    n = 2;
+    ASSERT_TRUE(reader.next_batch(0, &n, &column).ok());
+    EXPECT_EQ(values(column), std::vector<int64_t>({0, 1}));
+    EXPECT_EQ(num_reads, 3);
+
+    std::vector<rowid_t> rowids = {3, 7, 8};
+    ASSERT_TRUE(reader.read_by_rowids(rowids.data(), rowids.size(), &column).ok());
+    ASSERT_TRUE(reader.read_by_rowids(rowids.data(), rowids.size(), &column).ok());
+    EXPECT_EQ(values(column), std::vector<int64_t>({3, 7, 8}));
+    EXPECT_EQ(num_reads, 4);
+
+    rowids = {3, 7, 9};
+    ASSERT_TRUE(reader.read_by_rowids(rowids.data(), rowids.size(), &column).ok());
+    EXPECT_EQ(values(column), std::vector<int64_t>({3, 7, 9}));
+    EXPECT_EQ(num_reads, 5);
+}
+
+} // namespace doris::segment_v2
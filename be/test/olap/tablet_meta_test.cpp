@@ -245,4 +245,17 @@ TEST(TabletMetaTest, TestDeleteBitmap) {
     }
 }
 
+TEST(TabletMetaTest, TestSealDeleteBitmap) {
+    roaring::Roaring bitmap;
+    for (uint32_t i = 0; i < 100000; ++i) {
+        bitmap.add(i);
+    }
+    bitmap.add(200000);
+    roaring::Roaring expected = bitmap;
+    size_t size = bitmap.getSizeInBytes();
+    DeleteBitmap::seal(&bitmap);
+    EXPECT_EQ(bitmap, expected);
+    EXPECT_LT(bitmap.getSizeInBytes(), size / 10);
+}
+
 } // namespace doris
@@ -20,7 +20,11 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <map>
+#include <string>
 
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/data_types/data_type_string.h"
 
 namespace doris::pipeline {
@@ -227,14 +231,14 @@ TEST_F(AggregatedDataVariantsTest, TestNumericKeys) {
     // Test int8 key
     _variants->init(types, HashKeyType::int8_key);
     auto value = std::holds_alternative<
-            vectorized::MethodOneNumber<vectorized::UInt8, AggData<vectorized::UInt8>>>(
+            vectorized::MethodOneNumber<vectorized::UInt8, AggregatedDataWithUInt8Key>>(
             _variants->method_variant);
     ASSERT_TRUE(value);
 
     // Test int16 key
     _variants->init(types, HashKeyType::int16_key);
     value = std::holds_alternative<
-            vectorized::MethodOneNumber<vectorized::UInt16, AggData<vectorized::UInt16>>>(
+            vectorized::MethodOneNumber<vectorized::UInt16, AggregatedDataWithUInt16Key>>(
             _variants->method_variant);
     ASSERT_TRUE(value);
 
@@ -331,4 +335,62 @@ TEST_F(AggregatedDataVariantsTest, TestInvalidKeyType) {
     ASSERT_THROW(_variants->init(types, static_cast<HashKeyType>(-1)), Exception);
 }
 
-} // namespace doris::pipeline
\ No newline at end of file
+TEST(AggDictCodePlacesTest, FindOrEmplace) {
+    // "a", "b", null, "a", "c", "b", null
+    auto nested = vectorized::ColumnString::create();
+    auto null_map = vectorized::ColumnUInt8::create();
+    std::vector<std::string> values {"a", "b", "", "a", "c", "b", ""};
+    std::vector<vectorized::Int32> code_values {0, 1, -1, 0, 2, 1, -1};
+    for (size_t i = 0; i < values.size(); ++i) {
+        nested->insert_data(values[i].data(), values[i].size());
+        null_map->insert_value(code_values[i] == -1);
+    }
+    auto column = vectorized::ColumnNullable::create(std::move(nested), std::move(null_map));
+    vectorized::ColumnDictCodes codes;
+    codes.dict_id = 1;
+    codes.dict_size = 3;
+    codes.codes.assign(code_values.begin(), code_values.end());
+
+    std::map<std::string, vectorized::AggregateDataPtr> states;
+    std::vector<char> buffer(8);
+    size_t num_emplaced = 0;
+    auto emplace = [&](vectorized::IColumn& keys, vectorized::AggregateDataPtr* places,
+                       size_t rows) {
+        num_emplaced += rows;
+        for (size_t i = 0; i < rows; ++i) {
+            auto key = keys.is_null_at(i) ? std::string("NULL") : keys.get_data_at(i).to_string();
+            places[i] = states.emplace(key, &buffer[states.size()]).first->second;
+        }
+    };
+
+    AggDictCodePlaces dict_code_places;
+    std::vector<vectorized::AggregateDataPtr> places(values.size());
+    EXPECT_EQ(dict_code_places.find_or_emplace(codes, *column, places.data(), values.size(),
+                                               emplace),
+              0);
+    // Only the first row of every code is emplaced.
+    EXPECT_EQ(num_emplaced, 4);
+    EXPECT_EQ(places[0], states["a"]);
+    EXPECT_EQ(places[3], states["a"]);
+    EXPECT_EQ(places[5], states["b"]);
+    EXPECT_EQ(places[4], states["c"]);
+    EXPECT_EQ(places[2], states["NULL"]);
+    EXPECT_EQ(places[6], states["NULL"]);
+
+    // The codes of the same dictionary hit the cache.
+    EXPECT_EQ(dict_code_places.find_or_emplace(codes, *column, places.data(), values.size(),
+                                               emplace),
+              values.size());
+    EXPECT_EQ(num_emplaced, 4);
+    EXPECT_EQ(places[1], states["b"]);
+
+    // Another dictionary starts from an empty cache.
+    codes.dict_id = 2;
+    EXPECT_EQ(dict_code_places.find_or_emplace(codes, *column, places.data(), values.size(),
+                                               emplace),
+              0);
+    EXPECT_EQ(num_emplaced, 8);
+    EXPECT_EQ(states.size(), 4);
+}
+
+} // namespace doris::pipeline
@@ -1263,4 +1263,97 @@ TEST_F(LocalExchangerTest, TestShuffleExchangerWrongMap) {
                         .is<ErrorCode::INTERNAL_ERROR>());
     }
 }
+
+TEST_F(LocalExchangerTest, ShuffleExchangerSkewRebalance) {
+    int num_sink = 1;
+    int num_sources = 4;
+    int num_partitions = 4;
+    int free_block_limit = 0;
+    const int rows_per_block = 4096;
+    std::map<int, int> shuffle_idx_to_instance_idx;
+    for (int i = 0; i < num_partitions; i++) {
+        shuffle_idx_to_instance_idx[i] = i;
+    }
+    config::local_exchange_buffer_mem_limit = 1L << 30;
+    config::local_exchange_skew_factor = 1.5;
+    config::local_exchange_skew_min_rows = 1;
+
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto shared_state = LocalExchangeSharedState::create_shared(num_partitions);
+    shared_state->exchanger = ShuffleExchanger::create_unique(num_sink, num_sources, num_partitions,
+                                                              free_block_limit, true);
+    auto sink_dep = std::make_shared<Dependency>(0, 0, "LOCAL_EXCHANGE_SINK_DEPENDENCY", true);
+    sink_dep->set_shared_state(shared_state.get());
+    shared_state->sink_deps.push_back(sink_dep);
+    shared_state->create_source_dependencies(num_sources, 0, 0, "TEST");
+    auto* exchanger = (ShuffleExchanger*)shared_state->exchanger.get();
+
+    auto sink_local_state = std::make_unique<LocalExchangeSinkLocalState>(nullptr, nullptr);
+    sink_local_state->_exchanger = exchanger;
+    sink_local_state->_compute_hash_value_timer = ADD_TIMER(profile, "ComputeHashValueTime");
+    sink_local_state->_distribute_timer = ADD_TIMER(profile, "DistributeDataTime");
+    auto* skew_rebalanced_rows = ADD_COUNTER(profile, "SkewRebalancedRows", TUnit::UNIT);
+    sink_local_state->_partitioner.reset(
+            new vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>(num_partitions));
+    auto texpr = TExprNodeBuilder(TExprNodeType::SLOT_REF,
+                                  TTypeDescBuilder()
+                                          .set_types(TTypeNodeBuilder()
+                                                             .set_type(TTypeNodeType::SCALAR)
+                                                             .set_scalar_type(TPrimitiveType::INT)
+                                                             .build())
+                                          .build(),
+                                  0)
+                         .set_slot_ref(TSlotRefBuilder(0, 0).build())
+                         .build();
+    auto slot = doris::vectorized::VSlotRef::create_shared(texpr);
+    slot->_column_id = 0;
+    ((vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>*)
+             sink_local_state->_partitioner.get())
+            ->_partition_expr_ctxs.push_back(
+                    std::make_shared<doris::vectorized::VExprContext>(slot));
+    sink_local_state->_channel_id = 0;
+    sink_local_state->_shared_state = shared_state.get();
+    sink_local_state->_dependency = sink_dep.get();
+    sink_local_state->_memory_used_counter =
+            profile->AddHighWaterMarkCounter("SinkMemoryUsage", TUnit::BYTES, "", 1);
+    for (int i = 0; i < num_sources; i++) {
+        shared_state->mem_counters[i] = profile->AddHighWaterMarkCounter(
+                "MemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+    }
+
+    // All the rows share one key, so without rebalance only one instance receives data.
+    auto sink_block = [&]() {
+        vectorized::Block in_block;
+        auto int_col0 = vectorized::ColumnInt32::create();
+        int_col0->insert_many_vals(7, rows_per_block);
+        in_block.insert({std::move(int_col0), std::make_shared<vectorized::DataTypeInt32>(),
+                         "test_int_col0"});
+        EXPECT_EQ(exchanger->sink(_runtime_state.get(), &in_block, false,
+                                  {sink_local_state->_compute_hash_value_timer,
+                                   sink_local_state->_distribute_timer, nullptr,
+                                   skew_rebalanced_rows},
+                                  {&sink_local_state->_channel_id,
+                                   sink_local_state->_partitioner.get(), sink_local_state.get(),
+                                   &shuffle_idx_to_instance_idx}),
+                  Status::OK());
+    };
+    sink_block();
+    int hot_instance = -1;
+    for (int i = 0; i < num_sources; i++) {
+        if (exchanger->_data_queue[i].data_queue.size_approx() > 0) {
+            EXPECT_EQ(hot_instance, -1);
+            hot_instance = i;
+        }
+    }
+    EXPECT_NE(hot_instance, -1);
+    EXPECT_EQ(skew_rebalanced_rows->value(), 0);
+
+    // The hot instance is skewed now, so the next block is spread over all the instances.
+    sink_block();
+    EXPECT_EQ(skew_rebalanced_rows->value(), rows_per_block);
+    for (int i = 0; i < num_sources; i++) {
+        EXPECT_EQ(exchanger->_data_queue[i].data_queue.size_approx(), i == hot_instance ? 2 : 1);
+    }
+    config::local_exchange_skew_factor = 0;
+}
 } // namespace doris::pipeline
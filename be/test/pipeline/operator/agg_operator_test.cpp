@@ -18,8 +18,10 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
 #include <memory>
 
+#include "common/config.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
 #include "pipeline/exec/aggregation_source_operator.h"
@@ -755,4 +757,106 @@ TEST(AggOperatorTestWithOutGroupBy, other_case_3) {
     }
 }
 
+TEST_F(AggOperatorTestWithGroupBy, merge_buckets) {
+    using namespace vectorized;
+    const auto min_groups = config::agg_parallel_merge_min_groups;
+    const auto num_buckets = config::agg_parallel_merge_buckets;
+    config::agg_parallel_merge_min_groups = 8;
+    config::agg_parallel_merge_buckets = 4;
+
+    std::vector<int64_t> keys;
+    std::vector<int64_t> values;
+    for (int64_t i = 0; i < 100; ++i) {
+        keys.push_back(i % 20);
+        values.push_back(i);
+    }
+
+    auto phase1 = [&]() {
+        OperatorContext ctx;
+        auto sink_op = std::make_shared<MockAggsinkOperator>();
+        sink_op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+                ctx.pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()),
+                false, false));
+        sink_op->_pool = &ctx.pool;
+        EXPECT_TRUE(sink_op->prepare(&ctx.state).ok());
+        sink_op->_probe_expr_ctxs =
+                MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+        sink_op->_needs_finalize = false;
+        sink_op->_limit = -1;
+
+        auto source_op = std::make_shared<MockAggSourceOperator>();
+        source_op->mock_row_descriptor.reset(
+                new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt64>(),
+                                        std::make_shared<vectorized::DataTypeInt64>()},
+                                       &ctx.pool});
+        source_op->_without_key = false;
+        source_op->_needs_finalize = false;
+        EXPECT_TRUE(source_op->prepare(&ctx.state).ok());
+
+        auto shared_state = init_sink_and_source(sink_op, source_op, ctx);
+        vectorized::Block block {ColumnHelper::create_column_with_name<DataTypeInt64>(keys),
+                                 ColumnHelper::create_column_with_name<DataTypeInt64>(values)};
+        EXPECT_TRUE(sink_op->sink(&ctx.state, &block, true).ok());
+
+        vectorized::Block serialize_block;
+        bool eos = false;
+        EXPECT_TRUE(source_op->get_block(&ctx.state, &serialize_block, &eos).ok());
+        EXPECT_TRUE(eos);
+        return serialize_block;
+    };
+
+    OperatorContext ctx;
+    auto sink_op = std::make_shared<MockAggsinkOperator>();
+    sink_op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            ctx.pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()),
+            true, false));
+    sink_op->_pool = &ctx.pool;
+    EXPECT_TRUE(sink_op->prepare(&ctx.state).ok());
+    sink_op->_probe_expr_ctxs =
+            MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+    sink_op->_needs_finalize = true;
+    sink_op->_limit = -1;
+
+    auto source_op = std::make_shared<MockAggSourceOperator>();
+    source_op->mock_row_descriptor.reset(
+            new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt64>(),
+                                    std::make_shared<vectorized::DataTypeInt64>()},
+                                   &ctx.pool});
+    source_op->_without_key = false;
+    source_op->_needs_finalize = true;
+    EXPECT_TRUE(source_op->prepare(&ctx.state).ok());
+
+    auto shared_state = init_sink_and_source(sink_op, source_op, ctx);
+    auto* agg_shared_state = static_cast<AggSharedState*>(shared_state.get());
+
+    // The 20 groups of the first block are moved to the buckets, the second block is buffered.
+    for (int i = 0; i < 2; ++i) {
+        auto block = phase1();
+        auto st = sink_op->sink(&ctx.state, &block, i == 1);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_EQ(agg_shared_state->merge_buckets.size(), 4);
+    }
+
+    std::map<int64_t, int64_t> results;
+    bool eos = false;
+    while (!eos) {
+        vectorized::Block block;
+        auto st = source_op->get_block(&ctx.state, &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        for (size_t i = 0; i < block.rows(); ++i) {
+            auto key = block.get_by_position(0).column->get_int(i);
+            EXPECT_FALSE(results.contains(key));
+            results[key] = block.get_by_position(1).column->get_int(i);
+        }
+    }
+    EXPECT_EQ(results.size(), 20);
+    for (int64_t key = 0; key < 20; ++key) {
+        // 2 * sum(key + 20 * j) for j in [0, 5)
+        EXPECT_EQ(results[key], 2 * (5 * key + 200));
+    }
+
+    config::agg_parallel_merge_min_groups = min_groups;
+    config::agg_parallel_merge_buckets = num_buckets;
+}
+
 } // namespace doris::pipeline
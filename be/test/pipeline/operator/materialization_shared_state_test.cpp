@@ -99,6 +99,36 @@ TEST_F(MaterializationSharedStateTest, TestCreateMultiGetResult) {
     EXPECT_EQ(_shared_state->last_block, true);
 }
 
+TEST_F(MaterializationSharedStateTest, TestCreateMultiGetResultDuplicateRows) {
+    // the rows of a join repeat the row ids of the matched rows
+    vectorized::Columns columns;
+    auto rowid_col = _string_type->create_column();
+    GlobalRowLoacationV2 loc1(0, _backend_id1, 1, 1);
+    GlobalRowLoacationV2 loc2(0, _backend_id1, 1, 2);
+    GlobalRowLoacationV2 loc3(0, _backend_id2, 1, 1);
+    for (const auto* loc : {&loc1, &loc2, &loc1, &loc3, &loc2}) {
+        rowid_col->insert_data(reinterpret_cast<const char*>(loc), sizeof(GlobalRowLoacationV2));
+    }
+    columns.push_back(std::move(rowid_col));
+
+    Status st = _shared_state->create_muiltget_result(columns, false, false);
+    EXPECT_TRUE(st.ok());
+
+    // every location is asked for once
+    const auto& desc1 = _shared_state->rpc_struct_map[_backend_id1].request.request_block_descs(0);
+    EXPECT_EQ(desc1.row_id_size(), 2);
+    EXPECT_EQ(desc1.row_id(0), 1);
+    EXPECT_EQ(desc1.row_id(1), 2);
+    const auto& desc2 = _shared_state->rpc_struct_map[_backend_id2].request.request_block_descs(0);
+    EXPECT_EQ(desc2.row_id_size(), 1);
+
+    std::vector<int64_t> expected_order = {_backend_id1, _backend_id1, _backend_id1, _backend_id2,
+                                           _backend_id1};
+    EXPECT_EQ(_shared_state->block_order_results[0], expected_order);
+    std::vector<uint32_t> expected_positions = {0, 1, 0, 0, 1};
+    EXPECT_EQ(_shared_state->block_order_positions[0], expected_positions);
+}
+
 TEST_F(MaterializationSharedStateTest, TestMergeMultiResponse) {
     // 1. Setup origin block with nullable rowid column
     auto nullable_rowid_col = vectorized::ColumnNullable::create(_string_type->create_column(),
@@ -172,6 +202,7 @@ TEST_F(MaterializationSharedStateTest, TestMergeMultiResponse) {
     _shared_state->block_order_results = {
             {_backend_id1, 0, _backend_id2} // First block order: BE1,BE1,BE2
     };
+    _shared_state->block_order_positions = {{0, 0, 0}};
 
     // 4. Test merging responses
     vectorized::Block result_block;
@@ -311,6 +342,7 @@ TEST_F(MaterializationSharedStateTest, TestMergeMultiResponseMultiBlocks) {
             {_backend_id1, 0, _backend_id2}, // First block order: BE1,null,BE2
             {_backend_id1, _backend_id2, 0}  // Second block order: BE1,BE2,null
     };
+    _shared_state->block_order_positions = {{0, 0, 0}, {0, 0, 0}};
 
     // 4. Test merging responses
     vectorized::Block result_block;
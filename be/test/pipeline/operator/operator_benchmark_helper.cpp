@@ -0,0 +1,267 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "operator_benchmark_helper.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+
+#include "pipeline/dependency.h"
+#include "pipeline/dummy_task_queue.h"
+#include "pipeline/pipeline_fragment_context.h"
+#include "runtime/exec_env.h"
+#include "runtime/fragment_mgr.h"
+#include "runtime/query_context.h"
+#include "service/backend_options.h"
+#include "util/stopwatch.hpp"
+#include "util/time.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::pipeline {
+
+BenchmarkDataGenerator::BenchmarkDataGenerator(std::vector<BenchmarkColumnSpec> specs,
+                                               uint64_t seed)
+        : _specs(std::move(specs)), _zipf_cdfs(_specs.size()), _rng(seed) {
+    for (size_t i = 0; i < _specs.size(); ++i) {
+        const auto& spec = _specs[i];
+        DCHECK(spec.type == TYPE_BIGINT || spec.type == TYPE_STRING) << spec.type;
+        DCHECK_GT(spec.cardinality, 0);
+        DCHECK_LE(spec.min_length, spec.max_length);
+        if (spec.skew <= 0) {
+            continue;
+        }
+        auto& cdf = _zipf_cdfs[i];
+        cdf.resize(spec.cardinality);
+        double sum = 0;
+        for (int64_t rank = 0; rank < spec.cardinality; ++rank) {
+            sum += 1.0 / std::pow(static_cast<double>(rank + 1), spec.skew);
+            cdf[rank] = sum;
+        }
+        for (auto& probability : cdf) {
+            probability /= sum;
+        }
+    }
+}
+
+vectorized::DataTypes BenchmarkDataGenerator::data_types() const {
+    vectorized::DataTypes types;
+    for (const auto& spec : _specs) {
+        vectorized::DataTypePtr type;
+        if (spec.type == TYPE_STRING) {
+            type = std::make_shared<vectorized::DataTypeString>();
+        } else {
+            type = std::make_shared<vectorized::DataTypeInt64>();
+        }
+        if (spec.null_ratio > 0) {
+            type = vectorized::make_nullable(type);
+        }
+        types.push_back(std::move(type));
+    }
+    return types;
+}
+
+int64_t BenchmarkDataGenerator::_next_value(size_t column) {
+    const auto& cdf = _zipf_cdfs[column];
+    if (cdf.empty()) {
+        return std::uniform_int_distribution<int64_t>(0, _specs[column].cardinality - 1)(_rng);
+    }
+    double probability = std::uniform_real_distribution<double>(0, 1)(_rng);
+    auto it = std::lower_bound(cdf.begin(), cdf.end(), probability);
+    return std::min<int64_t>(it - cdf.begin(), cdf.size() - 1);
+}
+
+std::string BenchmarkDataGenerator::_string_value(const BenchmarkColumnSpec& spec,
+                                                  int64_t value) const {
+    // derive the length from the value, so every distinct value has a stable length
+    size_t length = spec.min_length + std::hash<int64_t>()(value) %
+                                              (spec.max_length - spec.min_length + 1);
+    std::string prefix = std::to_string(value);
+    std::string str;
+    str.reserve(length);
+    while (str.size() < length) {
+        str.append(prefix, 0, std::min(prefix.size(), length - str.size()));
+    }
+    return str;
+}
+
+vectorized::Block BenchmarkDataGenerator::next_block(size_t rows) {
+    vectorized::Block block;
+    auto types = data_types();
+    for (size_t i = 0; i < _specs.size(); ++i) {
+        const auto& spec = _specs[i];
+        auto nested_column = vectorized::remove_nullable(types[i])->create_column();
+        auto null_map = vectorized::ColumnUInt8::create();
+        std::bernoulli_distribution is_null(spec.null_ratio);
+        for (size_t row = 0; row < rows; ++row) {
+            null_map->insert_value(spec.null_ratio > 0 && is_null(_rng));
+            int64_t value = _next_value(i);
+            if (spec.type == TYPE_STRING) {
+                auto str = _string_value(spec, value);
+                nested_column->insert_data(str.data(), str.size());
+            } else {
+                assert_cast<vectorized::ColumnInt64&>(*nested_column).insert_value(value);
+            }
+        }
+        vectorized::ColumnPtr column = std::move(nested_column);
+        if (types[i]->is_nullable()) {
+            column = vectorized::ColumnNullable::create(column, std::move(null_map));
+        }
+        block.insert({column, types[i], fmt::format("c{}", i)});
+    }
+    return block;
+}
+
+Status BenchmarkSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* block,
+                                           bool* eos) {
+    if (_emitted_blocks < _num_blocks) {
+        *block = _generator->next_block(_block_rows);
+        _rows += block->rows();
+        ++_emitted_blocks;
+    }
+    *eos = _emitted_blocks == _num_blocks;
+    return Status::OK();
+}
+
+std::string OperatorBenchmarkResult::to_string() const {
+    return fmt::format(
+            "input rows: {}, output rows: {}, elapsed: {}ms, rows/s: {:.0f}, peak memory: {} "
+            "bytes, spill: {} bytes",
+            input_rows, output_rows, elapsed_ns / 1000000, rows_per_second(), peak_memory_bytes,
+            spill_bytes);
+}
+
+void OperatorBenchmarkHelper::add_pipeline(std::vector<OperatorPtr> operators,
+                                           DataSinkOperatorPtr sink) {
+    auto pipeline = std::make_shared<Pipeline>(static_cast<int>(_pipelines.size()), 1, 1);
+    for (auto& op : operators) {
+        static_cast<void>(pipeline->add_operator(op, 1));
+    }
+    static_cast<void>(pipeline->set_sink(sink));
+    _pipelines.push_back(std::move(pipeline));
+}
+
+static void empty_function(RuntimeState*, Status*) {}
+
+Status OperatorBenchmarkHelper::run(OperatorBenchmarkResult* result) {
+    // a new query for every run, so the peak memory only covers this run
+    TUniqueId query_id;
+    query_id.__set_hi(0);
+    query_id.__set_lo(UnixMillis());
+    TNetworkAddress fe_address;
+    fe_address.hostname = BackendOptions::get_localhost();
+    fe_address.port = config::brpc_port;
+    auto query_ctx = QueryContext::create(query_id, ExecEnv::GetInstance(), query_options,
+                                          fe_address, true, fe_address,
+                                          QuerySource::INTERNAL_FRONTEND);
+    auto fragment_context = std::make_shared<PipelineFragmentContext>(
+            query_id, 0, query_ctx, ExecEnv::GetInstance(), empty_function,
+            std::bind<Status>(std::mem_fn(&FragmentMgr::trigger_pipeline_context_report),
+                              ExecEnv::GetInstance()->fragment_mgr(), std::placeholders::_1,
+                              std::placeholders::_2));
+    DummyTaskQueue task_queue(1);
+
+    std::vector<std::unique_ptr<MockRuntimeState>> states;
+    std::vector<std::shared_ptr<RuntimeProfile>> profiles;
+    std::vector<std::shared_ptr<PipelineTask>> tasks;
+    for (auto& pipeline : _pipelines) {
+        auto state = std::make_unique<MockRuntimeState>(query_id, 0, query_options,
+                                                        query_ctx->query_globals,
+                                                        ExecEnv::GetInstance(), query_ctx.get());
+        state->batsh_size = query_options.batch_size;
+        state->set_task_execution_context(
+                std::static_pointer_cast<TaskExecutionContext>(fragment_context));
+        int min_operator_id = 0;
+        for (const auto& op : pipeline->operators()) {
+            min_operator_id = std::min(min_operator_id, op->operator_id());
+        }
+        state->resize_op_id_to_local_state(min_operator_id - 1);
+
+        auto profile = std::make_shared<RuntimeProfile>(
+                fmt::format("Pipeline : {}", pipeline->id()));
+        std::map<int, std::pair<std::shared_ptr<BasicSharedState>,
+                                std::vector<std::shared_ptr<Dependency>>>>
+                shared_state_map;
+        auto task = std::make_shared<PipelineTask>(pipeline, 0, state.get(), fragment_context,
+                                                   profile.get(), shared_state_map, 0);
+        task->set_task_queue(&task_queue);
+        if (!tasks.empty()) {
+            // the same as `PipelineFragmentContext::_build_pipeline_tasks`
+            auto& upstream = tasks.back();
+            if (auto shared_state = upstream->get_sink_shared_state()) {
+                task->inject_shared_state(shared_state);
+            } else {
+                upstream->inject_shared_state(task->get_source_shared_state());
+            }
+        }
+        states.push_back(std::move(state));
+        profiles.push_back(std::move(profile));
+        tasks.push_back(std::move(task));
+    }
+    for (auto& task : tasks) {
+        RETURN_IF_ERROR(task->prepare({}, 0, TDataSink()));
+    }
+    query_ctx->get_execution_dependency()->set_ready();
+
+    MonotonicStopWatch watch;
+    watch.start();
+    for (auto& task : tasks) {
+        bool done = false;
+        while (!done) {
+            RETURN_IF_ERROR(task->execute(&done));
+            if (!done && task->_exec_state == PipelineTask::State::BLOCKED) {
+                return Status::InternalError("task is blocked: {}", task->debug_string());
+            }
+        }
+        RETURN_IF_ERROR(task->close(Status::OK()));
+        RETURN_IF_ERROR(task->finalize());
+    }
+    result->elapsed_ns = watch.elapsed_time();
+
+    result->input_rows = 0;
+    for (auto& pipeline : _pipelines) {
+        for (const auto& op : pipeline->operators()) {
+            if (auto* source = dynamic_cast<BenchmarkSourceOperatorX*>(op.get())) {
+                result->input_rows += source->rows();
+            }
+        }
+    }
+    auto* sink = dynamic_cast<BenchmarkSinkOperatorX*>(_pipelines.back()->sink());
+    result->output_rows = sink ? sink->rows() : 0;
+    result->peak_memory_bytes = query_ctx->query_mem_tracker()->peak_consumption();
+    result->spill_bytes = 0;
+    for (auto& profile : profiles) {
+        std::vector<RuntimeProfile*> children;
+        profile->get_all_children(&children);
+        for (auto* child : children) {
+            if (auto* counter = child->get_counter("SpillWriteFileBytes")) {
+                result->spill_bytes += counter->value();
+            }
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace doris::pipeline
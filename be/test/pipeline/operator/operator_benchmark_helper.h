@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/PaloInternalService_types.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/object_pool.h"
+#include "common/status.h"
+#include "pipeline/exec/operator.h"
+#include "pipeline/pipeline.h"
+#include "pipeline/pipeline_task.h"
+#include "runtime/define_primitive_type.h"
+#include "testutil/mock/mock_descriptors.h"
+#include "testutil/mock/mock_runtime_state.h"
+#include "util/runtime_profile.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type.h"
+
+namespace doris::pipeline {
+
+// The distribution of one generated column.
+struct BenchmarkColumnSpec {
+    // TYPE_BIGINT or TYPE_STRING
+    PrimitiveType type = TYPE_BIGINT;
+    // number of distinct values
+    int64_t cardinality = 1024;
+    // exponent of the zipf distribution the values are drawn from, 0 means uniform
+    double skew = 0;
+    double null_ratio = 0;
+    // length range of the string values, each distinct value always has the same length
+    size_t min_length = 16;
+    size_t max_length = 16;
+};
+
+// Generates blocks whose columns follow the given specs. The same seed always generates the
+// same data, so runs of a benchmark before and after a change are comparable.
+class BenchmarkDataGenerator {
+public:
+    BenchmarkDataGenerator(std::vector<BenchmarkColumnSpec> specs, uint64_t seed = 0);
+
+    vectorized::DataTypes data_types() const;
+
+    vectorized::Block next_block(size_t rows);
+
+private:
+    int64_t _next_value(size_t column);
+
+    std::string _string_value(const BenchmarkColumnSpec& spec, int64_t value) const;
+
+    std::vector<BenchmarkColumnSpec> _specs;
+    // the cumulative probabilities of the values of the skewed columns
+    std::vector<std::vector<double>> _zipf_cdfs;
+    std::mt19937_64 _rng;
+};
+
+// Source operator which emits `num_blocks` generated blocks of `block_rows` rows.
+class BenchmarkSourceOperatorX final : public OperatorX<DummyOperatorLocalState> {
+public:
+    BenchmarkSourceOperatorX(ObjectPool* pool, int operator_id,
+                             std::shared_ptr<BenchmarkDataGenerator> generator, size_t num_blocks,
+                             size_t block_rows)
+            : OperatorX<DummyOperatorLocalState>(pool, 0, operator_id),
+              _generator(std::move(generator)),
+              _num_blocks(num_blocks),
+              _block_rows(block_rows),
+              _row_desc(_generator->data_types(), pool) {}
+
+    [[nodiscard]] bool is_source() const override { return true; }
+
+    Status get_block(RuntimeState* state, vectorized::Block* block, bool* eos) override;
+
+    const RowDescriptor& row_desc() const override { return _row_desc; }
+
+    int64_t rows() const { return _rows; }
+
+private:
+    std::shared_ptr<BenchmarkDataGenerator> _generator;
+    const size_t _num_blocks;
+    const size_t _block_rows;
+    size_t _emitted_blocks = 0;
+    int64_t _rows = 0;
+    MockRowDescriptor _row_desc;
+};
+
+// Sink operator which drops the blocks and counts their rows.
+class BenchmarkSinkOperatorX final : public DataSinkOperatorX<DummySinkLocalState> {
+public:
+    BenchmarkSinkOperatorX(int operator_id, int dest_id)
+            : DataSinkOperatorX<DummySinkLocalState>(operator_id, 0, dest_id) {}
+
+    Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos) override {
+        _rows += in_block->rows();
+        return Status::OK();
+    }
+
+    int64_t rows() const { return _rows; }
+
+private:
+    int64_t _rows = 0;
+};
+
+struct OperatorBenchmarkResult {
+    int64_t input_rows = 0;
+    int64_t output_rows = 0;
+    int64_t elapsed_ns = 0;
+    int64_t peak_memory_bytes = 0;
+    int64_t spill_bytes = 0;
+
+    double rows_per_second() const {
+        return elapsed_ns == 0 ? 0 : static_cast<double>(input_rows) * 1e9 / elapsed_ns;
+    }
+
+    std::string to_string() const;
+};
+
+// Runs pipelines of real operators with the `PipelineTask` execution loop, so the performance
+// of an operator can be measured on synthetic data without a cluster.
+//
+// The pipelines are added in the order of execution and the sink of every pipeline feeds the
+// source of the next one, e.g. a sort sink pipeline followed by a sort source pipeline. Each
+// pipeline has a single task which runs to the end before the next pipeline starts, so a sink
+// must not wait for its downstream pipeline to consume the data. The operators keep the state of
+// the generated data, so every run needs new operators.
+class OperatorBenchmarkHelper {
+public:
+    void add_pipeline(std::vector<OperatorPtr> operators, DataSinkOperatorPtr sink);
+
+    Status run(OperatorBenchmarkResult* result);
+
+    TQueryOptions query_options;
+    ObjectPool obj_pool;
+
+private:
+    std::vector<PipelinePtr> _pipelines;
+};
+
+} // namespace doris::pipeline
@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <memory>
+
+#include "operator_benchmark_helper.h"
+#include "pipeline/exec/sort_sink_operator.h"
+#include "pipeline/exec/sort_source_operator.h"
+#include "pipeline/exec/streaming_aggregation_operator.h"
+#include "pipeline/thrift_builder.h"
+#include "testutil/mock/mock_agg_fn_evaluator.h"
+#include "testutil/mock/mock_runtime_state.h"
+#include "testutil/mock/mock_slot_ref.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::pipeline {
+
+using namespace vectorized;
+
+struct BenchmarkStreamingAggOperatorX : public StreamingAggOperatorX {
+    BenchmarkStreamingAggOperatorX() = default;
+
+    Status _init_probe_expr_ctx(RuntimeState* state) override { return Status::OK(); }
+
+    Status _init_aggregate_evaluators(RuntimeState* state) override { return Status::OK(); }
+};
+
+// Benchmarks of single operators running in pipeline tasks, run them with
+// `--gtest_also_run_disabled_tests --gtest_filter=DISABLED_OperatorBenchmarkTest.*`.
+class DISABLED_OperatorBenchmarkTest : public testing::Test {
+public:
+    void SetUp() override {
+        _helper.query_options = TQueryOptionsBuilder().set_batch_size(BLOCK_ROWS).build();
+    }
+
+    std::shared_ptr<BenchmarkSourceOperatorX> create_source(
+            std::vector<BenchmarkColumnSpec> specs) {
+        return std::make_shared<BenchmarkSourceOperatorX>(
+                &_helper.obj_pool, 0, std::make_shared<BenchmarkDataGenerator>(std::move(specs)),
+                NUM_BLOCKS, BLOCK_ROWS);
+    }
+
+    // sort by the first column
+    void run_sort(std::vector<BenchmarkColumnSpec> specs, int64_t limit) {
+        auto types = BenchmarkDataGenerator(specs).data_types();
+        auto source = create_source(std::move(specs));
+        auto sink = std::make_shared<SortSinkOperatorX>(
+                &_helper.obj_pool,
+                limit > 0 ? TSortAlgorithm::HEAP_SORT : TSortAlgorithm::FULL_SORT, limit, 0);
+        sink->_is_asc_order = {true};
+        sink->_nulls_first = {false};
+        sink->_vsort_exec_exprs._sort_tuple_slot_expr_ctxs =
+                MockSlotRef::create_mock_contexts(types);
+        sink->_vsort_exec_exprs._materialize_tuple = false;
+        sink->_vsort_exec_exprs._ordering_expr_ctxs =
+                MockSlotRef::create_mock_contexts(0, types[0]);
+        ASSERT_TRUE(sink->set_child(source));
+        _helper.add_pipeline({source}, sink);
+        _helper.add_pipeline({std::make_shared<SortSourceOperatorX>()},
+                             std::make_shared<BenchmarkSinkOperatorX>(1, 2));
+        run();
+    }
+
+    // group by the first column and sum the second one
+    void run_streaming_agg(BenchmarkColumnSpec key_spec) {
+        auto source = create_source({key_spec, BenchmarkColumnSpec {}});
+        auto op = std::make_shared<BenchmarkStreamingAggOperatorX>();
+        op->_aggregate_evaluators.push_back(create_mock_agg_fn_evaluator(
+                _helper.obj_pool,
+                MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
+                false));
+        op->_pool = &_helper.obj_pool;
+        op->_needs_finalize = false;
+        op->_is_merge = false;
+        ASSERT_TRUE(op->set_child(source));
+        ASSERT_TRUE(op->prepare(&_state).ok());
+        op->_probe_expr_ctxs =
+                MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+        _helper.add_pipeline({source, op}, std::make_shared<BenchmarkSinkOperatorX>(1, 2));
+        run();
+    }
+
+    void run() {
+        OperatorBenchmarkResult result;
+        auto st = _helper.run(&result);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+        EXPECT_EQ(result.input_rows, static_cast<int64_t>(NUM_BLOCKS * BLOCK_ROWS));
+        std::cout << testing::UnitTest::GetInstance()->current_test_info()->name() << ": "
+                  << result.to_string() << std::endl;
+    }
+
+protected:
+    static constexpr size_t NUM_BLOCKS = 1024;
+    static constexpr size_t BLOCK_ROWS = 4096;
+
+    OperatorBenchmarkHelper _helper;
+    MockRuntimeState _state;
+};
+
+TEST_F(DISABLED_OperatorBenchmarkTest, sort_int) {
+    run_sort({BenchmarkColumnSpec {.cardinality = 1 << 20}}, 0);
+}
+
+TEST_F(DISABLED_OperatorBenchmarkTest, sort_skewed_nullable_string) {
+    run_sort({BenchmarkColumnSpec {.type = TYPE_STRING,
+                                   .cardinality = 1 << 16,
+                                   .skew = 1.1,
+                                   .null_ratio = 0.1,
+                                   .min_length = 8,
+                                   .max_length = 64}},
+             0);
+}
+
+TEST_F(DISABLED_OperatorBenchmarkTest, topn_int) {
+    run_sort({BenchmarkColumnSpec {.cardinality = 1 << 20}}, 100);
+}
+
+TEST_F(DISABLED_OperatorBenchmarkTest, streaming_agg_low_cardinality) {
+    run_streaming_agg(BenchmarkColumnSpec {.cardinality = 1024});
+}
+
+TEST_F(DISABLED_OperatorBenchmarkTest, streaming_agg_high_cardinality) {
+    run_streaming_agg(BenchmarkColumnSpec {.cardinality = 1 << 24});
+}
+
+TEST_F(DISABLED_OperatorBenchmarkTest, streaming_agg_skewed) {
+    run_streaming_agg(BenchmarkColumnSpec {.cardinality = 1 << 20, .skew = 1.2});
+}
+
+} // namespace doris::pipeline
@@ -253,6 +253,85 @@ TEST_F(PartitionedAggregationSinkOperatorTest, SinkWithSpill) {
     ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
 }
 
+TEST_F(PartitionedAggregationSinkOperatorTest, SinkWithSpillRetainPartitions) {
+    config::spill_aggregation_retain_partition_percent = 50;
+    Defer defer {[]() { config::spill_aggregation_retain_partition_percent = 0; }};
+    auto [source_operator, sink_operator] = _helper.create_operators();
+    ASSERT_TRUE(source_operator != nullptr);
+    ASSERT_TRUE(sink_operator != nullptr);
+
+    const auto tnode = _helper.create_test_plan_node();
+    auto st = sink_operator->init(tnode, _helper.runtime_state.get());
+    ASSERT_TRUE(st.ok()) << "init failed: " << st.to_string();
+
+    st = sink_operator->prepare(_helper.runtime_state.get());
+    ASSERT_TRUE(st.ok()) << "prepare failed: " << st.to_string();
+
+    auto shared_state = sink_operator->create_shared_state();
+    auto* dep = shared_state->create_source_dependency(source_operator->operator_id(),
+                                                       source_operator->node_id(),
+                                                       "PartitionedAggSinkTestDep");
+
+    LocalSinkStateInfo info {.task_idx = 0,
+                             .parent_profile = _helper.runtime_profile.get(),
+                             .sender_id = 0,
+                             .shared_state = shared_state.get(),
+                             .shared_state_map = {},
+                             .tsink = TDataSink()};
+    st = sink_operator->setup_local_state(_helper.runtime_state.get(), info);
+    ASSERT_TRUE(st.ok()) << "setup_local_state failed: " << st.to_string();
+
+    auto* local_state = reinterpret_cast<PartitionedAggSinkLocalState*>(
+            _helper.runtime_state->get_sink_local_state());
+    ASSERT_TRUE(local_state != nullptr);
+
+    st = local_state->open(_helper.runtime_state.get());
+    ASSERT_TRUE(st.ok()) << "open failed: " << st.to_string();
+
+    auto block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(
+            {1, 2, 3, 4, 2, 3, 4, 3, 4, 4});
+
+    block.insert(vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeInt32>(
+            {1, 2, 3, 4, 2, 3, 4, 3, 4, 4}));
+
+    st = sink_operator->sink(_helper.runtime_state.get(), &block, false);
+    ASSERT_TRUE(st.ok()) << "sink failed: " << st.to_string();
+
+    st = sink_operator->revoke_memory(_helper.runtime_state.get(), nullptr);
+    ASSERT_TRUE(st.ok()) << "revoke_memory failed: " << st.to_string();
+
+    while (local_state->_spill_dependency->is_blocked_by()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // at most half of the 4 groups stay in the hash table, the others are on disk
+    auto* spill_write_rows_counter = local_state->profile()->get_counter("SpillWriteRows");
+    auto* spill_retained_rows_counter = local_state->profile()->get_counter("SpillRetainedRows");
+    ASSERT_TRUE(spill_write_rows_counter != nullptr);
+    ASSERT_TRUE(spill_retained_rows_counter != nullptr);
+    auto* inner_sink_local_state = reinterpret_cast<AggSinkLocalState*>(
+            local_state->_runtime_state->get_sink_local_state());
+    const auto retained_rows = spill_retained_rows_counter->value();
+    ASSERT_LE(retained_rows, 2);
+    ASSERT_EQ((int64_t)inner_sink_local_state->_get_hash_table_size(), retained_rows);
+    ASSERT_EQ(spill_write_rows_counter->value() + retained_rows, 4);
+
+    // the spilled partitions are spilled again at eos, the retained ones stay in memory
+    st = sink_operator->sink(_helper.runtime_state.get(), &block, true);
+    ASSERT_TRUE(st.ok()) << "sink failed: " << st.to_string();
+
+    while (local_state->_spill_dependency->is_blocked_by()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ((int64_t)inner_sink_local_state->_get_hash_table_size(), retained_rows);
+    ASSERT_EQ(spill_write_rows_counter->value(), (4 - retained_rows) * 2);
+    ASSERT_FALSE(dep->is_blocked_by());
+
+    st = sink_operator->close(_helper.runtime_state.get(), st);
+    ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
+}
+
 TEST_F(PartitionedAggregationSinkOperatorTest, SinkWithSpillAndEmptyEOS) {
     auto [source_operator, sink_operator] = _helper.create_operators();
     ASSERT_TRUE(source_operator != nullptr);
@@ -1136,4 +1136,59 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, Other) {
     ASSERT_TRUE(st.ok()) << "Revoke memory failed: " << st.to_string();
 }
 
-} // namespace doris::pipeline
\ No newline at end of file
+TEST_F(PartitionedHashJoinProbeOperatorTest, RepartitionChannelIds) {
+    constexpr size_t partition_count = 16;
+    // The hashes which are in the same partition at level 0.
+    std::vector<uint32_t> hashes;
+    for (uint32_t hash = 0; hashes.size() < 4096; ++hash) {
+        if (vectorized::SpillPartitionChannelIds()(hash, partition_count) == 3) {
+            hashes.emplace_back(hash);
+        }
+    }
+
+    for (uint32_t level = 1; level <= 3; ++level) {
+        std::vector<size_t> counts(partition_count);
+        for (auto hash : hashes) {
+            auto channel_id =
+                    vectorized::SpillRepartitioner::channel_id(hash, level, partition_count);
+            ASSERT_LT(channel_id, partition_count);
+            ++counts[channel_id];
+        }
+        for (auto count : counts) {
+            ASSERT_GT(count, hashes.size() / partition_count / 2) << "level: " << level;
+        }
+    }
+}
+
+TEST_F(PartitionedHashJoinProbeOperatorTest, PullAfterRepartition) {
+    auto [probe_operator, sink_operator] = _helper.create_operators();
+    std::shared_ptr<MockPartitionedHashJoinSharedState> shared_state;
+    auto local_state = _helper.create_probe_local_state(_helper.runtime_state.get(),
+                                                        probe_operator.get(), shared_state);
+
+    // A sub partition was appended when repartitioning the last partition.
+    local_state->_partition_levels.push_back({1, true});
+    local_state->_partitioned_blocks.emplace_back();
+    local_state->_probe_spilling_streams.emplace_back();
+    shared_state->spilled_streams.emplace_back();
+    shared_state->partitioned_build_blocks.emplace_back();
+
+    local_state->_partition_cursor = PartitionedHashJoinTestHelper::TEST_PARTITION_COUNT - 1;
+    local_state->_partition_repartitioned = true;
+
+    vectorized::Block output_block;
+    bool eos = false;
+    auto st = probe_operator->pull(_helper.runtime_state.get(), &output_block, &eos);
+    ASSERT_TRUE(st.ok()) << "Pull failed: " << st.to_string();
+    ASSERT_FALSE(eos);
+    ASSERT_FALSE(local_state->_partition_repartitioned);
+    ASSERT_TRUE(local_state->_need_to_setup_internal_operators);
+    ASSERT_EQ(PartitionedHashJoinTestHelper::TEST_PARTITION_COUNT,
+              local_state->_partition_cursor);
+
+    st = probe_operator->pull(_helper.runtime_state.get(), &output_block, &eos);
+    ASSERT_TRUE(st.ok()) << "Pull failed: " << st.to_string();
+    ASSERT_TRUE(eos) << "The sub partition is the last one";
+}
+
+} // namespace doris::pipeline
@@ -183,6 +183,7 @@ PartitionedHashJoinProbeLocalState* PartitionedHashJoinTestHelper::create_probe_
 
     local_state->_partitioned_blocks.resize(probe_operator->_partition_count);
     local_state->_probe_spilling_streams.resize(probe_operator->_partition_count);
+    local_state->_partition_levels.resize(probe_operator->_partition_count);
 
     local_state->_spill_dependency =
             Dependency::create_shared(0, 0, "PartitionedHashJoinProbeOperatorTestSpillDep", true);
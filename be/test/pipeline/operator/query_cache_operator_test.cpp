@@ -23,6 +23,7 @@
 #include "pipeline/exec/cache_sink_operator.h"
 #include "pipeline/exec/cache_source_operator.h"
 #include "pipeline/exec/repeat_operator.h"
+#include "runtime/query_context.h"
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_descriptors.h"
 #include "testutil/mock/mock_runtime_state.h"
@@ -270,4 +271,78 @@ TEST_F(QueryCacheOperatorTest, test_hit_cache) {
     query_cache_uptr.release();
 }
 
+TEST_F(QueryCacheOperatorTest, test_incremental_hit_cache) {
+    sink = std::make_unique<CacheSinkOperatorX>();
+    source = std::make_unique<CacheSourceOperatorX>();
+    EXPECT_TRUE(source->set_child(child_op));
+    child_op->_mock_row_desc.reset(
+            new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt64>()}, &pool});
+    TQueryCacheParam cache_param;
+    cache_param.node_id = 0;
+    cache_param.output_slot_mapping[0] = 0;
+    cache_param.tablet_to_range.insert({42, "test"});
+    cache_param.force_refresh_query_cache = false;
+    cache_param.entry_max_bytes = 1024 * 1024;
+    cache_param.entry_max_rows = 1000;
+
+    int64_t version = 0;
+    std::string cache_key;
+    EXPECT_TRUE(QueryCache::build_cache_key(scan_ranges, cache_param, &cache_key, &version));
+    {
+        // the cached result of an older version, refreshed by the rows loaded since then
+        CacheResult result;
+        result.push_back(std::make_unique<Block>());
+        *result.back() = ColumnHelper::create_block<DataTypeInt64>({1, 2, 3});
+        query_cache->insert(cache_key, version - 10, result, {0}, 1);
+        auto lookup = std::make_shared<QueryCacheLookup>();
+        EXPECT_TRUE(query_cache->lookup(cache_key, version - 10, &lookup->handle));
+        lookup->incremental = true;
+        state->get_query_ctx()->query_cache_lookups.emplace(cache_key, lookup);
+    }
+
+    source->_cache_param = cache_param;
+    create_local_state();
+    EXPECT_TRUE(source_local_state->_incremental);
+
+    {
+        auto block = ColumnHelper::create_block<DataTypeInt64>({4, 5});
+        auto st = sink->sink(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+
+    {
+        Block block;
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt64>({1, 2, 3})));
+    }
+
+    {
+        Block block;
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(block,
+                                              ColumnHelper::create_block<DataTypeInt64>({4, 5})));
+    }
+
+    {
+        QueryCacheHandle handle;
+        EXPECT_TRUE(query_cache->lookup(cache_key, version, &handle));
+        EXPECT_EQ(handle.get_cache_version(), version);
+        const auto* result = handle.get_cache_result();
+        ASSERT_EQ(result->size(), 2);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                *result->at(0), ColumnHelper::create_block<DataTypeInt64>({1, 2, 3})));
+        EXPECT_TRUE(ColumnHelper::block_equal(*result->at(1),
+                                              ColumnHelper::create_block<DataTypeInt64>({4, 5})));
+    }
+
+    query_cache_uptr.release();
+}
+
 } // namespace doris::pipeline
\ No newline at end of file
@@ -0,0 +1,134 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/exec/join/sorted_merge_joiner.h"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::pipeline {
+
+using vectorized::Block;
+using vectorized::ColumnHelper;
+using vectorized::DataTypeInt64;
+
+class SortedMergeJoinerTest : public testing::Test {
+protected:
+    // Splits sorted (key, payload) rows into blocks of `block_rows` rows.
+    static SortedMergeJoiner::BlockSupplier make_supplier(std::vector<int64_t> keys,
+                                                          size_t block_rows) {
+        auto pos = std::make_shared<size_t>(0);
+        return [keys = std::move(keys), block_rows, pos](Block* block, bool* eos) {
+            size_t end = std::min(*pos + block_rows, keys.size());
+            std::vector<int64_t> key_data(keys.begin() + *pos, keys.begin() + end);
+            std::vector<int64_t> payload(end - *pos);
+            for (size_t i = 0; i < payload.size(); ++i) {
+                payload[i] = static_cast<int64_t>(*pos + i);
+            }
+            *block = ColumnHelper::create_block<DataTypeInt64>(key_data, payload);
+            *pos = end;
+            *eos = end == keys.size();
+            return Status::OK();
+        };
+    }
+
+    // Returns the joined (left payload, right payload) pairs.
+    static std::vector<std::pair<int64_t, int64_t>> join(SortedMergeJoiner& joiner) {
+        std::vector<std::pair<int64_t, int64_t>> result;
+        bool eos = false;
+        while (!eos) {
+            Block block;
+            EXPECT_TRUE(joiner.get_next(&block, &eos).ok());
+            if (block.rows() == 0) {
+                continue;
+            }
+            EXPECT_EQ(block.columns(), 4);
+            for (size_t i = 0; i < block.rows(); ++i) {
+                EXPECT_EQ(block.get_by_position(0).column->get_int(i),
+                          block.get_by_position(2).column->get_int(i));
+                result.emplace_back(block.get_by_position(1).column->get_int(i),
+                                    block.get_by_position(3).column->get_int(i));
+            }
+        }
+        return result;
+    }
+
+    static std::vector<std::pair<int64_t, int64_t>> nested_loop_join(
+            const std::vector<int64_t>& left, const std::vector<int64_t>& right) {
+        std::vector<std::pair<int64_t, int64_t>> result;
+        for (size_t l = 0; l < left.size(); ++l) {
+            for (size_t r = 0; r < right.size(); ++r) {
+                if (left[l] == right[r]) {
+                    result.emplace_back(l, r);
+                }
+            }
+        }
+        return result;
+    }
+};
+
+TEST_F(SortedMergeJoinerTest, DuplicateRunsAcrossBlocks) {
+    std::vector<int64_t> left {1, 2, 2, 2, 3, 5, 5, 7, 8, 8, 8, 8, 10};
+    std::vector<int64_t> right {0, 2, 2, 4, 5, 5, 5, 5, 5, 8, 8, 9, 10, 10, 11};
+    auto expected = nested_loop_join(left, right);
+    for (size_t left_block_rows : {1, 2, 5, 100}) {
+        for (size_t right_block_rows : {1, 3, 100}) {
+            for (size_t batch_size : {1, 4, 4096}) {
+                SortedMergeJoiner joiner(make_supplier(left, left_block_rows),
+                                         make_supplier(right, right_block_rows), {0}, {0}, true,
+                                         batch_size);
+                EXPECT_EQ(join(joiner), expected);
+                EXPECT_EQ(joiner.max_run_rows(), 5);
+            }
+        }
+    }
+}
+
+TEST_F(SortedMergeJoinerTest, EmptySide) {
+    SortedMergeJoiner joiner(make_supplier({}, 4), make_supplier({1, 2}, 4), {0}, {0}, true, 16);
+    EXPECT_TRUE(join(joiner).empty());
+    SortedMergeJoiner joiner2(make_supplier({1, 2}, 4), make_supplier({}, 4), {0}, {0}, true, 16);
+    EXPECT_TRUE(join(joiner2).empty());
+}
+
+TEST_F(SortedMergeJoinerTest, NullKeysNeverMatch) {
+    auto make_nullable = [](std::vector<int64_t> keys, std::vector<uint8_t> nulls) {
+        return [keys = std::move(keys), nulls = std::move(nulls)](Block* block, bool* eos) {
+            *block = ColumnHelper::create_nullable_block<DataTypeInt64>(keys, nulls);
+            *eos = true;
+            return Status::OK();
+        };
+    };
+    // nulls first
+    SortedMergeJoiner joiner(make_nullable({0, 0, 1, 2}, {1, 1, 0, 0}),
+                             make_nullable({0, 2, 3}, {1, 0, 0}), {0}, {0}, true, 16);
+    Block block;
+    bool eos = false;
+    size_t rows = 0;
+    while (!eos) {
+        EXPECT_TRUE(joiner.get_next(&block, &eos).ok());
+        rows += block.rows();
+    }
+    EXPECT_EQ(rows, 1);
+}
+
+} // namespace doris::pipeline
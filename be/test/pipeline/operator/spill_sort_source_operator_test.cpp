@@ -21,6 +21,8 @@
 
 #include <limits>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "pipeline/dependency.h"
@@ -81,6 +83,55 @@ TEST_F(SpillSortSourceOperatorTest, Basic) {
     ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
 }
 
+TEST_F(SpillSortSourceOperatorTest, StreamsToMerge) {
+    auto [source_operator, sink_operator] = _helper.create_operators();
+    ASSERT_TRUE(source_operator != nullptr);
+
+    auto tnode = _helper.create_test_plan_node();
+    auto st = source_operator->init(tnode, _helper.runtime_state.get());
+    ASSERT_TRUE(st.ok()) << "init failed: " << st.to_string();
+
+    st = source_operator->prepare(_helper.runtime_state.get());
+    ASSERT_TRUE(st.ok()) << "prepare failed: " << st.to_string();
+
+    auto shared_state =
+            std::dynamic_pointer_cast<SpillSortSharedState>(sink_operator->create_shared_state());
+    ASSERT_TRUE(shared_state != nullptr);
+
+    shared_state->in_mem_shared_state_sptr = std::make_shared<MockSortSharedState>();
+    shared_state->in_mem_shared_state =
+            static_cast<SortSharedState*>(shared_state->in_mem_shared_state_sptr.get());
+
+    LocalStateInfo info {.parent_profile = _helper.runtime_profile.get(),
+                         .scan_ranges = {},
+                         .shared_state = shared_state.get(),
+                         .shared_state_map = {},
+                         .task_idx = 0};
+
+    st = source_operator->setup_local_state(_helper.runtime_state.get(), info);
+    ASSERT_TRUE(st.ok()) << "setup_local_state failed: " << st.to_string();
+
+    auto* local_state = reinterpret_cast<SpillSortLocalState*>(
+            _helper.runtime_state->get_local_state(source_operator->operator_id()));
+    ASSERT_TRUE(local_state != nullptr);
+    ASSERT_GE(local_state->_calc_spill_blocks_to_merge(_helper.runtime_state.get()), 2);
+
+    // with a fan-in of 4, the first pass merges just enough streams that the later passes are
+    // full: 5 -> 4, 8 -> 7 -> 4, 7 -> 4 and 4 streams are merged at once.
+    for (auto [streams, expected] : std::vector<std::pair<size_t, int>> {
+                 {4, 4}, {3, 4}, {5, 2}, {7, 4}, {8, 2}, {10, 4}}) {
+        shared_state->sorted_streams.resize(streams);
+        EXPECT_EQ(local_state->_calc_streams_to_merge(4), expected) << streams;
+    }
+    shared_state->sorted_streams.clear();
+
+    st = local_state->close(_helper.runtime_state.get());
+    ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
+
+    st = source_operator->close(_helper.runtime_state.get());
+    ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
+}
+
 TEST_F(SpillSortSourceOperatorTest, GetBlock) {
     auto [source_operator, sink_operator] = _helper.create_operators();
     ASSERT_TRUE(source_operator != nullptr);
@@ -20,6 +20,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
 #include "pipeline/exec/aggregation_source_operator.h"
 #include "pipeline/exec/mock_operator.h"
@@ -406,4 +407,129 @@ TEST_F(StreamingAggOperatorTest, test4) {
     { EXPECT_TRUE(local_state->close(state.get()).ok()); }
 }
 
+TEST_F(StreamingAggOperatorTest, HotKeyCache) {
+    op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
+            false));
+    op->_pool = &pool;
+    op->_needs_finalize = false;
+    op->_is_merge = false;
+
+    EXPECT_TRUE(op->set_child(child_op));
+
+    EXPECT_TRUE(op->prepare(state.get()).ok());
+    op->_probe_expr_ctxs = MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+
+    {
+        auto local_state = std::make_unique<MockStreamingAggLocalState>(state.get(), op.get());
+        LocalStateInfo info {.parent_profile = &profile,
+                             .scan_ranges = {},
+                             .shared_state = nullptr,
+                             .shared_state_map = {},
+                             .task_idx = 0};
+
+        EXPECT_TRUE(local_state->init(state.get(), info).ok());
+        state->resize_op_id_to_local_state(-100);
+        state->emplace_local_state(op->operator_id(), std::move(local_state));
+    }
+
+    {
+        local_state =
+                static_cast<MockStreamingAggLocalState*>(state->get_local_state(op->operator_id()));
+        EXPECT_TRUE(local_state->open(state.get()).ok());
+    }
+
+    const auto hot_key_cache_size = config::streaming_agg_hot_key_cache_size;
+    config::streaming_agg_hot_key_cache_size = 2;
+    local_state->_preagg_mode = StreamingAggLocalState::PreAggMode::HOT_KEY_CACHE;
+    local_state->_num_windows = 1;
+
+    {
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 2, 2, 2, 3}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, false);
+        EXPECT_TRUE(st.ok()) << st.msg();
+
+        // key 3 is not in the cache and is passed through
+        EXPECT_EQ(local_state->_get_hash_table_size(), 2);
+        EXPECT_FALSE(op->need_more_input_data(state.get()));
+    }
+
+    {
+        bool eos = false;
+        vectorized::Block block;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_EQ(block.rows(), 1);
+    }
+
+    {
+        vectorized::Block block {ColumnHelper::create_column_with_name<DataTypeInt64>({3, 4, 1}),
+                                 ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 1})};
+        auto st = op->push(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_EQ(local_state->_get_hash_table_size(), 2);
+    }
+
+    {
+        bool eos = false;
+        vectorized::Block block;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_EQ(block.rows(), 2);
+        EXPECT_EQ(local_state->_hot_key_cache_miss_rows->value(), 3);
+    }
+
+    {
+        bool eos = false;
+        vectorized::Block block;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(eos);
+        EXPECT_EQ(block.rows(), 2);
+    }
+
+    config::streaming_agg_hot_key_cache_size = hot_key_cache_size;
+    { EXPECT_TRUE(local_state->close(state.get()).ok()); }
+}
+
+TEST_F(StreamingAggOperatorTest, ChoosePreAggMode) {
+    op->_pool = &pool;
+    op->_needs_finalize = false;
+    op->_is_merge = false;
+    EXPECT_TRUE(op->set_child(child_op));
+    EXPECT_TRUE(op->prepare(state.get()).ok());
+
+    auto local_state = std::make_unique<MockStreamingAggLocalState>(state.get(), op.get());
+    LocalStateInfo info {.parent_profile = &profile,
+                         .scan_ranges = {},
+                         .shared_state = nullptr,
+                         .shared_state_map = {},
+                         .task_idx = 0};
+    EXPECT_TRUE(local_state->init(state.get(), info).ok());
+
+    auto sample = [&](size_t rows, size_t ndv) {
+        std::vector<size_t> hashes(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            hashes[i] = i % ndv;
+        }
+        local_state->_preagg_sketch.clear();
+        local_state->_sketch_rows = 0;
+        local_state->_update_preagg_sketch(hashes.data(), rows);
+        local_state->_choose_preagg_mode();
+        return local_state->_preagg_mode;
+    };
+
+    using PreAggMode = StreamingAggLocalState::PreAggMode;
+    EXPECT_EQ(sample(65536, 100), PreAggMode::FULL);
+    EXPECT_EQ(sample(65536, 65536), PreAggMode::PASS_THROUGH);
+    EXPECT_EQ(sample(65536, 40000), PreAggMode::HOT_KEY_CACHE);
+    EXPECT_EQ(local_state->_preagg_full_windows->value(), 1);
+    EXPECT_EQ(local_state->_preagg_pass_through_windows->value(), 1);
+    EXPECT_EQ(local_state->_preagg_hot_key_windows->value(), 1);
+}
+
 } // namespace doris::pipeline
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/pipeline_tracing.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace doris::pipeline {
+
+TEST(PipelineTracingTest, RingBufferKeepsLatestEvents) {
+    TraceRingBuffer buffer(4);
+    for (uint64_t i = 0; i < 10; ++i) {
+        TraceEvent event;
+        event.start_time = i;
+        buffer.push(event);
+    }
+    std::vector<TraceEvent> events;
+    buffer.collect(&events);
+    ASSERT_EQ(events.size(), 4);
+    std::vector<uint64_t> start_times;
+    for (const auto& event : events) {
+        start_times.push_back(event.start_time);
+    }
+    std::sort(start_times.begin(), start_times.end());
+    EXPECT_EQ(start_times, (std::vector<uint64_t> {6, 7, 8, 9}));
+}
+
+TEST(PipelineTracingTest, SampleByQueryAndExport) {
+    PipelineTraceSampler sampler;
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(2);
+    EXPECT_FALSE(sampler.should_sample(query_id, 1));
+
+    sampler.add_traced_query(query_id);
+    EXPECT_TRUE(sampler.enabled());
+    EXPECT_TRUE(sampler.should_sample(query_id, 1));
+    // a traced query is only picked once
+    EXPECT_FALSE(sampler.should_sample(query_id, 1));
+
+    sampler.set_workload_group_sample_rate(1, 1.0);
+    EXPECT_TRUE(sampler.should_sample(query_id, 1));
+    EXPECT_FALSE(sampler.should_sample(query_id, 2));
+
+    TraceEvent run;
+    run.query_id_hi = 1;
+    run.query_id_lo = 2;
+    run.start_time = 100;
+    run.end_time = 150;
+    sampler.record(run);
+    TraceEvent block = run;
+    block.type = TraceEventType::BLOCK;
+    block.start_time = block.end_time = 150;
+    block.set_detail("HashJoinBuildDependency");
+    sampler.record(block);
+
+    auto trace = sampler.export_trace(&query_id);
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"dur\":50"), std::string::npos);
+    EXPECT_NE(trace.find("HashJoinBuildDependency"), std::string::npos);
+
+    TUniqueId other_query_id;
+    other_query_id.__set_hi(3);
+    other_query_id.__set_lo(4);
+    EXPECT_EQ(sampler.export_trace(&other_query_id).find("\"dur\""), std::string::npos);
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/descriptor_tbl_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "runtime/descriptor_helper.h"
+
+namespace doris {
+
+class DescriptorTblCacheTest : public testing::Test {
+protected:
+    static TDescriptorTable create_desc_tbl(const std::string& column_name) {
+        TDescriptorTableBuilder dtb;
+        TTupleDescriptorBuilder tuple_builder;
+        tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                       .type(TYPE_INT)
+                                       .column_name(column_name)
+                                       .column_pos(0)
+                                       .build());
+        tuple_builder.build(&dtb);
+        return dtb.desc_tbl();
+    }
+};
+
+TEST_F(DescriptorTblCacheTest, ShareSameTable) {
+    std::unique_ptr<DescriptorTblCache> cache(new DescriptorTblCache(16));
+
+    std::shared_ptr<CachedDescriptorTbl> first;
+    ASSERT_TRUE(cache->get_or_create(create_desc_tbl("k1"), &first).ok());
+    ASSERT_NE(first->desc_tbl, nullptr);
+    ASSERT_NE(first->desc_tbl->get_tuple_descriptor(0), nullptr);
+
+    std::shared_ptr<CachedDescriptorTbl> second;
+    ASSERT_TRUE(cache->get_or_create(create_desc_tbl("k1"), &second).ok());
+    EXPECT_EQ(first.get(), second.get());
+
+    std::shared_ptr<CachedDescriptorTbl> other;
+    ASSERT_TRUE(cache->get_or_create(create_desc_tbl("k2"), &other).ok());
+    EXPECT_NE(first.get(), other.get());
+    EXPECT_EQ(other->desc_tbl->get_tuple_descriptor(0)->slots()[0]->col_name(), "k2");
+}
+
+TEST_F(DescriptorTblCacheTest, EvictedTableStillAlive) {
+    std::unique_ptr<DescriptorTblCache> cache(new DescriptorTblCache(1));
+
+    std::shared_ptr<CachedDescriptorTbl> first;
+    ASSERT_TRUE(cache->get_or_create(create_desc_tbl("k1"), &first).ok());
+    std::shared_ptr<CachedDescriptorTbl> other;
+    ASSERT_TRUE(cache->get_or_create(create_desc_tbl("k2"), &other).ok());
+
+    // the evicted table is still held by the query which uses it
+    EXPECT_EQ(first->desc_tbl->get_tuple_descriptor(0)->slots()[0]->col_name(), "k1");
+}
+
+} // namespace doris
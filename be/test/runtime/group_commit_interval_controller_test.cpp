@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "runtime/group_commit_mgr.h"
+
+namespace doris {
+
+class GroupCommitIntervalControllerTest : public testing::Test {
+public:
+    void SetUp() override {
+        _min_interval_ms = config::group_commit_min_interval_ms;
+        config::group_commit_min_interval_ms = 50;
+    }
+    void TearDown() override { config::group_commit_min_interval_ms = _min_interval_ms; }
+
+private:
+    int32_t _min_interval_ms = 0;
+};
+
+TEST_F(GroupCommitIntervalControllerTest, NoLoadYet) {
+    GroupCommitIntervalController controller;
+    EXPECT_EQ(controller.interval_ms(10000, 64 << 20, 0), 10000);
+}
+
+TEST_F(GroupCommitIntervalControllerTest, FollowRate) {
+    GroupCommitIntervalController controller;
+    // 1KB per second, the window is shortened to the min interval
+    controller.update(1024, 1000, 10);
+    EXPECT_EQ(controller.interval_ms(10000, 64 << 20, 0), 50);
+    // never longer than the interval of the table
+    EXPECT_EQ(controller.interval_ms(20, 64 << 20, 0), 20);
+
+    // 64MB per second fills a batch before the interval ends, commits are made by data size
+    GroupCommitIntervalController fast;
+    fast.update(64 << 20, 1000, 10);
+    EXPECT_EQ(fast.interval_ms(10000, 64 << 20, 0), 10000);
+
+    // the rate in between, half of a batch in one interval
+    GroupCommitIntervalController medium;
+    medium.update(32 << 20, 8192, 10);
+    EXPECT_EQ(medium.interval_ms(8192, 64 << 20, 0), 4096);
+    // the rate is averaged with the next one
+    medium.update(0, 8192, 10);
+    EXPECT_EQ(medium.interval_ms(8192, 64 << 20, 0), 2048);
+}
+
+TEST_F(GroupCommitIntervalControllerTest, CommitLatency) {
+    GroupCommitIntervalController controller;
+    controller.update(1024, 1000, 400);
+    EXPECT_EQ(controller.interval_ms(10000, 64 << 20, 0), 50);
+    // loads are still committing, don't start the next commits faster than they finish
+    EXPECT_EQ(controller.interval_ms(10000, 64 << 20, 2), 800);
+    EXPECT_EQ(controller.interval_ms(10000, 64 << 20, 100), 10000);
+}
+
+} // namespace doris
@@ -20,8 +20,10 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <cstdint>
 #include <memory>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "vec/common/allocator_fwd.h"
 
@@ -59,4 +61,32 @@ TEST(AllocatorTest, TestNormal) {
     test_normal();
 }
 
+template <typename T>
+void test_huge_page_allocator(T allocator) {
+    constexpr size_t size = 6 * 1024 * 1024;
+    auto* ptr = reinterpret_cast<char*>(allocator.alloc(size));
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % (2 * 1024 * 1024));
+    EXPECT_EQ(0, ptr[size - 1]);
+    ptr[0] = 1;
+    ptr[size - 1] = 2;
+    ptr = reinterpret_cast<char*>(allocator.realloc(ptr, size, size * 2));
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(1, ptr[0]);
+    EXPECT_EQ(2, ptr[size - 1]);
+    EXPECT_EQ(0, ptr[size * 2 - 1]);
+    allocator.free(ptr, size * 2);
+}
+
+TEST(AllocatorTest, TestHugePage) {
+    auto mmap_threshold = config::mmap_threshold;
+    auto mmap_huge_page_threshold = config::mmap_huge_page_threshold;
+    config::mmap_threshold = 4 * 1024 * 1024;
+    config::mmap_huge_page_threshold = 4 * 1024 * 1024;
+    test_huge_page_allocator(Allocator<false, false, true>());
+    test_huge_page_allocator(Allocator<true, true, true>());
+    config::mmap_threshold = mmap_threshold;
+    config::mmap_huge_page_threshold = mmap_huge_page_threshold;
+}
+
 } // namespace doris
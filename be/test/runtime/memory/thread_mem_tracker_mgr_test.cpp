@@ -233,6 +233,38 @@ TEST_F(ThreadMemTrackerMgrTest, MultiMemTracker) {
     EXPECT_EQ(t3->consumption(), size2);
 }
 
+TEST_F(ThreadMemTrackerMgrTest, BatchConsumeConsumerTracker) {
+    std::unique_ptr<ThreadContext> thread_context = std::make_unique<ThreadContext>();
+    std::shared_ptr<MemTrackerLimiter> t1 = MemTrackerLimiter::create_shared(
+            MemTrackerLimiter::Type::OTHER, "UT-BatchConsumeConsumerTracker1");
+    std::shared_ptr<MemTracker> t2 =
+            std::make_shared<MemTracker>("UT-BatchConsumeConsumerTracker2");
+    std::shared_ptr<ResourceContext> rc = ResourceContext::create_shared();
+    rc->memory_context()->set_mem_tracker(t1);
+    config::enable_consumer_mem_tracker_batch_consume = true;
+
+    int64_t size1 = 4 * 1024;
+    int64_t size2 = 4 * 1024 * 1024;
+
+    thread_context->attach_task(rc);
+    thread_context->thread_mem_tracker_mgr->push_consumer_tracker(t2.get());
+    thread_context->thread_mem_tracker_mgr->consume(size1);
+    EXPECT_EQ(t2->consumption(), 0); // _untracked_consumer_mem = size1
+    thread_context->thread_mem_tracker_mgr->consume(size2);
+    EXPECT_EQ(t2->consumption(), size1 + size2);
+    thread_context->thread_mem_tracker_mgr->consume(-size1);
+    EXPECT_EQ(t2->consumption(), size1 + size2);
+    // pop flushes the untracked consumer mem before the tracker leaves the stack
+    thread_context->thread_mem_tracker_mgr->pop_consumer_tracker();
+    EXPECT_EQ(t2->consumption(), size2);
+
+    thread_context->thread_mem_tracker_mgr->consume(-size2);
+    thread_context->detach_task(); // detach t1
+    EXPECT_EQ(t1->consumption(), 0);
+    EXPECT_EQ(t2->consumption(), size2);
+    config::enable_consumer_mem_tracker_batch_consume = false;
+}
+
 TEST_F(ThreadMemTrackerMgrTest, ReserveMemory) {
     std::unique_ptr<ThreadContext> thread_context = std::make_unique<ThreadContext>();
     std::shared_ptr<MemTrackerLimiter> t =
@@ -182,4 +182,50 @@ TEST_F(ThreadContextTest, MixedScoped) {
     EXPECT_EQ(peak_mem2, 4 * 1024 * 2);
 }
 
+TEST_F(ThreadContextTest, RecordReadTier) {
+    using ReadTier = IOContext::ReadTier;
+    size_t bytes_read = 0;
+    {
+        // not attached to a task, nothing is recorded
+        SCOPED_RECORD_READ_TIER(ReadTier::LOCAL_DISK, &bytes_read);
+        bytes_read = 1024;
+    }
+    auto* io_context = rc1->io_context();
+    {
+        auto scoped = AttachTask(rc1);
+        {
+            SCOPED_RECORD_READ_TIER(ReadTier::LOCAL_DISK, &bytes_read);
+            bytes_read = 1024;
+        }
+        {
+            size_t file_cache_bytes_read = 0;
+            SCOPED_RECORD_READ_TIER(ReadTier::FILE_CACHE, &file_cache_bytes_read);
+            {
+                // the local file of the file cache is not attributed to the local disk
+                SCOPED_RECORD_READ_TIER(ReadTier::LOCAL_DISK, &bytes_read);
+                bytes_read = 4096;
+            }
+            file_cache_bytes_read = 4096;
+        }
+        {
+            SCOPED_RECORD_READ_TIER(ReadTier::LOCAL_DISK, &bytes_read);
+            bytes_read = 2048;
+        }
+    }
+    EXPECT_EQ(io_context->read_ios(ReadTier::LOCAL_DISK), 2);
+    EXPECT_EQ(io_context->read_bytes(ReadTier::LOCAL_DISK), 1024 + 2048);
+    EXPECT_EQ(io_context->read_ios(ReadTier::FILE_CACHE), 1);
+    EXPECT_EQ(io_context->read_bytes(ReadTier::FILE_CACHE), 4096);
+    EXPECT_EQ(io_context->read_ios(ReadTier::REMOTE_STORAGE), 0);
+
+    io_context->update_read(ReadTier::REMOTE_STORAGE, 1, 100, 50'000'000);
+    io_context->update_read(ReadTier::REMOTE_STORAGE, 1, 100, 2'000'000'000);
+    io_context->update_read(ReadTier::PAGE_CACHE, 10, 1000, -1);
+    EXPECT_EQ(io_context->read_latency_bucket(ReadTier::REMOTE_STORAGE, 3), 1);
+    EXPECT_EQ(io_context->read_latency_bucket(ReadTier::REMOTE_STORAGE, 5), 1);
+    EXPECT_EQ(io_context->read_time_ns(ReadTier::REMOTE_STORAGE), 2'050'000'000);
+    EXPECT_EQ(io_context->read_ios(ReadTier::PAGE_CACHE), 10);
+    EXPECT_EQ(io_context->read_time_ns(ReadTier::PAGE_CACHE), 0);
+}
+
 } // end namespace doris
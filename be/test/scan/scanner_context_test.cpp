@@ -847,4 +847,89 @@ TEST_F(ScannerContextTest, get_block_from_queue) {
     EXPECT_EQ(scanner_context->_num_finished_scanners, 1);
 }
 
+TEST_F(ScannerContextTest, adjust_scan_concurrency) {
+    const int parallel_tasks = 1;
+    auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+
+    auto olap_scan_local_state =
+            pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
+
+    const int64_t limit = 100;
+
+    OlapScanner::Params scanner_params;
+    scanner_params.state = state.get();
+    scanner_params.profile = profile.get();
+    scanner_params.limit = limit;
+    scanner_params.key_ranges = std::vector<OlapScanRange*>(); // empty
+
+    std::shared_ptr<Scanner> scanner =
+            OlapScanner::create_shared(olap_scan_local_state.get(), std::move(scanner_params));
+
+    std::list<std::shared_ptr<ScannerDelegate>> scanners;
+    for (int i = 0; i < 11; ++i) {
+        scanners.push_back(std::make_shared<ScannerDelegate>(scanner));
+    }
+
+    std::shared_ptr<ScannerContext> scanner_context = ScannerContext::create_shared(
+            state.get(), olap_scan_local_state.get(), output_tuple_desc, output_row_descriptor,
+            scanners, limit, scan_dependency, parallel_tasks);
+
+    // Not adjusted before init
+    scanner_context->_max_scan_concurrency = 8;
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_scan_concurrency_limit(), 8);
+
+    scanner_context->_min_scan_concurrency = 1;
+    scanner_context->_target_scan_concurrency = 8;
+    scanner_context->_max_bytes_in_queue = 100;
+
+    // Memory of the scan queue is used up, halve the scanners
+    scanner_context->_block_memory_usage = 200;
+    scanner_context->_last_adjust_concurrency_ms = 0;
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_scan_concurrency_limit(), 4);
+
+    // Not adjusted again within the interval
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_scan_concurrency_limit(), 4);
+
+    scanner_context->_last_adjust_concurrency_ms = 0;
+    scanner_context->_adjust_scan_concurrency();
+    scanner_context->_last_adjust_concurrency_ms = 0;
+    scanner_context->_adjust_scan_concurrency();
+    scanner_context->_last_adjust_concurrency_ms = 0;
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_scan_concurrency_limit(), 1);
+
+    // Consumer starved, add one scanner, or two if the scanners wait for IO
+    scanner_context->_consumer_starved = true;
+    scanner_context->_scan_tasks_cpu_ns = 10;
+    scanner_context->_scan_tasks_wall_ns = 11;
+    scanner_context->_last_adjust_concurrency_ms = 0;
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_scan_concurrency_limit(), 2);
+    ASSERT_FALSE(scanner_context->_consumer_starved);
+
+    scanner_context->_consumer_starved = true;
+    scanner_context->_scan_tasks_cpu_ns = 1;
+    scanner_context->_scan_tasks_wall_ns = 10;
+    scanner_context->_last_adjust_concurrency_ms = 0;
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_scan_concurrency_limit(), 4);
+
+    for (int i = 0; i < 5; ++i) {
+        scanner_context->_consumer_starved = true;
+        scanner_context->_last_adjust_concurrency_ms = 0;
+        scanner_context->_adjust_scan_concurrency();
+    }
+    ASSERT_EQ(scanner_context->_scan_concurrency_limit(), 8);
+
+    config::enable_adaptive_scan_concurrency = false;
+    scanner_context->_target_scan_concurrency = 2;
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_scan_concurrency_limit(), 8);
+    config::enable_adaptive_scan_concurrency = true;
+}
+
 } // namespace doris::vectorized
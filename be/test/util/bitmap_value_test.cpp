@@ -896,6 +896,50 @@ TEST(BitmapValueTest, bitmap_union) {
     config::enable_set_in_bitmap_value = old_config;
 }
 
+TEST(BitmapValueTest, bitmap_fastunion_many) {
+    bool old_config = config::enable_set_in_bitmap_value;
+    config::enable_set_in_bitmap_value = false;
+    // the values are spread over many 32-bit bitmaps
+    constexpr uint64_t high = uint64_t(1) << 32;
+    std::vector<BitmapValue> values;
+    values.emplace_back(std::vector<uint64_t> {1, high + 1, 2 * high + 1});
+    values.emplace_back(std::vector<uint64_t> {2, high + 1, high + 2, 3 * high});
+    values.emplace_back(uint64_t(5));
+    values.emplace_back(std::vector<uint64_t> {2 * high + 2, 7});
+    BitmapValue expected;
+    for (const auto& value : values) {
+        expected |= value;
+    }
+
+    std::vector<const BitmapValue*> inputs;
+    for (const auto& value : values) {
+        inputs.push_back(&value);
+    }
+    BitmapValue empty;
+    empty.fastunion(inputs);
+    EXPECT_EQ(expected.to_string(), empty.to_string());
+
+    BitmapValue bitmap({0, high + 3, 4 * high});
+    bitmap.fastunion(inputs);
+    expected |= BitmapValue({0, high + 3, 4 * high});
+    EXPECT_EQ(expected.to_string(), bitmap.to_string());
+
+    // the only bitmap is shared until the result is written
+    BitmapValue shared;
+    shared.fastunion({&values[0]});
+    EXPECT_EQ(values[0].to_string(), shared.to_string());
+    shared.add(9);
+    EXPECT_EQ(3, values[0].cardinality());
+    EXPECT_EQ(4, shared.cardinality());
+
+    detail::Roaring64Map roaring64_map;
+    const std::vector<uint64_t> unsorted({high + 2, 1, high + 1, 1, 2 * high, high + 2, 3});
+    roaring64_map.addMany(unsorted.size(), unsorted.data());
+    EXPECT_EQ(roaring64_map.cardinality(), 5);
+    EXPECT_TRUE(roaring64_map.contains(uint64_t(2 * high)));
+    config::enable_set_in_bitmap_value = old_config;
+}
+
 TEST(BitmapValueTest, bitmap_intersect) {
     BitmapValue empty;
     BitmapValue single(1024);
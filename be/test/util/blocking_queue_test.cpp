@@ -23,6 +23,7 @@
 
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace doris {
 
@@ -51,6 +52,38 @@ TEST(BlockingQueueTest, TestGetFromShutdownQueue) {
     EXPECT_FALSE(test_queue.blocking_get(&i));
 }
 
+TEST(BlockingQueueTest, TestBatch) {
+    BlockingQueue<int32_t> test_queue(3);
+    std::vector<int32_t> vals {1, 2, 3, 4, 5};
+    std::thread getter([&test_queue]() {
+        // the put of the last two values waits for this get
+        std::vector<int32_t> out;
+        EXPECT_TRUE(test_queue.controlled_blocking_get_batch(&out, 2, 100));
+        EXPECT_EQ((std::vector<int32_t> {1, 2}), out);
+    });
+    EXPECT_TRUE(test_queue.controlled_blocking_put_batch(&vals, 100));
+    EXPECT_TRUE(vals.empty());
+    getter.join();
+
+    std::vector<int32_t> out;
+    EXPECT_TRUE(test_queue.controlled_blocking_get_batch(&out, 10, 100));
+    EXPECT_EQ((std::vector<int32_t> {3, 4, 5}), out);
+
+    // the values which are not put are left to the caller
+    vals = {6, 7, 8, 9};
+    std::thread stopper([&test_queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        test_queue.shutdown();
+    });
+    EXPECT_FALSE(test_queue.controlled_blocking_put_batch(&vals, 100));
+    stopper.join();
+    EXPECT_EQ((std::vector<int32_t> {9}), vals);
+    out.clear();
+    EXPECT_TRUE(test_queue.controlled_blocking_get_batch(&out, 10, 100));
+    EXPECT_EQ((std::vector<int32_t> {6, 7, 8}), out);
+    EXPECT_FALSE(test_queue.controlled_blocking_get_batch(&out, 10, 100));
+}
+
 class MultiThreadTest {
 public:
     MultiThreadTest()
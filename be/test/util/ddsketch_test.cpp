@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/ddsketch.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace doris {
+
+static void check_quantiles(const DDSketch& sketch, std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    for (double q : {0.0, 0.01, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 1.0}) {
+        double expected = values[static_cast<size_t>(q * static_cast<double>(values.size() - 1))];
+        EXPECT_NEAR(sketch.quantile(q), expected,
+                    std::abs(expected) * sketch.relative_accuracy() + 1e-12)
+                << "quantile " << q;
+    }
+}
+
+TEST(DDSketchTest, Empty) {
+    DDSketch sketch;
+    EXPECT_EQ(0, sketch.count());
+    EXPECT_TRUE(std::isnan(sketch.quantile(0.5)));
+
+    sketch.add(std::nan(""));
+    sketch.add(INFINITY);
+    EXPECT_EQ(0, sketch.count());
+}
+
+TEST(DDSketchTest, RelativeAccuracy) {
+    std::mt19937_64 rng(0);
+    std::lognormal_distribution<double> latency(3, 2);
+    std::vector<double> values(100000);
+    for (auto& value : values) {
+        value = latency(rng);
+    }
+    values[0] = 0;
+    values[1] = -5;
+
+    DDSketch sketch;
+    sketch.add_batch(values.data(), values.size());
+    EXPECT_EQ(values.size(), sketch.count());
+    check_quantiles(sketch, values);
+
+    DDSketch accurate(0.001);
+    for (double value : values) {
+        accurate.add(value);
+    }
+    check_quantiles(accurate, values);
+}
+
+TEST(DDSketchTest, Merge) {
+    std::mt19937_64 rng(0);
+    std::uniform_real_distribution<double> dist(-1000, 1000);
+    std::vector<double> values(10000);
+    DDSketch whole;
+    DDSketch parts[4];
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = dist(rng);
+        whole.add(values[i]);
+        parts[i % 4].add(values[i]);
+    }
+
+    DDSketch merged;
+    for (const auto& part : parts) {
+        merged.merge(part);
+    }
+    EXPECT_EQ(whole.count(), merged.count());
+    for (double q : {0.0, 0.1, 0.5, 0.9, 0.99, 1.0}) {
+        EXPECT_DOUBLE_EQ(whole.quantile(q), merged.quantile(q));
+    }
+    check_quantiles(merged, values);
+
+    // the values of the other buckets are added if the accuracies are different
+    DDSketch coarse(0.05);
+    coarse.add(1);
+    coarse.merge(whole);
+    EXPECT_EQ(whole.count() + 1, coarse.count());
+    EXPECT_NEAR(coarse.quantile(0.99), whole.quantile(0.99),
+                std::abs(whole.quantile(0.99)) * 0.07);
+}
+
+TEST(DDSketchTest, Serialize) {
+    std::mt19937_64 rng(0);
+    std::exponential_distribution<double> dist(0.01);
+    DDSketch sketch;
+    for (int i = 0; i < 10000; ++i) {
+        sketch.add(i % 10 == 0 ? -dist(rng) : dist(rng));
+    }
+    sketch.add(0);
+
+    std::string buf(sketch.serialized_size(), '\0');
+    EXPECT_EQ(buf.size(), sketch.serialize(reinterpret_cast<uint8_t*>(buf.data())));
+    DDSketch other(0.2);
+    ASSERT_TRUE(other.deserialize(Slice(buf)));
+    EXPECT_EQ(sketch.count(), other.count());
+    EXPECT_EQ(sketch.relative_accuracy(), other.relative_accuracy());
+    for (double q : {0.0, 0.05, 0.1, 0.11, 0.5, 0.99, 1.0}) {
+        EXPECT_EQ(sketch.quantile(q), other.quantile(q));
+    }
+
+    EXPECT_FALSE(other.deserialize(Slice(buf.data(), buf.size() - 1)));
+    EXPECT_EQ(0, other.count());
+
+    DDSketch empty;
+    buf.assign(empty.serialized_size(), '\0');
+    empty.serialize(reinterpret_cast<uint8_t*>(buf.data()));
+    ASSERT_TRUE(other.deserialize(Slice(buf)));
+    EXPECT_EQ(0, other.count());
+}
+
+TEST(DDSketchTest, CollapseLowestBuckets) {
+    DDSketch sketch(0.001);
+    std::vector<double> values;
+    // the magnitudes span more buckets than the limit
+    for (double value = 1e-12; value < 1e12; value *= 1.0001) {
+        values.push_back(value);
+    }
+    for (auto it = values.rbegin(); it != values.rend(); ++it) {
+        sketch.add(*it);
+    }
+    EXPECT_EQ(values.size(), sketch.count());
+    std::string buf(sketch.serialized_size(), '\0');
+    sketch.serialize(reinterpret_cast<uint8_t*>(buf.data()));
+    EXPECT_LT(buf.size(), DDSketch::MAX_NUM_BUCKETS * 4);
+
+    // the high quantiles keep the accuracy, the lowest ones are overestimated
+    for (double q : {0.5, 0.9, 0.99, 1.0}) {
+        double expected = values[static_cast<size_t>(q * static_cast<double>(values.size() - 1))];
+        EXPECT_NEAR(sketch.quantile(q), expected, expected * sketch.relative_accuracy());
+    }
+    EXPECT_GT(sketch.quantile(0), values.front());
+}
+
+} // namespace doris
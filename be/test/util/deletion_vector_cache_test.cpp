@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/deletion_vector_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace doris {
+
+TEST(DeletionVectorCacheTest, GetAndPositions) {
+    DeletionVectorCache cache(1024 * 1024);
+    int num_created = 0;
+    auto create = [&](DeletionVectorCache::Bitmap* bitmap) {
+        ++num_created;
+        for (uint64_t i = 0; i < 1000; i += 2) {
+            bitmap->add(i);
+        }
+        bitmap->add(uint64_t(1) << 33);
+        return Status::OK();
+    };
+    std::string key = DeletionVectorCache::iceberg_key("delete.parquet", "data.parquet");
+    DeletionVectorCache::Handle handle;
+    ASSERT_TRUE(DeletionVectorCache::get(&cache, key, create, &handle).ok());
+    DeletionVectorCache::Handle cached_handle;
+    ASSERT_TRUE(DeletionVectorCache::get(&cache, key, create, &cached_handle).ok());
+    EXPECT_EQ(num_created, 1);
+    EXPECT_EQ(cached_handle.bitmap().cardinality(), 501);
+
+    DeletionVectorCache::Handle other;
+    ASSERT_TRUE(DeletionVectorCache::get(
+                        &cache, DeletionVectorCache::iceberg_key("delete.parquet", "data2.parquet"),
+                        [](DeletionVectorCache::Bitmap* bitmap) {
+                            for (uint64_t i = 1; i < 10; i += 2) {
+                                bitmap->add(i);
+                            }
+                            bitmap->add(uint64_t(2));
+                            return Status::OK();
+                        },
+                        &other)
+                        .ok());
+
+    std::vector<int64_t> positions;
+    DeletionVectorCache::to_positions({&handle.bitmap(), &other.bitmap()}, &positions);
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < 1000; ++i) {
+        if (i % 2 == 0 || i < 10) {
+            expected.push_back(i);
+        }
+    }
+    expected.push_back(int64_t(1) << 33);
+    EXPECT_EQ(positions, expected);
+}
+
+TEST(DeletionVectorCacheTest, Disabled) {
+    DeletionVectorCache::Handle handle;
+    ASSERT_TRUE(DeletionVectorCache::get(
+                        nullptr, DeletionVectorCache::paimon_key("index", 10, 20),
+                        [](DeletionVectorCache::Bitmap* bitmap) {
+                            bitmap->add(uint64_t(7));
+                            return Status::OK();
+                        },
+                        &handle)
+                        .ok());
+    std::vector<int64_t> positions;
+    DeletionVectorCache::to_positions({&handle.bitmap()}, &positions);
+    EXPECT_EQ(positions, std::vector<int64_t> {7});
+
+    Status st = DeletionVectorCache::get(
+            nullptr, "error",
+            [](DeletionVectorCache::Bitmap*) { return Status::IOError("read error"); }, &handle);
+    EXPECT_FALSE(st.ok());
+}
+
+} // namespace doris
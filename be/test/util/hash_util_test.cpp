@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/hash_util.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+
+namespace doris {
+
+template <size_t bytes>
+void test_zlib_crc_hash_fixed(std::mt19937& generator) {
+    uint8_t data[bytes];
+    for (int i = 0; i < 1000; ++i) {
+        for (auto& byte : data) {
+            byte = static_cast<uint8_t>(generator());
+        }
+        uint32_t seed = i == 0 ? 0 : generator();
+        EXPECT_EQ(HashUtil::zlib_crc_hash_fixed<bytes>(data, seed),
+                  HashUtil::zlib_crc_hash(data, bytes, seed));
+    }
+}
+
+TEST(HashUtilTest, ZlibCrcHashFixed) {
+    std::mt19937 generator(0);
+    test_zlib_crc_hash_fixed<1>(generator);
+    test_zlib_crc_hash_fixed<2>(generator);
+    test_zlib_crc_hash_fixed<4>(generator);
+    test_zlib_crc_hash_fixed<8>(generator);
+    test_zlib_crc_hash_fixed<16>(generator);
+    test_zlib_crc_hash_fixed<32>(generator);
+
+    const int zero = 0;
+    EXPECT_EQ(HashUtil::zlib_crc_hash_null(12345),
+              HashUtil::zlib_crc_hash(&zero, sizeof(zero), 12345));
+}
+
+} // namespace doris
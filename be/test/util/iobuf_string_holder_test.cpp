@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/iobuf_string_holder.h"
+
+#include <gtest/gtest.h>
+
+namespace doris {
+
+TEST(IOBufStringHolderTest, AppendWithoutCopy) {
+    size_t held = IOBufStringHolder::held_count();
+    auto data = std::make_unique<std::string>(1 << 20, 'x');
+    const char* raw = data->data();
+    {
+        butil::IOBuf buf;
+        IOBufStringHolder::append(std::move(data), &buf);
+        EXPECT_EQ(buf.size(), 1 << 20);
+        EXPECT_EQ(IOBufStringHolder::held_count(), held + 1);
+        // The IOBuf references the string buffer directly.
+        EXPECT_EQ(buf.backing_block(0).data(), raw);
+
+        butil::IOBuf copied = buf;
+        buf.clear();
+        EXPECT_EQ(IOBufStringHolder::held_count(), held + 1);
+        std::string out;
+        copied.copy_to(&out);
+        EXPECT_EQ(out, std::string(1 << 20, 'x'));
+    }
+    EXPECT_EQ(IOBufStringHolder::held_count(), held);
+}
+
+TEST(IOBufStringHolderTest, EmptyString) {
+    size_t held = IOBufStringHolder::held_count();
+    butil::IOBuf buf;
+    IOBufStringHolder::append(std::make_unique<std::string>(), &buf);
+    IOBufStringHolder::append(nullptr, &buf);
+    EXPECT_TRUE(buf.empty());
+    EXPECT_EQ(IOBufStringHolder::held_count(), held);
+}
+
+} // namespace doris
@@ -101,4 +101,19 @@ TEST_F(KeyUtilTest, encode) {
     }
 }
 
+TEST_F(KeyUtilTest, key_range_is_not_in_segment) {
+    KeyBoundsPB bounds;
+    bounds.set_min_key("c");
+    bounds.set_max_key("f");
+    EXPECT_TRUE(key_range_is_not_in_segment("a", "b", bounds, false));
+    EXPECT_TRUE(key_range_is_not_in_segment("fa", "z", bounds, false));
+    EXPECT_FALSE(key_range_is_not_in_segment("a", "c", bounds, false));
+    EXPECT_FALSE(key_range_is_not_in_segment("d", "e", bounds, false));
+    EXPECT_FALSE(key_range_is_not_in_segment("a", "z", bounds, false));
+    EXPECT_FALSE(key_range_is_not_in_segment("f", "z", bounds, false));
+    // the truncated max key "f" may stand for "fa"
+    EXPECT_FALSE(key_range_is_not_in_segment("fa", "z", bounds, true));
+    EXPECT_TRUE(key_range_is_not_in_segment("g", "z", bounds, true));
+}
+
 } // namespace doris
@@ -23,6 +23,7 @@
 #include <unistd.h>
 
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "testutil/test_util.h"
@@ -426,6 +427,30 @@ TEST_F(MetricsTest, HistogramRegistryOutput) {
             task_duration->add(j);
         }
         EXPECT_EQ(R"(# TYPE test_registry_task_duration histogram
+test_registry_task_duration_bucket{le="1"} 1
+test_registry_task_duration_bucket{le="4"} 4
+test_registry_task_duration_bucket{le="15"} 15
+test_registry_task_duration_bucket{le="51"} 51
+test_registry_task_duration_bucket{le="170"} 100
+test_registry_task_duration_bucket{le="580"} 100
+test_registry_task_duration_bucket{le="1900"} 100
+test_registry_task_duration_bucket{le="6600"} 100
+test_registry_task_duration_bucket{le="22000"} 100
+test_registry_task_duration_bucket{le="75000"} 100
+test_registry_task_duration_bucket{le="250000"} 100
+test_registry_task_duration_bucket{le="860000"} 100
+test_registry_task_duration_bucket{le="2900000"} 100
+test_registry_task_duration_bucket{le="9800000"} 100
+test_registry_task_duration_bucket{le="33000000"} 100
+test_registry_task_duration_bucket{le="110000000"} 100
+test_registry_task_duration_bucket{le="370000000"} 100
+test_registry_task_duration_bucket{le="1200000000"} 100
+test_registry_task_duration_bucket{le="4300000000"} 100
+test_registry_task_duration_bucket{le="14000000000"} 100
+test_registry_task_duration_bucket{le="49000000000"} 100
+test_registry_task_duration_bucket{le="160000000000"} 100
+test_registry_task_duration_bucket{le="550000000000"} 100
+test_registry_task_duration_bucket{le="+Inf"} 100
 test_registry_task_duration{quantile="0.50"} 50
 test_registry_task_duration{quantile="0.75"} 75
 test_registry_task_duration{quantile="0.90"} 95.8333
@@ -462,6 +487,30 @@ test_registry_task_duration_standard_deviation 28.8661
         }
 
         EXPECT_EQ(R"(# TYPE test_registry_task_duration histogram
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="1"} 1
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="4"} 4
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="15"} 15
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="51"} 51
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="170"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="580"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="1900"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="6600"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="22000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="75000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="250000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="860000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="2900000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="9800000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="33000000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="110000000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="370000000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="1200000000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="4300000000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="14000000000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="49000000000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="160000000000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="550000000000"} 100
+test_registry_task_duration_bucket{instance="test",type="create_tablet",le="+Inf"} 100
 test_registry_task_duration{instance="test",type="create_tablet",quantile="0.50"} 50
 test_registry_task_duration{instance="test",type="create_tablet",quantile="0.75"} 75
 test_registry_task_duration{instance="test",type="create_tablet",quantile="0.90"} 95.8333
@@ -485,4 +534,28 @@ test_registry_task_duration_standard_deviation{instance="test",type="create_tabl
         registry.deregister_entity(entity);
     }
 }
+
+TEST_F(MetricsTest, HistogramConcurrentAdd) {
+    HistogramMetric histogram;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&histogram]() {
+            for (int j = 1; j <= 1000; ++j) {
+                histogram.add(j);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(8000, histogram.num());
+    EXPECT_EQ(8 * 500500, histogram.sum());
+    EXPECT_EQ(1, histogram.min());
+    EXPECT_EQ(1000, histogram.max());
+    EXPECT_NEAR(500, histogram.median(), 100);
+
+    histogram.clear();
+    EXPECT_TRUE(histogram.is_empty());
+}
+
 } // namespace doris
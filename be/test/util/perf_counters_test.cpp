@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/perf_counters.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace doris {
+
+TEST(ThreadPerfCountersTest, CountCallingThread) {
+    auto* counters = ThreadPerfCounters::current();
+    if (counters == nullptr) {
+        GTEST_SKIP() << "perf events are not available";
+    }
+    // the counters are opened only once for every thread
+    EXPECT_EQ(counters, ThreadPerfCounters::current());
+
+    ThreadPerfCounters::Values start;
+    ThreadPerfCounters::Values end;
+    ASSERT_TRUE(counters->read(&start));
+    volatile int64_t sum = 0;
+    for (int64_t i = 0; i < 1000000; ++i) {
+        sum += i;
+    }
+    ASSERT_TRUE(counters->read(&end));
+    EXPECT_GT(end[ThreadPerfCounters::CPU_CYCLES], start[ThreadPerfCounters::CPU_CYCLES]);
+    for (int event = 0; event < ThreadPerfCounters::NUM_EVENTS; ++event) {
+        EXPECT_GE(end[event], start[event]) << ThreadPerfCounters::event_name(
+                static_cast<ThreadPerfCounters::Event>(event));
+    }
+
+    const ThreadPerfCounters* other = nullptr;
+    std::thread thread([&]() { other = ThreadPerfCounters::current(); });
+    thread.join();
+    EXPECT_NE(counters, other);
+}
+
+} // namespace doris
@@ -21,6 +21,8 @@
 
 #include <cstdlib>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "common/exception.h"
 #include "common/object_pool.h"
@@ -248,6 +250,52 @@ TEST(RuntimeProfileTest, DerivedCounters) {
     EXPECT_EQ(throughput_counter->value(), 40);
 }
 
+TEST(RuntimeProfileTest, ShardedCounter) {
+    RuntimeProfile profile("Profile");
+    RuntimeProfile::Counter* counter = ADD_SHARDED_COUNTER(&profile, "rows", TUnit::UNIT);
+    EXPECT_EQ(counter, profile.get_counter("rows"));
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 32; ++i) {
+        threads.emplace_back([counter]() {
+            for (int j = 0; j < 1000; ++j) {
+                COUNTER_UPDATE(counter, 1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter->value(), 32000);
+
+    TRuntimeProfileTree tprofile;
+    profile.to_thrift(&tprofile);
+    auto from_thrift = RuntimeProfile::from_thrift(tprofile);
+    EXPECT_EQ(from_thrift->get_counter("rows")->value(), 32000);
+
+    counter->set(10L);
+    EXPECT_EQ(counter->value(), 10);
+}
+
+TEST(RuntimeProfileTest, TimersDisabled) {
+    RuntimeProfile profile("Profile");
+    profile.set_timers_disabled();
+    RuntimeProfile child("Child");
+    profile.add_child(&child, true);
+    RuntimeProfile::Counter* timer = ADD_TIMER(&child, "timer");
+    RuntimeProfile::Counter* counter = ADD_COUNTER(&child, "counter", TUnit::UNIT);
+    EXPECT_TRUE(timer->timer_disabled());
+    EXPECT_FALSE(counter->timer_disabled());
+    {
+        SCOPED_TIMER(timer);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(timer->value(), 0);
+    // only the scoped timers are skipped
+    COUNTER_UPDATE(timer, 5);
+    EXPECT_EQ(timer->value(), 5);
+}
+
 TEST(RuntimeProfileTest, InfoStringTest) {
     ObjectPool pool;
     RuntimeProfile profile("Profile");
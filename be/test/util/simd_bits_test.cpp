@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "util/simd/bits.h"
+
+namespace doris::simd {
+
+TEST(SimdBitsTest, Bitmap) {
+    std::mt19937 generator(0);
+    for (size_t size : {0, 1, 7, 8, 9, 63, 64, 65, 1000}) {
+        std::vector<uint8_t> bytes(size);
+        size_t num_ones = 0;
+        for (auto& byte : bytes) {
+            byte = generator() % 3 == 0;
+            num_ones += byte;
+        }
+        std::vector<uint8_t> bits(bitmap_bytes(size), 0xff);
+        bytes_to_bitmap(bytes.data(), size, bits.data());
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_EQ((bits[i / 8] >> (i % 8)) & 1, bytes[i]) << i;
+        }
+        EXPECT_EQ(count_bitmap(bits.data(), size), num_ones);
+
+        std::vector<uint8_t> expanded(size);
+        bitmap_to_bytes(bits.data(), size, expanded.data());
+        EXPECT_EQ(expanded, bytes);
+
+        std::vector<uint8_t> other_bytes(size);
+        for (auto& byte : other_bytes) {
+            byte = generator() % 2;
+        }
+        std::vector<uint8_t> other_bits(bitmap_bytes(size));
+        bytes_to_bitmap(other_bytes.data(), size, other_bits.data());
+        auto or_bits = bits;
+        bitmap_or(or_bits.data(), other_bits.data(), size);
+        auto and_bits = bits;
+        bitmap_and(and_bits.data(), other_bits.data(), size);
+        std::vector<uint8_t> or_bytes(size);
+        bitmap_to_bytes(or_bits.data(), size, or_bytes.data());
+        std::vector<uint8_t> and_bytes(size);
+        bitmap_to_bytes(and_bits.data(), size, and_bytes.data());
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(or_bytes[i], bytes[i] | other_bytes[i]);
+            EXPECT_EQ(and_bytes[i], bytes[i] & other_bytes[i]);
+        }
+    }
+}
+
+} // namespace doris::simd
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/simd/string_to_number.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "util/string_parser.hpp"
+#include "vec/runtime/vdatetime_value.h"
+
+namespace doris {
+
+// The fast path accepts s only if StringParser gets the same value from it.
+template <typename T>
+void check_int(const std::string& s, bool expect_fast) {
+    T value = 0;
+    bool fast = simd::parse_int(s.data(), s.size(), &value);
+    EXPECT_EQ(fast, expect_fast) << s;
+    if (fast) {
+        StringParser::ParseResult result;
+        T expected = StringParser::string_to_int<T>(s.data(), s.size(), &result);
+        EXPECT_EQ(result, StringParser::PARSE_SUCCESS) << s;
+        EXPECT_TRUE(value == expected) << s;
+    }
+}
+
+TEST(StringToNumberTest, Int) {
+    check_int<int32_t>("0", true);
+    check_int<int32_t>("-0", true);
+    check_int<int32_t>("+12", true);
+    check_int<int32_t>("-12345678", true);
+    check_int<int32_t>("123456789", true);
+    check_int<int64_t>("-123456789012345678", true);
+    check_int<int64_t>("1234567890123456", true);
+    check_int<int8_t>("-99", true);
+    check_int<__int128>("12345678901234567890123456789012345678", true);
+
+    // left to StringParser
+    check_int<int32_t>("", false);
+    check_int<int32_t>("-", false);
+    check_int<int32_t>("1234567890", false);
+    check_int<int32_t>("2147483648", false);
+    check_int<int8_t>("-128", false);
+    check_int<int32_t>(" 12", false);
+    check_int<int32_t>("12 ", false);
+    check_int<int32_t>("12.0", false);
+    check_int<int32_t>("12345a78", false);
+    check_int<int32_t>("1234567:", false);
+    check_int<int64_t>("12345678/2345678", false);
+
+    std::mt19937_64 rng(42);
+    for (int i = 0; i < 10000; ++i) {
+        auto value = static_cast<int64_t>(rng()) >> (rng() % 64);
+        std::string s = std::to_string(value);
+        check_int<int64_t>(s, s.size() - (value < 0) < 19);
+    }
+}
+
+TEST(StringToNumberTest, DateTime) {
+    auto check = [](const std::string& s, size_t scale, bool expect_fast) {
+        simd::DateTimeParts parts;
+        bool fast = simd::parse_datetime(s.data(), s.size(), scale, &parts);
+        EXPECT_EQ(fast, expect_fast) << s;
+        if (!fast) {
+            return;
+        }
+        DateV2Value<DateTimeV2ValueType> value;
+        DateV2Value<DateTimeV2ValueType> expected;
+        ASSERT_TRUE(value.check_range_and_set_time(parts.year, parts.month, parts.day, parts.hour,
+                                                   parts.minute, parts.second,
+                                                   parts.microsecond))
+                << s;
+        ASSERT_TRUE(expected.from_date_str(s.data(), static_cast<int>(s.size()),
+                                           static_cast<int>(scale)))
+                << s;
+        EXPECT_EQ(value.to_date_int_val(), expected.to_date_int_val()) << s;
+    };
+    check("2024-02-29", 6, true);
+    check("2024-02-29 23:59:58", 0, true);
+    check("2024-02-29T23:59:58", 0, true);
+    check("2024-02-29 23:59:58.1", 6, true);
+    check("2024-02-29 23:59:58.123456", 6, true);
+    check("1999-12-31 00:00:00.120", 3, true);
+
+    // the fraction would be rounded
+    check("2024-02-29 23:59:58.1234", 3, false);
+    check("2024-02-29 23:59:58.", 6, false);
+    check("2024-2-29", 6, false);
+    check("2024/02/29", 6, false);
+    check("20240229", 6, false);
+    check("2024-02-29 23:59", 6, false);
+    check("2024-02-29  23:59:58", 6, false);
+    check("2024-02-29 23-59-58", 6, false);
+    check("2024-02-29 23:59:58+08:00", 6, false);
+    check("2024-02-2a 23:59:58", 6, false);
+
+    // the ranges are checked by the caller
+    simd::DateTimeParts parts;
+    ASSERT_TRUE(simd::parse_datetime("2023-02-29 24:00:00", 19, 0, &parts));
+    DateV2Value<DateTimeV2ValueType> value;
+    EXPECT_FALSE(value.check_range_and_set_time(parts.year, parts.month, parts.day, parts.hour,
+                                                parts.minute, parts.second, parts.microsecond));
+}
+
+} // namespace doris
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include "agg_function_test.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 
 namespace doris::vectorized {
@@ -30,4 +31,12 @@ TEST_F(AggregateFunctionCountTest, test_int64) {
     execute(Block({ColumnHelper::create_column_with_name<DataTypeInt64>({1, 2, 3})}),
             ColumnHelper::create_column_with_name<DataTypeInt64>({3}));
 }
+
+TEST_F(AggregateFunctionCountTest, test_nullable_int64) {
+    create_agg("count", false, {make_nullable(std::make_shared<DataTypeInt64>())});
+
+    execute(Block({ColumnHelper::create_nullable_column_with_name<DataTypeInt64>(
+                    {1, 2, 3, 4, 5}, {0, 1, 0, 1, 1})}),
+            ColumnHelper::create_column_with_name<DataTypeInt64>({2}));
+}
 } // namespace doris::vectorized
@@ -28,6 +28,7 @@
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/string_ref.h"
@@ -35,6 +36,7 @@
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_decimal.h"
 #include "vec/data_types/data_type_jsonb.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 
@@ -124,6 +126,53 @@ TEST_P(AggMinMaxTest, min_max_decimal_test) {
     }
 }
 
+TEST_P(AggMinMaxTest, min_max_nullable_test) {
+    std::string min_max_type = GetParam();
+    // The smallest and the largest values are null.
+    auto nested = ColumnInt32::create();
+    auto null_map = ColumnUInt8::create();
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        nested->insert_value(i);
+        null_map->insert_value(i < 10 || i >= agg_test_batch_size - 10);
+    }
+    auto column = ColumnNullable::create(std::move(nested), std::move(null_map));
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_minmax(factory);
+    DataTypes data_types = {make_nullable(std::make_shared<DataTypeInt32>())};
+    auto agg_function = factory.get(min_max_type, data_types, true, -1);
+    const size_t size_of_data = agg_function->size_of_data();
+    std::unique_ptr<char[]> memory(new char[size_of_data * 3]);
+    std::vector<AggregateDataPtr> places {memory.get(), memory.get() + size_of_data,
+                                          memory.get() + size_of_data * 2};
+    for (auto* place : places) {
+        agg_function->create(place);
+    }
+
+    const IColumn* column_ptrs[1] = {column.get()};
+    agg_function->add_batch_single_place(agg_test_batch_size, places[0], column_ptrs, nullptr);
+    // The agg reader adds inclusive ranges.
+    agg_function->add_batch_range(0, agg_test_batch_size / 2 - 1, places[1], column_ptrs, nullptr,
+                                  true);
+    agg_function->add_batch_range(agg_test_batch_size / 2, agg_test_batch_size - 1, places[1],
+                                  column_ptrs, nullptr, true);
+    // Only null rows.
+    agg_function->add_batch_single_place(10, places[2], column_ptrs, nullptr);
+
+    auto result = ColumnNullable::create(ColumnInt32::create(), ColumnUInt8::create());
+    for (auto* place : places) {
+        agg_function->insert_result_into(place, *result);
+        agg_function->destroy(place);
+    }
+    const auto& values = assert_cast<const ColumnInt32&>(result->get_nested_column());
+    const int expected = min_max_type == "min" ? 10 : agg_test_batch_size - 11;
+    EXPECT_FALSE(result->is_null_at(0));
+    EXPECT_EQ(expected, values.get_element(0));
+    EXPECT_FALSE(result->is_null_at(1));
+    EXPECT_EQ(expected, values.get_element(1));
+    EXPECT_TRUE(result->is_null_at(2));
+}
+
 TEST_P(AggMinMaxTest, min_max_string_test) {
     std::string min_max_type = GetParam();
     // Prepare test data.
@@ -27,10 +27,12 @@
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/aggregate_functions/aggregate_function_topn.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/core/field.h"
 #include "vec/core/types.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 
@@ -67,6 +69,51 @@ TEST(AggTest, basic_test) {
     agg_function->destroy(place);
 }
 
+TEST(AggTest, nullable_sum_test) {
+    auto nested = ColumnInt32::create();
+    auto null_map = ColumnUInt8::create();
+    int64_t ans = 0;
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        nested->insert_value(i);
+        null_map->insert_value(i % 3 == 0);
+        ans += i % 3 == 0 ? 0 : i;
+    }
+    auto column = ColumnNullable::create(std::move(nested), std::move(null_map));
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_sum(factory);
+    DataTypes data_types = {make_nullable(std::make_shared<DataTypeInt32>())};
+    auto agg_function = factory.get("sum", data_types, true, -1);
+    const size_t size_of_data = agg_function->size_of_data();
+    std::unique_ptr<char[]> memory(new char[size_of_data * 3]);
+    std::vector<AggregateDataPtr> places {memory.get(), memory.get() + size_of_data,
+                                          memory.get() + size_of_data * 2};
+    for (auto* place : places) {
+        agg_function->create(place);
+    }
+
+    // Without and with group by, the null rows are skipped.
+    const IColumn* column_ptrs[1] = {column.get()};
+    agg_function->add_batch_single_place(agg_test_batch_size, places[0], column_ptrs, nullptr);
+    std::vector<AggregateDataPtr> group_places(agg_test_batch_size, places[1]);
+    agg_function->add_batch(agg_test_batch_size, group_places.data(), 0, column_ptrs, nullptr,
+                            false);
+    // Only the first row, which is null.
+    agg_function->add_batch_single_place(1, places[2], column_ptrs, nullptr);
+
+    auto result = ColumnNullable::create(ColumnInt64::create(), ColumnUInt8::create());
+    for (auto* place : places) {
+        agg_function->insert_result_into(place, *result);
+        agg_function->destroy(place);
+    }
+    const auto& sums = assert_cast<const ColumnInt64&>(result->get_nested_column());
+    EXPECT_FALSE(result->is_null_at(0));
+    EXPECT_EQ(ans, sums.get_element(0));
+    EXPECT_FALSE(result->is_null_at(1));
+    EXPECT_EQ(ans, sums.get_element(1));
+    EXPECT_TRUE(result->is_null_at(2));
+}
+
 TEST(AggTest, topn_test) {
     MutableColumns datas(2);
     datas[0] = ColumnString::create();
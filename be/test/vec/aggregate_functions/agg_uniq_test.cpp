@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/aggregate_functions/aggregate_function_uniq.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "agg_function_test.h"
+#include "vec/columns/column_string.h"
+#include "vec/common/string_buffer.hpp"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+struct AggregateFunctionUniqTest : public AggregateFunctiontest {};
+
+TEST_F(AggregateFunctionUniqTest, test_int32) {
+    create_agg("multi_distinct_count", false, {std::make_shared<DataTypeInt32>()});
+
+    std::vector<Int32> values;
+    for (Int32 i = -100; i < 100; ++i) {
+        values.push_back(i);
+        values.push_back(i * 3);
+    }
+    // -100..99 and the multiples of 3 outside of it: -300..-102 and 102..297.
+    execute(Block({ColumnHelper::create_column_with_name<DataTypeInt32>(values)}),
+            ColumnHelper::create_column_with_name<DataTypeInt64>({200 + 67 + 66}));
+}
+
+TEST_F(AggregateFunctionUniqTest, test_nullable_int64) {
+    create_agg("multi_distinct_count", false, {make_nullable(std::make_shared<DataTypeInt64>())});
+
+    execute(Block({ColumnHelper::create_nullable_column_with_name<DataTypeInt64>(
+                    {1, -1, 1, 5, 5, 7}, {0, 0, 0, 1, 0, 1})}),
+            ColumnHelper::create_column_with_name<DataTypeInt64>({3}));
+}
+
+TEST(AggregateFunctionUniqBitmapDataTest, AdaptiveState) {
+    using Data = AggregateFunctionUniqBitmapData<TYPE_BIGINT>;
+    auto fill = [](Data& data, Int64 begin, Int64 end) {
+        for (Int64 i = begin; i < end; ++i) {
+            data.add(Data::to_value(i));
+            data.add(Data::to_value(i));
+        }
+    };
+    auto round_trip = [](const Data& data) {
+        ColumnString buf;
+        VectorBufferWriter writer(buf);
+        data.write(writer);
+        writer.commit();
+        VectorBufferReader reader(buf.get_data_at(0));
+        Data res;
+        res.read(reader);
+        return res;
+    };
+
+    Data small;
+    fill(small, -10, 10);
+    EXPECT_FALSE(small.is_bitmap);
+    EXPECT_EQ(small.size(), 20);
+    EXPECT_EQ(round_trip(small).small, small.small);
+
+    Data big;
+    fill(big, 0, Data::SMALL_SIZE + 1);
+    EXPECT_TRUE(big.is_bitmap);
+    EXPECT_EQ(big.size(), Data::SMALL_SIZE + 1);
+    Data big_copy = round_trip(big);
+    EXPECT_TRUE(big_copy.is_bitmap);
+    EXPECT_EQ(big_copy.size(), Data::SMALL_SIZE + 1);
+
+    // small + small grows into a bitmap.
+    Data other_small;
+    fill(other_small, 5, Data::SMALL_SIZE);
+    Data merged = small;
+    merged.merge(other_small);
+    EXPECT_TRUE(merged.is_bitmap);
+    EXPECT_EQ(merged.size(), Data::SMALL_SIZE + 10);
+
+    // small + bitmap and bitmap + small.
+    Data to_small = small;
+    to_small.merge(big);
+    EXPECT_TRUE(to_small.is_bitmap);
+    EXPECT_EQ(to_small.size(), Data::SMALL_SIZE + 11);
+    big.merge(small);
+    EXPECT_EQ(big.size(), Data::SMALL_SIZE + 11);
+
+    // bitmap + bitmap.
+    merged.merge(big_copy);
+    EXPECT_EQ(merged.size(), Data::SMALL_SIZE + 11);
+
+    std::vector<Int64> keys {3, -3, 1L << 40, -(1L << 40), 3};
+    Data batch;
+    batch.add_many(keys.data(), keys.size());
+    EXPECT_EQ(batch.size(), 4);
+    batch.reset();
+    EXPECT_EQ(batch.size(), 0);
+    EXPECT_FALSE(batch.is_bitmap);
+}
+
+} // namespace doris::vectorized
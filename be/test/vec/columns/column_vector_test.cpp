@@ -526,4 +526,39 @@ TEST_F(ColumnVectorTest, ScalaTypeInt32Test2erase) {
     }
 }
 
+template <typename ColumnType>
+void check_filter_partial_mask() {
+    using T = typename ColumnType::value_type;
+    // the filter mixes the all zero, all one and partial masks of every 32 or 16 rows
+    constexpr size_t rows = 1000;
+    auto column = ColumnType::create();
+    IColumn::Filter filter(rows);
+    std::vector<T> expected;
+    for (size_t i = 0; i < rows; ++i) {
+        column->insert_value(static_cast<T>(i * 3 + 1));
+        filter[i] = (i / 64) % 3 == 0 ? 0 : ((i / 64) % 3 == 1 ? 1 : (i * 7 + i / 5) % 3 == 0);
+        if (filter[i]) {
+            expected.push_back(static_cast<T>(i * 3 + 1));
+        }
+    }
+    auto filtered = column->filter(filter, -1);
+    ASSERT_EQ(filtered->size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(assert_cast<const ColumnType&>(*filtered).get_element(i), expected[i]) << i;
+    }
+    EXPECT_EQ(column->filter(filter), expected.size());
+    ASSERT_EQ(column->size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(column->get_element(i), expected[i]) << i;
+    }
+}
+
+TEST_F(ColumnVectorTest, filter_partial_mask) {
+    check_filter_partial_mask<ColumnInt32>();
+    check_filter_partial_mask<ColumnInt64>();
+    check_filter_partial_mask<ColumnFloat32>();
+    check_filter_partial_mask<ColumnFloat64>();
+    check_filter_partial_mask<ColumnInt16>();
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/fixed_hash_map.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/hash_table/hash_map_context.h"
+
+namespace doris::vectorized {
+
+TEST(FixedHashMapTest, EmplaceAndFind) {
+    FixedHashMap<UInt16, UInt64> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.get_buffer_size_in_bytes(), 0);
+    EXPECT_TRUE(map.add_elem_size_overflow(1));
+    EXPECT_EQ(map.find(UInt16(7)), nullptr);
+
+    for (UInt16 key : {7, 65535, 0, 7, 300}) {
+        FixedHashMap<UInt16, UInt64>::LookupResult it;
+        map.lazy_emplace(key, it, map.hash(key),
+                         [&](const auto& ctor, auto& k, auto&) { ctor(k, UInt64(k) * 2); });
+        EXPECT_EQ(*lookup_result_get_mapped(it), UInt64(key) * 2);
+    }
+    EXPECT_EQ(map.size(), 4);
+    EXPECT_EQ(map.get_buffer_size_in_bytes(), FixedHashMap<UInt16, UInt64>::BUFFER_SIZE);
+    EXPECT_FALSE(map.add_elem_size_overflow(1 << 20));
+    EXPECT_EQ(map.find(UInt16(8)), nullptr);
+    ASSERT_NE(map.find(UInt16(300)), nullptr);
+
+    // Iteration goes in key order.
+    std::vector<UInt16> keys;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        keys.push_back(it->get_first());
+        EXPECT_EQ(it->get_second(), UInt64(it->get_first()) * 2);
+    }
+    EXPECT_EQ(keys, (std::vector<UInt16> {0, 7, 300, 65535}));
+
+    map.clear_and_shrink();
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.begin() == map.end());
+    EXPECT_EQ(map.get_buffer_size_in_bytes(), 0);
+}
+
+TEST(FixedHashMapTest, NullableOneNumberMethod) {
+    using Method = MethodSingleNullableColumn<
+            MethodOneNumber<UInt8, DataWithNullKey<FixedHashMap<UInt8, char*>>>>;
+    auto nested = ColumnInt8::create();
+    auto null_map = ColumnUInt8::create();
+    std::vector<Int8> values {-1, 3, 0, -1, 127, 0, -128};
+    std::vector<UInt8> nulls {0, 0, 1, 0, 0, 1, 0};
+    for (size_t i = 0; i < values.size(); ++i) {
+        nested->insert_value(values[i]);
+        null_map->insert_value(nulls[i]);
+    }
+    auto column = ColumnNullable::create(std::move(nested), std::move(null_map));
+    ColumnRawPtrs key_columns {column.get()};
+
+    Method method;
+    Method::State state(key_columns);
+    method.init_serialized_keys(key_columns, values.size());
+
+    std::vector<char> states(values.size() + 1);
+    size_t created = 0;
+    auto creator = [&](const auto& ctor, auto& key, auto&) { ctor(key, &states[created++]); };
+    auto creator_for_null_key = [&](auto& mapped) { mapped = &states[created++]; };
+    std::vector<char*> places(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        places[i] = *method.lazy_emplace(state, i, creator, creator_for_null_key);
+    }
+
+    // -1, 3, null, 127 and -128 are the distinct keys.
+    EXPECT_EQ(created, 5);
+    EXPECT_EQ(method.hash_table->size(), 5);
+    EXPECT_EQ(places[0], places[3]);
+    EXPECT_EQ(places[2], places[5]);
+    EXPECT_NE(places[0], places[1]);
+    EXPECT_NE(places[4], places[6]);
+
+    auto find = method.find(state, 6);
+    EXPECT_TRUE(find.is_found());
+    EXPECT_EQ(find.get_mapped(), places[6]);
+}
+
+} // namespace doris::vectorized
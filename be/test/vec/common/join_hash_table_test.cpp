@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace doris {
+
+using TestJoinHashTable = JoinHashTable<uint64_t, HashCRC32<uint64_t>>;
+
+// Probes `probe_keys` against build keys 0..num_build-1 (each key inserted twice) with an inner
+// join and returns the matched (probe_idx, build_idx) pairs.
+static std::vector<std::pair<uint32_t, uint32_t>> inner_join(bool prefetch, size_t num_build,
+                                                             const std::vector<uint64_t>& probe_keys,
+                                                             int batch_size) {
+    // row 0 of the build side is a placeholder
+    size_t build_rows = num_build * 2 + 1;
+    std::vector<uint64_t> build_keys(build_rows);
+    for (size_t i = 1; i < build_rows; ++i) {
+        build_keys[i] = (i - 1) % num_build;
+    }
+
+    TestJoinHashTable table;
+    table.prepare_build<TJoinOp::INNER_JOIN>(build_rows, batch_size, false);
+    table.set_prefetch_build_rows(prefetch);
+    auto bucket_size = table.get_bucket_size();
+    DorisVector<uint32_t> build_buckets(build_rows);
+    for (size_t i = 0; i < build_rows; ++i) {
+        build_buckets[i] = table.hash(build_keys[i]) & (bucket_size - 1);
+    }
+    table.build(build_keys.data(), build_buckets.data(), build_rows, false);
+
+    int probe_rows = static_cast<int>(probe_keys.size());
+    DorisVector<uint32_t> probe_buckets(probe_rows);
+    for (int i = 0; i < probe_rows; ++i) {
+        probe_buckets[i] = table.hash(probe_keys[i]) & (bucket_size - 1);
+    }
+    table.pre_build_idxs(probe_buckets);
+
+    std::vector<std::pair<uint32_t, uint32_t>> result;
+    std::vector<uint32_t> probe_idxs(batch_size + 1);
+    std::vector<uint32_t> build_idxs(batch_size + 1);
+    int probe_idx = 0;
+    uint32_t build_idx = 0;
+    bool probe_visited = false;
+    while (probe_idx < probe_rows || build_idx) {
+        uint32_t matched = 0;
+        std::tie(probe_idx, build_idx, matched) = table.find_batch<TJoinOp::INNER_JOIN>(
+                probe_keys.data(), probe_buckets.data(), probe_idx, build_idx, probe_rows,
+                probe_idxs.data(), probe_visited, build_idxs.data(), nullptr, false, false, false);
+        for (uint32_t i = 0; i < matched; ++i) {
+            result.emplace_back(probe_idxs[i], build_idxs[i]);
+        }
+    }
+    return result;
+}
+
+TEST(JoinHashTableTest, VisitedFlags) {
+    JoinVisitedFlags flags;
+    flags.resize(130);
+    EXPECT_EQ(flags.size(), 130);
+    EXPECT_GE(flags.byte_size(), 3 * sizeof(uint64_t));
+    flags.set(0);
+    flags.set(64);
+    flags.set_if(127, false);
+    flags.set_if(129, true);
+    for (size_t i = 0; i < flags.size(); ++i) {
+        EXPECT_EQ(flags.test(i), i == 0 || i == 64 || i == 129) << i;
+    }
+}
+
+TEST(JoinHashTableTest, PrefetchBuildRowsSameResult) {
+    std::vector<uint64_t> probe_keys;
+    for (uint64_t i = 0; i < 5000; ++i) {
+        // keys in [1000, 2000) do not match
+        probe_keys.push_back(i % 2000);
+    }
+    auto expected = inner_join(false, 1000, probe_keys, 64);
+    auto actual = inner_join(true, 1000, probe_keys, 64);
+    EXPECT_EQ(expected.size(), 3000 * 2);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(JoinHashTableTest, BuildBucketRangesSameChains) {
+    constexpr size_t rows = 10000;
+    std::vector<uint64_t> keys(rows);
+    for (size_t i = 1; i < rows; ++i) {
+        keys[i] = i % 3000;
+    }
+
+    TestJoinHashTable serial;
+    TestJoinHashTable partitioned;
+    serial.prepare_build<TJoinOp::INNER_JOIN>(rows, 4096, false);
+    partitioned.prepare_build<TJoinOp::INNER_JOIN>(rows, 4096, false);
+    auto bucket_size = serial.get_bucket_size();
+    DorisVector<uint32_t> bucket_nums(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        bucket_nums[i] = serial.hash(keys[i]) & (bucket_size - 1);
+    }
+    serial.build(keys.data(), bucket_nums.data(), rows, false);
+    const uint32_t num_buckets = bucket_size + 1;
+    for (uint32_t p = 0; p < 3; ++p) {
+        partitioned.build_bucket_range(bucket_nums.data(), rows, num_buckets * p / 3,
+                                       num_buckets * (p + 1) / 3);
+    }
+    partitioned.finish_build(keys.data(), false);
+
+    DorisVector<uint32_t> serial_heads = bucket_nums;
+    DorisVector<uint32_t> partitioned_heads = bucket_nums;
+    serial.pre_build_idxs(serial_heads);
+    partitioned.pre_build_idxs(partitioned_heads);
+    EXPECT_EQ(serial_heads, partitioned_heads);
+}
+
+} // namespace doris
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/common/string_view.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace doris::vectorized {
+
+TEST(StringViewTest, InlineAndRef) {
+    std::string short_string = "hello world!";
+    StringView short_view(short_string.data(), static_cast<uint32_t>(short_string.size()));
+    EXPECT_TRUE(short_view.is_inline());
+    EXPECT_NE(short_view.data(), short_string.data());
+    short_string[0] = 'j';
+    // the short string is copied into the view
+    EXPECT_EQ(short_view.to_string_ref().to_string(), "hello world!");
+
+    std::string long_string = "hello world, hello doris";
+    StringView long_view {StringRef(long_string)};
+    EXPECT_FALSE(long_view.is_inline());
+    EXPECT_EQ(long_view.data(), long_string.data());
+    EXPECT_EQ(long_view.size(), long_string.size());
+
+    EXPECT_EQ(StringView().size(), 0U);
+    EXPECT_EQ(StringView(), StringView("", 0));
+}
+
+TEST(StringViewTest, CompareAsMemcmp) {
+    std::mt19937 generator(0);
+    std::vector<std::string> strings;
+    for (int i = 0; i < 1000; ++i) {
+        std::string s;
+        auto size = generator() % 20;
+        for (size_t j = 0; j < size; ++j) {
+            // few distinct bytes, so that many strings share prefixes
+            s.push_back("a\0\xff"[generator() % 3]);
+        }
+        strings.push_back(std::move(s));
+    }
+    for (const auto& a : strings) {
+        for (int i = 0; i < 20; ++i) {
+            const auto& b = strings[generator() % strings.size()];
+            StringView view_a {StringRef(a)};
+            StringView view_b {StringRef(b)};
+            int expected = StringRef(a).compare(StringRef(b));
+            expected = expected < 0 ? -1 : (expected > 0 ? 1 : 0);
+            EXPECT_EQ(view_a.compare(view_b), expected);
+            EXPECT_EQ(view_a == view_b, a == b);
+        }
+    }
+}
+
+} // namespace doris::vectorized
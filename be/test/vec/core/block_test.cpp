@@ -1376,4 +1376,44 @@ TEST(BlockTest, others) {
     ASSERT_TRUE(dumped_names.empty()) << "Dumped names: " << dumped_names;
 }
 
+TEST(BlockTest, dict_codes) {
+    auto strcol = vectorized::ColumnString::create();
+    for (const auto* value : {"a", "b", "a"}) {
+        strcol->insert_data(value, 1);
+    }
+    vectorized::DataTypePtr string_type(std::make_shared<vectorized::DataTypeString>());
+    auto intcol = vectorized::ColumnInt32::create();
+    for (int i = 0; i < 3; ++i) {
+        intcol->insert_value(i);
+    }
+    vectorized::DataTypePtr int_type(std::make_shared<vectorized::DataTypeInt32>());
+    vectorized::Block block({{std::move(intcol), int_type, "i"},
+                             {std::move(strcol), string_type, "s"}});
+
+    auto codes = std::make_shared<vectorized::ColumnDictCodes>();
+    codes->dict_id = 1;
+    codes->dict_size = 2;
+    codes->codes.assign({0, 1, 0});
+    block.set_dict_codes(1, codes);
+    ASSERT_EQ(block.get_dict_codes(block.get_by_position(1).column.get()), codes);
+    ASSERT_EQ(block.get_dict_codes(block.get_by_position(0).column.get()), nullptr);
+
+    // The codes follow their column.
+    block.shuffle_columns({1});
+    ASSERT_EQ(block.get_dict_codes(block.get_by_position(0).column.get()), codes);
+    vectorized::Block copied = block;
+    ASSERT_EQ(copied.get_dict_codes(copied.get_by_position(0).column.get()), codes);
+    vectorized::Block swapped;
+    swapped.swap(copied);
+    ASSERT_EQ(swapped.get_dict_codes(swapped.get_by_position(0).column.get()), codes);
+
+    // A new column of the block has no codes.
+    auto replaced = block.get_by_position(0).column->clone_resized(3);
+    block.replace_by_position(0, std::move(replaced));
+    ASSERT_EQ(block.get_dict_codes(block.get_by_position(0).column.get()), nullptr);
+
+    swapped.clear_column_data();
+    ASSERT_EQ(swapped.get_dict_codes(swapped.get_by_position(0).column.get()), nullptr);
+}
+
 } // namespace doris
@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_block.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+namespace {
+Block create_sort_block(size_t rows) {
+    std::vector<Int32> keys;
+    std::vector<UInt8> nulls;
+    std::vector<Int16> second_keys;
+    std::vector<Int64> row_ids;
+    for (size_t i = 0; i < rows; ++i) {
+        keys.push_back(Int32(i * 7919 % 61) - 30);
+        nulls.push_back(i % 13 == 0);
+        second_keys.push_back(Int16(Int32(i * 104729 % 2003) - 1000));
+        row_ids.push_back(Int64(i));
+    }
+    Block block;
+    block.insert(ColumnHelper::create_nullable_column_with_name<DataTypeInt32>(keys, nulls));
+    block.insert(ColumnHelper::create_column_with_name<DataTypeInt16>(second_keys));
+    block.insert(ColumnHelper::create_column_with_name<DataTypeInt64>(row_ids));
+    return block;
+}
+
+Block create_string_sort_block(size_t rows) {
+    std::vector<std::string> keys;
+    std::vector<UInt8> nulls;
+    std::vector<Int32> second_keys;
+    std::vector<Int64> row_ids;
+    // the long strings share a prefix longer than the normalized keys
+    const std::string long_prefix(40, 'x');
+    for (size_t i = 0; i < rows; ++i) {
+        std::string key = std::to_string(i * 7919 % 37);
+        keys.push_back(i % 3 == 0 ? long_prefix + key : key);
+        nulls.push_back(i % 11 == 0);
+        second_keys.push_back(Int32(i * 104729 % 101) - 50);
+        row_ids.push_back(Int64(i));
+    }
+    Block block;
+    block.insert(ColumnHelper::create_nullable_column_with_name<DataTypeString>(keys, nulls));
+    block.insert(ColumnHelper::create_column_with_name<DataTypeInt32>(second_keys));
+    block.insert(ColumnHelper::create_column_with_name<DataTypeInt64>(row_ids));
+    return block;
+}
+
+// Checks that the rows are in order and that the row ids in the last column are a permutation.
+void check_sorted(const Block& block, const SortDescription& description, size_t src_rows) {
+    std::vector<bool> seen(src_rows);
+    const auto& row_ids = block.get_by_position(block.columns() - 1).column;
+    for (size_t i = 0; i < block.rows(); ++i) {
+        auto row_id = row_ids->get_int(i);
+        EXPECT_FALSE(seen[row_id]);
+        seen[row_id] = true;
+        if (i == 0) {
+            continue;
+        }
+        int res = 0;
+        for (const auto& desc : description) {
+            const auto& column = block.get_by_position(desc.column_number).column;
+            res = column->compare_at(i - 1, i, *column, desc.nulls_direction) * desc.direction;
+            if (res != 0) {
+                break;
+            }
+        }
+        EXPECT_LE(res, 0) << "row " << i;
+    }
+}
+} // namespace
+
+TEST(SortBlockTest, RadixSortKeys) {
+    const size_t rows = 4000;
+    for (int direction : {1, -1}) {
+        for (int nulls_direction : {1, -1}) {
+            for (size_t key_num : {1, 2}) {
+                SortDescription description;
+                description.emplace_back(0, direction, nulls_direction);
+                if (key_num == 2) {
+                    description.emplace_back(1, -direction, nulls_direction);
+                }
+                Block block = create_sort_block(rows);
+                Block sorted = block.clone_empty();
+                sort_block(block, sorted, description);
+                ASSERT_EQ(sorted.rows(), rows);
+                check_sorted(sorted, description, rows);
+            }
+        }
+    }
+}
+
+TEST(SortBlockTest, RadixSortLimit) {
+    const size_t rows = 4000;
+    SortDescription description;
+    description.emplace_back(1, 1, 1);
+    description.emplace_back(0, -1, -1);
+    Block block = create_sort_block(rows);
+    Block sorted = block.clone_empty();
+    sort_block(block, sorted, description, rows / 2);
+    ASSERT_EQ(sorted.rows(), rows / 2);
+    check_sorted(sorted, description, rows);
+    // the smallest second key is -1000
+    EXPECT_EQ(sorted.get_by_position(1).column->get_int(0), -1000);
+}
+
+TEST(SortBlockTest, NormalizedKeys) {
+    const size_t rows = 500;
+    for (bool enable : {true, false}) {
+        config::enable_sort_normalized_key = enable;
+        for (int direction : {1, -1}) {
+            for (int nulls_direction : {1, -1}) {
+                // an integer prefix, and a string key prefix the rows with equal keys go on with
+                std::vector<SortDescription> descriptions(2);
+                descriptions[0].emplace_back(1, direction, nulls_direction);
+                descriptions[0].emplace_back(0, -direction, nulls_direction);
+                descriptions[1].emplace_back(0, direction, nulls_direction);
+                descriptions[1].emplace_back(1, -direction, nulls_direction);
+                for (const auto& description : descriptions) {
+                    Block block = create_string_sort_block(rows);
+                    Block sorted = block.clone_empty();
+                    sort_block(block, sorted, description);
+                    ASSERT_EQ(sorted.rows(), rows);
+                    check_sorted(sorted, description, rows);
+
+                    sorted = block.clone_empty();
+                    sort_block(block, sorted, description, 10);
+                    ASSERT_EQ(sorted.rows(), 10);
+                    check_sorted(sorted, description, rows);
+                }
+            }
+        }
+    }
+    config::enable_sort_normalized_key = true;
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/data_types/data_type_nullable.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "agent/be_exec_version_manager.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+TEST(DataTypeNullableTest, SerializeNullMap) {
+    auto type = std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt32>());
+    for (int be_exec_version : {USE_CONST_SERDE, BITMAP_NULL_MAP_SERDE}) {
+        for (size_t rows : {0, 1, 13, 100}) {
+            for (bool with_null : {false, true}) {
+                auto column = ColumnNullable::create(ColumnInt32::create(), ColumnUInt8::create());
+                for (size_t i = 0; i < rows; ++i) {
+                    if (with_null && i % 3 == 1) {
+                        column->insert_default();
+                    } else {
+                        column->insert(Field::create_field<TYPE_INT>(Int32(i)));
+                    }
+                }
+                auto size = type->get_uncompressed_serialized_bytes(*column, be_exec_version);
+                std::vector<char> buf(size);
+                char* end = type->serialize(*column, buf.data(), be_exec_version);
+                ASSERT_LE(end - buf.data(), size);
+
+                auto deserialized = type->create_column();
+                const char* read_end = type->deserialize(buf.data(), &deserialized,
+                                                         be_exec_version);
+                EXPECT_EQ(read_end, end);
+                ASSERT_EQ(deserialized->size(), rows);
+                for (size_t i = 0; i < rows; ++i) {
+                    ASSERT_EQ(deserialized->is_null_at(i), column->is_null_at(i));
+                    EXPECT_EQ(deserialized->compare_at(i, i, *column, 1), 0);
+                }
+            }
+        }
+    }
+}
+
+} // namespace doris::vectorized
@@ -338,4 +338,51 @@ TEST(DataTypeSerDeMysqlTest, ScalaSerDeTest) {
     serialize_and_deserialize_mysql_test();
 }
 
+TEST(DataTypeSerDeMysqlTest, ColumnCellsSerDeTest) {
+    const int row_num = 100;
+    auto int_column = ColumnInt32::create();
+    auto null_map = ColumnUInt8::create();
+    auto str_column = ColumnString::create();
+    auto datetime_column = ColumnDateTimeV2::create();
+    for (int i = 0; i < row_num; ++i) {
+        int_column->insert_value(i * 1000 - 7);
+        null_map->insert_value(i % 3 == 0 || i % 7 == 0);
+        std::string str(i % 5, 'a' + i % 26);
+        str_column->insert_data(str.data(), str.size());
+        DateV2Value<DateTimeV2ValueType> value;
+        value.unchecked_set_time(2022, 6, 6, i % 24, i % 60, i % 60, i * 1000);
+        datetime_column->insert_value(value.to_date_int_val());
+    }
+    auto datetime_type = std::make_shared<DataTypeDateTimeV2>(3);
+    std::vector<std::pair<ColumnPtr, DataTypeSerDeSPtr>> columns {
+            {ColumnNullable::create(std::move(int_column), std::move(null_map)),
+             make_nullable(std::make_shared<DataTypeInt32>())->get_serde()},
+            {std::move(str_column), std::make_shared<DataTypeString>()->get_serde()},
+            {std::move(datetime_column), datetime_type->get_serde()},
+            {ColumnIPv4::create(row_num, 3232235521),
+             std::make_shared<DataTypeIPv4>()->get_serde()},
+    };
+
+    DataTypeSerDe::FormatOptions options;
+    for (const auto& [column, serde] : columns) {
+        for (bool col_const : {false, true}) {
+            MysqlRowBuffer<false> cells;
+            std::vector<int64_t> cell_ends;
+            ASSERT_TRUE(serde->write_column_to_mysql_cells(*column, cells, 0, row_num, col_const,
+                                                           options, cell_ends)
+                                .ok());
+            ASSERT_EQ(cell_ends.size(), static_cast<size_t>(row_num));
+            // every cell is the same as the one written row by row
+            for (int i = 0; i < row_num; ++i) {
+                MysqlRowBuffer<false> row;
+                ASSERT_TRUE(serde->write_column_to_mysql(*column, row, i, col_const, options).ok());
+                int64_t begin = i == 0 ? 0 : cell_ends[i - 1];
+                EXPECT_EQ(std::string(cells.buf() + begin, cell_ends[i] - begin),
+                          std::string(row.buf(), row.length()))
+                        << column->get_name() << " row " << i;
+            }
+        }
+    }
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "vec/exec/format/csv/csv_reader.h"
+
+namespace doris::vectorized {
+
+class PlainCsvTextFieldSplitterTest : public testing::Test {
+public:
+    static std::vector<std::string> split(PlainCsvTextFieldSplitter& splitter,
+                                          const std::string& line) {
+        std::vector<Slice> values;
+        splitter.split_line(Slice(line), &values);
+        std::vector<std::string> result;
+        for (const auto& value : values) {
+            result.push_back(value.to_string());
+        }
+        return result;
+    }
+
+    static std::vector<std::string> expected_split(const std::string& line, char sep) {
+        std::vector<std::string> result;
+        size_t start = 0;
+        for (size_t i = 0; i < line.size(); ++i) {
+            if (line[i] == sep) {
+                result.push_back(line.substr(start, i - start));
+                start = i + 1;
+            }
+        }
+        result.push_back(line.substr(start));
+        return result;
+    }
+};
+
+TEST_F(PlainCsvTextFieldSplitterTest, SingleCharSeparator) {
+    PlainCsvTextFieldSplitter splitter(false, false, ",", 1);
+    EXPECT_EQ(split(splitter, ""), std::vector<std::string>({""}));
+    EXPECT_EQ(split(splitter, ","), std::vector<std::string>({"", ""}));
+    EXPECT_EQ(split(splitter, "a,bc,,d"), std::vector<std::string>({"a", "bc", "", "d"}));
+
+    // lines across many strides of the separator search, with bytes of the high bit set
+    std::mt19937 rng(42);
+    for (size_t i = 0; i < 2000; ++i) {
+        std::string line(rng() % 300, 'a');
+        for (auto& c : line) {
+            auto r = rng() % 6;
+            c = r == 0 ? ',' : (r == 1 ? static_cast<char>(0x80 | rng()) : 'a' + rng() % 26);
+        }
+        ASSERT_EQ(split(splitter, line), expected_split(line, ',')) << line;
+    }
+}
+
+TEST_F(PlainCsvTextFieldSplitterTest, Trim) {
+    PlainCsvTextFieldSplitter splitter(true, true, "|", 1, '"');
+    std::string line = "\"abc\"|  x  |\"long value over the first stride of the line\"  |";
+    EXPECT_EQ(split(splitter, line),
+              std::vector<std::string>(
+                      {"abc", "  x", "long value over the first stride of the line", ""}));
+}
+
+} // namespace doris::vectorized
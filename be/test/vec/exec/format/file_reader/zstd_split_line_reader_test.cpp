@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+#include <zstd.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "exec/decompressor.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "util/runtime_profile.h"
+#include "vec/exec/format/file_reader/new_plain_text_line_reader.h"
+
+namespace doris::vectorized {
+
+class ZstdSplitLineReaderTest : public testing::Test {
+public:
+    void SetUp() override {
+        std::filesystem::remove_all(_test_dir);
+        ASSERT_TRUE(std::filesystem::create_directory(_test_dir));
+    }
+
+    void TearDown() override { std::filesystem::remove_all(_test_dir); }
+
+    static void append_le32(std::string* buf, uint32_t value) {
+        for (int i = 0; i < 4; ++i) {
+            buf->push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    // Compress the chunks of data as the frames of a file in the zstd seekable format.
+    std::string write_seekable_file(const std::string& data, const std::vector<size_t>& chunks) {
+        std::string file;
+        std::string entries;
+        size_t pos = 0;
+        for (size_t chunk : chunks) {
+            std::string frame(ZSTD_compressBound(chunk), '\0');
+            size_t size = ZSTD_compress(frame.data(), frame.size(), data.data() + pos, chunk, 3);
+            EXPECT_FALSE(ZSTD_isError(size));
+            file.append(frame.data(), size);
+            append_le32(&entries, static_cast<uint32_t>(size));
+            append_le32(&entries, static_cast<uint32_t>(chunk));
+            pos += chunk;
+        }
+        EXPECT_EQ(pos, data.size());
+        append_le32(&file, 0x184D2A5E);
+        append_le32(&file, static_cast<uint32_t>(entries.size() + ZstdSeekTable::FOOTER_SIZE));
+        file.append(entries);
+        append_le32(&file, static_cast<uint32_t>(chunks.size()));
+        file.push_back(0);
+        append_le32(&file, 0x8F92EAB1);
+
+        std::string path = _test_dir + "/data.csv.zst";
+        io::FileWriterPtr file_writer;
+        EXPECT_TRUE(io::global_local_filesystem()->create_file(path, &file_writer).ok());
+        EXPECT_TRUE(file_writer->append(Slice(file)).ok());
+        EXPECT_TRUE(file_writer->close().ok());
+        return file;
+    }
+
+    ZstdSeekTable read_seek_table(const std::string& file) {
+        const auto* tail = reinterpret_cast<const uint8_t*>(file.data()) + file.size();
+        size_t table_size = 0;
+        EXPECT_TRUE(ZstdSeekTable::parse_footer(tail - ZstdSeekTable::FOOTER_SIZE, file.size(),
+                                                &table_size)
+                            .ok());
+        ZstdSeekTable seek_table;
+        EXPECT_TRUE(seek_table.parse(tail - table_size, table_size).ok());
+        return seek_table;
+    }
+
+    // Read the lines of the split like CsvReader.
+    void read_split(const ZstdSeekTable& seek_table, int64_t start, int64_t size,
+                    std::vector<std::string>* lines) {
+        auto range = seek_table.split_range(start, size);
+        io::FileReaderSPtr file_reader;
+        ASSERT_TRUE(io::global_local_filesystem()
+                            ->open_file(_test_dir + "/data.csv.zst", &file_reader)
+                            .ok());
+        std::unique_ptr<Decompressor> decompressor;
+        ASSERT_TRUE(Decompressor::create_decompressor(CompressType::ZSTD, &decompressor).ok());
+        auto ctx = std::make_shared<PlainTextLineReaderCtx>("\n", 1, false);
+        NewPlainTextLineReader line_reader(&_profile, file_reader, decompressor.get(), ctx, size,
+                                           range.read_offset);
+        line_reader.set_decompressed_range(range.skip_bytes, range.length);
+        bool skip_line = range.skip_first_line;
+        while (true) {
+            const uint8_t* ptr = nullptr;
+            size_t line_size = 0;
+            bool eof = false;
+            ASSERT_TRUE(line_reader.read_line(&ptr, &line_size, &eof, nullptr).ok());
+            if (eof) {
+                break;
+            }
+            if (skip_line) {
+                skip_line = false;
+                continue;
+            }
+            lines->emplace_back(reinterpret_cast<const char*>(ptr), line_size);
+        }
+    }
+
+protected:
+    const std::string _test_dir = "./zstd_split_line_reader_test";
+    RuntimeProfile _profile {"test"};
+};
+
+TEST_F(ZstdSplitLineReaderTest, SeekTable) {
+    std::string data(300, 'a');
+    std::string file = write_seekable_file(data, {100, 0, 200});
+    ZstdSeekTable seek_table = read_seek_table(file);
+    ASSERT_EQ(seek_table.frames().size(), 3);
+    EXPECT_EQ(seek_table.decompressed_size(), 300);
+    EXPECT_EQ(seek_table.frames()[0].compressed_offset, 0);
+    EXPECT_EQ(seek_table.frames()[2].decompressed_offset, 100);
+    EXPECT_EQ(seek_table.frames()[1].decompressed_size, 0);
+    EXPECT_EQ(seek_table.frames()[2].compressed_offset,
+              seek_table.frames()[1].compressed_offset + seek_table.frames()[1].compressed_size);
+
+    size_t table_size = 0;
+    std::string plain = "not a seekable zstd file";
+    ASSERT_TRUE(ZstdSeekTable::parse_footer(
+                        reinterpret_cast<const uint8_t*>(plain.data()) + plain.size() -
+                                ZstdSeekTable::FOOTER_SIZE,
+                        plain.size(), &table_size)
+                        .ok());
+    EXPECT_EQ(table_size, 0);
+}
+
+TEST_F(ZstdSplitLineReaderTest, ReadSplits) {
+    std::vector<std::string> expected;
+    std::string data;
+    for (int i = 0; i < 3000; ++i) {
+        expected.push_back("row_" + std::to_string(i) + ",value_" + std::to_string(i * 7));
+        data += expected.back() + "\n";
+    }
+    // the frames end in the middle of the lines, at the end of a line, and one is empty
+    std::vector<size_t> chunks;
+    size_t line_end = expected[0].size() + 1 + expected[1].size() + 1;
+    chunks.push_back(line_end);
+    chunks.push_back(0);
+    size_t pos = line_end;
+    for (size_t chunk = 997; pos + chunk < data.size(); chunk = chunk % 3000 + 1231) {
+        chunks.push_back(chunk);
+        pos += chunk;
+    }
+    chunks.push_back(data.size() - pos);
+    std::string file = write_seekable_file(data, chunks);
+    ZstdSeekTable seek_table = read_seek_table(file);
+
+    for (int64_t split_size : {100L, 1024L, 4096L, static_cast<int64_t>(file.size())}) {
+        std::vector<std::string> lines;
+        for (int64_t start = 0; start < static_cast<int64_t>(file.size()); start += split_size) {
+            read_split(seek_table, start, split_size, &lines);
+        }
+        ASSERT_EQ(lines, expected) << split_size;
+    }
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/table/equality_delete.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+class EqualityDeleteTest : public testing::Test {
+public:
+    static ColumnWithTypeAndName create_column(const std::string& name,
+                                               const std::vector<int32_t>& values,
+                                               const std::vector<uint8_t>& null_map) {
+        auto column = ColumnHelper::create_nullable_column_with_name<DataTypeInt32>(values,
+                                                                                    null_map);
+        column.name = name;
+        return column;
+    }
+
+    // Delete the multiples of 3 below 3 * num_delete_rows, and null if delete_null is set.
+    static Block create_delete_block(size_t num_delete_rows, bool multi_columns,
+                                     bool delete_null) {
+        std::vector<int32_t> values;
+        std::vector<uint8_t> null_map;
+        for (size_t i = 0; i < num_delete_rows; ++i) {
+            values.push_back(static_cast<int32_t>(i * 3));
+            null_map.push_back(0);
+        }
+        if (delete_null) {
+            values.push_back(0);
+            null_map.push_back(1);
+        }
+        Block block;
+        block.insert(create_column("a", values, null_map));
+        if (multi_columns) {
+            for (auto& value : values) {
+                value *= 2;
+            }
+            block.insert(create_column("b", values, null_map));
+        }
+        return block;
+    }
+
+    static Block create_data_block(size_t rows, bool with_null) {
+        std::vector<int32_t> values;
+        std::vector<uint8_t> null_map;
+        for (size_t i = 0; i < rows; ++i) {
+            values.push_back(static_cast<int32_t>(i));
+            null_map.push_back(with_null && i % 10 == 1);
+        }
+        Block block;
+        block.insert(create_column("a", values, null_map));
+        for (auto& value : values) {
+            value *= 2;
+        }
+        block.insert(create_column("b", values, null_map));
+        return block;
+    }
+
+    static void check(size_t num_delete_rows, bool multi_columns, bool delete_null,
+                      size_t data_rows) {
+        auto impl = EqualityDeleteBase::get_delete_impl(
+                create_delete_block(num_delete_rows, multi_columns, delete_null));
+        ASSERT_TRUE(impl->init().ok());
+        for (bool with_null : {false, true}) {
+            Block block = create_data_block(data_rows, with_null);
+            std::vector<int32_t> expected;
+            for (size_t i = 0; i < data_rows; ++i) {
+                bool is_null = with_null && i % 10 == 1;
+                bool deleted = is_null ? delete_null : i % 3 == 0 && i < num_delete_rows * 3;
+                if (!deleted) {
+                    expected.push_back(is_null ? -1 : static_cast<int32_t>(i));
+                }
+            }
+            ASSERT_TRUE(impl->filter_data_block(&block).ok());
+            ASSERT_EQ(block.rows(), expected.size());
+            const auto& column =
+                    assert_cast<const ColumnNullable&>(*block.get_by_position(0).column);
+            for (size_t i = 0; i < expected.size(); ++i) {
+                if (expected[i] == -1) {
+                    ASSERT_TRUE(column.is_null_at(i));
+                } else {
+                    ASSERT_EQ(column.get_nested_column().get_int(i), expected[i]);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(EqualityDeleteTest, SimpleEqualityDelete) {
+    check(100, false, false, 1000);
+    check(100, false, true, 1000);
+    // the bloom filter is built, and few rows pass it
+    check(EqualityDeleteBase::BLOOM_FILTER_MIN_DELETE_ROWS, false, true, 100000);
+    // a third of the rows pass the bloom filter, the hash set is probed by the whole block
+    check(EqualityDeleteBase::BLOOM_FILTER_MIN_DELETE_ROWS * 2, false, false, 4096);
+}
+
+TEST_F(EqualityDeleteTest, MultiEqualityDelete) {
+    check(100, true, false, 1000);
+    check(100, true, true, 1000);
+    check(EqualityDeleteBase::BLOOM_FILTER_MIN_DELETE_ROWS, true, true, 100000);
+    check(EqualityDeleteBase::BLOOM_FILTER_MIN_DELETE_ROWS * 2, true, false, 4096);
+}
+
+TEST_F(EqualityDeleteTest, MissingColumn) {
+    auto impl = EqualityDeleteBase::get_delete_impl(create_delete_block(10, true, false));
+    ASSERT_TRUE(impl->init().ok());
+    Block block;
+    block.insert(create_column("a", {1, 2, 3}, {0, 0, 0}));
+    EXPECT_FALSE(impl->filter_data_block(&block).ok());
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/table/paimon_merge_reader.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+class MockRunReader : public GenericReader {
+public:
+    MockRunReader(std::vector<Block> blocks) : _blocks(std::move(blocks)) {}
+
+    Status get_next_block(Block* block, size_t* read_rows, bool* eof) override {
+        if (_index < _blocks.size()) {
+            block->swap(_blocks[_index++]);
+        }
+        *read_rows = block->rows();
+        *eof = _index == _blocks.size();
+        return Status::OK();
+    }
+
+private:
+    std::vector<Block> _blocks;
+    size_t _index = 0;
+};
+
+class PaimonMergeReaderTest : public testing::Test {
+public:
+    struct Row {
+        int32_t key;
+        int64_t sequence;
+        int8_t value_kind;
+        int32_t value;
+    };
+
+    template <typename DataType>
+    static ColumnWithTypeAndName column(const std::string& name,
+                                        const std::vector<typename DataType::FieldType>& values) {
+        auto column = ColumnHelper::create_nullable_column_with_name<DataType>(
+                values, std::vector<uint8_t>(values.size(), 0));
+        column.name = name;
+        return column;
+    }
+
+    static Block create_block(const std::vector<Row>& rows) {
+        std::vector<int32_t> keys;
+        std::vector<int64_t> sequences;
+        std::vector<int8_t> value_kinds;
+        std::vector<int32_t> values;
+        for (const auto& row : rows) {
+            keys.push_back(row.key);
+            sequences.push_back(row.sequence);
+            value_kinds.push_back(row.value_kind);
+            values.push_back(row.value);
+        }
+        Block block;
+        block.insert(column<DataTypeInt32>("k", keys));
+        block.insert(column<DataTypeInt32>("v", values));
+        block.insert(column<DataTypeInt64>(PaimonMergeReader::SEQUENCE_NUMBER, sequences));
+        block.insert(column<DataTypeInt8>(PaimonMergeReader::VALUE_KIND, value_kinds));
+        return block;
+    }
+
+    // Read all the rows, key => value.
+    static std::map<int32_t, int32_t> read(std::vector<std::vector<std::vector<Row>>> runs,
+                                           size_t batch_size) {
+        std::vector<std::unique_ptr<GenericReader>> readers;
+        for (const auto& run : runs) {
+            std::vector<Block> blocks;
+            for (const auto& rows : run) {
+                blocks.push_back(create_block(rows));
+            }
+            readers.push_back(std::make_unique<MockRunReader>(std::move(blocks)));
+        }
+        RuntimeProfile profile("test");
+        PaimonMergeReader reader(std::move(readers), {"k"}, {}, batch_size, &profile);
+        std::map<int32_t, int32_t> result;
+        int32_t last_key = std::numeric_limits<int32_t>::min();
+        bool eof = false;
+        while (!eof) {
+            Block block = create_block({});
+            size_t read_rows = 0;
+            EXPECT_TRUE(reader.get_next_block(&block, &read_rows, &eof).ok());
+            EXPECT_EQ(read_rows, block.rows());
+            const auto& keys = assert_cast<const ColumnNullable&>(*block.get_by_position(0).column);
+            const auto& values =
+                    assert_cast<const ColumnNullable&>(*block.get_by_position(1).column);
+            for (size_t i = 0; i < block.rows(); ++i) {
+                auto key = static_cast<int32_t>(keys.get_nested_column().get_int(i));
+                // sorted by the keys without duplicates
+                EXPECT_GT(key, last_key);
+                last_key = key;
+                result[key] = static_cast<int32_t>(values.get_nested_column().get_int(i));
+            }
+        }
+        EXPECT_TRUE(reader.close().ok());
+        return result;
+    }
+};
+
+TEST_F(PaimonMergeReaderTest, Deduplicate) {
+    std::vector<std::vector<std::vector<Row>>> runs = {
+            {{{1, 1, 0, 10}, {2, 2, 0, 20}}, {{3, 3, 0, 30}, {5, 4, 0, 50}}},
+            {{{2, 5, 2, 21}, {3, 6, 3, 0}}, {{4, 7, 0, 40}}},
+            {{{2, 8, 2, 22}, {5, 9, 1, 0}, {5, 10, 2, 52}}, {{6, 11, 0, 60}}},
+    };
+    std::map<int32_t, int32_t> expected = {{1, 10}, {2, 22}, {4, 40}, {5, 52}, {6, 60}};
+    for (size_t batch_size : {1, 2, 3, 4096}) {
+        EXPECT_EQ(read(runs, batch_size), expected) << batch_size;
+    }
+}
+
+TEST_F(PaimonMergeReaderTest, DeletedLastKey) {
+    std::vector<std::vector<std::vector<Row>>> runs = {
+            {{{1, 1, 0, 10}, {2, 2, 0, 20}}},
+            {{{2, 3, 3, 0}}},
+    };
+    std::map<int32_t, int32_t> expected = {{1, 10}};
+    for (size_t batch_size : {1, 4096}) {
+        EXPECT_EQ(read(runs, batch_size), expected) << batch_size;
+    }
+    EXPECT_TRUE(read({{{{1, 1, 3, 0}}}}, 4096).empty());
+}
+
+TEST_F(PaimonMergeReaderTest, MissingColumn) {
+    std::vector<std::unique_ptr<GenericReader>> readers;
+    readers.push_back(std::make_unique<MockRunReader>(std::vector<Block> {}));
+    RuntimeProfile profile("test");
+    PaimonMergeReader reader(std::move(readers), {"pk"}, {}, 4096, &profile);
+    Block block = create_block({});
+    size_t read_rows = 0;
+    bool eof = false;
+    EXPECT_FALSE(reader.get_next_block(&block, &read_rows, &eof).ok());
+}
+
+} // namespace doris::vectorized
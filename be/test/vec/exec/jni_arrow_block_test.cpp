@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <arrow/array/builder_binary.h>
+#include <arrow/array/builder_primitive.h>
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <cctz/time_zone.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+#include "vec/exec/jni_connector.h"
+
+namespace doris::vectorized {
+
+class JniArrowBlockTest : public testing::Test {
+public:
+    static Block create_block() {
+        Block block;
+        auto int_type = std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt32>());
+        auto string_type = std::make_shared<DataTypeNullable>(std::make_shared<DataTypeString>());
+        block.insert({int_type->create_column(), int_type, "k1"});
+        block.insert({string_type->create_column(), string_type, "k2"});
+        return block;
+    }
+
+    static std::shared_ptr<arrow::RecordBatch> create_batch(int start, int rows) {
+        arrow::Int32Builder int_builder;
+        arrow::StringBuilder string_builder;
+        for (int i = start; i < start + rows; ++i) {
+            if (i % 5 == 0) {
+                EXPECT_TRUE(int_builder.AppendNull().ok());
+            } else {
+                EXPECT_TRUE(int_builder.Append(i).ok());
+            }
+            EXPECT_TRUE(string_builder.Append("v" + std::to_string(i)).ok());
+        }
+        std::shared_ptr<arrow::Array> ints;
+        std::shared_ptr<arrow::Array> strings;
+        EXPECT_TRUE(int_builder.Finish(&ints).ok());
+        EXPECT_TRUE(string_builder.Finish(&strings).ok());
+        // the columns in the batch are in another order than in the block
+        auto schema = arrow::schema({arrow::field("k2", arrow::utf8(), true),
+                                     arrow::field("k1", arrow::int32(), true)});
+        return arrow::RecordBatch::Make(schema, rows, {strings, ints});
+    }
+};
+
+TEST_F(JniArrowBlockTest, FillBlock) {
+    Block block = create_block();
+    cctz::time_zone ctz = cctz::utc_time_zone();
+    // the batches are appended to the block
+    for (int start : {0, 100}) {
+        ArrowArray array;
+        ArrowSchema schema;
+        ASSERT_TRUE(arrow::ExportRecordBatch(*create_batch(start, 100), &array, &schema).ok());
+        size_t num_rows = 0;
+        ASSERT_TRUE(JniConnector::fill_block_from_arrow(&block, &array, &schema, ctz, &num_rows)
+                            .ok());
+        EXPECT_EQ(num_rows, 100);
+        EXPECT_EQ(array.release, nullptr);
+        EXPECT_EQ(schema.release, nullptr);
+    }
+    ASSERT_EQ(block.rows(), 200);
+    const auto& k1 = assert_cast<const ColumnNullable&>(*block.get_by_name("k1").column);
+    const auto& k2 = assert_cast<const ColumnNullable&>(*block.get_by_name("k2").column);
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_EQ(k1.is_null_at(i), i % 5 == 0);
+        if (i % 5 != 0) {
+            ASSERT_EQ(assert_cast<const ColumnInt32&>(k1.get_nested_column()).get_element(i), i);
+        }
+        ASSERT_EQ(k2.get_nested_column().get_data_at(i).to_string(), "v" + std::to_string(i));
+    }
+}
+
+TEST_F(JniArrowBlockTest, MissingColumn) {
+    Block block;
+    auto int_type = std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt32>());
+    block.insert({int_type->create_column(), int_type, "k1"});
+    ArrowArray array;
+    ArrowSchema schema;
+    ASSERT_TRUE(arrow::ExportRecordBatch(*create_batch(0, 10), &array, &schema).ok());
+    size_t num_rows = 0;
+    EXPECT_FALSE(JniConnector::fill_block_from_arrow(&block, &array, &schema,
+                                                     cctz::utc_time_zone(), &num_rows)
+                         .ok());
+    // the imported batch is released
+    EXPECT_EQ(array.release, nullptr);
+    EXPECT_EQ(schema.release, nullptr);
+}
+
+} // namespace doris::vectorized
@@ -18,20 +18,27 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
 
+#include "exprs/create_predicate_function.h"
+#include "exprs/hybrid_set.h"
 #include "orc/sargs/SearchArgument.hh"
 #include "runtime/define_primitive_type.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "runtime/types.h"
 #include "testutil/desc_tbl_builder.h"
 #include "vec/exec/format/orc/orc_memory_pool.h"
 #include "vec/exec/format/orc/vorc_reader.h"
+#include "vec/exprs/vdirect_in_predicate.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vexpr_fwd.h"
+#include "vec/exprs/vruntimefilter_wrapper.h"
+#include "vec/exprs/vslot_ref.h"
 #include "vec/utils/util.hpp"
 namespace doris::vectorized {
 class OrcReaderTest : public testing::Test {
@@ -42,6 +49,15 @@ public:
 private:
     static constexpr const char* CANNOT_PUSH_DOWN_ERROR = "can't push down";
     std::string build_search_argument(const std::string& expr) {
+        return build_search_argument([&](const TupleDescriptor*, VExprContextSPtr& context) {
+            // deserialize expr
+            auto exprx = apache::thrift::from_json_string<TExpr>(expr);
+            return VExpr::create_expr_tree(exprx, context);
+        });
+    }
+
+    std::string build_search_argument(
+            const std::function<Status(const TupleDescriptor*, VExprContextSPtr&)>& create_expr) {
         // build orc_reader for table orders
         std::vector<std::string> column_names = {
                 "o_orderkey",      "o_custkey", "o_orderstatus",  "o_totalprice", "o_orderdate",
@@ -80,10 +96,8 @@ private:
                                           &row_desc, nullptr, nullptr);
         EXPECT_TRUE(status.ok());
 
-        // deserialize expr
-        auto exprx = apache::thrift::from_json_string<TExpr>(expr);
         VExprContextSPtr context;
-        status = VExpr::create_expr_tree(exprx, context);
+        status = create_expr(tuple_desc, context);
         EXPECT_TRUE(status.ok());
 
         // prepare expr context
@@ -167,4 +181,35 @@ TEST_F(OrcReaderTest, test_build_search_argument) {
     }
 }
 
+TEST_F(OrcReaderTest, test_build_search_argument_by_in_runtime_filter) {
+    auto create_in_filter = [](int size, bool null_aware) {
+        return [size, null_aware](const TupleDescriptor* tuple_desc, VExprContextSPtr& context) {
+            std::shared_ptr<HybridSetBase> set(create_set(TYPE_INT, size_t(size), null_aware));
+            for (int32_t i = 1; i <= size; ++i) {
+                set->insert(&i);
+            }
+            TExprNode node;
+            node.__set_type(create_type_desc(PrimitiveType::TYPE_BOOLEAN));
+            node.__set_node_type(null_aware ? TExprNodeType::NULL_AWARE_IN_PRED
+                                            : TExprNodeType::IN_PRED);
+            node.in_predicate.__set_is_not_in(false);
+            node.__set_opcode(TExprOpcode::FILTER_IN);
+            node.__set_is_nullable(false);
+            auto in_pred = VDirectInPredicate::create_shared(node, set);
+            // o_orderkey
+            in_pred->add_child(VSlotRef::create_shared(tuple_desc->slots()[0]));
+            context = VExprContext::create_shared(
+                    VRuntimeFilterWrapper::create_shared(node, in_pred, 0, null_aware, 1));
+            return Status::OK();
+        };
+    };
+    EXPECT_EQ(build_search_argument(create_in_filter(1, false)),
+              "leaf-0 = (o_orderkey = 1), expr = leaf-0");
+    EXPECT_EQ(build_search_argument(create_in_filter(3, false)),
+              "leaf-0 = (o_orderkey in [1, 2, 3]), expr = leaf-0");
+    EXPECT_EQ(build_search_argument(create_in_filter(3, true)), CANNOT_PUSH_DOWN_ERROR);
+    // more values than max_pushdown_conditions_per_column
+    EXPECT_EQ(build_search_argument(create_in_filter(2000, false)), CANNOT_PUSH_DOWN_ERROR);
+}
+
 } // namespace doris::vectorized
@@ -26,6 +26,7 @@
 #include <random>
 #include <utility>
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "runtime/runtime_state.h"
 #include "testutil/column_helper.h"
@@ -121,4 +122,44 @@ TEST_F(FullSorterTest, test_full_sorter3) {
     EXPECT_EQ(sorter->_state->get_sorted_block()[1]->rows(), 4);
 }
 
+TEST_F(FullSorterTest, test_parallel_full_sorter) {
+    config::full_sort_parallel_min_rows = 1000;
+    config::full_sort_parallel_max_threads = 4;
+    sorter = FullSorter::create_unique(sort_exec_exprs, -1, 0, &pool, is_asc_order, nulls_first,
+                                       *row_desc, &_state, nullptr);
+    sorter->init_profile(&_profile);
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int64_t> dist(0, 500);
+    for (int i = 0; i < 3; ++i) {
+        std::vector<int64_t> values(1000);
+        for (auto& value : values) {
+            value = dist(gen);
+        }
+        Block block = ColumnHelper::create_block<DataTypeInt64>(values);
+        EXPECT_TRUE(sorter->append_block(&block).ok());
+        // the first two blocks are sorted serially, the last one in parallel
+        if (i < 2) {
+            EXPECT_TRUE(sorter->_do_sort().ok());
+        }
+    }
+    EXPECT_TRUE(sorter->prepare_for_read().ok());
+    EXPECT_TRUE(sorter->_state->_parallel_merged);
+
+    std::vector<int64_t> output;
+    bool eos = false;
+    while (!eos) {
+        Block block;
+        EXPECT_TRUE(sorter->get_next(&_state, &block, &eos).ok());
+        for (size_t i = 0; i < block.rows(); ++i) {
+            output.push_back(block.get_by_position(0).column->get_int(i));
+        }
+    }
+    EXPECT_EQ(output.size(), 3000);
+    EXPECT_TRUE(std::is_sorted(output.begin(), output.end()));
+
+    config::full_sort_parallel_min_rows = 1048576;
+    config::full_sort_parallel_max_threads = 8;
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
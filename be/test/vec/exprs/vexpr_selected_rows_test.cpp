@@ -0,0 +1,229 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/Opcodes_types.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_factory.hpp"
+#include "vec/exprs/vcase_expr.h"
+#include "vec/exprs/vcompound_pred.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_context.h"
+
+namespace doris::vectorized {
+
+// A function of the slot at column_id, which counts the rows it is executed on.
+class RowCountingExpr final : public VExpr {
+public:
+    using Function = std::function<int32_t(int32_t)>;
+
+    RowCountingExpr(PrimitiveType type, int column_id, Function function)
+            : VExpr(DataTypeFactory::instance().create_data_type(type, false), false),
+              _column_id(column_id),
+              _function(std::move(function)) {
+        _node_type = TExprNodeType::FUNCTION_CALL;
+    }
+
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override {
+        const auto& input =
+                assert_cast<const ColumnInt32&>(*block->get_by_position(_column_id).column);
+        _rows += input.size();
+        MutableColumnPtr result;
+        if (_data_type->get_primitive_type() == TYPE_BOOLEAN) {
+            auto predicate = ColumnUInt8::create();
+            for (int32_t value : input.get_data()) {
+                predicate->insert_value(_function(value) != 0);
+            }
+            result = std::move(predicate);
+        } else {
+            auto values = ColumnInt32::create();
+            for (int32_t value : input.get_data()) {
+                values->insert_value(_function(value));
+            }
+            result = std::move(values);
+        }
+        *result_column_id = block->columns();
+        block->insert({std::move(result), _data_type, _name});
+        return Status::OK();
+    }
+
+    const std::string& expr_name() const override { return _name; }
+
+    bool is_constant() const override { return false; }
+
+    void collect_slot_column_ids(std::set<int>& column_ids) const override {
+        column_ids.insert(_column_id);
+    }
+
+    size_t rows() const { return _rows; }
+
+private:
+    const std::string _name = "row_counting";
+    int _column_id;
+    Function _function;
+    size_t _rows = 0;
+};
+
+class VExprSelectedRowsTest : public testing::Test {
+public:
+    static constexpr int32_t NUM_ROWS = 1000;
+
+    void SetUp() override {
+        auto column = ColumnInt32::create();
+        for (int32_t i = 0; i < NUM_ROWS; ++i) {
+            column->insert_value(i);
+        }
+        // the expr only reads the column at 1
+        _block.insert({ColumnInt32::create(NUM_ROWS, 0),
+                       DataTypeFactory::instance().create_data_type(TYPE_INT, false), "unused"});
+        _block.insert({std::move(column),
+                       DataTypeFactory::instance().create_data_type(TYPE_INT, false), "x"});
+    }
+
+    static std::shared_ptr<RowCountingExpr> divisible_by(int32_t divisor) {
+        return std::make_shared<RowCountingExpr>(TYPE_BOOLEAN, 1, [divisor](int32_t x) {
+            return x % divisor == 0;
+        });
+    }
+
+    static std::shared_ptr<RowCountingExpr> multiply(int32_t factor) {
+        return std::make_shared<RowCountingExpr>(TYPE_INT, 1,
+                                                 [factor](int32_t x) { return x * factor; });
+    }
+
+    static TExprNode expr_node(TExprNodeType::type node_type, PrimitiveType type,
+                               size_t num_children) {
+        TExprNode node;
+        node.__set_node_type(node_type);
+        node.__set_type(DataTypeFactory::instance().create_data_type(type, false)->to_thrift());
+        node.__set_is_nullable(false);
+        node.__set_num_children(static_cast<int32_t>(num_children));
+        return node;
+    }
+
+    ColumnPtr execute(const VExprSPtr& root) {
+        auto context = std::make_shared<VExprContext>(root);
+        EXPECT_TRUE(context->prepare(&_state, _row_desc).ok());
+        EXPECT_TRUE(context->open(&_state).ok());
+        int result_column_id = -1;
+        EXPECT_TRUE(context->execute(&_block, &result_column_id).ok());
+        return _block.get_by_position(result_column_id).column->convert_to_full_column_if_const();
+    }
+
+protected:
+    RuntimeState _state;
+    RowDescriptor _row_desc;
+    Block _block;
+};
+
+TEST_F(VExprSelectedRowsTest, CaseWhen) {
+    // CASE WHEN x % 2 = 0 THEN x * 10 WHEN x % 3 = 0 THEN x * 100 ELSE x END
+    auto when1 = divisible_by(2);
+    auto then1 = multiply(10);
+    auto when2 = divisible_by(3);
+    auto then2 = multiply(100);
+    auto else_expr = multiply(1);
+    TExprNode node = expr_node(TExprNodeType::CASE_EXPR, TYPE_INT, 5);
+    TCaseExpr case_expr;
+    case_expr.__set_has_case_expr(false);
+    case_expr.__set_has_else_expr(true);
+    node.__set_case_expr(case_expr);
+    auto root = VCaseExpr::create_shared(node);
+    for (const auto& child : {VExprSPtr(when1), VExprSPtr(then1), VExprSPtr(when2),
+                              VExprSPtr(then2), VExprSPtr(else_expr)}) {
+        root->add_child(child);
+    }
+
+    auto result = execute(root);
+    const auto& data = assert_cast<const ColumnInt32&>(*result).get_data();
+    ASSERT_EQ(data.size(), NUM_ROWS);
+    for (int32_t x = 0; x < NUM_ROWS; ++x) {
+        EXPECT_EQ(data[x], x % 2 == 0 ? x * 10 : (x % 3 == 0 ? x * 100 : x)) << x;
+    }
+    EXPECT_EQ(when1->rows(), NUM_ROWS);
+    // the second WHEN only sees the odd rows, each THEN only the rows of its branch
+    EXPECT_EQ(when2->rows(), NUM_ROWS / 2);
+    EXPECT_EQ(then1->rows(), NUM_ROWS / 2);
+    EXPECT_EQ(then2->rows(), 167);
+    EXPECT_EQ(else_expr->rows(), NUM_ROWS / 2 - 167);
+}
+
+TEST_F(VExprSelectedRowsTest, CaseWhenWithoutElse) {
+    auto when = divisible_by(4);
+    auto then = multiply(2);
+    TExprNode node = expr_node(TExprNodeType::CASE_EXPR, TYPE_INT, 2);
+    node.__set_is_nullable(true);
+    node.__set_type(DataTypeFactory::instance().create_data_type(TYPE_INT, true)->to_thrift());
+    TCaseExpr case_expr;
+    case_expr.__set_has_case_expr(false);
+    case_expr.__set_has_else_expr(false);
+    node.__set_case_expr(case_expr);
+    auto root = VCaseExpr::create_shared(node);
+    root->add_child(when);
+    root->add_child(then);
+
+    auto result = execute(root);
+    ASSERT_EQ(result->size(), NUM_ROWS);
+    for (int32_t x = 0; x < NUM_ROWS; ++x) {
+        if (x % 4 == 0) {
+            ASSERT_FALSE(result->is_null_at(x));
+            const auto& nullable = assert_cast<const ColumnNullable&>(*result);
+            EXPECT_EQ(assert_cast<const ColumnInt32&>(nullable.get_nested_column()).get_element(x),
+                      x * 2);
+        } else {
+            EXPECT_TRUE(result->is_null_at(x));
+        }
+    }
+    EXPECT_EQ(then->rows(), NUM_ROWS / 4);
+}
+
+TEST_F(VExprSelectedRowsTest, AndOr) {
+    for (auto op : {TExprOpcode::COMPOUND_AND, TExprOpcode::COMPOUND_OR}) {
+        auto lhs = divisible_by(2);
+        auto rhs = divisible_by(3);
+        TExprNode node = expr_node(TExprNodeType::COMPOUND_PRED, TYPE_BOOLEAN, 2);
+        node.__set_opcode(op);
+        auto root = VCompoundPred::create_shared(node);
+        root->add_child(lhs);
+        root->add_child(rhs);
+
+        auto result = execute(root);
+        const auto& data = assert_cast<const ColumnUInt8&>(*result).get_data();
+        ASSERT_EQ(data.size(), NUM_ROWS);
+        for (int32_t x = 0; x < NUM_ROWS; ++x) {
+            bool expected = op == TExprOpcode::COMPOUND_AND ? x % 2 == 0 && x % 3 == 0
+                                                            : x % 2 == 0 || x % 3 == 0;
+            EXPECT_EQ(data[x], expected) << x;
+        }
+        EXPECT_EQ(lhs->rows(), NUM_ROWS);
+        // the rhs only runs on the rows the lhs doesn't decide
+        EXPECT_EQ(rhs->rows(), NUM_ROWS / 2);
+    }
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,42 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vruntimefilter_wrapper.h"
+
+#include <gtest/gtest.h>
+
+namespace doris::vectorized {
+
+TEST(VRuntimeFilterWrapperTest, JudgeSelectivity) {
+    bool always_true = false;
+    VRuntimeFilterWrapper::judge_selectivity(0.4, 30, 100, always_true);
+    EXPECT_TRUE(always_true);
+    VRuntimeFilterWrapper::judge_selectivity(0.4, 50, 100, always_true);
+    EXPECT_FALSE(always_true);
+}
+
+TEST(VRuntimeFilterWrapperTest, JudgeCost) {
+    // no benefit configured, only the selectivity counts
+    EXPECT_FALSE(VRuntimeFilterWrapper::judge_cost(0, 0, 1000000));
+    // 100 removed rows save 1000ns, more than the 800ns the filter took
+    EXPECT_FALSE(VRuntimeFilterWrapper::judge_cost(10, 100, 800));
+    // but not the 2000ns
+    EXPECT_TRUE(VRuntimeFilterWrapper::judge_cost(10, 100, 2000));
+    EXPECT_TRUE(VRuntimeFilterWrapper::judge_cost(10, 0, 1));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,192 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/exprs/vshared_expr.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_factory.hpp"
+#include "vec/exprs/vectorized_fn_call.h"
+#include "vec/exprs/vexpr_context.h"
+
+namespace doris::vectorized {
+
+// A builtin function of the column at 0 or of its child, which adds one and counts its calls.
+class CountingFnCall final : public VectorizedFnCall {
+public:
+    explicit CountingFnCall(const std::string& name) {
+        _fn.name.function_name = name;
+        _fn.binary_type = TFunctionBinaryType::BUILTIN;
+        _node_type = TExprNodeType::FUNCTION_CALL;
+        _data_type = DataTypeFactory::instance().create_data_type(TYPE_INT, false);
+        _expr_name = name;
+    }
+
+    Status prepare(RuntimeState* state, const RowDescriptor& desc,
+                   VExprContext* context) override {
+        return VExpr::prepare(state, desc, context);
+    }
+
+    Status open(RuntimeState* state, VExprContext* context,
+                FunctionContext::FunctionStateScope scope) override {
+        return VExpr::open(state, context, scope);
+    }
+
+    void close(VExprContext* context, FunctionContext::FunctionStateScope scope) override {
+        VExpr::close(context, scope);
+    }
+
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override {
+        ++_calls;
+        int input_column_id = 0;
+        if (!_children.empty()) {
+            RETURN_IF_ERROR(_children[0]->execute(context, block, &input_column_id));
+        }
+        const auto& input =
+                assert_cast<const ColumnInt32&>(*block->get_by_position(input_column_id).column);
+        auto result = ColumnInt32::create();
+        for (int32_t value : input.get_data()) {
+            result->insert_value(value + 1);
+        }
+        *result_column_id = static_cast<int>(block->columns());
+        block->insert({std::move(result), _data_type, _expr_name});
+        return Status::OK();
+    }
+
+    const std::string& expr_name() const override { return _expr_name; }
+
+    bool is_constant() const override { return false; }
+
+    size_t calls() const { return _calls; }
+
+private:
+    size_t _calls = 0;
+};
+
+class VSharedExprTest : public testing::Test {
+public:
+    void SetUp() override {
+        auto column = ColumnInt32::create();
+        for (int32_t i = 0; i < 100; ++i) {
+            column->insert_value(i);
+        }
+        _block.insert({std::move(column),
+                       DataTypeFactory::instance().create_data_type(TYPE_INT, false), "x"});
+    }
+
+    static std::shared_ptr<CountingFnCall> call(const std::string& name,
+                                                const VExprSPtr& child = nullptr) {
+        auto expr = std::make_shared<CountingFnCall>(name);
+        if (child != nullptr) {
+            expr->add_child(child);
+        }
+        return expr;
+    }
+
+    VExprContextSPtrs prepare(const VExprSPtrs& roots) {
+        VExprContextSPtrs contexts;
+        for (const auto& root : roots) {
+            contexts.push_back(std::make_shared<VExprContext>(root));
+            EXPECT_TRUE(contexts.back()->prepare(&_state, _row_desc).ok());
+        }
+        return contexts;
+    }
+
+    void open(const VExprContextSPtrs& contexts) {
+        for (const auto& context : contexts) {
+            EXPECT_TRUE(context->open(&_state).ok());
+        }
+    }
+
+    int32_t execute(const VExprContextSPtr& context, size_t row) {
+        int result_column_id = -1;
+        EXPECT_TRUE(context->execute(&_block, &result_column_id).ok());
+        return assert_cast<const ColumnInt32&>(*_block.get_by_position(result_column_id).column)
+                .get_element(row);
+    }
+
+protected:
+    RuntimeState _state;
+    RowDescriptor _row_desc;
+    Block _block;
+};
+
+TEST_F(VSharedExprTest, ShareCommonSubexpr) {
+    // f(g(x)), h(g(x)), g(x)
+    auto g1 = call("g");
+    auto g2 = call("g");
+    auto g3 = call("g");
+    auto f = call("f", g1);
+    auto h = call("h", g2);
+    auto contexts = prepare({f, h, g3});
+
+    size_t num_slots = 0;
+    VSharedExpr::share_common_subexprs(contexts, &num_slots);
+    EXPECT_EQ(num_slots, 1);
+    open(contexts);
+    auto results = SharedExprResults::create(num_slots, contexts, {});
+    ASSERT_NE(results, nullptr);
+
+    EXPECT_EQ(execute(contexts[0], 10), 12);
+    EXPECT_EQ(execute(contexts[1], 10), 12);
+    EXPECT_EQ(execute(contexts[2], 10), 11);
+    EXPECT_EQ(g1->calls() + g2->calls() + g3->calls(), 1);
+    EXPECT_EQ(f->calls(), 1);
+    EXPECT_EQ(h->calls(), 1);
+
+    // the next block computes it again
+    results->reset();
+    for (const auto& context : contexts) {
+        execute(context, 0);
+    }
+    EXPECT_EQ(g1->calls() + g2->calls() + g3->calls(), 2);
+}
+
+TEST_F(VSharedExprTest, DifferentArguments) {
+    // g(x) and g(g(x)) only share the inner g(x)
+    auto inner = call("g");
+    auto outer = call("g", call("g"));
+    auto contexts = prepare({inner, outer});
+
+    size_t num_slots = 0;
+    VSharedExpr::share_common_subexprs(contexts, &num_slots);
+    EXPECT_EQ(num_slots, 1);
+    open(contexts);
+    auto results = SharedExprResults::create(num_slots, contexts, {});
+    EXPECT_EQ(execute(contexts[0], 5), 6);
+    EXPECT_EQ(execute(contexts[1], 5), 7);
+    EXPECT_EQ(inner->calls(), 1);
+    EXPECT_EQ(outer->calls(), 1);
+}
+
+TEST_F(VSharedExprTest, NonDeterministic) {
+    auto contexts = prepare({call("random"), call("random")});
+    size_t num_slots = 0;
+    VSharedExpr::share_common_subexprs(contexts, &num_slots);
+    EXPECT_EQ(num_slots, 0);
+    EXPECT_EQ(SharedExprResults::create(num_slots, contexts, {}), nullptr);
+}
+
+} // namespace doris::vectorized
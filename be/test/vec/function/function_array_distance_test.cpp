@@ -0,0 +1,176 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/functions/array/function_array_distance.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "function_test_util.h"
+#include "util/simd/vector_distance.h"
+#include "vec/columns/column_const.h"
+#include "vec/core/types.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+TEST(function_array_distance_test, kernels) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(-10, 10);
+    for (size_t n = 0; n < 40; ++n) {
+        std::vector<double> x(n);
+        std::vector<double> y(n);
+        double l1 = 0;
+        double l2 = 0;
+        double dot = 0;
+        double squared_x = 0;
+        double squared_y = 0;
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = dist(rng);
+            y[i] = dist(rng);
+            l1 += std::fabs(x[i] - y[i]);
+            l2 += (x[i] - y[i]) * (x[i] - y[i]);
+            dot += x[i] * y[i];
+            squared_x += x[i] * x[i];
+            squared_y += y[i] * y[i];
+        }
+        EXPECT_NEAR(simd::l1_distance(x.data(), y.data(), n), l1, 1e-9) << n;
+        EXPECT_NEAR(simd::l2_squared_distance(x.data(), y.data(), n), l2, 1e-9) << n;
+        EXPECT_NEAR(simd::inner_product(x.data(), y.data(), n), dot, 1e-9) << n;
+        double dot_prod = -1;
+        double norm_x = -1;
+        double norm_y = -1;
+        simd::inner_product_and_squared_norm(x.data(), y.data(), n, &dot_prod, &norm_x);
+        EXPECT_NEAR(dot_prod, dot, 1e-9) << n;
+        EXPECT_NEAR(norm_x, squared_x, 1e-9) << n;
+        simd::inner_product_and_squared_norms(x.data(), y.data(), n, &dot_prod, &norm_x, &norm_y);
+        EXPECT_NEAR(dot_prod, dot, 1e-9) << n;
+        EXPECT_NEAR(norm_x, squared_x, 1e-9) << n;
+        EXPECT_NEAR(norm_y, squared_y, 1e-9) << n;
+    }
+}
+
+TEST(function_array_distance_test, distances) {
+    InputTypeSet input_types = {PrimitiveType::TYPE_ARRAY, PrimitiveType::TYPE_DOUBLE,
+                                PrimitiveType::TYPE_ARRAY, PrimitiveType::TYPE_DOUBLE};
+    TestArray vec1 = {double(1), double(2), double(3), double(4), double(5)};
+    TestArray vec2 = {double(2), double(4), double(6), double(8), double(10)};
+    TestArray vec3 = {double(1), double(0)};
+    TestArray vec4 = {double(4), double(4)};
+    TestArray with_null = {double(1), Null()};
+    TestArray zero = {double(0), double(0)};
+    TestArray empty_arr;
+
+    {
+        DataSet data_set = {{{vec1, vec2}, double(15)},    {{vec3, vec4}, double(7)},
+                            {{Null(), vec1}, Null()},      {{with_null, vec3}, Null()},
+                            {{empty_arr, empty_arr}, double(0)}};
+        static_cast<void>(
+                check_function<DataTypeFloat64, true>("l1_distance", input_types, data_set));
+    }
+    {
+        DataSet data_set = {{{vec3, vec4}, double(5)},
+                            {{vec4, vec4}, double(0)},
+                            {{vec3, Null()}, Null()},
+                            {{vec3, with_null}, Null()}};
+        static_cast<void>(
+                check_function<DataTypeFloat64, true>("l2_distance", input_types, data_set));
+    }
+    {
+        DataSet data_set = {{{vec1, vec2}, double(110)},
+                            {{vec3, vec4}, double(4)},
+                            {{with_null, vec3}, Null()}};
+        static_cast<void>(
+                check_function<DataTypeFloat64, true>("inner_product", input_types, data_set));
+    }
+    {
+        // the distance to a zero vector is NaN, and returned as null
+        DataSet data_set = {{{vec1, vec2}, double(0)},
+                            {{vec3, TestArray {double(0), double(3)}}, double(1)},
+                            {{zero, vec3}, Null()},
+                            {{with_null, vec3}, Null()}};
+        static_cast<void>(
+                check_function<DataTypeFloat64, true>("cosine_distance", input_types, data_set));
+    }
+}
+
+class FunctionArrayDistanceConstTest : public testing::Test {
+public:
+    static ColumnPtr make_arrays(const std::vector<std::vector<double>>& rows) {
+        auto nested = ColumnFloat64::create();
+        auto offsets = ColumnArray::ColumnOffsets::create();
+        for (const auto& row : rows) {
+            for (double value : row) {
+                nested->insert_value(value);
+            }
+            offsets->insert_value(nested->size());
+        }
+        size_t num_elements = nested->size();
+        auto nested_nullable =
+                ColumnNullable::create(std::move(nested), ColumnUInt8::create(num_elements, 0));
+        return ColumnArray::create(std::move(nested_nullable), std::move(offsets));
+    }
+
+    static double value_at(const ColumnPtr& column, size_t row) {
+        const auto& nullable = assert_cast<const ColumnNullable&>(*column);
+        return assert_cast<const ColumnFloat64&>(nullable.get_nested_column()).get_element(row);
+    }
+
+    template <typename DistanceImpl>
+    static ColumnPtr execute(ColumnPtr col1, ColumnPtr col2, size_t rows) {
+        DataTypePtr type = std::make_shared<DataTypeArray>(
+                make_nullable(std::make_shared<DataTypeFloat64>()));
+        Block block({{std::move(col1), type, "x"},
+                     {std::move(col2), type, "y"},
+                     {nullptr, make_nullable(std::make_shared<DataTypeFloat64>()), "result"}});
+        FunctionArrayDistance<DistanceImpl> function;
+        EXPECT_TRUE(function.execute_impl(nullptr, block, {0, 1}, 2, rows).ok());
+        return block.get_by_position(2).column;
+    }
+};
+
+TEST_F(FunctionArrayDistanceConstTest, ConstQuery) {
+    auto data = make_arrays({{3, 4}, {0, 0}, {1, 1}});
+    auto query = ColumnConst::create(make_arrays({{0, 1}}), 3);
+    for (bool query_first : {false, true}) {
+        auto l2 = query_first ? execute<L2Distance>(query, data, 3)
+                              : execute<L2Distance>(data, query, 3);
+        EXPECT_DOUBLE_EQ(value_at(l2, 0), std::sqrt(18.0));
+        EXPECT_DOUBLE_EQ(value_at(l2, 1), 1);
+        EXPECT_DOUBLE_EQ(value_at(l2, 2), 1);
+
+        auto cosine = query_first ? execute<CosineDistance>(query, data, 3)
+                                  : execute<CosineDistance>(data, query, 3);
+        EXPECT_DOUBLE_EQ(value_at(cosine, 0), 1 - 4.0 / 5);
+        EXPECT_TRUE(cosine->is_null_at(1));
+        EXPECT_DOUBLE_EQ(value_at(cosine, 2), 1 - 1 / std::sqrt(2.0));
+    }
+
+    FunctionArrayDistance<InnerProduct> function;
+    DataTypePtr type =
+            std::make_shared<DataTypeArray>(make_nullable(std::make_shared<DataTypeFloat64>()));
+    Block block({{data, type, "x"},
+                 {ColumnConst::create(make_arrays({{0, 1, 2}}), 3), type, "y"},
+                 {nullptr, make_nullable(std::make_shared<DataTypeFloat64>()), "result"}});
+    EXPECT_FALSE(function.execute_impl(nullptr, block, {0, 1}, 2, 3).ok());
+}
+
+} // namespace doris::vectorized
@@ -15,11 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "function_test_util.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 #include "vec/functions/complex_hash_map_dictionary.h"
@@ -132,4 +135,39 @@ TEST(ComplexHashMapDictTest, Test1) {
             "dict1");
 }
 
+TEST(ComplexHashMapDictTest, SingleNumberKey) {
+    auto value_type = std::make_shared<DataTypeInt64>();
+    auto key_type = std::make_shared<DataTypeInt32>();
+    // dense keys are looked up by the direct index, sparse ones in the hash map
+    for (const auto& keys :
+         {std::vector<Int32> {-2, 0, -1, 1}, std::vector<Int32> {-2, 0, 1 << 30}}) {
+        std::vector<Int64> values;
+        for (auto key : keys) {
+            values.push_back(key * 10L);
+        }
+        auto dict = create_complex_hash_map_dict_from_column(
+                "dict", {create_column_with_data_and_name<DataTypeInt32>(keys, "key")},
+                {create_column_with_data_and_name<DataTypeInt64>(values, "value")});
+
+        std::vector<Int32> lookup_keys {0, -2, 5, -3, 1 << 30, 1, INT32_MIN};
+        auto result = dict->get_tuple_columns(
+                {"value"}, {value_type}, {create_column_with_data<DataTypeInt32>(lookup_keys)},
+                {key_type})[0];
+        ASSERT_EQ(result->size(), lookup_keys.size());
+        const auto& nullable = assert_cast<const ColumnNullable&>(*result);
+        const auto& data = assert_cast<const ColumnInt64&>(nullable.get_nested_column()).get_data();
+        for (size_t i = 0; i < lookup_keys.size(); ++i) {
+            bool found = std::find(keys.begin(), keys.end(), lookup_keys[i]) != keys.end();
+            ASSERT_EQ(nullable.is_null_at(i), !found) << lookup_keys[i];
+            if (found) {
+                EXPECT_EQ(data[i], lookup_keys[i] * 10L);
+            }
+        }
+    }
+
+    EXPECT_ANY_THROW(create_complex_hash_map_dict_from_column(
+            "dict", {create_column_with_data_and_name<DataTypeInt32>({1, 2, 1}, "key")},
+            {create_column_with_data_and_name<DataTypeInt64>({1, 2, 3}, "value")}));
+}
+
 } // namespace doris::vectorized
@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 #include <stdint.h>
 
+#include <random>
 #include <vector>
 
 #include "common/status.h"
@@ -56,4 +57,89 @@ TEST(FunctionConvertTZTest, test_no_open_but_execute_const) {
     EXPECT_EQ(st.ok(), true) << st.msg();
 }
 
+class FunctionConvertTZStateTest : public testing::Test {
+public:
+    using Value = DateV2Value<DateTimeV2ValueType>;
+
+    static UInt64 datetime(int year, int month, int day, int hour, int minute, int second,
+                           uint32_t microsecond = 0) {
+        Value value;
+        value.unchecked_set_time(year, month, day, hour, minute, second, microsecond);
+        return binary_cast<Value, UInt64>(value);
+    }
+
+    // Convert the values with the state of the zones and check them against cctz.
+    static void check(const std::string& from_name, const std::string& to_name,
+                      const std::vector<UInt64>& values) {
+        auto state = std::make_shared<ConvertTzState>();
+        state->use_state = true;
+        state->is_valid = true;
+        ASSERT_TRUE(cctz::load_time_zone(from_name, &state->from_tz));
+        ASSERT_TRUE(cctz::load_time_zone(to_name, &state->to_tz));
+        FunctionConvertTZ<DataTypeDateTimeV2> func;
+        FunctionContext ctx;
+        ctx.set_function_state(FunctionContext::FRAGMENT_LOCAL, state);
+
+        auto string_column = [](const std::string& name) {
+            return ColumnConst::create(ColumnHelper::create_column<DataTypeString>({name}), 1);
+        };
+        Block block {ColumnWithTypeAndName {ColumnHelper::create_column<DataTypeDateTimeV2>(values),
+                                            std::make_shared<DataTypeDateTimeV2>(), "date"},
+                     ColumnWithTypeAndName {string_column(from_name),
+                                            std::make_shared<DataTypeString>(), "from_tz"},
+                     ColumnWithTypeAndName {string_column(to_name),
+                                            std::make_shared<DataTypeString>(), "to_tz"},
+                     ColumnWithTypeAndName {nullptr, std::make_shared<DataTypeDateTimeV2>(),
+                                            "result"}};
+        auto st = func.execute(&ctx, block, {0, 1, 2}, 3, values.size());
+        ASSERT_TRUE(st.ok()) << st.msg();
+
+        const auto& result = assert_cast<const ColumnNullable&>(*block.get_by_position(3).column);
+        const auto& data =
+                assert_cast<const ColumnDateTimeV2&>(result.get_nested_column()).get_data();
+        for (size_t i = 0; i < values.size(); ++i) {
+            auto value = binary_cast<UInt64, Value>(values[i]);
+            const auto instant = cctz::convert(
+                    cctz::civil_second(value.year(), value.month(), value.day(), value.hour(),
+                                       value.minute(), value.second()),
+                    state->from_tz);
+            const auto civil = cctz::convert(instant, state->to_tz);
+            ASSERT_FALSE(result.is_null_at(i));
+            EXPECT_EQ(data[i], datetime(static_cast<int>(civil.year()), civil.month(), civil.day(),
+                                        civil.hour(), civil.minute(), civil.second(),
+                                        value.microsecond()))
+                    << i;
+        }
+    }
+};
+
+TEST_F(FunctionConvertTZStateTest, FixedOffset) {
+    std::mt19937 rng(42);
+    std::vector<UInt64> values;
+    for (int i = 0; i < 1000; ++i) {
+        // July of 2024, within the daylight saving time of New York
+        values.push_back(datetime(2024, 7, 1 + static_cast<int>(rng() % 31),
+                                  static_cast<int>(rng() % 24), static_cast<int>(rng() % 60),
+                                  static_cast<int>(rng() % 60), rng() % 1000000));
+    }
+    values.push_back(datetime(2024, 7, 31, 23, 59, 59));
+    values.push_back(datetime(2024, 7, 1, 0, 0, 0));
+    check("UTC", "America/New_York", values);
+    check("America/New_York", "Asia/Shanghai", values);
+    check("Asia/Tokyo", "Asia/Kolkata", {datetime(2024, 12, 31, 23, 0, 0),
+                                         datetime(2025, 1, 1, 3, 0, 0),
+                                         datetime(2024, 2, 29, 1, 0, 0)});
+}
+
+TEST_F(FunctionConvertTZStateTest, AcrossTransition) {
+    // the clocks of New York moved forward at 2024-03-10 02:00:00
+    std::vector<UInt64> values;
+    for (int hour = 0; hour < 24; ++hour) {
+        values.push_back(datetime(2024, 3, 10, hour, 30, 0));
+        values.push_back(datetime(2024, 11, 3, hour, 30, 0));
+    }
+    check("UTC", "America/New_York", values);
+    check("America/New_York", "UTC", values);
+}
+
 } // namespace doris::vectorized
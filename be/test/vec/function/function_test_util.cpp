@@ -621,6 +621,51 @@ static Block* process_table_function(TableFunction* fn, Block* input_block,
     return output_block.release();
 }
 
+// the same as `process_table_function`, by the batch interface with small batches
+static Block* process_table_function_batch(TableFunction* fn, Block* input_block,
+                                           const InputTypeSet& output_types) {
+    ut_type::UTDataTypeDescs descs;
+    if (!parse_ut_data_type(output_types, descs)) {
+        return nullptr;
+    }
+    RuntimeState runtime_state((TQueryGlobals()));
+    if (fn->process_init(input_block, &runtime_state) != Status::OK()) {
+        LOG(WARNING) << "TableFunction process_init failed";
+        return nullptr;
+    }
+    vectorized::MutableColumnPtr column = descs[0].data_type->create_column();
+    if (column->is_nullable()) {
+        fn->set_nullable();
+    }
+
+    size_t row = 0;
+    while (row < input_block->rows()) {
+        IColumn::Offsets offsets;
+        size_t old_size = column->size();
+        size_t num_rows =
+                fn->get_batch_values(row, input_block->rows() - row, column, 3, offsets);
+        EXPECT_EQ(num_rows, offsets.size());
+        if (num_rows > 0) {
+            EXPECT_EQ(old_size + offsets.back(), column->size());
+            row += num_rows;
+            continue;
+        }
+        // the results of the row are more than a batch
+        fn->process_row(row++);
+        if (!fn->is_outer() && fn->current_empty()) {
+            continue;
+        }
+        do {
+            fn->get_value(column, 10);
+        } while (!fn->eos());
+    }
+    fn->process_close();
+
+    std::unique_ptr<Block> output_block = Block::create_unique();
+    output_block->insert({std::move(column), descs[0].data_type, descs[0].col_name});
+    return output_block.release();
+}
+
 void check_vec_table_function(TableFunction* fn, const InputTypeSet& input_types,
                               const InputDataSet& input_set, const InputTypeSet& output_types,
                               const InputDataSet& output_set, const bool test_get_value_func) {
@@ -635,14 +680,20 @@ void check_vec_table_function(TableFunction* fn, const InputTypeSet& input_types
             process_table_function(fn, input_block.get(), output_types, test_get_value_func));
     EXPECT_TRUE(real_output_block != nullptr);
 
-    // compare real_output_block with expect_output_block
-    EXPECT_EQ(expect_output_block->columns(), real_output_block->columns());
-    EXPECT_EQ(expect_output_block->rows(), real_output_block->rows());
-    for (size_t col = 0; col < expect_output_block->columns(); ++col) {
-        auto left_col = expect_output_block->get_by_position(col).column;
-        auto right_col = real_output_block->get_by_position(col).column;
-        for (size_t row = 0; row < expect_output_block->rows(); ++row) {
-            EXPECT_EQ(left_col->compare_at(row, row, *right_col, 0), 0);
+    std::unique_ptr<Block> batch_output_block(
+            process_table_function_batch(fn, input_block.get(), output_types));
+    EXPECT_TRUE(batch_output_block != nullptr);
+
+    // compare real_output_block and batch_output_block with expect_output_block
+    for (auto* output_block : {real_output_block.get(), batch_output_block.get()}) {
+        EXPECT_EQ(expect_output_block->columns(), output_block->columns());
+        EXPECT_EQ(expect_output_block->rows(), output_block->rows());
+        for (size_t col = 0; col < expect_output_block->columns(); ++col) {
+            auto left_col = expect_output_block->get_by_position(col).column;
+            auto right_col = output_block->get_by_position(col).column;
+            for (size_t row = 0; row < expect_output_block->rows(); ++row) {
+                EXPECT_EQ(left_col->compare_at(row, row, *right_col, 0), 0);
+            }
         }
     }
 }
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/functions/hyperscan_database_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace doris::vectorized {
+
+namespace {
+
+constexpr unsigned int FLAGS = HS_FLAG_DOTALL | HS_FLAG_SINGLEMATCH | HS_FLAG_UTF8;
+
+int on_match(unsigned int id, unsigned long long /* from */, // NOLINT
+             unsigned long long /* to */,                    // NOLINT
+             unsigned int /* flags */, void* context) {
+    static_cast<std::vector<unsigned int>*>(context)->push_back(id);
+    return 0;
+}
+
+std::vector<unsigned int> scan(const HyperscanDatabaseCache::HandlePtr& handle,
+                               const std::string& value) {
+    multiregexps::ScratchPtr scratch;
+    EXPECT_TRUE(handle->clone_scratch(&scratch).ok());
+    std::vector<unsigned int> ids;
+    EXPECT_EQ(hs_scan(handle->database(), value.data(), static_cast<unsigned int>(value.size()), 0,
+                      scratch.get(), on_match, &ids),
+              HS_SUCCESS);
+    return ids;
+}
+
+} // namespace
+
+TEST(HyperscanDatabaseCacheTest, Get) {
+    HyperscanDatabaseCache cache(16 * 1024 * 1024);
+    HyperscanDatabaseCache::HandlePtr handle;
+    ASSERT_TRUE(HyperscanDatabaseCache::get(&cache, {"err(or)?", "time.?out"}, FLAGS, &handle)
+                        .ok());
+    HyperscanDatabaseCache::HandlePtr cached;
+    ASSERT_TRUE(HyperscanDatabaseCache::get(&cache, {"err(or)?", "time.?out"}, FLAGS, &cached)
+                        .ok());
+    // compiled once
+    EXPECT_EQ(handle->database(), cached->database());
+    EXPECT_EQ(scan(cached, "an error"), std::vector<unsigned int> {0});
+    EXPECT_EQ(scan(cached, "timeout"), std::vector<unsigned int> {1});
+    EXPECT_TRUE(scan(cached, "ok").empty());
+
+    // the same bytes split into other patterns
+    HyperscanDatabaseCache::HandlePtr other;
+    ASSERT_TRUE(HyperscanDatabaseCache::get(&cache, {"err(or)?time", ".?out"}, FLAGS, &other)
+                        .ok());
+    EXPECT_NE(other->database(), handle->database());
+    HyperscanDatabaseCache::HandlePtr other_flags;
+    ASSERT_TRUE(HyperscanDatabaseCache::get(&cache, {"err(or)?", "time.?out"},
+                                            FLAGS | HS_FLAG_CASELESS, &other_flags)
+                        .ok());
+    EXPECT_EQ(scan(other_flags, "TIMEOUT"), std::vector<unsigned int> {1});
+}
+
+TEST(HyperscanDatabaseCacheTest, CompileError) {
+    HyperscanDatabaseCache cache(16 * 1024 * 1024);
+    HyperscanDatabaseCache::HandlePtr handle;
+    // back references are not supported by hyperscan, the error is cached
+    EXPECT_FALSE(HyperscanDatabaseCache::get(&cache, {"(a)\\1"}, FLAGS, &handle).ok());
+    EXPECT_FALSE(HyperscanDatabaseCache::get(&cache, {"(a)\\1"}, FLAGS, &handle).ok());
+    EXPECT_EQ(handle, nullptr);
+    EXPECT_FALSE(HyperscanDatabaseCache::get(nullptr, {"(a)\\1"}, FLAGS, &handle).ok());
+}
+
+TEST(HyperscanDatabaseCacheTest, Disabled) {
+    HyperscanDatabaseCache::HandlePtr handle;
+    ASSERT_TRUE(HyperscanDatabaseCache::get(nullptr, {"a.c"}, FLAGS, &handle).ok());
+    EXPECT_EQ(scan(handle, "xabcx"), std::vector<unsigned int> {0});
+}
+
+} // namespace doris::vectorized
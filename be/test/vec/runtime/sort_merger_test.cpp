@@ -17,8 +17,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_slot_ref.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/runtime/vsorted_run_merger.h"
@@ -485,4 +491,72 @@ TEST(SortMergerTest, TEST_SINGLE_STREAM) {
     }
 }
 
+TEST(SortMergerTest, MANY_RUNS_WITH_LONG_RUNS) {
+    /**
+     * 64 sorted runs of 3 blocks each, some runs overlap with each other and some runs hold
+     * long ranges of values that no other run has, so the merged output mixes single rows and
+     * long ranges of one run. The output must equal the sorted union of all the inputs.
+     */
+    const int num_children = 64;
+    const int num_blocks = 3;
+    const int block_rows = 100;
+    const int batch_size = 1024;
+    const int offset = 7;
+    std::mt19937 rng(20240501);
+
+    std::vector<std::vector<std::vector<int64_t>>> runs(num_children);
+    std::vector<int64_t> expected;
+    for (int child_idx = 0; child_idx < num_children; child_idx++) {
+        std::vector<int64_t> values(num_blocks * block_rows);
+        if (child_idx % 8 == 0) {
+            // a long range that is disjoint with the other runs
+            std::iota(values.begin(), values.end(), 1000000 + child_idx * 10000);
+        } else {
+            for (auto& v : values) {
+                v = rng() % 5000;
+            }
+            std::sort(values.begin(), values.end());
+        }
+        expected.insert(expected.end(), values.begin(), values.end());
+        for (int b = 0; b < num_blocks; b++) {
+            runs[child_idx].emplace_back(values.begin() + b * block_rows,
+                                         values.begin() + (b + 1) * block_rows);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    expected.erase(expected.begin(), expected.begin() + offset);
+
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto ordering_expr = MockSlotRef::create_mock_contexts(std::make_shared<DataTypeInt64>());
+    VSortedRunMerger merger(ordering_expr, {true}, {false}, batch_size, -1, offset, profile.get());
+    std::vector<int> round(num_children, 0);
+    std::vector<vectorized::BlockSupplier> child_block_suppliers;
+    for (int child_idx = 0; child_idx < num_children; child_idx++) {
+        child_block_suppliers.emplace_back(
+                [&, id = child_idx](vectorized::Block* block, bool* eos) {
+                    if (round[id] == num_blocks) {
+                        *eos = true;
+                        return Status::OK();
+                    }
+                    *block = ColumnHelper::create_block<DataTypeInt64>(runs[id][round[id]++]);
+                    return Status::OK();
+                });
+    }
+    EXPECT_TRUE(merger.prepare(child_block_suppliers).ok());
+
+    std::vector<int64_t> merged;
+    bool eos = false;
+    while (!eos) {
+        vectorized::Block block;
+        EXPECT_TRUE(merger.get_next(&block, &eos).ok());
+        EXPECT_LE(block.rows(), batch_size);
+        if (block.rows() > 0) {
+            const auto& data =
+                    assert_cast<const ColumnInt64&>(*block.get_by_position(0).column).get_data();
+            merged.insert(merged.end(), data.begin(), data.end());
+        }
+    }
+    EXPECT_EQ(merged, expected);
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/adaptive_compression_selector.h"
+
+#include <gtest/gtest.h>
+
+namespace doris::vectorized {
+
+class AdaptiveCompressionSelectorTest : public testing::Test {
+protected:
+    // Sample both codecs once with the given ratio and cost (ns per byte).
+    static void sample(AdaptiveCompressionSelector& selector, double network_bytes_per_ns,
+                       double lz4_ratio, double lz4_cost, double zstd_ratio, double zstd_cost) {
+        constexpr size_t bytes = 1 << 20;
+        for (int i = 0; i < 2; ++i) {
+            auto type = selector.next(network_bytes_per_ns);
+            ASSERT_TRUE(type == segment_v2::LZ4 || type == segment_v2::ZSTD);
+            double ratio = type == segment_v2::LZ4 ? lz4_ratio : zstd_ratio;
+            double cost = type == segment_v2::LZ4 ? lz4_cost : zstd_cost;
+            selector.update(type, bytes, size_t(bytes * ratio), int64_t(bytes * cost));
+        }
+    }
+};
+
+TEST_F(AdaptiveCompressionSelectorTest, UnknownNetworkUsesDefault) {
+    AdaptiveCompressionSelector selector(segment_v2::LZ4, 64);
+    EXPECT_EQ(selector.next(0), segment_v2::LZ4);
+    EXPECT_EQ(selector.next(-1), segment_v2::LZ4);
+}
+
+TEST_F(AdaptiveCompressionSelectorTest, IncompressibleDataOnFastNetwork) {
+    AdaptiveCompressionSelector selector(segment_v2::LZ4, 64);
+    // 10 bytes/ns, the data can not be compressed.
+    sample(selector, 10, 1.0, 0.5, 0.98, 3);
+    EXPECT_EQ(selector.next(10), segment_v2::NO_COMPRESSION);
+}
+
+TEST_F(AdaptiveCompressionSelectorTest, CompressibleDataOnSlowNetwork) {
+    AdaptiveCompressionSelector selector(segment_v2::LZ4, 64);
+    // 0.05 bytes/ns (~50MB/s), ZSTD compresses much better than LZ4.
+    sample(selector, 0.05, 0.5, 0.5, 0.25, 3);
+    EXPECT_EQ(selector.next(0.05), segment_v2::ZSTD);
+}
+
+TEST_F(AdaptiveCompressionSelectorTest, CompressibleDataOnFastNetwork) {
+    AdaptiveCompressionSelector selector(segment_v2::NO_COMPRESSION, 64);
+    // 1 byte/ns, LZ4 is cheap enough and ZSTD is too slow.
+    sample(selector, 1, 0.3, 0.2, 0.2, 3);
+    EXPECT_EQ(selector.next(1), segment_v2::LZ4);
+}
+
+TEST_F(AdaptiveCompressionSelectorTest, PeriodicResample) {
+    AdaptiveCompressionSelector selector(segment_v2::LZ4, 4);
+    sample(selector, 10, 1.0, 0.5, 0.98, 3);
+    // blocks 1 and 2 were samples, block 4 is sampled again.
+    EXPECT_EQ(selector.next(10), segment_v2::NO_COMPRESSION);
+    EXPECT_NE(selector.next(10), segment_v2::NO_COMPRESSION);
+    EXPECT_EQ(selector.next(10), segment_v2::NO_COMPRESSION);
+}
+
+} // namespace doris::vectorized
@@ -27,9 +27,11 @@
 #include <gen_cpp/internal_service.pb.h>
 #include <gtest/gtest.h>
 
+#include "common/config.h"
 #include "pipeline/dependency.h"
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_runtime_state.h"
+#include "util/defer_op.h"
 #include "vec/sink/varrow_flight_result_writer.h"
 
 namespace doris::vectorized {
@@ -374,4 +376,42 @@ TEST_F(ArrowResultBlockBufferTest, TestArrowResultSerializeFailure) {
     }
 }
 
+TEST_F(ArrowResultBlockBufferTest, TestBytesBackPressure) {
+    MockRuntimeState state;
+    state.batsh_size = 1024;
+    int buffer_size = 16;
+    auto dep = pipeline::Dependency::create_shared(0, 0, "Test", true);
+    auto ins_id = TUniqueId();
+    std::shared_ptr<arrow::Schema> schema;
+    ArrowFlightResultBlockBuffer buffer(TUniqueId(), &state, schema, buffer_size);
+    buffer.set_dependency(ins_id, dep);
+    auto old_limit = config::arrow_flight_result_sink_buffer_size_bytes;
+    Defer defer {[&]() { config::arrow_flight_result_sink_buffer_size_bytes = old_limit; }};
+    config::arrow_flight_result_sink_buffer_size_bytes = 8;
+
+    {
+        // 2 rows of int64 are not limited by the rows but by the bytes
+        auto in_block = std::make_shared<Block>(ColumnHelper::create_block<DataTypeInt64>({1, 2}));
+        EXPECT_TRUE(buffer.add_batch(&state, in_block).ok());
+        EXPECT_EQ(buffer._instance_rows[ins_id], 2);
+        EXPECT_EQ(buffer._instance_bytes[ins_id], 16);
+        EXPECT_EQ(buffer._instance_bytes_in_queue.back()[ins_id], 16);
+        EXPECT_FALSE(dep->ready());
+    }
+    {
+        std::shared_ptr<Block> result;
+        EXPECT_TRUE(buffer.get_arrow_batch(&result).ok());
+        EXPECT_EQ(result->rows(), 2);
+        EXPECT_EQ(buffer._instance_bytes[ins_id], 0);
+        EXPECT_TRUE(buffer._instance_bytes_in_queue.empty());
+        EXPECT_TRUE(dep->ready());
+    }
+    {
+        config::arrow_flight_result_sink_buffer_size_bytes = 0;
+        auto in_block = std::make_shared<Block>(ColumnHelper::create_block<DataTypeInt64>({1, 2}));
+        EXPECT_TRUE(buffer.add_batch(&state, in_block).ok());
+        EXPECT_TRUE(dep->ready());
+    }
+}
+
 } // namespace doris::vectorized
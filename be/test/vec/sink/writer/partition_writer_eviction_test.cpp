@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/writer/partition_writer_eviction.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace doris::vectorized {
+
+class PartitionWriterEvictionTest : public testing::Test {
+public:
+    struct MockPartitionWriter {
+        MockPartitionWriter(int64_t buffered_bytes, int64_t last_write_time)
+                : _buffered_bytes(buffered_bytes), _last_write_time(last_write_time) {}
+
+        int64_t buffered_bytes() const { return _buffered_bytes; }
+        int64_t last_write_time() const { return _last_write_time; }
+
+        Status close(const Status& status) {
+            ++_closed;
+            return _close_status;
+        }
+
+        int64_t _buffered_bytes;
+        int64_t _last_write_time;
+        int _closed = 0;
+        Status _close_status;
+    };
+
+    using Writers = std::unordered_map<std::string, std::shared_ptr<MockPartitionWriter>>;
+};
+
+TEST_F(PartitionWriterEvictionTest, UnderBudget) {
+    Writers writers;
+    writers["p1"] = std::make_shared<MockPartitionWriter>(100, 1);
+    writers["p2"] = std::make_shared<MockPartitionWriter>(100, 2);
+    int64_t evicted = 0;
+    EXPECT_TRUE(evict_partition_writers(&writers, 200, &evicted).ok());
+    EXPECT_EQ(writers.size(), 2);
+    // no limit
+    EXPECT_TRUE(evict_partition_writers(&writers, 0, &evicted).ok());
+    EXPECT_EQ(writers.size(), 2);
+    EXPECT_EQ(evicted, 0);
+}
+
+TEST_F(PartitionWriterEvictionTest, EvictLeastRecentlyWritten) {
+    Writers writers;
+    auto p1 = std::make_shared<MockPartitionWriter>(100, 4);
+    auto p2 = std::make_shared<MockPartitionWriter>(100, 1);
+    auto p3 = std::make_shared<MockPartitionWriter>(0, 0);
+    auto p4 = std::make_shared<MockPartitionWriter>(100, 3);
+    auto p5 = std::make_shared<MockPartitionWriter>(100, 2);
+    writers = {{"p1", p1}, {"p2", p2}, {"p3", p3}, {"p4", p4}, {"p5", p5}};
+    int64_t evicted = 0;
+    // 400 bytes are buffered, the oldest writers are closed until 150 bytes are left
+    EXPECT_TRUE(evict_partition_writers(&writers, 300, &evicted).ok());
+    EXPECT_EQ(evicted, 3);
+    EXPECT_EQ(p2->_closed, 1);
+    EXPECT_EQ(p5->_closed, 1);
+    EXPECT_EQ(p4->_closed, 1);
+    // the writer without buffered bytes is kept
+    EXPECT_EQ(p3->_closed, 0);
+    EXPECT_EQ(p1->_closed, 0);
+    EXPECT_EQ(writers.size(), 2);
+    EXPECT_TRUE(writers.contains("p1"));
+    EXPECT_TRUE(writers.contains("p3"));
+}
+
+TEST_F(PartitionWriterEvictionTest, CloseFailed) {
+    Writers writers;
+    auto p1 = std::make_shared<MockPartitionWriter>(100, 1);
+    p1->_close_status = Status::IOError("close failed");
+    writers = {{"p1", p1}, {"p2", std::make_shared<MockPartitionWriter>(100, 2)}};
+    int64_t evicted = 0;
+    EXPECT_FALSE(evict_partition_writers(&writers, 150, &evicted).ok());
+    EXPECT_EQ(p1->_closed, 1);
+    EXPECT_EQ(writers.size(), 1);
+    EXPECT_EQ(evicted, 0);
+}
+
+} // namespace doris::vectorized
@@ -54,6 +54,7 @@ Usage: $0 <options>
      --file-cache-microbench    build Backend file cache microbench tool. Default OFF.
      --cloud                    build Cloud. Default OFF.
      --index-tool               build Backend inverted index tool. Default OFF.
+     --segment-bench-tool       build Backend segment scan benchmark tool. Default OFF.
      --benchmark                build Google Benchmark. Default OFF.
      --broker                   build Broker. Default ON.
      --hive-udf                 build Hive UDF library for Ingestion Load. Default ON.
@@ -78,6 +79,7 @@ Usage: $0 <options>
     $0 --file-cache-microbench              build Backend file cache microbench tool
     $0 --cloud                              build Cloud
     $0 --index-tool                         build Backend inverted index tool
+    $0 --segment-bench-tool                 build Backend segment scan benchmark tool
     $0 --benchmark                          build Google Benchmark of Backend
     $0 --fe --clean                         clean and build Frontend.
     $0 --fe --be --clean                    clean and build Frontend and Backend
@@ -138,6 +140,7 @@ if ! OPTS="$(getopt \
     -l 'meta-tool' \
     -l 'file-cache-microbench' \
     -l 'index-tool' \
+    -l 'segment-bench-tool' \
     -l 'benchmark' \
     -l 'spark-dpp' \
     -l 'hive-udf' \
@@ -162,6 +165,7 @@ BUILD_BROKER=0
 BUILD_META_TOOL='OFF'
 BUILD_FILE_CACHE_MICROBENCH_TOOL='OFF'
 BUILD_INDEX_TOOL='OFF'
+BUILD_SEGMENT_BENCH_TOOL='OFF'
 BUILD_BENCHMARK='OFF'
 BUILD_BE_JAVA_EXTENSIONS=0
 BUILD_HIVE_UDF=0
@@ -183,6 +187,7 @@ if [[ "$#" == 1 ]]; then
     BUILD_META_TOOL='OFF'
     BUILD_FILE_CACHE_MICROBENCH_TOOL='OFF'
     BUILD_INDEX_TOOL='OFF'
+    BUILD_SEGMENT_BENCH_TOOL='OFF'
     BUILD_BENCHMARK='OFF'
     BUILD_HIVE_UDF=1
     BUILD_BE_JAVA_EXTENSIONS=1
@@ -221,6 +226,10 @@ else
             BUILD_INDEX_TOOL='ON'
             shift
             ;;
+        --segment-bench-tool)
+            BUILD_SEGMENT_BENCH_TOOL='ON'
+            shift
+            ;;
         --benchmark)
             BUILD_BENCHMARK='ON'
             BUILD_BE=1 # go into BE cmake building, but benchmark instead of doris_be
@@ -286,6 +295,7 @@ else
         BUILD_META_TOOL='ON'
         BUILD_FILE_CACHE_MICROBENCH_TOOL='OFF'
         BUILD_INDEX_TOOL='ON'
+        BUILD_SEGMENT_BENCH_TOOL='OFF'
         BUILD_HIVE_UDF=1
         BUILD_BE_JAVA_EXTENSIONS=1
         CLEAN=0
@@ -499,6 +509,7 @@ echo "Get params:
     BUILD_META_TOOL                     -- ${BUILD_META_TOOL}
     BUILD_FILE_CACHE_MICROBENCH_TOOL    -- ${BUILD_FILE_CACHE_MICROBENCH_TOOL}
     BUILD_INDEX_TOOL                    -- ${BUILD_INDEX_TOOL}
+    BUILD_SEGMENT_BENCH_TOOL            -- ${BUILD_SEGMENT_BENCH_TOOL}
     BUILD_BENCHMARK                     -- ${BUILD_BENCHMARK}
     BUILD_BE_JAVA_EXTENSIONS            -- ${BUILD_BE_JAVA_EXTENSIONS}
     BUILD_HIVE_UDF                      -- ${BUILD_HIVE_UDF}
@@ -603,6 +614,7 @@ if [[ "${BUILD_BE}" -eq 1 ]]; then
         -DBUILD_META_TOOL="${BUILD_META_TOOL}" \
         -DBUILD_FILE_CACHE_MICROBENCH_TOOL="${BUILD_FILE_CACHE_MICROBENCH_TOOL}" \
         -DBUILD_INDEX_TOOL="${BUILD_INDEX_TOOL}" \
+        -DBUILD_SEGMENT_BENCH_TOOL="${BUILD_SEGMENT_BENCH_TOOL}" \
         -DSTRIP_DEBUG_INFO="${STRIP_DEBUG_INFO}" \
         -DUSE_DWARF="${USE_DWARF}" \
         -DUSE_UNWIND="${USE_UNWIND}" \
@@ -825,6 +837,10 @@ EOF
         cp -r -p "${DORIS_HOME}/be/output/lib/index_tool" "${DORIS_OUTPUT}/be/lib"/
     fi
 
+    if [[ "${BUILD_SEGMENT_BENCH_TOOL}" = "ON" ]]; then
+        cp -r -p "${DORIS_HOME}/be/output/lib/segment_bench_tool" "${DORIS_OUTPUT}/be/lib"/
+    fi
+
     cp -r -p "${DORIS_HOME}/webroot/be"/* "${DORIS_OUTPUT}/be/www"/
     cp -r -p "${DORIS_HOME}/tools/FlameGraph"/* "${DORIS_OUTPUT}/be/tools/FlameGraph"/
     if [[ "${STRIP_DEBUG_INFO}" = "ON" ]]; then
@@ -299,6 +299,11 @@ extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_error_counter;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_conflict_counter;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_get_count_normalized;
 
+// txn lazy committer's bvars
+extern bvar::Adder<int64_t> g_bvar_txn_lazy_committer_waiting_tasks;
+extern bvar::Adder<int64_t> g_bvar_txn_lazy_committer_running_tasks;
+extern bvar::Adder<int64_t> g_bvar_txn_lazy_committer_conflict_retry_counter;
+
 extern bvar::Adder<int64_t> g_bvar_delete_bitmap_lock_txn_put_conflict_counter;
 extern bvar::Adder<int64_t> g_bvar_delete_bitmap_lock_txn_remove_conflict_by_fail_counter;
 extern bvar::Adder<int64_t> g_bvar_delete_bitmap_lock_txn_remove_conflict_by_load_counter;
@@ -93,6 +93,9 @@ CONF_Bool(enable_checker, "false");
 // The parallelism for parallel recycle operation
 // s3_producer_pool recycle_tablet_pool, delete single object in this pool
 CONF_Int32(recycle_pool_parallelism, "40");
+// The files of the recycled rowsets in one resource are split into batches of about this many
+// files, which are deleted in parallel in s3_producer_pool
+CONF_mInt32(recycler_delete_files_batch_size, "1000");
 // Currently only used for recycler test
 CONF_Bool(enable_inverted_check, "false");
 // Currently only used for recycler test
@@ -225,6 +228,12 @@ CONF_Validator(s3_put_bucket_tokens, [](int64_t config) -> bool { return config
 CONF_mInt64(s3_put_token_per_second, "1000000000000000000");
 CONF_Validator(s3_put_token_per_second, [](int64_t config) -> bool { return config > 0; });
 CONF_mInt64(s3_put_token_limit, "0");
+// The delete requests throttled by the object storage (503 SlowDown) are retried after a backoff
+// shared by all the deleting threads, which doubles on every throttled request and halves on
+// every successful one.
+CONF_mInt32(s3_delete_slow_down_retry_times, "10");
+CONF_mInt64(s3_delete_slow_down_min_backoff_ms, "100");
+CONF_mInt64(s3_delete_slow_down_max_backoff_ms, "10000");
 
 // The secondary package name of the MetaService.
 CONF_String(secondary_package_name, "");
@@ -280,6 +289,9 @@ CONF_Bool(enable_cloud_txn_lazy_commit, "true");
 CONF_Int32(txn_lazy_commit_rowsets_thresold, "1000");
 CONF_Int32(txn_lazy_commit_num_threads, "8");
 CONF_Int32(txn_lazy_max_rowsets_per_batch, "1000");
+// The base interval of the backoff before a lazy commit task retries the KV_TXN_CONFLICT,
+// the n-th retry sleeps (1 << (n - 1)) * base + random drift in [0, base] ms
+CONF_mInt32(txn_lazy_commit_retry_base_intervals_ms, "20");
 // max TabletIndexPB num for batch get
 CONF_Int32(max_tablet_index_num_per_batch, "1000");
 
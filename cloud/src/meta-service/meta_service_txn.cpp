@@ -868,6 +868,27 @@ void scan_tmp_rowset(
     return;
 }
 
+// Add `stats` to the serialized TabletStatsPB `val` of `key` and put it back
+static void add_tablet_stats(const std::string& key, std::string* val, const TabletStats& stats,
+                             std::unique_ptr<Transaction>& txn, MetaServiceCode& code,
+                             std::string& msg) {
+    TabletStatsPB stats_pb;
+    if (!stats_pb.ParseFromString(*val)) {
+        code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+        msg = fmt::format("malformed tablet stats value, key={}", hex(key));
+        return;
+    }
+    stats_pb.set_data_size(stats_pb.data_size() + stats.data_size);
+    stats_pb.set_num_rows(stats_pb.num_rows() + stats.num_rows);
+    stats_pb.set_num_rowsets(stats_pb.num_rowsets() + stats.num_rowsets);
+    stats_pb.set_num_segments(stats_pb.num_segments() + stats.num_segs);
+    stats_pb.set_index_size(stats_pb.index_size() + stats.index_size);
+    stats_pb.set_segment_size(stats_pb.segment_size() + stats.segment_size);
+    stats_pb.SerializeToString(val);
+    txn->put(key, *val);
+    LOG(INFO) << "put stats_tablet_key key=" << hex(key);
+}
+
 void update_tablet_stats(const StatsTabletKeyInfo& info, const TabletStats& stats,
                          std::unique_ptr<Transaction>& txn, MetaServiceCode& code,
                          std::string& msg) {
@@ -904,21 +925,59 @@ void update_tablet_stats(const StatsTabletKeyInfo& info, const TabletStats& stat
                               std::get<4>(info));
             return;
         }
-        TabletStatsPB stats_pb;
-        if (!stats_pb.ParseFromString(val)) {
-            code = MetaServiceCode::PROTOBUF_PARSE_ERR;
-            msg = fmt::format("malformed tablet stats value, key={}", hex(key));
+        add_tablet_stats(key, &val, stats, txn, code, msg);
+    }
+}
+
+void update_tablets_stats(const std::string& instance_id,
+                          const std::unordered_map<int64_t, TabletStats>& tablet_stats,
+                          std::unordered_map<int64_t, TabletIndexPB>& tablet_ids,
+                          std::unique_ptr<Transaction>& txn, MetaServiceCode& code,
+                          std::string& msg) {
+    std::vector<StatsTabletKeyInfo> infos;
+    infos.reserve(tablet_stats.size());
+    for (auto& [tablet_id, _] : tablet_stats) {
+        DCHECK(tablet_ids.count(tablet_id));
+        auto& tablet_idx = tablet_ids[tablet_id];
+        infos.push_back({instance_id, tablet_idx.table_id(), tablet_idx.index_id(),
+                         tablet_idx.partition_id(), tablet_id});
+    }
+    if (config::split_tablet_stats) {
+        // only atomic adds, nothing to read
+        size_t i = 0;
+        for (auto& [_, stats] : tablet_stats) {
+            update_tablet_stats(infos[i++], stats, txn, code, msg);
+            if (code != MetaServiceCode::OK) return;
+        }
+        return;
+    }
+
+    // Read the stats of all tablets in parallel rather than one round trip per tablet
+    std::vector<std::string> keys;
+    keys.reserve(infos.size());
+    for (auto& info : infos) {
+        stats_tablet_key(info, &keys.emplace_back());
+    }
+    std::vector<std::optional<std::string>> values;
+    TxnErrorCode err = txn->batch_get(&values, keys);
+    if (err != TxnErrorCode::TXN_OK) {
+        code = cast_as<ErrCategory::READ>(err);
+        msg = fmt::format("failed to batch get tablet stats, err={}", err);
+        return;
+    }
+    size_t i = 0;
+    for (auto& [tablet_id, stats] : tablet_stats) {
+        const auto& key = keys[i];
+        auto& val = values[i];
+        ++i;
+        if (!val.has_value()) {
+            code = MetaServiceCode::TABLET_NOT_FOUND;
+            msg = fmt::format("failed to get tablet stats, err={} tablet_id={}",
+                              TxnErrorCode::TXN_KEY_NOT_FOUND, tablet_id);
             return;
         }
-        stats_pb.set_data_size(stats_pb.data_size() + stats.data_size);
-        stats_pb.set_num_rows(stats_pb.num_rows() + stats.num_rows);
-        stats_pb.set_num_rowsets(stats_pb.num_rowsets() + stats.num_rowsets);
-        stats_pb.set_num_segments(stats_pb.num_segments() + stats.num_segs);
-        stats_pb.set_index_size(stats_pb.index_size() + stats.index_size);
-        stats_pb.set_segment_size(stats_pb.segment_size() + stats.segment_size);
-        stats_pb.SerializeToString(&val);
-        txn->put(key, val);
-        LOG(INFO) << "put stats_tablet_key key=" << hex(key);
+        add_tablet_stats(key, &val.value(), stats, txn, code, msg);
+        if (code != MetaServiceCode::OK) return;
     }
 }
 
@@ -1352,14 +1411,8 @@ void commit_txn_immediately(
         LOG(INFO) << "xxx put info_key=" << hex(info_key) << " txn_id=" << txn_id;
 
         // Update stats of affected tablet
-        for (auto& [tablet_id, stats] : tablet_stats) {
-            DCHECK(tablet_ids.count(tablet_id));
-            auto& tablet_idx = tablet_ids[tablet_id];
-            StatsTabletKeyInfo info {instance_id, tablet_idx.table_id(), tablet_idx.index_id(),
-                                     tablet_idx.partition_id(), tablet_id};
-            update_tablet_stats(info, stats, txn, code, msg);
-            if (code != MetaServiceCode::OK) return;
-        }
+        update_tablets_stats(instance_id, tablet_stats, tablet_ids, txn, code, msg);
+        if (code != MetaServiceCode::OK) return;
         // Remove tmp rowset meta
         for (auto& [k, _] : tmp_rowsets_meta) {
             txn->remove(k);
@@ -2381,69 +2434,8 @@ void commit_txn_with_sub_txn(const CommitTxnRequest* request, CommitTxnResponse*
     LOG(INFO) << "xxx put info_key=" << hex(info_key) << " txn_id=" << txn_id;
 
     // Update stats of affected tablet
-    std::deque<std::string> kv_pool;
-    std::function<void(const StatsTabletKeyInfo&, const TabletStats&)> update_tablet_stats;
-    if (config::split_tablet_stats) {
-        update_tablet_stats = [&](const StatsTabletKeyInfo& info, const TabletStats& stats) {
-            if (stats.num_segs > 0) {
-                auto& data_size_key = kv_pool.emplace_back();
-                stats_tablet_data_size_key(info, &data_size_key);
-                txn->atomic_add(data_size_key, stats.data_size);
-                auto& num_rows_key = kv_pool.emplace_back();
-                stats_tablet_num_rows_key(info, &num_rows_key);
-                txn->atomic_add(num_rows_key, stats.num_rows);
-                auto& num_segs_key = kv_pool.emplace_back();
-                stats_tablet_num_segs_key(info, &num_segs_key);
-                txn->atomic_add(num_segs_key, stats.num_segs);
-                auto& index_size_key = kv_pool.emplace_back();
-                stats_tablet_index_size_key(info, &index_size_key);
-                txn->atomic_add(index_size_key, stats.index_size);
-                auto& segment_size_key = kv_pool.emplace_back();
-                stats_tablet_segment_size_key(info, &segment_size_key);
-                txn->atomic_add(segment_size_key, stats.segment_size);
-            }
-            auto& num_rowsets_key = kv_pool.emplace_back();
-            stats_tablet_num_rowsets_key(info, &num_rowsets_key);
-            txn->atomic_add(num_rowsets_key, stats.num_rowsets);
-        };
-    } else {
-        update_tablet_stats = [&](const StatsTabletKeyInfo& info, const TabletStats& stats) {
-            auto& key = kv_pool.emplace_back();
-            stats_tablet_key(info, &key);
-            auto& val = kv_pool.emplace_back();
-            TxnErrorCode err = txn->get(key, &val);
-            if (err != TxnErrorCode::TXN_OK) {
-                code = err == TxnErrorCode::TXN_KEY_NOT_FOUND ? MetaServiceCode::TABLET_NOT_FOUND
-                                                              : cast_as<ErrCategory::READ>(err);
-                msg = fmt::format("failed to get tablet stats, err={} tablet_id={}", err,
-                                  std::get<4>(info));
-                return;
-            }
-            TabletStatsPB stats_pb;
-            if (!stats_pb.ParseFromString(val)) {
-                code = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                msg = fmt::format("malformed tablet stats value, key={}", hex(key));
-                return;
-            }
-            stats_pb.set_data_size(stats_pb.data_size() + stats.data_size);
-            stats_pb.set_num_rows(stats_pb.num_rows() + stats.num_rows);
-            stats_pb.set_num_rowsets(stats_pb.num_rowsets() + stats.num_rowsets);
-            stats_pb.set_num_segments(stats_pb.num_segments() + stats.num_segs);
-            stats_pb.set_index_size(stats_pb.index_size() + stats.index_size);
-            stats_pb.set_segment_size(stats_pb.segment_size() + stats.segment_size);
-            stats_pb.SerializeToString(&val);
-            txn->put(key, val);
-            LOG(INFO) << "put stats_tablet_key, key=" << hex(key);
-        };
-    }
-    for (auto& [tablet_id, stats] : tablet_stats) {
-        DCHECK(tablet_ids.count(tablet_id));
-        auto& tablet_idx = tablet_ids[tablet_id];
-        StatsTabletKeyInfo info {instance_id, tablet_idx.table_id(), tablet_idx.index_id(),
-                                 tablet_idx.partition_id(), tablet_id};
-        update_tablet_stats(info, stats);
-        if (code != MetaServiceCode::OK) return;
-    }
+    update_tablets_stats(instance_id, tablet_stats, tablet_ids, txn, code, msg);
+    if (code != MetaServiceCode::OK) return;
     // Remove tmp rowset meta
     for (auto& [_, tmp_rowsets_meta] : sub_txn_to_tmp_rowsets_meta) {
         for (auto& [k, _] : tmp_rowsets_meta) {
@@ -2751,19 +2743,35 @@ static void _abort_txn(const std::string& instance_id, const AbortTxnRequest* re
         }
 
         int64_t prepare_txn_id = 0;
+        // The prepared txn is usually the latest one, so all txn infos of the label are read
+        // together instead of one by one.
+        std::vector<std::string> cur_info_keys;
+        cur_info_keys.reserve(label_pb.txn_ids_size());
+        for (auto cur_txn_id : label_pb.txn_ids()) {
+            cur_info_keys.push_back(txn_info_key({instance_id, db_id, cur_txn_id}));
+        }
+        std::vector<std::optional<std::string>> cur_info_vals;
+        err = txn->batch_get(&cur_info_vals, cur_info_keys);
+        if (err != TxnErrorCode::TXN_OK) {
+            code = cast_as<ErrCategory::READ>(err);
+            std::stringstream ss;
+            ss << "txn->batch_get() failed, label=" << label << " err=" << err;
+            msg = ss.str();
+            return;
+        }
         //found prepare state txn for abort
-        for (auto& cur_txn_id : label_pb.txn_ids()) {
-            std::string cur_info_key = txn_info_key({instance_id, db_id, cur_txn_id});
-            std::string cur_info_val;
-            err = txn->get(cur_info_key, &cur_info_val);
-            if (err != TxnErrorCode::TXN_OK) {
+        for (int i = 0; i < label_pb.txn_ids_size(); ++i) {
+            int64_t cur_txn_id = label_pb.txn_ids(i);
+            std::string& cur_info_key = cur_info_keys[i];
+            if (!cur_info_vals[i].has_value()) {
+                err = TxnErrorCode::TXN_KEY_NOT_FOUND;
                 code = cast_as<ErrCategory::READ>(err);
                 std::stringstream ss;
                 ss << "txn->get() failed, cur_txn_id=" << cur_txn_id << " err=" << err;
                 msg = ss.str();
                 return;
             }
-            // ret == 0
+            const std::string& cur_info_val = cur_info_vals[i].value();
             TxnInfoPB cur_txn_info;
             if (!cur_txn_info.ParseFromString(cur_info_val)) {
                 code = MetaServiceCode::PROTOBUF_PARSE_ERR;
@@ -3941,26 +3949,31 @@ void MetaServiceImpl::get_txn_id(::google::protobuf::RpcController* controller,
         return;
     }
 
-    for (auto& cur_txn_id : label_pb.txn_ids()) {
-        const std::string cur_info_key = txn_info_key({instance_id, db_id, cur_txn_id});
-        std::string cur_info_val;
-        err = txn->get(cur_info_key, &cur_info_val);
-        if (err != TxnErrorCode::TXN_OK && err != TxnErrorCode::TXN_KEY_NOT_FOUND) {
-            code = cast_as<ErrCategory::READ>(err);
-            ss << "txn->get() failed, cur_txn_id=" << cur_txn_id << " label=" << label
-               << " err=" << err;
-            msg = ss.str();
-            return;
-        }
+    std::vector<std::string> cur_info_keys;
+    cur_info_keys.reserve(label_pb.txn_ids_size());
+    for (auto cur_txn_id : label_pb.txn_ids()) {
+        cur_info_keys.push_back(txn_info_key({instance_id, db_id, cur_txn_id}));
+    }
+    std::vector<std::optional<std::string>> cur_info_vals;
+    err = txn->batch_get(&cur_info_vals, cur_info_keys);
+    if (err != TxnErrorCode::TXN_OK) {
+        code = cast_as<ErrCategory::READ>(err);
+        ss << "txn->batch_get() failed, label=" << label << " err=" << err;
+        msg = ss.str();
+        return;
+    }
 
-        if (err == TxnErrorCode::TXN_KEY_NOT_FOUND) {
+    for (int i = 0; i < label_pb.txn_ids_size(); ++i) {
+        int64_t cur_txn_id = label_pb.txn_ids(i);
+        if (!cur_info_vals[i].has_value()) {
             //label_to_idx and txn info inconsistency.
             code = MetaServiceCode::TXN_ID_NOT_FOUND;
             ss << "txn->get() failed, cur_txn_id=" << cur_txn_id << " label=" << label
-               << " err=" << err;
+               << " err=" << TxnErrorCode::TXN_KEY_NOT_FOUND;
             msg = ss.str();
             return;
         }
+        const std::string& cur_info_val = cur_info_vals[i].value();
 
         TxnInfoPB cur_txn_info;
         if (!cur_txn_info.ParseFromString(cur_info_val)) {
@@ -17,8 +17,12 @@
 
 #include "txn_lazy_committer.h"
 
+#include <bthread/bthread.h>
+
 #include <chrono>
+#include <random>
 
+#include "common/bvars.h"
 #include "common/logging.h"
 #include "common/stats.h"
 #include "common/util.h"
@@ -37,9 +41,11 @@ void scan_tmp_rowset(
         std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>* tmp_rowsets_meta,
         KVStats* stats);
 
-void update_tablet_stats(const StatsTabletKeyInfo& info, const TabletStats& stats,
-                         std::unique_ptr<Transaction>& txn, MetaServiceCode& code,
-                         std::string& msg);
+void update_tablets_stats(const std::string& instance_id,
+                          const std::unordered_map<int64_t, TabletStats>& tablet_stats,
+                          std::unordered_map<int64_t, TabletIndexPB>& tablet_ids,
+                          std::unique_ptr<Transaction>& txn, MetaServiceCode& code,
+                          std::string& msg);
 
 void convert_tmp_rowsets(
         const std::string& instance_id, int64_t txn_id, std::shared_ptr<TxnKv> txn_kv,
@@ -184,14 +190,8 @@ void convert_tmp_rowsets(
         stats.segment_size += tmp_rowset_pb.data_disk_size();
     }
 
-    for (auto& [tablet_id, stats] : tablet_stats) {
-        DCHECK(tablet_ids.count(tablet_id));
-        auto& tablet_idx = tablet_ids[tablet_id];
-        StatsTabletKeyInfo info {instance_id, tablet_idx.table_id(), tablet_idx.index_id(),
-                                 tablet_idx.partition_id(), tablet_id};
-        update_tablet_stats(info, stats, txn, code, msg);
-        if (code != MetaServiceCode::OK) return;
-    }
+    update_tablets_stats(instance_id, tablet_stats, tablet_ids, txn, code, msg);
+    if (code != MetaServiceCode::OK) return;
 
     TEST_SYNC_POINT_RETURN_WITH_VOID("convert_tmp_rowsets::before_commit", &code);
     err = txn->commit();
@@ -289,6 +289,128 @@ void make_committed_txn_visible(const std::string& instance_id, int64_t db_id, i
     }
 }
 
+// Advance the versions of the partitions whose tmp rowsets have all been converted and remove
+// their tmp rowsets, in one kv txn for the whole group instead of one kv txn per partition.
+static void advance_partitions_version(
+        const std::string& instance_id, int64_t txn_id, int64_t db_id,
+        std::shared_ptr<TxnKv> txn_kv,
+        const std::vector<std::pair<
+                int64_t, const std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>*>>&
+                partitions,
+        std::unordered_map<int64_t, TabletIndexPB>& tablet_ids, MetaServiceCode& code,
+        std::string& msg) {
+    std::stringstream ss;
+    std::unique_ptr<Transaction> txn;
+    TxnErrorCode err = txn_kv->create_txn(&txn);
+    if (err != TxnErrorCode::TXN_OK) {
+        code = cast_as<ErrCategory::CREATE>(err);
+        ss << "failed to create txn, txn_id=" << txn_id << " err=" << err;
+        msg = ss.str();
+        LOG(WARNING) << msg;
+        return;
+    }
+
+    size_t num_advanced = 0;
+    for (const auto& [partition_id, tmp_rowset_metas] : partitions) {
+        int64_t table_id = -1;
+        DCHECK(tmp_rowset_metas->size() > 0);
+        if (tablet_ids.size() > 0) {
+            // get table_id from memory cache
+            table_id = tablet_ids.begin()->second.table_id();
+        } else {
+            // get table_id from storage
+            int64_t first_tablet_id = tmp_rowset_metas->begin()->second.tablet_id();
+            std::string tablet_idx_key = meta_tablet_idx_key({instance_id, first_tablet_id});
+            std::string tablet_idx_val;
+            err = txn->get(tablet_idx_key, &tablet_idx_val, true);
+            if (TxnErrorCode::TXN_OK != err) {
+                code = err == TxnErrorCode::TXN_KEY_NOT_FOUND ? MetaServiceCode::TXN_ID_NOT_FOUND
+                                                              : cast_as<ErrCategory::READ>(err);
+                ss << "failed to get tablet idx, txn_id=" << txn_id
+                   << " key=" << hex(tablet_idx_key) << " err=" << err;
+                msg = ss.str();
+                LOG(WARNING) << msg;
+                return;
+            }
+
+            TabletIndexPB tablet_idx_pb;
+            if (!tablet_idx_pb.ParseFromString(tablet_idx_val)) {
+                code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+                ss << "failed to parse tablet idx pb txn_id=" << txn_id
+                   << " key=" << hex(tablet_idx_key);
+                msg = ss.str();
+                return;
+            }
+            table_id = tablet_idx_pb.table_id();
+        }
+
+        DCHECK(table_id > 0);
+        DCHECK(partition_id > 0);
+
+        std::string ver_val;
+        std::string ver_key = partition_version_key({instance_id, db_id, table_id, partition_id});
+        err = txn->get(ver_key, &ver_val);
+        if (TxnErrorCode::TXN_OK != err) {
+            code = err == TxnErrorCode::TXN_KEY_NOT_FOUND ? MetaServiceCode::TXN_ID_NOT_FOUND
+                                                          : cast_as<ErrCategory::READ>(err);
+            ss << "failed to get partiton version, txn_id=" << txn_id << " key=" << hex(ver_key)
+               << " err=" << err;
+            msg = ss.str();
+            LOG(WARNING) << msg;
+            return;
+        }
+        VersionPB version_pb;
+        if (!version_pb.ParseFromString(ver_val)) {
+            code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+            ss << "failed to parse version pb txn_id=" << txn_id << " key=" << hex(ver_key);
+            msg = ss.str();
+            return;
+        }
+
+        if (version_pb.pending_txn_ids_size() == 0 || version_pb.pending_txn_ids(0) != txn_id) {
+            // the partition has been advanced by a previous round
+            continue;
+        }
+
+        DCHECK(version_pb.pending_txn_ids_size() == 1);
+        version_pb.clear_pending_txn_ids();
+        ver_val.clear();
+
+        if (version_pb.has_version()) {
+            version_pb.set_version(version_pb.version() + 1);
+        } else {
+            // first commit txn version is 2
+            version_pb.set_version(2);
+        }
+        if (!version_pb.SerializeToString(&ver_val)) {
+            code = MetaServiceCode::PROTOBUF_SERIALIZE_ERR;
+            ss << "failed to serialize version_pb when saving, txn_id=" << txn_id;
+            msg = ss.str();
+            return;
+        }
+        txn->put(ver_key, ver_val);
+        LOG(INFO) << "put ver_key=" << hex(ver_key) << " txn_id=" << txn_id
+                  << " version_pb=" << version_pb.ShortDebugString();
+
+        for (auto& [tmp_rowset_key, tmp_rowset_pb] : *tmp_rowset_metas) {
+            txn->remove(tmp_rowset_key);
+            LOG(INFO) << "remove tmp_rowset_key=" << hex(tmp_rowset_key) << " txn_id=" << txn_id;
+        }
+        ++num_advanced;
+    }
+
+    if (num_advanced == 0) return;
+
+    TEST_SYNC_POINT_CALLBACK("advance_partitions_version::before_commit", &num_advanced);
+    err = txn->commit();
+    if (err != TxnErrorCode::TXN_OK) {
+        code = cast_as<ErrCategory::COMMIT>(err);
+        ss << "failed to commit kv txn, txn_id=" << txn_id << " err=" << err;
+        msg = ss.str();
+        return;
+    }
+}
+
 TxnLazyCommitTask::TxnLazyCommitTask(const std::string& instance_id, int64_t txn_id,
                                      std::shared_ptr<TxnKv> txn_kv,
                                      TxnLazyCommitter* txn_lazy_committer)
@@ -300,10 +422,28 @@ TxnLazyCommitTask::TxnLazyCommitTask(const std::string& instance_id, int64_t txn
 }
 
 void TxnLazyCommitTask::commit() {
-    std::stringstream ss;
+    g_bvar_txn_lazy_committer_waiting_tasks << -1;
+    g_bvar_txn_lazy_committer_running_tasks << 1;
     int retry_times = 0;
+    int64_t retry_drift_ms = 0;
     do {
         LOG(INFO) << "lazy task commit txn_id=" << txn_id_ << " retry_times=" << retry_times;
+        if (retry_times > 0) {
+            // back off before retrying the conflict, so that the concurrent commits on the same
+            // partitions could make progress instead of aborting each other again
+            if (retry_times == 1) {
+                std::mt19937 rng(std::random_device {}());
+                retry_drift_ms = std::uniform_int_distribution<int64_t>(
+                        0, config::txn_lazy_commit_retry_base_intervals_ms)(rng);
+            }
+            int64_t duration_ms =
+                    (1L << (retry_times - 1)) * config::txn_lazy_commit_retry_base_intervals_ms +
+                    retry_drift_ms;
+            g_bvar_txn_lazy_committer_conflict_retry_counter << 1;
+            LOG(WARNING) << "lazy task commit conflict, txn_id=" << txn_id_ << " sleep "
+                         << duration_ms << " ms before retry_times=" << retry_times;
+            bthread_usleep(duration_ms * 1000);
+        }
         do {
             code_ = MetaServiceCode::OK;
             msg_.clear();
@@ -351,115 +491,32 @@ void TxnLazyCommitTask::commit() {
                     if (code_ != MetaServiceCode::OK) break;
                 }
                 if (code_ != MetaServiceCode::OK) break;
+            }
+            if (code_ != MetaServiceCode::OK) {
+                LOG(WARNING) << "txn_id=" << txn_id_ << " code=" << code_ << " msg=" << msg_;
+                break;
+            }
 
-                std::unique_ptr<Transaction> txn;
-                TxnErrorCode err = txn_kv_->create_txn(&txn);
-                if (err != TxnErrorCode::TXN_OK) {
-                    code_ = cast_as<ErrCategory::CREATE>(err);
-                    ss << "failed to create txn, txn_id=" << txn_id_ << " err=" << err;
-                    msg_ = ss.str();
-                    LOG(WARNING) << msg_;
-                    break;
-                }
-
-                int64_t table_id = -1;
-                DCHECK(tmp_rowset_metas.size() > 0);
-                if (table_id <= 0) {
-                    if (tablet_ids.size() > 0) {
-                        // get table_id from memory cache
-                        table_id = tablet_ids.begin()->second.table_id();
-                    } else {
-                        // get table_id from storage
-                        int64_t first_tablet_id = tmp_rowset_metas.begin()->second.tablet_id();
-                        std::string tablet_idx_key =
-                                meta_tablet_idx_key({instance_id_, first_tablet_id});
-                        std::string tablet_idx_val;
-                        err = txn->get(tablet_idx_key, &tablet_idx_val, true);
-                        if (TxnErrorCode::TXN_OK != err) {
-                            code_ = err == TxnErrorCode::TXN_KEY_NOT_FOUND
-                                            ? MetaServiceCode::TXN_ID_NOT_FOUND
-                                            : cast_as<ErrCategory::READ>(err);
-                            ss << "failed to get tablet idx, txn_id=" << txn_id_
-                               << " key=" << hex(tablet_idx_key) << " err=" << err;
-                            msg_ = ss.str();
-                            LOG(WARNING) << msg_;
-                            break;
-                        }
-
-                        TabletIndexPB tablet_idx_pb;
-                        if (!tablet_idx_pb.ParseFromString(tablet_idx_val)) {
-                            code_ = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                            ss << "failed to parse tablet idx pb txn_id=" << txn_id_
-                               << " key=" << hex(tablet_idx_key);
-                            msg_ = ss.str();
-                            break;
-                        }
-                        table_id = tablet_idx_pb.table_id();
-                    }
-                }
-
-                DCHECK(table_id > 0);
-                DCHECK(partition_id > 0);
-
-                std::string ver_val;
-                std::string ver_key =
-                        partition_version_key({instance_id_, db_id, table_id, partition_id});
-                err = txn->get(ver_key, &ver_val);
-                if (TxnErrorCode::TXN_OK != err) {
-                    code_ = err == TxnErrorCode::TXN_KEY_NOT_FOUND
-                                    ? MetaServiceCode::TXN_ID_NOT_FOUND
-                                    : cast_as<ErrCategory::READ>(err);
-                    ss << "failed to get partiton version, txn_id=" << txn_id_
-                       << " key=" << hex(ver_key) << " err=" << err;
-                    msg_ = ss.str();
-                    LOG(WARNING) << msg_;
-                    break;
-                }
-                VersionPB version_pb;
-                if (!version_pb.ParseFromString(ver_val)) {
-                    code_ = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                    ss << "failed to parse version pb txn_id=" << txn_id_
-                       << " key=" << hex(ver_key);
-                    msg_ = ss.str();
-                    break;
-                }
-
-                if (version_pb.pending_txn_ids_size() > 0 &&
-                    version_pb.pending_txn_ids(0) == txn_id_) {
-                    DCHECK(version_pb.pending_txn_ids_size() == 1);
-                    version_pb.clear_pending_txn_ids();
-                    ver_val.clear();
-
-                    if (version_pb.has_version()) {
-                        version_pb.set_version(version_pb.version() + 1);
-                    } else {
-                        // first commit txn version is 2
-                        version_pb.set_version(2);
-                    }
-                    if (!version_pb.SerializeToString(&ver_val)) {
-                        code_ = MetaServiceCode::PROTOBUF_SERIALIZE_ERR;
-                        ss << "failed to serialize version_pb when saving, txn_id=" << txn_id_;
-                        msg_ = ss.str();
-                        break;
-                    }
-                    txn->put(ver_key, ver_val);
-                    LOG(INFO) << "put ver_key=" << hex(ver_key) << " txn_id=" << txn_id_
-                              << " version_pb=" << version_pb.ShortDebugString();
-
-                    for (auto& [tmp_rowset_key, tmp_rowset_pb] : tmp_rowset_metas) {
-                        txn->remove(tmp_rowset_key);
-                        LOG(INFO) << "remove tmp_rowset_key=" << hex(tmp_rowset_key)
-                                  << " txn_id=" << txn_id_;
-                    }
-
-                    err = txn->commit();
-                    if (err != TxnErrorCode::TXN_OK) {
-                        code_ = cast_as<ErrCategory::COMMIT>(err);
-                        ss << "failed to commit kv txn, txn_id=" << txn_id_ << " err=" << err;
-                        msg_ = ss.str();
-                        break;
-                    }
+            // All tmp rowsets have been converted, advance the partition versions in groups. The
+            // tmp rowsets removed by a group are bounded by `txn_lazy_max_rowsets_per_batch`, so
+            // a kv txn of the group stays as small as a kv txn of the conversion.
+            std::vector<std::pair<
+                    int64_t, const std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>*>>
+                    group;
+            size_t group_rowsets = 0;
+            size_t num_partitions = 0;
+            for (auto& [partition_id, tmp_rowset_metas] : partition_to_tmp_rowset_metas) {
+                group.emplace_back(partition_id, &tmp_rowset_metas);
+                group_rowsets += tmp_rowset_metas.size();
+                if (++num_partitions < partition_to_tmp_rowset_metas.size() &&
+                    group_rowsets < static_cast<size_t>(config::txn_lazy_max_rowsets_per_batch)) {
+                    continue;
                 }
+                advance_partitions_version(instance_id_, txn_id_, db_id, txn_kv_, group,
+                                           tablet_ids, code_, msg_);
+                if (code_ != MetaServiceCode::OK) break;
+                group.clear();
+                group_rowsets = 0;
             }
             if (code_ != MetaServiceCode::OK) {
                 LOG(WARNING) << "txn_id=" << txn_id_ << " code=" << code_ << " msg=" << msg_;
@@ -469,6 +526,7 @@ void TxnLazyCommitTask::commit() {
         } while (false);
     } while (code_ == MetaServiceCode::KV_TXN_CONFLICT &&
              retry_times++ < config::txn_store_retry_times);
+    g_bvar_txn_lazy_committer_running_tasks << -1;
     {
         std::unique_lock<std::mutex> lock(mutex_);
         this->finished_ = true;
@@ -527,6 +585,7 @@ std::shared_ptr<TxnLazyCommitTask> TxnLazyCommitter::submit(const std::string& i
         task = std::make_shared<TxnLazyCommitTask>(instance_id, txn_id, txn_kv_, this);
         running_tasks_.emplace(txn_id, task);
     }
+    g_bvar_txn_lazy_committer_waiting_tasks << 1;
 
     worker_pool_->submit([task]() { task->commit(); });
     DCHECK(task != nullptr);
@@ -1695,8 +1695,8 @@ int InstanceRecycler::delete_rowset_data(
         const std::map<std::string, doris::RowsetMetaCloudPB>& rowsets, RowsetRecyclingState type,
         RecyclerMetricsContext& metrics_context) {
     int ret = 0;
-    // resource_id -> file_paths
-    std::map<std::string, std::vector<std::string>> resource_file_paths;
+    // resource_id -> batches of file_paths, the files of a rowset are in the same batch
+    std::map<std::string, std::vector<std::vector<std::string>>> resource_file_paths;
     // (resource_id, tablet_id, rowset_id)
     std::vector<std::tuple<std::string, int64_t, std::string>> rowsets_delete_by_prefix;
     bool is_formal_rowset = (type == RowsetRecyclingState::FORMAL_ROWSET);
@@ -1721,7 +1721,6 @@ int InstanceRecycler::delete_rowset_data(
             continue;
         }
 
-        auto& file_paths = resource_file_paths[rs.resource_id()];
         const auto& rowset_id = rs.rowset_id_v2();
         int64_t tablet_id = rs.tablet_id();
         int64_t num_segments = rs.num_segments();
@@ -1790,6 +1789,13 @@ int InstanceRecycler::delete_rowset_data(
             rowsets_delete_by_prefix.emplace_back(rs.resource_id(), tablet_id, rs.rowset_id_v2());
             continue;
         }
+        auto& file_path_batches = resource_file_paths[rs.resource_id()];
+        if (file_path_batches.empty() ||
+            file_path_batches.back().size() >=
+                    static_cast<size_t>(std::max(config::recycler_delete_files_batch_size, 1))) {
+            file_path_batches.emplace_back();
+        }
+        auto& file_paths = file_path_batches.back();
         for (int64_t i = 0; i < num_segments; ++i) {
             file_paths.push_back(segment_path(tablet_id, rowset_id, i));
             if (index_format == InvertedIndexStorageFormatPB::V1) {
@@ -1815,57 +1821,56 @@ int InstanceRecycler::delete_rowset_data(
     SyncExecutor<int> concurrent_delete_executor(_thread_pool_group.s3_producer_pool,
                                                  "delete_rowset_data",
                                                  [](const int& ret) { return ret != 0; });
-    for (auto& [resource_id, file_paths] : resource_file_paths) {
-        concurrent_delete_executor.add([&, rid = &resource_id, paths = &file_paths]() -> int {
-            DCHECK(accessor_map_.count(*rid))
-                    << "uninitilized accessor, instance_id=" << instance_id_
-                    << " resource_id=" << resource_id << " path[0]=" << (*paths)[0];
-            TEST_SYNC_POINT_CALLBACK("InstanceRecycler::delete_rowset_data.no_resource_id",
-                                     &accessor_map_);
-            if (!accessor_map_.contains(*rid)) {
-                LOG_WARNING("delete rowset data accessor_map_ does not contains resouce id")
-                        .tag("resource_id", resource_id)
-                        .tag("instance_id", instance_id_);
-                return -1;
-            }
-            auto& accessor = accessor_map_[*rid];
-            int ret = accessor->delete_files(*paths);
-            if (!ret) {
-                // deduplication of different files with the same rowset id
-                // 020000000000007fd045a62bc87a6587dd7ac274aa36e5a9_0.dat
-                //020000000000007fd045a62bc87a6587dd7ac274aa36e5a9_0.idx
-                std::set<std::string> deleted_rowset_id;
-
-                std::for_each(
-                        paths->begin(), paths->end(),
-                        [&metrics_context, &rowsets, &deleted_rowset_id](const std::string& path) {
-                            std::vector<std::string> str;
-                            butil::SplitString(path, '/', &str);
-                            std::string rowset_id;
-                            if (auto pos = str.back().find('_'); pos != std::string::npos) {
-                                rowset_id = str.back().substr(0, pos);
-                            } else {
-                                LOG(WARNING) << "failed to parse rowset_id, path=" << path;
-                                return;
-                            }
-                            auto rs_meta = rowsets.find(rowset_id);
-                            if (rs_meta != rowsets.end() &&
-                                !deleted_rowset_id.contains(rowset_id)) {
-                                deleted_rowset_id.emplace(rowset_id);
-                                metrics_context.total_recycled_data_size +=
-                                        rs_meta->second.total_disk_size();
-                                segment_metrics_context_.total_recycled_num +=
-                                        rs_meta->second.num_segments();
-                                segment_metrics_context_.total_recycled_data_size +=
-                                        rs_meta->second.total_disk_size();
-                                metrics_context.total_recycled_num++;
-                            }
-                        });
-                segment_metrics_context_.report();
-                metrics_context.report();
-            }
-            return ret;
-        });
+    for (auto& [resource_id, file_path_batches] : resource_file_paths) {
+        for (auto& file_paths : file_path_batches) {
+            concurrent_delete_executor.add([&, rid = &resource_id, paths = &file_paths]() -> int {
+                DCHECK(accessor_map_.count(*rid))
+                        << "uninitilized accessor, instance_id=" << instance_id_
+                        << " resource_id=" << resource_id << " path[0]=" << (*paths)[0];
+                TEST_SYNC_POINT_CALLBACK("InstanceRecycler::delete_rowset_data.no_resource_id",
+                                         &accessor_map_);
+                if (!accessor_map_.contains(*rid)) {
+                    LOG_WARNING("delete rowset data accessor_map_ does not contains resouce id")
+                            .tag("resource_id", resource_id)
+                            .tag("instance_id", instance_id_);
+                    return -1;
+                }
+                auto& accessor = accessor_map_[*rid];
+                int ret = accessor->delete_files(*paths);
+                if (!ret) {
+                    // deduplication of different files with the same rowset id
+                    // 020000000000007fd045a62bc87a6587dd7ac274aa36e5a9_0.dat
+                    //020000000000007fd045a62bc87a6587dd7ac274aa36e5a9_0.idx
+                    std::set<std::string> deleted_rowset_id;
+
+                    std::for_each(paths->begin(), paths->end(), [&](const std::string& path) {
+                        std::vector<std::string> str;
+                        butil::SplitString(path, '/', &str);
+                        std::string rowset_id;
+                        if (auto pos = str.back().find('_'); pos != std::string::npos) {
+                            rowset_id = str.back().substr(0, pos);
+                        } else {
+                            LOG(WARNING) << "failed to parse rowset_id, path=" << path;
+                            return;
+                        }
+                        auto rs_meta = rowsets.find(rowset_id);
+                        if (rs_meta != rowsets.end() && !deleted_rowset_id.contains(rowset_id)) {
+                            deleted_rowset_id.emplace(rowset_id);
+                            metrics_context.total_recycled_data_size +=
+                                    rs_meta->second.total_disk_size();
+                            segment_metrics_context_.total_recycled_num +=
+                                    rs_meta->second.num_segments();
+                            segment_metrics_context_.total_recycled_data_size +=
+                                    rs_meta->second.total_disk_size();
+                            metrics_context.total_recycled_num++;
+                        }
+                    });
+                    segment_metrics_context_.report();
+                    metrics_context.report();
+                }
+                return ret;
+            });
+        }
     }
     for (const auto& [resource_id, tablet_id, rowset_id] : rowsets_delete_by_prefix) {
         LOG_INFO(
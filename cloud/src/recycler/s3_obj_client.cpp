@@ -26,7 +26,10 @@
 #include <aws/s3/model/ListObjectsV2Request.h>
 #include <aws/s3/model/PutObjectRequest.h>
 
+#include <algorithm>
+#include <atomic>
 #include <ranges>
+#include <thread>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -55,6 +58,44 @@ auto s3_rate_limit(S3RateLimitType op, Func callback) -> decltype(callback()) {
     return callback();
 }
 
+// Backoff of the delete requests after the object storage replies SlowDown, shared by all the
+// deleting threads so that they slow down together.
+class SlowDownBackoff {
+public:
+    void wait() const {
+        int64_t ms = _backoff_ms.load(std::memory_order_relaxed);
+        if (ms > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        }
+    }
+
+    void on_slow_down() {
+        int64_t ms = _backoff_ms.load(std::memory_order_relaxed);
+        int64_t new_ms = std::min(std::max(ms * 2, config::s3_delete_slow_down_min_backoff_ms),
+                                  config::s3_delete_slow_down_max_backoff_ms);
+        _backoff_ms.compare_exchange_strong(ms, new_ms, std::memory_order_relaxed);
+    }
+
+    void on_success() {
+        int64_t ms = _backoff_ms.load(std::memory_order_relaxed);
+        if (ms == 0) {
+            return;
+        }
+        int64_t new_ms = ms / 2 < config::s3_delete_slow_down_min_backoff_ms ? 0 : ms / 2;
+        _backoff_ms.compare_exchange_strong(ms, new_ms, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> _backoff_ms {0};
+};
+
+static SlowDownBackoff s_delete_backoff;
+
+static bool is_slow_down(const Aws::S3::S3Error& error) {
+    return error.GetErrorType() == Aws::S3::S3Errors::SLOW_DOWN ||
+           error.GetResponseCode() == Aws::Http::HttpResponseCode::SERVICE_UNAVAILABLE;
+}
+
 template <typename Func>
 auto s3_get_rate_limit(Func callback) -> decltype(callback()) {
     return s3_rate_limit(S3RateLimitType::GET, std::move(callback));
@@ -229,36 +270,56 @@ ObjectStorageResponse S3ObjClient::delete_objects(const std::string& bucket,
             return delete_object({.bucket = bucket, .key = objects[0].GetKey()}).ret;
         }
 
-        Aws::S3::Model::Delete del;
-        del.WithObjects(std::move(objects)).SetQuiet(true);
-        delete_request.SetDelete(std::move(del));
-        auto delete_outcome = s3_put_rate_limit([&]() {
-            SCOPED_BVAR_LATENCY(s3_bvar::s3_delete_objects_latency);
-            return s3_client_->DeleteObjects(delete_request);
-        });
-        if (!delete_outcome.IsSuccess()) {
-            LOG_WARNING("failed to delete objects")
-                    .tag("endpoint", endpoint_)
-                    .tag("bucket", bucket)
-                    .tag("key[0]", delete_request.GetDelete().GetObjects().front().GetKey())
-                    .tag("responseCode",
-                         static_cast<int>(delete_outcome.GetError().GetResponseCode()))
-                    .tag("error", delete_outcome.GetError().GetMessage());
-            return -1;
-        }
+        for (int retry = 0;; ++retry) {
+            s_delete_backoff.wait();
+            Aws::S3::Model::Delete del;
+            del.WithObjects(objects).SetQuiet(true);
+            delete_request.SetDelete(std::move(del));
+            auto delete_outcome = s3_put_rate_limit([&]() {
+                SCOPED_BVAR_LATENCY(s3_bvar::s3_delete_objects_latency);
+                return s3_client_->DeleteObjects(delete_request);
+            });
+            if (!delete_outcome.IsSuccess()) {
+                if (is_slow_down(delete_outcome.GetError()) &&
+                    retry < config::s3_delete_slow_down_retry_times) {
+                    s_delete_backoff.on_slow_down();
+                    continue;
+                }
+                LOG_WARNING("failed to delete objects")
+                        .tag("endpoint", endpoint_)
+                        .tag("bucket", bucket)
+                        .tag("key[0]", objects.front().GetKey())
+                        .tag("responseCode",
+                             static_cast<int>(delete_outcome.GetError().GetResponseCode()))
+                        .tag("error", delete_outcome.GetError().GetMessage())
+                        .tag("retry", retry);
+                return -1;
+            }
 
-        if (!delete_outcome.IsSuccess()) {
-            LOG_WARNING("failed to delete objects")
-                    .tag("endpoint", endpoint_)
-                    .tag("bucket", bucket)
-                    .tag("key[0]", delete_request.GetDelete().GetObjects().front().GetKey())
-                    .tag("responseCode",
-                         static_cast<int>(delete_outcome.GetError().GetResponseCode()))
-                    .tag("error", delete_outcome.GetError().GetMessage());
-            return -1;
+            // A quiet delete reports only the keys failed to be deleted, retry the throttled ones
+            const auto& errors = delete_outcome.GetResult().GetErrors();
+            if (errors.empty()) {
+                s_delete_backoff.on_success();
+                return 0;
+            }
+            std::vector<Aws::S3::Model::ObjectIdentifier> throttled;
+            for (const auto& error : errors) {
+                if (error.GetCode() != "SlowDown" ||
+                    retry >= config::s3_delete_slow_down_retry_times) {
+                    LOG_WARNING("failed to delete object in batch")
+                            .tag("endpoint", endpoint_)
+                            .tag("bucket", bucket)
+                            .tag("key", error.GetKey())
+                            .tag("code", error.GetCode())
+                            .tag("error", error.GetMessage())
+                            .tag("retry", retry);
+                    return -1;
+                }
+                throttled.emplace_back().SetKey(error.GetKey());
+            }
+            s_delete_backoff.on_slow_down();
+            objects = std::move(throttled);
         }
-
-        return 0;
     };
 
     int ret = 0;
@@ -17,6 +17,8 @@
 
 #include <aws/core/Aws.h>
 #include <aws/s3/S3Client.h>
+#include <aws/s3/model/DeleteObjectsRequest.h>
+#include <aws/s3/model/DeleteObjectsResult.h>
 #include <aws/s3/model/ListObjectsV2Request.h>
 #include <aws/s3/model/ListObjectsV2Result.h>
 #include <aws/s3/model/Object.h>
@@ -63,6 +65,8 @@ public:
 
     MOCK_METHOD(Aws::S3::Model::ListObjectsV2Outcome, ListObjectsV2,
                 (const Aws::S3::Model::ListObjectsV2Request& request), (const, override));
+    MOCK_METHOD(Aws::S3::Model::DeleteObjectsOutcome, DeleteObjects,
+                (const Aws::S3::Model::DeleteObjectsRequest& request), (const, override));
 };
 
 TEST_F(S3AccessorMockTest, list_objects_compatibility) {
@@ -83,4 +87,45 @@ TEST_F(S3AccessorMockTest, list_objects_compatibility) {
     EXPECT_FALSE(response->is_valid());
 }
 
+TEST_F(S3AccessorMockTest, delete_objects_slow_down) {
+    auto mock_s3_client = std::make_shared<MockS3Client>();
+    S3ObjClient s3_obj_client(mock_s3_client, "dummy-endpoint");
+    auto min_backoff_ms = config::s3_delete_slow_down_min_backoff_ms;
+    config::s3_delete_slow_down_min_backoff_ms = 1;
+
+    std::vector<std::vector<std::string>> requested_keys;
+    auto record_keys = [&](const DeleteObjectsRequest& request) {
+        auto& keys = requested_keys.emplace_back();
+        for (const auto& object : request.GetDelete().GetObjects()) {
+            keys.push_back(object.GetKey());
+        }
+    };
+    // the whole request is throttled, then one of the keys
+    Aws::S3::S3Error slow_down(Aws::S3::S3Errors::SLOW_DOWN, "SlowDown",
+                               "Please reduce your request rate", true);
+    DeleteObjectsResult partially_throttled;
+    partially_throttled.AddErrors(Error().WithKey("key2").WithCode("SlowDown"));
+    EXPECT_CALL(*mock_s3_client, DeleteObjects(testing::_))
+            .WillOnce([&](const DeleteObjectsRequest& request) {
+                record_keys(request);
+                return DeleteObjectsOutcome(slow_down);
+            })
+            .WillOnce([&](const DeleteObjectsRequest& request) {
+                record_keys(request);
+                return DeleteObjectsOutcome(partially_throttled);
+            })
+            .WillOnce([&](const DeleteObjectsRequest& request) {
+                record_keys(request);
+                return DeleteObjectsOutcome(DeleteObjectsResult());
+            });
+
+    auto response = s3_obj_client.delete_objects("dummy-bucket", {"key1", "key2", "key3"}, {});
+    EXPECT_EQ(response.ret, 0);
+    ASSERT_EQ(requested_keys.size(), 3);
+    EXPECT_EQ(requested_keys[0], (std::vector<std::string> {"key1", "key2", "key3"}));
+    EXPECT_EQ(requested_keys[1], (std::vector<std::string> {"key1", "key2", "key3"}));
+    EXPECT_EQ(requested_keys[2], (std::vector<std::string> {"key2"}));
+    config::s3_delete_slow_down_min_backoff_ms = min_backoff_ms;
+}
+
 } // namespace doris::cloud